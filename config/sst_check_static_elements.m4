@@ -0,0 +1,33 @@
+AC_DEFUN([SST_CHECK_STATIC_ELEMENTS],
+[
+  AC_ARG_WITH([static-elements],
+    [AS_HELP_STRING([--with-static-elements=ARCHIVES],
+      [Link the comma separated list of element library archives into sstsim.x and sstinfo.x
+       instead of loading them at run time (Default: none)])])
+
+  AS_IF([test "$with_static_elements" = "yes"],
+    [AC_MSG_ERROR([--with-static-elements requires a list of element library archives])])
+
+  SST_LTLIBS_ELEMLIBS=
+  sst_check_static_elements_happy="no"
+
+  AS_IF([test ! -z "$with_static_elements" -a "$with_static_elements" != "no"],
+    [sst_check_static_elements_happy="yes"
+     for sst_static_element in `echo "$with_static_elements" | tr ',' ' '`; do
+       AS_IF([test ! -f "$sst_static_element"],
+         [AC_MSG_ERROR([Element library archive $sst_static_element not found])])
+       AS_IF([test "$sst_check_os_happy" = "yes"],
+         [SST_LTLIBS_ELEMLIBS="$SST_LTLIBS_ELEMLIBS -Wl,-force_load,$sst_static_element"],
+         [SST_LTLIBS_ELEMLIBS="$SST_LTLIBS_ELEMLIBS $sst_static_element"])
+     done
+     # Nothing in the core refers to the elements, they only register
+     # with the ELI database from their static initializers, so every
+     # object in the archives has to be linked in
+     AS_IF([test "$sst_check_os_happy" != "yes"],
+       [SST_LTLIBS_ELEMLIBS="-Wl,--whole-archive $SST_LTLIBS_ELEMLIBS -Wl,--no-whole-archive"])])
+
+  AC_SUBST([SST_LTLIBS_ELEMLIBS])
+
+  AC_MSG_CHECKING([for statically linked element libraries])
+  AC_MSG_RESULT([$sst_check_static_elements_happy])
+])
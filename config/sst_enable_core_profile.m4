@@ -8,4 +8,11 @@ AC_DEFUN([SST_ENABLE_CORE_PROFILE], [
   AS_IF([test "x$enable_profile" = "xyes" ],
 	[AC_DEFINE([__SST_ENABLE_PROFILE__], [1], [Defines if core should have profiling enabled.])])
 
+  AC_ARG_ENABLE([handler-profiling],
+    [AS_HELP_STRING([--disable-handler-profiling],
+      [Compiles out support for ProfileTools on clock and event handlers, removing a check from every handler call.])])
+
+  AS_IF([test "x$enable_handler_profiling" = "xno" ],
+	[AC_DEFINE([SST_DISABLE_HANDLER_PROFILING], [1], [Defines if ProfileTools on clock and event handlers are compiled out.])])
+
 ])
@@ -48,6 +48,7 @@ endif(CURSES_FOUND)
 
 check_include_file(execinfo.h HAVE_EXECINFO_H)
 check_symbol_exists(backtrace "execinfo.h" HAVE_BACKTRACE)
+check_include_file(linux/perf_event.h HAVE_LINUX_PERF_EVENT_H)
 check_include_file(mach/mach_time.h HAVE_MACH_MACH_TIME_H)
 check_include_file(mach-o/dyld.h HAVE_MACH_O_DYLD_H)
 check_symbol_exists(opendir "dirent.h" HAVE_OPENDIR)
@@ -152,6 +152,11 @@ public:
     /** Function which will be called when the time for this Activity comes to pass. */
     virtual void execute(void) = 0;
 
+    /** Whether the Activity was cancelled while in the TimeVortex.  A
+     * cancelled Activity does nothing when executed, so it can be
+     * dropped instead. */
+    virtual bool isCancelled() const { return false; }
+
     /** Set the time for which this Activity should be delivered */
     //设置活动的交付时间
     inline void setDeliveryTime(SimTime_t time) { delivery_time = time; }
@@ -226,9 +231,10 @@ protected:
     //可以存储或传输的形式的过程
     void serialize_order(SST::Core::Serialization::serializer& ser) override
     {
-        ser& delivery_time;
-        ser& priority_order;
-        ser& queue_order;
+        // delivery_time and priority_order are declared together and
+        // copied as a single block.  The queue order is set by the
+        // TimeVortex an Activity is inserted into, so isn't sent.
+        ser& SST::Core::Serialization::block(delivery_time, priority_order);
     }
     ImplementVirtualSerializable(SST::Activity)
 
@@ -240,7 +246,9 @@ protected:
     }
 
 private:
-    // Data members
+    // Data members.  serialize_order() copies delivery_time and
+    // priority_order as one block, so keep them adjacent and trivially
+    // copyable
     //用于存储活动的交付时间，记录活动应该在模拟的哪个时间点
     SimTime_t delivery_time;
     // This will hold both the priority (high bits) and the link order
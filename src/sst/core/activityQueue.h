@@ -35,6 +35,17 @@ public:
     /** Returns the next activity */
     virtual Activity* front()                    = 0;
 
+    /** Insert a range of activities into the queue.  The default
+     * inserts them one at a time; implementations can override this
+     * to take advantage of knowing the whole batch up front, and may
+     * reorder the range while doing so. */
+    virtual void insertBatch(Activity** begin, Activity** end)
+    {
+        for ( Activity** it = begin; it != end; ++it ) {
+            insert(*it);
+        }
+    }
+
 private:
 };
 
@@ -110,30 +110,59 @@ TimeConverter*
 BaseComponent::registerClock(const std::string& freq, Clock::HandlerBase* handler, bool regAll)
 {
     TimeConverter* tc = sim_->registerClock(freq, handler, CLOCKPRIORITY);
+    return finishClockRegistration(tc, handler, regAll);
+}
 
-    // Check to see if there is a profile tool installed
-    auto tools = sim_->getProfileTool<Profile::ClockHandlerProfileTool>("clock");
+TimeConverter*
+BaseComponent::registerClock(const UnitAlgebra& freq, Clock::HandlerBase* handler, bool regAll)
+{
+    TimeConverter* tc = sim_->registerClock(freq, handler, CLOCKPRIORITY);
+    return finishClockRegistration(tc, handler, regAll);
+}
 
-    for ( auto* tool : tools ) {
-        ClockHandlerMetaData mdata(my_info->getID(), getName(), getType());
-        // Add the receive profiler to the handler
-        handler->addProfileTool(tool, mdata);
-    }
+TimeConverter*
+BaseComponent::registerClock(TimeConverter* tc, Clock::HandlerBase* handler, bool regAll)
+{
+    TimeConverter* tcRet = sim_->registerClock(tc, handler, CLOCKPRIORITY);
+    return finishClockRegistration(tcRet, handler, regAll);
+}
 
-    // if regAll is true set tc as the default for the component and
-    // for all the links
-    if ( regAll ) {
-        setDefaultTimeBaseForLinks(tc);
-        my_info->defaultTimeBase = tc;
-    }
-    return tc;
+TimeConverter*
+BaseComponent::registerClock(const std::string& freq, Clock::SkipHandlerBase* handler, bool regAll)
+{
+    return registerClock(Simulation_impl::getTimeLord()->getTimeConverter(freq), handler, regAll);
 }
 
 TimeConverter*
-BaseComponent::registerClock(const UnitAlgebra& freq, Clock::HandlerBase* handler, bool regAll)
+BaseComponent::registerClock(const UnitAlgebra& freq, Clock::SkipHandlerBase* handler, bool regAll)
 {
-    TimeConverter* tc = sim_->registerClock(freq, handler, CLOCKPRIORITY);
+    return registerClock(Simulation_impl::getTimeLord()->getTimeConverter(freq), handler, regAll);
+}
+
+TimeConverter*
+BaseComponent::registerClock(TimeConverter* tc, Clock::SkipHandlerBase* handler, bool regAll)
+{
+    TimeConverter* tcRet = sim_->registerClock(tc, handler, CLOCKPRIORITY);
+    return finishClockRegistration(tcRet, handler, regAll);
+}
+
+Clock::SuspendHandle
+BaseComponent::registerSuspendableClock(const std::string& freq, Clock::HandlerBase* handler, bool regAll)
+{
+    return registerSuspendableClock(Simulation_impl::getTimeLord()->getTimeConverter(freq), handler, regAll);
+}
 
+Clock::SuspendHandle
+BaseComponent::registerSuspendableClock(TimeConverter* tc, Clock::HandlerBase* handler, bool regAll)
+{
+    Clock::SuspendHandle handle = sim_->registerSuspendableClock(tc, handler, CLOCKPRIORITY);
+    finishClockRegistration(tc, handler, regAll);
+    return handle;
+}
+
+TimeConverter*
+BaseComponent::finishClockRegistration(TimeConverter* tc, SSTHandlerBaseProfile* handler, bool regAll)
+{
     // Check to see if there is a profile tool installed
     auto tools = sim_->getProfileTool<Profile::ClockHandlerProfileTool>("clock");
 
@@ -152,27 +181,19 @@ BaseComponent::registerClock(const UnitAlgebra& freq, Clock::HandlerBase* handle
     return tc;
 }
 
-TimeConverter*
-BaseComponent::registerClock(TimeConverter* tc, Clock::HandlerBase* handler, bool regAll)
+ClockBatch*
+BaseComponent::addToClockBatch(
+    const std::string& freq, const std::type_info& type, ClockBatch* (*create)(), size_t& index, bool regAll)
 {
-    TimeConverter* tcRet = sim_->registerClock(tc, handler, CLOCKPRIORITY);
-
-    // Check to see if there is a profile tool installed
-    auto tools = sim_->getProfileTool<Profile::ClockHandlerProfileTool>("clock");
-
-    for ( auto* tool : tools ) {
-        ClockHandlerMetaData mdata(my_info->getID(), getName(), getType());
-        // Add the receive profiler to the handler
-        handler->addProfileTool(tool, mdata);
-    }
+    TimeConverter* tc    = Simulation_impl::getTimeLord()->getTimeConverter(freq);
+    ClockBatch*    batch = sim_->getClockBatch(tc, type, create);
+    index                = batch->add();
 
-    // if regAll is true set tc as the default for the component and
-    // for all the links
     if ( regAll ) {
-        setDefaultTimeBaseForLinks(tcRet);
-        my_info->defaultTimeBase = tcRet;
+        setDefaultTimeBaseForLinks(tc);
+        my_info->defaultTimeBase = tc;
     }
-    return tcRet;
+    return batch;
 }
 
 Cycle_t
@@ -181,6 +202,12 @@ BaseComponent::reregisterClock(TimeConverter* freq, Clock::HandlerBase* handler)
     return sim_->reregisterClock(freq, handler, CLOCKPRIORITY);
 }
 
+Cycle_t
+BaseComponent::reregisterClock(TimeConverter* freq, Clock::SkipHandlerBase* handler)
+{
+    return sim_->reregisterClock(freq, handler, CLOCKPRIORITY);
+}
+
 Cycle_t
 BaseComponent::getNextClockCycle(TimeConverter* freq)
 {
@@ -193,6 +220,12 @@ BaseComponent::unregisterClock(TimeConverter* tc, Clock::HandlerBase* handler)
     sim_->unregisterClock(tc, handler, CLOCKPRIORITY);
 }
 
+void
+BaseComponent::unregisterClock(TimeConverter* tc, Clock::SkipHandlerBase* handler)
+{
+    sim_->unregisterClock(tc, handler, CLOCKPRIORITY);
+}
+
 TimeConverter*
 BaseComponent::registerTimeBase(const std::string& base, bool regAll)
 {
@@ -303,6 +336,8 @@ BaseComponent::configureLink(const std::string& name, TimeConverter* time_base,
             auto tools = sim_->getProfileTool<Profile::EventHandlerProfileTool>("event");
             for ( auto& tool : tools ) {
                 EventHandlerMetaData mdata(my_info->getID(), getName(), getType(), name);
+                mdata.peer_rank = tmp->getPeerRank();
+                if ( !mdata.peer_rank.isAssigned() ) mdata.peer_rank = sim_->getRank();
 
                 // Add the receive profiler to the handler
                 if ( tool->profileReceives() ) handler->addProfileTool(tool, mdata);
@@ -384,6 +419,32 @@ BaseComponent::configureSelfLink(const std::string& name, Event::HandlerBase* ha
     return configureLink(name, handler);
 }
 
+void
+BaseComponent::serialize_order(SST::Core::Serialization::serializer& UNUSED(ser))
+{
+    fatal(CALL_INFO, 1, "Element does not support checkpointing (serialize_order() is not implemented)\n");
+}
+
+void
+BaseComponent::serializeStatistics(SST::Core::Serialization::serializer& ser)
+{
+    for ( auto& stat : m_explicitlyEnabledSharedStats ) {
+        stat.second->serialize_order(ser);
+    }
+    for ( auto& id : m_explicitlyEnabledUniqueStats ) {
+        for ( auto& name : id.second ) {
+            for ( auto& stat : name.second ) {
+                stat.second->serialize_order(ser);
+            }
+        }
+    }
+    for ( auto& name : m_enabledAllStats ) {
+        for ( auto& stat : name.second ) {
+            stat.second->serialize_order(ser);
+        }
+    }
+}
+
 UnitAlgebra
 BaseComponent::getCoreTimeBase() const
 {
@@ -542,6 +603,15 @@ BaseComponent::isSimulationRunModeBoth() const
     return sim_->getSimulationMode() == SimulationRunMode::BOTH;
 }
 
+void
+BaseComponent::requestUntimedPhase()
+{
+    ComponentInfo* info = my_info;
+    while ( info->parent_info != nullptr )
+        info = info->parent_info;
+    info->untimed_requested = true;
+}
+
 std::string&
 BaseComponent::getOutputDirectory() const
 {
@@ -554,11 +624,18 @@ BaseComponent::requireLibrary(const std::string& name)
     sim_->requireLibrary(name);
 }
 
+const Factory::StatIndex*
+BaseComponent::getStatIndex() const
+{
+    if ( nullptr == stat_index ) stat_index = Factory::getFactory()->getStatIndex(my_info->getType());
+    return stat_index;
+}
+
 bool
 BaseComponent::doesComponentInfoStatisticExist(const std::string& statisticName) const
 {
-    const std::string& type = my_info->getType();
-    return Factory::getFactory()->DoesComponentInfoStatisticNameExist(type, statisticName);
+    const Factory::StatIndex* index = getStatIndex();
+    return index->find(statisticName) != index->end();
 }
 
 StatisticProcessingEngine*
@@ -644,7 +721,10 @@ BaseComponent::getSimulation() const
 uint8_t
 BaseComponent::getComponentInfoStatisticEnableLevel(const std::string& statisticName) const
 {
-    return Factory::getFactory()->GetComponentInfoStatisticEnableLevel(my_info->type, statisticName);
+    const Factory::StatIndex* index = getStatIndex();
+    auto                      stat  = index->find(statisticName);
+    if ( stat == index->end() ) return 0;
+    return stat->second->enableLevel;
 }
 
 void
@@ -701,6 +781,8 @@ BaseComponent::createStatistic(
     Params& cpp_params, const Params& python_params, const std::string& name, const std::string& subId,
     bool check_load_level, StatCreateFunction fxn)
 {
+    // The statistics engine is shared by all components in this thread
+    auto  lock   = sim_->getConstructLock();
     auto* engine = getStatEngine();
 
     if ( check_load_level ) {
@@ -804,13 +886,11 @@ BaseComponent::createExplicitlyEnabledStatistic(
 void
 BaseComponent::configureAllowedStatParams(SST::Params& params)
 {
-    // Identify what keys are Allowed in the parameters
-    Params::KeySet_t allowedKeySet;
-    allowedKeySet.insert("type");
-    allowedKeySet.insert("rate");
-    allowedKeySet.insert("startat");
-    allowedKeySet.insert("stopat");
-    allowedKeySet.insert("resetOnRead");
+    // Identify what keys are Allowed in the parameters.  The set is
+    // the same for every statistic, so it is only built once.
+    static const Params::KeySet_t allowedKeySet = {
+        "type", "rate", "startat", "stopat", "resetOnRead", "sharedname", "samplemode", "sampleinterval", "sampleseed"
+    };
     params.pushAllowedKeys(allowedKeySet);
 }
 
@@ -13,6 +13,7 @@
 #define SST_CORE_BASECOMPONENT_H
 
 #include "sst/core/clock.h"
+#include "sst/core/clockBatch.h"
 #include "sst/core/componentInfo.h"
 #include "sst/core/eli/elementinfo.h"
 #include "sst/core/event.h"
@@ -26,6 +27,8 @@
 
 #include <map>
 #include <string>
+#include <type_traits>
+#include <typeinfo>
 
 using namespace SST::Statistics;
 
@@ -55,6 +58,7 @@ class BaseComponent
     friend class ComponentInfo;
     friend class SubComponent;
     friend class SubComponentSlotInfo;
+    friend class Simulation_impl;
 
 protected:
     using StatCreateFunction = std::function<Statistics::StatisticBase*(
@@ -87,7 +91,8 @@ public:
 
     /** Used during the init phase.  The method will be called each
      phase of initialization.  Initialization ends when no components
-     have sent any data. */
+     have sent any data.  See requestUntimedPhase() for when the
+     method is called with --active-untimed-phases. */
     virtual void init(unsigned int UNUSED(phase)) {}
     /** Used during the complete phase after the end of simulation.
      The method will be called each phase of complete. Complete phase
@@ -111,6 +116,20 @@ public:
      */
     virtual void printStatus(Output& UNUSED(out)) { return; }
 
+    /**
+     * Called by the Simulation to save the state of the component to
+     * a checkpoint, or to restore it when restarting from one.  On a
+     * restart the component has already been constructed from the
+     * input file, but init() and setup() are not called, so only the
+     * state that changes once the simulation starts needs to be
+     * serialized.  Links, events in flight, clocks and statistics are
+     * handled by the core, and SubComponents are called separately.
+     * The default implementation is fatal, so components have to opt
+     * in to checkpointing.
+     * @param ser The serializer used to save or restore the state
+     */
+    virtual void serialize_order(SST::Core::Serialization::serializer& ser);
+
     /** Get the core timebase */
     UnitAlgebra getCoreTimeBase() const;
     /** Return the current simulation time as a cycle count*/
@@ -185,6 +204,15 @@ protected:
      */
     bool isSimulationRunModeBoth() const;
 
+    /** Ask for init() or complete() to be called in the next untimed
+     *  phase.  With --active-untimed-phases, phases after phase 0 are
+     *  only called on Components that have untimed data waiting on
+     *  one of their links or that called this during the previous
+     *  phase.  It does not keep the phases going if no data was
+     *  sent.  Calls from a SubComponent apply to its Component.
+     */
+    void requestUntimedPhase();
+
     /** Returns the output directory of the simulation
      *  @return Directory in which simulation outputs should be
      *  placed.  Returns empty string if output directory not set by
@@ -303,9 +331,81 @@ protected:
     */
     TimeConverter* registerClock(TimeConverter* tc, Clock::HandlerBase* handler, bool regAll = true);
 
+    /** Registers a clock for this component with a handler that is
+        only called on the cycles it asks for (see Clock::SkipHandler).
+        @param freq Frequency for the clock in SI units
+        @param handler Pointer to Clock::SkipHandlerBase which is to be
+        invoked at the specified interval
+        @param regAll Should this clock period be used as the default
+        time base for all of the links connected to this component
+        @return the TimeConverter object representing the clock frequency
+    */
+    TimeConverter* registerClock(const std::string& freq, Clock::SkipHandlerBase* handler, bool regAll = true);
+
+    /** Registers a clock for this component with a handler that is
+        only called on the cycles it asks for (see Clock::SkipHandler).
+        @param freq Frequency for the clock as a UnitAlgebra object
+        @param handler Pointer to Clock::SkipHandlerBase which is to be
+        invoked at the specified interval
+        @param regAll Should this clock period be used as the default
+        time base for all of the links connected to this component
+        @return the TimeConverter object representing the clock frequency
+    */
+    TimeConverter* registerClock(const UnitAlgebra& freq, Clock::SkipHandlerBase* handler, bool regAll = true);
+
+    /** Registers a clock for this component with a handler that is
+        only called on the cycles it asks for (see Clock::SkipHandler).
+        @param tc TimeConverter object specifying the clock frequency
+        @param handler Pointer to Clock::SkipHandlerBase which is to be
+        invoked at the specified interval
+        @param regAll Should this clock period be used as the default
+        time base for all of the links connected to this component
+        @return the TimeConverter object representing the clock frequency
+    */
+    TimeConverter* registerClock(TimeConverter* tc, Clock::SkipHandlerBase* handler, bool regAll = true);
+
+    /** Registers a clock handler that can be suspended and resumed
+        cheaply, for components that go idle often.  Suspending the
+        handler keeps its place on the clock instead of removing it,
+        and returning true from the handler suspends it.  See
+        Clock::registerSuspendable().
+        @param freq Frequency for the clock in SI units
+        @param handler Pointer to Clock::HandlerBase which is to be invoked
+        at the specified interval
+        @param regAll Should this clock period be used as the default
+        time base for all of the links connected to this component
+        @return Handle used to suspend and resume the handler
+    */
+    Clock::SuspendHandle
+    registerSuspendableClock(const std::string& freq, Clock::HandlerBase* handler, bool regAll = true);
+
+    /** Registers a clock handler that can be suspended and resumed
+        cheaply.  See the other registerSuspendableClock().
+        @param tc TimeConverter object specifying the clock frequency
+        @param handler Pointer to Clock::HandlerBase which is to be invoked
+        at the specified interval
+        @param regAll Should this clock period be used as the default
+        time base for all of the links connected to this component
+        @return Handle used to suspend and resume the handler
+    */
+    Clock::SuspendHandle registerSuspendableClock(TimeConverter* tc, Clock::HandlerBase* handler, bool regAll = true);
+
+    /** Stops calling a handler registered with
+        registerSuspendableClock() until it is resumed */
+    void suspendClock(Clock::SuspendHandle handle) { handle.clock->suspend(handle.slot); }
+
+    /** Calls a suspended handler again, starting with the next cycle
+        of its clock.  See the note on reregisterClock().
+        @return The cycle the handler is next called on
+    */
+    Cycle_t resumeClock(Clock::SuspendHandle handle) { return handle.clock->resume(handle.slot); }
+
     /** Removes a clock handler from the component */
     void unregisterClock(TimeConverter* tc, Clock::HandlerBase* handler);
 
+    /** Removes a clock handler from the component */
+    void unregisterClock(TimeConverter* tc, Clock::SkipHandlerBase* handler);
+
     /** Reactivates an existing Clock and Handler
      * @return time of next time clock handler will fire
      *
@@ -317,6 +417,13 @@ protected:
      */
     Cycle_t reregisterClock(TimeConverter* freq, Clock::HandlerBase* handler);
 
+    /** Reactivates an existing Clock and a handler that can skip ahead.
+     * The handler is called on the next cycle.  See the note on the
+     * other reregisterClock().
+     * @return time of next time clock handler will fire
+     */
+    Cycle_t reregisterClock(TimeConverter* freq, Clock::SkipHandlerBase* handler);
+
     /** Returns the next Cycle that the TimeConverter would fire
         If called prior to the simulation run loop, next Cycle is 0.
         If called after the simulation run loop completes (e.g., during
@@ -326,6 +433,24 @@ protected:
      */
     Cycle_t getNextClockCycle(TimeConverter* freq);
 
+    /** Adds this component to the batch of type batchT on a clock, to
+        be updated together with the other components in the batch
+        instead of through a handler of its own (see ClockBatch).  The
+        batch is created by the first component that registers with it.
+        @param freq Frequency for the clock in SI units
+        @param index Set to the component's slot in the batch
+        @param regAll Should this clock period be used as the default
+        time base for all of the links connected to this component
+        @return the batch
+    */
+    template <class batchT>
+    batchT* registerClockBatch(const std::string& freq, size_t& index, bool regAll = true)
+    {
+        static_assert(std::is_base_of<ClockBatch, batchT>::value, "batchT must derive from SST::ClockBatch");
+        return static_cast<batchT*>(
+            addToClockBatch(freq, typeid(batchT), []() -> ClockBatch* { return new batchT(); }, index, regAll));
+    }
+
     /** Registers a default time base for the component and optionally
         sets the the component's links to that timebase. Useful for
         components which do not have a clock, but would like a default
@@ -874,9 +999,26 @@ private:
     Simulation_impl* sim_    = nullptr;
     bool             isExtension;
 
+    // Statistics in the ELI of this type, looked up on first use
+    mutable const Factory::StatIndex* stat_index = nullptr;
+
+    const Factory::StatIndex* getStatIndex() const;
+
     void  addSelfLink(const std::string& name);
     Link* getLinkFromParentSharedPort(const std::string& port);
 
+    /** Attaches the clock profile tools to a newly registered clock
+     * handler and sets the default time base if regAll is true */
+    TimeConverter* finishClockRegistration(TimeConverter* tc, SSTHandlerBaseProfile* handler, bool regAll);
+
+    /** Non-template part of registerClockBatch() */
+    ClockBatch* addToClockBatch(
+        const std::string& freq, const std::type_info& type, ClockBatch* (*create)(), size_t& index, bool regAll);
+
+    /** Save or restore the collected data of the statistics owned by
+     * this component for a checkpoint */
+    void serializeStatistics(SST::Core::Serialization::serializer& ser);
+
     using StatNameMap = std::map<std::string, std::map<std::string, Statistics::StatisticBase*>>;
 
     std::map<StatisticId_t, Statistics::StatisticBase*> m_explicitlyEnabledSharedStats;
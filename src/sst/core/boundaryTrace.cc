@@ -0,0 +1,377 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/boundaryTrace.h"
+
+#include "sst/core/action.h"
+#include "sst/core/activityQueue.h"
+#include "sst/core/event.h"
+#include "sst/core/initQueue.h"
+#include "sst/core/link.h"
+#include "sst/core/output.h"
+#include "sst/core/serialization/serializer.h"
+#include "sst/core/simulation_impl.h"
+
+#include <cerrno>
+#include <cstring>
+#include <fnmatch.h>
+
+namespace SST {
+
+// Identifies a trace file, and its version
+static const char TRACE_MAGIC[8] = { 'S', 'S', 'T', 'B', 'T', 'R', 'C', '1' };
+
+/**
+ * Writes each event put in a queue to the trace, then passes it on to
+ * the queue
+ */
+class BoundaryTrace::Recorder : public ActivityQueue
+{
+public:
+    /** Untimed data is recorded from a queue of the recorder's own,
+     * since the link only creates one when it is first used */
+    Recorder(BoundaryTrace* trace, uint32_t port) :
+        trace(trace),
+        type(UNTIMED),
+        port(port),
+        queue(new InitQueue())
+    {}
+
+    Recorder(BoundaryTrace* trace, uint32_t port, ActivityQueue* queue) :
+        trace(trace),
+        type(TIMED),
+        port(port),
+        queue(queue)
+    {}
+
+    ~Recorder()
+    {
+        if ( type == UNTIMED ) delete queue;
+    }
+
+    bool      empty() override { return queue->empty(); }
+    int       size() override { return queue->size(); }
+    Activity* pop() override { return queue->pop(); }
+    Activity* front() override { return queue->front(); }
+
+    void insert(Activity* activity) override
+    {
+        trace->write(type, port, activity);
+        queue->insert(activity);
+    }
+
+    void insertBatch(Activity** begin, Activity** end) override
+    {
+        for ( Activity** it = begin; it != end; ++it ) {
+            trace->write(type, port, *it);
+        }
+        queue->insertBatch(begin, end);
+    }
+
+private:
+    BoundaryTrace* trace;
+    RecordType     type;
+    uint32_t       port;
+    ActivityQueue* queue;
+};
+
+/**
+ * Sends the events recorded for the current time, then reschedules
+ * itself for the time of the next ones
+ */
+class BoundaryTrace::Driver : public Action
+{
+public:
+    explicit Driver(BoundaryTrace* trace) : trace(trace) { setPriority(SYNCPRIORITY); }
+
+    void execute() override
+    {
+        SimTime_t next = trace->sendTimed();
+        if ( next == MAX_SIMTIME_T ) {
+            delete this;
+            return;
+        }
+        Simulation_impl::getSimulation()->insertActivity(next, this);
+    }
+
+private:
+    BoundaryTrace* trace;
+};
+
+/**
+ * Handler for the stand in links.  Events sent out of the boundary
+ * have nowhere to go.
+ */
+class BoundaryTrace::Sink : public Event::HandlerBase
+{
+private:
+    void operator_impl(Event* ev) override { delete ev; }
+};
+
+BoundaryTrace::BoundaryTrace(const std::string& components, const std::string& file, bool replay) :
+    replay(replay),
+    file(nullptr),
+    filename(file),
+    have_next(false),
+    sink(nullptr)
+{
+    size_t start = 0;
+    while ( start <= components.size() ) {
+        size_t end = components.find(',', start);
+        if ( end == std::string::npos ) end = components.size();
+        if ( end > start ) patterns.push_back(components.substr(start, end - start));
+        start = end + 1;
+    }
+
+    this->file = fopen(file.c_str(), replay ? "rb" : "wb");
+    if ( this->file == nullptr ) {
+        Output::getDefaultObject().fatal(
+            CALL_INFO, 1, "ERROR: Could not open boundary trace %s: %s\n", file.c_str(), strerror(errno));
+    }
+    if ( replay ) sink = new Sink();
+}
+
+BoundaryTrace::~BoundaryTrace()
+{
+    if ( file != nullptr ) fclose(file);
+    for ( auto x : recorders ) {
+        delete x;
+    }
+    for ( auto& x : untimed ) {
+        delete x.activity;
+    }
+    if ( have_next ) delete next.activity;
+    if ( replay ) {
+        for ( auto x : outside_links ) {
+            delete x;
+        }
+    }
+    delete sink;
+}
+
+bool
+BoundaryTrace::isInside(const std::string& name) const
+{
+    for ( auto& pattern : patterns ) {
+        if ( fnmatch(pattern.c_str(), name.c_str(), 0) == 0 ) return true;
+    }
+    return false;
+}
+
+void
+BoundaryTrace::addLink(const std::string& name, Link* outside)
+{
+    uint32_t port = names.size();
+    names.push_back(name);
+    outside_links.push_back(outside);
+
+    if ( replay ) {
+        outside->setFunctor(sink);
+        return;
+    }
+
+    Recorder* recorder = new Recorder(this, port);
+    recorders.push_back(recorder);
+    outside->send_queue = recorder;
+}
+
+void
+BoundaryTrace::write(RecordType type, uint32_t port, Activity* activity)
+{
+    // Untimed data is recorded with the phase it is received in, which
+    // is already its delivery time
+    SimTime_t time =
+        type == UNTIMED ? activity->getDeliveryTime() : Simulation_impl::getSimulation()->getCurrentSimCycle();
+
+    SST::Core::Serialization::serializer ser;
+    ser.start_packing(buffer);
+    ser& activity;
+    uint64_t size = ser.size();
+
+    bool ok = fwrite(&type, sizeof(type), 1, file) == 1;
+    ok      = ok && fwrite(&port, sizeof(port), 1, file) == 1;
+    ok      = ok && fwrite(&time, sizeof(time), 1, file) == 1;
+    ok      = ok && fwrite(&size, sizeof(size), 1, file) == 1;
+    ok      = ok && fwrite(buffer.data(), 1, size, file) == size;
+    if ( !ok ) {
+        Output::getDefaultObject().fatal(
+            CALL_INFO, 1, "ERROR: Could not write to boundary trace %s: %s\n", filename.c_str(), strerror(errno));
+    }
+}
+
+bool
+BoundaryTrace::read(Record& record)
+{
+    uint64_t size;
+    if ( fread(&record.type, sizeof(record.type), 1, file) != 1 ) return false;
+
+    bool ok = fread(&record.port, sizeof(record.port), 1, file) == 1;
+    ok      = ok && fread(&record.time, sizeof(record.time), 1, file) == 1;
+    ok      = ok && fread(&size, sizeof(size), 1, file) == 1;
+    if ( ok ) {
+        buffer.resize(size);
+        ok = fread(buffer.data(), 1, size, file) == size;
+    }
+    if ( !ok || record.port >= port_map.size() ) {
+        Output::getDefaultObject().fatal(CALL_INFO, 1, "ERROR: Boundary trace %s is corrupt\n", filename.c_str());
+    }
+
+    record.activity = nullptr;
+    SST::Core::Serialization::serializer ser;
+    ser.start_unpacking(buffer.data(), size);
+    ser& record.activity;
+    return true;
+}
+
+void
+BoundaryTrace::startUntimedPhase(uint32_t phase)
+{
+    if ( phase == 0 && !replay ) {
+        // Ports are written by name, so the replay doesn't depend on
+        // link creation order
+        uint32_t count = names.size();
+        bool     ok    = fwrite(TRACE_MAGIC, sizeof(TRACE_MAGIC), 1, file) == 1;
+        ok             = ok && fwrite(&count, sizeof(count), 1, file) == 1;
+        for ( auto& name : names ) {
+            uint32_t length = name.size();
+            ok              = ok && fwrite(&length, sizeof(length), 1, file) == 1;
+            ok              = ok && fwrite(name.data(), 1, length, file) == length;
+        }
+        if ( !ok ) {
+            Output::getDefaultObject().fatal(
+                CALL_INFO, 1, "ERROR: Could not write to boundary trace %s: %s\n", filename.c_str(), strerror(errno));
+        }
+        return;
+    }
+    if ( !replay ) return;
+
+    if ( phase == 0 ) {
+        char     magic[sizeof(TRACE_MAGIC)];
+        uint32_t count = 0;
+        bool     ok    = fread(magic, sizeof(magic), 1, file) == 1 && memcmp(magic, TRACE_MAGIC, sizeof(magic)) == 0;
+        ok             = ok && fread(&count, sizeof(count), 1, file) == 1;
+        for ( uint32_t i = 0; ok && i < count; ++i ) {
+            uint32_t length = 0;
+            ok              = fread(&length, sizeof(length), 1, file) == 1;
+            std::string name(length, '\0');
+            ok = ok && fread(&name[0], 1, length, file) == length;
+
+            int index = -1;
+            for ( size_t j = 0; j < names.size(); ++j ) {
+                if ( names[j] == name ) index = j;
+            }
+            if ( ok && index == -1 ) {
+                Output::getDefaultObject().fatal(
+                    CALL_INFO, 1, "ERROR: Boundary trace %s has events for %s, which is not a boundary link\n",
+                    filename.c_str(), name.c_str());
+            }
+            port_map.push_back(index);
+        }
+        if ( !ok ) {
+            Output::getDefaultObject().fatal(CALL_INFO, 1, "ERROR: %s is not a boundary trace\n", filename.c_str());
+        }
+
+        // Untimed data is all recorded before the run, and there is
+        // little enough of it to read up front
+        Record record;
+        while ( read(record) ) {
+            if ( record.type == TIMED ) {
+                next      = record;
+                have_next = true;
+                break;
+            }
+            untimed.push_back(record);
+        }
+    }
+
+    // Sent in the phase it was sent in when recorded, so it arrives
+    // in the next one
+    size_t kept = 0;
+    for ( auto& record : untimed ) {
+        if ( record.time == phase + 1 ) {
+            outside_links[port_map[record.port]]->sendUntimedData(static_cast<Event*>(record.activity));
+        }
+        else {
+            untimed[kept++] = record;
+        }
+    }
+    untimed.resize(kept);
+}
+
+void
+BoundaryTrace::startRun()
+{
+    if ( !replay ) {
+        // Events to the inside components go in the TimeVortex or
+        // polling queue set up by finalizeConfiguration()
+        for ( size_t i = 0; i < outside_links.size(); ++i ) {
+            Recorder* recorder = new Recorder(this, i, outside_links[i]->send_queue);
+            recorders.push_back(recorder);
+            outside_links[i]->send_queue = recorder;
+        }
+        return;
+    }
+
+    // Nothing else has the stand ins to configure them
+    for ( auto x : outside_links ) {
+        x->finalizeConfiguration();
+    }
+
+    // Anything the recording sent during init() that was never read
+    // is dropped, the same as it would have been
+    for ( auto& x : untimed ) {
+        delete x.activity;
+    }
+    untimed.clear();
+
+    if ( have_next ) Simulation_impl::getSimulation()->insertActivity(next.time, new Driver(this));
+}
+
+void
+BoundaryTrace::send(const Record& record)
+{
+    Link*     link     = outside_links[port_map[record.port]];
+    Event*    event    = static_cast<Event*>(record.activity);
+    SimTime_t earliest = Simulation_impl::getSimulation()->getCurrentSimCycle() + link->latency;
+    if ( event->getDeliveryTime() < earliest ) {
+        Output::getDefaultObject().fatal(
+            CALL_INFO, 1, "ERROR: Boundary trace %s does not match the latency of link %s\n", filename.c_str(),
+            names[port_map[record.port]].c_str());
+    }
+    link->send_impl(event->getDeliveryTime() - earliest, event);
+}
+
+SimTime_t
+BoundaryTrace::sendTimed()
+{
+    SimTime_t now = next.time;
+    while ( have_next && next.time == now ) {
+        send(next);
+        have_next = read(next);
+    }
+    return have_next ? next.time : MAX_SIMTIME_T;
+}
+
+void
+BoundaryTrace::prepareForComplete()
+{
+    if ( !replay ) {
+        fflush(file);
+        return;
+    }
+    for ( auto x : outside_links ) {
+        x->prepareForComplete();
+    }
+}
+
+} // namespace SST
@@ -0,0 +1,133 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_BOUNDARYTRACE_H
+#define SST_CORE_BOUNDARYTRACE_H
+
+#include "sst/core/sst_types.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace SST {
+
+class Activity;
+class Event;
+class Link;
+
+/**
+ * Records the events that cross into a set of components, so the set
+ * can later be simulated alone with the recording standing in for the
+ * rest of the system.
+ *
+ * A boundary link is one with exactly one end on a component in the
+ * set.  When recording, the queue that events sent to the inside end
+ * go into is wrapped so each event is serialized to the trace before
+ * it is queued.  This covers untimed data sent during init() and
+ * events sent during the run.  When replaying, the components outside
+ * the set are not built, and the outside end of each boundary link is
+ * a stand in link that resends the recorded events at the same times.
+ * Events the inside components send out over the boundary are deleted.
+ *
+ * Recording and replay need a single rank and thread, the same graph
+ * (the boundary links are matched by component and port name), and
+ * serializable events.  Untimed data sent during complete() is not
+ * recorded.
+ */
+class BoundaryTrace
+{
+public:
+    /** Open the trace
+     * @param components Comma separated list of names or shell
+     * wildcard patterns of the components inside the boundary
+     * @param file Trace to write, or to read if replay is true
+     * @param replay Whether to replay the trace instead of recording it
+     */
+    BoundaryTrace(const std::string& components, const std::string& file, bool replay);
+    ~BoundaryTrace();
+
+    /** Whether the trace is replayed instead of recorded */
+    bool isReplaying() const { return replay; }
+
+    /** Whether a component is inside the boundary */
+    bool isInside(const std::string& name) const;
+
+    /** Called while the links are created, for each boundary link.
+     * @param name Name of the inside end, as component:port
+     * @param outside The other end of the link.  When replaying, this
+     * is a stand in the trace takes ownership of.
+     */
+    void addLink(const std::string& name, Link* outside);
+
+    /** Called at the start of each init() round.  When replaying,
+     * sends the untimed data recorded in the round. */
+    void startUntimedPhase(uint32_t phase);
+
+    /** Called once the links are configured for the run */
+    void startRun();
+
+    /** Called before complete() */
+    void prepareForComplete();
+
+private:
+    class Recorder;
+    class Driver;
+    class Sink;
+
+    enum RecordType : uint8_t { UNTIMED, TIMED };
+
+    /** A record read back from the trace */
+    struct Record
+    {
+        RecordType type;
+        uint32_t   port;
+        SimTime_t  time;
+        Activity*  activity;
+    };
+
+    void write(RecordType type, uint32_t port, Activity* activity);
+    bool read(Record& record);
+
+    /** Send a replayed event from the stand in for its port */
+    void send(const Record& record);
+
+    /** Called by the Driver to send all the events recorded at the
+     * current time.  Returns the time of the next one, or
+     * MAX_SIMTIME_T if the trace is done. */
+    SimTime_t sendTimed();
+
+    bool                     replay;
+    std::vector<std::string> patterns;
+    FILE*                    file;
+    std::string              filename;
+
+    // Boundary links, in the order they were added
+    std::vector<std::string> names;
+    std::vector<Link*>       outside_links;
+
+    // When replaying, maps the ports in the trace to the boundary
+    // links, and holds the records read ahead
+    std::vector<int>    port_map;
+    std::vector<Record> untimed;
+    Record              next;
+    bool                have_next;
+    Sink*               sink;
+
+    // Reused for packing and unpacking records
+    std::vector<char> buffer;
+
+    std::vector<Recorder*> recorders;
+};
+
+} // namespace SST
+
+#endif // SST_CORE_BOUNDARYTRACE_H
@@ -0,0 +1,90 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+//
+
+#include "sst_config.h"
+
+#include "sst/core/cfgoutput/binaryConfigOutput.h"
+
+#include "sst/core/config.h"
+#include "sst/core/configGraph.h"
+#include "sst/core/params.h"
+#include "sst/core/serialization/serializer.h"
+
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace SST::Core;
+
+BinaryConfigGraphOutput::BinaryConfigGraphOutput(const char* path) : ConfigGraphOutput(path, false) {}
+
+void
+BinaryConfigGraphOutput::generate(const Config* cfg, ConfigGraph* graph)
+{
+    if ( nullptr == outputFile ) { throw ConfigGraphOutputException("Output file is not open for writing"); }
+
+    // Same program options as the other config outputs
+    std::map<std::string, std::string> options;
+    options["verbose"]                 = std::to_string(cfg->verbose());
+    options["stop-at"]                 = cfg->stop_at();
+    options["print-timing-info"]       = cfg->print_timing() ? "true" : "false";
+    options["heartbeat-period"]        = cfg->heartbeatPeriod();
+    options["timebase"]                = cfg->timeBase();
+    options["partitioner"]             = cfg->partitioner();
+    options["partition-weights"]       = cfg->partition_weights();
+    options["partition-cache"]         = cfg->partition_cache();
+    options["timeVortex"]              = cfg->timeVortex();
+    options["interthread-links"]       = cfg->interthread_links() ? "true" : "false";
+    options["interthread-lookahead"]   = cfg->interthread_lookahead() ? "true" : "false";
+    options["direct-delivery"]         = cfg->direct_delivery() ? "true" : "false";
+    options["tight-clock-loop"]        = cfg->tight_clock_loop() ? "true" : "false";
+    options["sync-compress-threshold"] = std::to_string(cfg->sync_compress_threshold());
+    options["construct-threads"]       = std::to_string(cfg->construct_threads());
+    options["active-untimed-phases"]   = cfg->active_untimed_phases() ? "true" : "false";
+    options["deferred-file-output"]    = cfg->deferred_file_output() ? "true" : "false";
+    options["output-prefix-core"]      = cfg->output_core_prefix();
+
+    // Params store keys as IDs, so the names have to go along with
+    // the graph
+    std::vector<std::string> key_names = Params::keyMapReverse;
+
+    std::map<std::string, std::map<std::string, std::string>> globals;
+    for ( const auto& set : getGlobalParamSetNames() ) {
+        globals[set] = getGlobalParamSet(set);
+    }
+
+    SST::Core::Serialization::serializer ser;
+    ser.start_sizing();
+    ser& options;
+    ser& key_names;
+    ser& globals;
+    ser& *graph;
+
+    std::vector<char> buffer(ser.size());
+    ser.start_packing(buffer.data(), buffer.size());
+    ser& options;
+    ser& key_names;
+    ser& globals;
+    ser& *graph;
+
+    Header header;
+    memcpy(header.magic, file_magic, sizeof(header.magic));
+    header.version      = file_version;
+    header.reserved     = 0;
+    header.payload_size = buffer.size();
+
+    if ( fwrite(&header, sizeof(header), 1, outputFile) != 1 ||
+         fwrite(buffer.data(), 1, buffer.size(), outputFile) != buffer.size() ) {
+        throw ConfigGraphOutputException("Error writing binary graph snapshot");
+    }
+}
@@ -0,0 +1,54 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+//
+
+#ifndef SST_CORE_BINARY_CONFIG_OUTPUT_H
+#define SST_CORE_BINARY_CONFIG_OUTPUT_H
+
+#include "sst/core/configGraph.h"
+#include "sst/core/configGraphOutput.h"
+
+#include <cstdint>
+
+namespace SST {
+namespace Core {
+
+/**
+ * Writes the ConfigGraph as a binary snapshot that can be loaded
+ * again with SSTBinaryModelDefinition much faster than re-running
+ * the original model.  The file holds a fixed header followed by the
+ * serialized program options, parameter key names, global parameter
+ * sets and the graph itself.
+ */
+class BinaryConfigGraphOutput : public ConfigGraphOutput
+{
+
+public:
+    /** File header for a binary graph snapshot */
+    struct Header
+    {
+        char     magic[8];     /*!< Always "SSTGRAPH" */
+        uint32_t version;      /*!< Format version */
+        uint32_t reserved;     /*!< Unused, set to 0 */
+        uint64_t payload_size; /*!< Bytes of serialized data after the header */
+    };
+
+    static constexpr const char* file_magic   = "SSTGRAPH";
+    static constexpr uint32_t    file_version = 1;
+
+    BinaryConfigGraphOutput(const char* path);
+    virtual void generate(const Config* cfg, ConfigGraph* graph) override;
+};
+
+} // namespace Core
+} // namespace SST
+
+#endif // SST_CORE_BINARY_CONFIG_OUTPUT_H
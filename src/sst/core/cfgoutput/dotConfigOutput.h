@@ -26,11 +26,11 @@ public:
     virtual void generate(const Config* cfg, ConfigGraph* graph) override;
 
 protected:
-    void generateDot(const ConfigComponent* comp, const ConfigLinkMap_t& linkMap, const uint32_t dot_verbosity) const;
+    void generateDot(const ConfigComponent* comp, const ConfigLinkMap_t& linkMap, const uint32_t dot_verbosity);
     void generateDot(
         const ConfigComponent* comp, const ConfigLinkMap_t& linkMap, const uint32_t dot_verbosity,
-        const ConfigComponent* parent) const;
-    void generateDot(const ConfigLink* link, const uint32_t dot_verbosity) const;
+        const ConfigComponent* parent);
+    void generateDot(const ConfigLink* link, const uint32_t dot_verbosity);
 };
 
 } // namespace Core
@@ -21,8 +21,14 @@
 
 #include "nlohmann/json.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <exception>
 #include <map>
-#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
 
 using namespace SST::Core;
 namespace json = ::nlohmann;
@@ -136,12 +142,105 @@ to_json(json::ordered_json& j, LinkConfPair const& pair)
     j["right"]["latency"]   = link->latency_str[1];
 }
 
+// Components and links are formatted this many at a time
+const size_t FORMAT_CHUNK_SIZE = 4096;
+
+// Number of threads to format with.  SST_CORE_GRAPH_OUTPUT_THREADS
+// overrides the default, with 1 formatting on the calling thread.
+int
+getFormatThreads()
+{
+    const char* env = getenv("SST_CORE_GRAPH_OUTPUT_THREADS");
+    if ( env != nullptr ) return std::max(atoi(env), 1);
+    return std::max(std::min((int)std::thread::hardware_concurrency(), 8), 1);
+}
+
+// Add a value dumped at the depth of an array inside the top level
+// object
+void
+appendIndented(std::string& out, const json::ordered_json& j)
+{
+    std::string dump = j.dump(2);
+    out.append("    ");
+    size_t start = 0;
+    size_t end;
+    while ( (end = dump.find('\n', start)) != std::string::npos ) {
+        out.append(dump, start, end + 1 - start);
+        out.append("    ");
+        start = end + 1;
+    }
+    out.append(dump, start, std::string::npos);
+}
+
+// Formats the array elements in chunks on several threads, and passes
+// the chunks to write in order.  Only a few chunks per thread are held
+// at once, so the memory used doesn't grow with the graph.
+template <typename T, typename FORMAT, typename WRITE>
+void
+formatArray(const std::vector<T>& items, FORMAT format, WRITE write)
+{
+    size_t num_chunks  = (items.size() + FORMAT_CHUNK_SIZE - 1) / FORMAT_CHUNK_SIZE;
+    size_t num_threads = std::min((size_t)getFormatThreads(), num_chunks);
+
+    auto format_chunk = [&](size_t chunk, std::string& out) {
+        size_t end = std::min((chunk + 1) * FORMAT_CHUNK_SIZE, items.size());
+        for ( size_t i = chunk * FORMAT_CHUNK_SIZE; i < end; ++i ) {
+            if ( i != 0 ) out.append(",\n");
+            appendIndented(out, format(items[i]));
+        }
+    };
+
+    if ( num_threads <= 1 ) {
+        std::string out;
+        for ( size_t chunk = 0; chunk < num_chunks; ++chunk ) {
+            out.clear();
+            format_chunk(chunk, out);
+            write(out);
+        }
+        return;
+    }
+
+    std::vector<std::string> round(num_threads * 4);
+    for ( size_t first = 0; first < num_chunks; first += round.size() ) {
+        size_t                          count = std::min(round.size(), num_chunks - first);
+        std::atomic<size_t>             next(0);
+        std::vector<std::exception_ptr> errors(num_threads);
+        std::vector<std::thread>        threads;
+
+        auto worker = [&](size_t id) {
+            try {
+                size_t index;
+                while ( (index = next++) < count ) {
+                    round[index].clear();
+                    format_chunk(first + index, round[index]);
+                }
+            }
+            catch ( ... ) {
+                errors[id] = std::current_exception();
+            }
+        };
+        for ( size_t i = 1; i < num_threads; ++i ) {
+            threads.emplace_back(worker, i);
+        }
+        worker(0);
+        for ( auto& x : threads ) {
+            x.join();
+        }
+        for ( auto& x : errors ) {
+            if ( x ) std::rethrow_exception(x);
+        }
+        for ( size_t i = 0; i < count; ++i ) {
+            write(round[i]);
+        }
+    }
+}
+
 } // namespace
 
 void
 JSONConfigGraphOutput::generate(const Config* cfg, ConfigGraph* graph)
 {
-    if ( nullptr == outputFile ) { throw ConfigGraphOutputException("Output file is not open for writing"); }
+    if ( !isOpen() ) { throw ConfigGraphOutputException("Output file is not open for writing"); }
 
     const auto& compMap = graph->getComponentMap();
     const auto& linkMap = graph->getLinkMap();
@@ -149,17 +248,26 @@ JSONConfigGraphOutput::generate(const Config* cfg, ConfigGraph* graph)
     json::ordered_json outputJson;
 
     // Put in the program options
-    outputJson["program_options"]["verbose"]            = std::to_string(cfg->verbose());
-    outputJson["program_options"]["stop-at"]            = cfg->stop_at();
-    outputJson["program_options"]["print-timing-info"]  = cfg->print_timing() ? "true" : "false";
+    outputJson["program_options"]["verbose"]                 = std::to_string(cfg->verbose());
+    outputJson["program_options"]["stop-at"]                 = cfg->stop_at();
+    outputJson["program_options"]["print-timing-info"]       = cfg->print_timing() ? "true" : "false";
     // Ignore stopAfter for now
     // outputJson["program_options"]["stopAfter"] = cfg->stopAfterSec();
-    outputJson["program_options"]["heartbeat-period"]   = cfg->heartbeatPeriod();
-    outputJson["program_options"]["timebase"]           = cfg->timeBase();
-    outputJson["program_options"]["partitioner"]        = cfg->partitioner();
-    outputJson["program_options"]["timeVortex"]         = cfg->timeVortex();
-    outputJson["program_options"]["interthread-links"]  = cfg->interthread_links() ? "true" : "false";
-    outputJson["program_options"]["output-prefix-core"] = cfg->output_core_prefix();
+    outputJson["program_options"]["heartbeat-period"]        = cfg->heartbeatPeriod();
+    outputJson["program_options"]["timebase"]                = cfg->timeBase();
+    outputJson["program_options"]["partitioner"]             = cfg->partitioner();
+    outputJson["program_options"]["partition-weights"]       = cfg->partition_weights();
+    outputJson["program_options"]["partition-cache"]         = cfg->partition_cache();
+    outputJson["program_options"]["timeVortex"]              = cfg->timeVortex();
+    outputJson["program_options"]["interthread-links"]       = cfg->interthread_links() ? "true" : "false";
+    outputJson["program_options"]["interthread-lookahead"]   = cfg->interthread_lookahead() ? "true" : "false";
+    outputJson["program_options"]["direct-delivery"]         = cfg->direct_delivery() ? "true" : "false";
+    outputJson["program_options"]["tight-clock-loop"]        = cfg->tight_clock_loop() ? "true" : "false";
+    outputJson["program_options"]["sync-compress-threshold"] = std::to_string(cfg->sync_compress_threshold());
+    outputJson["program_options"]["construct-threads"]       = std::to_string(cfg->construct_threads());
+    outputJson["program_options"]["active-untimed-phases"]   = cfg->active_untimed_phases() ? "true" : "false";
+    outputJson["program_options"]["deferred-file-output"]    = cfg->deferred_file_output() ? "true" : "false";
+    outputJson["program_options"]["output-prefix-core"]      = cfg->output_core_prefix();
 
     // Put in the global param sets
     for ( const auto& set : getGlobalParamSetNames() ) {
@@ -168,25 +276,41 @@ JSONConfigGraphOutput::generate(const Config* cfg, ConfigGraph* graph)
         }
     }
 
-    // no components exist in this rank
-    if ( const_cast<ConfigComponentMap_t&>(compMap).size() == 0 ) { outputJson["components"]; }
+    // The components and links are streamed after the rest, instead
+    // of building the whole document in memory.  The layout matches
+    // what dumping it all at once would give.
+    std::string head = outputJson.dump(2);
+    head.resize(head.rfind('\n'));
+    write(head);
+
+    auto write_chunk = [this](const std::string& chunk) { write(chunk); };
 
-    for ( const auto& compItr : compMap ) {
-        outputJson["components"].emplace_back(CompWrapper { compItr, cfg->output_partition() });
+    // no components exist in this rank
+    std::vector<const ConfigComponent*> comps(compMap.begin(), compMap.end());
+    if ( comps.empty() ) { write(",\n  \"components\": null"); }
+    else {
+        write(",\n  \"components\": [\n");
+        bool output_partition = cfg->output_partition();
+        formatArray(
+            comps,
+            [output_partition](const ConfigComponent* comp) {
+                return json::ordered_json(CompWrapper { comp, output_partition });
+            },
+            write_chunk);
+        write("\n  ]");
     }
 
     // no links exist in this rank
-    if ( const_cast<ConfigLinkMap_t&>(linkMap).size() == 0 ) { outputJson["links"]; }
-
-    for ( const auto& linkItr : linkMap ) {
-        outputJson["links"].push_back(LinkConfPair { linkItr, graph });
+    std::vector<const ConfigLink*> links(linkMap.begin(), linkMap.end());
+    if ( links.empty() ) { write(",\n  \"links\": null"); }
+    else {
+        write(",\n  \"links\": [\n");
+        formatArray(
+            links, [graph](const ConfigLink* link) { return json::ordered_json(LinkConfPair { link, graph }); },
+            write_chunk);
+        write("\n  ]");
     }
 
-    std::stringstream ss;
-    ss << std::setw(2) << outputJson << std::endl;
-
-    // Avoid lifetime issues, I don't think it's a big deal in this case due to
-    // lifetime extension, but this temp is the careful way.
-    std::string outputString = ss.str();
-    fprintf(outputFile, "%s", outputString.c_str());
+    write("\n}\n");
+    flush();
 }
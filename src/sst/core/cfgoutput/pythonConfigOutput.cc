@@ -28,7 +28,7 @@ PythonConfigGraphOutput::generateParams(const Params& params)
 {
     if ( params.empty() ) return;
 
-    fprintf(outputFile, "{\n");
+    print("{\n");
 
     bool firstItem = true;
     // for ( auto& key : params.getKeys() ) {
@@ -37,10 +37,10 @@ PythonConfigGraphOutput::generateParams(const Params& params)
         char* esValue     = makeEscapeSafe(params.find<std::string>(key).c_str());
 
         if ( isMultiLine(esValue) ) {
-            fprintf(outputFile, "%s     \"%s\" : \"\"\"%s\"\"\"", firstItem ? "" : ",\n", esParamName, esValue);
+            print("%s     \"%s\" : \"\"\"%s\"\"\"", firstItem ? "" : ",\n", esParamName, esValue);
         }
         else {
-            fprintf(outputFile, "%s     \"%s\" : \"%s\"", firstItem ? "" : ",\n", esParamName, esValue);
+            print("%s     \"%s\" : \"%s\"", firstItem ? "" : ",\n", esParamName, esValue);
         }
 
         free(esParamName);
@@ -49,7 +49,7 @@ PythonConfigGraphOutput::generateParams(const Params& params)
         firstItem = false;
     }
 
-    fprintf(outputFile, "\n}");
+    print("\n}");
 }
 
 const std::string&
@@ -57,8 +57,8 @@ PythonConfigGraphOutput::getLinkObject(LinkId_t id, const std::string& name, boo
 {
     if ( linkMap.find(id) == linkMap.end() ) {
         char* pyLinkName = makePythonSafeWithPrefix(name.c_str(), "link_");
-        fprintf(outputFile, "%s = sst.Link(\"%s\")\n", pyLinkName, name.c_str());
-        if ( no_cut ) fprintf(outputFile, "%s.setNoCut()\n", pyLinkName);
+        print("%s = sst.Link(\"%s\")\n", pyLinkName, name.c_str());
+        if ( no_cut ) print("%s.setNoCut()\n", pyLinkName);
         linkMap[id] = pyLinkName;
     }
     return linkMap[id];
@@ -69,36 +69,36 @@ PythonConfigGraphOutput::generateCommonComponent(const char* objName, const Conf
 {
     if ( !comp->params.empty() ) {
         // Add local params
-        fprintf(outputFile, "%s.addParams(", objName);
+        print("%s.addParams(", objName);
         generateParams(comp->params);
-        fprintf(outputFile, ")\n");
+        print(")\n");
         // Add global param sets
         for ( auto x : getSubscribedGlobalParamSets(comp->params) ) {
-            fprintf(outputFile, "%s.addGlobalParamSet(\"%s\")\n", objName, x.c_str());
+            print("%s.addGlobalParamSet(\"%s\")\n", objName, x.c_str());
         }
     }
 
-    fprintf(outputFile, "%s.setCoordinates(", objName);
+    print("%s.setCoordinates(", objName);
     bool first = true;
     for ( double d : comp->coords ) {
-        fprintf(outputFile, first ? "%lg" : ", %lg", d);
+        print(first ? "%lg" : ", %lg", d);
         first = false;
     }
-    fprintf(outputFile, ")\n");
+    print(")\n");
 
     for ( auto& pair : comp->enabledStatNames ) {
         auto& name       = pair.first;
         auto* si         = comp->findStatistic(pair.second);
         char* esStatName = makeEscapeSafe(name.c_str());
 
-        fprintf(outputFile, "%s.enableStatistics([\"%s\"]", objName, esStatName);
+        print("%s.enableStatistics([\"%s\"]", objName, esStatName);
 
         // Output the Statistic Parameters
         if ( !si->params.empty() ) {
-            fprintf(outputFile, ", ");
+            print(", ");
             generateParams(si->params);
         }
-        fprintf(outputFile, ")\n");
+        print(")\n");
 
         free(esStatName);
     }
@@ -114,9 +114,7 @@ PythonConfigGraphOutput::generateCommonComponent(const char* objName, const Conf
         char*             esPortName = makeEscapeSafe(link->port[idx].c_str());
 
         const std::string& linkName = getLinkObject(linkID, link->name, link->no_cut);
-        fprintf(
-            outputFile, "%s.addLink(%s, \"%s\", \"%s\")\n", objName, linkName.c_str(), esPortName,
-            tmp.toStringBestSI().c_str());
+        print("%s.addLink(%s, \"%s\", \"%s\")\n", objName, linkName.c_str(), esPortName, tmp.toStringBestSI().c_str());
 
         free(esPortName);
     }
@@ -135,8 +133,8 @@ PythonConfigGraphOutput::generateSubComponent(const char* owner, const ConfigCom
     char* pyCompName = makePythonSafeWithPrefix(comp->name.c_str(), combName);
     char* esCompName = makeEscapeSafe(comp->name.c_str());
 
-    fprintf(
-        outputFile, "%s = %s.setSubComponent(\"%s\", \"%s\", %d)\n", pyCompName, owner, esCompName, comp->type.c_str(),
+    print(
+        "%s = %s.setSubComponent(\"%s\", \"%s\", %d)\n", pyCompName, owner, esCompName, comp->type.c_str(),
         comp->slot_num);
 
     generateCommonComponent(pyCompName, comp);
@@ -152,10 +150,10 @@ PythonConfigGraphOutput::generateComponent(const ConfigComponent* comp, bool out
     char* pyCompName = makePythonSafeWithPrefix(comp->name.c_str(), "comp_");
     char* esCompName = makeEscapeSafe(comp->name.c_str());
 
-    fprintf(outputFile, "%s = sst.Component(\"%s\", \"%s\")\n", pyCompName, esCompName, comp->type.c_str());
+    print("%s = sst.Component(\"%s\", \"%s\")\n", pyCompName, esCompName, comp->type.c_str());
 
     if ( output_parition_info ) {
-        fprintf(outputFile, "%s.setRank(%d,%d)\n", pyCompName, comp->rank.rank, comp->rank.thread);
+        print("%s.setRank(%d,%d)\n", pyCompName, comp->rank.rank, comp->rank.thread);
     }
 
     generateCommonComponent(pyCompName, comp);
@@ -170,33 +168,34 @@ PythonConfigGraphOutput::generateStatGroup(const ConfigGraph* graph, const Confi
     char* pyGroupName = makePythonSafeWithPrefix(grp.name.c_str(), "statGroup_");
     char* esGroupName = makeEscapeSafe(grp.name.c_str());
 
-    fprintf(outputFile, "%s = sst.StatisticGroup(\"%s\")\n", pyGroupName, esGroupName);
+    print("%s = sst.StatisticGroup(\"%s\")\n", pyGroupName, esGroupName);
     if ( grp.outputFrequency.getValue() != 0 ) {
-        fprintf(outputFile, "%s.setFrequency(\"%s\")\n", pyGroupName, grp.outputFrequency.toStringBestSI().c_str());
+        print("%s.setFrequency(\"%s\")\n", pyGroupName, grp.outputFrequency.toStringBestSI().c_str());
     }
+    if ( grp.reduce ) { print("%s.setReduce(True)\n", pyGroupName); }
     if ( grp.outputID != 0 ) {
         const ConfigStatOutput& out = graph->getStatOutput(grp.outputID);
-        fprintf(outputFile, "%s.setOutput(sst.StatisticOutput(\"%s\"", pyGroupName, out.type.c_str());
+        print("%s.setOutput(sst.StatisticOutput(\"%s\"", pyGroupName, out.type.c_str());
         if ( !out.params.empty() ) {
-            fprintf(outputFile, ", ");
+            print(", ");
             generateParams(out.params);
         }
-        fprintf(outputFile, "))\n");
+        print("))\n");
     }
 
     for ( auto& i : grp.statMap ) {
-        fprintf(outputFile, "%s.addStatistic(\"%s\"", pyGroupName, i.first.c_str());
+        print("%s.addStatistic(\"%s\"", pyGroupName, i.first.c_str());
         if ( !i.second.empty() ) {
-            fprintf(outputFile, ", ");
+            print(", ");
             generateParams(i.second);
         }
-        fprintf(outputFile, ")\n");
+        print(")\n");
     }
 
     for ( ComponentId_t id : grp.components ) {
         const ConfigComponent* comp       = graph->findComponent(id);
         char*                  pyCompName = makePythonSafeWithPrefix(comp->name.c_str(), "comp_");
-        fprintf(outputFile, "%s.addComponent(%s)\n", pyGroupName, pyCompName);
+        print("%s.addComponent(%s)\n", pyGroupName, pyCompName);
         free(pyCompName);
     }
 
@@ -208,85 +207,91 @@ void
 PythonConfigGraphOutput::generate(const Config* cfg, ConfigGraph* graph)
 {
 
-    if ( nullptr == outputFile ) { throw ConfigGraphOutputException("Input file is not open for output writing"); }
+    if ( !isOpen() ) { throw ConfigGraphOutputException("Input file is not open for output writing"); }
 
     this->graph = graph;
 
     // Generate the header and program options
-    fprintf(outputFile, "# Automatically generated by SST\n");
-    fprintf(outputFile, "import sst\n\n");
+    print("# Automatically generated by SST\n");
+    print("import sst\n\n");
     // We will dump all the program options so we can exactly recreate
     // the run just by running the file.  The exceptions will be to
     // information or configuration outputs.  We don't need to
     // recreate output files when we run it again.  They're added in
     // the order they're defined in the config.cc file.
 
-    fprintf(outputFile, "# Define SST Program Options:\n");
-    fprintf(outputFile, "# (These reflect the settings from original run and are not necessary in all files)\n");
-    fprintf(outputFile, "sst.setProgramOption(\"verbose\", \"%" PRIu32 "\")\n", cfg->verbose());
-    fprintf(outputFile, "sst.setProgramOption(\"stop-at\", \"%s\")\n", cfg->stop_at().c_str());
-    fprintf(
-        outputFile, "sst.setProgramOption(\"print-timing-info\", \"%s\")\n", cfg->print_timing() ? "true" : "false");
+    print("# Define SST Program Options:\n");
+    print("# (These reflect the settings from original run and are not necessary in all files)\n");
+    print("sst.setProgramOption(\"verbose\", \"%" PRIu32 "\")\n", cfg->verbose());
+    print("sst.setProgramOption(\"stop-at\", \"%s\")\n", cfg->stop_at().c_str());
+    print("sst.setProgramOption(\"print-timing-info\", \"%s\")\n", cfg->print_timing() ? "true" : "false");
     // Ignore stopAfter for now
-    // fprintf(outputFile, "sst.setProgramOption(\"stopAfter\", \"%" PRIu32 "\")\n", cfg->stopAfterSec);
-    fprintf(outputFile, "sst.setProgramOption(\"heartbeat-period\", \"%s\")\n", cfg->heartbeatPeriod().c_str());
-    fprintf(outputFile, "sst.setProgramOption(\"timebase\", \"%s\")\n", cfg->timeBase().c_str());
-    fprintf(outputFile, "sst.setProgramOption(\"partitioner\", \"%s\")\n", cfg->partitioner().c_str());
-    fprintf(outputFile, "sst.setProgramOption(\"timeVortex\", \"%s\")\n", cfg->timeVortex().c_str());
-    fprintf(
-        outputFile, "sst.setProgramOption(\"interthread-links\", \"%s\")\n",
-        cfg->interthread_links() ? "true" : "false");
-    fprintf(outputFile, "sst.setProgramOption(\"output-prefix-core\", \"%s\")\n", cfg->output_core_prefix().c_str());
+    // print("sst.setProgramOption(\"stopAfter\", \"%" PRIu32 "\")\n", cfg->stopAfterSec);
+    print("sst.setProgramOption(\"heartbeat-period\", \"%s\")\n", cfg->heartbeatPeriod().c_str());
+    print("sst.setProgramOption(\"timebase\", \"%s\")\n", cfg->timeBase().c_str());
+    print("sst.setProgramOption(\"partitioner\", \"%s\")\n", cfg->partitioner().c_str());
+    print("sst.setProgramOption(\"partition-weights\", \"%s\")\n", cfg->partition_weights().c_str());
+    print("sst.setProgramOption(\"partition-cache\", \"%s\")\n", cfg->partition_cache().c_str());
+    print("sst.setProgramOption(\"timeVortex\", \"%s\")\n", cfg->timeVortex().c_str());
+    print("sst.setProgramOption(\"interthread-links\", \"%s\")\n", cfg->interthread_links() ? "true" : "false");
+    print("sst.setProgramOption(\"interthread-lookahead\", \"%s\")\n", cfg->interthread_lookahead() ? "true" : "false");
+    print("sst.setProgramOption(\"direct-delivery\", \"%s\")\n", cfg->direct_delivery() ? "true" : "false");
+    print("sst.setProgramOption(\"tight-clock-loop\", \"%s\")\n", cfg->tight_clock_loop() ? "true" : "false");
+    print("sst.setProgramOption(\"sync-compress-threshold\", \"%" PRIu32 "\")\n", cfg->sync_compress_threshold());
+    print("sst.setProgramOption(\"construct-threads\", \"%" PRIu32 "\")\n", cfg->construct_threads());
+    print("sst.setProgramOption(\"active-untimed-phases\", \"%s\")\n", cfg->active_untimed_phases() ? "true" : "false");
+    print("sst.setProgramOption(\"deferred-file-output\", \"%s\")\n", cfg->deferred_file_output() ? "true" : "false");
+    print("sst.setProgramOption(\"output-prefix-core\", \"%s\")\n", cfg->output_core_prefix().c_str());
 
     // Output the global params
-    fprintf(outputFile, "# Define the global parameter sets:\n");
+    print("# Define the global parameter sets:\n");
     std::vector<std::string> global_param_sets = getGlobalParamSetNames();
     for ( auto& x : global_param_sets ) {
-        fprintf(outputFile, "sst.addGlobalParams(\"%s\", {\n", x.c_str());
+        print("sst.addGlobalParams(\"%s\", {\n", x.c_str());
         for ( auto y : getGlobalParamSet(x) ) {
             // If the key is <set_name>, then we can skip since it's
             // just metadata
-            if ( y.first != "<set_name>" )
-                fprintf(outputFile, "    \"%s\" : \"%s\",\n", y.first.c_str(), y.second.c_str());
+            if ( y.first != "<set_name>" ) print("    \"%s\" : \"%s\",\n", y.first.c_str(), y.second.c_str());
         }
-        fprintf(outputFile, "})\n");
+        print("})\n");
     }
-    fprintf(outputFile, "\n");
+    print("\n");
 
     // Output the graph
-    fprintf(outputFile, "# Define the SST Components:\n");
+    print("# Define the SST Components:\n");
 
     auto compMap = graph->getComponentMap();
     for ( auto& comp_itr : compMap ) {
         generateComponent(comp_itr, cfg->output_partition());
-        fprintf(outputFile, "\n");
+        print("\n");
     }
 
     // Output general statistics options
-    fprintf(outputFile, "# Define SST Statistics Options:\n");
+    print("# Define SST Statistics Options:\n");
 
     if ( 0 != graph->getStatLoadLevel() ) {
-        fprintf(outputFile, "sst.setStatisticLoadLevel(%" PRIu64 ")\n", (uint64_t)graph->getStatLoadLevel());
+        print("sst.setStatisticLoadLevel(%" PRIu64 ")\n", (uint64_t)graph->getStatLoadLevel());
     }
     if ( !graph->getStatOutput().type.empty() ) {
-        fprintf(outputFile, "sst.setStatisticOutput(\"%s\"", graph->getStatOutput().type.c_str());
+        print("sst.setStatisticOutput(\"%s\"", graph->getStatOutput().type.c_str());
         const Params& outParams = graph->getStatOutput().params;
         if ( !outParams.empty() ) {
-            fprintf(outputFile, ", ");
+            print(", ");
             generateParams(outParams);
         }
-        fprintf(outputFile, ")\n");
+        print(")\n");
     }
 
     // Check for statistic groups
     if ( !graph->getStatGroups().empty() ) {
-        fprintf(outputFile, "\n# Statistic Groups:\n");
+        print("\n# Statistic Groups:\n");
         for ( auto& grp : graph->getStatGroups() ) {
             generateStatGroup(graph, grp.second);
         }
     }
 
-    fprintf(outputFile, "# End of generated output.\n\n");
+    print("# End of generated output.\n\n");
+    flush();
 
     this->graph = nullptr;
     linkMap.clear();
@@ -25,11 +25,11 @@ void
 XMLConfigGraphOutput::generate(const Config* UNUSED(cfg), ConfigGraph* graph)
 {
 
-    if ( nullptr == outputFile ) { throw ConfigGraphOutputException("Output file is not open for writing"); }
+    if ( !isOpen() ) { throw ConfigGraphOutputException("Output file is not open for writing"); }
 
-    fprintf(outputFile, "<?xml version=\"1.0\" ?>\n");
-    fprintf(outputFile, "<component id=\"root\" name=\"root\">\n");
-    fprintf(outputFile, "   <component id=\"system\" name=\"system\">\n");
+    print("<?xml version=\"1.0\" ?>\n");
+    print("<component id=\"root\" name=\"root\">\n");
+    print("   <component id=\"system\" name=\"system\">\n");
 
     const auto compMap = graph->getComponentMap();
     const auto linkMap = graph->getLinkMap();
@@ -42,17 +42,18 @@ XMLConfigGraphOutput::generate(const Config* UNUSED(cfg), ConfigGraph* graph)
         generateXML("      ", (*linkItr), compMap);
     }
 
-    fprintf(outputFile, "   </component>\n");
-    fprintf(outputFile, "</component>\n");
+    print("   </component>\n");
+    print("</component>\n");
+    flush();
 }
 
 void
 XMLConfigGraphOutput::generateXML(
-    const std::string& indent, const ConfigComponent* comp, const ConfigLinkMap_t& UNUSED(linkMap)) const
+    const std::string& indent, const ConfigComponent* comp, const ConfigLinkMap_t& UNUSED(linkMap))
 {
 
-    fprintf(
-        outputFile, "%s<component id=\"system.%s\" name=\"%s\" type=\"%s\">\n", indent.c_str(), comp->name.c_str(),
+    print(
+        "%s<component id=\"system.%s\" name=\"%s\" type=\"%s\">\n", indent.c_str(), comp->name.c_str(),
         comp->name.c_str(), comp->type.c_str());
 
     // for(auto paramsItr = comp->params.begin(); paramsItr != comp->params.end(); paramsItr++) {
@@ -61,24 +62,21 @@ XMLConfigGraphOutput::generateXML(
         std::string paramName  = *paramsItr;
         std::string paramValue = comp->params.find<std::string>(*paramsItr);
 
-        fprintf(
-            outputFile, "%s%s<param name=\"%s\" value=\"%s\"/>\n", indent.c_str(), "   ", paramName.c_str(),
-            paramValue.c_str());
+        print("%s%s<param name=\"%s\" value=\"%s\"/>\n", indent.c_str(), "   ", paramName.c_str(), paramValue.c_str());
     }
 
-    fprintf(outputFile, "%s</component>\n", indent.c_str());
+    print("%s</component>\n", indent.c_str());
 }
 
 void
 XMLConfigGraphOutput::generateXML(
-    const std::string& indent, const ConfigLink* link, const ConfigComponentMap_t& compMap) const
+    const std::string& indent, const ConfigLink* link, const ConfigComponentMap_t& compMap)
 {
 
     const ConfigComponent* link_left  = compMap[link->component[0]];
     const ConfigComponent* link_right = compMap[link->component[1]];
 
-    fprintf(
-        outputFile,
+    print(
         "%s<link id=\"%s\" name=\"%s\"\n%s%sleft=\"%s\" right=\"%s\"\n%s%sleftport=\"%s\" rightport=\"%s\"/>\n",
         indent.c_str(), link->name.c_str(), link->name.c_str(), indent.c_str(), "   ", link_left->name.c_str(),
         link_right->name.c_str(), indent.c_str(), "   ", link->port[0].c_str(), link->port[1].c_str());
@@ -0,0 +1,52 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#include "sst_config.h"
+
+#include "sst/core/checkpointAction.h"
+
+#include "sst/core/simulation_impl.h"
+
+namespace SST {
+
+CheckpointAction::CheckpointAction(Simulation_impl* sim, SimTime_t period) : Action(), m_sim(sim), m_period(period)
+{
+    setPriority(SYNCPRIORITY);
+    schedule();
+}
+
+CheckpointAction::~CheckpointAction() {}
+
+void
+CheckpointAction::schedule()
+{
+    SimTime_t next = (m_sim->getCurrentSimCycle() / m_period + 1) * m_period;
+    m_sim->insertActivity(next, this);
+}
+
+void
+CheckpointAction::execute(void)
+{
+    // There are no syncs, so there is nothing to restore on a restart
+    m_sim->checkpoint(MAX_SIMTIME_T, MAX_SIMTIME_T);
+    schedule();
+}
+
+void
+CheckpointAction::print(const std::string& header, Output& out) const
+{
+    out.output(
+        "%s CheckpointAction with period %" PRIu64 " to be delivered at %" PRIu64 " with priority %d\n",
+        header.c_str(), m_period, getDeliveryTime(), getPriority());
+}
+
+} // namespace SST
@@ -0,0 +1,54 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef SST_CORE_CHECKPOINTACTION_H
+#define SST_CORE_CHECKPOINTACTION_H
+
+#include "sst/core/action.h"
+#include "sst/core/sst_types.h"
+
+namespace SST {
+
+class Simulation_impl;
+
+/**
+  \class CheckpointAction
+    Writes checkpoints for a simulation that never syncs.  Simulations
+    with cross rank or cross thread links write their checkpoints at
+    the sync points chosen by the SyncManager instead.
+*/
+class CheckpointAction : public Action
+{
+public:
+    /**
+    Create a new checkpoint action, which inserts itself into the
+    TimeVortex of sim at the next multiple of period
+    */
+    CheckpointAction(Simulation_impl* sim, SimTime_t period);
+    ~CheckpointAction();
+
+    void print(const std::string& header, Output& out) const override;
+
+private:
+    CheckpointAction() {};
+    CheckpointAction(const CheckpointAction&);
+
+    void             operator=(CheckpointAction const&);
+    void             execute(void) override;
+    void             schedule();
+    Simulation_impl* m_sim;
+    SimTime_t        m_period;
+};
+
+} // namespace SST
+
+#endif // SST_CORE_CHECKPOINTACTION_H
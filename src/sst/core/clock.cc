@@ -17,11 +17,22 @@
 #include "sst/core/simulation_impl.h"
 #include "sst/core/timeConverter.h"
 
+#include <algorithm>
 #include <sys/time.h>
 
 namespace SST {
 
-Clock::Clock(TimeConverter* period, int priority) : Action(), currentCycle(0), period(period), scheduled(false)
+Clock::Clock(TimeConverter* period, int priority) :
+    Action(),
+    currentCycle(0),
+    period(period),
+    numHandlers(0),
+    numRemoved(0),
+    numAwake(0),
+    scheduled(false),
+    wakeup(nullptr),
+    group(nullptr),
+    grouped(false)
 {
     setPriority(priority);
 }
@@ -30,37 +41,114 @@ Clock::~Clock()
 {
     // Delete all the handlers
     for ( StaticHandlerMap_t::iterator it = staticHandlerMap.begin(); it != staticHandlerMap.end(); ++it ) {
-        delete *it;
+        delete it->handler;
+        delete it->skip_handler;
     }
     staticHandlerMap.clear();
+    for ( auto* handler : suspendable ) {
+        delete handler;
+    }
 }
 
 bool
 Clock::registerHandler(Clock::HandlerBase* handler)
 {
-    staticHandlerMap.push_back(handler);
+    staticHandlerMap.push_back({ handler, nullptr, 0 });
+    numHandlers++;
+    if ( !scheduled ) { schedule(); }
+    return 0;
+}
+
+bool
+Clock::registerHandler(Clock::SkipHandlerBase* handler)
+{
+    staticHandlerMap.push_back({ nullptr, handler, 0 });
+    numHandlers++;
     if ( !scheduled ) { schedule(); }
     return 0;
 }
 
+size_t
+Clock::registerSuspendable(Clock::HandlerBase* handler)
+{
+    size_t slot = suspendable.size();
+    suspendable.push_back(handler);
+    if ( slot % 64 == 0 ) awake.push_back(0);
+    resume(slot);
+    return slot;
+}
+
+void
+Clock::suspend(size_t slot)
+{
+    uint64_t bit = uint64_t(1) << (slot % 64);
+    if ( !(awake[slot / 64] & bit) ) return;
+    awake[slot / 64] &= ~bit;
+    numAwake--;
+    numHandlers--;
+}
+
+Cycle_t
+Clock::resume(size_t slot)
+{
+    uint64_t bit = uint64_t(1) << (slot % 64);
+    if ( !(awake[slot / 64] & bit) && suspendable[slot] ) {
+        awake[slot / 64] |= bit;
+        numAwake++;
+        numHandlers++;
+        if ( !scheduled ) { schedule(); }
+    }
+    return getNextCycle();
+}
+
 bool
 Clock::unregisterHandler(Clock::HandlerBase* handler, bool& empty)
 {
+    for ( size_t i = 0; i < staticHandlerMap.size(); ++i ) {
+        if ( staticHandlerMap[i].handler == handler ) {
+            removeHandler(i);
+            break;
+        }
+    }
+    for ( size_t i = 0; i < suspendable.size(); ++i ) {
+        if ( suspendable[i] == handler ) {
+            suspend(i);
+            suspendable[i] = nullptr;
+            break;
+        }
+    }
 
-    StaticHandlerMap_t::iterator iter = staticHandlerMap.begin();
+    empty = numHandlers == 0;
+
+    return 0;
+}
 
-    for ( ; iter != staticHandlerMap.end(); iter++ ) {
-        if ( *iter == handler ) {
-            staticHandlerMap.erase(iter);
+bool
+Clock::unregisterHandler(Clock::SkipHandlerBase* handler, bool& empty)
+{
+    for ( size_t i = 0; i < staticHandlerMap.size(); ++i ) {
+        if ( staticHandlerMap[i].skip_handler == handler ) {
+            removeHandler(i);
             break;
         }
     }
 
-    empty = staticHandlerMap.empty();
+    empty = numHandlers == 0;
 
     return 0;
 }
 
+void
+Clock::removeHandler(size_t index)
+{
+    // The handler may have been unregistered while it was running
+    if ( !staticHandlerMap[index].handler && !staticHandlerMap[index].skip_handler ) return;
+    staticHandlerMap[index].handler      = nullptr;
+    staticHandlerMap[index].skip_handler = nullptr;
+    numHandlers--;
+    numRemoved++;
+}
+
 Cycle_t
 Clock::getNextCycle()
 {
@@ -74,40 +162,119 @@ Clock::execute(void)
 {
     Simulation_impl* sim = Simulation_impl::getSimulation();
 
-    if ( staticHandlerMap.empty() ) {
+    // With the tight clock loop, ticks are run back to back until
+    // something else is due
+    do {
+        if ( !tick() ) return;
+    } while ( sim->runNext(this, next) );
+    sim->insertActivity(next, this);
+}
+
+bool
+Clock::tick()
+{
+    Simulation_impl* sim = Simulation_impl::getSimulation();
+
+    if ( numHandlers == 0 ) {
         scheduled = false;
-        return;
+        return false;
     }
 
     // Derive the current cycle from the core time
     // currentCycle = period->convertFromCoreTime(sim->getCurrentSimCycle());
     currentCycle++;
 
-    StaticHandlerMap_t::iterator sop_iter;
-    for ( sop_iter = staticHandlerMap.begin(); sop_iter != staticHandlerMap.end(); ) {
-        Clock::HandlerBase* handler = *sop_iter;
+    // Suspendable handlers resumed during the tick are first called on
+    // the next one
+    awakeTick.assign(awake.begin(), awake.end());
 
+    // Handlers are looked up by index, since they can register more
+    // handlers on this clock.  Those are first called on the next
+    // cycle.
+    size_t  count = staticHandlerMap.size();
+    Cycle_t wake  = MAX_SIMTIME_T;
+    for ( size_t i = 0; i < count; ++i ) {
+        HandlerEntry& entry = staticHandlerMap[i];
 
-        if ( (*handler)(currentCycle) )
-            sop_iter = staticHandlerMap.erase(sop_iter);
-        else
-            ++sop_iter;
+        if ( entry.handler ) {
+            if ( (*entry.handler)(currentCycle) )
+                removeHandler(i);
+            else
+                wake = currentCycle + 1;
+        }
+        else if ( entry.skip_handler ) {
+            if ( entry.wake > currentCycle ) {
+                wake = std::min(wake, entry.wake);
+                continue;
+            }
+            Cycle_t handler_wake = (*entry.skip_handler)(currentCycle);
+            if ( handler_wake == 0 ) {
+                removeHandler(i);
+            }
+            else {
+                handler_wake             = std::max(handler_wake, currentCycle + 1);
+                staticHandlerMap[i].wake = handler_wake;
+                wake                     = std::min(wake, handler_wake);
+            }
+        }
+    }
+    if ( staticHandlerMap.size() > count ) wake = currentCycle + 1;
+
+    for ( size_t word = 0; word < awakeTick.size(); ++word ) {
+        uint64_t bits = awakeTick[word];
+        while ( bits != 0 ) {
+            uint64_t bit = bits & -bits;
+            bits ^= bit;
+            // Skip handlers suspended earlier in this tick
+            if ( !(awake[word] & bit) ) continue;
+            size_t slot = word * 64 + __builtin_ctzll(bit);
+            if ( (*suspendable[slot])(currentCycle) ) suspend(slot);
+        }
+    }
+    if ( numAwake != 0 ) wake = currentCycle + 1;
+
+    // Removed handlers are compacted in one pass that keeps the
+    // order the handlers are called in
+    if ( numRemoved > 0 ) {
+        staticHandlerMap.erase(
+            std::remove_if(
+                staticHandlerMap.begin(), staticHandlerMap.end(),
+                [](const HandlerEntry& entry) { return !entry.handler && !entry.skip_handler; }),
+            staticHandlerMap.end());
+        numRemoved = 0;
+    }
 
-        // (*handler)(currentCycle);
-        // ++sop_iter;
+    if ( numHandlers != 0 && wake > currentCycle + 1 ) {
+        skipTo(wake);
+        return false;
     }
 
     next = sim->getCurrentSimCycle() + period->getFactor();
-    sim->insertActivity(next, this);
+    return !(group && group->join(this));
+}
 
-    return;
+void
+Clock::skipTo(Cycle_t cycle)
+{
+    Simulation_impl* sim = Simulation_impl::getSimulation();
+
+    // A clock that is not scheduled is scheduled again when a handler
+    // is registered, which then also cancels the WakeUp
+    wakeup    = new WakeUp(this, cycle);
+    scheduled = false;
+    next      = sim->getCurrentSimCycle() + (cycle - currentCycle) * period->getFactor();
+    sim->insertActivity(next, wakeup);
 }
 
 void
 Clock::schedule()
 {
     Simulation_impl* sim = Simulation_impl::getSimulation();
-    currentCycle         = sim->getCurrentSimCycle() / period->getFactor();
+    if ( wakeup ) {
+        wakeup->clock = nullptr;
+        wakeup        = nullptr;
+    }
+    currentCycle         = period->convertFromCoreTime(sim->getCurrentSimCycle());
     SimTime_t next       = (currentCycle * period->getFactor()) + period->getFactor();
 
     // Check to see if we need to insert clock into queue at current
@@ -116,7 +283,9 @@ Clock::schedule()
     // However, if we are at time = 0, then we always go out to the
     // next cycle;
     if ( sim->getCurrentPriority() < getPriority() && sim->getCurrentSimCycle() != 0 ) {
-        if ( sim->getCurrentSimCycle() % period->getFactor() == 0 ) { next = sim->getCurrentSimCycle(); }
+        if ( period->convertToCoreTime(currentCycle) == sim->getCurrentSimCycle() ) {
+            next = sim->getCurrentSimCycle();
+        }
     }
 
     // std::cout << "Scheduling clock " << period->getFactor() << " at cycle " << next << " current cycle is " <<
@@ -129,7 +298,7 @@ void
 Clock::updateCurrentCycle()
 {
     Simulation_impl* sim = Simulation_impl::getSimulation();
-    currentCycle         = sim->getCurrentSimCycle() / period->getFactor();
+    currentCycle         = period->convertFromCoreTime(sim->getCurrentSimCycle());
     return;
 }
 
@@ -138,7 +307,122 @@ Clock::toString() const
 {
     std::stringstream buf;
     buf << "Clock Activity with period " << period->getFactor() << " to be delivered at " << getDeliveryTime()
-        << " with priority " << getPriority() << " with " << staticHandlerMap.size() << " items on clock list";
+        << " with priority " << getPriority() << " with " << numHandlers << " items on clock list";
+    return buf.str();
+}
+
+Clock::WakeUp::WakeUp(Clock* clock, Cycle_t cycle) : Action(), clock(clock), cycle(cycle)
+{
+    setPriority(clock->getPriority());
+}
+
+void
+Clock::WakeUp::execute(void)
+{
+    if ( clock ) {
+        clock->wakeup       = nullptr;
+        clock->scheduled    = true;
+        clock->currentCycle = cycle - 1;
+        clock->execute();
+    }
+    delete this;
+}
+
+std::string
+Clock::WakeUp::toString() const
+{
+    std::stringstream buf;
+    buf << "Clock WakeUp Activity for cycle " << cycle << " to be delivered at " << getDeliveryTime()
+        << " with priority " << getPriority() << (clock ? "" : " (cancelled)");
+    return buf.str();
+}
+
+Clock::Group::Group(int priority) : Action(), time(0), scheduled(false), running(false)
+{
+    setPriority(priority);
+}
+
+Clock::Group::~Group()
+{
+    // The clocks waiting on the group are not in the TimeVortex, which
+    // would otherwise have deleted them
+    for ( Clock* clock : clocks ) {
+        if ( clock->grouped ) delete clock;
+    }
+}
+
+void
+Clock::Group::addClock(Clock* clock)
+{
+    // Clocks that are due at the same time fire in the order they were
+    // inserted into the TimeVortex, and so in the order of their
+    // previous ticks.  That puts the clock with the longest period
+    // first, which the group keeps.
+    auto it = std::upper_bound(clocks.begin(), clocks.end(), clock, [](Clock* lhs, Clock* rhs) {
+        return lhs->period->getFactor() > rhs->period->getFactor();
+    });
+    clocks.insert(it, clock);
+    clock->group = this;
+}
+
+bool
+Clock::Group::join(Clock* clock)
+{
+    // Once in the TimeVortex, the group can not be moved earlier
+    if ( scheduled && clock->next < time ) return false;
+
+    clock->grouped = true;
+    if ( !running && !scheduled ) {
+        time      = clock->next;
+        scheduled = true;
+        Simulation_impl::getSimulation()->insertActivity(time, this);
+    }
+    return true;
+}
+
+void
+Clock::Group::execute(void)
+{
+    Simulation_impl* sim = Simulation_impl::getSimulation();
+
+    // With the tight clock loop, ticks are run back to back until
+    // something else is due
+    do {
+        SimTime_t now = sim->getCurrentSimCycle();
+
+        // Clocks are looked up by index, since a handler can create a
+        // new clock.  That only moves the clocks after it, which are
+        // then seen again but are not due.
+        scheduled = false;
+        running   = true;
+        for ( size_t i = 0; i < clocks.size(); ++i ) {
+            Clock* clock = clocks[i];
+            if ( clock->grouped && clock->next == now ) {
+                clock->grouped = false;
+                clock->execute();
+            }
+        }
+        running = false;
+
+        SimTime_t next = MAX_SIMTIME_T;
+        for ( Clock* clock : clocks ) {
+            if ( clock->grouped ) next = std::min(next, clock->next);
+        }
+        if ( next == MAX_SIMTIME_T ) return;
+
+        time = next;
+    } while ( sim->runNext(this, time) );
+
+    scheduled = true;
+    sim->insertActivity(time, this);
+}
+
+std::string
+Clock::Group::toString() const
+{
+    std::stringstream buf;
+    buf << "Clock Group Activity to be delivered at " << getDeliveryTime() << " with priority " << getPriority()
+        << " with " << clocks.size() << " clocks";
     return buf.str();
 }
 
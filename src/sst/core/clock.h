@@ -67,6 +67,56 @@ public:
     template <typename classT, typename dataT = void>
     using Handler = SSTHandler<bool, Cycle_t, classT, dataT>;
 
+    /**
+       Used to create clock handlers when the callback function is
+       known at compile time.  The callback is the same as for
+       Handler, and the class is created with:
+
+         new Clock::Handler2<classname, &classname::function_name>(this)
+
+       Static data is added as for Event::Handler2.
+     */
+    template <typename classT, auto funcT, typename dataT = void>
+    using Handler2 = SSTHandler2<bool, Cycle_t, classT, dataT, funcT>;
+
+    /**
+       Base handler for clock functions that can skip ahead.
+     */
+    using SkipHandlerBase = SSTHandlerBase<Cycle_t, Cycle_t>;
+
+    /**
+       Used to create handlers for clock that tell the clock when they
+       next need to be called.  The callback function is expected to be
+       in the form of:
+
+         Cycle_t func(Cycle_t cycle)
+
+       and the class is created with:
+
+         new Clock::SkipHandler<classname>(this, &classname::function_name)
+
+       Static data can be added the same way as for Handler.
+
+       The returned value is the next cycle the handler needs to be
+       called on.  Returning cycle + 1 calls the handler every cycle,
+       and a later cycle skips the cycles in between.  If the handlers
+       of a clock all skip ahead, the clock does not fire until one of
+       them needs it.  On return of 0, the handler will be removed
+       from the list, as for a Handler that returns true.
+     */
+    template <typename classT, typename dataT = void>
+    using SkipHandler = SSTHandler<Cycle_t, Cycle_t, classT, dataT>;
+
+    /**
+       Handle to a handler registered with registerSuspendable(), used
+       to suspend and resume it.
+     */
+    struct SuspendHandle
+    {
+        Clock* clock;
+        size_t slot;
+    };
+
     /**
      * Activates this clock object, by inserting into the simulation's
      * timeVortex for future execution.
@@ -85,24 +135,123 @@ public:
 
     /** Add a handler to be called on this clock's tick */
     bool registerHandler(Clock::HandlerBase* handler);
+    /** Add a handler to be called on the clock ticks it asks for */
+    bool registerHandler(Clock::SkipHandlerBase* handler);
+    /** Add a handler that can be suspended and resumed.  The handler
+     * keeps its slot while it is suspended, and the clock only calls
+     * the handlers marked awake in a bitmap, so suspend() and resume()
+     * don't search or change the list of handlers.  Returning true
+     * from the handler suspends it instead of removing it.  The
+     * handlers are called after the other handlers of the clock.
+     * @return Slot of the handler
+     */
+    size_t registerSuspendable(Clock::HandlerBase* handler);
+    /** Stop calling the handler in slot until it is resumed */
+    void suspend(size_t slot);
+    /** Call the handler in slot again.  A handler resumed during a tick
+     * is first called on the next one.
+     * @return The next cycle of the clock */
+    Cycle_t resume(size_t slot);
     /** Remove a handler from the list of handlers to be called on the clock tick */
     bool unregisterHandler(Clock::HandlerBase* handler, bool& empty);
+    /** Remove a handler from the list of handlers to be called on the clock tick */
+    bool unregisterHandler(Clock::SkipHandlerBase* handler, bool& empty);
 
     std::string toString() const override;
 
 private:
+    // Saves and restores the clock state in a checkpoint
+    friend class Simulation_impl;
+
+    /** A registered handler.  Only one of handler and skip_handler
+     * is set, and neither once the handler has been removed. */
+    struct HandlerEntry
+    {
+        Clock::HandlerBase*     handler;
+        Clock::SkipHandlerBase* skip_handler;
+        Cycle_t                 wake; // Next cycle skip_handler is called on
+    };
+
+    /** Fires a clock that skipped ahead because none of its handlers
+     * needed the cycles in between.  If the clock is scheduled again
+     * before then, the WakeUp is left in the TimeVortex and does
+     * nothing. */
+    class WakeUp : public Action
+    {
+    public:
+        WakeUp(Clock* clock, Cycle_t cycle);
+
+        void        execute(void) override;
+        std::string toString() const override;
+
+        Clock*  clock; // nullptr once the clock was scheduled again
+        Cycle_t cycle;
+
+        NotSerializable(SST::Clock::WakeUp)
+    };
+
+    /** Fires the clocks of one priority that are due at the same
+     * time, so clocks with harmonically related periods share one
+     * TimeVortex entry instead of each having their own.  A clock is
+     * only handed to the group for the tick after a regular tick; a
+     * clock that was just scheduled or woken up fires on its own
+     * first. */
+    class Group : public Action
+    {
+    public:
+        Group(int priority);
+        ~Group();
+
+        /** Add a newly created clock */
+        void addClock(Clock* clock);
+
+        /** Let the group fire the next tick of clock, at clock->next.
+         * @return false if the group is scheduled too late to do it */
+        bool join(Clock* clock);
+
+        void        execute(void) override;
+        std::string toString() const override;
+
+        std::vector<Clock*> clocks;    // Longest period first
+        SimTime_t           time;      // Time the group is scheduled for
+        bool                scheduled;
+        bool                running;
+
+        NotSerializable(SST::Clock::Group)
+    };
+
     /*     typedef std::list<Clock::HandlerBase*> HandlerMap_t; */
-    typedef std::vector<Clock::HandlerBase*> StaticHandlerMap_t;
+    typedef std::vector<HandlerEntry> StaticHandlerMap_t;
 
     Clock() {}
 
     void execute(void) override;
 
+    /** Calls the handlers for one tick.
+     * @return true if the clock has to be scheduled for next */
+    bool tick();
+
+    /** Marks the handler at index as removed */
+    void removeHandler(size_t index);
+
+    /** Sleep until cycle, which is more than one cycle away */
+    void skipTo(Cycle_t cycle);
+
     Cycle_t            currentCycle;
     TimeConverter*     period;
-    StaticHandlerMap_t staticHandlerMap;
+    StaticHandlerMap_t staticHandlerMap; // Compacted at the next tick after removals
+    size_t             numHandlers;      // Includes the awake suspendable handlers
+    size_t             numRemoved;
+
+    std::vector<Clock::HandlerBase*> suspendable; // By slot, nullptr once unregistered
+    std::vector<uint64_t>            awake;       // Bitmap of the slots that are not suspended
+    std::vector<uint64_t>            awakeTick;   // Copy of awake at the start of the tick
+    size_t                           numAwake;
     SimTime_t          next;
     bool               scheduled;
+    WakeUp*            wakeup;  // Set while skipping ahead
+    Group*             group;
+    bool               grouped; // Next tick is fired by group
 
     NotSerializable(SST::Clock)
 };
@@ -0,0 +1,69 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_CLOCKBATCH_H
+#define SST_CORE_CLOCKBATCH_H
+
+#include "sst/core/sst_types.h"
+
+#include <cstddef>
+
+namespace SST {
+
+/**
+ * Clock handler shared by the components of one type on a clock.
+ * Instead of each registering a handler, the components of a large
+ * homogeneous array register with a batch (see
+ * BaseComponent::registerClockBatch()).  The batch keeps their state in
+ * struct-of-arrays form, one vector per field indexed by the slot each
+ * component was given, and updates all of them in one call per tick.
+ * The loops over the fields can then be vectorized by the compiler, or
+ * handed to an accelerator by the batch itself.
+ *
+ * The core creates one batch of each type per clock and simulation
+ * thread, and deletes it at the end of the simulation.  Batches are not
+ * checkpointed, so components save their own slots in serialize_order().
+ */
+class ClockBatch
+{
+public:
+    ClockBatch() : count(0) {}
+    virtual ~ClockBatch() {}
+
+    /** Number of components in the batch */
+    size_t size() const { return count; }
+
+protected:
+    /** Grow the fields to hold size components.  Called each time a
+     * component is added. */
+    virtual void resize(size_t size) = 0;
+
+    /** Called on every tick of the clock for all the components.
+     * @return true to remove the batch from the clock */
+    virtual bool tick(Cycle_t cycle) = 0;
+
+private:
+    friend class BaseComponent;
+    friend class Simulation_impl;
+
+    /** Add a component and return its slot */
+    size_t add()
+    {
+        resize(count + 1);
+        return count++;
+    }
+
+    size_t count;
+};
+
+} // namespace SST
+
+#endif // SST_CORE_CLOCKBATCH_H
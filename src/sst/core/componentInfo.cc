@@ -13,16 +13,36 @@
 
 #include "sst/core/componentInfo.h"
 
+#include "sst/core/activityQueue.h"
 #include "sst/core/configGraph.h"
 #include "sst/core/linkMap.h"
 
+#include <mutex>
+
 namespace SST {
 
+std::atomic<uint64_t> ComponentInfo::tree_version(0);
+
+// So lookup keys don't need the lock in intern()
+static const std::string empty_string;
+
+const std::string&
+ComponentInfo::intern(const std::string& str)
+{
+    if ( str.empty() ) return empty_string;
+
+    // Never freed, but there is only one of each type and slot name
+    static std::mutex                      mtx;
+    static std::unordered_set<std::string> strings;
+    std::lock_guard<std::mutex>            lock(mtx);
+    return *strings.insert(str).first;
+}
+
 ComponentInfo::ComponentInfo(ComponentId_t id, const std::string& name) :
     id(id),
     parent_info(nullptr),
     name(name),
-    type(""),
+    type(empty_string),
     link_map(nullptr),
     component(nullptr),
     params(nullptr),
@@ -33,9 +53,10 @@ ComponentInfo::ComponentInfo(ComponentId_t id, const std::string& name) :
     allStatConfig(nullptr),
     coordinates(3, 0.0),
     subIDIndex(1),
-    slot_name(""),
+    slot_name(empty_string),
     slot_num(-1),
-    share_flags(0)
+    share_flags(0),
+    untimed_requested(false)
 {}
 
 // ComponentInfo::ComponentInfo(ComponentId_t id, ComponentInfo* parent_info, const std::string& type, const Params
@@ -62,7 +83,7 @@ ComponentInfo::ComponentInfo(
     id(id),
     parent_info(parent_info),
     name(""),
-    type(type),
+    type(intern(type)),
     link_map(nullptr),
     component(nullptr),
     params(/*new Params()*/ nullptr),
@@ -74,9 +95,10 @@ ComponentInfo::ComponentInfo(
     statLoadLevel(0),
     coordinates(parent_info->coordinates),
     subIDIndex(1),
-    slot_name(slot_name),
+    slot_name(intern(slot_name)),
     slot_num(slot_num),
-    share_flags(share_flags)
+    share_flags(share_flags),
+    untimed_requested(false)
 {
     /*params.insert(params_in.getParams());*/
 }
@@ -86,7 +108,7 @@ ComponentInfo::ComponentInfo(
     id(ccomp->id),
     parent_info(parent_info),
     name(name),
-    type(ccomp->type),
+    type(intern(ccomp->type)),
     link_map(link_map),
     component(nullptr),
     params(&ccomp->params),
@@ -98,12 +120,17 @@ ComponentInfo::ComponentInfo(
     statLoadLevel(ccomp->statLoadLevel),
     coordinates(ccomp->coords),
     subIDIndex(1),
-    slot_name(ccomp->name),
+    slot_name(intern(ccomp->name)),
     slot_num(ccomp->slot_num),
-    share_flags(0)
+    share_flags(0),
+    untimed_requested(false)
 {
     // printf("ComponentInfo(ConfigComponent): id = %llx\n",ccomp->id);
 
+    // The graph is done being built, so the params can be switched
+    // over to the faster read-only lookups
+    ccomp->params.freeze();
+
     // See how many subcomponents are in each slot so we know how to name them
     std::map<std::string, int> counts;
     for ( auto sc : ccomp->subComponents ) {
@@ -131,7 +158,7 @@ ComponentInfo::ComponentInfo(ComponentInfo&& o) :
     id(o.id),
     parent_info(o.parent_info),
     name(std::move(o.name)),
-    type(std::move(o.type)),
+    type(o.type),
     link_map(o.link_map),
     component(o.component),
     subComponents(std::move(o.subComponents)),
@@ -144,7 +171,8 @@ ComponentInfo::ComponentInfo(ComponentInfo&& o) :
     subIDIndex(o.subIDIndex),
     slot_name(o.slot_name),
     slot_num(o.slot_num),
-    share_flags(o.share_flags)
+    share_flags(o.share_flags),
+    untimed_requested(o.untimed_requested)
 {
     o.parent_info     = nullptr;
     o.link_map        = nullptr;
@@ -187,6 +215,7 @@ ComponentInfo::addAnonymousSubComponent(
     subComponents.emplace_hint(
         subComponents.end(), std::piecewise_construct, std::make_tuple(cid),
         std::forward_as_tuple(cid, parent_info, type, slot_name, slot_num, share_flags));
+    tree_version.fetch_add(1, std::memory_order_relaxed);
 
     return cid;
 }
@@ -199,9 +228,6 @@ ComponentInfo::finalizeLinkConfiguration() const
             i.second->finalizeConfiguration();
         }
     }
-    for ( auto& s : subComponents ) {
-        s.second.finalizeLinkConfiguration();
-    }
 }
 
 void
@@ -212,9 +238,19 @@ ComponentInfo::prepareForComplete() const
             i.second->prepareForComplete();
         }
     }
-    for ( auto& s : subComponents ) {
-        s.second.prepareForComplete();
+}
+
+bool
+ComponentInfo::hasUntimedData() const
+{
+    // Untimed data sent to a link is held in the send_queue of its pair
+    if ( nullptr != link_map ) {
+        for ( auto& i : link_map->getLinkMap() ) {
+            ActivityQueue* queue = i.second->pair_link->send_queue;
+            if ( queue != nullptr && !queue->empty() ) return true;
+        }
     }
+    return false;
 }
 
 ComponentInfo*
@@ -255,4 +291,57 @@ ComponentInfo::hasLinks() const
     return false;
 }
 
+void
+ComponentInfoMap::flatten(ComponentInfo* info)
+{
+    tree.push_back(info);
+    for ( auto& sc : info->subComponents ) {
+        flatten(&sc.second);
+    }
+}
+
+void
+ComponentInfoMap::rebuild()
+{
+    // Read first, so a SubComponent added while building means another
+    // rebuild instead of being missed
+    tree_version = ComponentInfo::tree_version.load(std::memory_order_relaxed);
+
+    components.assign(dataByID.begin(), dataByID.end());
+    tree.clear();
+    tree_start.clear();
+    for ( auto* info : components ) {
+        tree_start.push_back(tree.size());
+        flatten(info);
+    }
+    tree_start.push_back(tree.size());
+    tree_valid = true;
+}
+
+bool
+ComponentInfoMap::hasUntimedData(size_t index)
+{
+    update();
+    for ( size_t i = tree_start[index]; i < tree_start[index + 1]; ++i ) {
+        if ( tree[i]->hasUntimedData() ) return true;
+    }
+    return false;
+}
+
+void
+ComponentInfoMap::finalizeLinkConfiguration()
+{
+    for ( auto* info : getTree() ) {
+        info->finalizeLinkConfiguration();
+    }
+}
+
+void
+ComponentInfoMap::prepareForComplete()
+{
+    for ( auto* info : getTree() ) {
+        info->prepareForComplete();
+    }
+}
+
 } // namespace SST
@@ -15,10 +15,12 @@
 #include "sst/core/params.h"
 #include "sst/core/sst_types.h"
 
+#include <atomic>
 #include <functional>
 #include <map>
 #include <string>
 #include <unordered_set>
+#include <vector>
 
 namespace SST {
 
@@ -75,9 +77,10 @@ private:
     const std::string name;
 
     /**
-       Type of the Component/SubComponent.
+       Type of the Component/SubComponent.  Interned, since many
+       (Sub)Components have the same type.
      */
-    const std::string type;
+    const std::string& type;
 
     /**
        LinkMap containing the links assigned to this
@@ -125,9 +128,9 @@ private:
 
     /**
        Name of the slot this SubComponent was loaded into.  This field
-       is not used for Components.
+       is not used for Components.  Interned like the type.
      */
-    const std::string slot_name;
+    const std::string& slot_name;
 
     /**
        Index in the slot this SubComponent was loaded into.  This field
@@ -142,6 +145,21 @@ private:
      */
     uint64_t share_flags;
 
+    /**
+       Set when the Component asks to be called in the next init or
+       complete phase.  Only used on Components.
+     */
+    bool untimed_requested;
+
+    /**
+       Incremented whenever a SubComponent is added, so a
+       ComponentInfoMap knows when its flattened trees are stale.
+     */
+    static std::atomic<uint64_t> tree_version;
+
+    /** Get the copy of a string kept for all the ComponentInfos */
+    static const std::string& intern(const std::string& str);
+
     bool sharesPorts() { return (share_flags & SHARE_PORTS) != 0; }
 
     bool sharesStatistics() { return (share_flags & SHARE_STATS) != 0; }
@@ -153,9 +171,16 @@ private:
 
     /* Lookup Key style constructor */
     ComponentInfo(ComponentId_t id, const std::string& name);
+
+    // These only handle the links of this ComponentInfo.  The
+    // ComponentInfoMap applies them to the SubComponents.
     void finalizeLinkConfiguration() const;
     void prepareForComplete() const;
 
+    /** Check whether any link of this ComponentInfo has untimed data
+     * waiting to be received */
+    bool hasUntimedData() const;
+
     ComponentId_t addAnonymousSubComponent(
         ComponentInfo* parent_info, const std::string& type, const std::string& slot_name, int slot_num,
         uint64_t share_flags);
@@ -251,6 +276,24 @@ class ComponentInfoMap
 private:
     std::unordered_set<ComponentInfo*, ComponentInfo::HashID, ComponentInfo::EqualsID> dataByID;
 
+    // The Components, and every Component followed by its
+    // SubComponents in preorder, so the phases walk arrays instead of
+    // the set and the maps of SubComponents.  Built when first needed
+    // after a Component is inserted or any SubComponent is added.
+    std::vector<ComponentInfo*> components;
+    std::vector<ComponentInfo*> tree;
+    std::vector<size_t>         tree_start; /*!< Where each Component starts in tree, then the end */
+    uint64_t                    tree_version;
+    bool                        tree_valid;
+
+    void flatten(ComponentInfo* info);
+    void rebuild();
+
+    void update()
+    {
+        if ( !tree_valid || tree_version != ComponentInfo::tree_version.load(std::memory_order_relaxed) ) rebuild();
+    }
+
 public:
     typedef std::unordered_set<ComponentInfo*, ComponentInfo::HashID, ComponentInfo::EqualsID>::const_iterator
         const_iterator;
@@ -259,9 +302,45 @@ public:
 
     const_iterator end() const { return dataByID.end(); }
 
-    ComponentInfoMap() {}
+    ComponentInfoMap() : tree_version(0), tree_valid(false) {}
+
+    void insert(ComponentInfo* info)
+    {
+        dataByID.insert(info);
+        tree_valid = false;
+    }
+
+    /** Number of Components, not counting SubComponents */
+    size_t size() { return dataByID.size(); }
+
+    /** Get a Component by index, in the same order as begin() to end() */
+    ComponentInfo* operator[](size_t index)
+    {
+        update();
+        return components[index];
+    }
+
+    /** Get every Component and SubComponent.  Each Component is
+     * followed by its SubComponents in preorder. */
+    const std::vector<ComponentInfo*>& getTree()
+    {
+        update();
+        return tree;
+    }
+
+    /** Check whether any link of a Component or its SubComponents has
+     * untimed data waiting to be received
+     * @param index Index of the Component
+     */
+    bool hasUntimedData(size_t index);
+
+    /** Call finalizeConfiguration() on the links of every Component
+     * and SubComponent */
+    void finalizeLinkConfiguration();
 
-    void insert(ComponentInfo* info) { dataByID.insert(info); }
+    /** Call prepareForComplete() on the links of every Component and
+     * SubComponent */
+    void prepareForComplete();
 
     ComponentInfo* getByID(const ComponentId_t key) const
     {
@@ -283,6 +362,10 @@ public:
             delete i;
         }
         dataByID.clear();
+        components.clear();
+        tree.clear();
+        tree_start.clear();
+        tree_valid = false;
     }
 };
 
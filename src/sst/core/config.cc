@@ -88,6 +88,19 @@ public:
         return 0;
     }
 
+    // model cache
+    static int setModelCache(Config* cfg, const std::string& arg)
+    {
+        cfg->model_cache_ = arg;
+        return 0;
+    }
+
+    static int setModelCacheKey(Config* cfg, const std::string& arg)
+    {
+        cfg->model_cache_key_ = arg;
+        return 0;
+    }
+
     // print timing
     static int setPrintTiming(Config* cfg, const std::string& arg)
     {
@@ -101,6 +114,39 @@ public:
         return -1;
     }
 
+    // print imbalance info
+    static int setPrintImbalance(Config* cfg, const std::string& arg)
+    {
+        if ( arg == "" ) {
+            cfg->print_imbalance_ = true;
+            return 0;
+        }
+        bool success          = false;
+        cfg->print_imbalance_ = cfg->parseBoolean(arg, success, "print-imbalance-info");
+        if ( success ) return 0;
+        return -1;
+    }
+
+    // print memory info
+    static int setPrintMemory(Config* cfg, const std::string& arg)
+    {
+        if ( arg == "" ) {
+            cfg->print_memory_ = true;
+            return 0;
+        }
+        bool success       = false;
+        cfg->print_memory_ = cfg->parseBoolean(arg, success, "print-memory-info");
+        if ( success ) return 0;
+        return -1;
+    }
+
+    // timing info json
+    static int setTimingJson(Config* cfg, const std::string& arg)
+    {
+        cfg->timing_json_ = arg;
+        return 0;
+    }
+
     // stop-at
     static int setStopAt(Config* cfg, const std::string& arg)
     {
@@ -149,6 +195,30 @@ public:
         return -1;
     }
 
+    // skip teardown at exit
+    static int setFastExit(Config* cfg, const std::string& arg)
+    {
+        if ( arg == "" ) {
+            cfg->fast_exit_ = true;
+            return 0;
+        }
+        bool success    = false;
+        cfg->fast_exit_ = cfg->parseBoolean(arg, success, "fast-exit");
+        return success ? 0 : -1;
+    }
+
+    // free build memory before the run
+    static int setReleaseBuildMemory(Config* cfg, const std::string& arg)
+    {
+        if ( arg == "" ) {
+            cfg->release_build_memory_ = true;
+            return 0;
+        }
+        bool success               = false;
+        cfg->release_build_memory_ = cfg->parseBoolean(arg, success, "release-build-memory");
+        return success ? 0 : -1;
+    }
+
 
     // partitioner
     static int setPartitioner(Config* cfg, const std::string& arg)
@@ -158,6 +228,44 @@ public:
         return 0;
     }
 
+    // partition weights
+    static int setPartitionWeights(Config* cfg, const std::string& arg)
+    {
+        cfg->partition_weights_ = arg;
+        return 0;
+    }
+
+    // partition cache
+    static int setPartitionCache(Config* cfg, const std::string& arg)
+    {
+        cfg->partition_cache_ = arg;
+        return 0;
+    }
+
+    // print partition report
+    static int setPartitionReport(Config* cfg, const std::string& arg)
+    {
+        if ( arg == "" ) {
+            cfg->partition_report_ = true;
+            return 0;
+        }
+        bool success           = false;
+        cfg->partition_report_ = cfg->parseBoolean(arg, success, "partition-report");
+        return success ? 0 : -1;
+    }
+
+    // stop after partitioning
+    static int setPartitionOnly(Config* cfg, const std::string& arg)
+    {
+        if ( arg == "" ) {
+            cfg->partition_only_ = true;
+            return 0;
+        }
+        bool success         = false;
+        cfg->partition_only_ = cfg->parseBoolean(arg, success, "partition-only");
+        return success ? 0 : -1;
+    }
+
     // heart beat
     static int setHeartbeat(Config* cfg, const std::string& arg)
     {
@@ -166,6 +274,80 @@ public:
         return 0;
     }
 
+    // checkpoint period
+    static int setCheckpointPeriod(Config* cfg, const std::string& arg)
+    {
+        cfg->checkpoint_period_ = arg;
+        return 0;
+    }
+
+    // checkpoint file prefix
+    static int setCheckpointPrefix(Config* cfg, const std::string& arg)
+    {
+        if ( arg.empty() ) {
+            fprintf(stderr, "Error: --checkpoint-prefix requires a non-empty prefix\n");
+            return -1;
+        }
+        cfg->checkpoint_prefix_ = arg;
+        return 0;
+    }
+
+    // restart from checkpoint
+    static int setLoadCheckpoint(Config* cfg, const std::string& arg)
+    {
+        cfg->load_checkpoint_ = arg;
+        return 0;
+    }
+
+    // write checkpoints in the background
+    static int setCheckpointAsync(Config* cfg, const std::string& arg)
+    {
+        if ( arg == "" ) {
+            cfg->checkpoint_async_ = true;
+            return 0;
+        }
+        bool success           = false;
+        cfg->checkpoint_async_ = cfg->parseBoolean(arg, success, "checkpoint-async");
+        return success ? 0 : -1;
+    }
+
+    // only save changed state in checkpoints
+    static int setCheckpointIncremental(Config* cfg, const std::string& arg)
+    {
+        if ( arg == "" ) {
+            cfg->checkpoint_incremental_ = true;
+            return 0;
+        }
+        bool success                 = false;
+        cfg->checkpoint_incremental_ = cfg->parseBoolean(arg, success, "checkpoint-incremental");
+        return success ? 0 : -1;
+    }
+
+    // metrics file
+    static int setMetricsFile(Config* cfg, const std::string& arg)
+    {
+        cfg->metrics_file_ = arg;
+        return 0;
+    }
+
+    // metrics period
+    static int setMetricsPeriod(Config* cfg, const std::string& arg)
+    {
+        try {
+            double val = stod(arg);
+            if ( val <= 0.0 ) {
+                fprintf(stderr, "Option --metrics-period must be greater than 0\n");
+                return -1;
+            }
+            cfg->metrics_period_ = val;
+            return 0;
+        }
+        catch ( std::invalid_argument& e ) {
+            fprintf(stderr, "Failed to parse '%s' as number for option --metrics-period\n", arg.c_str());
+            return -1;
+        }
+    }
+
     // output directory
     static int setOutputDir(Config* cfg, const std::string& arg)
     {
@@ -197,6 +379,13 @@ public:
         return 0;
     }
 
+    // output binary graph snapshot
+    static int setWriteBinary(Config* cfg, const std::string& arg)
+    {
+        cfg->output_binary_ = arg;
+        return 0;
+    }
+
     // parallel output
 #ifdef SST_CONFIG_HAVE_MPI
     static int enableParallelOutput(Config* cfg, const std::string& arg)
@@ -281,13 +470,26 @@ public:
         else
             cfg->parallel_load_ = true;
 
+        cfg->parallel_load_mode_replicate_ = false;
+        cfg->parallel_load_mode_node_      = false;
         if ( arg_lower == "single" )
             cfg->parallel_load_mode_multi_ = false;
         else if ( arg_lower == "multi" )
             cfg->parallel_load_mode_multi_ = true;
+        else if ( arg_lower == "replicate" ) {
+            cfg->parallel_load_mode_multi_     = false;
+            cfg->parallel_load_mode_replicate_ = true;
+        }
+        else if ( arg_lower == "node" ) {
+            cfg->parallel_load_mode_multi_     = false;
+            cfg->parallel_load_mode_replicate_ = true;
+            cfg->parallel_load_mode_node_      = true;
+        }
         else {
             fprintf(
-                stderr, "Invalid option '%s' passed to --parallel-load.  Valid options are NONE, SINGLE and MULTI.\n",
+                stderr,
+                "Invalid option '%s' passed to --parallel-load.  Valid options are NONE, SINGLE, MULTI, REPLICATE "
+                "and NODE.\n",
                 arg.c_str());
             return -1;
         }
@@ -314,6 +516,24 @@ public:
         return 0;
     }
 
+    // timevortex params
+    static int setTimeVortexParams(Config* cfg, const std::string& arg)
+    {
+        size_t start = 0;
+        while ( start <= arg.size() ) {
+            size_t end = arg.find(',', start);
+            if ( end == std::string::npos ) end = arg.size();
+            size_t eq = arg.find('=', start);
+            if ( eq == std::string::npos || eq >= end || eq == start ) {
+                fprintf(stderr, "Failed to parse '%s' as KEY=VALUE for option --timeVortex-params\n", arg.c_str());
+                return -1;
+            }
+            start = end + 1;
+        }
+        cfg->timeVortexParams_ = arg;
+        return 0;
+    }
+
     // interthread links
     static int setInterThreadLinks(Config* cfg, const std::string& arg)
     {
@@ -327,6 +547,235 @@ public:
         return success ? 0 : -1;
     }
 
+    // interthread lookahead
+    static int setInterThreadLookahead(Config* cfg, const std::string& arg)
+    {
+        if ( arg == "" ) {
+            cfg->interthread_lookahead_ = true;
+            return 0;
+        }
+
+        bool success                = false;
+        cfg->interthread_lookahead_ = cfg->parseBoolean(arg, success, "interthread-lookahead");
+        return success ? 0 : -1;
+    }
+
+    // direct delivery
+    static int setDirectDelivery(Config* cfg, const std::string& arg)
+    {
+        if ( arg == "" ) {
+            cfg->direct_delivery_ = true;
+            return 0;
+        }
+
+        bool success          = false;
+        cfg->direct_delivery_ = cfg->parseBoolean(arg, success, "direct-delivery");
+        return success ? 0 : -1;
+    }
+
+    // run clock cycles back to back
+    static int setTightClockLoop(Config* cfg, const std::string& arg)
+    {
+        if ( arg == "" ) {
+            cfg->tight_clock_loop_ = true;
+            return 0;
+        }
+
+        bool success           = false;
+        cfg->tight_clock_loop_ = cfg->parseBoolean(arg, success, "tight-clock-loop");
+        return success ? 0 : -1;
+    }
+
+    // sync compression
+    static int setSyncCompressThreshold(Config* cfg, const std::string& arg)
+    {
+        try {
+            unsigned long val             = stoul(arg);
+            cfg->sync_compress_threshold_ = val;
+            return 0;
+        }
+        catch ( std::invalid_argument& e ) {
+            fprintf(stderr, "Failed to parse '%s' as number for option --sync-compress-threshold\n", arg.c_str());
+            return -1;
+        }
+    }
+
+    // nonblocking sync reduction
+    static int setSyncNonblockingReduce(Config* cfg, const std::string& arg)
+    {
+        if ( arg == "" ) {
+            cfg->sync_nonblocking_reduce_ = true;
+            return 0;
+        }
+
+        bool success                  = false;
+        cfg->sync_nonblocking_reduce_ = cfg->parseBoolean(arg, success, "sync-nonblocking-reduce");
+        return success ? 0 : -1;
+    }
+
+    // sparse untimed data exchange
+    static int setSyncSparseUntimed(Config* cfg, const std::string& arg)
+    {
+        if ( arg == "" ) {
+            cfg->sync_sparse_untimed_ = true;
+            return 0;
+        }
+
+        bool success              = false;
+        cfg->sync_sparse_untimed_ = cfg->parseBoolean(arg, success, "sync-sparse-untimed");
+        return success ? 0 : -1;
+    }
+
+    // deferred end of simulation check
+    static int setDeferredExitCheck(Config* cfg, const std::string& arg)
+    {
+        if ( arg == "" ) {
+            cfg->deferred_exit_check_ = true;
+            return 0;
+        }
+
+        bool success              = false;
+        cfg->deferred_exit_check_ = cfg->parseBoolean(arg, success, "deferred-exit-check");
+        return success ? 0 : -1;
+    }
+
+    // number of concurrent ensemble runs
+    static int setEnsembleJobs(Config* cfg, const std::string& arg)
+    {
+        try {
+            unsigned long val   = stoul(arg);
+            cfg->ensemble_jobs_ = val;
+            return 0;
+        }
+        catch ( std::invalid_argument& e ) {
+            fprintf(stderr, "Failed to parse '%s' as number for option --ensemble-jobs\n", arg.c_str());
+            return -1;
+        }
+    }
+
+    // point to fork ensemble runs at
+    static int setEnsembleFork(Config* cfg, const std::string& arg)
+    {
+        if ( arg != "graph" && arg != "setup" ) {
+            fprintf(
+                stderr, "Invalid option '%s' passed to --ensemble-fork.  Valid options are graph and setup\n",
+                arg.c_str());
+            return -1;
+        }
+        cfg->ensemble_fork_ = arg;
+        return 0;
+    }
+
+    // components inside the boundary of a boundary trace
+    static int setBoundaryComponents(Config* cfg, const std::string& arg)
+    {
+        cfg->boundary_components_ = arg;
+        return 0;
+    }
+
+    // record a boundary trace
+    static int setBoundaryRecord(Config* cfg, const std::string& arg)
+    {
+        cfg->boundary_record_ = arg;
+        return 0;
+    }
+
+    // replay a boundary trace
+    static int setBoundaryReplay(Config* cfg, const std::string& arg)
+    {
+        cfg->boundary_replay_ = arg;
+        return 0;
+    }
+
+    // rank sync algorithm
+    static int setRankSync(Config* cfg, const std::string& arg)
+    {
+        if ( arg != "skip" && arg != "nullmessage" && arg != "optimistic" && arg != "overlap" && arg != "pairwise" &&
+             arg != "persistent" && arg != "shmem" && arg != "rma" ) {
+            fprintf(
+                stderr,
+                "Unknown rank sync '%s', valid values are skip, nullmessage, optimistic, overlap, pairwise, "
+                "persistent, shmem and rma\n",
+                arg.c_str());
+            return -1;
+        }
+        cfg->rank_sync_ = arg;
+        return 0;
+    }
+
+    // barrier used between the threads of a rank
+    static int setThreadBarrier(Config* cfg, const std::string& arg)
+    {
+        if ( arg != "central" && arg != "tree" ) {
+            fprintf(stderr, "Unknown thread barrier '%s', valid values are central and tree\n", arg.c_str());
+            return -1;
+        }
+        cfg->thread_barrier_ = arg;
+        return 0;
+    }
+
+    // placement of the simulation threads on cores
+    static int setThreadAffinity(Config* cfg, const std::string& arg)
+    {
+        if ( arg != "none" && arg != "compact" && arg != "scatter" ) {
+            fprintf(stderr, "Unknown thread affinity '%s', valid values are none, compact and scatter\n", arg.c_str());
+            return -1;
+        }
+        cfg->thread_affinity_ = arg;
+        return 0;
+    }
+
+    // largest speculative window of the optimistic rank sync
+    static int setOptimisticWindow(Config* cfg, const std::string& arg)
+    {
+        cfg->optimistic_window_ = arg;
+        return 0;
+    }
+
+    // only call init/complete on components with untimed data
+    static int setActiveUntimedPhases(Config* cfg, const std::string& arg)
+    {
+        if ( arg == "" ) {
+            cfg->active_untimed_phases_ = true;
+            return 0;
+        }
+
+        bool success                = false;
+        cfg->active_untimed_phases_ = cfg->parseBoolean(arg, success, "active-untimed-phases");
+        return success ? 0 : -1;
+    }
+
+    // format and write FILE output on a background thread
+    static int setDeferredFileOutput(Config* cfg, const std::string& arg)
+    {
+        if ( arg == "" ) {
+            cfg->deferred_file_output_ = true;
+            return 0;
+        }
+
+        bool success               = false;
+        cfg->deferred_file_output_ = cfg->parseBoolean(arg, success, "deferred-file-output");
+        return success ? 0 : -1;
+    }
+
+    // component construction threads
+    static int setConstructThreads(Config* cfg, const std::string& arg)
+    {
+        try {
+            unsigned long val = stoul(arg);
+            if ( val == 0 ) {
+                fprintf(stderr, "Option --construct-threads must be at least 1\n");
+                return -1;
+            }
+            cfg->construct_threads_ = val;
+            return 0;
+        }
+        catch ( std::invalid_argument& e ) {
+            fprintf(stderr, "Failed to parse '%s' as number for option --construct-threads\n", arg.c_str());
+            return -1;
+        }
+    }
+
 #ifdef USE_MEMPOOL
     // cache align mempool allocations
     static int setCacheAlignMempools(Config* cfg, const std::string& arg)
@@ -339,6 +788,54 @@ public:
         cfg->cache_align_mempools_ = cfg->parseBoolean(arg, success, "cache-align-mempools");
         return success ? 0 : -1;
     }
+
+    // return remotely freed mempool items to the allocating thread
+    static int setMempoolThreadReturn(Config* cfg, const std::string& arg)
+    {
+        if ( arg == "" ) {
+            cfg->mempool_thread_return_ = true;
+            return 0;
+        }
+        bool success                = false;
+        cfg->mempool_thread_return_ = cfg->parseBoolean(arg, success, "mempool-thread-return");
+        return success ? 0 : -1;
+    }
+
+    // back mempool arenas with huge pages
+    static int setMempoolHugePages(Config* cfg, const std::string& arg)
+    {
+        if ( arg == "" ) {
+            cfg->mempool_huge_pages_ = true;
+            return 0;
+        }
+        bool success             = false;
+        cfg->mempool_huge_pages_ = cfg->parseBoolean(arg, success, "mempool-huge-pages");
+        return success ? 0 : -1;
+    }
+
+    // place mempool arenas on the local NUMA node
+    static int setMempoolNumaLocal(Config* cfg, const std::string& arg)
+    {
+        if ( arg == "" ) {
+            cfg->mempool_numa_local_ = true;
+            return 0;
+        }
+        bool success             = false;
+        cfg->mempool_numa_local_ = cfg->parseBoolean(arg, success, "mempool-numa-local");
+        return success ? 0 : -1;
+    }
+
+    // release free mempool arenas after setup
+    static int setMempoolTrim(Config* cfg, const std::string& arg)
+    {
+        if ( arg == "" ) {
+            cfg->mempool_trim_ = true;
+            return 0;
+        }
+        bool success       = false;
+        cfg->mempool_trim_ = cfg->parseBoolean(arg, success, "mempool-trim");
+        return success ? 0 : -1;
+    }
 #endif
 
     // debug file
@@ -442,6 +939,18 @@ public:
         cfg->event_dump_file_ = arg;
         return 0;
     }
+
+    // print mempool usage by size and class
+    static int setPrintMempoolStats(Config* cfg, const std::string& arg)
+    {
+        if ( arg == "" ) {
+            cfg->print_mempool_stats_ = true;
+            return 0;
+        }
+        bool success              = false;
+        cfg->print_mempool_stats_ = cfg->parseBoolean(arg, success, "print-mempool-stats");
+        return success ? 0 : -1;
+    }
 #endif
 
     // rank sequentional startup
@@ -473,15 +982,34 @@ Config::print()
     std::cout << "num_ranks = " << num_ranks_ << std::endl;
     std::cout << "configFile = " << configFile_ << std::endl;
     std::cout << "model_options = " << model_options_ << std::endl;
+    std::cout << "model_cache = " << model_cache_ << std::endl;
+    std::cout << "model_cache_key = " << model_cache_key_ << std::endl;
     std::cout << "print_timing = " << print_timing_ << std::endl;
+    std::cout << "print_imbalance = " << print_imbalance_ << std::endl;
+    std::cout << "print_memory = " << print_memory_ << std::endl;
+    std::cout << "timing_json = " << timing_json_ << std::endl;
     std::cout << "stop_at = " << stop_at_ << std::endl;
     std::cout << "exit_after = " << exit_after_ << std::endl;
+    std::cout << "fast_exit = " << fast_exit_ << std::endl;
+    std::cout << "release_build_memory = " << release_build_memory_ << std::endl;
     std::cout << "partitioner = " << partitioner_ << std::endl;
+    std::cout << "partition_weights = " << partition_weights_ << std::endl;
+    std::cout << "partition_cache = " << partition_cache_ << std::endl;
+    std::cout << "partition_report = " << partition_report_ << std::endl;
+    std::cout << "partition_only = " << partition_only_ << std::endl;
     std::cout << "heartbeatPeriod = " << heartbeatPeriod_ << std::endl;
+    std::cout << "checkpoint_period = " << checkpoint_period_ << std::endl;
+    std::cout << "checkpoint_prefix = " << checkpoint_prefix_ << std::endl;
+    std::cout << "load_checkpoint = " << load_checkpoint_ << std::endl;
+    std::cout << "checkpoint_async = " << checkpoint_async_ << std::endl;
+    std::cout << "checkpoint_incremental = " << checkpoint_incremental_ << std::endl;
+    std::cout << "metrics_file = " << metrics_file_ << std::endl;
+    std::cout << "metrics_period = " << metrics_period_ << std::endl;
     std::cout << "output_directory = " << output_directory_ << std::endl;
     std::cout << "output_core_prefix = " << output_core_prefix_ << std::endl;
     std::cout << "output_config_graph = " << output_config_graph_ << std::endl;
     std::cout << "output_json = " << output_json_ << std::endl;
+    std::cout << "output_binary = " << output_binary_ << std::endl;
     std::cout << "parallel_output = " << parallel_output_ << std::endl;
     std::cout << "output_dot = " << output_dot_ << std::endl;
     std::cout << "dot_verbosity = " << dot_verbosity_ << std::endl;
@@ -489,10 +1017,36 @@ Config::print()
     std::cout << "output_partition = " << output_partition_ << std::endl;
     std::cout << "timeBase = " << timeBase_ << std::endl;
     std::cout << "parallel_load = " << parallel_load_ << std::endl;
+    std::cout << "parallel_load_mode_replicate = " << parallel_load_mode_replicate_ << std::endl;
+    std::cout << "parallel_load_mode_node = " << parallel_load_mode_node_ << std::endl;
     std::cout << "timeVortex = " << timeVortex_ << std::endl;
+    std::cout << "timeVortexParams = " << timeVortexParams_ << std::endl;
     std::cout << "interthread_links = " << interthread_links_ << std::endl;
+    std::cout << "interthread_lookahead = " << interthread_lookahead_ << std::endl;
+    std::cout << "direct_delivery = " << direct_delivery_ << std::endl;
+    std::cout << "tight_clock_loop = " << tight_clock_loop_ << std::endl;
+    std::cout << "sync_compress_threshold = " << sync_compress_threshold_ << std::endl;
+    std::cout << "sync_nonblocking_reduce = " << sync_nonblocking_reduce_ << std::endl;
+    std::cout << "sync_sparse_untimed = " << sync_sparse_untimed_ << std::endl;
+    std::cout << "deferred_exit_check = " << deferred_exit_check_ << std::endl;
+    std::cout << "ensemble_jobs = " << ensemble_jobs_ << std::endl;
+    std::cout << "ensemble_fork = " << ensemble_fork_ << std::endl;
+    std::cout << "boundary_components = " << boundary_components_ << std::endl;
+    std::cout << "boundary_record = " << boundary_record_ << std::endl;
+    std::cout << "boundary_replay = " << boundary_replay_ << std::endl;
+    std::cout << "rank_sync = " << rank_sync_ << std::endl;
+    std::cout << "optimistic_window = " << optimistic_window_ << std::endl;
+    std::cout << "thread_barrier = " << thread_barrier_ << std::endl;
+    std::cout << "thread_affinity = " << thread_affinity_ << std::endl;
+    std::cout << "construct_threads = " << construct_threads_ << std::endl;
+    std::cout << "active_untimed_phases = " << active_untimed_phases_ << std::endl;
+    std::cout << "deferred_file_output = " << deferred_file_output_ << std::endl;
 #ifdef USE_MEMPOOL
     std::cout << "cache_align_mempools = " << cache_align_mempools_ << std::endl;
+    std::cout << "mempool_thread_return = " << mempool_thread_return_ << std::endl;
+    std::cout << "mempool_huge_pages = " << mempool_huge_pages_ << std::endl;
+    std::cout << "mempool_numa_local = " << mempool_numa_local_ << std::endl;
+    std::cout << "mempool_trim = " << mempool_trim_ << std::endl;
 #endif
     std::cout << "debugFile = " << debugFile_ << std::endl;
     std::cout << "libpath = " << libpath_ << std::endl;
@@ -517,6 +1071,7 @@ Config::print()
 
 #ifdef USE_MEMPOOL
     std::cout << "event_dump_file = " << event_dump_file_ << std::endl;
+    std::cout << "print_mempool_stats = " << print_mempool_stats_ << std::endl;
 #endif
     std::cout << "rank_seq_startup_ " << rank_seq_startup_ << std::endl;
     std::cout << "print_env" << print_env_ << std::endl;
@@ -535,15 +1090,34 @@ Config::Config(uint32_t num_ranks, bool first_rank) : ConfigShared(!first_rank,
     // Basic Options
     first_rank_ = first_rank;
 
-    num_ranks_       = num_ranks;
-    num_threads_     = 1;
-    configFile_      = "NONE";
-    model_options_   = "";
-    print_timing_    = false;
-    stop_at_         = "0 ns";
-    exit_after_      = 0;
-    partitioner_     = "sst.linear";
-    heartbeatPeriod_ = "";
+    num_ranks_         = num_ranks;
+    num_threads_       = 1;
+    configFile_        = "NONE";
+    model_options_     = "";
+    model_cache_       = "";
+    model_cache_key_   = "";
+    print_timing_      = false;
+    print_imbalance_   = false;
+    print_memory_      = false;
+    timing_json_       = "";
+    stop_at_           = "0 ns";
+    exit_after_        = 0;
+    fast_exit_         = false;
+    partitioner_       = "sst.linear";
+    partition_weights_ = "";
+    partition_cache_   = "";
+    partition_report_  = false;
+    partition_only_    = false;
+    heartbeatPeriod_   = "";
+    checkpoint_period_ = "";
+    checkpoint_prefix_ = "checkpoint";
+    load_checkpoint_   = "";
+
+    checkpoint_async_       = false;
+    checkpoint_incremental_ = false;
+    release_build_memory_   = false;
+    metrics_file_           = "";
+    metrics_period_         = 1.0;
 
     char* wd_buf = (char*)malloc(sizeof(char) * PATH_MAX);
     getcwd(wd_buf, PATH_MAX);
@@ -560,6 +1134,7 @@ Config::Config(uint32_t num_ranks, bool first_rank) : ConfigShared(!first_rank,
 
     output_config_graph_ = "";
     output_json_         = "";
+    output_binary_       = "";
     parallel_output_     = false;
 
     // Graph output
@@ -569,13 +1144,39 @@ Config::Config(uint32_t num_ranks, bool first_rank) : ConfigShared(!first_rank,
     output_partition_         = false;
 
     // Advance Options
-    timeBase_                 = "1 ps";
-    parallel_load_            = false;
-    parallel_load_mode_multi_ = true;
-    timeVortex_               = "sst.timevortex.priority_queue";
-    interthread_links_        = false;
+    timeBase_                     = "1 ps";
+    parallel_load_                = false;
+    parallel_load_mode_multi_     = true;
+    parallel_load_mode_replicate_ = false;
+    parallel_load_mode_node_      = false;
+    timeVortex_                   = "sst.timevortex.priority_queue";
+    timeVortexParams_             = "";
+    interthread_links_            = false;
+    interthread_lookahead_        = false;
+    direct_delivery_              = false;
+    tight_clock_loop_             = false;
+    sync_compress_threshold_      = 0;
+    sync_nonblocking_reduce_      = false;
+    sync_sparse_untimed_          = false;
+    deferred_exit_check_          = false;
+    ensemble_jobs_                = 0;
+    ensemble_fork_                = "graph";
+    boundary_components_          = "";
+    boundary_record_              = "";
+    boundary_replay_              = "";
+    rank_sync_                    = "skip";
+    optimistic_window_            = "";
+    thread_barrier_               = "central";
+    thread_affinity_              = "none";
+    construct_threads_            = 1;
+    active_untimed_phases_        = false;
+    deferred_file_output_         = false;
 #ifdef USE_MEMPOOL
-    cache_align_mempools_ = false;
+    cache_align_mempools_  = false;
+    mempool_thread_return_ = false;
+    mempool_huge_pages_    = false;
+    mempool_numa_local_    = false;
+    mempool_trim_          = false;
 #endif
     debugFile_ = "/dev/null";
 
@@ -586,7 +1187,8 @@ Config::Config(uint32_t num_ranks, bool first_rank) : ConfigShared(!first_rank,
     // Advanced Options - Debug
     runMode_ = SimulationRunMode::BOTH;
 #ifdef USE_MEMPOOL
-    event_dump_file_ = "";
+    event_dump_file_     = "";
+    print_mempool_stats_ = false;
 #endif
     rank_seq_startup_ = false;
 
@@ -654,9 +1256,37 @@ Config::insertOptions()
         "will be "
         "appended to the model options (or used as the model options if --model-options was not specified).",
         std::bind(&ConfigHelper::setModelOptions, this, _1), false);
+    DEF_ARG(
+        "model-cache", 0, "DIR",
+        "[EXPERIMENTAL] Cache graphs built by Python models in DIR.  A model whose script, imported modules and model "
+        "options haven't changed is loaded from the cache instead of being run.  Graphs built with sst.cacheGraph() "
+        "are reused whenever the build function and its inputs haven't changed, and the rest of the script is run "
+        "over them.  Other inputs of the model, such as data files it reads or environment variables, are not "
+        "tracked, so use --model-cache-key when they change.",
+        std::bind(&ConfigHelper::setModelCache, this, _1), false);
+    DEF_ARG(
+        "model-cache-key", 0, "STRING",
+        "[EXPERIMENTAL] Add STRING to the keys of the model cache, so entries are only reused by runs given the same "
+        "STRING.  Use it for inputs of the model that --model-cache can't see, e.g. a checksum of its data files.",
+        std::bind(&ConfigHelper::setModelCacheKey, this, _1), false);
     DEF_FLAG_OPTVAL(
         "print-timing-info", 0, "Print SST timing information", std::bind(&ConfigHelper::setPrintTiming, this, _1),
         true);
+    DEF_FLAG_OPTVAL(
+        "print-imbalance-info", 0,
+        "Print the events executed, busy time, sync time and end of run wait of each rank and thread, along with an "
+        "estimate of the critical path of the run loop",
+        std::bind(&ConfigHelper::setPrintImbalance, this, _1), true);
+    DEF_FLAG_OPTVAL(
+        "print-memory-info", 0,
+        "Print the approximate peak memory use of the ConfigGraph, Params, links, TimeVortex, mempools, statistics, "
+        "SharedObjects and sync buffers in each phase of the run, for the largest and smallest rank",
+        std::bind(&ConfigHelper::setPrintMemory, this, _1), true);
+    DEF_ARG(
+        "timing-info-json", 0, "FILE",
+        "Write the time spent in each phase of the run by each rank, with the min, max and average across ranks, to "
+        "FILE as JSON",
+        std::bind(&ConfigHelper::setTimingJson, this, _1), true);
     DEF_ARG(
         "stop-at", 0, "TIME", "Set time at which simulation will end execution",
         std::bind(&ConfigHelper::setStopAt, this, _1), true);
@@ -667,14 +1297,86 @@ Config::insertOptions()
         "appropriate numbers for that value, lower case letters represent the units and are required for those "
         "formats).",
         std::bind(&ConfigHelper::setExitAfter, this, _1), true);
+    DEF_FLAG_OPTVAL(
+        "fast-exit", 0,
+        "[EXPERIMENTAL] Exit without destroying the components, links, statistics and events once the simulation has "
+        "finished and its output has been written.  Saves the time spent freeing memory at the end of large runs",
+        std::bind(&ConfigHelper::setFastExit, this, _1), true);
+    DEF_FLAG_OPTVAL(
+        "release-build-memory", 0,
+        "[EXPERIMENTAL] Finalize the Python interpreter once the model is built and return the memory freed by "
+        "deleting the configuration graph to the OS before the simulation runs.  Elements that use Python after the "
+        "model is built will not work with this option",
+        std::bind(&ConfigHelper::setReleaseBuildMemory, this, _1), true);
     DEF_ARG(
         "partitioner", 0, "PARTITIONER", "Select the partitioner to be used. <lib.partitionerName>",
         std::bind(&ConfigHelper::setPartitioner, this, _1), true);
+    DEF_ARG(
+        "partition-weights", 0, "FILE",
+        "[EXPERIMENTAL] Set component weights used by the partitioner from FILE.  FILE can be the output of the "
+        "component, clock handler or event handler profiling tools from a previous run (collected at component or "
+        "subcomponent level), or lines of the form \"name, weight\".  Link traffic from the event comm profiling "
+        "tool (collected at subcomponent level with track_ports) weights the links in the multilevel partitioner.",
+        std::bind(&ConfigHelper::setPartitionWeights, this, _1), true);
+    DEF_ARG(
+        "partition-cache", 0, "FILE",
+        "[EXPERIMENTAL] Reuse the partition saved in FILE if it was made for the same graph, partitioner, weights "
+        "and number of ranks and threads.  Otherwise partition as usual and save the result to FILE.",
+        std::bind(&ConfigHelper::setPartitionCache, this, _1), true);
+    DEF_FLAG_OPTVAL(
+        "partition-report", 0,
+        "[EXPERIMENTAL] Print the component count, weight and cut links of each rank and thread after partitioning, "
+        "along with the minimum latency crossing ranks and threads and an estimate of the traffic between them",
+        std::bind(&ConfigHelper::setPartitionReport, this, _1), true);
+    DEF_FLAG_OPTVAL(
+        "partition-only", 0,
+        "[EXPERIMENTAL] Stop after partitioning, without building or running the simulation.  Prints the partition "
+        "report and any requested partition or graph output",
+        std::bind(&ConfigHelper::setPartitionOnly, this, _1), true);
     DEF_ARG(
         "heartbeat-period", 0, "PERIOD",
         "Set time for heartbeats to be published (these are approximate timings, published by the core, to update on "
         "progress)",
         std::bind(&ConfigHelper::setHeartbeat, this, _1), true);
+    DEF_ARG(
+        "checkpoint-period", 0, "PERIOD",
+        "[EXPERIMENTAL] Set simulated time between checkpoints.  Every rank and thread writes its own file and all of "
+        "the components in the simulation must support checkpointing",
+        std::bind(&ConfigHelper::setCheckpointPeriod, this, _1), true);
+    DEF_ARG(
+        "checkpoint-prefix", 0, "PREFIX",
+        "[EXPERIMENTAL] Set prefix of the checkpoint files (default: checkpoint).  Files are named "
+        "PREFIX_<checkpoint>_<rank>_<thread>.sstcpt",
+        std::bind(&ConfigHelper::setCheckpointPrefix, this, _1), true);
+    DEF_ARG(
+        "load-checkpoint", 0, "CHECKPOINT",
+        "[EXPERIMENTAL] Restart the simulation from checkpoint CHECKPOINT, given as PREFIX_<checkpoint>.  The input "
+        "file is still used to build the components, so it must be the same as for the run that wrote the "
+        "checkpoint.  The number of ranks and threads can be different, in which case the components are "
+        "partitioned again and their state and events are read from the files they were written to",
+        std::bind(&ConfigHelper::setLoadCheckpoint, this, _1), true);
+    DEF_FLAG_OPTVAL(
+        "checkpoint-async", 0,
+        "[EXPERIMENTAL] Set whether checkpoints are written to file on a background thread while the simulation "
+        "continues.  The state is still captured at the checkpoint, and a checkpoint waits for the previous one to "
+        "finish writing",
+        std::bind(&ConfigHelper::setCheckpointAsync, this, _1), true);
+    DEF_FLAG_OPTVAL(
+        "checkpoint-incremental", 0,
+        "[EXPERIMENTAL] Set whether checkpoints only save the components whose state changed since the previous "
+        "checkpoint.  Restarting from an incremental checkpoint also reads the earlier checkpoints it refers to",
+        std::bind(&ConfigHelper::setCheckpointIncremental, this, _1), true);
+    DEF_ARG(
+        "metrics-file", 0, "FILE",
+        "Write performance metrics of the running simulation to FILE as one JSON object per line: event rate, "
+        "TimeVortex depth, time spent in syncs, mempool usage and simulated time per wall-clock second.  Each thread "
+        "writes a line every --metrics-period seconds of wall-clock time.  With more than one rank, the rank is added "
+        "to the file name",
+        std::bind(&ConfigHelper::setMetricsFile, this, _1), true);
+    DEF_ARG(
+        "metrics-period", 0, "SECONDS",
+        "Set the wall-clock time in seconds between lines written to the --metrics-file (default: 1)",
+        std::bind(&ConfigHelper::setMetricsPeriod, this, _1), true);
     DEF_ARG(
         "output-directory", 0, "DIR", "Directory into which all SST output files should reside",
         std::bind(&ConfigHelper::setOutputDir, this, _1), true);
@@ -686,24 +1388,32 @@ Config::insertOptions()
     DEF_SECTION_HEADING(
         "Configuration Output Options (generates a file that can be used as input for reproducing a run)");
     DEF_ARG(
-        "output-config", 0, "FILE", "File to write SST configuration (in Python format)",
+        "output-config", 0, "FILE",
+        "File to write SST configuration (in Python format).  Written compressed if FILE ends in .gz",
         std::bind(&ConfigHelper::setWriteConfig, this, _1), true);
     DEF_ARG(
-        "output-json", 0, "FILE", "File to write SST configuration graph (in JSON format)",
+        "output-json", 0, "FILE",
+        "File to write SST configuration graph (in JSON format).  Written compressed if FILE ends in .gz",
         std::bind(&ConfigHelper::setWriteJSON, this, _1), true);
+    DEF_ARG(
+        "output-binary", 0, "FILE",
+        "[EXPERIMENTAL] File to write a binary snapshot of the SST configuration graph.  The snapshot can be loaded "
+        "directly as the input file (must use a .sstgraph extension)",
+        std::bind(&ConfigHelper::setWriteBinary, this, _1), true);
 #ifdef SST_CONFIG_HAVE_MPI
     DEF_FLAG_OPTVAL(
         "parallel-output", 0,
         "Enable parallel output of configuration information.  This option is ignored for single rank jobs.  Must also "
-        "specify an output type (--output-config "
-        "and/or --output-json).  Note: this will also cause partition info to be output if set to true.",
+        "specify an output type (--output-config, "
+        "--output-json and/or --output-binary).  Note: this will also cause partition info to be output if set to true.",
         std::bind(&ConfigHelper::enableParallelOutput, this, _1), true);
 #endif
 
     /* Configuration Output */
     DEF_SECTION_HEADING("Graph Output Options (for outputting graph information for visualization or inspection)");
     DEF_ARG(
-        "output-dot", 0, "FILE", "File to write SST configuration graph (in GraphViz format)",
+        "output-dot", 0, "FILE",
+        "File to write SST configuration graph (in GraphViz format).  Written compressed if FILE ends in .gz",
         std::bind(&ConfigHelper::setWriteDot, this, _1), true);
     DEF_ARG(
         "dot-verbosity", 0, "INT", "Amount of detail to include in the dot graph output",
@@ -723,22 +1433,169 @@ Config::insertOptions()
     DEF_ARG_OPTVAL(
         "parallel-load", 0, "MODE",
         "Enable parallel loading of configuration. This option is ignored for single rank jobs.  Optional mode "
-        "parameters are NONE, SINGLE and MULTI (default).  If NONE is specified, parallel-load is turned off. If "
-        "SINGLE is specified, the same file will be passed to all MPI "
-        "ranks.  If MULTI is specified, each MPI rank is required to have it's own file to load. Note, not all input "
-        "formats support both types of file loading.",
+        "parameters are NONE, SINGLE, MULTI (default), REPLICATE and NODE.  If NONE is specified, parallel-load is "
+        "turned off. If SINGLE is specified, the same file will be passed to all MPI "
+        "ranks.  If MULTI is specified, each MPI rank is required to have it's own file to load.  If REPLICATE is "
+        "specified, every rank builds the full graph from the same file and runs the partitioner, then keeps only its "
+        "own part, so the graph is not distributed from rank 0.  The input file and partitioner must give the same "
+        "result on every rank.  NODE is the same as REPLICATE, except that only the lowest rank on each node builds "
+        "and partitions the graph, and hands the other ranks on the node their parts through shared memory. Note, "
+        "not all input formats support all types of file loading.",
         std::bind(&ConfigHelper::enableParallelLoadMode, this, _1), false);
 #endif
     DEF_ARG(
         "timeVortex", 0, "MODULE", "Select TimeVortex implementation <lib.timevortex>",
         std::bind(&ConfigHelper::setTimeVortex, this, _1), true);
+    DEF_ARG(
+        "timeVortex-params", 0, "KEY=VALUE[,KEY=VALUE...]",
+        "[EXPERIMENTAL] Parameters passed to the TimeVortex, e.g. horizon=10us for sst.timevortex.spill",
+        std::bind(&ConfigHelper::setTimeVortexParams, this, _1), true);
     DEF_FLAG_OPTVAL(
         "interthread-links", 0, "[EXPERIMENTAL] Set whether or not interthread links should be used",
         std::bind(&ConfigHelper::setInterThreadLinks, this, _1), true);
+    DEF_FLAG_OPTVAL(
+        "interthread-lookahead", 0,
+        "[EXPERIMENTAL] Set whether thread syncs are scheduled from the next activity time and cross-thread link "
+        "latency of each thread, which lets quiet periods on low latency links be skipped",
+        std::bind(&ConfigHelper::setInterThreadLookahead, this, _1), true);
+    DEF_FLAG_OPTVAL(
+        "direct-delivery", 0,
+        "[EXPERIMENTAL] Set whether events sent on zero latency links within a thread for the current time are "
+        "delivered from a FIFO instead of being inserted into the TimeVortex",
+        std::bind(&ConfigHelper::setDirectDelivery, this, _1), true);
+    DEF_FLAG_OPTVAL(
+        "tight-clock-loop", 0,
+        "[EXPERIMENTAL] Set whether a clock runs its next cycle right away, without going through the TimeVortex, "
+        "when nothing else is due before it.  Only used with one thread per rank",
+        std::bind(&ConfigHelper::setTightClockLoop, this, _1), true);
+    DEF_ARG(
+        "sync-compress-threshold", 0, "BYTES",
+        "[EXPERIMENTAL] Compress the data exchanged between ranks when the buffer sent to a rank is at least BYTES "
+        "bytes (0 disables compression).  Requires SST to be built with zlib",
+        std::bind(&ConfigHelper::setSyncCompressThreshold, this, _1), true);
+    DEF_FLAG_OPTVAL(
+        "sync-nonblocking-reduce", 0,
+        "[EXPERIMENTAL] Set whether the skip, persistent, shmem and rma rank syncs start the reduction of the next sync time "
+        "before exchanging events, so that it completes while the events are received and delivered.  The local "
+        "input also covers the events being sent, so the next sync time is the same as without this option",
+        std::bind(&ConfigHelper::setSyncNonblockingReduce, this, _1), true);
+    DEF_FLAG_OPTVAL(
+        "sync-sparse-untimed", 0,
+        "[EXPERIMENTAL] Set whether the skip rank syncs only send untimed data during init and complete to the ranks "
+        "they have data for, and end each round with a nonblocking consensus instead of receiving from every "
+        "neighbor and summing the message counts separately",
+        std::bind(&ConfigHelper::setSyncSparseUntimed, this, _1), true);
+    DEF_FLAG_OPTVAL(
+        "deferred-exit-check", 0,
+        "[EXPERIMENTAL] Set whether the check that all primary components are done, which is a reduction over all "
+        "ranks at each global rank sync, only waits on the ranks whose components are all done.  Ranks that still "
+        "have work start their part of the check and complete it at the next global sync.  The simulation ends at "
+        "the same sync and time as without it",
+        std::bind(&ConfigHelper::setDeferredExitCheck, this, _1), true);
+    DEF_ARG(
+        "ensemble-jobs", 0, "NUM",
+        "[EXPERIMENTAL] Number of runs of an ensemble, added by the model with sst.addEnsembleVariant(), done at once "
+        "(default: the number of cores divided by the number of threads).  The graph is built and partitioned once, "
+        "then each run is a child process that sets the params of its variant in the global param sets",
+        std::bind(&ConfigHelper::setEnsembleJobs, this, _1), true);
+    DEF_ARG(
+        "ensemble-fork", 0, "POINT",
+        "[EXPERIMENTAL] When to fork the runs of an ensemble (default: graph).  graph: once the graph is partitioned, "
+        "so each run builds its own components with the params of its variant.  setup: after init and setup, so the "
+        "init phase is only run once.  Only params read after setup see the variant, and only a single thread is "
+        "supported",
+        std::bind(&ConfigHelper::setEnsembleFork, this, _1), true);
+    DEF_ARG(
+        "boundary-components", 0, "NAME[,NAME...]",
+        "[EXPERIMENTAL] Components inside the boundary for --boundary-record and --boundary-replay.  Names can use "
+        "shell wildcards",
+        std::bind(&ConfigHelper::setBoundaryComponents, this, _1), true);
+    DEF_ARG(
+        "boundary-record", 0, "FILE",
+        "[EXPERIMENTAL] Record the events sent into the boundary components from outside them to FILE.  Requires a "
+        "single rank and thread, and serializable events",
+        std::bind(&ConfigHelper::setBoundaryRecord, this, _1), true);
+    DEF_ARG(
+        "boundary-replay", 0, "FILE",
+        "[EXPERIMENTAL] Only build the boundary components, and send them the events recorded in FILE by "
+        "--boundary-record in place of the rest of the graph.  Requires the same graph it was recorded with",
+        std::bind(&ConfigHelper::setBoundaryReplay, this, _1), true);
+    DEF_ARG(
+        "rank-sync", 0, "MODE",
+        "[EXPERIMENTAL] Select how ranks synchronize (default: skip).  skip: every sync is global and waits for the "
+        "earliest next event on any rank.  nullmessage: each rank only exchanges events and time guarantees with the "
+        "ranks it has links to, based on the latency of those links, so ranks can run at different simulated times.  "
+        "optimistic: ranks run speculative windows longer than the partition latency and all roll back to the start "
+        "of the window if an event arrives in the past of any rank.  Components must implement serialize_order.  "
+        "overlap: syncs every half partition latency and exchanges the data on a separate thread while the "
+        "simulation keeps running.  Needs MPI_THREAD_MULTIPLE, so it has to be given on the command line, and does "
+        "not support checkpoints.  pairwise: each "
+        "pair of ranks exchanges events every smallest latency of the links between them, and all ranks only meet "
+        "every largest such latency.  Does not support checkpoints.  persistent: same as skip, but the receives are "
+        "persistent MPI requests posted ahead of each sync, into buffers sized from the recent message sizes so that "
+        "large messages rarely need a second round.  shmem: same as skip, but the events sent to ranks on the same "
+        "node are serialized into shared memory the other rank reads directly, and MPI only carries a short notice.  "
+        "rma: same as skip, but the data is written with one-sided puts into an MPI window and each rank polls a "
+        "per-sync flag instead of matching messages.  "
+        "nullmessage and optimistic need one thread per rank and do not support checkpoints",
+        std::bind(&ConfigHelper::setRankSync, this, _1), true);
+    DEF_ARG(
+        "optimistic-window", 0, "TIME",
+        "[EXPERIMENTAL] Largest speculative window of --rank-sync=optimistic (default: 16 times the minimum "
+        "partition latency)",
+        std::bind(&ConfigHelper::setOptimisticWindow, this, _1), true);
+    DEF_ARG(
+        "thread-barrier", 0, "MODE",
+        "[EXPERIMENTAL] Select the barrier used between the threads of a rank (default: central).  central: all "
+        "threads count down one shared counter.  tree: threads meet in small groups and the last of each group "
+        "moves up a tree, which scales better to many threads",
+        std::bind(&ConfigHelper::setThreadBarrier, this, _1), true);
+    DEF_ARG(
+        "thread-affinity", 0, "POLICY",
+        "[EXPERIMENTAL] Pin each simulation thread to a core (default: none).  compact: consecutive threads on "
+        "consecutive cores of a socket.  scatter: consecutive threads on different sockets.  Threads are placed on "
+        "the cores the process is allowed to run on.  Only supported on Linux",
+        std::bind(&ConfigHelper::setThreadAffinity, this, _1), true);
+    DEF_ARG(
+        "construct-threads", 0, "INT",
+        "[EXPERIMENTAL] Number of threads each simulation thread uses to construct its components.  Only helps "
+        "models with expensive component constructors.  Components are not constructed in a fixed order, so "
+        "clock handlers registered in constructors may be called in a different order.  Components are always "
+        "constructed by one thread when SST is built with memory pools",
+        std::bind(&ConfigHelper::setConstructThreads, this, _1), true);
+    DEF_FLAG_OPTVAL(
+        "active-untimed-phases", 0,
+        "[EXPERIMENTAL] Set whether init and complete phases after phase 0 only call the components that have "
+        "untimed data waiting or that asked to be called again, instead of every component",
+        std::bind(&ConfigHelper::setActiveUntimedPhases, this, _1), true);
+    DEF_FLAG_OPTVAL(
+        "deferred-file-output", 0,
+        "[EXPERIMENTAL] Set whether Output objects writing to a file only save the format and arguments of each "
+        "call, and a background thread formats and writes them",
+        std::bind(&ConfigHelper::setDeferredFileOutput, this, _1), true);
 #ifdef USE_MEMPOOL
     DEF_FLAG_OPTVAL(
         "cache-align-mempools", 0, "[EXPERIMENTAL] Set whether mempool allocations are cache aligned",
         std::bind(&ConfigHelper::setCacheAlignMempools, this, _1), true);
+    DEF_FLAG_OPTVAL(
+        "mempool-thread-return", 0,
+        "[EXPERIMENTAL] Set whether mempool items deleted on a different thread than they were allocated on are "
+        "returned to the allocating thread through a lock free queue",
+        std::bind(&ConfigHelper::setMempoolThreadReturn, this, _1), true);
+    DEF_FLAG_OPTVAL(
+        "mempool-huge-pages", 0,
+        "[EXPERIMENTAL] Set whether mempool arenas are backed by huge pages.  Explicit huge pages are used if the "
+        "system has them reserved, otherwise transparent huge pages are requested",
+        std::bind(&ConfigHelper::setMempoolHugePages, this, _1), true);
+    DEF_FLAG_OPTVAL(
+        "mempool-numa-local", 0,
+        "[EXPERIMENTAL] Set whether mempool arenas are placed on the NUMA node of the thread that allocates them",
+        std::bind(&ConfigHelper::setMempoolNumaLocal, this, _1), true);
+    DEF_FLAG_OPTVAL(
+        "mempool-trim", 0,
+        "[EXPERIMENTAL] Set whether mempool arenas that are completely free after setup, such as those left by events "
+        "used only during init, are released back to the operating system",
+        std::bind(&ConfigHelper::setMempoolTrim, this, _1), true);
 #endif
     DEF_ARG(
         "debug-file", 0, "FILE", "File where debug output will go", std::bind(&ConfigHelper::setDebugFile, this, _1),
@@ -767,6 +1624,11 @@ Config::insertOptions()
         "file to write information about all undeleted events at the end of simulation (STDOUT and STDERR can be used "
         "to output to console)",
         std::bind(&ConfigHelper::setWriteUndeleted, this, _1), true);
+    DEF_FLAG_OPTVAL(
+        "print-mempool-stats", 0,
+        "Print mempool usage broken down by pool size and by class at each heartbeat and at the end of simulation.  "
+        "The breakdown by class is only done at heartbeats when running one thread per rank",
+        std::bind(&ConfigHelper::setPrintMempoolStats, this, _1), true);
 #endif
     DEF_FLAG(
         "force-rank-seq-startup", 0,
@@ -840,7 +1702,27 @@ Config::checkArgsAfterParsing()
 
     if ( output_json_.size() > 0 && isFileNameOnly(output_json_) ) { output_json_.insert(0, output_directory_); }
 
+    if ( output_binary_.size() > 0 && isFileNameOnly(output_binary_) ) {
+        output_binary_.insert(0, output_directory_);
+    }
+
     if ( debugFile_.size() > 0 && isFileNameOnly(debugFile_) ) { debugFile_.insert(0, output_directory_); }
+
+    if ( isFileNameOnly(checkpoint_prefix_) ) { checkpoint_prefix_.insert(0, output_directory_); }
+
+    if ( load_checkpoint_.size() > 0 && isFileNameOnly(load_checkpoint_) ) {
+        load_checkpoint_.insert(0, output_directory_);
+    }
+
+    // Restarting from a checkpoint only runs the simulation, the init
+    // and setup phases ran before the checkpoint was written
+    if ( load_checkpoint_.size() > 0 ) {
+        if ( runMode_ == SimulationRunMode::INIT ) {
+            fprintf(stderr, "ERROR: --load-checkpoint cannot be used with --run-mode=init\n");
+            return -1;
+        }
+        runMode_ = SimulationRunMode::RUN;
+    }
     return 0;
 }
 
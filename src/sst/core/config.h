@@ -111,11 +111,40 @@ public:
     */
     const std::string& model_options() const { return model_options_; }
 
+    /**
+       Directory Python model graphs are cached in.  Empty string
+       means models are not cached.
+    */
+    const std::string& model_cache() const { return model_cache_; }
+
+    /**
+       Extra string hashed into the keys of the model cache, for inputs
+       of the model the cache can't see.
+    */
+    const std::string& model_cache_key() const { return model_cache_key_; }
+
     /**
        Print SST timing information after the run
     */
     bool print_timing() const { return print_timing_; }
 
+    /**
+       Print per rank and thread run loop balance information
+    */
+    bool print_imbalance() const { return print_imbalance_; }
+
+    /**
+       Print the approximate memory use of the core subsystems in each
+       phase after the run
+    */
+    bool print_memory() const { return print_memory_; }
+
+    /**
+       File to write the time spent in each phase of the run to, as
+       JSON.  Empty if none.
+    */
+    const std::string& timing_json() const { return timing_json_; }
+
     /**
        Simulated cycle to stop the simulation at
     */
@@ -126,16 +155,97 @@ public:
     */
     uint32_t exit_after() const { return exit_after_; }
 
+    /**
+       Controls whether SST exits without tearing down the simulation
+       once it has finished and its output has been written
+    */
+    bool fast_exit() const { return fast_exit_; }
+
+    /**
+       Controls whether the Python interpreter is finalized after the
+       model is built and memory freed by the build is returned to the
+       OS before the simulation runs
+    */
+    bool release_build_memory() const { return release_build_memory_; }
+
     /**
        Partitioner to use for parallel simualations
     */
     const std::string& partitioner() const { return partitioner_; }
 
+    /**
+       File of measured per-component costs (for example, the output
+       of a previous run's profiling tools) used to set component
+       weights before partitioning.  Empty string means weights are
+       left as set in the input file.
+    */
+    const std::string& partition_weights() const { return partition_weights_; }
+
+    /**
+       File a partition is saved to and reused from by later runs with
+       the same graph.  Empty string means partitions are not cached.
+    */
+    const std::string& partition_cache() const { return partition_cache_; }
+
+    /**
+       Controls whether a report on the quality of the partition is
+       printed after partitioning
+    */
+    bool partition_report() const { return partition_report_; }
+
+    /**
+       Controls whether SST stops after partitioning, without building
+       or running the simulation
+    */
+    bool partition_only() const { return partition_only_; }
+
     /**
        Simulation period at which to print out a "heartbeat" message
     */
     const std::string& heartbeatPeriod() const { return heartbeatPeriod_; }
 
+    /**
+       Simulation period at which to write a checkpoint.  Empty string
+       means no checkpoints are written.
+    */
+    const std::string& checkpoint_period() const { return checkpoint_period_; }
+
+    /**
+       Prefix of the checkpoint files.  Each rank and thread writes
+       <prefix>_<checkpoint>_<rank>_<thread>.sstcpt
+    */
+    const std::string& checkpoint_prefix() const { return checkpoint_prefix_; }
+
+    /**
+       Checkpoint to restart the simulation from, given as
+       <prefix>_<checkpoint>.  Empty string means the simulation is
+       not restarted from a checkpoint.
+    */
+    const std::string& load_checkpoint() const { return load_checkpoint_; }
+
+    /**
+       Controls whether checkpoints are written to file on a
+       background thread
+    */
+    bool checkpoint_async() const { return checkpoint_async_; }
+
+    /**
+       Controls whether checkpoints only hold the components whose
+       state changed since the previous checkpoint
+    */
+    bool checkpoint_incremental() const { return checkpoint_incremental_; }
+
+    /**
+       File to write the performance metrics of the running simulation
+       to.  Empty string means no metrics are written.
+    */
+    const std::string& metrics_file() const { return metrics_file_; }
+
+    /**
+       Wall-clock time in seconds between metrics lines
+    */
+    double metrics_period() const { return metrics_period_; }
+
     /**
        The directory to be used for writting output files
     */
@@ -160,6 +270,12 @@ public:
     */
     const std::string& output_json() const { return output_json_; }
 
+    /**
+       File to output a binary snapshot of the config graph to (empty
+       string means no output)
+    */
+    const std::string& output_binary() const { return output_binary_; }
+
     /**
        If true, and a config graph output option is specified, write
        each ranks graph separately
@@ -215,13 +331,31 @@ public:
     */
     bool parallel_load_mode_multi() const { return parallel_load_mode_multi_; }
 
+    /**
+       If graph construction will be done in parallel, each rank
+       builds the full graph from the same file, partitions it and
+       keeps only its own part.  This avoids distributing the graph
+       from rank 0.
+    */
+    bool parallel_load_mode_replicate() const { return parallel_load_mode_replicate_; }
+
+    /**
+       If true along with parallel_load_mode_replicate, only one rank
+       on each node builds and partitions the graph, and the other
+       ranks on the node get their parts from it through shared
+       memory.
+    */
+    bool parallel_load_mode_node() const { return parallel_load_mode_node_; }
+
     /**
        Retruns the string equivalent for parallel-load: NONE (if
-       parallel load is off), SINGLE or MULTI.
+       parallel load is off), SINGLE, MULTI, REPLICATE or NODE.
     */
     std::string parallel_load_str() const
     {
         if ( !parallel_load_ ) return "NONE";
+        if ( parallel_load_mode_node_ ) return "NODE";
+        if ( parallel_load_mode_replicate_ ) return "REPLICATE";
         if ( parallel_load_mode_multi_ ) return "MULTI";
         return "SINGLE";
     }
@@ -231,17 +365,159 @@ public:
     */
     const std::string& timeVortex() const { return timeVortex_; }
 
+    /**
+       Comma separated KEY=VALUE parameters for the TimeVortex
+    */
+    const std::string& timeVortexParams() const { return timeVortexParams_; }
+
     /**
        Use links that connect directly to ActivityQueue in receiving thread
     */
     bool interthread_links() const { return interthread_links_; }
 
+    /**
+       Compute thread synchronization intervals from the lookahead of
+       each thread's cross-thread links rather than the global minimum
+       cross-thread latency
+    */
+    bool interthread_lookahead() const { return interthread_lookahead_; }
+
+    /**
+       Deliver events sent on zero latency links within a thread from
+       a queue for the current time instead of the TimeVortex
+    */
+    bool direct_delivery() const { return direct_delivery_; }
+
+    /**
+       Run the next cycle of a clock right away when nothing else in
+       the TimeVortex is due before it
+    */
+    bool tight_clock_loop() const { return tight_clock_loop_; }
+
+    /**
+       Minimum size in bytes of a rank sync buffer before it is
+       compressed.  0 means buffers are never compressed.
+    */
+    uint32_t sync_compress_threshold() const { return sync_compress_threshold_; }
+
+    /**
+       Start the reduction of the next sync time before the event
+       exchange of a rank sync instead of after it
+    */
+    bool sync_nonblocking_reduce() const { return sync_nonblocking_reduce_; }
+
+    /**
+       Exchange untimed data only with the ranks that have some, and
+       end each round with a nonblocking consensus
+    */
+    bool sync_sparse_untimed() const { return sync_sparse_untimed_; }
+
+    /**
+       Complete the check of whether all primary components are done
+       at the next global rank sync instead of blocking on it
+    */
+    bool deferred_exit_check() const { return deferred_exit_check_; }
+
+    /**
+       Number of runs of an ensemble done at once.  0 means the number
+       of cores divided by the number of threads.
+    */
+    uint32_t ensemble_jobs() const { return ensemble_jobs_; }
+
+    /**
+       Point at which the runs of an ensemble are forked: graph (once
+       the graph is partitioned) or setup (after init and setup)
+    */
+    const std::string& ensemble_fork() const { return ensemble_fork_; }
+
+    /**
+       Names or wildcard patterns of the components inside the
+       boundary of a boundary trace
+    */
+    const std::string& boundary_components() const { return boundary_components_; }
+
+    /**
+       File to record the events crossing into the boundary
+       components to
+    */
+    const std::string& boundary_record() const { return boundary_record_; }
+
+    /**
+       File to replay the events crossing into the boundary components
+       from, in place of the components outside the boundary
+    */
+    const std::string& boundary_replay() const { return boundary_replay_; }
+
+    /**
+       Algorithm used to synchronize ranks: skip, nullmessage,
+       optimistic, overlap or pairwise
+    */
+    const std::string& rank_sync() const { return rank_sync_; }
+
+    /**
+       Largest speculative window of the optimistic rank sync.  Empty
+       means a multiple of the minimum partition latency.
+    */
+    const std::string& optimistic_window() const { return optimistic_window_; }
+
+    /**
+       Barrier used between the threads of a rank: central or tree
+    */
+    const std::string& thread_barrier() const { return thread_barrier_; }
+
+    /**
+       Placement of the simulation threads on cores: none, compact or
+       scatter
+    */
+    const std::string& thread_affinity() const { return thread_affinity_; }
+
+    /**
+       Number of threads each simulation thread uses to construct its
+       components.  1 means components are constructed serially.
+    */
+    uint32_t construct_threads() const { return construct_threads_; }
+
+    /**
+       Only call init() and complete() after phase 0 on components
+       with untimed data waiting or that asked to be called again
+    */
+    bool active_untimed_phases() const { return active_untimed_phases_; }
+
+    /**
+       Format and write the output of Output objects that write to a
+       file on a background thread
+    */
+    bool deferred_file_output() const { return deferred_file_output_; }
+
 #ifdef USE_MEMPOOL
     /**
        Controls whether mempool items are cache-aligned
 
     */
     bool cache_align_mempools() const { return cache_align_mempools_; }
+
+    /**
+       Controls whether mempool items deleted on a different thread are
+       returned to the pool of the thread that allocated them
+    */
+    bool mempool_thread_return() const { return mempool_thread_return_; }
+
+    /**
+       Controls whether mempool arenas are backed by huge pages
+    */
+    bool mempool_huge_pages() const { return mempool_huge_pages_; }
+
+    /**
+       Controls whether mempool arenas are placed on the NUMA node of
+       the thread that allocates them
+    */
+    bool mempool_numa_local() const { return mempool_numa_local_; }
+
+    /**
+       Controls whether mempool arenas that are completely free after
+       setup are released back to the operating system
+    */
+    bool mempool_trim() const { return mempool_trim_; }
 #endif
     /**
        File to which core debug information should be written
@@ -279,9 +555,9 @@ public:
     // Advanced options - Debug
 
     /**
-       Run mode to use (Init, Both, Run-only).  Note that Run-only is
-       not currently supported because there is not component level
-       checkpointing.
+       Run mode to use (Init, Both, Run-only).  Run-only skips the
+       init() and setup() phases, which is what a restart from a
+       checkpoint (see load_checkpoint()) does.
     */
     SimulationRunMode runMode() const { return runMode_; }
 
@@ -313,6 +589,13 @@ public:
     for mempools in main.cc
     */
     const std::string& event_dump_file() const { return event_dump_file_; }
+
+    /**
+       Controls whether mempool usage broken down by pool size and by
+       class is printed at each heartbeat and at the end of the
+       simulation
+    */
+    bool print_mempool_stats() const { return print_mempool_stats_; }
 #endif
 
     /**
@@ -356,16 +639,35 @@ public:
         ser& verbose_;
         ser& configFile_;
         ser& model_options_;
+        ser& model_cache_;
+        ser& model_cache_key_;
         ser& print_timing_;
+        ser& print_imbalance_;
+        ser& print_memory_;
+        ser& timing_json_;
         ser& stop_at_;
         ser& exit_after_;
+        ser& fast_exit_;
+        ser& release_build_memory_;
         ser& partitioner_;
+        ser& partition_weights_;
+        ser& partition_cache_;
+        ser& partition_report_;
+        ser& partition_only_;
         ser& heartbeatPeriod_;
+        ser& checkpoint_period_;
+        ser& checkpoint_prefix_;
+        ser& load_checkpoint_;
+        ser& checkpoint_async_;
+        ser& checkpoint_incremental_;
+        ser& metrics_file_;
+        ser& metrics_period_;
         ser& output_directory_;
         ser& output_core_prefix_;
 
         ser& output_config_graph_;
         ser& output_json_;
+        ser& output_binary_;
         ser& parallel_output_;
 
         ser& output_dot_;
@@ -376,10 +678,36 @@ public:
         ser& timeBase_;
         ser& parallel_load_;
         ser& parallel_load_mode_multi_;
+        ser& parallel_load_mode_replicate_;
+        ser& parallel_load_mode_node_;
         ser& timeVortex_;
+        ser& timeVortexParams_;
         ser& interthread_links_;
+        ser& interthread_lookahead_;
+        ser& direct_delivery_;
+        ser& tight_clock_loop_;
+        ser& sync_compress_threshold_;
+        ser& sync_nonblocking_reduce_;
+        ser& sync_sparse_untimed_;
+        ser& deferred_exit_check_;
+        ser& ensemble_jobs_;
+        ser& ensemble_fork_;
+        ser& boundary_components_;
+        ser& boundary_record_;
+        ser& boundary_replay_;
+        ser& rank_sync_;
+        ser& optimistic_window_;
+        ser& thread_barrier_;
+        ser& thread_affinity_;
+        ser& construct_threads_;
+        ser& active_untimed_phases_;
+        ser& deferred_file_output_;
 #ifdef USE_MEMPOOL
         ser& cache_align_mempools_;
+        ser& mempool_thread_return_;
+        ser& mempool_huge_pages_;
+        ser& mempool_numa_local_;
+        ser& mempool_trim_;
 #endif
         ser& debugFile_;
         ser& libpath_;
@@ -389,6 +717,7 @@ public:
         ser& runMode_;
 #ifdef USE_MEMPOOL
         ser& event_dump_file_;
+        ser& print_mempool_stats_;
 #endif
 
         ser& print_env_;
@@ -436,21 +765,40 @@ private:
     // Basic options
     // uint32_t    verbose_; ** in ConfigShared
     // Num threads held in RankInfo.thread
-    uint32_t    num_ranks_;          /*!< Number of ranks in the simulation */
-    uint32_t    num_threads_;        /*!< Number of threads requested */
-    std::string configFile_;         /*!< Graph generation file */
-    std::string model_options_;      /*!< Options to pass to Python Model generator */
-    bool        print_timing_;       /*!< Print SST timing information */
-    std::string stop_at_;            /*!< When to stop the simulation */
-    uint32_t    exit_after_;         /*!< When (wall-time) to stop the simulation */
-    std::string partitioner_;        /*!< Partitioner to use */
-    std::string heartbeatPeriod_;    /*!< Sets the heartbeat period for the simulation */
-    std::string output_directory_;   /*!< Output directory to dump all files to */
-    std::string output_core_prefix_; /*!< Set the SST::Output prefix for the core */
+    uint32_t    num_ranks_;              /*!< Number of ranks in the simulation */
+    uint32_t    num_threads_;            /*!< Number of threads requested */
+    std::string configFile_;             /*!< Graph generation file */
+    std::string model_options_;          /*!< Options to pass to Python Model generator */
+    std::string model_cache_;            /*!< Directory Python model graphs are cached in */
+    std::string model_cache_key_;        /*!< Extra string hashed into the model cache keys */
+    bool        print_timing_;           /*!< Print SST timing information */
+    bool        print_imbalance_;        /*!< Print run loop balance of ranks and threads */
+    bool        print_memory_;           /*!< Print memory use of the core subsystems */
+    std::string timing_json_;            /*!< File to write phase timing to as JSON */
+    std::string stop_at_;                /*!< When to stop the simulation */
+    uint32_t    exit_after_;             /*!< When (wall-time) to stop the simulation */
+    bool        fast_exit_;              /*!< Skip teardown at exit */
+    bool        release_build_memory_;   /*!< Free build memory before the run */
+    std::string partitioner_;            /*!< Partitioner to use */
+    std::string partition_weights_;      /*!< File of measured component weights */
+    std::string partition_cache_;        /*!< File partitions are saved to and reused from */
+    bool        partition_report_;       /*!< Print a report on the partition */
+    bool        partition_only_;         /*!< Stop after partitioning */
+    std::string heartbeatPeriod_;        /*!< Sets the heartbeat period for the simulation */
+    std::string checkpoint_period_;      /*!< Sets the checkpoint period for the simulation */
+    std::string checkpoint_prefix_;      /*!< Prefix of the checkpoint files */
+    std::string load_checkpoint_;        /*!< Checkpoint to restart the simulation from */
+    bool        checkpoint_async_;       /*!< Write checkpoints on a background thread */
+    bool        checkpoint_incremental_; /*!< Only save changed state in checkpoints */
+    std::string metrics_file_;           /*!< File to write live performance metrics to */
+    double      metrics_period_;         /*!< Wall-clock seconds between metrics lines */
+    std::string output_directory_;       /*!< Output directory to dump all files to */
+    std::string output_core_prefix_;     /*!< Set the SST::Output prefix for the core */
 
     // Configuration output
     std::string output_config_graph_; /*!< File to dump configuration graph */
     std::string output_json_;         /*!< File to dump JSON output */
+    std::string output_binary_;       /*!< File to dump binary graph snapshot */
     bool        parallel_output_;     /*!< Output simulation graph in parallel */
 
     // Graph output
@@ -460,13 +808,39 @@ private:
     bool        output_partition_;         /*!< Output paritition info when writing config output */
 
     // Advanced options
-    std::string timeBase_;                 /*!< Timebase of simulation */
-    bool        parallel_load_;            /*!< Load simulation graph in parallel */
-    bool        parallel_load_mode_multi_; /*!< If true, load using multiple files */
-    std::string timeVortex_;               /*!< TimeVortex implementation to use */
-    bool        interthread_links_;        /*!< Use interthread links */
+    std::string timeBase_;                     /*!< Timebase of simulation */
+    bool        parallel_load_;                /*!< Load simulation graph in parallel */
+    bool        parallel_load_mode_multi_;     /*!< If true, load using multiple files */
+    bool        parallel_load_mode_replicate_; /*!< If true, build the full graph on each rank */
+    bool        parallel_load_mode_node_;      /*!< If true, build the full graph once per node */
+    std::string timeVortex_;                   /*!< TimeVortex implementation to use */
+    std::string timeVortexParams_;             /*!< Parameters for the TimeVortex */
+    bool        interthread_links_;            /*!< Use interthread links */
+    bool        interthread_lookahead_;        /*!< Use per-thread lookahead for thread syncs */
+    bool        direct_delivery_;              /*!< Bypass the TimeVortex for zero latency links */
+    bool        tight_clock_loop_;             /*!< Run clock cycles back to back when nothing else is due */
+    uint32_t    sync_compress_threshold_;      /*!< Compress rank sync buffers at least this large */
+    bool        sync_nonblocking_reduce_;      /*!< Overlap the sync time reduction with the exchange */
+    bool        sync_sparse_untimed_;          /*!< Only send untimed data to ranks that have some */
+    bool        deferred_exit_check_;          /*!< Overlap the end of simulation check with a sync interval */
+    uint32_t    ensemble_jobs_;                /*!< Runs of an ensemble done at once */
+    std::string ensemble_fork_;                /*!< Point at which the runs of an ensemble are forked */
+    std::string boundary_components_;          /*!< Components inside the boundary of a boundary trace */
+    std::string boundary_record_;              /*!< File to record a boundary trace to */
+    std::string boundary_replay_;              /*!< File to replay a boundary trace from */
+    std::string rank_sync_;                    /*!< Algorithm used to synchronize ranks */
+    std::string optimistic_window_;            /*!< Largest speculative window of the optimistic rank sync */
+    std::string thread_barrier_;               /*!< Barrier used between the threads of a rank */
+    std::string thread_affinity_;              /*!< Placement of the simulation threads on cores */
+    uint32_t    construct_threads_;            /*!< Threads used to construct each thread's components */
+    bool        active_untimed_phases_;        /*!< Skip components with no untimed work after phase 0 */
+    bool        deferred_file_output_;         /*!< Format FILE output on a background thread */
 #ifdef USE_MEMPOOL
-    bool cache_align_mempools_; /*!< Cache align allocations from mempools */
+    bool cache_align_mempools_;  /*!< Cache align allocations from mempools */
+    bool mempool_thread_return_; /*!< Return remotely freed mempool items to the allocating thread */
+    bool mempool_huge_pages_;    /*!< Back mempool arenas with huge pages */
+    bool mempool_numa_local_;    /*!< Place mempool arenas on the allocating thread's NUMA node */
+    bool mempool_trim_;          /*!< Release free mempool arenas after setup */
 #endif
     std::string debugFile_; /*!< File to which debug information should be written */
     // std::string libpath_;  ** in ConfigShared
@@ -479,7 +853,8 @@ private:
     // Advanced options - debug
     SimulationRunMode runMode_; /*!< Run Mode (Init, Both, Run-only) */
 #ifdef USE_MEMPOOL
-    std::string event_dump_file_; /*!< File to dump undeleted events to  */
+    std::string event_dump_file_;     /*!< File to dump undeleted events to  */
+    bool        print_mempool_stats_; /*!< Print mempool usage by size and class */
 #endif
     bool rank_seq_startup_; /*!< Run simulation initialization phases one rank at a time */
 
@@ -23,8 +23,11 @@
 #include "sst/core/warnmacros.h"
 
 #include <algorithm>
+#include <atomic>
 #include <fstream>
 #include <string.h>
+#include <string_view>
+#include <thread>
 
 using namespace std;
 
@@ -73,6 +76,59 @@ checkForValidLinkName(const std::string& name)
 
 namespace SST {
 
+thread_local ConfigStringTable* ConfigStringTable::active = nullptr;
+
+ConfigStringTable::Scope::Scope(size_t hint) : prev(active)
+{
+    active = new ConfigStringTable();
+    if ( hint > 0 ) {
+        active->index.reserve(hint);
+        active->strings.reserve(hint);
+    }
+}
+
+ConfigStringTable::Scope::~Scope()
+{
+    delete active;
+    active = prev;
+}
+
+void
+ConfigStringTable::serialize(SST::Core::Serialization::serializer& ser, std::string& str)
+{
+    if ( active == nullptr ) {
+        ser& str;
+        return;
+    }
+
+    // An index equal to the current table size means a new string
+    // follows.  Sizing and packing each get their own table, so both
+    // passes see the same sequence of strings.
+    uint32_t idx;
+    switch ( ser.mode() ) {
+    case SST::Core::Serialization::serializer::SIZER:
+    case SST::Core::Serialization::serializer::PACK:
+    {
+        // One lookup both finds and adds the string
+        auto res = active->index.try_emplace(str, static_cast<uint32_t>(active->index.size()));
+        idx      = res.first->second;
+        ser& idx;
+        if ( res.second ) ser& str;
+        break;
+    }
+    case SST::Core::Serialization::serializer::UNPACK:
+        ser& idx;
+        if ( idx == active->strings.size() ) {
+            ser& str;
+            active->strings.push_back(str);
+        }
+        else {
+            str = active->strings[idx];
+        }
+        break;
+    }
+}
+
 void
 ConfigLink::updateLatencies(TimeLord* timeLord)
 {
@@ -143,6 +199,13 @@ ConfigStatGroup::setFrequency(const std::string& freq)
     return false;
 }
 
+bool
+ConfigStatGroup::setReduce(bool val)
+{
+    reduce = val;
+    return true;
+}
+
 std::pair<bool, std::string>
 ConfigStatGroup::verifyStatsAndComponents(const ConfigGraph* graph)
 {
@@ -623,10 +686,14 @@ ConfigComponent::clearAllLinks()
 void
 ConfigComponent::checkPorts() const
 {
-    std::map<std::string, std::string> ports;
+    // Port names point into the links, which outlive the check
+    std::unordered_map<std::string_view, const ConfigLink*> ports;
 
     auto& graph_links = graph->getLinkMap();
 
+    // Look the type up once for all its links
+    const Factory::PortIndex* port_index = Factory::getFactory()->getPortIndex(type);
+
     // Loop over all the links
     for ( unsigned int i = 0; i < links.size(); i++ ) {
         const ConfigLink* link = graph_links[links[i]];
@@ -634,7 +701,7 @@ ConfigComponent::checkPorts() const
 
             if ( link->component[j] == id ) {
                 // If port is not found, print an error
-                if ( !Factory::getFactory()->isPortNameValid(type, link->port[j]) ) {
+                if ( !port_index->isValid(link->port[j]) ) {
                     // For now this is not a fatal error
                     // found_error = true;
                     Output::getDefaultObject().fatal(
@@ -645,14 +712,15 @@ ConfigComponent::checkPorts() const
                 }
 
                 // Check for multiple links hooked to port
-                auto ret = ports.insert(std::make_pair(link->port[j], link->name));
+                auto ret = ports.emplace(link->port[j], link);
                 if ( !ret.second ) {
                     // Check to see if this is a loopback link
-                    if ( ret.first->second != link->name )
+                    if ( ret.first->second != link )
                         // Not a loopback link, fatal...
                         Output::getDefaultObject().fatal(
                             CALL_INFO, 1, "ERROR: Port %s of Component %s connected to two links: %s, %s.\n",
-                            link->port[j].c_str(), name.c_str(), link->name.c_str(), ret.first->second.c_str());
+                            link->port[j].c_str(), name.c_str(), link->name.c_str(),
+                            ret.first->second->name.c_str());
                 }
             }
         }
@@ -712,13 +780,31 @@ ConfigGraph::postCreationCleanup()
         link->updateLatencies(timeLord);
     }
 
+    // Links are ordered by name
+    std::vector<ConfigLink*> by_name(links.begin(), links.end());
+    std::sort(by_name.begin(), by_name.end(), [](const ConfigLink* a, const ConfigLink* b) { return a->name < b->name; });
     LinkId_t count = 1;
-    for ( auto& it : link_names ) {
-        ConfigLink* link = links[it.second];
-        link->order      = count;
+    for ( ConfigLink* link : by_name ) {
+        link->order = count;
         count++;
     }
 
+    // Components made from the same template share one copy of their
+    // params, which is also only sent once when the graph is
+    // distributed
+    Params::DataPool              pool;
+    std::vector<ConfigComponent*> pending(comps.begin(), comps.end());
+    while ( !pending.empty() ) {
+        ConfigComponent* comp = pending.back();
+        pending.pop_back();
+        pool.share(comp->params);
+        // So do statistics enabled on many components at once
+        for ( auto& stat : comp->statistics )
+            pool.share(stat.second.params);
+        if ( comp->enabledAllStats ) pool.share(comp->allStatConfig.params);
+        pending.insert(pending.end(), comp->subComponents.begin(), comp->subComponents.end());
+    }
+
     /* Force component / statistic registration for Group stats */
     for ( auto& cfg : getStatGroups() ) {
         for ( ComponentId_t compID : cfg.second.components ) {
@@ -735,7 +821,7 @@ ConfigGraph::postCreationCleanup()
 // Checks for errors that can't be easily detected during the build
 // process
 bool
-ConfigGraph::checkForStructuralErrors()
+ConfigGraph::checkForStructuralErrors(uint32_t num_threads)
 {
     // Check to make sure there are no dangling links.  A dangling
     // link is found by looking though the links in the graph and
@@ -763,10 +849,29 @@ ConfigGraph::checkForStructuralErrors()
     // Check to see if all the port names are valid and they are only
     // used once
 
-    // Loop over all the Components
-    for ( ConfigComponentMap_t::iterator iter = comps.begin(); iter != comps.end(); ++iter ) {
-        ConfigComponent* ccomp = *iter;
-        ccomp->checkPorts();
+    // Each component only reads the links, so the components can be
+    // checked in any order
+    std::atomic<size_t> next_comp(0);
+    auto                check = [&]() {
+        size_t i;
+        while ( (i = next_comp++) < comps.size() ) {
+            comps.data[i]->checkPorts();
+        }
+    };
+
+    uint32_t num_workers = std::min<size_t>(num_threads, comps.size());
+    if ( num_workers > 1 ) {
+        std::vector<std::thread> workers;
+        for ( uint32_t i = 1; i < num_workers; ++i ) {
+            workers.emplace_back(check);
+        }
+        check();
+        for ( auto& t : workers ) {
+            t.join();
+        }
+    }
+    else {
+        check();
     }
 
     return found_error;
@@ -779,7 +884,7 @@ ConfigGraph::addComponent(const std::string& name, const std::string& type)
     ComponentId_t cid = nextComponentId++;
     comps.insert(new ConfigComponent(cid, this, name, type, 1.0f, RankInfo()));
 
-    auto ret = compsByName.insert(std::make_pair(name, cid));
+    auto ret = compsByName.insert(std::make_pair(names.intern(name), cid));
     // Check to see if the name has already been used
     if ( !ret.second ) {
         output.fatal(CALL_INFO, 1, "ERROR: trying to add Component with name that already exists: %s\n", name.c_str());
@@ -793,6 +898,16 @@ ConfigGraph::addGlobalParam(const std::string& global_set, const std::string& ke
     Params::insert_global(global_set, key, value);
 }
 
+void
+ConfigGraph::applyEnsembleVariant(const EnsembleVariant& variant)
+{
+    for ( auto& set : variant ) {
+        for ( auto& param : set.second ) {
+            Params::insert_global(set.first, param.first, param.second);
+        }
+    }
+}
+
 void
 ConfigGraph::setStatisticOutput(const std::string& name)
 {
@@ -829,11 +944,10 @@ ConfigGraph::addLink(
     // the link_name to id mapping (the id is links.size()) and add
     // the link to the links data structure.  The insert function
     // returns a reference to the newly inserted link.
-    auto link_name_it = link_names.find(link_name);
+    auto link_name_it = link_names.try_emplace(names.intern(link_name), links.size());
 
-    ConfigLink* link = (link_name_it == link_names.end())
-                           ? links.insert(new ConfigLink(link_names[link_name] = links.size(), link_name))
-                           : links[link_name_it->second];
+    ConfigLink* link = link_name_it.second ? links.insert(new ConfigLink(link_name_it.first->second, link_name))
+                                           : links[link_name_it.first->second];
 
     // Check to make sure the link has not been referenced too many
     // times.
@@ -866,9 +980,10 @@ void
 ConfigGraph::setLinkNoCut(const std::string& link_name)
 {
     // If link doesn't exist, return
-    if ( link_names.find(link_name) == link_names.end() ) return;
+    auto it = link_names.find(names.find(link_name));
+    if ( it == link_names.end() ) return;
 
-    ConfigLink* link = links[link_names[link_name]];
+    ConfigLink* link = links[it->second];
     link->no_cut     = true;
 }
 
@@ -899,7 +1014,7 @@ ConfigGraph::findComponentByName(const std::string& name)
     std::string origname(name);
     auto        index    = origname.find(":");
     std::string compname = origname.substr(0, index);
-    auto        itr      = compsByName.find(compname);
+    auto        itr      = compsByName.find(names.find(compname));
 
     // Check to see if component was found
     if ( itr == compsByName.end() ) return nullptr;
@@ -937,13 +1052,19 @@ ConfigGraph::getSubGraph(const std::set<uint32_t>& rank_set)
 {
     ConfigGraph* graph = new ConfigGraph();
 
+    // Flat lookup of the ranks in the set
+    std::vector<bool> in_set(rank_set.empty() ? 0 : *rank_set.rbegin() + 1, false);
+    for ( uint32_t rank : rank_set )
+        in_set[rank] = true;
+    auto in_ranks = [&in_set](uint32_t rank) { return rank < in_set.size() && in_set[rank]; };
+
     // SparseVectorMap is extremely slow at random inserts, so make
     // sure things go in in order into both comps and links, then tie
     // it all together.
     for ( ConfigComponentMap_t::iterator it = comps.begin(); it != comps.end(); ++it ) {
         const ConfigComponent* comp = *it;
 
-        if ( rank_set.find(comp->rank.rank) != rank_set.end() ) { graph->comps.insert(comp->cloneWithoutLinks(graph)); }
+        if ( in_ranks(comp->rank.rank) ) { graph->comps.insert(comp->cloneWithoutLinks(graph)); }
         else {
             // See if the other side of any of component's links is in
             // set, if so, add to graph
@@ -952,7 +1073,7 @@ ConfigGraph::getSubGraph(const std::set<uint32_t>& rank_set)
                 ComponentId_t     remote = COMPONENT_ID_MASK(link->component[0]) == COMPONENT_ID_MASK(comp->id)
                                                ? link->component[1]
                                                : link->component[0];
-                if ( rank_set.find(comps[COMPONENT_ID_MASK(remote)]->rank.rank) != rank_set.end() ) {
+                if ( in_ranks(comps[COMPONENT_ID_MASK(remote)]->rank.rank) ) {
                     graph->comps.insert(comp->cloneWithoutLinksOrParams(graph));
                     break;
                 }
@@ -969,8 +1090,8 @@ ConfigGraph::getSubGraph(const std::set<uint32_t>& rank_set)
         const ConfigComponent* comp0 = findComponent(link->component[0]);
         const ConfigComponent* comp1 = findComponent(link->component[1]);
 
-        bool comp0_in_ranks = (rank_set.find(comp0->rank.rank) != rank_set.end());
-        bool comp1_in_ranks = (rank_set.find(comp1->rank.rank) != rank_set.end());
+        bool comp0_in_ranks = in_ranks(comp0->rank.rank);
+        bool comp1_in_ranks = in_ranks(comp1->rank.rank);
 
         if ( comp0_in_ranks || comp1_in_ranks ) {
             // Clone the link and add to new lin k map
@@ -998,52 +1119,66 @@ ConfigGraph::getSubGraph(const std::set<uint32_t>& rank_set)
 }
 
 ConfigGraph::GraphFilter::GraphFilter(
-    ConfigGraph* original_graph, ConfigGraph* new_graph, const std::set<uint32_t>& original_rank_set,
-    const std::set<uint32_t>& new_rank_set) :
-    ograph(original_graph),
-    ngraph(new_graph),
-    oset(original_rank_set),
-    nset(new_rank_set)
-{}
+    const std::vector<ConfigGraph*>& graphs, const std::vector<std::set<uint32_t>>& rank_sets) :
+    graphs(graphs),
+    ghosts(graphs.size(), nullptr)
+{
+    // Flat lookup of which graph each rank goes to
+    for ( size_t i = 0; i < rank_sets.size(); i++ ) {
+        if ( rank_sets[i].empty() ) continue;
+        uint32_t last = *rank_sets[i].rbegin();
+        if ( last >= rank_graph.size() ) rank_graph.resize(last + 1, -1);
+        for ( uint32_t rank : rank_sets[i] )
+            rank_graph[rank] = i;
+    }
+    link_graphs.reserve(graphs[0]->links.size());
+}
+
+void
+ConfigGraph::GraphFilter::addToGhost(ConfigComponent* comp, int g, LinkId_t id)
+{
+    if ( nullptr == ghosts[g] ) ghosts[g] = comp->cloneWithoutLinksOrParams(graphs[g]);
+    ConfigLink*   link  = graphs[g]->links[id];
+    ComponentId_t subid = COMPONENT_ID_MASK(link->component[0]) == COMPONENT_ID_MASK(comp->id) ? link->component[0]
+                                                                                                : link->component[1];
+    ghosts[g]->findSubComponent(subid)->links.push_back(id);
+}
 
 ConfigLink*
 ConfigGraph::GraphFilter::operator()(ConfigLink* link)
 {
-    // Need to see if the link is connected to components in the
-    // old and/or new graph
-    int ranks[2];
-    ranks[0] = ograph->findComponent(link->component[0])->rank.rank;
-    ranks[1] = ograph->findComponent(link->component[1])->rank.rank;
-
-    // First bit of flag checks to see if either end is in the set
-    // that will stay in the original graph
-    uint8_t flag = oset.count(ranks[0]) | oset.count(ranks[1]);
+    // Need to see which graphs the link is connected to components in
+    ConfigGraph* ograph = graphs[0];
+    int          ends[2];
+    ends[0] = graphOf(ograph->findComponent(link->component[0])->rank.rank);
+    ends[1] = graphOf(ograph->findComponent(link->component[1])->rank.rank);
+    link_graphs.emplace(link->id, std::make_pair(ends[0], ends[1]));
 
-    // Second bit will check for the set that will be in the new graph
-    flag |= ((nset.count(ranks[0]) | nset.count(ranks[1])) << 1);
-
-    switch ( flag ) {
-    case 0:
-        // Not connected in either of the partitions.  This shouldn't
+    if ( ends[0] == -1 && ends[1] == -1 ) {
+        // Not connected in any of the partitions.  This shouldn't
         // happen, but if it did, it's just an extraneous link.  Just
         // delete it and remove from the original graph.
         delete link;
         return nullptr;
-    case 1:
-        // Connected in original graph, not in new. Just return it
-        return link;
-    case 2:
-        // Connected in new graph, but not original.  Move to new
-        // graph
-        ngraph->links.insert(link);
-        return nullptr;
-    case 3:
-        // Connected in both graphs.  Make a copy for the new graph
-        ConfigLink* l = new ConfigLink(*link);
-        ngraph->links.insert(l);
+    }
+
+    // An end on a ghost component only needs the link in the graph of
+    // the other end
+    if ( ends[0] == -1 ) ends[0] = ends[1];
+    if ( ends[1] == -1 ) ends[1] = ends[0];
+
+    if ( ends[0] == 0 || ends[1] == 0 ) {
+        // Stays in the original graph, with a copy for the graph of
+        // the other end
+        int other = ends[0] == 0 ? ends[1] : ends[0];
+        if ( other != 0 ) graphs[other]->links.insert(new ConfigLink(*link));
         return link;
     }
-    // Silence warning even though every possible path has a return
+
+    // Moves to the graph of one end, with a copy for the graph of the
+    // other end
+    graphs[ends[0]]->links.insert(link);
+    if ( ends[1] != ends[0] ) graphs[ends[1]]->links.insert(new ConfigLink(*link));
     return nullptr;
 }
 
@@ -1052,159 +1187,124 @@ ConfigComponent*
 ConfigGraph::GraphFilter::operator()(ConfigComponent* comp)
 {
     // Need to figure out which graph this component should end up in.
-    // If it's in both graphs, then one will get a ghost component (or
-    // both may get a ghost component if it is already a ghost
-    // component).
-
-    // First, see if it is actually in one of the sets.  If not, then
-    // it is already a ghost component.
-    if ( ((oset.count(comp->rank.rank) + nset.count(comp->rank.rank)) == 0) ) {
-        // A ghost component could end up being in one or both of the new
-        // graphs.  Also, unlike real components, links could end up
-        // getting deleted from either version of the ghost cell, so we
-        // will just start with a clean slate for both and add them back
-        // in as needed.
-        ConfigComponent* extra         = nullptr;
-        bool             keep_original = false;
+    // Any other graph it has links to gets a ghost component.
+    int              home = graphOf(comp->rank.rank);
+    ConfigComponent* ret  = nullptr;
+
+    if ( home == -1 ) {
+        // Already a ghost component.  It could end up in any number of
+        // the new graphs, and its links could end up getting deleted
+        // from any of them, so we will just start with a clean slate
+        // and add them back in as needed.
         for ( LinkId_t id : comp->clearAllLinks() ) {
-            // Each link will only be in one of the new graphs since one
-            // side already connects to a component out of the bounds of
-            // the input graph.
-            if ( ograph->links.contains(id) ) {
+            auto it = link_graphs.find(id);
+            if ( it == link_graphs.end() ) continue;
+            // The end on this component is in none of the sets, so the
+            // link is only in the graph of the other end
+            int g = it->second.first == -1 ? it->second.second : it->second.first;
+            // Extra link that got deleted.  Nothing needs to be done
+            if ( g == -1 ) continue;
+            if ( g == 0 ) {
                 // Add back into comp
-                ConfigLink*   link  = ograph->links[id];
+                ConfigLink*   link  = graphs[0]->links[id];
                 ComponentId_t subid = COMPONENT_ID_MASK(link->component[0]) == COMPONENT_ID_MASK(comp->id)
                                           ? link->component[0]
                                           : link->component[1];
                 comp->findSubComponent(subid)->links.push_back(id);
-                keep_original = true;
-            }
-            else if ( ngraph->links.contains(id) ) {
-                // Add to "extra"
-                if ( nullptr == extra ) extra = comp->cloneWithoutLinksOrParams(ngraph);
-                ConfigLink*   link  = ngraph->links[id];
-                ComponentId_t subid = COMPONENT_ID_MASK(link->component[0]) == COMPONENT_ID_MASK(comp->id)
-                                          ? link->component[0]
-                                          : link->component[1];
-                extra->findSubComponent(subid)->links.push_back(id);
+                ret = comp;
             }
             else {
-                // Extra link that didn't get deleted before.  Nothing
-                // needs to be done
+                addToGhost(comp, g, id);
             }
         }
-
-        // If we created a new ghost add it to the ngraph
-        if ( extra ) { ngraph->comps.insert(extra); }
-
-        if ( !keep_original ) {
-            // Remove from ograph and delete
-            delete comp;
-            return nullptr;
-        }
-        else {
-            // Keep in ograph
-            return comp;
-        }
+        // Remove from the original graph if nothing there links to it
+        if ( ret == nullptr ) delete comp;
     }
-
-    // Not a ghost component, which means the whole thing will end up
-    // in one graph and the other may get a ghost.
-    ConfigGraph* other;
-
-    if ( oset.count(comp->rank.rank) ) { other = ngraph; }
     else {
-        // Need to move comp to ngraph
-        comp->graph = ngraph;
-        ngraph->comps.insert(comp);
-
-        other = ograph;
-    }
-
-
-    // Possible ghost
-    ConfigComponent* ghost = nullptr;
+        // Not a ghost component, which means the whole thing will end
+        // up in one graph
+        if ( home == 0 ) { ret = comp; }
+        else {
+            comp->graph = graphs[home];
+            graphs[home]->comps.insert(comp);
+        }
 
-    // Need to see if any of the links in the component cross the
-    // parition.  If so, we need a "ghost component".
-    for ( LinkId_t id : comp->allLinks() ) {
-        // Link will for sure be in real, so only need to check other
-        if ( other->links.contains(id) ) {
-            // Link is in the other partition.  Will need a ghost
-            // cell.  Ghost cell will end up in other graph
-            if ( nullptr == ghost ) ghost = comp->cloneWithoutLinksOrParams(other);
-            ConfigLink*   link  = other->links[id];
-            ComponentId_t subid = COMPONENT_ID_MASK(link->component[0]) == COMPONENT_ID_MASK(comp->id)
-                                      ? link->component[0]
-                                      : link->component[1];
-            ghost->findSubComponent(subid)->links.push_back(id);
+        // Need to see if any of the links in the component cross to
+        // another partition.  If so, that partition gets a ghost.
+        for ( LinkId_t id : comp->allLinks() ) {
+            auto it = link_graphs.find(id);
+            if ( it == link_graphs.end() ) continue;
+            int other = it->second.first == home ? it->second.second : it->second.first;
+            if ( other == -1 || other == home ) continue;
+            addToGhost(comp, other, id);
         }
-    }
 
-    // Now need to sort out where the ghost cell goes
-    if ( oset.count(comp->rank.rank) ) {
-        // Ghost goes in ngraph.  Comp stays in ograph
-        if ( ghost ) { ngraph->comps.insert(ghost); }
-        return comp;
+        // A ghost in the original graph takes the place of comp
+        if ( home != 0 ) ret = ghosts[0];
     }
-    else {
-        // Ghost goes in ograph
-        return ghost;
+
+    // Components are visited in ID order, so each graph gets its
+    // ghosts in order
+    for ( size_t g = 1; g < ghosts.size(); g++ ) {
+        if ( ghosts[g] ) graphs[g]->comps.insert(ghosts[g]);
     }
+    std::fill(ghosts.begin(), ghosts.end(), nullptr);
+    return ret;
 }
 
 ConfigGraph*
 ConfigGraph::splitGraph(const std::set<uint32_t>& orig_rank_set, const std::set<uint32_t>& new_rank_set)
 {
-    ConfigGraph* graph = new ConfigGraph();
+    return splitGraph(std::vector<std::set<uint32_t>> { orig_rank_set, new_rank_set })[0];
+}
 
-    // Split up the links
-    GraphFilter filter(this, graph, orig_rank_set, new_rank_set);
-    links.filter(filter);
+std::vector<ConfigGraph*>
+ConfigGraph::splitGraph(const std::vector<std::set<uint32_t>>& rank_sets)
+{
+    std::vector<ConfigGraph*> graphs(rank_sets.size());
+    graphs[0] = this;
+    for ( size_t i = 1; i < graphs.size(); i++ )
+        graphs[i] = new ConfigGraph();
 
-    // Split up the components
+    // Split up the links, then the components, each in a single pass
+    GraphFilter filter(graphs, rank_sets);
+    links.filter(filter);
     comps.filter(filter);
 
-    // Copy the statistic configuration to the sub-graph
-    graph->statOutputs = this->statOutputs;
+    for ( size_t i = 1; i < graphs.size(); i++ ) {
+        // Copy the statistic configuration to the sub-graph
+        graphs[i]->statOutputs = this->statOutputs;
+        graphs[i]->setStatisticLoadLevel(this->getStatLoadLevel());
+    }
 
-    // Need to copy statgroups contained in new graph and remove
+    // Need to copy statgroups contained in the new graphs and remove
     // statgroups that are no longer needed in original graph
-    // for ( auto& kv : this->statGroups ) {
     for ( auto it = this->statGroups.begin(); it != this->statGroups.end(); /* increment in loop body */ ) {
-        bool copy   = false;
+        for ( size_t i = 1; i < graphs.size(); i++ ) {
+            for ( auto& id : it->second.components ) {
+                if ( graphs[i]->containsComponent(id) ) {
+                    graphs[i]->statGroups.insert(std::make_pair(it->first, it->second));
+                    break;
+                }
+            }
+        }
+
         bool remove = true;
         for ( auto& id : it->second.components ) {
-            if ( graph->containsComponent(id) ) {
-                copy = true;
-                // We can stop if we've verified it belongs in both
-                // already.  In this case, if remove is false, then we
-                // can break
-                if ( !remove ) break;
-            }
             if ( containsComponent(id) ) {
                 remove = false;
-                // We can stop if we've verified it belongs in both
-                // already.  In this case, if copy is true, then we
-                // can break
-                if ( copy ) break;
+                break;
             }
         }
 
-        // See if we need to copy into new graph
-        if ( copy ) { graph->statGroups.insert(std::make_pair(it->first, it->second)); }
-
-        // See if we need to remove from the original graph.
         if ( remove ) { it = this->statGroups.erase(it); }
         else {
             ++it;
         }
     }
 
-    graph->setStatisticLoadLevel(this->getStatLoadLevel());
-
-
-    return graph;
+    graphs.erase(graphs.begin());
+    return graphs;
 }
 
 
@@ -1280,6 +1380,8 @@ ConfigGraph::getCollapsedPartitionGraph()
             const ConfigComponent* comp = comps[*i];
             // Compute the new weight
             pcomp->weight += comp->weight;
+            for ( int d = 0; d < 3; ++d )
+                pcomp->coords[d] += comp->coords[d] / group.size();
             // Inserting in order because the iterator is from an
             // ordered set
             pcomp->group.insert(*i);
@@ -1371,6 +1473,17 @@ ConfigGraph::getConnectedNoCutComps(ComponentId_t start, std::set<ComponentId_t>
     }
 }
 
+void
+ConfigGraph::restoreLookupTables()
+{
+    compsByName.clear();
+    nextComponentId = 0;
+    for ( auto* x : comps ) {
+        compsByName.insert(std::make_pair(names.intern(x->name), x->id));
+        nextComponentId = std::max(nextComponentId, x->id + 1);
+    }
+}
+
 void
 ConfigGraph::setComponentConfigGraphPointers()
 {
@@ -14,6 +14,7 @@
 #ifndef SST_CORE_CONFIGGRAPH_H
 #define SST_CORE_CONFIGGRAPH_H
 
+#include "sst/core/nameTable.h"
 #include "sst/core/params.h"
 #include "sst/core/rankInfo.h"
 #include "sst/core/serialization/serializable.h"
@@ -23,9 +24,11 @@
 #include "sst/core/statapi/statoutput.h"
 #include "sst/core/unitAlgebra.h"
 
+#include <algorithm>
 #include <climits>
 #include <map>
 #include <set>
+#include <unordered_map>
 #include <vector>
 
 using namespace SST::Statistics;
@@ -41,6 +44,42 @@ class ConfigGraph;
 typedef SparseVectorMap<ComponentId_t> ComponentIdMap_t;
 typedef std::vector<LinkId_t>          LinkIdMap_t;
 
+/**
+   Table of strings used while serializing a ConfigGraph.  Strings
+   that repeat across the graph (component types, port names and
+   latencies) are written once, and every later use is written as an
+   index into the table.  The table only exists for the duration of
+   ConfigGraph::serialize_order(); outside of that, strings are
+   serialized normally.
+ */
+class ConfigStringTable
+{
+public:
+    /** Serialize a string through the active table, if there is one */
+    static void serialize(SST::Core::Serialization::serializer& ser, std::string& str);
+
+    /** Makes a table active for the lifetime of the object */
+    class Scope
+    {
+    public:
+        /** @param hint Expected number of distinct strings, used to
+            size the table up front */
+        explicit Scope(size_t hint = 0);
+        ~Scope();
+
+    private:
+        ConfigStringTable* prev;
+        // Shared Params are also only written once
+        Params::SharedDataTable::Scope params;
+    };
+
+private:
+    std::unordered_map<std::string, uint32_t> index;
+    std::vector<std::string>                  strings;
+
+    static thread_local ConfigStringTable* active;
+};
+
 /** Represents the configuration of a generic Link */
 class ConfigLink : public SST::Core::Serialization::serializable
 {
@@ -52,9 +91,10 @@ public:
     SimTime_t     latency[2];     /*!< Latency from each side */
     std::string   latency_str[2]; /*!< Temp string holding latency */
 
-    LinkId_t order;  /*!< Number of components currently referring to this Link.  After graph construction, it will
-                       be repurposed to hold the enforce_order value */
-    bool     no_cut; /*!< If set to true, partitioner will not make a cut through this Link */
+    LinkId_t order;   /*!< Number of components currently referring to this Link.  After graph construction, it will
+                        be repurposed to hold the enforce_order value */
+    bool     no_cut;  /*!< If set to true, partitioner will not make a cut through this Link */
+    double   traffic; /*!< Events measured on this Link in an earlier run, used by the partitioner if set */
 
     // inline const std::string& key() const { return name; }
     inline LinkId_t key() const { return id; }
@@ -79,7 +119,7 @@ public:
     }
 
     /* Do not use.  For serialization only */
-    ConfigLink() {}
+    ConfigLink() : no_cut(false), traffic(0.0) {}
 
     void serialize_order(SST::Core::Serialization::serializer& ser) override
     {
@@ -87,20 +127,22 @@ public:
         ser& name;
         ser& component[0];
         ser& component[1];
-        ser& port[0];
-        ser& port[1];
+        ConfigStringTable::serialize(ser, port[0]);
+        ConfigStringTable::serialize(ser, port[1]);
         ser& latency[0];
         ser& latency[1];
-        ser& latency_str[0];
-        ser& latency_str[1];
+        ConfigStringTable::serialize(ser, latency_str[0]);
+        ConfigStringTable::serialize(ser, latency_str[1]);
         ser& order;
+        ser& no_cut;
+        ser& traffic;
     }
 
     ImplementSerializable(SST::ConfigLink)
 
 private:
     friend class ConfigGraph;
-    ConfigLink(LinkId_t id) : id(id), no_cut(false)
+    ConfigLink(LinkId_t id) : id(id), no_cut(false), traffic(0.0)
     {
         order = 0;
 
@@ -109,7 +151,7 @@ private:
         component[1] = ULONG_MAX;
     }
 
-    ConfigLink(LinkId_t id, const std::string& n) : id(id), no_cut(false)
+    ConfigLink(LinkId_t id, const std::string& n) : id(id), no_cut(false), traffic(0.0)
     {
         order = 0;
         name  = n;
@@ -163,14 +205,16 @@ public:
     std::vector<ComponentId_t>    components;
     size_t                        outputID;
     UnitAlgebra                   outputFrequency;
+    bool                          reduce;
 
-    ConfigStatGroup(const std::string& name) : name(name), outputID(0) {}
+    ConfigStatGroup(const std::string& name) : name(name), outputID(0), reduce(false) {}
     ConfigStatGroup() {} /* Do not use */
 
     bool addComponent(ComponentId_t id);
     bool addStatistic(const std::string& name, Params& p);
     bool setOutput(size_t id);
     bool setFrequency(const std::string& freq);
+    bool setReduce(bool val);
 
     /**
      * Checks to make sure that all components in the group support all
@@ -186,6 +230,7 @@ public:
         ser& components;
         ser& outputID;
         ser& outputFrequency;
+        ser& reduce;
     }
 
     ImplementSerializable(SST::ConfigStatGroup)
@@ -302,7 +347,7 @@ public:
         ser& id;
         ser& name;
         ser& slot_num;
-        ser& type;
+        ConfigStringTable::serialize(ser, type);
         ser& weight;
         ser& rank.rank;
         ser& rank.thread;
@@ -374,8 +419,8 @@ private:
 // typedef SparseVectorMap<std::string,ConfigLink> ConfigLinkMap_t;
 /** Map IDs to Components */
 typedef SparseVectorMap<ComponentId_t, ConfigComponent*> ConfigComponentMap_t;
-/** Map names to Components */
-typedef std::map<std::string, ComponentId_t>             ConfigComponentNameMap_t;
+/** Map interned names to Components */
+typedef std::unordered_map<NameTable::NameId_t, ComponentId_t> ConfigComponentNameMap_t;
 /** Map names to Parameter Sets: XML only */
 typedef std::map<std::string, Params*>                   ParamsMap_t;
 /** Map names to variable values:  XML only */
@@ -446,6 +491,18 @@ public:
 
     long getStatLoadLevel() const { return statLoadLevel; }
 
+    /** Values to set in global param sets for one run of an ensemble,
+     * keyed by set name, then by parameter */
+    typedef std::map<std::string, std::map<std::string, std::string>> EnsembleVariant;
+
+    /** Add a run to the ensemble of runs of this graph */
+    void addEnsembleVariant(const EnsembleVariant& variant) { ensembleVariants.push_back(variant); }
+
+    const std::vector<EnsembleVariant>& getEnsembleVariants() const { return ensembleVariants; }
+
+    /** Set the params of a variant in the global param sets */
+    static void applyEnsembleVariant(const EnsembleVariant& variant);
+
     /** Add a Link to a Component on a given Port */
     void addLink(
         ComponentId_t comp_id, const std::string& link_name, const std::string& port, const std::string& latency_str,
@@ -457,8 +514,14 @@ public:
     /** Perform any post-creation cleanup processes */
     void postCreationCleanup();
 
-    /** Check the graph for Structural errors */
-    bool checkForStructuralErrors();
+    /** Rebuild the component name lookup and next component ID,
+     * which are not serialized with the graph.  Used when a full
+     * graph is loaded from a binary snapshot. */
+    void restoreLookupTables();
+
+    /** Check the graph for Structural errors, checking the ports of
+        the components with up to num_threads threads */
+    bool checkForStructuralErrors(uint32_t num_threads = 1);
 
     // Temporary until we have a better API
     /** Return the map of components */
@@ -491,19 +554,41 @@ public:
 
     ConfigGraph* splitGraph(const std::set<uint32_t>& orig_rank_set, const std::set<uint32_t>& new_rank_set);
 
+    /**
+     * Split the graph several ways in one pass.  Components on the
+     * ranks in rank_sets[0] stay in this graph, and a new graph is
+     * returned for each of the other sets, in the same order.
+     * Components with links to another graph get a ghost there, the
+     * same as with the two-way split.
+     */
+    std::vector<ConfigGraph*> splitGraph(const std::vector<std::set<uint32_t>>& rank_sets);
+
     PartitionGraph* getPartitionGraph();
     PartitionGraph* getCollapsedPartitionGraph();
     void            annotateRanks(PartitionGraph* graph);
     void            getConnectedNoCutComps(ComponentId_t start, std::set<ComponentId_t>& group);
 
     void setComponentConfigGraphPointers();
-    void serialize_order(SST::Core::Serialization::serializer& ser) override
+
+    /** Serialize everything but the components and links, so that a
+        large graph can be sent with those in separate pieces */
+    void serialize_statistics(SST::Core::Serialization::serializer& ser)
     {
-        ser& links;
-        ser& comps;
         ser& statOutputs;
         ser& statLoadLevel;
         ser& statGroups;
+    }
+
+    void serialize_order(SST::Core::Serialization::serializer& ser) override
+    {
+        // Repeated strings are only written once.  Most graphs only
+        // have a few distinct port names and latencies, but ones with
+        // per-instance names would otherwise rehash many times.
+        ConfigStringTable::Scope strings(std::min<size_t>(2 * links.size() + comps.size(), 1 << 16));
+
+        ser& links;
+        ser& comps;
+        serialize_statistics(ser);
         if ( ser.mode() == SST::Core::Serialization::serializer::UNPACK ) {
             // Need to reintialize the ConfigGraph ptrs in the
             // ConfigComponents
@@ -521,28 +606,43 @@ private:
 
     ConfigLinkMap_t                        links;       // SparseVectorMap
     ConfigComponentMap_t                   comps;       // SparseVectorMap
-    ConfigComponentNameMap_t               compsByName; // std::map
+    ConfigComponentNameMap_t               compsByName; // Keyed by ID in names
     std::map<std::string, ConfigStatGroup> statGroups;
 
-    std::map<std::string, LinkId_t> link_names;
+    std::unordered_map<NameTable::NameId_t, LinkId_t> link_names; // Keyed by ID in names
+
+    // Component and link names, which share most of their segments
+    NameTable names;
 
     std::vector<ConfigStatOutput> statOutputs; // [0] is default
     uint8_t                       statLoadLevel;
 
+    // Runs of an ensemble, which are only done with a single rank, so
+    // they aren't serialized
+    std::vector<EnsembleVariant> ensembleVariants;
+
     ImplementSerializable(SST::ConfigGraph)
 
     // Filter class
     class GraphFilter
     {
-        ConfigGraph*              ograph;
-        ConfigGraph*              ngraph;
-        const std::set<uint32_t>& oset;
-        const std::set<uint32_t>& nset;
+        // graphs[0] is the graph being split
+        std::vector<ConfigGraph*> graphs;
+        // Index into graphs for each rank, -1 for ranks in no set
+        std::vector<int>          rank_graph;
+        // Graphs of the two ends of each link, filled in by the link
+        // pass for the component pass
+        std::unordered_map<LinkId_t, std::pair<int, int>> link_graphs;
+        // Ghosts of the current component, by graph
+        std::vector<ConfigComponent*> ghosts;
+
+        int graphOf(uint32_t rank) const { return rank < rank_graph.size() ? rank_graph[rank] : -1; }
+
+        /** Add a link to the ghost of comp in graph g, creating it if needed */
+        void addToGhost(ConfigComponent* comp, int g, LinkId_t id);
 
     public:
-        GraphFilter(
-            ConfigGraph* original_graph, ConfigGraph* new_graph, const std::set<uint32_t>& original_rank_set,
-            const std::set<uint32_t>& new_rank_set);
+        GraphFilter(const std::vector<ConfigGraph*>& graphs, const std::vector<std::set<uint32_t>>& rank_sets);
 
         ConfigLink*      operator()(ConfigLink* link);
         ConfigComponent* operator()(ConfigComponent* comp);
@@ -556,6 +656,7 @@ public:
     float         weight;
     RankInfo      rank;
     LinkIdMap_t   links;
+    double        coords[3]; /*!< Mean of the coordinates of the group */
 
     ComponentIdMap_t group;
 
@@ -564,9 +665,16 @@ public:
         id     = cc->id;
         weight = cc->weight;
         rank   = cc->rank;
+        for ( int i = 0; i < 3; ++i )
+            coords[i] = cc->coords[i];
     }
 
-    PartitionComponent(LinkId_t id) : id(id), weight(0), rank(RankInfo(RankInfo::UNASSIGNED, 0)) {}
+    PartitionComponent(LinkId_t id) :
+        id(id),
+        weight(0),
+        rank(RankInfo(RankInfo::UNASSIGNED, 0)),
+        coords { 0.0, 0.0, 0.0 }
+    {}
 
     // PartitionComponent(ComponentId_t id, ConfigGraph* graph, const ComponentIdMap_t& group);
     void print(std::ostream& os, const PartitionGraph* graph) const;
@@ -581,6 +689,7 @@ public:
     ComponentId_t component[2];
     SimTime_t     latency[2];
     bool          no_cut;
+    double        traffic;
 
     PartitionLink(const ConfigLink& cl)
     {
@@ -590,6 +699,7 @@ public:
         latency[0]   = cl.latency[0];
         latency[1]   = cl.latency[1];
         no_cut       = cl.no_cut;
+        traffic      = cl.traffic;
     }
 
     inline LinkId_t key() const { return id; }
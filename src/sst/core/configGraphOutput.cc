@@ -0,0 +1,139 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/configGraphOutput.h"
+
+#include "sst/core/output.h"
+
+#include <cstdarg>
+#include <cstring>
+
+#ifdef HAVE_LIBZ
+#include <zlib.h>
+#endif
+
+using namespace SST::Core;
+
+// Output is written out a megabyte at a time
+static const size_t OUTPUT_BUFFER_SIZE = 1024 * 1024;
+
+ConfigGraphOutput::ConfigGraphOutput(const char* path, bool compress) :
+    outputFile(nullptr),
+    gzOutput(nullptr),
+    buffer(OUTPUT_BUFFER_SIZE),
+    used(0)
+{
+    size_t len = strlen(path);
+    if ( compress && len > 3 && strcmp(path + len - 3, ".gz") == 0 ) {
+#ifdef HAVE_LIBZ
+        gzOutput = gzopen(path, "wb");
+        return;
+#else
+        Output::getDefaultObject().output(
+            "WARNING: SST was built without zlib, so %s will be written uncompressed\n", path);
+#endif
+    }
+    outputFile = fopen(path, "wt");
+}
+
+ConfigGraphOutput::~ConfigGraphOutput()
+{
+    // Errors are reported by flush(), so anything left is written on a
+    // best effort basis
+    if ( used != 0 ) writeOut(buffer.data(), used);
+#ifdef HAVE_LIBZ
+    if ( gzOutput != nullptr ) gzclose((gzFile)gzOutput);
+#endif
+    if ( outputFile != nullptr ) fclose(outputFile);
+}
+
+bool
+ConfigGraphOutput::isOpen() const
+{
+    return outputFile != nullptr || gzOutput != nullptr;
+}
+
+void
+ConfigGraphOutput::print(const char* fmt, ...)
+{
+    va_list args;
+    va_list retry;
+    va_start(args, fmt);
+    va_copy(retry, args);
+
+    size_t avail = buffer.size() - used;
+    int    len   = vsnprintf(buffer.data() + used, avail, fmt, args);
+    va_end(args);
+    if ( len < 0 ) {
+        va_end(retry);
+        throw ConfigGraphOutputException("Error formatting graph output");
+    }
+
+    if ( (size_t)len < avail ) { used += len; }
+    else {
+        // Didn't fit, so make room and format it again
+        flush();
+        if ( (size_t)len < buffer.size() ) {
+            vsnprintf(buffer.data(), buffer.size(), fmt, retry);
+            used = len;
+        }
+        else {
+            std::vector<char> large(len + 1);
+            vsnprintf(large.data(), large.size(), fmt, retry);
+            if ( !writeOut(large.data(), len) ) throw ConfigGraphOutputException("Error writing graph output");
+        }
+    }
+    va_end(retry);
+}
+
+void
+ConfigGraphOutput::write(const char* data, size_t size)
+{
+    if ( size > buffer.size() - used ) {
+        flush();
+        if ( size >= buffer.size() ) {
+            if ( !writeOut(data, size) ) throw ConfigGraphOutputException("Error writing graph output");
+            return;
+        }
+    }
+    memcpy(buffer.data() + used, data, size);
+    used += size;
+}
+
+void
+ConfigGraphOutput::flush()
+{
+    if ( used == 0 ) return;
+    bool ok = writeOut(buffer.data(), used);
+    used    = 0;
+    if ( !ok ) throw ConfigGraphOutputException("Error writing graph output");
+}
+
+bool
+ConfigGraphOutput::writeOut(const char* data, size_t size)
+{
+#ifdef HAVE_LIBZ
+    if ( gzOutput != nullptr ) {
+        // gzwrite() takes an unsigned length, so large writes are split
+        while ( size > 0 ) {
+            unsigned chunk = size > OUTPUT_BUFFER_SIZE ? OUTPUT_BUFFER_SIZE : size;
+            if ( gzwrite((gzFile)gzOutput, data, chunk) != (int)chunk ) return false;
+            data += chunk;
+            size -= chunk;
+        }
+        return true;
+    }
+#endif
+    if ( outputFile == nullptr ) return false;
+    return fwrite(data, 1, size, outputFile) == size;
+}
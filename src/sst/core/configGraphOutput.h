@@ -17,6 +17,8 @@
 
 #include <cstdio>
 #include <exception>
+#include <string>
+#include <vector>
 
 namespace SST {
 class ConfigGraph;
@@ -50,13 +52,23 @@ protected:
 
 /**
  * Outputs configuration data to a specified file path.
+ *
+ * Text formats are written with print() and write(), which collect the
+ * output in a large buffer so a graph with millions of components
+ * isn't written a few bytes at a time.  A path ending in .gz is
+ * written compressed.
  */
 class ConfigGraphOutput
 {
 public:
-    ConfigGraphOutput(const char* path) { outputFile = fopen(path, "wt"); }
+    /**
+     * @param path File to write
+     * @param compress Whether a path ending in .gz is written compressed.
+     * Formats that write to outputFile directly need to pass false.
+     */
+    ConfigGraphOutput(const char* path, bool compress = true);
 
-    virtual ~ConfigGraphOutput() { fclose(outputFile); }
+    virtual ~ConfigGraphOutput();
 
     /**
      * @param cfg Constant pointer to SST configuration
@@ -66,8 +78,23 @@ public:
     virtual void generate(const Config* cfg, ConfigGraph* graph) = 0;
 
 protected:
+    /** Only set if the file is not compressed */
     FILE* outputFile;
 
+    /** Whether the file was opened */
+    bool isOpen() const;
+
+    /** Add formatted output to the buffer */
+    void print(const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+
+    /** Add output to the buffer */
+    void write(const char* data, size_t size);
+    void write(const std::string& str) { write(str.data(), str.size()); }
+
+    /** Write out the buffer.  Throws ConfigGraphOutputException if the
+     * write fails, so generate() should call it once it is done. */
+    void flush();
+
     /**
      * Get a named global parameter set.
      *
@@ -114,6 +141,14 @@ protected:
     {
         return params.getSubscribedGlobalParamSets();
     }
+
+private:
+    bool writeOut(const char* data, size_t size);
+
+    // Actually a gzFile, kept opaque so this header doesn't need zlib
+    void*             gzOutput;
+    std::vector<char> buffer;
+    size_t            used;
 };
 
 } // namespace Core
@@ -16,6 +16,7 @@
 
 #include "sst/core/from_string.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <iomanip>
 #include <limits>
@@ -188,6 +189,105 @@ private:
         }
     }
 
+#ifdef __SIZEOF_INT128__
+    __extension__ typedef unsigned __int128 uint128_t;
+
+    /**
+       Find the span of non-zero words of a number.  Values built from
+       unit strings, like 2e9 or 1e-12, usually only use one or two of
+       the words.
+
+       @param low Set to the index of the least significant non-zero word
+       @param high Set to the index of the most significant non-zero word
+       @return false if the number is zero
+     */
+    bool nonzero_words(int& low, int& high) const
+    {
+        low = 0;
+        while ( low < whole_words + fraction_words && data[low] == 0 )
+            ++low;
+        if ( low == whole_words + fraction_words ) return false;
+        high = whole_words + fraction_words - 1;
+        while ( data[high] == 0 )
+            --high;
+        return true;
+    }
+
+    /**
+       Multiply using native 128-bit integers when the non-zero words
+       of both numbers span at most two words each, so the product
+       fits in 128 bits.  The result is the same as the word by word
+       multiply.
+
+       @return false if the numbers are too wide, without changing this number
+     */
+    bool multiply_narrow(const decimal_fixedpoint& v)
+    {
+        int me_low, me_high, v_low, v_high;
+        if ( !nonzero_words(me_low, me_high) ) return true;
+        if ( !v.nonzero_words(v_low, v_high) ) {
+            *this = v;
+            return true;
+        }
+        if ( me_high - me_low > 1 || v_high - v_low > 1 ) return false;
+
+        uint64_t a = data[me_low] + (me_high > me_low ? data[me_high] * storage_radix_long : 0);
+        uint64_t b = v.data[v_low] + (v_high > v_low ? v.data[v_high] * storage_radix_long : 0);
+
+        uint128_t product = static_cast<uint128_t>(a) * b;
+
+        // Word i of the product is word (i + pos) of the result
+        int pos = me_low + v_low - fraction_words;
+        for ( int i = 0; i < whole_words + fraction_words; ++i ) {
+            data[i] = 0;
+        }
+        for ( int i = pos; product != 0 && i < whole_words + fraction_words; ++i ) {
+            if ( i >= 0 ) data[i] = static_cast<uint32_t>(product % storage_radix_long);
+            product /= storage_radix_long;
+        }
+        negative = negative ^ v.negative;
+        return true;
+    }
+
+    /**
+       Divide using native 128-bit integers when the non-zero words of
+       the divisor span at most two words.  This is an exact long
+       division, one word of quotient per step, so the result is
+       truncated rather than approximated like the generic path.
+
+       @return false if the divisor is too wide or zero, without
+       changing this number
+     */
+    bool divide_narrow(const decimal_fixedpoint& v)
+    {
+        int v_low, v_high;
+        if ( !v.nonzero_words(v_low, v_high) || v_high - v_low > 1 ) return false;
+
+        uint64_t divisor = v.data[v_low] + (v_high > v_low ? v.data[v_high] * storage_radix_long : 0);
+
+        // Dividing by the divisor's low zero words moves word i of the
+        // dividend to word (i + shift) of the quotient.  The dividend
+        // words that end up below word 0 only add to the remainder.
+        int      shift     = fraction_words - v_low;
+        uint64_t remainder = 0;
+
+        uint32_t quotient[whole_words + fraction_words] = {};
+        for ( int i = whole_words + fraction_words - 1; i >= std::min(0, -shift); --i ) {
+            uint128_t current = static_cast<uint128_t>(remainder) * storage_radix_long + (i >= 0 ? data[i] : 0);
+            remainder         = static_cast<uint64_t>(current % divisor);
+            int pos           = i + shift;
+            if ( pos >= 0 && pos < whole_words + fraction_words ) {
+                quotient[pos] = static_cast<uint32_t>(current / divisor);
+            }
+        }
+        for ( int i = 0; i < whole_words + fraction_words; ++i ) {
+            data[i] = quotient[i];
+        }
+        negative = negative ^ v.negative;
+        return true;
+    }
+#endif
+
 public:
     /**
        Default constructor.
@@ -726,6 +826,9 @@ public:
      */
     decimal_fixedpoint& operator*=(const decimal_fixedpoint& v)
     {
+#ifdef __SIZEOF_INT128__
+        if ( multiply_narrow(v) ) return *this;
+#endif
         // Need to do the multiply accumulate for each digit.
         decimal_fixedpoint<whole_words, fraction_words> me(*this);
 
@@ -773,6 +876,9 @@ public:
      */
     decimal_fixedpoint& operator/=(const decimal_fixedpoint& v)
     {
+#ifdef __SIZEOF_INT128__
+        if ( divide_narrow(v) ) return *this;
+#endif
         decimal_fixedpoint inv(v);
         inv.inverse();
         operator*=(inv);
@@ -785,6 +891,13 @@ public:
 
     decimal_fixedpoint& inverse()
     {
+#ifdef __SIZEOF_INT128__
+        decimal_fixedpoint one(1ul);
+        if ( one.divide_narrow(*this) ) {
+            *this = one;
+            return *this;
+        }
+#endif
         // We will use the Newton-Raphson method to compute the
         // inverse
 
@@ -0,0 +1,98 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/directDeliveryQueue.h"
+
+#include <algorithm>
+
+namespace SST {
+
+DirectDeliveryQueue::DirectDeliveryQueue(ActivityQueue* timeVortex, SimTime_t& current_time) :
+    ActivityQueue(),
+    timeVortex(timeVortex),
+    current_time(current_time),
+    head(0)
+{}
+
+DirectDeliveryQueue::~DirectDeliveryQueue()
+{
+    // Need to delete any events left in the queue
+    for ( size_t i = head; i < data.size(); ++i ) {
+        delete data[i];
+    }
+    data.clear();
+}
+
+bool
+DirectDeliveryQueue::empty()
+{
+    return head == data.size();
+}
+
+int
+DirectDeliveryQueue::size()
+{
+    return data.size() - head;
+}
+
+void
+DirectDeliveryQueue::insert(Activity* activity)
+{
+    if ( activity->getDeliveryTime() != current_time ) {
+        timeVortex->insert(activity);
+        return;
+    }
+
+    if ( head == data.size() ) {
+        data.clear();
+        head = 0;
+    }
+
+    // Events are almost always sent in order, otherwise they are put
+    // after the queued events that come before them, as the
+    // TimeVortex would
+    if ( data.size() == head || !Activity::less<false, true, false>()(activity, data.back()) ) {
+        data.push_back(activity);
+    }
+    else {
+        data.insert(
+            std::upper_bound(data.begin() + head, data.end(), activity, Activity::less<false, true, false>()),
+            activity);
+    }
+}
+
+Activity*
+DirectDeliveryQueue::pop()
+{
+    if ( head == data.size() ) return nullptr;
+    return data[head++];
+}
+
+Activity*
+DirectDeliveryQueue::front()
+{
+    if ( head == data.size() ) return nullptr;
+    return data[head];
+}
+
+void
+DirectDeliveryQueue::flush()
+{
+    for ( size_t i = head; i < data.size(); ++i ) {
+        timeVortex->insert(data[i]);
+    }
+    data.clear();
+    head = 0;
+}
+
+} // namespace SST
@@ -0,0 +1,51 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_DIRECTDELIVERYQUEUE_H
+#define SST_CORE_DIRECTDELIVERYQUEUE_H
+
+#include "sst/core/activityQueue.h"
+
+#include <vector>
+
+namespace SST {
+
+/**
+ * Send queue for zero latency links on the same thread.  Events for
+ * the current time are kept in a FIFO that the run loop drains
+ * alongside the TimeVortex, instead of going through its heap.  All
+ * other events are passed on to the TimeVortex.
+ */
+class DirectDeliveryQueue final : public ActivityQueue
+{
+public:
+    DirectDeliveryQueue(ActivityQueue* timeVortex, SimTime_t& current_time);
+    ~DirectDeliveryQueue();
+
+    bool      empty() override;
+    int       size() override;
+    void      insert(Activity* activity) override;
+    Activity* pop() override;
+    Activity* front() override;
+
+    /** Move the queued events into the TimeVortex */
+    void flush();
+
+private:
+    ActivityQueue*         timeVortex;
+    SimTime_t&             current_time;
+    std::vector<Activity*> data; // Sorted by priority and order tag
+    size_t                 head;
+};
+
+} // namespace SST
+
+#endif // SST_CORE_DIRECTDELIVERYQUEUE_H
@@ -19,10 +19,15 @@
 #include "sst/core/sstpart.h"
 #include "sst/core/subcomponent.h"
 
+#include <algorithm>
+#include <atomic>
 #include <climits>
 #include <cstdio>
 #include <cstring>
 #include <dirent.h>
+#include <fcntl.h>
+#include <fstream>
+#include <thread>
 #include <vector>
 
 #ifdef HAVE_DLFCN_H
@@ -40,70 +45,35 @@
 
 namespace {
 
-template <class BaseType>
+// Element names are checked as each info is built, since infos are
+// only built when they are first looked up
+template <class Info>
 void
-checkForValidParamNames(const std::string& libname)
+checkForValidNames(const std::string& libname, const std::string& elem, Info* info)
 {
-    auto* lib = SST::ELI::InfoDatabase::getLibrary<BaseType>(libname);
-    if ( lib ) {
-        const auto& info_map = lib->getMap();
-        for ( auto& x : info_map ) {
-            const std::string comp_name(x.first);
-            const auto&       param_map = x.second->getValidParams();
-            for ( auto& param : param_map ) {
-                if ( !SST::NameCheck::isParamNameValid(param.name) ) {
-                    printf(
-                        "WARNING: Element %s.%s has parameter with an invalid name: %s\n", libname.c_str(),
-                        comp_name.c_str(), param.name);
-                }
-            }
+    for ( auto& param : info->getValidParams() ) {
+        if ( !SST::NameCheck::isParamNameValid(param.name) ) {
+            printf(
+                "WARNING: Element %s.%s has parameter with an invalid name: %s\n", libname.c_str(), elem.c_str(),
+                param.name);
         }
     }
-}
-
-template <class BaseType>
-void
-checkForValidPortNames(const std::string& libname)
-{
-    auto* lib = SST::ELI::InfoDatabase::getLibrary<BaseType>(libname);
-    if ( lib ) {
-        const auto& info_map = lib->getMap();
-        for ( auto& x : info_map ) {
-            const std::string comp_name(x.first);
-            const auto&       port_map = x.second->getValidPorts();
-            for ( auto& port : port_map ) {
-                if ( !SST::NameCheck::isPortNameValid(port.name) ) {
-                    printf(
-                        "WARNING: Element %s.%s has port with an invalid name: %s\n", libname.c_str(),
-                        comp_name.c_str(), port.name);
-                }
-            }
+    for ( auto& port : info->getValidPorts() ) {
+        if ( !SST::NameCheck::isPortNameValid(port.name) ) {
+            printf(
+                "WARNING: Element %s.%s has port with an invalid name: %s\n", libname.c_str(), elem.c_str(),
+                port.name);
         }
     }
-}
-
-template <class BaseType>
-void
-checkForValidSlotNames(const std::string& libname)
-{
-    auto* lib = SST::ELI::InfoDatabase::getLibrary<BaseType>(libname);
-    if ( lib ) {
-        const auto& info_map = lib->getMap();
-        for ( auto& x : info_map ) {
-            const std::string comp_name(x.first);
-            const auto&       slot_map = x.second->getSubComponentSlots();
-            for ( auto& slot : slot_map ) {
-                if ( !SST::NameCheck::isSlotNameValid(slot.name) ) {
-                    printf(
-                        "WARNING: Element %s.%s has slot with an invalid name: %s\n", libname.c_str(),
-                        comp_name.c_str(), slot.name);
-                }
-            }
+    for ( auto& slot : info->getSubComponentSlots() ) {
+        if ( !SST::NameCheck::isSlotNameValid(slot.name) ) {
+            printf(
+                "WARNING: Element %s.%s has slot with an invalid name: %s\n", libname.c_str(), elem.c_str(),
+                slot.name);
         }
     }
 }
 
-
 } // namespace
 
 namespace SST {
@@ -127,9 +97,15 @@ splitPath(const std::string& searchPaths)
 ElemLoader::ElemLoader(const std::string& searchPaths) :
     searchPaths(searchPaths),
     verbose(false),
-    bindPolicy(RTLD_LAZY | RTLD_GLOBAL)
+    bindPolicy(RTLD_LAZY | RTLD_GLOBAL),
+    prefetchThreads(8)
 {
 
+    // Need to check the elements to make sure names of params, etc.
+    // are valid
+    ELI::LazyInfo<Component::BuilderInfo>::setValidator(checkForValidNames<Component::BuilderInfo>);
+    ELI::LazyInfo<SubComponent::BuilderInfo>::setValidator(checkForValidNames<SubComponent::BuilderInfo>);
+
     const char* verbose_env = getenv("SST_CORE_DL_VERBOSE");
     if ( nullptr != verbose_env ) { verbose = atoi(verbose_env) > 0; }
 
@@ -137,14 +113,171 @@ ElemLoader::ElemLoader(const std::string& searchPaths) :
     if ( (nullptr != bind_env) && ((!strcmp(bind_env, "now")) || (!strcmp(bind_env, "NOW"))) ) {
         bindPolicy = RTLD_NOW | RTLD_GLOBAL;
     }
+
+    const char* prefetch_env = getenv("SST_CORE_DL_PREFETCH_THREADS");
+    if ( nullptr != prefetch_env ) { prefetchThreads = std::max(atoi(prefetch_env), 0); }
+
+    readElementCache();
 }
 
 ElemLoader::~ElemLoader() {}
 
+static void
+runELILoaders()
+{
+    for ( auto& libpair : ELI::LoadedLibraries::getLoaders() ) {
+        // loop all the elements in the element lib
+        for ( auto& elempair : libpair.second ) {
+            // loop all the loaders in the element
+            for ( auto* loader : elempair.second ) {
+                loader->load();
+            }
+        }
+    }
+}
+
+// The element cache is a text file.  The first line holds the search
+// path the cache was built from and every other line is a library
+// name and the full path of its file separated by a tab.  A cache
+// built from a different search path is ignored, since it may point
+// at the wrong version of a library.
+static const char* elementCacheHeader = "# SST element library cache";
+
+void
+ElemLoader::readElementCache()
+{
+    const char* cache_env = getenv("SST_CORE_ELEMENT_CACHE");
+    if ( nullptr == cache_env || '\0' == cache_env[0] ) return;
+
+    std::ifstream cache(cache_env);
+    if ( !cache.is_open() ) {
+        if ( verbose ) { printf("SST-DL: Unable to open element cache %s\n", cache_env); }
+        return;
+    }
+
+    std::string line;
+    if ( !std::getline(cache, line) || line != elementCacheHeader ) {
+        if ( verbose ) { printf("SST-DL: Ignoring element cache %s, file is not an element cache\n", cache_env); }
+        return;
+    }
+    if ( !std::getline(cache, line) || line != searchPaths ) {
+        if ( verbose ) {
+            printf("SST-DL: Ignoring element cache %s, it was built for a different search path\n", cache_env);
+        }
+        return;
+    }
+
+    while ( std::getline(cache, line) ) {
+        size_t tab = line.find('\t');
+        if ( tab == std::string::npos || tab == 0 || tab + 1 == line.length() ) continue;
+        cachedPaths[line.substr(0, tab)] = line.substr(tab + 1);
+    }
+
+    if ( verbose ) { printf("SST-DL: Read %zu entries from element cache %s\n", cachedPaths.size(), cache_env); }
+}
+
+bool
+ElemLoader::writeElementCache(const std::string& filename, std::ostream& err_os)
+{
+    std::ofstream cache(filename, std::ios::trunc);
+    if ( !cache.is_open() ) {
+        err_os << "Error: unable to open element cache file \"" << filename << "\" for writing\n";
+        return false;
+    }
+
+    cache << elementCacheHeader << "\n" << searchPaths << "\n";
+    for ( auto& x : loadedPaths ) {
+        cache << x.first << "\t" << x.second << "\n";
+    }
+    cache.close();
+
+    if ( cache.fail() ) {
+        err_os << "Error: failed writing element cache file \"" << filename << "\"\n";
+        return false;
+    }
+    return true;
+}
+
+std::string
+ElemLoader::findLibraryFile(const std::string& elemlib, const std::vector<std::string>& paths) const
+{
+    struct stat sb;
+    auto        cached = cachedPaths.find(elemlib);
+    if ( cached != cachedPaths.end() && 0 == stat(cached->second.c_str(), &sb) ) { return cached->second; }
+
+    for ( std::string const& next_path : paths ) {
+        std::string dir  = next_path.back() == '/' ? next_path : next_path + "/";
+        std::string file = dir + "lib" + elemlib + ".so";
+        if ( 0 == stat(file.c_str(), &sb) && S_ISREG(sb.st_mode) ) { return file; }
+#ifdef SST_COMPILE_MACOSX
+        file = dir + "lib" + elemlib + ".dylib";
+        if ( 0 == stat(file.c_str(), &sb) && S_ISREG(sb.st_mode) ) { return file; }
+#endif
+    }
+    return "";
+}
+
+void
+ElemLoader::readLibraryFile(const std::string& path, std::vector<char>& buffer)
+{
+    int fd = open(path.c_str(), O_RDONLY);
+    if ( fd < 0 ) return;
+    while ( read(fd, buffer.data(), buffer.size()) > 0 ) {}
+    close(fd);
+}
+
+void
+ElemLoader::prefetchLibraries(const std::set<std::string>& elemlibs)
+{
+    if ( prefetchThreads == 0 ) return;
+
+    std::vector<std::string> libs;
+    for ( auto& x : elemlibs ) {
+        if ( !ELI::LoadedLibraries::isLoaded(x) && loadedPaths.count(x) == 0 && prefetchedPaths.count(x) == 0 ) {
+            libs.push_back(x);
+        }
+    }
+    if ( libs.empty() ) return;
+
+    // Each thread takes the next library until they are all done
+    std::vector<std::string> paths = splitPath(searchPaths);
+    std::vector<std::string> found(libs.size());
+    std::atomic<size_t>      next(0);
+
+    auto prefetch = [&]() {
+        std::vector<char> buffer(1 << 20);
+        for ( size_t i = next++; i < libs.size(); i = next++ ) {
+            found[i] = findLibraryFile(libs[i], paths);
+            if ( !found[i].empty() ) readLibraryFile(found[i], buffer);
+        }
+    };
+
+    std::vector<std::thread> threads(std::min<size_t>(prefetchThreads, libs.size()));
+    for ( auto& t : threads ) {
+        t = std::thread(prefetch);
+    }
+    for ( auto& t : threads ) {
+        t.join();
+    }
+
+    for ( size_t i = 0; i < libs.size(); ++i ) {
+        if ( found[i].empty() ) continue;
+        prefetchedPaths[libs[i]] = found[i];
+        if ( verbose ) { printf("SST-DL: Prefetched %s\n", found[i].c_str()); }
+    }
+}
 
 void
 ElemLoader::loadLibrary(const std::string& elemlib, std::ostream& err_os)
 {
+    // Element libraries linked into the executable registered with
+    // the ELI database before main(), so there is nothing to open
+    if ( ELI::LoadedLibraries::isLoaded(elemlib) ) {
+        if ( verbose ) { printf("SST-DL: %s is linked into the executable\n", elemlib.c_str()); }
+        runELILoaders();
+        return;
+    }
+
     std::vector<std::string> paths = splitPath(searchPaths);
 
     char* full_path     = new char[PATH_MAX];
@@ -156,6 +289,32 @@ ElemLoader::loadLibrary(const std::string& elemlib, std::ostream& err_os)
     // errors/warnings/info whether things succeed or not.
     std::vector<std::string> error_msgs;
 
+    // Check the file found by prefetchLibraries() and then the element
+    // cache first.  If the file can't be opened, fall back to searching
+    // the full path.
+    const std::string* cached_path = nullptr;
+    auto               prefetched  = prefetchedPaths.find(elemlib);
+    auto               cached      = cachedPaths.find(elemlib);
+    if ( prefetched != prefetchedPaths.end() ) { cached_path = &prefetched->second; }
+    else if ( cached != cachedPaths.end() ) {
+        cached_path = &cached->second;
+    }
+    if ( cached_path ) {
+        if ( verbose ) { printf("SST-DL: Attempting to load %s from element cache\n", cached_path->c_str()); }
+
+        void* handle = dlopen(cached_path->c_str(), bindPolicy);
+        if ( nullptr == handle ) {
+            if ( verbose ) { printf("SST-DL: Loading from element cache failed, error: %s\n", dlerror()); }
+        }
+        else {
+            if ( verbose ) { printf("SST-DL: Load was successful.\n"); }
+            found_element        = true;
+            loadedPaths[elemlib] = *cached_path;
+            runELILoaders();
+            paths.clear();
+        }
+    }
+
     for ( std::string const& next_path : paths ) {
         if ( verbose ) { printf("SST-DL: Searching: %s\n", next_path.c_str()); }
 
@@ -224,17 +383,9 @@ ElemLoader::loadLibrary(const std::string& elemlib, std::ostream& err_os)
         else {
             if ( verbose ) { printf("SST-DL: Load was successful.\n"); }
 
-            found_element = true;
-
-            for ( auto& libpair : ELI::LoadedLibraries::getLoaders() ) {
-                // loop all the elements in the element lib
-                for ( auto& elempair : libpair.second ) {
-                    // loop all the loaders in the element
-                    for ( auto* loader : elempair.second ) {
-                        loader->load();
-                    }
-                }
-            }
+            found_element        = true;
+            loadedPaths[elemlib] = full_path;
+            runELILoaders();
 
             // exit the search loop, we have found the library we tried to load
             break;
@@ -264,15 +415,6 @@ ElemLoader::loadLibrary(const std::string& elemlib, std::ostream& err_os)
         }
     }
 
-    // Need to check the element library to make sure names of params,
-    // etc. are valid
-    checkForValidParamNames<Component>(elemlib);
-    checkForValidPortNames<Component>(elemlib);
-    checkForValidSlotNames<Component>(elemlib);
-    checkForValidParamNames<SubComponent>(elemlib);
-    checkForValidPortNames<SubComponent>(elemlib);
-    checkForValidSlotNames<SubComponent>(elemlib);
-
     return;
 }
 
@@ -314,6 +456,11 @@ ElemLoader::getPotentialElements(std::vector<std::string>& potential_elements)
     // Always add in the sst library, since it's built into the sst
     // and sst-info executables
     potential_elements.push_back("sst");
+
+    // Along with any element libraries linked in with it
+    for ( auto& libpair : ELI::LoadedLibraries::getLoaders() ) {
+        if ( libpair.first != "sst" ) potential_elements.push_back(libpair.first);
+    }
 }
 
 } // namespace SST
@@ -12,6 +12,8 @@
 #ifndef SST_CORE_ELEMLOADER_H
 #define SST_CORE_ELEMLOADER_H
 
+#include <map>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -34,6 +36,19 @@ public:
      */
     void loadLibrary(const std::string& elemlib, std::ostream& err_os);
 
+    /**
+     * Find and read the files of a set of libraries in parallel
+     * threads, ahead of loading them.  dlopen() itself serializes, so
+     * this hides the latency of searching the path and reading the
+     * files from a slow filesystem, after which loadLibrary() opens
+     * each file from the page cache.  The number of threads is set by
+     * the SST_CORE_DL_PREFETCH_THREADS environment variable, and 0
+     * turns prefetching off.
+     *
+     * @param elemlibs - The names of the Element Libraries to prefetch
+     */
+    void prefetchLibraries(const std::set<std::string>& elemlibs);
+
     /**
      * Search paths for potential elements and add them to the provided vector
      *
@@ -42,10 +57,42 @@ public:
      */
     void getPotentialElements(std::vector<std::string>& potElems);
 
+    /**
+     * Write the locations of all libraries loaded so far to an element
+     * cache file.  When the SST_CORE_ELEMENT_CACHE environment variable
+     * points at this file, later loaders with the same search path will
+     * open the cached files directly instead of searching every
+     * directory in the path.
+     *
+     * @param filename - Name of the cache file to write
+     * @param err_os - Where to print errors associated with writing the file
+     * @return true if the file was written, false otherwise
+     */
+    bool writeElementCache(const std::string& filename, std::ostream& err_os);
+
 private:
+    /** Read the element cache named by SST_CORE_ELEMENT_CACHE, if any */
+    void readElementCache();
+
+    /** Full path of a library's file, or an empty string if it isn't
+     * found.  Only touches the filesystem, so it is safe to call from
+     * more than one thread. */
+    std::string findLibraryFile(const std::string& elemlib, const std::vector<std::string>& paths) const;
+
+    /** Read a file into the page cache */
+    static void readLibraryFile(const std::string& path, std::vector<char>& buffer);
+
     std::string searchPaths;
     bool        verbose;
     int         bindPolicy;
+    unsigned    prefetchThreads;
+
+    /** Library name to file path, read from the element cache */
+    std::map<std::string, std::string> cachedPaths;
+    /** Library name to file path, found by prefetchLibraries() */
+    std::map<std::string, std::string> prefetchedPaths;
+    /** Library name to file path for every library this loader opened */
+    std::map<std::string, std::string> loadedPaths;
 };
 
 } // namespace SST
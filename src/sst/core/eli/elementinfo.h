@@ -28,6 +28,7 @@
 #include "sst/core/sst_types.h"
 #include "sst/core/warnmacros.h"
 
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -137,32 +138,105 @@ struct InstantiateBuilderInfo
     static const bool loaded;
 };
 
+/**
+   Holds the info for one element until it is first looked up.
+   Registration only records how to build the info, so the params,
+   ports, statistics, etc. of elements a simulation never uses are
+   never constructed.  The same holder is added to the library of
+   every base the element is registered under, so they all share one
+   info.
+*/
+template <class Info>
+class LazyInfo
+{
+public:
+    using Validator = void (*)(const std::string& elemlib, const std::string& elem, Info* info);
+
+    template <class T>
+    static LazyInfo* create(const std::string& elemlib, const std::string& elem)
+    {
+        return new LazyInfo(elemlib, elem, [](const std::string& lib, const std::string& name) -> Info* {
+            return new Info(lib, name, (T*)nullptr);
+        });
+    }
+
+    /** Build the info if this is the first lookup.  Safe to call from
+     * more than one thread. */
+    Info* get()
+    {
+        std::call_once(once_, [this]() {
+            info_ = build_(elemlib_, elem_);
+            if ( validator_ ) validator_(elemlib_, elem_, info_);
+        });
+        return info_;
+    }
+
+    /** Set a check to run on each info of this type when it is built */
+    static void setValidator(Validator validator) { validator_ = validator; }
+
+private:
+    using Builder = Info* (*)(const std::string&, const std::string&);
+
+    LazyInfo(const std::string& elemlib, const std::string& elem, Builder build) :
+        elemlib_(elemlib),
+        elem_(elem),
+        build_(build),
+        info_(nullptr)
+    {}
+
+    std::string    elemlib_;
+    std::string    elem_;
+    Builder        build_;
+    Info*          info_;
+    std::once_flag once_;
+
+    static Validator validator_;
+};
+template <class Info>
+typename LazyInfo<Info>::Validator LazyInfo<Info>::validator_ = nullptr;
+
 template <class Base>
 class InfoLibrary
 {
 public:
     using BaseInfo = typename Base::BuilderInfo;
+    using Lazy     = LazyInfo<BaseInfo>;
 
     InfoLibrary(const std::string& name) : name_(name) {}
 
     BaseInfo* getInfo(const std::string& name)
     {
-        auto iter = infos_.find(name);
-        if ( iter == infos_.end() ) { return nullptr; }
+        auto iter = entries_.find(name);
+        if ( iter == entries_.end() ) { return nullptr; }
         else {
-            return iter->second;
+            return iter->second->get();
         }
     }
 
-    bool hasInfo(const std::string& name) const { return infos_.find(name) != infos_.end(); }
+    bool hasInfo(const std::string& name) const { return entries_.find(name) != entries_.end(); }
 
-    int numEntries() const { return infos_.size(); }
+    int numEntries() const { return entries_.size(); }
 
-    const std::map<std::string, BaseInfo*>& getMap() const { return infos_; }
+    /** All the infos in the library.  This builds every one of them, so
+     * it is meant for listing the library rather than lookups. */
+    const std::map<std::string, BaseInfo*>& getMap()
+    {
+        std::lock_guard<std::mutex> lock(map_mutex_);
+        if ( infos_.size() != entries_.size() ) {
+            for ( auto& x : entries_ ) {
+                infos_[x.first] = x.second->get();
+            }
+        }
+        return infos_;
+    }
 
-    void readdInfo(const std::string& name, BaseInfo* info) { infos_[name] = info; }
+    void readdInfo(const std::string& name, Lazy* info)
+    {
+        entries_[name] = info;
+        infos_.erase(name);
+    }
 
-    bool addInfo(const std::string& elem, BaseInfo* info)
+    bool addInfo(const std::string& elem, Lazy* info)
     {
         readdInfo(elem, info);
         // dlopen might thrash this later - add a loader to put it back in case
@@ -171,9 +245,13 @@ public:
     }
 
 private:
-    void addLoader(const std::string& lib, const std::string& name, BaseInfo* info);
+    void addLoader(const std::string& lib, const std::string& name, Lazy* info);
+
+    std::map<std::string, Lazy*> entries_;
 
+    // Built on demand by getMap()
     std::map<std::string, BaseInfo*> infos_;
+    std::mutex                       map_mutex_;
 
     std::string name_;
 };
@@ -246,9 +324,9 @@ private:
 
 template <class Base>
 void
-InfoLibrary<Base>::addLoader(const std::string& elemlib, const std::string& elem, BaseInfo* info)
+InfoLibrary<Base>::addLoader(const std::string& elemlib, const std::string& elem, Lazy* info)
 {
-    auto loader = new InfoLoader<Base, BaseInfo>(elemlib, elem, info);
+    auto loader = new InfoLoader<Base, Lazy>(elemlib, elem, info);
     LoadedLibraries::addLoader(elemlib, elem, loader);
 }
 
@@ -334,35 +412,40 @@ SST_ELI_getTertiaryNumberFromVersion(SST_ELI_element_version_extraction ver)
 #define SST_ELI_DECLARE_INFO(...)                                                                      \
     using BuilderInfo = ::SST::ELI::BuilderInfoImpl<__VA_ARGS__, SST::ELI::ProvidesDefaultInfo, void>; \
     template <class BuilderImpl>                                                                       \
-    static bool addInfo(const std::string& elemlib, const std::string& elem, BuilderImpl* info)        \
+    static bool addInfo(                                                                               \
+        const std::string& elemlib, const std::string& elem, ::SST::ELI::LazyInfo<BuilderImpl>* info)  \
     {                                                                                                  \
         return ::SST::ELI::InfoDatabase::getLibrary<__LocalEliBase>(elemlib)->addInfo(elem, info);     \
     }                                                                                                  \
     SST_ELI_DECLARE_INFO_COMMON()
 
-#define SST_ELI_DECLARE_DEFAULT_INFO()                                                             \
-    using BuilderInfo = ::SST::ELI::BuilderInfoImpl<SST::ELI::ProvidesDefaultInfo, void>;          \
-    template <class BuilderImpl>                                                                   \
-    static bool addInfo(const std::string& elemlib, const std::string& elem, BuilderImpl* info)    \
-    {                                                                                              \
-        return ::SST::ELI::InfoDatabase::getLibrary<__LocalEliBase>(elemlib)->addInfo(elem, info); \
-    }                                                                                              \
+#define SST_ELI_DECLARE_DEFAULT_INFO()                                                                \
+    using BuilderInfo = ::SST::ELI::BuilderInfoImpl<SST::ELI::ProvidesDefaultInfo, void>;             \
+    template <class BuilderImpl>                                                                      \
+    static bool addInfo(                                                                              \
+        const std::string& elemlib, const std::string& elem, ::SST::ELI::LazyInfo<BuilderImpl>* info) \
+    {                                                                                                 \
+        return ::SST::ELI::InfoDatabase::getLibrary<__LocalEliBase>(elemlib)->addInfo(elem, info);    \
+    }                                                                                                 \
     SST_ELI_DECLARE_INFO_COMMON()
 
 #define SST_ELI_DECLARE_INFO_EXTERN(...)                                                               \
     using BuilderInfo = ::SST::ELI::BuilderInfoImpl<SST::ELI::ProvidesDefaultInfo, __VA_ARGS__, void>; \
-    static bool addInfo(const std::string& elemlib, const std::string& elem, BuilderInfo* info);       \
+    static bool addInfo(                                                                               \
+        const std::string& elemlib, const std::string& elem, ::SST::ELI::LazyInfo<BuilderInfo>* info); \
     SST_ELI_DECLARE_INFO_COMMON()
 
-#define SST_ELI_DECLARE_DEFAULT_INFO_EXTERN()                                                    \
-    using BuilderInfo = ::SST::ELI::BuilderInfoImpl<SST::ELI::ProvidesDefaultInfo, void>;        \
-    static bool addInfo(const std::string& elemlib, const std::string& elem, BuilderInfo* info); \
+#define SST_ELI_DECLARE_DEFAULT_INFO_EXTERN()                                                          \
+    using BuilderInfo = ::SST::ELI::BuilderInfoImpl<SST::ELI::ProvidesDefaultInfo, void>;              \
+    static bool addInfo(                                                                               \
+        const std::string& elemlib, const std::string& elem, ::SST::ELI::LazyInfo<BuilderInfo>* info); \
     SST_ELI_DECLARE_INFO_COMMON()
 
-#define SST_ELI_DEFINE_INFO_EXTERN(base)                                                           \
-    bool base::addInfo(const std::string& elemlib, const std::string& elem, BuilderInfo* info)     \
-    {                                                                                              \
-        return ::SST::ELI::InfoDatabase::getLibrary<__LocalEliBase>(elemlib)->addInfo(elem, info); \
+#define SST_ELI_DEFINE_INFO_EXTERN(base)                                                              \
+    bool base::addInfo(                                                                               \
+        const std::string& elemlib, const std::string& elem, ::SST::ELI::LazyInfo<BuilderInfo>* info) \
+    {                                                                                                 \
+        return ::SST::ELI::InfoDatabase::getLibrary<__LocalEliBase>(elemlib)->addInfo(elem, info);    \
     }
 
 #define SST_ELI_EXTERN_DERIVED(base, cls, lib, name, version, desc) \
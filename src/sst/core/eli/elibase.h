@@ -182,13 +182,13 @@ private:
     static constexpr int __EliDerivedLevel = 0;    \
     static const char*   ELI_baseName() { return #Base; }
 
-#define SST_ELI_DECLARE_INFO_COMMON()                                           \
-    using InfoLibrary = ::SST::ELI::InfoLibrary<__LocalEliBase>;                \
-    template <class __TT>                                                       \
-    static bool addDerivedInfo(const std::string& lib, const std::string& elem) \
-    {                                                                           \
-        using BuilderInfo = typename __LocalEliBase::BuilderInfo;               \
-        return addInfo(lib, elem, new BuilderInfo(lib, elem, (__TT*)nullptr));  \
+#define SST_ELI_DECLARE_INFO_COMMON()                                                                   \
+    using InfoLibrary = ::SST::ELI::InfoLibrary<__LocalEliBase>;                                        \
+    template <class __TT>                                                                               \
+    static bool addDerivedInfo(const std::string& lib, const std::string& elem)                         \
+    {                                                                                                   \
+        using BuilderInfo = typename __LocalEliBase::BuilderInfo;                                       \
+        return addInfo(lib, elem, ::SST::ELI::LazyInfo<BuilderInfo>::template create<__TT>(lib, elem)); \
     }
 
 // This macro can be used to declare a new base class that inherits
@@ -24,6 +24,14 @@ namespace SST {
 std::atomic<uint64_t>     SST::Event::id_counter(0);
 const SST::Event::id_type SST::Event::NO_ID = std::make_pair(0, -1);
 
+// Delivers cancelled events, which are simply deleted
+class CancelledEventHandler : public Event::HandlerBase
+{
+    void operator_impl(Event* ev) override { delete ev; }
+};
+
+static CancelledEventHandler cancelled_handler;
+
 Event::~Event() {}
 
 void
@@ -31,7 +39,71 @@ Event::execute(void)
 {
     (*reinterpret_cast<HandlerBase*>(delivery_info))(this);
 }
+
+bool
+Event::isCancelled() const
+{
+    return delivery_info == reinterpret_cast<uintptr_t>(&cancelled_handler);
+}
+
+void
+Event::cancel()
+{
+    delivery_info = reinterpret_cast<uintptr_t>(&cancelled_handler);
+}
 //它的作用是创建并返回当前事件对象的一个副本
+EventBatch::EventBatch(Event* first) : Event()
+{
+    setDeliveryTime(first->getDeliveryTime());
+    setPriority(first->getPriority());
+    setDeliveryInfo(first->getTag(), first->delivery_info);
+    events.push_back(first);
+}
+
+EventBatch::~EventBatch()
+{
+    // Only a batch that was never delivered still has events
+    for ( Event* event : events ) {
+        delete event;
+    }
+}
+
+void
+EventBatch::add(Event* event)
+{
+    EventBatch* batch = dynamic_cast<EventBatch*>(event);
+    if ( batch == nullptr ) {
+        events.push_back(event);
+        return;
+    }
+    events.insert(events.end(), batch->events.begin(), batch->events.end());
+    batch->events.clear();
+    delete batch;
+}
+
+void
+EventBatch::prepareEvents()
+{
+    for ( Event* event : events ) {
+        event->setDeliveryTime(getDeliveryTime());
+        event->setPriority(getPriority());
+        event->setDeliveryInfo(getTag(), delivery_info);
+    }
+}
+
+void
+EventBatch::execute(void)
+{
+    // The handlers own the events, and the batch is done with once
+    // they are all delivered
+    prepareEvents();
+    for ( Event* event : events ) {
+        static_cast<Activity*>(event)->execute();
+    }
+    events.clear();
+    delete this;
+}
+
 Event*
 Event::clone()
 {
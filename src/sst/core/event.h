@@ -13,19 +13,24 @@
 #define SST_CORE_EVENT_H
 
 #include "sst/core/activity.h"
+#include "sst/core/rankInfo.h"
 #include "sst/core/sst_types.h"
 #include "sst/core/ssthandler.h"
 
 #include <atomic>
 #include <cinttypes>
 #include <string>
+#include <type_traits>
+#include <vector>
 //SST是一个命名空间，用于组织和封装相关的类和函数，这有助于避免名称冲突
 //并提供一个清晰的代码结构
 namespace SST {
 
+class EventBatch;
 class Link;
 class NullEvent;
 class RankSync;
+class SyncQueue;
 class ThreadSync;
 
 /**
@@ -66,6 +71,37 @@ public:
     //定义了Handler作为SSTHandler的别名，SSTHandler是一个模板类，用于创建事件处理器
     using Handler = SSTHandler<void, Event*, classT, dataT>;
 
+    /**
+       Used to create handlers for event delivery when the callback
+       function is known at compile time.  The callback is the same as
+       for Handler, and the class is created with:
+
+         new Event::Handler2<classname, &classname::function_name>(this)
+
+       Or, to add static data:
+
+         new Event::Handler2<classname, &classname::function_name, dataT>(this, data)
+
+       Delivering an event through a Handler2 is a single virtual call
+       with the callback inlined into it.
+     */
+    template <typename classT, auto funcT, typename dataT = void>
+    using Handler2 = SSTHandler2<void, Event*, classT, dataT, funcT>;
+
+    /**
+       Used to create handlers that call a different function for
+       each type of event, looked up by getTypeId().  The class is
+       created with the function for events of any other type, then
+       given the function for each type:
+
+         auto* h = new Event::DispatchHandler<classname>(this, &classname::handle_other);
+         h->on<MyEvent, &classname::handle_my_event>();
+
+       where handle_my_event takes a MyEvent*.
+     */
+    template <typename classT>
+    using DispatchHandler = SSTDispatchHandler<void, Event, classT>;
+
     /** Type definition of unique identifiers */
     //唯一标识符类型定义id_type,uint64_t和int分别用于存储事件唯一标识符的
     //高64位和低32位
@@ -88,9 +124,46 @@ public:
     }
     virtual ~Event();
 
+    /** Whether the event was cancelled with Link::cancel() */
+    bool isCancelled() const override;
+
     /** Clones the event in for the case of a broadcast */
     virtual Event* clone();
 
+    /** Compact id of the concrete type of the event, assigned when
+     * its library is loaded.  The ids are small enough to index a
+     * table, but are not the same between processes.  Event types
+     * that can't be serialized have none and return
+     * SST::Core::Serialization::serializable::NullClsIndex. */
+    uint32_t getTypeId() const { return cls_index(); }
+
+    /** Compact id of event type T, which is what getTypeId() returns
+     * for an event that is exactly a T.  T must use
+     * ImplementSerializable itself, not just inherit it. */
+    template <typename T>
+    static uint32_t typeId()
+    {
+        return SST::Core::Serialization::serializable_builder_impl<T>::static_cls_index();
+    }
+
+    /** Cast to an event type, or nullptr if the event isn't one.  An
+     * event that is exactly a T is cast by comparing type ids.  Any
+     * other event needs a dynamic_cast, unless T is final, so declare
+     * event types final where possible.  Abstract types always use a
+     * dynamic_cast. */
+    template <typename T>
+    T* fast_cast()
+    {
+        if constexpr ( std::is_abstract<T>::value ) { return dynamic_cast<T*>(this); }
+        else {
+            if ( getTypeId() == typeId<T>() ) return static_cast<T*>(this);
+            if constexpr ( std::is_final<T>::value ) { return nullptr; }
+            else {
+                return dynamic_cast<T*>(this);
+            }
+        }
+    }
+
 
 #ifdef __SST_DEBUG_EVENT_TRACKING__
     //这个函数用于输出事件的跟踪信息
@@ -135,8 +208,12 @@ public:
     void serialize_order(SST::Core::Serialization::serializer& ser) override
     {
         //首先，序列化从Activity类继承的成员变量
-        Activity::serialize_order(ser);
-        ser& delivery_info;
+        // Events in a batch get their delivery information from the
+        // batch, so it isn't sent for each of them
+        if ( !in_batch ) {
+            Activity::serialize_order(ser);
+            ser& delivery_info;
+        }
 //如果定义了预处理宏，则还会序列化一系列额外的成员变量
 #ifdef __SST_DEBUG_EVENT_TRACKING__
         ser& first_comp;//首次发送事件的组件名称
@@ -158,16 +235,22 @@ protected:
 
 //final用于声明一些其他类时Event类的朋友，其他类可以直接访问私有变量
 private:
+    friend class EventBatch;
     friend class Link;
     friend class NullEvent;
     friend class RankSync;
+    friend class SyncQueue;
     friend class ThreadSync;
+    friend class Simulation_impl;
 
 
     /** Cause this event to fire */
     //事件到达其预定的交付时间时触发事件的执行
     void execute(void) override;
 
+    /** Drop the event instead of delivering it when it fires */
+    void cancel();
+
     /**
        This sets the information needed to get the event properly
        delivered for the next step of transfer.
@@ -211,6 +294,9 @@ private:
 private:
     static std::atomic<uint64_t> id_counter;
 
+    /** Set while the events of an EventBatch are serialized */
+    static inline thread_local bool in_batch = false;
+
 #ifdef __SST_DEBUG_EVENT_TRACKING__
     std::string first_comp;
     std::string first_type;
@@ -223,6 +309,46 @@ private:
     ImplementVirtualSerializable(SST::Event)
 };
 
+/**
+ * Events sent on one link for the same time, delivered as a single
+ * Activity.  On delivery, the handler is called on each of the events
+ * in the order they were added.  Created by Link::sendBatch() and by
+ * the SyncQueue of cross-rank links.  For use by SST Core only.
+ */
+class EventBatch : public Event
+{
+public:
+    /** Create a batch with the delivery information of first */
+    EventBatch(Event* first);
+    ~EventBatch();
+
+    /** Add an event, or the events of another batch */
+    void add(Event* event);
+
+private:
+    friend class Link;
+
+    EventBatch() : Event() {} // For serialization
+
+    void execute(void) override;
+
+    /** Give each event the delivery information of the batch.  This
+     * also restores it on events that were serialized in the batch. */
+    void prepareEvents();
+
+    std::vector<Event*> events;
+
+    void serialize_order(SST::Core::Serialization::serializer& ser) override
+    {
+        Event::serialize_order(ser);
+        in_batch = true;
+        ser& events;
+        in_batch = false;
+    }
+
+    ImplementSerializable(SST::EventBatch)
+};
+
 /**
  * Empty Event.  Does nothing.
  */
@@ -248,6 +374,10 @@ public:
     const std::string   comp_type;//用于存储组件的类型
     const std::string   port_name;//用于存储组件的端口名称
 
+    /** Partition (rank and thread) of the component on the other end
+     * of the port's link */
+    RankInfo peer_rank;
+
     EventHandlerMetaData(
         ComponentId_t id, const std::string& cname, const std::string& ctype, const std::string& pname) :
         comp_id(id),
@@ -18,41 +18,61 @@
 DISABLE_WARN_MISSING_OVERRIDE
 #include <mpi.h>
 REENABLE_WARNING
+#define UNUSED_WO_MPI(x) x
+#else
+#define UNUSED_WO_MPI(x) UNUSED(x)
 #endif
 
 #include "sst/core/component.h"
 #include "sst/core/simulation_impl.h"
 #include "sst/core/stopAction.h"
 
+#include <algorithm>
+
 using SST::Core::ThreadSafe::Spinlock;
 
 namespace SST {
 
-Exit::Exit(int num_threads, bool single_rank) :
+struct Exit::PendingCheck
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    // Both values are reduced with MPI_MIN: whether every component
+    // on the rank is done (1) or not (0), and MAX_SIMTIME_T minus the
+    // end time of the rank, so the minimum gives the latest end time
+    uint64_t    input[2];
+    uint64_t    output[2];
+    MPI_Request request = MPI_REQUEST_NULL;
+#endif
+    bool active = false;
+};
+
+Exit::Exit(int num_threads, bool single_rank, bool UNUSED_WO_MPI(deferred_check)) :
     Action(),
     //     m_functor( new EventHandler<Exit,bool,Event*> (this,&Exit::handler ) ),
     num_threads(num_threads),
-    m_refCount(0),
+    m_threads(new ThreadState[num_threads]),
     end_time(0),
-    single_rank(single_rank)
+    single_rank(single_rank),
+    pending(nullptr)
 {
     setPriority(EXITPRIORITY);
-    m_thread_counts = new unsigned int[num_threads];
-    for ( int i = 0; i < num_threads; i++ ) {
-        m_thread_counts[i] = 0;
-    }
+#ifdef SST_CONFIG_HAVE_MPI
+    if ( deferred_check && !single_rank ) pending = new PendingCheck();
+#endif
 }
 
 Exit::~Exit()
 {
-    m_idSet.clear();
+    delete[] m_threads;
+    delete pending;
 }
 
 bool
 Exit::refInc(ComponentId_t id, uint32_t thread)
 {
-    std::lock_guard<Spinlock> lock(slock);
-    if ( m_idSet.find(id) != m_idSet.end() ) {
+    ThreadState&              state = m_threads[thread];
+    std::lock_guard<Spinlock> lock(state.lock);
+    if ( state.ids.find(id) != state.ids.end() ) {
         // CompMap_t comp_map = Simulation_impl::getSimulation()->getComponentMap();
         // bool found_in_map = false;
 
@@ -75,10 +95,8 @@ Exit::refInc(ComponentId_t id, uint32_t thread)
         return true;
     }
 
-    m_idSet.insert(id);
-
-    ++m_refCount;
-    ++m_thread_counts[thread];
+    state.ids.insert(id);
+    state.count.store(state.ids.size(), std::memory_order_relaxed);
 
     return false;
 }
@@ -86,32 +104,30 @@ Exit::refInc(ComponentId_t id, uint32_t thread)
 bool
 Exit::refDec(ComponentId_t id, uint32_t thread)
 {
-    std::lock_guard<Spinlock> lock(slock);
-    if ( m_idSet.find(id) == m_idSet.end() ) {
+    ThreadState&              state = m_threads[thread];
+    std::lock_guard<Spinlock> lock(state.lock);
+    if ( state.ids.find(id) == state.ids.end() ) {
         Simulation_impl::getSimulation()->getSimulationOutput().verbose(
             CALL_INFO, 1, 1, "component (%s) multiple decrement\n",
             Simulation_impl::getSimulation()->getComponent(id)->getName().c_str());
         return true;
     }
 
-    if ( m_refCount == 0 ) {
-        Simulation_impl::getSimulation()->getSimulationOutput().fatal(CALL_INFO, 1, "refCount is already 0\n");
-        return true;
-    }
+    state.ids.erase(id);
+    state.count.store(state.ids.size(), std::memory_order_relaxed);
 
-    m_idSet.erase(id);
+    if ( !state.ids.empty() ) return false;
 
-    --m_refCount;
-    --m_thread_counts[thread];
-
-    if ( single_rank && num_threads == 1 && m_refCount == 0 ) {
+    if ( single_rank && num_threads == 1 ) {
         end_time             = Simulation_impl::getSimulation()->getCurrentSimCycle();
         Simulation_impl* sim = Simulation_impl::getSimulation();
         sim->insertActivity(sim->getCurrentSimCycle() + 1, this);
     }
-    else if ( m_thread_counts[thread] == 0 ) {
+    else {
         SimTime_t end_time_new = Simulation_impl::getSimulation()->getCurrentSimCycle();
-        if ( end_time_new > end_time ) end_time = end_time_new;
+        if ( end_time_new > state.end_time.load(std::memory_order_relaxed) ) {
+            state.end_time.store(end_time_new, std::memory_order_relaxed);
+        }
         if ( Simulation_impl::getSimulation()->isIndependentThread() ) {
             // Need to exit just this thread, so we'll need to use a
             // StopAction
@@ -126,7 +142,21 @@ Exit::refDec(ComponentId_t id, uint32_t thread)
 unsigned int
 Exit::getRefCount()
 {
-    return m_refCount;
+    unsigned int count = 0;
+    for ( int i = 0; i < num_threads; i++ ) {
+        count += m_threads[i].count.load(std::memory_order_relaxed);
+    }
+    return count;
+}
+
+SimTime_t
+Exit::getEndTime()
+{
+    SimTime_t time = end_time;
+    for ( int i = 0; i < num_threads; i++ ) {
+        time = std::max(time, m_threads[i].end_time.load(std::memory_order_relaxed));
+    }
+    return time;
 }
 
 void
@@ -142,6 +172,7 @@ Exit::execute()
 SimTime_t
 Exit::computeEndTime()
 {
+    end_time = getEndTime();
 #ifdef SST_CONFIG_HAVE_MPI
     // Do an all_reduce to get the end_time
     SimTime_t end_value;
@@ -159,7 +190,37 @@ void
 Exit::check()
 {
     // TraceFunction trace(CALL_INFO_LONG);
-    int value = (m_refCount > 0);
+#ifdef SST_CONFIG_HAVE_MPI
+    if ( pending != nullptr ) {
+        // A rank that isn't done already knows the simulation can't
+        // end at this sync, so it only starts its part of the check
+        // and completes it at the next one.  Only the ranks that are
+        // done wait for the result, so the simulation still ends at
+        // the sync where every rank was done, the same as with the
+        // blocking check.  The end time comes with the votes, so it
+        // needs no reduction of its own.
+        if ( pending->active ) {
+            MPI_Wait(&pending->request, MPI_STATUS_IGNORE);
+            pending->active = false;
+        }
+        pending->input[0] = (getRefCount() == 0);
+        pending->input[1] = MAX_SIMTIME_T - getEndTime();
+        MPI_Iallreduce(pending->input, pending->output, 2, MPI_UINT64_T, MPI_MIN, MPI_COMM_WORLD, &pending->request);
+        global_count = 1;
+        if ( !pending->input[0] ) {
+            pending->active = true;
+            return;
+        }
+        MPI_Wait(&pending->request, MPI_STATUS_IGNORE);
+        if ( pending->output[0] ) {
+            global_count = 0;
+            end_time     = MAX_SIMTIME_T - pending->output[1];
+        }
+        return;
+    }
+#endif
+
+    int value = (getRefCount() > 0);
     int out;
 
 #ifdef SST_CONFIG_HAVE_MPI
@@ -186,4 +247,15 @@ Exit::check()
     // }
 }
 
+void
+Exit::finish()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    if ( pending != nullptr && pending->active ) {
+        MPI_Wait(&pending->request, MPI_STATUS_IGNORE);
+        pending->active = false;
+    }
+#endif
+}
+
 } // namespace SST
@@ -16,6 +16,7 @@
 #include "sst/core/sst_types.h"
 #include "sst/core/threadsafe.h"
 
+#include <atomic>
 #include <cinttypes>
 #include <unordered_set>
 
@@ -38,6 +39,8 @@ public:
      * Create a new ExitEvent
      * @param sim Simulation object
      * @param single_rank True if there are no parallel ranks
+     * @param deferred_check True to have ranks that aren't done
+     * complete each check at the next global sync instead of right away
      *
      *  Exit needs to register a handler during constructor time, which
      * requires a simulation object.  But the simulation class creates
@@ -47,7 +50,7 @@ public:
      * pointers" rule.  However, it still needs to follow the "classes
      * shouldn't contain pointers back to Simulation" rule.
      */
-    Exit(int num_threads, bool single_rank);
+    Exit(int num_threads, bool single_rank, bool deferred_check = false);
     ~Exit();
 
     /** Increment Reference Count for a given Component ID */
@@ -55,12 +58,16 @@ public:
     /** Decrement Reference Count for a given Component ID */
     bool refDec(ComponentId_t, uint32_t thread);
 
+    /** Number of primary components that have not said it is OK to
+     * end the simulation.  The counts of the threads are summed, so
+     * it is only exact at syncs.
+     */
     unsigned int getRefCount();
 
     /** Gets the end time of the simulation
      * @return Time when simulation ends
      */
-    SimTime_t getEndTime() { return end_time; }
+    SimTime_t getEndTime();
 
     /** Stores the time the simulation has ended
      * @param time Current simulation time
@@ -75,6 +82,10 @@ public:
     void      execute(void) override;
     void      check();
 
+    /** Complete a deferred check that is still in progress.  Must be
+     * called on all ranks after the run loop ends. */
+    void finish();
+
     /**
      * @param header String to preface the exit action log
      * @param out SST Output logger object
@@ -91,23 +102,40 @@ public:
     unsigned int getGlobalCount() { return global_count; }
 
 private:
-    Exit() {}                    // for serialization only
-    Exit(const Exit&);           // Don't implement
-    void operator=(Exit const&); // Don't implement
+    // Restores the reference counts when loading a checkpoint
+    friend class Simulation_impl;
+
+    Exit() : m_threads(nullptr), pending(nullptr) {} // for serialization only
+    Exit(const Exit&);             // Don't implement
+    void operator=(Exit const&);   // Don't implement
 
     //     bool handler( Event* );
 
     //     EventHandler< Exit, bool, Event* >* m_functor;
-    int                               num_threads;
-    unsigned int                      m_refCount;
-    unsigned int*                     m_thread_counts;
-    unsigned int                      global_count;
-    std::unordered_set<ComponentId_t> m_idSet;
-    SimTime_t                         end_time;
+    // Primary components of one thread that have not said it is OK to
+    // end the simulation.  Only the components of the thread change
+    // it, so the lock is only contended during parallel construction,
+    // and the threads are only summed when the counts are checked.
+    struct CACHE_ALIGNED_T ThreadState
+    {
+        Core::ThreadSafe::Spinlock        lock;
+        std::unordered_set<ComponentId_t> ids;
+        std::atomic<unsigned int>         count { 0 };
+        std::atomic<SimTime_t>            end_time { 0 }; // Last time count went to 0
+    };
 
-    Core::ThreadSafe::Spinlock slock;
+    int          num_threads;
+    ThreadState* m_threads;
+    unsigned int global_count;
+    SimTime_t    end_time;
 
     bool single_rank;
+
+    // Reduction of the votes and end times started by the last
+    // deferred check on a rank that wasn't done.  Only used with MPI
+    // and more than one rank.
+    struct PendingCheck;
+    PendingCheck* pending;
 };
 
 } // namespace SST
@@ -36,9 +36,12 @@
 #include "sst/core/statapi/statoutputhdf5.h"
 #endif
 #include "sst/core/statapi/stataccumulator.h"
+#include "sst/core/statapi/statapproxuniquecount.h"
 #include "sst/core/statapi/statbase.h"
+#include "sst/core/statapi/stathdrhistogram.h"
 #include "sst/core/statapi/stathistogram.h"
 #include "sst/core/statapi/statnull.h"
+#include "sst/core/statapi/statquantilesketch.h"
 #include "sst/core/statapi/statuniquecount.h"
 
 using namespace SST::Statistics;
@@ -47,6 +50,8 @@ namespace SST {
 
 Factory* Factory::instance = nullptr;
 
+thread_local std::string Factory::loadingComponentType;
+
 Factory::Factory(const std::string& searchPaths) : searchPaths(searchPaths), out(Output::getDefaultObject())
 {
     if ( instance ) out.fatal(CALL_INFO, 1, "Already initialized a factory.\n");
@@ -94,9 +99,30 @@ checkPort(const std::string& def, const std::string& offered)
     return true;
 }
 
+bool
+Factory::PortIndex::isValid(const std::string& port_name) const
+{
+    if ( names.count(port_name) ) return true;
+    for ( auto& p : patterns ) {
+        if ( checkPort(p, port_name) ) return true;
+    }
+    return false;
+}
+
 bool
 Factory::isPortNameValid(const std::string& type, const std::string& port_name)
 {
+    return getPortIndex(type)->isValid(port_name);
+}
+
+const Factory::PortIndex*
+Factory::getPortIndex(const std::string& type)
+{
+    std::lock_guard<std::recursive_mutex> lock(factoryMutex);
+
+    auto index = port_indexes.find(type);
+    if ( index != port_indexes.end() ) return &index->second;
+
     std::string elemlib, elem;
     std::tie(elemlib, elem) = parseLoadName(type);
     // ensure library is already loaded...
@@ -136,13 +162,19 @@ Factory::isPortNameValid(const std::string& type, const std::string& port_name)
         }
         std::cerr << err.str() << std::endl;
         out.fatal(CALL_INFO, 1, "can't find requested component or subcomponent '%s'\n ", tmp.c_str());
-        return false;
+        return nullptr;
     }
 
-    for ( auto p : *portNames ) {
-        if ( checkPort(p, port_name) ) return true;
+    // Index the ports so components with many of them don't do a
+    // linear search for each link
+    PortIndex& new_index = port_indexes[type];
+    for ( auto& p : *portNames ) {
+        if ( p == "*" || p.find('%') != std::string::npos ) { new_index.patterns.push_back(p); }
+        else {
+            new_index.names.insert(p);
+        }
     }
-    return false;
+    return &new_index;
 }
 
 const Params::KeySet_t&
@@ -187,35 +219,17 @@ Factory::getParamNames(const std::string& type)
 Component*
 Factory::CreateComponent(ComponentId_t id, const std::string& type, Params& params)
 {
-    std::string elemlib, elem;
-
-    std::tie(elemlib, elem) = parseLoadName(type);
-
-    // ensure library is already loaded...
+    // Components may be constructed by more than one thread, which
+    // only share the factory lock the first time they see a type
     std::stringstream sstr;
-    requireLibrary(elemlib, sstr);
-
-    std::lock_guard<std::recursive_mutex> lock(factoryMutex);
-    // Check to see if library is loaded into new
-    // ElementLibraryDatabase
-
-    auto* lib = ELI::InfoDatabase::getLibrary<Component>(elemlib);
-    if ( lib ) {
-        auto* compInfo = lib->getInfo(elem);
-        if ( compInfo ) {
-            auto* compLib = Component::getBuilderLibrary(elemlib);
-            if ( compLib ) {
-                auto* fact = compLib->getBuilder(elem);
-                if ( fact ) {
-                    loadingComponentType = type;
-                    params.pushAllowedKeys(compInfo->getParamNames());
-                    Component* ret = fact->create(id, params);
-                    params.popAllowedKeys();
-                    loadingComponentType = "";
-                    return ret;
-                }
-            }
-        }
+    auto              found = findBuilder<Component>(type, sstr);
+    if ( found.builder ) {
+        loadingComponentType = type;
+        params.pushAllowedKeys(found.info->getParamNames());
+        Component* ret = found.builder->create(id, params);
+        params.popAllowedKeys();
+        loadingComponentType = "";
+        return ret;
     }
     // If we make it to here, component not found
     out.fatal(CALL_INFO, 1, "can't find requested component '%s'\n%s\n", type.c_str(), sstr.str().c_str());
@@ -302,21 +316,16 @@ Factory::GetValidStatistics(const std::string& compType)
     return null_return; // to avoid compiler warnings
 }
 
-bool
-Factory::DoesComponentInfoStatisticNameExist(const std::string& compType, const std::string& statisticName)
-{
-    auto& my_list = GetValidStatistics(compType);
-    for ( auto& item : my_list ) {
-        if ( statisticName == item ) { return true; }
-    }
-    return false;
-}
-
-uint8_t
-Factory::GetComponentInfoStatisticEnableLevel(const std::string& type, const std::string& statisticName)
+const Factory::StatIndex*
+Factory::getStatIndex(const std::string& type)
 {
     std::string compTypeToLoad = type;
-    if ( true == type.empty() ) { compTypeToLoad = loadingComponentType; }
+    if ( type.empty() ) { compTypeToLoad = loadingComponentType; }
+
+    std::lock_guard<std::recursive_mutex> lock(factoryMutex);
+
+    auto index = stat_indexes.find(compTypeToLoad);
+    if ( index != stat_indexes.end() ) return &index->second;
 
     std::string elemlib, elem;
     std::tie(elemlib, elem) = parseLoadName(compTypeToLoad);
@@ -325,35 +334,49 @@ Factory::GetComponentInfoStatisticEnableLevel(const std::string& type, const std
     std::stringstream error_os;
     requireLibrary(elemlib, error_os);
 
-    std::lock_guard<std::recursive_mutex> lock(factoryMutex);
+    const std::vector<ElementInfoStatistic>* stats = nullptr;
 
-    // Check to see if library is loaded into new
-    // ElementLibraryDatabase
     auto* compLib = ELI::InfoDatabase::getLibrary<Component>(elemlib);
     if ( compLib ) {
         auto* info = compLib->getInfo(elem);
-        if ( info ) {
-            for ( auto& item : info->getValidStats() ) {
-                if ( statisticName == item.name ) { return item.enableLevel; }
-            }
+        if ( info ) { stats = &info->getValidStats(); }
+    }
+    if ( nullptr == stats ) {
+        auto* subLib = ELI::InfoDatabase::getLibrary<SubComponent>(elemlib);
+        if ( subLib ) {
+            auto* info = subLib->getInfo(elem);
+            if ( info ) { stats = &info->getValidStats(); }
         }
-        return 0;
     }
 
-    auto* subLib = ELI::InfoDatabase::getLibrary<SubComponent>(elemlib);
-    if ( subLib ) {
-        auto* info = subLib->getInfo(elem);
-        if ( info ) {
-            for ( auto& item : info->getValidStats() ) {
-                if ( statisticName == item.name ) { return item.enableLevel; }
-            }
-        }
-        return 0;
+    if ( nullptr == stats ) {
+        out.fatal(
+            CALL_INFO, 1, "can't find requested component/subcomponent '%s'\n%s\n", type.c_str(),
+            error_os.str().c_str());
+        return nullptr;
     }
 
-    // If we get to here, element doesn't exist
-    out.fatal(CALL_INFO, 1, "can't find requested component '%s'\n%s\n", type.c_str(), error_os.str().c_str());
-    return 0;
+    StatIndex& new_index = stat_indexes[compTypeToLoad];
+    for ( auto& item : *stats ) {
+        new_index.emplace(item.name, &item);
+    }
+    return &new_index;
+}
+
+bool
+Factory::DoesComponentInfoStatisticNameExist(const std::string& compType, const std::string& statisticName)
+{
+    const StatIndex* index = getStatIndex(compType);
+    return index->find(statisticName) != index->end();
+}
+
+uint8_t
+Factory::GetComponentInfoStatisticEnableLevel(const std::string& type, const std::string& statisticName)
+{
+    const StatIndex* index = getStatIndex(type);
+    auto             stat  = index->find(statisticName);
+    if ( stat == index->end() ) return 0;
+    return stat->second->enableLevel;
 }
 
 std::string
@@ -557,11 +580,19 @@ Factory::getLoadedLibraryNames(std::set<std::string>& lib_names)
 void
 Factory::loadUnloadedLibraries(const std::set<std::string>& lib_names)
 {
+    prefetchLibraries(lib_names);
     for ( std::set<std::string>::const_iterator i = lib_names.begin(); i != lib_names.end(); ++i ) {
         findLibrary(*i);
     }
 }
 
+void
+Factory::prefetchLibraries(const std::set<std::string>& lib_names)
+{
+    std::lock_guard<std::recursive_mutex> lock(factoryMutex);
+    loader->prefetchLibraries(lib_names);
+}
+
 bool
 Factory::findLibrary(const std::string& elemlib, std::ostream& err_os)
 {
@@ -19,6 +19,8 @@
 
 #include <mutex>
 #include <stdio.h>
+#include <unordered_map>
+#include <unordered_set>
 
 /* Forward declare for Friendship */
 extern int main(int argc, char** argv);
@@ -51,6 +53,26 @@ public:
      */
     bool isPortNameValid(const std::string& type, const std::string& port_name);
 
+    /** Port names from the ELI of an element, split into names to look
+     * up directly and names with %d wildcards that have to be matched
+     */
+    struct PortIndex
+    {
+        std::unordered_set<std::string> names;
+        std::vector<std::string>        patterns;
+
+        /** Check a port name.  Doesn't take the Factory lock. */
+        bool isValid(const std::string& port_name) const;
+    };
+
+    /** Get the port index for a given component type, so that many
+     * port names can be checked with a single lookup of the type.
+     * Can be called from multiple threads.
+     * @param type - Name of component in lib.name format
+     * @return Index that stays valid for the life of the Factory
+     */
+    const PortIndex* getPortIndex(const std::string& type);
+
     /** Get a list of allowed param keys for a given component type.
      * @param type - Name of component in lib.name format
      * @return True if this is a valid portname
@@ -86,25 +108,8 @@ public:
     template <class Base>
     bool isSubComponentLoadableUsingAPI(const std::string& type)
     {
-        std::string elemlib, elem;
-        std::tie(elemlib, elem) = parseLoadName(type);
-
-        requireLibrary(elemlib);
-        std::lock_guard<std::recursive_mutex> lock(factoryMutex);
-
-        auto* lib = ELI::InfoDatabase::getLibrary<Base>(elemlib);
-        if ( lib ) {
-            auto  map  = lib->getMap();
-            auto* info = lib->getInfo(elem);
-            if ( info ) {
-                auto* builderLib = Base::getBuilderLibrary(elemlib);
-                if ( builderLib ) {
-                    auto* fact = builderLib->getBuilder(elem);
-                    if ( fact ) { return true; }
-                }
-            }
-        }
-        return false;
+        std::stringstream err_os;
+        return findBuilder<Base>(type, err_os).builder != nullptr;
     }
 
     template <class Base, int index, class InfoType>
@@ -142,27 +147,9 @@ public:
     template <class Base, class... CtorArgs>
     Base* Create(const std::string& type, CtorArgs&&... args)
     {
-        std::string elemlib, elem;
-        std::tie(elemlib, elem) = parseLoadName(type);
-
         std::stringstream err_os;
-        requireLibrary(elemlib, err_os);
-        std::lock_guard<std::recursive_mutex> lock(factoryMutex);
-
-        auto* lib = ELI::InfoDatabase::getLibrary<Base>(elemlib);
-        if ( lib ) {
-            auto* info = lib->getInfo(elem);
-            if ( info ) {
-                auto* builderLib = Base::getBuilderLibrary(elemlib);
-                if ( builderLib ) {
-                    auto* fact = builderLib->getBuilder(elem);
-                    if ( fact ) {
-                        Base* ret = fact->create(std::forward<CtorArgs>(args)...);
-                        return ret;
-                    }
-                }
-            }
-        }
+        auto              found = findBuilder<Base>(type, err_os);
+        if ( found.builder ) { return found.builder->create(std::forward<CtorArgs>(args)...); }
         notFound(Base::ELI_baseName(), type, err_os.str());
         return nullptr;
     }
@@ -187,29 +174,13 @@ public:
     template <class Base, class... CtorArgs>
     Base* CreateWithParams(const std::string& type, SST::Params& params, CtorArgs&&... args)
     {
-        std::string elemlib, elem;
-        std::tie(elemlib, elem) = parseLoadName(type);
-
         std::stringstream err_os;
-        requireLibrary(elemlib, err_os);
-        std::lock_guard<std::recursive_mutex> lock(factoryMutex);
-
-        auto* lib = ELI::InfoDatabase::getLibrary<Base>(elemlib);
-        if ( lib ) {
-            auto  map  = lib->getMap();
-            auto* info = lib->getInfo(elem);
-            if ( info ) {
-                auto* builderLib = Base::getBuilderLibrary(elemlib);
-                if ( builderLib ) {
-                    auto* fact = builderLib->getBuilder(elem);
-                    if ( fact ) {
-                        params.pushAllowedKeys(info->getParamNames());
-                        Base* ret = fact->create(std::forward<CtorArgs>(args)...);
-                        params.popAllowedKeys();
-                        return ret;
-                    }
-                }
-            }
+        auto              found = findBuilder<Base>(type, err_os);
+        if ( found.builder ) {
+            params.pushAllowedKeys(found.info->getParamNames());
+            Base* ret = found.builder->create(std::forward<CtorArgs>(args)...);
+            params.popAllowedKeys();
+            return ret;
         }
         notFound(Base::ELI_baseName(), type, err_os.str());
         return nullptr;
@@ -266,6 +237,13 @@ public:
     void getLoadedLibraryNames(std::set<std::string>& lib_names);
     void loadUnloadedLibraries(const std::set<std::string>& lib_names);
 
+    /** Find and read the files of a set of libraries in parallel, so
+     * loading them later doesn't wait on the filesystem.  Libraries
+     * that are already loaded are skipped.
+     * @param lib_names - The names of the libraries
+     */
+    void prefetchLibraries(const std::set<std::string>& lib_names);
+
     /** Determine if a SubComponentSlot is defined in a components ElementInfoStatistic
      * @param type - The name of the component/subcomponent
      * @param slotName - The name of the SubComponentSlot
@@ -282,6 +260,17 @@ public:
 
     const std::vector<std::string>& GetValidStatistics(const std::string& compType);
 
+    /** Statistics from the ELI of an element, indexed by name */
+    typedef std::unordered_map<std::string, const ElementInfoStatistic*> StatIndex;
+
+    /** Get the statistic index for a given component type, so that
+     * statistics can be registered without searching the ELI each time.
+     * Can be called from multiple threads.
+     * @param type - Name of component in lib.name format
+     * @return Index that stays valid for the life of the Factory
+     */
+    const StatIndex* getStatIndex(const std::string& type);
+
     /** Get the enable level of a statistic defined in the component's ElementInfoStatistic
      * @param componentname - The name of the component
      * @param statisticName - The name of the statistic
@@ -324,13 +313,65 @@ private:
 
     std::set<std::string> loaded_libraries;
 
+    // Built the first time a port of the type is checked
+    std::unordered_map<std::string, PortIndex> port_indexes;
+    // Built the first time a statistic of the type is looked up
+    std::unordered_map<std::string, StatIndex> stat_indexes;
+
     std::string searchPaths;
 
     ElemLoader* loader;
-    std::string loadingComponentType;
+
+    // Type of the component being constructed by this thread
+    static thread_local std::string loadingComponentType;
 
     std::pair<std::string, std::string> parseLoadName(const std::string& wholename);
 
+    // ELI info and builder of an element type
+    template <class Base>
+    struct CachedBuilder
+    {
+        typename Base::BuilderInfo*                                                  info;
+        decltype(Base::getBuilderLibrary(std::string())->getBuilder(std::string())) builder;
+    };
+
+    /**
+     * Find the ELI info and builder of a type.  Each thread keeps the
+     * ones it has found, so creating more of a type is a hash lookup
+     * without the library lookups or the factory lock.  The builder is
+     * nullptr if the type isn't found, with the reason in err_os.
+     */
+    template <class Base>
+    CachedBuilder<Base> findBuilder(const std::string& type, std::ostream& err_os)
+    {
+        static thread_local std::unordered_map<std::string, CachedBuilder<Base>> cache;
+
+        auto cached = cache.find(type);
+        if ( cached != cache.end() ) return cached->second;
+
+        std::string elemlib, elem;
+        std::tie(elemlib, elem) = parseLoadName(type);
+
+        requireLibrary(elemlib, err_os);
+        std::lock_guard<std::recursive_mutex> lock(factoryMutex);
+
+        CachedBuilder<Base> found { nullptr, nullptr };
+        auto*               lib = ELI::InfoDatabase::getLibrary<Base>(elemlib);
+        if ( lib ) {
+            found.info = lib->getInfo(elem);
+            if ( found.info ) {
+                auto* builderLib = Base::getBuilderLibrary(elemlib);
+                if ( builderLib ) {
+                    found.builder = builderLib->getBuilder(elem);
+                    // Only types that were found are kept, a library
+                    // may still be loaded that provides the others
+                    if ( found.builder ) cache.emplace(type, found);
+                }
+            }
+        }
+        return found;
+    }
+
     std::recursive_mutex factoryMutex;
 
 protected:
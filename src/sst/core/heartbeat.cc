@@ -18,8 +18,11 @@
 #include "sst/core/simulation_impl.h"
 #include "sst/core/stringize.h"
 #include "sst/core/timeConverter.h"
+#include "sst/core/unitAlgebra.h"
 #include "sst/core/warnmacros.h"
 
+#include <algorithm>
+
 #ifdef SST_CONFIG_HAVE_MPI
 DISABLE_WARN_MISSING_OVERRIDE
 #include <mpi.h>
@@ -28,21 +31,81 @@ REENABLE_WARNING
 
 namespace SST {
 
-SimulatorHeartbeat::SimulatorHeartbeat(
-    Config* UNUSED(cfg), int this_rank, Simulation_impl* sim, TimeConverter* period) :
+#ifdef SST_CONFIG_HAVE_MPI
+struct SimulatorHeartbeat::Reduction
+{
+    Usage        local;
+    Usage        global;
+    UnitAlgebra  time;
+    MPI_Request  request;
+    MPI_Datatype type;
+    MPI_Op       op;
+    bool         pending;
+};
+
+// Whether each field of Usage is the max or the sum over the ranks
+static const bool     usage_is_max[] = { true, true, false, true, false, false };
+static const uint64_t usage_fields   = sizeof(usage_is_max) / sizeof(usage_is_max[0]);
+
+static void
+reduceUsage(void* in, void* inout, int* len, MPI_Datatype* UNUSED(type))
+{
+    const uint64_t* a = static_cast<const uint64_t*>(in);
+    uint64_t*       b = static_cast<uint64_t*>(inout);
+    for ( uint64_t i = 0; i < *len * usage_fields; ++i ) {
+        if ( usage_is_max[i % usage_fields] )
+            b[i] = std::max(a[i], b[i]);
+        else
+            b[i] += a[i];
+    }
+}
+#endif
+
+SimulatorHeartbeat::SimulatorHeartbeat(Config* cfg, int this_rank, Simulation_impl* sim, TimeConverter* period) :
     Action(),
     rank(this_rank),
-    m_period(period)
+    m_period(period),
+    print_mempool_stats(false),
+    reduction(nullptr)
 {
+#ifdef USE_MEMPOOL
+    print_mempool_stats = cfg->print_mempool_stats();
+#else
+    (void)cfg;
+#endif
     sim->insertActivity(period->getFactor(), this);
     if ( (0 == this_rank) ) { lastTime = sst_get_cpu_time(); }
     // if( (0 == this_rank) ) {
     //     sim->insertActivity( period->getFactor(), this );
     //     lastTime = sst_get_cpu_time();
     // }
+
+#ifdef SST_CONFIG_HAVE_MPI
+    static_assert(sizeof(Usage) == usage_fields * sizeof(uint64_t), "usage_is_max must match Usage");
+    if ( sim->getNumRanks().rank > 1 ) {
+        reduction          = new Reduction();
+        reduction->pending = false;
+        MPI_Type_contiguous(usage_fields, MPI_UINT64_T, &reduction->type);
+        MPI_Type_commit(&reduction->type);
+        MPI_Op_create(reduceUsage, 1 /* commutative */, &reduction->op);
+    }
+#endif
 }
 
-SimulatorHeartbeat::~SimulatorHeartbeat() {}
+SimulatorHeartbeat::~SimulatorHeartbeat()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    if ( reduction == nullptr ) return;
+    int finalized;
+    MPI_Finalized(&finalized);
+    if ( !finalized ) {
+        finish();
+        MPI_Op_free(&reduction->op);
+        MPI_Type_free(&reduction->type);
+    }
+    delete reduction;
+#endif
+}
 
 void
 SimulatorHeartbeat::execute(void)
@@ -63,57 +126,89 @@ SimulatorHeartbeat::execute(void)
     sim->insertActivity(next, this);
 
     // Print some resource usage
-    uint64_t local_max_tv_depth  = Simulation_impl::getSimulation()->getTimeVortexMaxDepth();
-    uint64_t global_max_tv_depth = 0;
-
-    uint64_t global_max_sync_data_size = 0, global_sync_data_size = 0;
+    Usage usage;
+    usage.max_tv_depth = sim->getTimeVortexMaxDepth();
 
     int64_t mempool_size      = 0;
     int64_t active_activities = 0;
     Core::MemPoolAccessor::getMemPoolUsage(mempool_size, active_activities);
-    uint64_t max_mempool_size, global_mempool_size, global_active_activities;
+    usage.max_mempool_size  = mempool_size;
+    usage.mempool_size      = mempool_size;
+    usage.active_activities = active_activities;
 
 #ifdef SST_CONFIG_HAVE_MPI
-    uint64_t local_sync_data_size = Simulation_impl::getSimulation()->getSyncQueueDataSize();
-
-    MPI_Allreduce(&local_max_tv_depth, &global_max_tv_depth, 1, MPI_UINT64_T, MPI_MAX, MPI_COMM_WORLD);
-    MPI_Allreduce(&local_sync_data_size, &global_max_sync_data_size, 1, MPI_UINT64_T, MPI_MAX, MPI_COMM_WORLD);
-    MPI_Allreduce(&local_sync_data_size, &global_sync_data_size, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
-    MPI_Allreduce(&mempool_size, &max_mempool_size, 1, MPI_UINT64_T, MPI_MAX, MPI_COMM_WORLD);
-    MPI_Allreduce(&mempool_size, &global_mempool_size, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
-    MPI_Allreduce(&active_activities, &global_active_activities, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
+    usage.max_sync_data_size = sim->getSyncQueueDataSize();
 #else
-    global_max_tv_depth       = local_max_tv_depth;
-    global_max_sync_data_size = 0;
-    global_max_sync_data_size = 0;
-    max_mempool_size          = mempool_size;
-    global_mempool_size       = mempool_size;
-    global_active_activities  = active_activities;
+    usage.max_sync_data_size = 0;
+#endif
+    usage.sync_data_size = usage.max_sync_data_size;
+
+    if ( reduction == nullptr ) {
+        if ( rank == 0 ) printUsage(usage);
+    }
+#ifdef SST_CONFIG_HAVE_MPI
+    else {
+        // The reduction started by the last heartbeat has had a whole
+        // period to finish, so this rarely waits
+        finish();
+        reduction->local = usage;
+        reduction->time  = sim->getElapsedSimTime();
+        MPI_Iallreduce(
+            &reduction->local, &reduction->global, 1, reduction->type, reduction->op, MPI_COMM_WORLD,
+            &reduction->request);
+        reduction->pending = true;
+    }
 #endif
 
+    if ( print_mempool_stats ) {
+        // The heartbeat only runs on thread 0, so the other threads
+        // may be allocating while the arenas are walked.  Only break
+        // usage down by class when this is the only thread on the rank.
+        RankInfo num_ranks = sim->getNumRanks();
+        if ( num_ranks.rank > 1 ) sim_output.output("\tMempool stats for rank %d:\n", rank);
+        Core::MemPoolAccessor::printMemPoolStats("\t", sim_output, num_ranks.thread == 1);
+    }
+}
+
+void
+SimulatorHeartbeat::finish()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    if ( reduction == nullptr || !reduction->pending ) return;
+    MPI_Wait(&reduction->request, MPI_STATUS_IGNORE);
+    reduction->pending = false;
     if ( rank == 0 ) {
-        std::string ua_str;
+        Simulation_impl::getSimulation()->getSimulationOutput().output(
+            "\tResource usage at simulated time %s:\n", reduction->time.toStringBestSI().c_str());
+        printUsage(reduction->global);
+    }
+#endif
+}
 
-        ua_str = format_string("%" PRIu64 "B", global_max_sync_data_size);
-        UnitAlgebra global_max_sync_data_size_ua(ua_str);
+void
+SimulatorHeartbeat::printUsage(const Usage& usage)
+{
+    Output&     sim_output = Simulation_impl::getSimulation()->getSimulationOutput();
+    std::string ua_str;
 
-        ua_str = format_string("%" PRIu64 "B", global_sync_data_size);
-        UnitAlgebra global_sync_data_size_ua(ua_str);
+    ua_str = format_string("%" PRIu64 "B", usage.max_sync_data_size);
+    UnitAlgebra global_max_sync_data_size_ua(ua_str);
 
-        ua_str = format_string("%" PRIu64 "B", max_mempool_size);
-        UnitAlgebra max_mempool_size_ua(ua_str);
+    ua_str = format_string("%" PRIu64 "B", usage.sync_data_size);
+    UnitAlgebra global_sync_data_size_ua(ua_str);
 
-        ua_str = format_string("%" PRIu64 "B", global_mempool_size);
-        UnitAlgebra global_mempool_size_ua(ua_str);
+    ua_str = format_string("%" PRIu64 "B", usage.max_mempool_size);
+    UnitAlgebra max_mempool_size_ua(ua_str);
 
-        sim_output.output("\tMax mempool usage:               %s\n", max_mempool_size_ua.toStringBestSI().c_str());
-        sim_output.output("\tGlobal mempool usage:            %s\n", global_mempool_size_ua.toStringBestSI().c_str());
-        sim_output.output("\tGlobal active activities         %" PRIu64 " activities\n", global_active_activities);
-        sim_output.output("\tMax TimeVortex depth:            %" PRIu64 " entries\n", global_max_tv_depth);
-        sim_output.output(
-            "\tMax Sync data size:              %s\n", global_max_sync_data_size_ua.toStringBestSI().c_str());
-        sim_output.output("\tGlobal Sync data size:           %s\n", global_sync_data_size_ua.toStringBestSI().c_str());
-    }
+    ua_str = format_string("%" PRIu64 "B", usage.mempool_size);
+    UnitAlgebra global_mempool_size_ua(ua_str);
+
+    sim_output.output("\tMax mempool usage:               %s\n", max_mempool_size_ua.toStringBestSI().c_str());
+    sim_output.output("\tGlobal mempool usage:            %s\n", global_mempool_size_ua.toStringBestSI().c_str());
+    sim_output.output("\tGlobal active activities         %" PRIu64 " activities\n", usage.active_activities);
+    sim_output.output("\tMax TimeVortex depth:            %" PRIu64 " entries\n", usage.max_tv_depth);
+    sim_output.output("\tMax Sync data size:              %s\n", global_max_sync_data_size_ua.toStringBestSI().c_str());
+    sim_output.output("\tGlobal Sync data size:           %s\n", global_sync_data_size_ua.toStringBestSI().c_str());
 }
 
 } // namespace SST
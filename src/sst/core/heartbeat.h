@@ -28,6 +28,10 @@ class TimeConverter;
 /**
   \class SimulatorHeartbeat
     An optional heartbeat to show progress in a simulation
+
+    With more than one rank, the resource usage of all the ranks is
+    reduced without blocking.  Each heartbeat starts a reduction and
+    prints the one started by the heartbeat before it.
 */
 class SimulatorHeartbeat : public Action
 {
@@ -38,15 +42,38 @@ public:
     SimulatorHeartbeat(Config* cfg, int this_rank, Simulation_impl* sim, TimeConverter* period);
     ~SimulatorHeartbeat();
 
+    /** Print the resource usage of the last heartbeat, if it is still
+     * being reduced.  Called by all ranks at the end of the run. */
+    void finish();
+
 private:
+    /** Resource usage of the ranks, combined with the max or sum of
+     * each field */
+    struct Usage
+    {
+        uint64_t max_tv_depth;
+        uint64_t max_sync_data_size;
+        uint64_t sync_data_size;
+        uint64_t max_mempool_size;
+        uint64_t mempool_size;
+        uint64_t active_activities;
+    };
+
+    // Reduction that is still in flight, defined with the MPI parts
+    struct Reduction;
+
+
     SimulatorHeartbeat() {};
     SimulatorHeartbeat(const SimulatorHeartbeat&);
 
     void           operator=(SimulatorHeartbeat const&);
     void           execute(void) override;
+    void           printUsage(const Usage& usage);
     int            rank;
     TimeConverter* m_period;
     double         lastTime;
+    bool           print_mempool_stats;
+    Reduction*     reduction;
 };
 
 } // namespace SST
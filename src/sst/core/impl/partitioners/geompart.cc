@@ -0,0 +1,159 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/partitioners/geompart.h"
+
+#include "sst/core/configGraph.h"
+#include "sst/core/output.h"
+#include "sst/core/warnmacros.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace std;
+
+namespace SST {
+namespace IMPL {
+namespace Partition {
+
+namespace {
+
+// Bits of each coordinate used for the curve, so a key fits in 63 bits
+const int CURVE_BITS = 21;
+
+/**
+   Position along a 3D Hilbert curve of a point with coordinates in
+   [0, 2^CURVE_BITS).  Uses the transpose form of J. Skilling,
+   "Programming the Hilbert curve", AIP Conf. Proc. 707, 2004.
+ */
+uint64_t
+hilbertKey(uint32_t x[3])
+{
+    const uint32_t top = 1u << (CURVE_BITS - 1);
+
+    // Inverse undo
+    for ( uint32_t q = top; q > 1; q >>= 1 ) {
+        uint32_t p = q - 1;
+        for ( int i = 0; i < 3; ++i ) {
+            if ( x[i] & q ) { x[0] ^= p; }
+            else {
+                uint32_t t = (x[0] ^ x[i]) & p;
+                x[0] ^= t;
+                x[i] ^= t;
+            }
+        }
+    }
+
+    // Gray encode
+    for ( int i = 1; i < 3; ++i )
+        x[i] ^= x[i - 1];
+    uint32_t t = 0;
+    for ( uint32_t q = top; q > 1; q >>= 1 ) {
+        if ( x[2] & q ) t ^= q - 1;
+    }
+    for ( int i = 0; i < 3; ++i )
+        x[i] ^= t;
+
+    // Interleave the bits, most significant first
+    uint64_t key = 0;
+    for ( int b = CURVE_BITS - 1; b >= 0; --b ) {
+        for ( int i = 0; i < 3; ++i )
+            key = (key << 1) | ((x[i] >> b) & 1);
+    }
+    return key;
+}
+
+} // namespace
+
+SSTGeometricPartition::SSTGeometricPartition(RankInfo world_size, RankInfo UNUSED(my_rank), int verbosity) :
+    SSTPartitioner(),
+    world_size(world_size)
+{
+    partOutput = new Output("GeometricPartition ", verbosity, 0, SST::Output::STDOUT);
+}
+
+SSTGeometricPartition::~SSTGeometricPartition()
+{
+    delete partOutput;
+}
+
+void
+SSTGeometricPartition::performPartition(PartitionGraph* graph)
+{
+    PartitionComponentMap_t& compMap = graph->getComponentMap();
+
+    partOutput->verbose(CALL_INFO, 1, 0, "Performing a geometric partition scheme for simulation model.\n");
+
+    std::vector<PartitionComponent*> comps;
+    comps.reserve(compMap.size());
+    for ( PartitionComponentMap_t::iterator compItr = compMap.begin(); compItr != compMap.end(); compItr++ ) {
+        comps.push_back(*compItr);
+    }
+    size_t n = comps.size();
+    if ( n == 0 ) return;
+
+    // Bounding box of the coordinates
+    double lo[3], hi[3];
+    for ( int d = 0; d < 3; ++d ) {
+        lo[d] = hi[d] = comps[0]->coords[d];
+    }
+    for ( auto comp : comps ) {
+        for ( int d = 0; d < 3; ++d ) {
+            lo[d] = std::min(lo[d], comp->coords[d]);
+            hi[d] = std::max(hi[d], comp->coords[d]);
+        }
+    }
+    if ( lo[0] == hi[0] && lo[1] == hi[1] && lo[2] == hi[2] ) {
+        partOutput->verbose(
+            CALL_INFO, 1, 0, "- All components are at the same coordinates, partitioning in component order\n");
+    }
+
+    // Scale every axis to the full curve resolution and order the
+    // components along the curve.  Ties are broken on position in the
+    // component map, which is in component order.
+    const double                             max_coord = double((1u << CURVE_BITS) - 1);
+    std::vector<std::pair<uint64_t, size_t>> order(n);
+    for ( size_t i = 0; i < n; ++i ) {
+        uint32_t x[3];
+        for ( int d = 0; d < 3; ++d ) {
+            double extent = hi[d] - lo[d];
+            x[d]          = extent > 0.0 ? uint32_t((comps[i]->coords[d] - lo[d]) / extent * max_coord) : 0;
+        }
+        order[i] = std::make_pair(hilbertKey(x), i);
+    }
+    std::sort(order.begin(), order.end());
+
+    // Cut the curve into pieces of equal weight, rank by rank.  If no
+    // component has a weight, count them instead.
+    double total = 0.0;
+    for ( auto comp : comps )
+        total += comp->weight;
+    bool     use_count = !(total > 0.0);
+    if ( use_count ) total = n;
+    uint32_t pieces = world_size.rank * world_size.thread;
+
+    double acc = 0.0;
+    for ( auto& x : order ) {
+        PartitionComponent* comp  = comps[x.second];
+        double              w     = use_count ? 1.0 : comp->weight;
+        uint32_t            piece = std::min(uint32_t((acc + w / 2) * pieces / total), pieces - 1);
+        comp->rank                = RankInfo(piece / world_size.thread, piece % world_size.thread);
+        acc += w;
+    }
+
+    partOutput->verbose(CALL_INFO, 1, 0, "Geometric partition scheme completed.\n");
+}
+
+} // namespace Partition
+} // namespace IMPL
+} // namespace SST
@@ -0,0 +1,76 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_PARTITONERS_GEOMPART_H
+#define SST_CORE_IMPL_PARTITONERS_GEOMPART_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/sstpart.h"
+
+namespace SST {
+
+class Output;
+
+namespace IMPL {
+namespace Partition {
+
+/**
+Performs a geometric partition of an SST simulation configuration,
+using the coordinates set on the components (see
+Component.setCoordinates() in the Python model).  The components are
+ordered along a Hilbert space filling curve through their coordinates,
+and the curve is cut into pieces of equal weight, one for each thread
+of each rank.  Since the pieces of a rank are next to each other on the
+curve, each rank gets a compact region of space, as does each of its
+threads.
+
+Only a sort of the components is needed, so this scales to very large
+models where graph partitioning takes too long.  It works well when
+the coordinates reflect how the components are connected, as in mesh
+and torus models.  Components with no coordinates are all at the
+origin, and end up partitioned in component order.
+*/
+class SSTGeometricPartition : public SST::Partition::SSTPartitioner
+{
+
+public:
+    SST_ELI_REGISTER_PARTITIONER(
+        SSTGeometricPartition,
+        "sst",
+        "geometric",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Partitions components by cutting a space filling curve through their coordinates into pieces of equal "
+        "weight.")
+
+private:
+    /** Number of ranks and threads in the simulation */
+    RankInfo world_size;
+    /** Output object to print partitioning information */
+    Output*  partOutput;
+
+public:
+    SSTGeometricPartition(RankInfo world_size, RankInfo my_rank, int verbosity);
+    ~SSTGeometricPartition();
+
+    /**
+       Performs a partition of an SST simulation configuration
+       \param graph The simulation configuration to partition
+    */
+    void performPartition(PartitionGraph* graph) override;
+
+    bool requiresConfigGraph() override { return false; }
+    bool spawnOnAllRanks() override { return false; }
+};
+
+} // namespace Partition
+} // namespace IMPL
+} // namespace SST
+#endif // SST_CORE_IMPL_PARTITONERS_GEOMPART_H
@@ -0,0 +1,560 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/partitioners/mlpart.h"
+
+#include "sst/core/configGraph.h"
+#include "sst/core/output.h"
+#include "sst/core/warnmacros.h"
+
+#include <algorithm>
+#include <deque>
+#include <numeric>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+namespace SST {
+namespace IMPL {
+namespace Partition {
+
+namespace {
+
+// Allowed imbalance between partitions
+const double BALANCE_TOLERANCE = 1.03;
+
+// Maximum number of refinement passes done at each level
+const int REFINE_PASSES = 8;
+
+const uint32_t UNMATCHED = UINT32_MAX;
+
+/** Weighted graph in compressed sparse row format */
+struct MLGraph
+{
+    std::vector<double>   vwgt;   // vertex weights
+    std::vector<size_t>   xadj;   // start of each vertex's edges (size n+1)
+    std::vector<uint32_t> adjncy; // edge end points
+    std::vector<double>   adjwgt; // edge weights
+
+    size_t size() const { return vwgt.size(); }
+
+    double totalWeight() const { return std::accumulate(vwgt.begin(), vwgt.end(), 0.0); }
+};
+
+/**
+   Collapse the graph using heavy edge matching.  Each vertex is
+   paired with the unmatched neighbor it shares the heaviest edge with,
+   as long as the combined weight stays below max_vwgt.  cmap is filled
+   with the coarse vertex each fine vertex maps to.
+ */
+void
+coarsen(const MLGraph& g, MLGraph& cg, std::vector<uint32_t>& cmap, double max_vwgt, std::mt19937& rng)
+{
+    size_t n = g.size();
+
+    // Visit the vertices in random order so the matching doesn't
+    // depend on component numbering
+    std::vector<uint32_t> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::shuffle(order.begin(), order.end(), rng);
+
+    std::vector<uint32_t> match(n, UNMATCHED);
+    std::vector<uint32_t> members; // fine vertices for each coarse vertex, two per entry
+    cmap.assign(n, 0);
+
+    uint32_t cn = 0;
+    for ( auto v : order ) {
+        if ( match[v] != UNMATCHED ) continue;
+
+        uint32_t best   = v;
+        double   best_w = -1.0;
+        for ( size_t j = g.xadj[v]; j < g.xadj[v + 1]; ++j ) {
+            uint32_t u = g.adjncy[j];
+            if ( match[u] != UNMATCHED || g.vwgt[v] + g.vwgt[u] > max_vwgt ) continue;
+            if ( g.adjwgt[j] > best_w ) {
+                best   = u;
+                best_w = g.adjwgt[j];
+            }
+        }
+        match[v]    = best;
+        match[best] = v;
+        cmap[v]     = cn;
+        cmap[best]  = cn;
+        members.push_back(v);
+        members.push_back(best);
+        cn++;
+    }
+
+    // Build the coarse graph, merging edges that now connect the same
+    // pair of coarse vertices
+    cg.vwgt.assign(cn, 0.0);
+    cg.xadj.assign(1, 0);
+    cg.adjncy.clear();
+    cg.adjwgt.clear();
+
+    std::vector<size_t> where(cn, SIZE_MAX);
+    for ( uint32_t c = 0; c < cn; ++c ) {
+        size_t start = cg.adjncy.size();
+        for ( int m = 0; m < 2; ++m ) {
+            uint32_t v = members[2 * c + m];
+            if ( m == 1 && v == members[2 * c] ) break;
+            cg.vwgt[c] += g.vwgt[v];
+            for ( size_t j = g.xadj[v]; j < g.xadj[v + 1]; ++j ) {
+                uint32_t cu = cmap[g.adjncy[j]];
+                if ( cu == c ) continue;
+                if ( where[cu] == SIZE_MAX ) {
+                    where[cu] = cg.adjncy.size();
+                    cg.adjncy.push_back(cu);
+                    cg.adjwgt.push_back(g.adjwgt[j]);
+                }
+                else {
+                    cg.adjwgt[where[cu]] += g.adjwgt[j];
+                }
+            }
+        }
+        for ( size_t j = start; j < cg.adjncy.size(); ++j ) {
+            where[cg.adjncy[j]] = SIZE_MAX;
+        }
+        cg.xadj.push_back(cg.adjncy.size());
+    }
+}
+
+/**
+   Compute a starting partition for the coarsest graph.  Vertices are
+   laid out in breadth first order, which keeps neighbors close
+   together, and the order is cut into k pieces with the target
+   fractions of the total weight.
+ */
+void
+initialPartition(const MLGraph& g, uint32_t k, const std::vector<double>& targets, std::vector<uint32_t>& part)
+{
+    size_t n     = g.size();
+    double total = g.totalWeight();
+
+    part.assign(n, 0);
+    std::vector<bool>     visited(n, false);
+    std::deque<uint32_t>  queue;
+    std::vector<uint32_t> order;
+    order.reserve(n);
+
+    for ( uint32_t s = 0; s < n; ++s ) {
+        if ( visited[s] ) continue;
+        visited[s] = true;
+        queue.push_back(s);
+        while ( !queue.empty() ) {
+            uint32_t v = queue.front();
+            queue.pop_front();
+            order.push_back(v);
+            for ( size_t j = g.xadj[v]; j < g.xadj[v + 1]; ++j ) {
+                uint32_t u = g.adjncy[j];
+                if ( !visited[u] ) {
+                    visited[u] = true;
+                    queue.push_back(u);
+                }
+            }
+        }
+    }
+
+    // Upper end of each piece
+    std::vector<double> bound(k);
+    double              sum = 0.0;
+    for ( uint32_t q = 0; q < k; ++q ) {
+        sum += targets[q];
+        bound[q] = sum * total;
+    }
+
+    double   acc = 0.0;
+    uint32_t p   = 0;
+    for ( auto v : order ) {
+        double mid = acc + g.vwgt[v] / 2;
+        while ( p < k - 1 && mid >= bound[p] )
+            p++;
+        part[v] = p;
+        acc += g.vwgt[v];
+    }
+}
+
+/**
+   Greedy boundary refinement.  Each vertex moves to the neighboring
+   partition it is most strongly connected to if that reduces the cut
+   and keeps the partition under its max_pw.  Vertices on overweight
+   partitions move even if it costs some cut.
+ */
+void
+refine(const MLGraph& g, uint32_t k, std::vector<uint32_t>& part, const std::vector<double>& max_pw)
+{
+    size_t n = g.size();
+
+    std::vector<double> pw(k, 0.0);
+    for ( size_t v = 0; v < n; ++v )
+        pw[part[v]] += g.vwgt[v];
+
+    std::vector<double>   conn(k, 0.0);
+    std::vector<uint32_t> touched;
+
+    for ( int pass = 0; pass < REFINE_PASSES; ++pass ) {
+        size_t moved = 0;
+        for ( uint32_t v = 0; v < n; ++v ) {
+            uint32_t own  = part[v];
+            double   vw   = g.vwgt[v];
+            bool     over = pw[own] > max_pw[own];
+
+            // Sum the edge weight to each neighboring partition
+            touched.clear();
+            for ( size_t j = g.xadj[v]; j < g.xadj[v + 1]; ++j ) {
+                uint32_t p = part[g.adjncy[j]];
+                if ( conn[p] == 0.0 ) touched.push_back(p);
+                conn[p] += g.adjwgt[j];
+            }
+
+            uint32_t best      = own;
+            double   best_gain = 0.0;
+            for ( auto q : touched ) {
+                if ( q == own || pw[q] + vw > max_pw[q] ) continue;
+                double gain = conn[q] - conn[own];
+                if ( gain > best_gain || (best == own && over) ||
+                     (best != own && gain == best_gain && max_pw[q] - pw[q] > max_pw[best] - pw[best]) ) {
+                    best      = q;
+                    best_gain = gain;
+                }
+                // Equal cut, but the move improves balance
+                else if ( best == own && gain == 0.0 && (pw[q] + vw) / max_pw[q] < pw[own] / max_pw[own] ) {
+                    best = q;
+                }
+            }
+
+            // Overweight with no neighboring partition that can take
+            // it, so give it to the partition with the most room
+            if ( over && best == own ) {
+                uint32_t roomiest = 0;
+                for ( uint32_t q = 1; q < k; ++q ) {
+                    if ( max_pw[q] - pw[q] > max_pw[roomiest] - pw[roomiest] ) roomiest = q;
+                }
+                if ( pw[roomiest] + vw <= max_pw[roomiest] ) best = roomiest;
+            }
+
+            for ( auto q : touched )
+                conn[q] = 0.0;
+
+            if ( best != own ) {
+                pw[own] -= vw;
+                pw[best] += vw;
+                part[v] = best;
+                moved++;
+            }
+        }
+        if ( moved == 0 ) break;
+    }
+}
+
+/** Multilevel k-way partition of g, giving each partition the target
+ * fraction of the total weight */
+void
+multilevelPartition(
+    const MLGraph& g, uint32_t k, const std::vector<double>& targets, std::vector<uint32_t>& part, std::mt19937& rng)
+{
+    if ( k <= 1 || g.size() <= k ) {
+        // Nothing to partition, or one vertex per partition at most
+        part.resize(g.size());
+        for ( size_t i = 0; i < g.size(); ++i )
+            part[i] = k <= 1 ? 0 : i;
+        return;
+    }
+
+    double total  = g.totalWeight();
+    double max_vw = *std::max_element(g.vwgt.begin(), g.vwgt.end());
+    std::vector<double> max_pw(k);
+    for ( uint32_t q = 0; q < k; ++q )
+        max_pw[q] = std::max(BALANCE_TOLERANCE * total * targets[q], total * targets[q] + max_vw);
+
+    // Coarsen until the graph is small enough to partition directly,
+    // or until it stops shrinking
+    size_t coarsen_to = std::max<size_t>(20 * k, 100);
+    double max_cvw    = std::max(1.5 * total / coarsen_to, max_vw);
+
+    std::deque<MLGraph>               levels;
+    std::deque<std::vector<uint32_t>> cmaps;
+    const MLGraph*                    cur = &g;
+    while ( cur->size() > coarsen_to ) {
+        levels.emplace_back();
+        cmaps.emplace_back();
+        coarsen(*cur, levels.back(), cmaps.back(), max_cvw, rng);
+        if ( levels.back().size() > 0.95 * cur->size() ) {
+            levels.pop_back();
+            cmaps.pop_back();
+            break;
+        }
+        cur = &levels.back();
+    }
+
+    std::vector<uint32_t> cpart;
+    initialPartition(*cur, k, targets, cpart);
+    refine(*cur, k, cpart, max_pw);
+
+    // Project the partition back to the original graph, refining at
+    // each level
+    while ( !levels.empty() ) {
+        levels.pop_back();
+        const MLGraph&         fine = levels.empty() ? g : levels.back();
+        std::vector<uint32_t>& cmap = cmaps.back();
+
+        std::vector<uint32_t> fpart(fine.size());
+        for ( size_t v = 0; v < fine.size(); ++v )
+            fpart[v] = cpart[cmap[v]];
+        cmaps.pop_back();
+
+        refine(fine, k, fpart, max_pw);
+        cpart.swap(fpart);
+    }
+    part.swap(cpart);
+}
+
+/** Build the subgraph of g made up of the vertices in verts */
+void
+inducedSubgraph(const MLGraph& g, const std::vector<uint32_t>& verts, MLGraph& sg)
+{
+    std::vector<uint32_t> local(g.size(), UNMATCHED);
+    for ( size_t i = 0; i < verts.size(); ++i )
+        local[verts[i]] = i;
+
+    sg.vwgt.resize(verts.size());
+    sg.xadj.assign(1, 0);
+    sg.adjncy.clear();
+    sg.adjwgt.clear();
+    for ( size_t i = 0; i < verts.size(); ++i ) {
+        uint32_t v = verts[i];
+        sg.vwgt[i] = g.vwgt[v];
+        for ( size_t j = g.xadj[v]; j < g.xadj[v + 1]; ++j ) {
+            uint32_t u = local[g.adjncy[j]];
+            if ( u == UNMATCHED ) continue;
+            sg.adjncy.push_back(u);
+            sg.adjwgt.push_back(g.adjwgt[j]);
+        }
+        sg.xadj.push_back(sg.adjncy.size());
+    }
+}
+
+/** Split the vertices verts of g into parts with the target fractions
+ * of their weight */
+std::vector<std::vector<uint32_t>>
+splitVertices(const MLGraph& g, const std::vector<uint32_t>& verts, const std::vector<double>& targets, std::mt19937& rng)
+{
+    MLGraph sg;
+    inducedSubgraph(g, verts, sg);
+    std::vector<uint32_t> part;
+    multilevelPartition(sg, targets.size(), targets, part, rng);
+
+    std::vector<std::vector<uint32_t>> parts(targets.size());
+    for ( size_t i = 0; i < verts.size(); ++i )
+        parts[part[i]].push_back(verts[i]);
+    return parts;
+}
+
+/** Targets for k parts of equal weight */
+std::vector<double>
+equalTargets(size_t k)
+{
+    return std::vector<double>(k, 1.0 / k);
+}
+
+/** List the members of each group, given the group of each member */
+std::vector<std::vector<uint32_t>>
+groupMembers(const std::vector<uint32_t>& group_of)
+{
+    std::vector<std::vector<uint32_t>> groups;
+    for ( uint32_t i = 0; i < group_of.size(); ++i ) {
+        if ( group_of[i] >= groups.size() ) groups.resize(group_of[i] + 1);
+        groups[group_of[i]].push_back(i);
+    }
+    // Group numbers may have gaps
+    groups.erase(
+        std::remove_if(
+            groups.begin(), groups.end(), [](const std::vector<uint32_t>& members) { return members.empty(); }),
+        groups.end());
+    return groups;
+}
+
+} // namespace
+
+SSTMultilevelPartition::SSTMultilevelPartition(RankInfo world_size, RankInfo UNUSED(my_rank), int verbosity) :
+    SSTPartitioner(),
+    world_size(world_size),
+    rank_node(world_size.rank),
+    thread_socket(world_size.thread, 0)
+{
+    partOutput = new Output("MultilevelPartition ", verbosity, 0, SST::Output::STDOUT);
+
+    // Until told otherwise, each rank is on its own node
+    std::iota(rank_node.begin(), rank_node.end(), 0);
+}
+
+SSTMultilevelPartition::~SSTMultilevelPartition()
+{
+    delete partOutput;
+}
+
+void
+SSTMultilevelPartition::setMachineLayout(
+    const std::vector<uint32_t>& rank_node, const std::vector<uint32_t>& thread_socket)
+{
+    if ( rank_node.size() == world_size.rank ) this->rank_node = rank_node;
+    if ( thread_socket.size() == world_size.thread ) this->thread_socket = thread_socket;
+}
+
+void
+SSTMultilevelPartition::performPartition(PartitionGraph* graph)
+{
+    PartitionComponentMap_t& compMap = graph->getComponentMap();
+    PartitionLinkMap_t&      linkMap = graph->getLinkMap();
+
+    partOutput->verbose(CALL_INFO, 1, 0, "Performing a multilevel partition scheme for simulation model.\n");
+
+    std::vector<PartitionComponent*> comps;
+    comps.reserve(compMap.size());
+    for ( PartitionComponentMap_t::iterator compItr = compMap.begin(); compItr != compMap.end(); compItr++ ) {
+        comps.push_back(*compItr);
+    }
+    size_t n = comps.size();
+    if ( n == 0 ) return;
+
+    // Find the two end points of each link by looking at which
+    // components list it.  The link itself may still refer to the
+    // original component IDs rather than the partition components.
+    LinkId_t max_link     = 0;
+    bool     have_traffic = false;
+    for ( auto it = linkMap.begin(); it != linkMap.end(); ++it ) {
+        max_link = std::max(max_link, it->id);
+        if ( it->traffic > 0.0 ) have_traffic = true;
+    }
+    std::vector<uint32_t> end0(linkMap.size() ? max_link + 1 : 0, UNMATCHED);
+    std::vector<std::pair<uint32_t, uint32_t>> edges;
+    std::vector<double>                        edge_wgt;
+    for ( uint32_t i = 0; i < n; ++i ) {
+        for ( auto id : comps[i]->links ) {
+            if ( end0[id] == UNMATCHED ) {
+                end0[id] = i;
+                continue;
+            }
+            if ( end0[id] == i ) continue;
+            // Edges are weighted by the traffic measured in an
+            // earlier run if there is any, otherwise by inverse
+            // latency.  Links with no measured traffic count as one
+            // event.
+            const PartitionLink& link = graph->getLink(id);
+            SimTime_t            lat  = std::max<SimTime_t>(1, link.getMinLatency());
+            edges.emplace_back(end0[id], i);
+            edge_wgt.push_back(have_traffic ? 1.0 + link.traffic : 1.0 / lat);
+        }
+    }
+
+    // Build the CSR graph, with each edge stored in both directions.
+    // Parallel links between the same components are left as separate
+    // edges; coarsening merges them.
+    MLGraph g;
+    g.vwgt.resize(n);
+    for ( uint32_t i = 0; i < n; ++i )
+        g.vwgt[i] = comps[i]->weight;
+
+    std::vector<size_t> degree(n, 0);
+    for ( auto& e : edges ) {
+        degree[e.first]++;
+        degree[e.second]++;
+    }
+    g.xadj.resize(n + 1);
+    g.xadj[0] = 0;
+    for ( size_t i = 0; i < n; ++i )
+        g.xadj[i + 1] = g.xadj[i] + degree[i];
+    g.adjncy.resize(g.xadj[n]);
+    g.adjwgt.resize(g.xadj[n]);
+    std::vector<size_t> fill(g.xadj.begin(), g.xadj.end() - 1);
+    for ( size_t e = 0; e < edges.size(); ++e ) {
+        uint32_t a = edges[e].first;
+        uint32_t b = edges[e].second;
+        g.adjncy[fill[a]]   = b;
+        g.adjwgt[fill[a]++] = edge_wgt[e];
+        g.adjncy[fill[b]]   = a;
+        g.adjwgt[fill[b]++] = edge_wgt[e];
+    }
+
+    // Fixed seed so the partition is repeatable
+    std::mt19937 rng(1);
+
+    // Partition across nodes, the ranks on each node, the sockets of
+    // each rank and the threads on each socket, so the most expensive
+    // cuts end up on the cheapest boundaries.  Nodes and sockets get
+    // weight in proportion to the number of ranks or threads on them.
+    std::vector<std::vector<uint32_t>> node_ranks     = groupMembers(rank_node);
+    std::vector<std::vector<uint32_t>> socket_threads = groupMembers(thread_socket);
+
+    std::vector<double> node_targets;
+    for ( auto& ranks : node_ranks )
+        node_targets.push_back(double(ranks.size()) / world_size.rank);
+    std::vector<double> socket_targets;
+    for ( auto& threads : socket_threads )
+        socket_targets.push_back(double(threads.size()) / world_size.thread);
+
+    std::vector<uint32_t> all(n);
+    std::iota(all.begin(), all.end(), 0);
+    auto node_verts = splitVertices(g, all, node_targets, rng);
+    for ( size_t i = 0; i < node_ranks.size(); ++i ) {
+        auto rank_verts = splitVertices(g, node_verts[i], equalTargets(node_ranks[i].size()), rng);
+        for ( size_t j = 0; j < node_ranks[i].size(); ++j ) {
+            auto socket_verts = splitVertices(g, rank_verts[j], socket_targets, rng);
+            for ( size_t s = 0; s < socket_threads.size(); ++s ) {
+                auto thread_verts = splitVertices(g, socket_verts[s], equalTargets(socket_threads[s].size()), rng);
+                for ( size_t t = 0; t < socket_threads[s].size(); ++t ) {
+                    for ( auto v : thread_verts[t] )
+                        comps[v]->rank = RankInfo(node_ranks[i][j], socket_threads[s][t]);
+                }
+            }
+        }
+    }
+
+    // Report the quality of the partition
+    SimTime_t min_node_lat   = MAX_SIMTIME_T;
+    SimTime_t min_rank_lat   = MAX_SIMTIME_T;
+    SimTime_t min_thread_lat = MAX_SIMTIME_T;
+    size_t    cut_links      = 0;
+    for ( size_t e = 0; e < edges.size(); ++e ) {
+        const RankInfo& a = comps[edges[e].first]->rank;
+        const RankInfo& b = comps[edges[e].second]->rank;
+        if ( a == b ) continue;
+        cut_links++;
+        SimTime_t lat = static_cast<SimTime_t>(1.0 / edge_wgt[e] + 0.5);
+        if ( a.rank == b.rank )
+            min_thread_lat = std::min(min_thread_lat, lat);
+        else if ( rank_node[a.rank] == rank_node[b.rank] )
+            min_rank_lat = std::min(min_rank_lat, lat);
+        else
+            min_node_lat = std::min(min_node_lat, lat);
+    }
+    partOutput->verbose(CALL_INFO, 1, 0, "- Links cut:                        %10zu\n", cut_links);
+    if ( min_node_lat != MAX_SIMTIME_T && node_ranks.size() < world_size.rank )
+        partOutput->verbose(
+            CALL_INFO, 1, 0, "- Min cross node latency:           %10" PRIu64 "\n", (uint64_t)min_node_lat);
+    else
+        min_rank_lat = std::min(min_rank_lat, min_node_lat);
+    if ( min_rank_lat != MAX_SIMTIME_T )
+        partOutput->verbose(
+            CALL_INFO, 1, 0, "- Min cross rank latency:           %10" PRIu64 "\n", (uint64_t)min_rank_lat);
+    if ( min_thread_lat != MAX_SIMTIME_T )
+        partOutput->verbose(
+            CALL_INFO, 1, 0, "- Min cross thread latency:         %10" PRIu64 "\n", (uint64_t)min_thread_lat);
+
+    partOutput->verbose(CALL_INFO, 1, 0, "Multilevel partition scheme completed.\n");
+}
+
+} // namespace Partition
+} // namespace IMPL
+} // namespace SST
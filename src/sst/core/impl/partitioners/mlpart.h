@@ -0,0 +1,91 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_PARTITONERS_MLPART_H
+#define SST_CORE_IMPL_PARTITONERS_MLPART_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/sstpart.h"
+
+#include <vector>
+
+namespace SST {
+
+class Output;
+
+namespace IMPL {
+namespace Partition {
+
+/**
+Performs a multilevel partition of an SST simulation configuration in
+the style of METIS.  The component graph is repeatedly coarsened by
+collapsing the most heavily weighted links, the small coarse graph is
+partitioned, and the partition is projected back through each level
+with a greedy boundary refinement pass at every step.
+
+Links are weighted by the inverse of their latency, so cutting a low
+latency link is much more expensive than cutting a high latency one.
+This keeps tightly coupled components together and raises the minimum
+latency between partitions, which is the lookahead used by the rank
+and thread synchronization.  Components are weighted by the weight set
+in the input file (see Component.setWeight() in the Python model), and
+the total weight on each partition is kept within a few percent of the
+average.
+
+The partition is hierarchical, so the most expensive cuts stay on the
+cheapest boundaries: components are split across nodes, then across
+the ranks on each node, then across the sockets the threads of a rank
+are pinned to (see --thread-affinity), and last across the threads on
+each socket.  Without a machine layout each rank is taken to be on its
+own node and all threads on one socket.
+*/
+class SSTMultilevelPartition : public SST::Partition::SSTPartitioner
+{
+
+public:
+    SST_ELI_REGISTER_PARTITIONER(
+        SSTMultilevelPartition,
+        "sst",
+        "multilevel",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Multilevel coarsen/partition/refine scheme that avoids cutting low latency links while balancing component "
+        "weights across ranks and threads.")
+
+private:
+    /** Number of ranks and threads in the simulation */
+    RankInfo              world_size;
+    /** Output object to print partitioning information */
+    Output*               partOutput;
+    /** Node of each rank */
+    std::vector<uint32_t> rank_node;
+    /** Socket of each thread */
+    std::vector<uint32_t> thread_socket;
+
+public:
+    SSTMultilevelPartition(RankInfo world_size, RankInfo my_rank, int verbosity);
+    ~SSTMultilevelPartition();
+
+    /**
+       Performs a partition of an SST simulation configuration
+       \param graph The simulation configuration to partition
+    */
+    void performPartition(PartitionGraph* graph) override;
+
+    void setMachineLayout(const std::vector<uint32_t>& rank_node, const std::vector<uint32_t>& thread_socket) override;
+
+    bool requiresConfigGraph() override { return false; }
+    bool spawnOnAllRanks() override { return false; }
+};
+
+} // namespace Partition
+} // namespace IMPL
+} // namespace SST
+#endif // SST_CORE_IMPL_PARTITONERS_MLPART_H
@@ -0,0 +1,120 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/partitioners/weightpart.h"
+
+#include "sst/core/configGraph.h"
+#include "sst/core/output.h"
+#include "sst/core/warnmacros.h"
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+
+using namespace std;
+
+namespace SST {
+namespace IMPL {
+namespace Partition {
+
+SSTWeightedPartition::SSTWeightedPartition(RankInfo world_size, RankInfo UNUSED(my_rank), int verbosity) :
+    SSTPartitioner(),
+    world_size(world_size)
+{
+    partOutput = new Output("WeightedPartition ", verbosity, 0, SST::Output::STDOUT);
+}
+
+SSTWeightedPartition::~SSTWeightedPartition()
+{
+    delete partOutput;
+}
+
+std::vector<uint32_t>
+SSTWeightedPartition::balance(const std::vector<PartitionComponent*>& comps, uint32_t nbins, std::vector<double>& load)
+{
+    // Visit the components heaviest first.  Ties are broken on
+    // component id so the partition is deterministic.
+    std::vector<size_t> order(comps.size());
+    for ( size_t i = 0; i < order.size(); ++i )
+        order[i] = i;
+    std::stable_sort(order.begin(), order.end(), [&comps](size_t a, size_t b) {
+        return comps[a]->weight > comps[b]->weight;
+    });
+
+    // Min heap of (load, bin) so the least loaded bin is always on
+    // top.  Using the bin index as the second key makes bins with
+    // equal load fill in order.
+    typedef std::pair<double, uint32_t> bin_t;
+    std::priority_queue<bin_t, std::vector<bin_t>, std::greater<bin_t>> bins;
+    for ( uint32_t i = 0; i < nbins; ++i )
+        bins.push(bin_t(0.0, i));
+
+    std::vector<uint32_t> assignment(comps.size());
+    for ( auto i : order ) {
+        bin_t bin = bins.top();
+        bins.pop();
+        assignment[i] = bin.second;
+        bin.first += comps[i]->weight;
+        bins.push(bin);
+    }
+
+    load.assign(nbins, 0.0);
+    while ( !bins.empty() ) {
+        load[bins.top().second] = bins.top().first;
+        bins.pop();
+    }
+    return assignment;
+}
+
+void
+SSTWeightedPartition::performPartition(PartitionGraph* graph)
+{
+    PartitionComponentMap_t& compMap = graph->getComponentMap();
+
+    partOutput->verbose(CALL_INFO, 1, 0, "Performing a weighted partition scheme for simulation model.\n");
+
+    std::vector<PartitionComponent*> comps;
+    comps.reserve(compMap.size());
+    for ( PartitionComponentMap_t::iterator compItr = compMap.begin(); compItr != compMap.end(); compItr++ ) {
+        comps.push_back(*compItr);
+    }
+
+    // First balance across ranks
+    std::vector<double>   rank_load;
+    std::vector<uint32_t> rank_assignment = balance(comps, world_size.rank, rank_load);
+
+    // Then balance the components on each rank across its threads
+    std::vector<std::vector<PartitionComponent*>> rank_comps(world_size.rank);
+    for ( size_t i = 0; i < comps.size(); ++i ) {
+        rank_comps[rank_assignment[i]].push_back(comps[i]);
+    }
+
+    for ( uint32_t r = 0; r < world_size.rank; ++r ) {
+        std::vector<double>   thread_load;
+        std::vector<uint32_t> thread_assignment = balance(rank_comps[r], world_size.thread, thread_load);
+        for ( size_t i = 0; i < rank_comps[r].size(); ++i ) {
+            rank_comps[r][i]->rank = RankInfo(r, thread_assignment[i]);
+        }
+
+        for ( uint32_t t = 0; t < world_size.thread; ++t ) {
+            partOutput->verbose(
+                CALL_INFO, 2, 0, "- Rank %" PRIu32 ", thread %" PRIu32 " weight: %f\n", r, t, thread_load[t]);
+        }
+    }
+
+    partOutput->verbose(CALL_INFO, 1, 0, "Weighted partition scheme completed.\n");
+}
+
+} // namespace Partition
+} // namespace IMPL
+} // namespace SST
@@ -0,0 +1,83 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_PARTITONERS_WEIGHTPART_H
+#define SST_CORE_IMPL_PARTITONERS_WEIGHTPART_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/sstpart.h"
+
+#include <vector>
+
+namespace SST {
+
+class Output;
+class PartitionComponent;
+
+namespace IMPL {
+namespace Partition {
+
+/**
+Performs a load balancing partition of an SST simulation configuration
+using the per-component weights set in the input file (see
+Component.setWeight() in the Python model).  Components are placed
+heaviest first onto the least loaded rank (longest processing time
+first), and then the components on each rank are spread across that
+rank's threads in the same way.  Because every thread waits at the
+end of each synchronization window for the slowest thread, weights
+that reflect the measured cost of each component (for example, the
+per-component times reported by the event handler profile tool on a
+previous run) give much shorter barrier waits than partitioning on
+component count alone.  Links are not considered, so this scheme works
+best for models where computation rather than communication dominates.
+*/
+class SSTWeightedPartition : public SST::Partition::SSTPartitioner
+{
+
+public:
+    SST_ELI_REGISTER_PARTITIONER(
+        SSTWeightedPartition,
+        "sst",
+        "weighted",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Partitions components so that the sum of component weights is balanced across ranks and threads.  "
+        "Use Component.setWeight() to provide measured per-component cost.")
+
+private:
+    /** Number of ranks and threads in the simulation */
+    RankInfo world_size;
+    /** Output object to print partitioning information */
+    Output*  partOutput;
+
+    /** Assign each of the components to one of nbins bins, heaviest
+        first onto the least loaded bin.  Returns the bin index for
+        each component in the same order as comps. */
+    std::vector<uint32_t>
+    balance(const std::vector<PartitionComponent*>& comps, uint32_t nbins, std::vector<double>& load);
+
+public:
+    SSTWeightedPartition(RankInfo world_size, RankInfo my_rank, int verbosity);
+    ~SSTWeightedPartition();
+
+    /**
+       Performs a partition of an SST simulation configuration
+       \param graph The simulation configuration to partition
+    */
+    void performPartition(PartitionGraph* graph) override;
+
+    bool requiresConfigGraph() override { return false; }
+    bool spawnOnAllRanks() override { return false; }
+};
+
+} // namespace Partition
+} // namespace IMPL
+} // namespace SST
+#endif // SST_CORE_IMPL_PARTITONERS_WEIGHTPART_H
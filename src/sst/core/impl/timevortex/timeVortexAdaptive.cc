@@ -0,0 +1,228 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#include "sst_config.h"
+
+#include "sst/core/impl/timevortex/timeVortexAdaptive.h"
+
+#include "sst/core/factory.h"
+#include "sst/core/output.h"
+#include "sst/core/simulation_runloop.h"
+
+#include <vector>
+
+namespace SST {
+namespace IMPL {
+
+template <bool TS>
+TimeVortexAdaptiveBase<TS>::TimeVortexAdaptiveBase(Params& params) :
+    TimeVortex(),
+    pops(0),
+    times(0),
+    last_time(0),
+    moves(0)
+{
+    dispersed_type = params.find<std::string>("dispersed", "sst.timevortex.priority_queue");
+    batched_type   = params.find<std::string>("batched", "sst.timevortex.ring.binned");
+    to_batched     = params.find<double>("batched_threshold", 4.0);
+    to_dispersed   = params.find<double>("dispersed_threshold", 1.5);
+    window         = params.find<uint64_t>("window", 4096);
+
+    if ( window == 0 || to_dispersed >= to_batched ) {
+        Output::getDefaultObject().fatal(
+            CALL_INFO, 1,
+            "ERROR: TimeVortexAdaptive needs a window greater than 0 and dispersed_threshold less than "
+            "batched_threshold\n");
+    }
+
+    // Both are only touched by the owner of this TimeVortex, or with
+    // slock held, so neither needs to be thread safe
+    dispersed = Factory::getFactory()->Create<TimeVortex>(dispersed_type, params);
+    batched   = Factory::getFactory()->Create<TimeVortex>(batched_type, params);
+    current   = dispersed;
+}
+
+template <bool TS>
+TimeVortexAdaptiveBase<TS>::~TimeVortexAdaptiveBase()
+{
+    delete dispersed;
+    delete batched;
+}
+
+template <bool TS>
+bool
+TimeVortexAdaptiveBase<TS>::empty()
+{
+    if ( TS ) slock.lock();
+    auto ret = current->empty();
+    if ( TS ) slock.unlock();
+    return ret;
+}
+
+template <bool TS>
+int
+TimeVortexAdaptiveBase<TS>::size()
+{
+    if ( TS ) slock.lock();
+    auto ret = current->size();
+    if ( TS ) slock.unlock();
+    return ret;
+}
+
+template <bool TS>
+void
+TimeVortexAdaptiveBase<TS>::insert(Activity* activity)
+{
+    if ( TS ) slock.lock();
+    current->insert(activity);
+    if ( TS ) slock.unlock();
+}
+
+template <bool TS>
+void
+TimeVortexAdaptiveBase<TS>::insertBatch(Activity** begin, Activity** end)
+{
+    if ( TS ) slock.lock();
+    current->insertBatch(begin, end);
+    if ( TS ) slock.unlock();
+}
+
+template <bool TS>
+Activity*
+TimeVortexAdaptiveBase<TS>::pop()
+{
+    if ( TS ) slock.lock();
+    Activity* ret = current->pop();
+    if ( ret != nullptr ) {
+        if ( pops == 0 || ret->getDeliveryTime() != last_time ) {
+            last_time = ret->getDeliveryTime();
+            times++;
+        }
+        if ( ++pops == window ) evaluate();
+    }
+    if ( TS ) slock.unlock();
+    return ret;
+}
+
+template <bool TS>
+Activity*
+TimeVortexAdaptiveBase<TS>::front()
+{
+    if ( TS ) slock.lock();
+    auto ret = current->front();
+    if ( TS ) slock.unlock();
+    return ret;
+}
+
+template <bool TS>
+void
+TimeVortexAdaptiveBase<TS>::compact()
+{
+    if ( TS ) slock.lock();
+    current->compact();
+    if ( TS ) slock.unlock();
+}
+
+template <bool TS>
+void
+TimeVortexAdaptiveBase<TS>::evaluate()
+{
+    double per_time = (double)pops / (double)times;
+    pops            = 0;
+    times           = 0;
+
+    TimeVortex* target = current;
+    if ( current == dispersed && per_time >= to_batched )
+        target = batched;
+    else if ( current == batched && per_time <= to_dispersed )
+        target = dispersed;
+    if ( target == current ) return;
+
+    // Popping everything out in order and inserting it as a batch
+    // keeps the order, since each TimeVortex breaks ties by insertion
+    // order
+    std::vector<Activity*> pending;
+    pending.reserve(current->getCurrentDepth());
+    while ( !current->empty() ) {
+        pending.push_back(current->pop());
+    }
+    target->insertBatch(pending.data(), pending.data() + pending.size());
+    current = target;
+    moves++;
+}
+
+template <bool TS>
+void
+TimeVortexAdaptiveBase<TS>::print(Output& out) const
+{
+    out.output(
+        "TimeVortex using %s (moved %" PRIu64 " times):\n",
+        current == dispersed ? dispersed_type.c_str() : batched_type.c_str(), moves);
+    current->print(out);
+}
+
+
+class TimeVortexAdaptive : public TimeVortexAdaptiveBase<false>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexAdaptive,
+        "sst",
+        "timevortex.adaptive",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "[EXPERIMENTAL] TimeVortex that switches between a priority queue and a binned queue based on how many activities share each delivery time.")
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {"dispersed", "TimeVortex used when activities have dispersed delivery times", "sst.timevortex.priority_queue"},
+        {"batched", "TimeVortex used when many activities share a delivery time", "sst.timevortex.ring.binned"},
+        {"batched_threshold", "Average activities per delivery time at which to move to the batched TimeVortex", "4.0"},
+        {"dispersed_threshold", "Average activities per delivery time at which to move to the dispersed TimeVortex", "1.5"},
+        {"window", "Number of pops between checks of the workload", "4096"}
+    )
+
+    TimeVortexAdaptive(Params& params) : TimeVortexAdaptiveBase<false>(params) {}
+    ~TimeVortexAdaptive() {}
+    SST_ELI_EXPORT(TimeVortexAdaptive)
+};
+
+class TimeVortexAdaptive_ts : public TimeVortexAdaptiveBase<true>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexAdaptive_ts,
+        "sst",
+        "timevortex.adaptive.ts",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "[EXPERIMENTAL] Thread safe verion of TimeVortex that switches between a priority queue and a binned queue based on how many activities share each delivery time.  Do not reference this element directly, just specify sst.timevortex.adaptive and this version will be selected when it is needed based on other parameters.")
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {"dispersed", "TimeVortex used when activities have dispersed delivery times", "sst.timevortex.priority_queue"},
+        {"batched", "TimeVortex used when many activities share a delivery time", "sst.timevortex.ring.binned"},
+        {"batched_threshold", "Average activities per delivery time at which to move to the batched TimeVortex", "4.0"},
+        {"dispersed_threshold", "Average activities per delivery time at which to move to the dispersed TimeVortex", "1.5"},
+        {"window", "Number of pops between checks of the workload", "4096"}
+    )
+
+    TimeVortexAdaptive_ts(Params& params) : TimeVortexAdaptiveBase<true>(params) {}
+    ~TimeVortexAdaptive_ts() {}
+    SST_ELI_EXPORT(TimeVortexAdaptive_ts)
+};
+
+} // namespace IMPL
+
+// Run loops with the calls to these TimeVortices inlined
+template bool Simulation_impl::runLoop<IMPL::TimeVortexAdaptiveBase<false>>();
+template bool Simulation_impl::runLoop<IMPL::TimeVortexAdaptiveBase<true>>();
+
+} // namespace SST
@@ -0,0 +1,94 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXADAPTIVE_H
+#define SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXADAPTIVE_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/threadsafe.h"
+#include "sst/core/timeVortex.h"
+
+#include <algorithm>
+#include <string>
+
+namespace SST {
+
+class Output;
+
+namespace IMPL {
+
+/**
+ * Primary Event Queue that picks its implementation from the
+ * workload.  Activities are kept in one of two TimeVortices: one for
+ * dispersed delivery times (a priority queue by default) and one for
+ * many activities at the same time (a binned queue by default).  The
+ * average number of activities popped per delivery time is checked
+ * every window of pops, and when it moves past a threshold the
+ * contents are moved over to the other TimeVortex.  Moving preserves
+ * the order of the activities, and the thresholds are far enough
+ * apart that the queue doesn't bounce between the two.
+ */
+template <bool TS>
+class TimeVortexAdaptiveBase : public TimeVortex
+{
+
+public:
+    TimeVortexAdaptiveBase(Params& params);
+    ~TimeVortexAdaptiveBase();
+
+    bool      empty() override;
+    int       size() override;
+    void      insert(Activity* activity) override;
+    void      insertBatch(Activity** begin, Activity** end) override;
+    Activity* pop() override;
+    Activity* front() override;
+
+    /** Print the state of the TimeVortex */
+    void print(Output& out) const override;
+
+    uint64_t getCurrentDepth() const override { return current->getCurrentDepth(); }
+    uint64_t getMaxDepth() const override { return std::max(dispersed->getMaxDepth(), batched->getMaxDepth()); }
+
+    void compact() override;
+
+private:
+    /** Check the last window of pops and move to the other
+     * TimeVortex if it suits them better.  Must be called with slock
+     * held. */
+    void evaluate();
+
+    TimeVortex* dispersed;
+    TimeVortex* batched;
+    TimeVortex* current;
+
+    std::string dispersed_type;
+    std::string batched_type;
+
+    // Pops per delivery time needed to move to each TimeVortex
+    double to_batched;
+    double to_dispersed;
+
+    // Pops and distinct delivery times seen in the current window
+    uint64_t  window;
+    uint64_t  pops;
+    uint64_t  times;
+    SimTime_t last_time;
+
+    uint64_t moves;
+
+    CACHE_ALIGNED(SST::Core::ThreadSafe::Spinlock, slock);
+};
+
+} // namespace IMPL
+} // namespace SST
+
+#endif // SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXADAPTIVE_H
@@ -36,12 +36,19 @@ TimeVortexBinnedMapBase<TS>::TimeUnit::sort()
     sorted = true;
 }
 
+template <bool TS>
+Activity*
+TimeVortexBinnedMapBase<TS>::TimeUnit::first() const
+{
+    // The activity sort() would put at the back
+    return *std::max_element(activities.begin(), activities.end(), my_less);
+}
+
 
 template <bool TS>
-TimeVortexBinnedMapBase<TS>::TimeVortexBinnedMapBase(Params& UNUSED(params)) :
+TimeVortexBinnedMapBase<TS>::TimeVortexBinnedMapBase(Params& params) :
     TimeVortex(),
-    insertOrder(0),
-    current_depth(0)
+    counters(params.find<size_t>("thread_count", 1))
 {
     max_depth = 0;
 
@@ -63,31 +70,29 @@ template <bool TS>
 bool
 TimeVortexBinnedMapBase<TS>::empty()
 {
-    if ( TS ) slock.lock();
-    bool ret = current_depth == 0;
-    if ( TS ) slock.unlock();
-    return ret;
+    return counters.getDepth() == 0;
 }
 
 template <bool TS>
 int
 TimeVortexBinnedMapBase<TS>::size()
 {
-    return current_depth;
+    return counters.getDepth();
 }
 
 template <bool TS>
 void
 TimeVortexBinnedMapBase<TS>::insert(Activity* activity)
 {
-    activity->setQueueOrder(insertOrder++);
+    counters.setQueueOrder(activity);
     SimTime_t sort_time = activity->getDeliveryTime();
 
-    current_depth++;
+    counters.addDepth(1);
 
-    // This is not really thread safe, but it's only used for stats,
-    // so is okay if it misses something.
-    if ( UNLIKELY(current_depth > max_depth) ) { max_depth = current_depth; }
+    // The thread safe depth is a sum over all the producers, so it is
+    // only checked by the owning thread when it moves to the next
+    // TimeUnit.
+    if ( !TS ) updateMaxDepth();
 
     // Check to see if this event is supposed to be delivered at the
     // current time.  This can only happen if it comes in on a
@@ -121,16 +126,64 @@ TimeVortexBinnedMapBase<TS>::insert(Activity* activity)
     }
 }
 
+template <bool TS>
+typename TimeVortexBinnedMapBase<TS>::TimeUnit*
+TimeVortexBinnedMapBase<TS>::getTimeUnit(SimTime_t sort_time)
+{
+    if ( UNLIKELY(sort_time == current_time_unit->getSortTime()) ) return current_time_unit;
+
+    if ( TS ) slock.lock();
+    TimeUnit* ret;
+    auto      element = map.find(sort_time);
+    if ( element == map.end() ) {
+        ret = pool.remove();
+        ret->setSortTime(sort_time);
+        map.emplace_hint(map.end(), sort_time, ret);
+    }
+    else {
+        ret = element->second;
+    }
+    if ( TS ) slock.unlock();
+    return ret;
+}
+
+template <bool TS>
+void
+TimeVortexBinnedMapBase<TS>::insertBatch(Activity** begin, Activity** end)
+{
+    // Queue order reflects the order the batch was handed to us, so
+    // set it before grouping the batch by delivery time
+    counters.setQueueOrder(begin, end);
+    std::sort(begin, end, Activity::less<true, false, false>());
+
+    counters.addDepth(end - begin);
+    if ( !TS ) updateMaxDepth();
+
+    // One map lookup per distinct delivery time in the batch
+    Activity** run = begin;
+    while ( run != end ) {
+        SimTime_t  sort_time = (*run)->getDeliveryTime();
+        Activity** run_end   = run + 1;
+        while ( run_end != end && (*run_end)->getDeliveryTime() == sort_time ) {
+            ++run_end;
+        }
+        getTimeUnit(sort_time)->insert(run, run_end);
+        run = run_end;
+    }
+}
+
 template <bool TS>
 Activity*
 TimeVortexBinnedMapBase<TS>::pop()
 {
-    if ( current_depth == 0 ) return nullptr;
-    current_depth--;
-
     Activity* ret = current_time_unit->pop();
     if ( ret == nullptr ) {
         if ( TS ) slock.lock();
+        if ( map.empty() ) {
+            if ( TS ) slock.unlock();
+            return nullptr;
+        }
+        if ( TS ) updateMaxDepth();
         // Need to get the next TimeUnit
 
         // Return current time unit to pool
@@ -142,6 +195,7 @@ TimeVortexBinnedMapBase<TS>::pop()
         if ( TS ) slock.unlock();
         ret = current_time_unit->pop();
     }
+    counters.addDepth(-1);
     return ret;
 }
 
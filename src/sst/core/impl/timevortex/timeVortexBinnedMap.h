@@ -12,6 +12,8 @@
 #ifndef SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXBINNEDMAP_H
 #define SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXBINNEDMAP_H
 
+#include "sst/core/impl/timevortex/timeVortexCounters.h"
+
 #include <atomic>
 #include <queue>
 #include <sst/core/timeVortex.h>
@@ -91,6 +93,15 @@ private:
             if ( TS ) tu_lock.unlock();
         }
 
+        // Insert a run of activities with the same delivery time
+        void insert(Activity** begin, Activity** end)
+        {
+            if ( TS ) tu_lock.lock();
+            activities.insert(activities.end(), begin, end);
+            sorted = false;
+            if ( TS ) tu_lock.unlock();
+        }
+
         // pop only happens by one thread
         Activity* pop()
         {
@@ -101,15 +112,17 @@ private:
             return ret;
         }
 
-        // front only happens by one thread
+        // front can be called by other threads while the owner is
+        // waiting at a sync, so it can't sort
         Activity* front()
         {
             if ( 0 == activities.size() ) return nullptr;
-            if ( !sorted ) sort();
-            return activities.back();
+            if ( sorted ) return activities.back();
+            return first();
         }
 
-        void sort();
+        void      sort();
+        Activity* first() const;
 
         inline bool operator<(const TimeUnit& rhs) { return this->sort_time < rhs.sort_time; }
 
@@ -133,6 +146,7 @@ public:
     bool      empty() override;
     int       size() override;
     void      insert(Activity* activity) override;
+    void      insertBatch(Activity** begin, Activity** end) override;
     Activity* pop() override;
     Activity* front() override;
 
@@ -140,10 +154,20 @@ public:
     /** Print the state of the TimeVortex */
     void print(Output& out) const override;
 
-    uint64_t getCurrentDepth() const override { return current_depth; }
+    uint64_t getCurrentDepth() const override { return counters.getDepth(); }
     uint64_t getMaxDepth() const override { return max_depth; }
 
 private:
+    /** Get the TimeUnit for a delivery time, creating it if needed */
+    TimeUnit* getTimeUnit(SimTime_t sort_time);
+
+    /** Only called by the owning thread in the thread safe version */
+    void updateMaxDepth()
+    {
+        uint64_t depth = counters.getDepth();
+        if ( UNLIKELY(depth > max_depth) ) { max_depth = depth; }
+    }
+
     // Should only ever be accessed by the "active" thread.  Not safe
     // for concurrent access.
     TimeUnit* current_time_unit;
@@ -151,10 +175,11 @@ private:
     typedef std::map<SimTime_t, TimeUnit*> mapType_t;
 
     // Accessed by multiple threads, must be locked when accessing
-    mapType_t                                                            map;
-    typename std::conditional<TS, std::atomic<uint64_t>, uint64_t>::type insertOrder;
+    mapType_t map;
 
-    typename std::conditional<TS, std::atomic<uint64_t>, uint64_t>::type current_depth;
+    // Queue order and depth, kept per producer thread in the thread
+    // safe version
+    TimeVortexCounters<TS> counters;
 
     // Should only ever be accessed by the "active" thread, or in a
     // mutex.  There are no internal mutexes.
@@ -0,0 +1,270 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/timevortex/timeVortexBinnedRing.h"
+
+#include "sst/core/output.h"
+#include "sst/core/simulation_runloop.h"
+
+#include <algorithm>
+
+namespace SST {
+namespace IMPL {
+
+// We sort backwards so we can work from the bottom of the vector
+// (faster delete)
+static Activity::greater<true, true, true> ring_greater;
+
+// Consumed ring entries are only compacted away once there are at
+// least this many of them
+static const size_t RING_COMPACT_SIZE = 1024;
+
+template <bool TS>
+TimeVortexBinnedRingBase<TS>::TimeVortexBinnedRingBase(Params& params) :
+    TimeVortex(),
+    head(0),
+    counters(params.find<size_t>("thread_count", 1))
+{
+    max_depth = 0;
+
+    // Initialize things with with time = 0 bin
+    bins.emplace_back();
+    current_bin = &bins.back();
+}
+
+template <bool TS>
+TimeVortexBinnedRingBase<TS>::~TimeVortexBinnedRingBase()
+{
+    // Every bin, pending or free, lives in the pool
+    for ( auto& bin : bins ) {
+        for ( auto x : bin.activities ) {
+            delete x;
+        }
+    }
+}
+
+template <bool TS>
+bool
+TimeVortexBinnedRingBase<TS>::empty()
+{
+    return counters.getDepth() == 0;
+}
+
+template <bool TS>
+int
+TimeVortexBinnedRingBase<TS>::size()
+{
+    return counters.getDepth();
+}
+
+template <bool TS>
+typename TimeVortexBinnedRingBase<TS>::Bin&
+TimeVortexBinnedRingBase<TS>::getBin(SimTime_t sort_time)
+{
+    // Most new bins land at the end of the ring, so check there
+    // before doing a search
+    size_t pos = ring_times.size();
+    if ( pos != head && sort_time <= ring_times.back() ) {
+        auto it = std::lower_bound(ring_times.begin() + head, ring_times.end(), sort_time);
+        pos     = it - ring_times.begin();
+        if ( *it == sort_time ) return *ring_bins[pos];
+    }
+
+    Bin* bin;
+    if ( free_bins.empty() ) {
+        bins.emplace_back();
+        bin = &bins.back();
+    }
+    else {
+        bin = free_bins.back();
+        free_bins.pop_back();
+    }
+    bin->sort_time = sort_time;
+    ring_times.insert(ring_times.begin() + pos, sort_time);
+    ring_bins.insert(ring_bins.begin() + pos, bin);
+    return *bin;
+}
+
+template <bool TS>
+void
+TimeVortexBinnedRingBase<TS>::insert(Activity* activity)
+{
+    counters.setQueueOrder(activity);
+    SimTime_t sort_time = activity->getDeliveryTime();
+
+    counters.addDepth(1);
+
+    // The thread safe depth is a sum over all the producers, so it is
+    // only checked by the owning thread when it moves to the next bin.
+    if ( !TS ) updateMaxDepth();
+
+    // Events for the current time can only come from a SelfLink with
+    // no added latency, so only the active thread touches the current
+    // bin and it needs no lock.
+    if ( UNLIKELY(sort_time == current_bin->sort_time) ) {
+        current_bin->activities.push_back(activity);
+        current_bin->sorted = false;
+        return;
+    }
+
+    if ( TS ) slock.lock();
+    Bin& bin = getBin(sort_time);
+    bin.activities.push_back(activity);
+    bin.sorted = false;
+    if ( TS ) slock.unlock();
+}
+
+template <bool TS>
+void
+TimeVortexBinnedRingBase<TS>::insertBatch(Activity** begin, Activity** end)
+{
+    // Queue order reflects the order the batch was handed to us, so
+    // set it before grouping the batch by delivery time
+    counters.setQueueOrder(begin, end);
+    std::sort(begin, end, Activity::less<true, false, false>());
+
+    counters.addDepth(end - begin);
+    if ( !TS ) updateMaxDepth();
+
+    if ( TS ) slock.lock();
+    Activity** run = begin;
+    while ( run != end ) {
+        SimTime_t  sort_time = (*run)->getDeliveryTime();
+        Activity** run_end   = run + 1;
+        while ( run_end != end && (*run_end)->getDeliveryTime() == sort_time ) {
+            ++run_end;
+        }
+        Bin& bin = sort_time == current_bin->sort_time ? *current_bin : getBin(sort_time);
+        bin.activities.insert(bin.activities.end(), run, run_end);
+        bin.sorted = false;
+        run        = run_end;
+    }
+    if ( TS ) slock.unlock();
+}
+
+template <bool TS>
+bool
+TimeVortexBinnedRingBase<TS>::advance()
+{
+    if ( current_bin->activities.empty() ) {
+        if ( TS ) slock.lock();
+        if ( head == ring_times.size() ) {
+            if ( TS ) slock.unlock();
+            return false;
+        }
+        if ( TS ) updateMaxDepth();
+
+        // Return current bin to the pool and move to the next one
+        free_bins.push_back(current_bin);
+        current_bin = ring_bins[head++];
+
+        if ( UNLIKELY(head >= RING_COMPACT_SIZE && head * 2 >= ring_times.size()) ) {
+            ring_times.erase(ring_times.begin(), ring_times.begin() + head);
+            ring_bins.erase(ring_bins.begin(), ring_bins.begin() + head);
+            head = 0;
+        }
+        if ( TS ) slock.unlock();
+    }
+
+    if ( !current_bin->sorted ) {
+        std::sort(current_bin->activities.begin(), current_bin->activities.end(), ring_greater);
+        current_bin->sorted = true;
+    }
+    return true;
+}
+
+template <bool TS>
+Activity*
+TimeVortexBinnedRingBase<TS>::pop()
+{
+    if ( !advance() ) return nullptr;
+    Activity* ret = current_bin->activities.back();
+    current_bin->activities.pop_back();
+    counters.addDepth(-1);
+    return ret;
+}
+
+template <bool TS>
+Activity*
+TimeVortexBinnedRingBase<TS>::front()
+{
+    // Other threads call this while the owner waits at a sync, so it
+    // can't move to the next bin or sort one
+    if ( !current_bin->activities.empty() ) return first(*current_bin);
+    if ( TS ) slock.lock();
+    Activity* ret = head == ring_times.size() ? nullptr : first(*ring_bins[head]);
+    if ( TS ) slock.unlock();
+    return ret;
+}
+
+template <bool TS>
+Activity*
+TimeVortexBinnedRingBase<TS>::first(const Bin& bin)
+{
+    // The activity the sort in advance() would put at the back
+    if ( bin.sorted ) return bin.activities.back();
+    return *std::max_element(bin.activities.begin(), bin.activities.end(), ring_greater);
+}
+
+template <bool TS>
+void
+TimeVortexBinnedRingBase<TS>::print(Output& out) const
+{
+    out.output("TimeVortex state:\n");
+    out.output("  current bin: time = %" PRIu64 ", %zu activities\n", current_bin->sort_time,
+        current_bin->activities.size());
+    for ( size_t i = head; i < ring_times.size(); ++i ) {
+        out.output("  bin: time = %" PRIu64 ", %zu activities\n", ring_times[i], ring_bins[i]->activities.size());
+    }
+}
+
+
+class TimeVortexBinnedRing : public TimeVortexBinnedRingBase<false>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexBinnedRing,
+        "sst",
+        "timevortex.ring.binned",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "[EXPERIMENTAL] TimeVortex with events binned in time buckets kept in a flat sorted array of pooled bins.")
+
+
+    TimeVortexBinnedRing(Params& params) : TimeVortexBinnedRingBase<false>(params) {}
+    SST_ELI_EXPORT(TimeVortexBinnedRing)
+};
+
+class TimeVortexBinnedRing_ts : public TimeVortexBinnedRingBase<true>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexBinnedRing_ts,
+        "sst",
+        "timevortex.ring.binned.ts",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "[EXPERIMENTAL] Thread safe verion of TimeVortex with events binned in time buckets kept in a flat sorted array of pooled bins.  Do not reference this element directly, just specify sst.timevortex.ring.binned and this version will be selected when it is needed based on other parameters.")
+
+
+    TimeVortexBinnedRing_ts(Params& params) : TimeVortexBinnedRingBase<true>(params) {}
+    SST_ELI_EXPORT(TimeVortexBinnedRing_ts)
+};
+
+} // namespace IMPL
+
+// Run loops with the calls to these TimeVortices inlined
+template bool Simulation_impl::runLoop<IMPL::TimeVortexBinnedRingBase<false>>();
+template bool Simulation_impl::runLoop<IMPL::TimeVortexBinnedRingBase<true>>();
+
+} // namespace SST
@@ -0,0 +1,110 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXBINNEDRING_H
+#define SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXBINNEDRING_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/impl/timevortex/timeVortexCounters.h"
+#include "sst/core/timeVortex.h"
+
+#include <deque>
+#include <vector>
+
+namespace SST {
+
+class Output;
+
+namespace IMPL {
+
+/**
+ * Primary Event Queue that bins activities by delivery time like
+ * TimeVortexBinnedMap, but keeps the bins in a flat sorted array
+ * instead of a std::map.  Bins live in a single pool and are
+ * recycled along with the capacity of their activity vectors, so once
+ * the queue reaches steady state inserts and pops do no allocation.
+ */
+template <bool TS>
+class TimeVortexBinnedRingBase : public TimeVortex
+{
+
+private:
+    // Holds all the activities for one delivery time
+    struct Bin
+    {
+        SimTime_t              sort_time;
+        std::vector<Activity*> activities;
+        bool                   sorted;
+
+        Bin() : sort_time(0), sorted(false) {}
+    };
+
+public:
+    TimeVortexBinnedRingBase(Params& params);
+    ~TimeVortexBinnedRingBase();
+
+    bool      empty() override;
+    int       size() override;
+    void      insert(Activity* activity) override;
+    void      insertBatch(Activity** begin, Activity** end) override;
+    Activity* pop() override;
+    Activity* front() override;
+
+    /** Print the state of the TimeVortex */
+    void print(Output& out) const override;
+
+    uint64_t getCurrentDepth() const override { return counters.getDepth(); }
+    uint64_t getMaxDepth() const override { return max_depth; }
+
+private:
+    /** Get the bin for a delivery time that is not the current bin,
+     * creating it if needed.  Must be called with slock held. */
+    Bin& getBin(SimTime_t sort_time);
+
+    /** Make sure the current bin is non-empty, moving to the next
+     * bin if needed.  Returns false if the queue is empty. */
+    bool advance();
+
+    /** Next activity in a non-empty bin, without sorting it */
+    static Activity* first(const Bin& bin);
+
+    /** Only called by the owning thread in the thread safe version */
+    void updateMaxDepth()
+    {
+        uint64_t depth = counters.getDepth();
+        if ( UNLIKELY(depth > max_depth) ) { max_depth = depth; }
+    }
+
+    // Should only ever be accessed by the "active" thread
+    Bin* current_bin;
+
+    // Pool of bins.  A deque so that pointers to bins stay valid as
+    // the pool grows.
+    std::deque<Bin>   bins;
+    std::vector<Bin*> free_bins;
+
+    // Delivery times and bins of pending bins, sorted by time.
+    // Entries before head have already been consumed.
+    std::vector<SimTime_t> ring_times;
+    std::vector<Bin*>      ring_bins;
+    size_t                 head;
+
+    // Queue order and depth, kept per producer thread in the thread
+    // safe version
+    TimeVortexCounters<TS> counters;
+
+    CACHE_ALIGNED(SST::Core::ThreadSafe::Spinlock, slock);
+};
+
+} // namespace IMPL
+} // namespace SST
+
+#endif // SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXBINNEDRING_H
@@ -0,0 +1,213 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/timevortex/timeVortexBucketed.h"
+
+#include "sst/core/output.h"
+#include "sst/core/simulation_runloop.h"
+
+#include <algorithm>
+
+namespace SST {
+namespace IMPL {
+
+template <bool TS>
+TimeVortexBucketedBase<TS>::TimeVortexBucketedBase(Params& UNUSED(params)) :
+    TimeVortex(),
+    last(nullptr),
+    insertOrder(0),
+    current_depth(0)
+{
+    max_depth = 0;
+}
+
+template <bool TS>
+TimeVortexBucketedBase<TS>::~TimeVortexBucketedBase()
+{
+    // Activities in TimeVortexBucketed all need to be deleted
+    for ( auto& x : heap ) {
+        Bucket* bucket = x.bucket;
+        for ( size_t i = bucket->head; i < bucket->activities.size(); ++i ) {
+            delete bucket->activities[i];
+        }
+        delete bucket;
+    }
+    for ( auto bucket : free_buckets ) {
+        delete bucket;
+    }
+}
+
+template <bool TS>
+bool
+TimeVortexBucketedBase<TS>::empty()
+{
+    if ( TS ) slock.lock();
+    auto ret = heap.empty();
+    if ( TS ) slock.unlock();
+    return ret;
+}
+
+template <bool TS>
+int
+TimeVortexBucketedBase<TS>::size()
+{
+    return current_depth;
+}
+
+template <bool TS>
+void
+TimeVortexBucketedBase<TS>::push(Activity* activity)
+{
+    activity->setQueueOrder(insertOrder++);
+    SimTime_t time           = activity->getDeliveryTime();
+    uint64_t  priority_order = ((uint64_t)(uint32_t)activity->getPriority() << 32) | activity->getOrderTag();
+
+    // Activities for the same time tend to be inserted together
+    if ( last == nullptr || last->delivery_time != time || last->priority_order != priority_order ) {
+        Bucket*& bucket = buckets[key_t(time, priority_order)];
+        if ( bucket == nullptr ) {
+            if ( free_buckets.empty() ) { bucket = new Bucket(); }
+            else {
+                bucket = free_buckets.back();
+                free_buckets.pop_back();
+            }
+            bucket->delivery_time  = time;
+            bucket->priority_order = priority_order;
+            bucket->head           = 0;
+            heap.push_back({ time, priority_order, bucket });
+            std::push_heap(heap.begin(), heap.end());
+        }
+        last = bucket;
+    }
+    last->activities.push_back(activity);
+}
+
+template <bool TS>
+void
+TimeVortexBucketedBase<TS>::insert(Activity* activity)
+{
+    if ( TS ) slock.lock();
+    push(activity);
+    current_depth++;
+    if ( current_depth > max_depth ) { max_depth = current_depth; }
+    if ( TS ) slock.unlock();
+}
+
+template <bool TS>
+void
+TimeVortexBucketedBase<TS>::insertBatch(Activity** begin, Activity** end)
+{
+    if ( TS ) slock.lock();
+    for ( Activity** it = begin; it != end; ++it ) {
+        push(*it);
+    }
+    current_depth += end - begin;
+    if ( current_depth > max_depth ) { max_depth = current_depth; }
+    if ( TS ) slock.unlock();
+}
+
+template <bool TS>
+Activity*
+TimeVortexBucketedBase<TS>::pop()
+{
+    if ( TS ) slock.lock();
+    if ( heap.empty() ) {
+        if ( TS ) slock.unlock();
+        return nullptr;
+    }
+    Bucket*   bucket  = heap.front().bucket;
+    Activity* ret_val = bucket->activities[bucket->head++];
+    if ( bucket->head == bucket->activities.size() ) {
+        // The bucket keeps its capacity for the next time it is used
+        std::pop_heap(heap.begin(), heap.end());
+        heap.pop_back();
+        buckets.erase(key_t(bucket->delivery_time, bucket->priority_order));
+        bucket->activities.clear();
+        free_buckets.push_back(bucket);
+        if ( last == bucket ) last = nullptr;
+    }
+    current_depth--;
+    if ( TS ) slock.unlock();
+    return ret_val;
+}
+
+template <bool TS>
+Activity*
+TimeVortexBucketedBase<TS>::front()
+{
+    if ( TS ) slock.lock();
+    Activity* ret = nullptr;
+    if ( !heap.empty() ) {
+        Bucket* bucket = heap.front().bucket;
+        ret            = bucket->activities[bucket->head];
+    }
+    if ( TS ) slock.unlock();
+    return ret;
+}
+
+template <bool TS>
+void
+TimeVortexBucketedBase<TS>::print(Output& out) const
+{
+    out.output("TimeVortex state:\n");
+
+    // Heap order is not delivery order, so print unsorted
+    for ( auto& x : heap ) {
+        Bucket* bucket = x.bucket;
+        for ( size_t i = bucket->head; i < bucket->activities.size(); ++i ) {
+            out.output("  %s\n", bucket->activities[i]->toString().c_str());
+        }
+    }
+}
+
+class TimeVortexBucketed : public TimeVortexBucketedBase<false>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexBucketed,
+        "sst",
+        "timevortex.bucketed",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "TimeVortex with a FIFO bucket per (time, priority), and a heap of the buckets.")
+
+
+    TimeVortexBucketed(Params& params) : TimeVortexBucketedBase<false>(params) {}
+    ~TimeVortexBucketed() {}
+    SST_ELI_EXPORT(TimeVortexBucketed)
+};
+
+class TimeVortexBucketed_ts : public TimeVortexBucketedBase<true>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexBucketed_ts,
+        "sst",
+        "timevortex.bucketed.ts",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Thread safe verion of TimeVortex with a FIFO bucket per (time, priority).  Do not reference this element directly, just specify sst.timevortex.bucketed and this version will be selected when it is needed based on other parameters.")
+
+
+    TimeVortexBucketed_ts(Params& params) : TimeVortexBucketedBase<true>(params) {}
+    ~TimeVortexBucketed_ts() {}
+    SST_ELI_EXPORT(TimeVortexBucketed_ts)
+};
+
+} // namespace IMPL
+
+// Run loops with the calls to these TimeVortices inlined
+template bool Simulation_impl::runLoop<IMPL::TimeVortexBucketedBase<false>>();
+template bool Simulation_impl::runLoop<IMPL::TimeVortexBucketedBase<true>>();
+
+} // namespace SST
@@ -0,0 +1,108 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXBUCKETED_H
+#define SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXBUCKETED_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/timeVortex.h"
+
+#include <unordered_map>
+#include <vector>
+
+namespace SST {
+
+class Output;
+
+namespace IMPL {
+
+/**
+ * Primary Event Queue that keeps one FIFO bucket per (time, priority
+ * and order tag).  Within a bucket activities are in insertion order,
+ * which is queue order, so inserting into an existing bucket and
+ * popping are constant time.  Only the buckets are kept in a heap,
+ * which pays off when many activities are due at the same time, as
+ * with clocked models.
+ */
+template <bool TS>
+class TimeVortexBucketedBase : public TimeVortex
+{
+
+public:
+    TimeVortexBucketedBase(Params& params);
+    ~TimeVortexBucketedBase();
+
+    bool      empty() override;
+    int       size() override;
+    void      insert(Activity* activity) override;
+    void      insertBatch(Activity** begin, Activity** end) override;
+    Activity* pop() override;
+    Activity* front() override;
+
+    /** Print the state of the TimeVortex */
+    void print(Output& out) const override;
+
+    uint64_t getCurrentDepth() const override { return current_depth; }
+    uint64_t getMaxDepth() const override { return max_depth; }
+
+private:
+    struct Bucket
+    {
+        SimTime_t              delivery_time;
+        uint64_t               priority_order;
+        std::vector<Activity*> activities;
+        size_t                 head; // Index of the next activity to pop
+    };
+
+    struct HeapKey
+    {
+        SimTime_t delivery_time;
+        uint64_t  priority_order;
+        Bucket*   bucket;
+
+        // Reversed, so the std heap functions keep the earliest first
+        inline bool operator<(const HeapKey& rhs) const
+        {
+            if ( delivery_time != rhs.delivery_time ) return delivery_time > rhs.delivery_time;
+            return priority_order > rhs.priority_order;
+        }
+    };
+
+    typedef std::pair<SimTime_t, uint64_t> key_t;
+
+    struct KeyHash
+    {
+        inline size_t operator()(const key_t& key) const
+        {
+            return key.first * 0x9E3779B97F4A7C15ull ^ key.second;
+        }
+    };
+
+    /** Add an activity without locking */
+    void push(Activity* activity);
+
+    // Data
+    std::vector<HeapKey>                        heap;
+    std::unordered_map<key_t, Bucket*, KeyHash> buckets;
+    std::vector<Bucket*>                        free_buckets;
+    Bucket*                                     last; // Bucket of the last insert, if still in use
+    uint64_t                                    insertOrder;
+
+    // Need current depth to be atomic if we are thread safe
+    typename std::conditional<TS, std::atomic<uint64_t>, uint64_t>::type current_depth;
+
+    CACHE_ALIGNED(SST::Core::ThreadSafe::Spinlock, slock);
+};
+
+} // namespace IMPL
+} // namespace SST
+
+#endif // SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXBUCKETED_H
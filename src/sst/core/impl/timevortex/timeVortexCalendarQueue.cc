@@ -0,0 +1,329 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/timevortex/timeVortexCalendarQueue.h"
+
+#include "sst/core/output.h"
+#include "sst/core/simulation_runloop.h"
+
+#include <algorithm>
+
+namespace SST {
+namespace IMPL {
+
+// Buckets are sorted backwards so the next activity is always at the
+// back of the vector (faster delete)
+static Activity::greater<true, true, true> cq_greater;
+
+// Smallest calendar we will shrink to
+static const size_t MIN_BUCKETS = 16;
+
+// Number of activities sampled from the head of the queue when
+// computing a new bucket width
+static const size_t WIDTH_SAMPLE_SIZE = 25;
+
+template <bool TS>
+TimeVortexCalendarQueueBase<TS>::TimeVortexCalendarQueueBase(Params& UNUSED(params)) :
+    TimeVortex(),
+    buckets(MIN_BUCKETS),
+    unsorted(MIN_BUCKETS, false),
+    mask(MIN_BUCKETS - 1),
+    width(1),
+    current_bucket(0),
+    current_window(0),
+    head(nullptr),
+    grow_threshold(2 * MIN_BUCKETS),
+    shrink_threshold(0),
+    insertOrder(0),
+    current_depth(0)
+{
+    max_depth = 0;
+}
+
+template <bool TS>
+TimeVortexCalendarQueueBase<TS>::~TimeVortexCalendarQueueBase()
+{
+    // Activities in TimeVortexCalendarQueue all need to be deleted
+    for ( auto& bucket : buckets ) {
+        for ( auto x : bucket ) {
+            delete x;
+        }
+    }
+}
+
+template <bool TS>
+bool
+TimeVortexCalendarQueueBase<TS>::empty()
+{
+    return current_depth == 0;
+}
+
+template <bool TS>
+int
+TimeVortexCalendarQueueBase<TS>::size()
+{
+    return current_depth;
+}
+
+template <bool TS>
+void
+TimeVortexCalendarQueueBase<TS>::place(Activity* activity)
+{
+    SimTime_t time   = activity->getDeliveryTime();
+    SimTime_t window = time / width;
+    size_t    index  = window & mask;
+    bucket_t& bucket = buckets[index];
+    if ( index == current_bucket && !unsorted[index] ) {
+        // The bucket being drained stays sorted
+        bucket.insert(std::upper_bound(bucket.begin(), bucket.end(), activity, cq_greater), activity);
+    }
+    else {
+        bucket.push_back(activity);
+        if ( bucket.size() > 1 ) unsorted[index] = true;
+    }
+
+    // If this activity lands before the window we have advanced to
+    // (possible since pop() moves on to the next activity), move the
+    // search back to it
+    if ( window < current_window ) {
+        current_window = window;
+        current_bucket = window & mask;
+    }
+
+    if ( head == nullptr || cq_greater(head, activity) ) head = activity;
+}
+
+template <bool TS>
+typename TimeVortexCalendarQueueBase<TS>::bucket_t*
+TimeVortexCalendarQueueBase<TS>::findNext()
+{
+    if ( current_depth == 0 ) return nullptr;
+
+    // Walk one year worth of buckets looking for an activity that
+    // falls in the window the bucket currently represents
+    for ( size_t i = 0; i <= mask; ++i ) {
+        bucket_t& bucket = sortedBucket(current_bucket);
+        if ( !bucket.empty() && bucket.back()->getDeliveryTime() / width <= current_window ) return &bucket;
+        current_bucket = (current_bucket + 1) & mask;
+        current_window++;
+    }
+
+    // Nothing in the coming year, so do a direct search for the
+    // minimum and jump to it
+    Activity* min_act = nullptr;
+    size_t    min_idx = 0;
+    for ( size_t i = 0; i <= mask; ++i ) {
+        if ( buckets[i].empty() ) continue;
+        sortedBucket(i);
+        if ( min_act == nullptr || cq_greater(min_act, buckets[i].back()) ) {
+            min_act = buckets[i].back();
+            min_idx = i;
+        }
+    }
+    current_bucket = min_idx;
+    current_window = min_act->getDeliveryTime() / width;
+    return &buckets[min_idx];
+}
+
+template <bool TS>
+void
+TimeVortexCalendarQueueBase<TS>::resize(size_t new_nbuckets)
+{
+    // Pull the first few activities off the queue to estimate the
+    // average separation between events near the head of the queue.
+    std::vector<Activity*> all;
+    all.reserve(current_depth);
+    for ( size_t i = 0; i < WIDTH_SAMPLE_SIZE; ++i ) {
+        bucket_t* bucket = findNext();
+        if ( bucket == nullptr ) break;
+        all.push_back(bucket->back());
+        bucket->pop_back();
+        current_depth--;
+    }
+
+    SimTime_t new_width = width;
+    if ( all.size() > 1 ) {
+        SimTime_t avg = (all.back()->getDeliveryTime() - all.front()->getDeliveryTime()) / (all.size() - 1);
+
+        // Recompute ignoring separations that are much larger than
+        // average so a few outliers don't skew the width
+        SimTime_t total = 0;
+        SimTime_t count = 0;
+        for ( size_t i = 1; i < all.size(); ++i ) {
+            SimTime_t sep = all[i]->getDeliveryTime() - all[i - 1]->getDeliveryTime();
+            if ( sep <= 2 * avg ) {
+                total += sep;
+                count++;
+            }
+        }
+        if ( count > 0 ) avg = total / count;
+        new_width = std::max<SimTime_t>(1, 3 * avg);
+    }
+
+    // Sampled activities are back in the count once they are
+    // redistributed below
+    current_depth += all.size();
+
+    for ( auto& bucket : buckets ) {
+        all.insert(all.end(), bucket.begin(), bucket.end());
+    }
+
+    // Build the new calendar
+    std::vector<bucket_t>(new_nbuckets).swap(buckets);
+    unsorted.assign(new_nbuckets, false);
+    mask  = new_nbuckets - 1;
+    width = new_width;
+
+    for ( auto x : all ) {
+        buckets[bucketIndex(x->getDeliveryTime())].push_back(x);
+    }
+    for ( auto& bucket : buckets ) {
+        std::sort(bucket.begin(), bucket.end(), cq_greater);
+    }
+
+    if ( !all.empty() ) {
+        // The first sampled activity is the head of the queue
+        current_window = all.front()->getDeliveryTime() / width;
+        current_bucket = current_window & mask;
+    }
+    else {
+        current_window = 0;
+        current_bucket = 0;
+    }
+
+    grow_threshold   = 2 * new_nbuckets;
+    shrink_threshold = new_nbuckets > MIN_BUCKETS ? new_nbuckets / 2 : 0;
+}
+
+template <bool TS>
+void
+TimeVortexCalendarQueueBase<TS>::insert(Activity* activity)
+{
+    if ( TS ) slock.lock();
+    activity->setQueueOrder(insertOrder++);
+    place(activity);
+    current_depth++;
+    if ( current_depth > max_depth ) { max_depth = current_depth; }
+    if ( UNLIKELY(current_depth > grow_threshold) ) resize(2 * buckets.size());
+    if ( TS ) slock.unlock();
+}
+
+template <bool TS>
+void
+TimeVortexCalendarQueueBase<TS>::insertBatch(Activity** begin, Activity** end)
+{
+    if ( TS ) slock.lock();
+    for ( Activity** it = begin; it != end; ++it ) {
+        (*it)->setQueueOrder(insertOrder++);
+        place(*it);
+    }
+    current_depth += (end - begin);
+    if ( current_depth > max_depth ) { max_depth = current_depth; }
+
+    // Resize once for the whole batch
+    if ( UNLIKELY(current_depth > grow_threshold) ) {
+        size_t new_nbuckets = buckets.size();
+        while ( current_depth > 2 * new_nbuckets ) {
+            new_nbuckets *= 2;
+        }
+        resize(new_nbuckets);
+    }
+    if ( TS ) slock.unlock();
+}
+
+template <bool TS>
+Activity*
+TimeVortexCalendarQueueBase<TS>::pop()
+{
+    if ( TS ) slock.lock();
+    bucket_t* bucket = findNext();
+    if ( bucket == nullptr ) {
+        if ( TS ) slock.unlock();
+        return nullptr;
+    }
+    Activity* ret_val = bucket->back();
+    bucket->pop_back();
+    current_depth--;
+    if ( UNLIKELY(current_depth < shrink_threshold) ) resize(buckets.size() / 2);
+    bucket = findNext();
+    head   = bucket == nullptr ? nullptr : bucket->back();
+    if ( TS ) slock.unlock();
+    return ret_val;
+}
+
+template <bool TS>
+Activity*
+TimeVortexCalendarQueueBase<TS>::front()
+{
+    if ( TS ) slock.lock();
+    Activity* ret = head;
+    if ( TS ) slock.unlock();
+    return ret;
+}
+
+template <bool TS>
+void
+TimeVortexCalendarQueueBase<TS>::print(Output& out) const
+{
+    out.output("TimeVortex state:\n");
+    out.output("  %zu buckets of width %" PRIu64 "\n", buckets.size(), width);
+    for ( size_t i = 0; i < buckets.size(); ++i ) {
+        if ( buckets[i].empty() ) continue;
+        out.output("  bucket %zu:\n", i);
+        for ( auto it = buckets[i].rbegin(); it != buckets[i].rend(); ++it ) {
+            out.output("    %s\n", (*it)->toString().c_str());
+        }
+    }
+}
+
+class TimeVortexCalendarQueue : public TimeVortexCalendarQueueBase<false>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexCalendarQueue,
+        "sst",
+        "timevortex.calendar_queue",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "TimeVortex based on a calendar queue with O(1) amortized insert and pop.")
+
+
+    TimeVortexCalendarQueue(Params& params) : TimeVortexCalendarQueueBase<false>(params) {}
+    ~TimeVortexCalendarQueue() {}
+    SST_ELI_EXPORT(TimeVortexCalendarQueue)
+};
+
+class TimeVortexCalendarQueue_ts : public TimeVortexCalendarQueueBase<true>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexCalendarQueue_ts,
+        "sst",
+        "timevortex.calendar_queue.ts",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Thread safe verion of TimeVortex based on a calendar queue.  Do not reference this element directly, just specify sst.timevortex.calendar_queue and this version will be selected when it is needed based on other parameters.")
+
+
+    TimeVortexCalendarQueue_ts(Params& params) : TimeVortexCalendarQueueBase<true>(params) {}
+    ~TimeVortexCalendarQueue_ts() {}
+    SST_ELI_EXPORT(TimeVortexCalendarQueue_ts)
+};
+
+} // namespace IMPL
+
+// Run loops with the calls to these TimeVortices inlined
+template bool Simulation_impl::runLoop<IMPL::TimeVortexCalendarQueueBase<false>>();
+template bool Simulation_impl::runLoop<IMPL::TimeVortexCalendarQueueBase<true>>();
+
+} // namespace SST
@@ -0,0 +1,120 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXCALENDARQUEUE_H
+#define SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXCALENDARQUEUE_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/timeVortex.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace SST {
+
+class Output;
+
+namespace IMPL {
+
+/**
+ * Primary Event Queue based on a calendar queue (R. Brown, CACM
+ * 1988).  Activities are hashed by delivery time into a power of two
+ * number of buckets, each covering a fixed width of simulated time.
+ * Each bucket is sorted in reverse order so the next activity can be
+ * taken from the back of the vector.  Buckets other than the one
+ * being drained are only sorted when they are next looked at, so
+ * bursts of activities with the same delivery time stay cheap to
+ * insert.  The number of buckets and the bucket width are recomputed
+ * as the queue grows and shrinks, which gives O(1) amortized insert
+ * and pop for most event time distributions.
+ *
+ * The next activity is found when it becomes the head, on insert or
+ * pop, so front() doesn't change anything.  Other threads call it
+ * during syncs.
+ */
+template <bool TS>
+class TimeVortexCalendarQueueBase : public TimeVortex
+{
+
+public:
+    TimeVortexCalendarQueueBase(Params& params);
+    ~TimeVortexCalendarQueueBase();
+
+    bool      empty() override;
+    int       size() override;
+    void      insert(Activity* activity) override;
+    void      insertBatch(Activity** begin, Activity** end) override;
+    Activity* pop() override;
+    Activity* front() override;
+
+    /** Print the state of the TimeVortex */
+    void print(Output& out) const override;
+
+    uint64_t getCurrentDepth() const override { return current_depth; }
+    uint64_t getMaxDepth() const override { return max_depth; }
+
+private:
+    typedef std::vector<Activity*> bucket_t;
+
+    /** Put an activity into its bucket without touching the queue order */
+    void place(Activity* activity);
+
+    /** Advance to the bucket holding the next activity.  Returns
+     * nullptr if the queue is empty.  Only called from insert and
+     * pop. */
+    bucket_t* findNext();
+
+    /** Rebuild the calendar with a new number of buckets, sampling
+     * the head of the queue to pick a new bucket width */
+    void resize(size_t new_nbuckets);
+
+    inline size_t bucketIndex(SimTime_t time) const { return (time / width) & mask; }
+
+    /** Make sure a bucket is sorted before looking at its back */
+    inline bucket_t& sortedBucket(size_t index)
+    {
+        if ( UNLIKELY(unsorted[index]) ) {
+            std::sort(buckets[index].begin(), buckets[index].end(), Activity::greater<true, true, true>());
+            unsorted[index] = false;
+        }
+        return buckets[index];
+    }
+
+    // Calendar
+    std::vector<bucket_t> buckets;
+    std::vector<bool>     unsorted;
+    size_t                mask;
+    SimTime_t             width;
+
+    // Bucket currently being drained and the index of its time
+    // window (delivery_time / width) in the current "year"
+    size_t    current_bucket;
+    SimTime_t current_window;
+
+    // Next activity, or nullptr if the queue is empty
+    Activity* head;
+
+    // Thresholds at which the calendar is resized
+    uint64_t grow_threshold;
+    uint64_t shrink_threshold;
+
+    uint64_t insertOrder;
+
+    // Need current depth to be atomic if we are thread safe
+    typename std::conditional<TS, std::atomic<uint64_t>, uint64_t>::type current_depth;
+
+    CACHE_ALIGNED(SST::Core::ThreadSafe::Spinlock, slock);
+};
+
+} // namespace IMPL
+} // namespace SST
+
+#endif // SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXCALENDARQUEUE_H
@@ -0,0 +1,128 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXCOUNTERS_H
+#define SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXCOUNTERS_H
+
+#include "sst/core/activity.h"
+#include "sst/core/threadsafe.h"
+#include "sst/core/warnmacros.h"
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace SST {
+namespace IMPL {
+
+/**
+ * Queue order and depth counters for the binned TimeVortices.
+ *
+ * The thread safe version keeps both counters per producer thread, so
+ * inserts from different threads never write the same cache line.
+ * Queue order is the producer's own count with the producer's thread
+ * index in the low bits, which keeps the order of each producer's
+ * activities and breaks ties between producers by thread index
+ * instead of by which thread got to a shared counter first.  Depth is
+ * the sum of the per producer counts, so reading it costs one load
+ * per thread and is meant for stats and for the owning thread, not
+ * for every insert.
+ */
+template <bool TS>
+class TimeVortexCounters;
+
+template <>
+class TimeVortexCounters<false>
+{
+public:
+    explicit TimeVortexCounters(size_t UNUSED(num_producers)) {}
+
+    void setQueueOrder(Activity* act) { act->setQueueOrder(insertOrder++); }
+
+    void setQueueOrder(Activity** begin, Activity** end)
+    {
+        for ( Activity** it = begin; it != end; ++it ) {
+            (*it)->setQueueOrder(insertOrder++);
+        }
+    }
+
+    /** Called by the thread adding (or, with a negative count, removing) activities */
+    void addDepth(int64_t count) { depth += count; }
+
+    uint64_t getDepth() const { return depth; }
+
+private:
+    uint64_t insertOrder = 0;
+    uint64_t depth       = 0;
+};
+
+template <>
+class TimeVortexCounters<true>
+{
+public:
+    /** Bits of the queue order that hold the producer's thread index */
+    static const int PRODUCER_BITS = 16;
+
+    explicit TimeVortexCounters(size_t num_producers) : producers(num_producers == 0 ? 1 : num_producers) {}
+
+    void setQueueOrder(Activity* act)
+    {
+        size_t index = mine();
+        act->setQueueOrder((producers[index].insertOrder++ << PRODUCER_BITS) | index);
+    }
+
+    void setQueueOrder(Activity** begin, Activity** end)
+    {
+        size_t    index = mine();
+        uint64_t& order = producers[index].insertOrder;
+        for ( Activity** it = begin; it != end; ++it ) {
+            (*it)->setQueueOrder((order++ << PRODUCER_BITS) | index);
+        }
+    }
+
+    /** Called by the thread adding (or, with a negative count,
+     * removing) activities.  Only that thread writes its count, so it
+     * needs no read-modify-write. */
+    void addDepth(int64_t count)
+    {
+        std::atomic<int64_t>& depth = producers[mine()].depth;
+        depth.store(depth.load(std::memory_order_relaxed) + count, std::memory_order_relaxed);
+    }
+
+    /** Sum of the producer counts.  Removals are counted against the
+     * owning thread, so single counts can go negative. */
+    uint64_t getDepth() const
+    {
+        int64_t sum = 0;
+        for ( auto& x : producers ) {
+            sum += x.depth.load(std::memory_order_relaxed);
+        }
+        return sum < 0 ? 0 : sum;
+    }
+
+private:
+    struct CACHE_ALIGNED_T Producer
+    {
+        uint64_t             insertOrder = 0;
+        std::atomic<int64_t> depth { 0 };
+    };
+
+    /** Index of the calling thread.  Simulation threads are numbered
+     * from 0, so this only folds if the thread count was wrong. */
+    size_t mine() const { return SST::Core::ThreadSafe::Barrier::getThreadIndex() % producers.size(); }
+
+    std::vector<Producer> producers;
+};
+
+} // namespace IMPL
+} // namespace SST
+
+#endif // SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXCOUNTERS_H
@@ -0,0 +1,223 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/timevortex/timeVortexDHeap.h"
+
+#include "sst/core/output.h"
+#include "sst/core/simulation_runloop.h"
+
+namespace SST {
+namespace IMPL {
+
+template <bool TS>
+TimeVortexDHeapBase<TS>::TimeVortexDHeapBase(Params& UNUSED(params)) :
+    TimeVortex(),
+    insertOrder(0),
+    current_depth(0)
+{
+    max_depth = 0;
+}
+
+template <bool TS>
+TimeVortexDHeapBase<TS>::~TimeVortexDHeapBase()
+{
+    // Activities in TimeVortexDHeap all need to be deleted
+    for ( auto& x : data ) {
+        delete x.activity;
+    }
+}
+
+template <bool TS>
+bool
+TimeVortexDHeapBase<TS>::empty()
+{
+    if ( TS ) slock.lock();
+    auto ret = data.empty();
+    if ( TS ) slock.unlock();
+    return ret;
+}
+
+template <bool TS>
+int
+TimeVortexDHeapBase<TS>::size()
+{
+    if ( TS ) slock.lock();
+    auto ret = data.size();
+    if ( TS ) slock.unlock();
+    return ret;
+}
+
+template <bool TS>
+void
+TimeVortexDHeapBase<TS>::siftUp(size_t index, const HeapKey& key)
+{
+    while ( index > 0 ) {
+        size_t parent = (index - 1) / ARITY;
+        if ( !(key < data[parent]) ) break;
+        data[index] = data[parent];
+        index       = parent;
+    }
+    data[index] = key;
+}
+
+template <bool TS>
+void
+TimeVortexDHeapBase<TS>::siftDown(size_t index, const HeapKey& key)
+{
+    const size_t count = data.size();
+    while ( true ) {
+        size_t first = index * ARITY + 1;
+        if ( first >= count ) break;
+        size_t last = first + ARITY < count ? first + ARITY : count;
+
+        // Find the smallest child
+        size_t min = first;
+        for ( size_t i = first + 1; i < last; ++i ) {
+            if ( data[i] < data[min] ) min = i;
+        }
+        if ( !(data[min] < key) ) break;
+        data[index] = data[min];
+        index       = min;
+    }
+    data[index] = key;
+}
+
+template <bool TS>
+void
+TimeVortexDHeapBase<TS>::insert(Activity* activity)
+{
+    if ( TS ) slock.lock();
+    HeapKey key;
+    makeKey(activity, key);
+
+    data.emplace_back();
+    siftUp(data.size() - 1, key);
+    current_depth++;
+    if ( current_depth > max_depth ) { max_depth = current_depth; }
+    if ( TS ) slock.unlock();
+}
+
+template <bool TS>
+void
+TimeVortexDHeapBase<TS>::insertBatch(Activity** begin, Activity** end)
+{
+    if ( TS ) slock.lock();
+    size_t count = end - begin;
+    size_t start = data.size();
+    data.resize(start + count);
+    if ( count > start ) {
+        // Cheaper to append everything and rebuild the heap bottom up
+        // than to sift each activity up individually
+        for ( size_t i = 0; i < count; ++i ) {
+            makeKey(begin[i], data[start + i]);
+        }
+        if ( data.size() > 1 ) {
+            for ( size_t i = (data.size() - 2) / ARITY + 1; i-- > 0; ) {
+                HeapKey key = data[i];
+                siftDown(i, key);
+            }
+        }
+    }
+    else {
+        HeapKey key;
+        for ( size_t i = 0; i < count; ++i ) {
+            makeKey(begin[i], key);
+            siftUp(start + i, key);
+        }
+    }
+    current_depth += count;
+    if ( current_depth > max_depth ) { max_depth = current_depth; }
+    if ( TS ) slock.unlock();
+}
+
+template <bool TS>
+Activity*
+TimeVortexDHeapBase<TS>::pop()
+{
+    if ( TS ) slock.lock();
+    if ( data.empty() ) {
+        if ( TS ) slock.unlock();
+        return nullptr;
+    }
+    Activity* ret_val = data.front().activity;
+    HeapKey   last    = data.back();
+    data.pop_back();
+    if ( !data.empty() ) siftDown(0, last);
+    current_depth--;
+    if ( TS ) slock.unlock();
+    return ret_val;
+}
+
+template <bool TS>
+Activity*
+TimeVortexDHeapBase<TS>::front()
+{
+    if ( TS ) slock.lock();
+    auto ret = data.empty() ? nullptr : data.front().activity;
+    if ( TS ) slock.unlock();
+    return ret;
+}
+
+template <bool TS>
+void
+TimeVortexDHeapBase<TS>::print(Output& out) const
+{
+    out.output("TimeVortex state:\n");
+
+    // Heap order is not delivery order, so print unsorted
+    for ( auto& x : data ) {
+        out.output("  %s\n", x.activity->toString().c_str());
+    }
+}
+
+class TimeVortexDHeap : public TimeVortexDHeapBase<false>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexDHeap,
+        "sst",
+        "timevortex.dheap",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "TimeVortex based on a 4-ary heap of packed (time, priority, queue order) keys.")
+
+
+    TimeVortexDHeap(Params& params) : TimeVortexDHeapBase<false>(params) {}
+    ~TimeVortexDHeap() {}
+    SST_ELI_EXPORT(TimeVortexDHeap)
+};
+
+class TimeVortexDHeap_ts : public TimeVortexDHeapBase<true>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexDHeap_ts,
+        "sst",
+        "timevortex.dheap.ts",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Thread safe verion of TimeVortex based on a 4-ary heap of packed keys.  Do not reference this element directly, just specify sst.timevortex.dheap and this version will be selected when it is needed based on other parameters.")
+
+
+    TimeVortexDHeap_ts(Params& params) : TimeVortexDHeapBase<true>(params) {}
+    ~TimeVortexDHeap_ts() {}
+    SST_ELI_EXPORT(TimeVortexDHeap_ts)
+};
+
+} // namespace IMPL
+
+// Run loops with the calls to these TimeVortices inlined
+template bool Simulation_impl::runLoop<IMPL::TimeVortexDHeapBase<false>>();
+template bool Simulation_impl::runLoop<IMPL::TimeVortexDHeapBase<true>>();
+
+} // namespace SST
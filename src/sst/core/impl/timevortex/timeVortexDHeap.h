@@ -0,0 +1,100 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXDHEAP_H
+#define SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXDHEAP_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/timeVortex.h"
+
+#include <vector>
+
+namespace SST {
+
+class Output;
+
+namespace IMPL {
+
+/**
+ * Primary Event Queue based on a 4-ary heap of packed sort keys.
+ * The delivery time, priority/order tag and queue order of each
+ * Activity are copied into the heap alongside the pointer, so heap
+ * comparisons only touch contiguous heap memory and never
+ * dereference the Activity.
+ */
+template <bool TS>
+class TimeVortexDHeapBase : public TimeVortex
+{
+
+public:
+    TimeVortexDHeapBase(Params& params);
+    ~TimeVortexDHeapBase();
+
+    bool      empty() override;
+    int       size() override;
+    void      insert(Activity* activity) override;
+    void      insertBatch(Activity** begin, Activity** end) override;
+    Activity* pop() override;
+    Activity* front() override;
+
+    /** Print the state of the TimeVortex */
+    void print(Output& out) const override;
+
+    uint64_t getCurrentDepth() const override { return current_depth; }
+    uint64_t getMaxDepth() const override { return max_depth; }
+
+private:
+    /** Number of children of each heap node */
+    static constexpr size_t ARITY = 4;
+
+    /** Sort key stored in the heap.  32 bytes, so the four children
+     * of a node span at most two cache lines. */
+    struct HeapKey
+    {
+        SimTime_t delivery_time;
+        uint64_t  priority_order;
+        uint64_t  queue_order;
+        Activity* activity;
+
+        inline bool operator<(const HeapKey& rhs) const
+        {
+            if ( delivery_time != rhs.delivery_time ) return delivery_time < rhs.delivery_time;
+            if ( priority_order != rhs.priority_order ) return priority_order < rhs.priority_order;
+            return queue_order < rhs.queue_order;
+        }
+    };
+
+    inline void makeKey(Activity* activity, HeapKey& key)
+    {
+        activity->setQueueOrder(insertOrder++);
+        key.delivery_time  = activity->getDeliveryTime();
+        key.priority_order = ((uint64_t)(uint32_t)activity->getPriority() << 32) | activity->getOrderTag();
+        key.queue_order    = activity->getQueueOrder();
+        key.activity       = activity;
+    }
+
+    void siftUp(size_t index, const HeapKey& key);
+    void siftDown(size_t index, const HeapKey& key);
+
+    // Data
+    std::vector<HeapKey> data;
+    uint64_t             insertOrder;
+
+    // Need current depth to be atomic if we are thread safe
+    typename std::conditional<TS, std::atomic<uint64_t>, uint64_t>::type current_depth;
+
+    CACHE_ALIGNED(SST::Core::ThreadSafe::Spinlock, slock);
+};
+
+} // namespace IMPL
+} // namespace SST
+
+#endif // SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXDHEAP_H
@@ -15,6 +15,7 @@
 
 #include "sst/core/clock.h"
 #include "sst/core/output.h"
+#include "sst/core/simulation_runloop.h"
 
 namespace SST {
 namespace IMPL {
@@ -70,6 +71,33 @@ TimeVortexPQBase<TS>::insert(Activity* activity)
     if ( TS ) slock.unlock();
 }
 
+template <bool TS>
+void
+TimeVortexPQBase<TS>::insertBatch(Activity** begin, Activity** end)
+{
+    if ( TS ) slock.lock();
+    size_t count = end - begin;
+    if ( count > data.size() ) {
+        // Cheaper to append everything and rebuild the heap than to
+        // sift each activity up individually
+        auto& container = data.getContainer();
+        for ( Activity** it = begin; it != end; ++it ) {
+            (*it)->setQueueOrder(insertOrder++);
+            container.push_back(*it);
+        }
+        data.heapify();
+    }
+    else {
+        for ( Activity** it = begin; it != end; ++it ) {
+            (*it)->setQueueOrder(insertOrder++);
+            data.push(*it);
+        }
+    }
+    current_depth += count;
+    if ( current_depth > max_depth ) { max_depth = current_depth; }
+    if ( TS ) slock.unlock();
+}
+
 template <bool TS>
 Activity*
 TimeVortexPQBase<TS>::pop()
@@ -107,6 +135,178 @@ TimeVortexPQBase<TS>::print(Output& out) const
     //    }
 }
 
+// Each producer thread gets its own staging lane the first time it
+// inserts into any staged TimeVortex
+static std::atomic<size_t> next_lane(0);
+static thread_local size_t my_lane = next_lane++;
+
+TimeVortexPQStaged::TimeVortexPQStaged(Params& params) :
+    TimeVortex(),
+    insertOrder(0),
+    owner(std::this_thread::get_id()),
+    staged_min(MAX_SIMTIME_T),
+    has_overflow(false),
+    current_depth(0)
+{
+    max_depth = 0;
+
+    num_lanes           = params.find<size_t>("thread_count", 1);
+    size_t staging_size = params.find<size_t>("staging_size", 4096);
+    if ( num_lanes == 0 ) num_lanes = 1;
+    lanes = new lane_t[num_lanes];
+    for ( size_t i = 0; i < num_lanes; ++i ) {
+        lanes[i].initialize(staging_size);
+    }
+}
+
+TimeVortexPQStaged::~TimeVortexPQStaged()
+{
+    // Pick up anything still staged so it gets deleted with the rest
+    drain();
+    while ( !data.empty() ) {
+        Activity* it = data.top();
+        delete it;
+        data.pop();
+    }
+    delete[] lanes;
+}
+
+void
+TimeVortexPQStaged::drain()
+{
+    // Anything staged from here on updates it again
+    staged_min.store(MAX_SIMTIME_T, std::memory_order_relaxed);
+
+    Activity* act;
+    for ( size_t i = 0; i < num_lanes; ++i ) {
+        while ( lanes[i].try_remove(act) ) {
+            push(act);
+        }
+    }
+    if ( UNLIKELY(has_overflow.load(std::memory_order_acquire)) ) {
+        overflow_lock.lock();
+        // A producer that used the overflow list keeps using it, so
+        // what it put in its staging buffer before then is older than
+        // anything in the list.  Some of that may have come in since
+        // the buffers were drained above, and has to go in the heap
+        // first to keep activities on a link in order.
+        for ( size_t i = 0; i < num_lanes; ++i ) {
+            while ( lanes[i].try_remove(act) ) {
+                push(act);
+            }
+        }
+        for ( auto x : overflow ) {
+            push(x);
+        }
+        overflow.clear();
+        has_overflow.store(false, std::memory_order_release);
+        overflow_lock.unlock();
+    }
+}
+
+bool
+TimeVortexPQStaged::empty()
+{
+    return current_depth == 0;
+}
+
+int
+TimeVortexPQStaged::size()
+{
+    return current_depth;
+}
+
+void
+TimeVortexPQStaged::insert(Activity* activity)
+{
+    // This is not really thread safe, but it's only used for stats,
+    // so is okay if it misses something.
+    uint64_t depth = ++current_depth;
+    if ( UNLIKELY(depth > max_depth) ) { max_depth = depth; }
+
+    if ( std::this_thread::get_id() == owner ) {
+        push(activity);
+        return;
+    }
+
+    // Staging buffer is full, or the overflow list is in use, so fall
+    // back to the locked overflow list
+    if ( UNLIKELY(has_overflow.load(std::memory_order_acquire)) ||
+         UNLIKELY(!lanes[my_lane % num_lanes].try_insert(activity)) ) {
+        overflow_lock.lock();
+        overflow.push_back(activity);
+        has_overflow.store(true, std::memory_order_release);
+        overflow_lock.unlock();
+    }
+    staged(activity);
+}
+
+void
+TimeVortexPQStaged::staged(Activity* activity)
+{
+    SimTime_t time = activity->getDeliveryTime();
+    SimTime_t min  = staged_min.load(std::memory_order_relaxed);
+    while ( time < min && !staged_min.compare_exchange_weak(min, time, std::memory_order_release) ) {}
+}
+
+void
+TimeVortexPQStaged::insertBatch(Activity** begin, Activity** end)
+{
+    if ( std::this_thread::get_id() != owner ) {
+        TimeVortex::insertBatch(begin, end);
+        return;
+    }
+
+    uint64_t depth = current_depth += (end - begin);
+    if ( UNLIKELY(depth > max_depth) ) { max_depth = depth; }
+    for ( Activity** it = begin; it != end; ++it ) {
+        push(*it);
+    }
+}
+
+Activity*
+TimeVortexPQStaged::pop()
+{
+    drain();
+    if ( data.empty() ) return nullptr;
+    Activity* ret_val = data.top();
+    data.pop();
+    current_depth--;
+    return ret_val;
+}
+
+Activity*
+TimeVortexPQStaged::front()
+{
+    Activity* ret = data.empty() ? nullptr : data.top();
+    if ( ret != nullptr && staged_min.load(std::memory_order_acquire) > ret->getDeliveryTime() ) return ret;
+
+    // Something staged may come first.  It would go in the heap after
+    // what is already there, in the order drain() takes it, so only
+    // an activity that sorts strictly earlier replaces ret.
+    Activity::less<true, true, false> less;
+    auto                              check = [&ret, &less](Activity* act) {
+        if ( ret == nullptr || less(act, ret) ) ret = act;
+    };
+    for ( size_t i = 0; i < num_lanes; ++i ) {
+        lanes[i].for_each(check);
+    }
+    if ( UNLIKELY(has_overflow.load(std::memory_order_acquire)) ) {
+        overflow_lock.lock();
+        for ( auto x : overflow ) {
+            check(x);
+        }
+        overflow_lock.unlock();
+    }
+    return ret;
+}
+
+void
+TimeVortexPQStaged::print(Output& out) const
+{
+    out.output("TimeVortex state:\n");
+}
+
 class TimeVortexPQ : public TimeVortexPQBase<false>
 {
 public:
@@ -141,5 +341,49 @@ public:
     SST_ELI_EXPORT(TimeVortexPQ_ts)
 };
 
+class TimeVortexPQStaged_nts : public TimeVortexPQBase<false>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexPQStaged_nts,
+        "sst",
+        "timevortex.priority_queue.staged",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "TimeVortex based on std::priority_queue.  When run with multiple threads, inserts from other threads go through lock-free staging buffers instead of a spinlock.")
+
+
+    TimeVortexPQStaged_nts(Params& params) : TimeVortexPQBase<false>(params) {}
+    ~TimeVortexPQStaged_nts() {}
+    SST_ELI_EXPORT(TimeVortexPQStaged_nts)
+};
+
+class TimeVortexPQStaged_ts : public TimeVortexPQStaged
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexPQStaged_ts,
+        "sst",
+        "timevortex.priority_queue.staged.ts",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Thread safe verion of TimeVortex based on std::priority_queue with per-producer lock-free staging buffers.  Do not reference this element directly, just specify sst.timevortex.priority_queue.staged and this version will be selected when it is needed based on other parameters.")
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {"thread_count", "Number of threads that can insert into the TimeVortex.  Set by the core.", "1"},
+        {"staging_size", "Number of activities each producer can stage before falling back to a locked list", "4096"}
+    )
+
+    TimeVortexPQStaged_ts(Params& params) : TimeVortexPQStaged(params) {}
+    ~TimeVortexPQStaged_ts() {}
+    SST_ELI_EXPORT(TimeVortexPQStaged_ts)
+};
+
 } // namespace IMPL
+
+// Run loops with the calls to these TimeVortices inlined
+template bool Simulation_impl::runLoop<IMPL::TimeVortexPQBase<false>>();
+template bool Simulation_impl::runLoop<IMPL::TimeVortexPQBase<true>>();
+template bool Simulation_impl::runLoop<IMPL::TimeVortexPQStaged>();
+
 } // namespace SST
@@ -15,8 +15,10 @@
 #include "sst/core/eli/elementinfo.h"
 #include "sst/core/timeVortex.h"
 
+#include <algorithm>
 #include <functional>
 #include <queue>
+#include <thread>
 #include <vector>
 
 namespace SST {
@@ -40,6 +42,7 @@ public:
     bool      empty() override;
     int       size() override;
     void      insert(Activity* activity) override;
+    void      insertBatch(Activity** begin, Activity** end) override;
     Activity* pop() override;
     Activity* front() override;
 
@@ -50,7 +53,15 @@ public:
     uint64_t getMaxDepth() const override { return max_depth; }
 
 private:
-    typedef std::priority_queue<Activity*, std::vector<Activity*>, Activity::greater<true, true, true>> dataType_t;
+    /** std::priority_queue with access to the underlying container
+     * so large batches can be appended and heapified in one pass */
+    class dataType_t :
+        public std::priority_queue<Activity*, std::vector<Activity*>, Activity::greater<true, true, true>>
+    {
+    public:
+        std::vector<Activity*>& getContainer() { return c; }
+        void                    heapify() { std::make_heap(c.begin(), c.end(), comp); }
+    };
 
     // Data
     dataType_t data;
@@ -65,6 +76,74 @@ private:
     CACHE_ALIGNED(SST::Core::ThreadSafe::Spinlock, slock);
 };
 
+/**
+ * Thread safe Primary Event Queue where inserts from other threads
+ * never touch the heap.  Remote producers push into per-producer
+ * lock-free staging buffers, which the owning thread (the one that
+ * created the TimeVortex) drains into its private heap before each
+ * pop().  Only the owning thread may call pop().  front() doesn't
+ * drain, since other threads call it during syncs, and only looks
+ * through the staging buffers when they might hold the next activity.
+ */
+class TimeVortexPQStaged : public TimeVortex
+{
+
+public:
+    TimeVortexPQStaged(Params& params);
+    ~TimeVortexPQStaged();
+
+    bool      empty() override;
+    int       size() override;
+    void      insert(Activity* activity) override;
+    void      insertBatch(Activity** begin, Activity** end) override;
+    Activity* pop() override;
+    Activity* front() override;
+
+    /** Print the state of the TimeVortex */
+    void print(Output& out) const override;
+
+    uint64_t getCurrentDepth() const override { return current_depth; }
+    uint64_t getMaxDepth() const override { return max_depth; }
+
+private:
+    typedef std::priority_queue<Activity*, std::vector<Activity*>, Activity::greater<true, true, true>> dataType_t;
+    typedef SST::Core::ThreadSafe::BoundedQueue<Activity*>                                              lane_t;
+
+    /** Move everything in the staging buffers into the heap */
+    void drain();
+
+    /** Note the delivery time of an activity put in a staging buffer */
+    void staged(Activity* activity);
+
+    /** Put an activity in the heap.  Only called by the owning thread */
+    inline void push(Activity* activity)
+    {
+        activity->setQueueOrder(insertOrder++);
+        data.push(activity);
+    }
+
+    // Data, only accessed by the owning thread
+    dataType_t      data;
+    uint64_t        insertOrder;
+    std::thread::id owner;
+
+    // One staging buffer per producer thread
+    lane_t* lanes;
+    size_t  num_lanes;
+
+    // Earliest delivery time staged since the last drain, or earlier
+    std::atomic<SimTime_t> staged_min;
+
+    // Used when a producer's staging buffer is full.  Once anything is
+    // in it, all producers use it until it is drained.
+    std::vector<Activity*> overflow;
+    std::atomic<bool>      has_overflow;
+    CACHE_ALIGNED(SST::Core::ThreadSafe::Spinlock, overflow_lock);
+
+    // Updated by all producers
+    std::atomic<uint64_t> current_depth;
+};
+
 
 } // namespace IMPL
 } // namespace SST
@@ -0,0 +1,314 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/timevortex/timeVortexSimdHeap.h"
+
+#include "sst/core/output.h"
+#include "sst/core/simulation_runloop.h"
+
+#include <cstring>
+#include <new>
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace SST {
+namespace IMPL {
+
+template <bool TS>
+TimeVortexSimdHeapBase<TS>::TimeVortexSimdHeapBase(Params& UNUSED(params)) :
+    TimeVortex(),
+    times(nullptr),
+    capacity(0),
+    count(0),
+    insertOrder(0),
+    current_depth(0)
+{
+    max_depth = 0;
+    reserve(1);
+}
+
+template <bool TS>
+TimeVortexSimdHeapBase<TS>::~TimeVortexSimdHeapBase()
+{
+    // Activities in TimeVortexSimdHeap all need to be deleted
+    for ( size_t i = 0; i < count; ++i ) {
+        delete keys[slot(i)].activity;
+    }
+    ::operator delete(times, std::align_val_t(64));
+}
+
+template <bool TS>
+bool
+TimeVortexSimdHeapBase<TS>::empty()
+{
+    if ( TS ) slock.lock();
+    auto ret = count == 0;
+    if ( TS ) slock.unlock();
+    return ret;
+}
+
+template <bool TS>
+int
+TimeVortexSimdHeapBase<TS>::size()
+{
+    if ( TS ) slock.lock();
+    auto ret = count;
+    if ( TS ) slock.unlock();
+    return ret;
+}
+
+template <bool TS>
+void
+TimeVortexSimdHeapBase<TS>::reserve(size_t new_count)
+{
+    // Always whole groups of children, so they can be loaded at once
+    size_t needed = (slot(new_count - 1) / ARITY + 1) * ARITY;
+    if ( needed <= capacity ) return;
+
+    size_t new_capacity = capacity == 0 ? 8 * ARITY : capacity;
+    while ( new_capacity < needed ) {
+        new_capacity *= 2;
+    }
+
+    SimTime_t* new_times =
+        static_cast<SimTime_t*>(::operator new(new_capacity * sizeof(SimTime_t), std::align_val_t(64)));
+    if ( capacity != 0 ) memcpy(new_times, times, capacity * sizeof(SimTime_t));
+    for ( size_t i = capacity; i < new_capacity; ++i ) {
+        new_times[i] = MAX_SIMTIME_T;
+    }
+    ::operator delete(times, std::align_val_t(64));
+    times    = new_times;
+    capacity = new_capacity;
+    keys.resize(new_capacity);
+}
+
+template <bool TS>
+size_t
+TimeVortexSimdHeapBase<TS>::minChild(size_t first, size_t valid) const
+{
+    // Get the mask of the children with the earliest time.  Slots past
+    // the end of the heap hold MAX_SIMTIME_T, so they never make the
+    // minimum smaller, and are masked off afterwards.
+    const SimTime_t* group = times + first;
+    uint32_t         mask;
+#if defined(__AVX512F__)
+    __m512i t = _mm512_load_si512(group);
+    mask      = _mm512_cmpeq_epu64_mask(t, _mm512_set1_epi64(_mm512_reduce_min_epu64(t)));
+#elif defined(__AVX2__)
+    // AVX2 only compares signed 64 bit values, so the sign bits are
+    // flipped to get the unsigned order
+    const __m256i bias = _mm256_set1_epi64x(INT64_MIN);
+    __m256i       lo   = _mm256_xor_si256(_mm256_load_si256((const __m256i*)group), bias);
+    __m256i       hi   = _mm256_xor_si256(_mm256_load_si256((const __m256i*)(group + 4)), bias);
+    __m256i       min  = _mm256_blendv_epi8(lo, hi, _mm256_cmpgt_epi64(lo, hi));
+    __m256i       swap = _mm256_permute4x64_epi64(min, _MM_SHUFFLE(1, 0, 3, 2));
+    min                = _mm256_blendv_epi8(min, swap, _mm256_cmpgt_epi64(min, swap));
+    swap               = _mm256_shuffle_epi32(min, _MM_SHUFFLE(1, 0, 3, 2));
+    min                = _mm256_blendv_epi8(min, swap, _mm256_cmpgt_epi64(min, swap));
+    mask               = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(lo, min))) |
+           (_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(hi, min))) << 4);
+#else
+    SimTime_t min = group[0];
+    for ( size_t i = 1; i < valid; ++i ) {
+        if ( group[i] < min ) min = group[i];
+    }
+    mask = 0;
+    for ( size_t i = 0; i < valid; ++i ) {
+        if ( group[i] == min ) mask |= 1u << i;
+    }
+#endif
+    mask &= (1u << valid) - 1;
+
+    // Ties on the time are broken by the rest of the key
+    size_t best = __builtin_ctz(mask);
+    mask &= mask - 1;
+    while ( mask != 0 ) {
+        size_t i = __builtin_ctz(mask);
+        if ( keys[first + i] < keys[first + best] ) best = i;
+        mask &= mask - 1;
+    }
+    return first + best;
+}
+
+template <bool TS>
+void
+TimeVortexSimdHeapBase<TS>::siftUp(size_t pos, SimTime_t time, const HeapKey& key)
+{
+    while ( pos != ROOT ) {
+        size_t up = parent(pos);
+        if ( !less(time, key, times[up], keys[up]) ) break;
+        times[pos] = times[up];
+        keys[pos]  = keys[up];
+        pos        = up;
+    }
+    times[pos] = time;
+    keys[pos]  = key;
+}
+
+template <bool TS>
+void
+TimeVortexSimdHeapBase<TS>::siftDown(size_t pos, SimTime_t time, const HeapKey& key)
+{
+    const size_t last = slot(count - 1);
+    while ( true ) {
+        size_t first = firstChild(pos);
+        if ( first > last ) break;
+        size_t valid = last - first + 1 < ARITY ? last - first + 1 : ARITY;
+
+        size_t min = minChild(first, valid);
+        if ( !less(times[min], keys[min], time, key) ) break;
+        times[pos] = times[min];
+        keys[pos]  = keys[min];
+        pos        = min;
+    }
+    times[pos] = time;
+    keys[pos]  = key;
+}
+
+template <bool TS>
+void
+TimeVortexSimdHeapBase<TS>::insert(Activity* activity)
+{
+    if ( TS ) slock.lock();
+    SimTime_t time;
+    HeapKey   key;
+    makeKey(activity, time, key);
+
+    reserve(count + 1);
+    siftUp(slot(count++), time, key);
+    current_depth++;
+    if ( current_depth > max_depth ) { max_depth = current_depth; }
+    if ( TS ) slock.unlock();
+}
+
+template <bool TS>
+void
+TimeVortexSimdHeapBase<TS>::insertBatch(Activity** begin, Activity** end)
+{
+    if ( TS ) slock.lock();
+    size_t num   = end - begin;
+    size_t start = count;
+    if ( num != 0 ) reserve(start + num);
+    if ( num > start ) {
+        // Cheaper to append everything and rebuild the heap bottom up
+        // than to sift each activity up individually
+        for ( size_t i = 0; i < num; ++i ) {
+            size_t pos = slot(start + i);
+            makeKey(begin[i], times[pos], keys[pos]);
+        }
+        count += num;
+        if ( count > 1 ) {
+            for ( size_t pos = parent(slot(count - 1)) + 1; pos-- > ROOT; ) {
+                HeapKey key = keys[pos];
+                siftDown(pos, times[pos], key);
+            }
+        }
+    }
+    else {
+        SimTime_t time;
+        HeapKey   key;
+        for ( size_t i = 0; i < num; ++i ) {
+            makeKey(begin[i], time, key);
+            siftUp(slot(count++), time, key);
+        }
+    }
+    current_depth += num;
+    if ( current_depth > max_depth ) { max_depth = current_depth; }
+    if ( TS ) slock.unlock();
+}
+
+template <bool TS>
+Activity*
+TimeVortexSimdHeapBase<TS>::pop()
+{
+    if ( TS ) slock.lock();
+    if ( count == 0 ) {
+        if ( TS ) slock.unlock();
+        return nullptr;
+    }
+    Activity* ret_val = keys[ROOT].activity;
+    size_t    last    = slot(--count);
+    SimTime_t time    = times[last];
+    HeapKey   key     = keys[last];
+    times[last]       = MAX_SIMTIME_T;
+    if ( count != 0 ) siftDown(ROOT, time, key);
+    current_depth--;
+    if ( TS ) slock.unlock();
+    return ret_val;
+}
+
+template <bool TS>
+Activity*
+TimeVortexSimdHeapBase<TS>::front()
+{
+    if ( TS ) slock.lock();
+    auto ret = count == 0 ? nullptr : keys[ROOT].activity;
+    if ( TS ) slock.unlock();
+    return ret;
+}
+
+template <bool TS>
+void
+TimeVortexSimdHeapBase<TS>::print(Output& out) const
+{
+    out.output("TimeVortex state:\n");
+
+    // Heap order is not delivery order, so print unsorted
+    for ( size_t i = 0; i < count; ++i ) {
+        out.output("  %s\n", keys[slot(i)].activity->toString().c_str());
+    }
+}
+
+class TimeVortexSimdHeap : public TimeVortexSimdHeapBase<false>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexSimdHeap,
+        "sst",
+        "timevortex.simdheap",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "TimeVortex based on an 8-ary heap whose children are compared with SIMD instructions.")
+
+
+    TimeVortexSimdHeap(Params& params) : TimeVortexSimdHeapBase<false>(params) {}
+    ~TimeVortexSimdHeap() {}
+    SST_ELI_EXPORT(TimeVortexSimdHeap)
+};
+
+class TimeVortexSimdHeap_ts : public TimeVortexSimdHeapBase<true>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexSimdHeap_ts,
+        "sst",
+        "timevortex.simdheap.ts",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Thread safe verion of TimeVortex based on an 8-ary SIMD heap.  Do not reference this element directly, just specify sst.timevortex.simdheap and this version will be selected when it is needed based on other parameters.")
+
+
+    TimeVortexSimdHeap_ts(Params& params) : TimeVortexSimdHeapBase<true>(params) {}
+    ~TimeVortexSimdHeap_ts() {}
+    SST_ELI_EXPORT(TimeVortexSimdHeap_ts)
+};
+
+} // namespace IMPL
+
+// Run loops with the calls to these TimeVortices inlined
+template bool Simulation_impl::runLoop<IMPL::TimeVortexSimdHeapBase<false>>();
+template bool Simulation_impl::runLoop<IMPL::TimeVortexSimdHeapBase<true>>();
+
+} // namespace SST
@@ -0,0 +1,129 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXSIMDHEAP_H
+#define SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXSIMDHEAP_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/timeVortex.h"
+
+#include <vector>
+
+namespace SST {
+
+class Output;
+
+namespace IMPL {
+
+/**
+ * Primary Event Queue based on an 8-ary heap laid out so the children
+ * of a node can be compared with SIMD instructions.
+ *
+ * The delivery times are kept in an array of their own, apart from
+ * the rest of the sort key, and the root is put after 7 unused slots
+ * so the eight children of every node fill one cache line of times.
+ * The smallest child is found with one load, a vector min and a
+ * compare that gives a mask of the children with that time; the rest
+ * of the key is only read for children that tie.  Compared to the
+ * 4-ary TimeVortexDHeap, a pop does more comparisons but goes through
+ * half as many levels.
+ *
+ * AVX-512 or AVX2 is used when SST is compiled for it (e.g. with
+ * -march=native), otherwise the children are compared one at a time.
+ */
+template <bool TS>
+class TimeVortexSimdHeapBase : public TimeVortex
+{
+
+public:
+    TimeVortexSimdHeapBase(Params& params);
+    ~TimeVortexSimdHeapBase();
+
+    bool      empty() override;
+    int       size() override;
+    void      insert(Activity* activity) override;
+    void      insertBatch(Activity** begin, Activity** end) override;
+    Activity* pop() override;
+    Activity* front() override;
+
+    /** Print the state of the TimeVortex */
+    void print(Output& out) const override;
+
+    uint64_t getCurrentDepth() const override { return current_depth; }
+    uint64_t getMaxDepth() const override { return max_depth; }
+
+private:
+    /** Number of children of each heap node */
+    static constexpr size_t ARITY = 8;
+
+    /** Sort key stored in the heap, except for the delivery time */
+    struct HeapKey
+    {
+        uint64_t  priority_order;
+        uint64_t  queue_order;
+        Activity* activity;
+
+        inline bool operator<(const HeapKey& rhs) const
+        {
+            if ( priority_order != rhs.priority_order ) return priority_order < rhs.priority_order;
+            return queue_order < rhs.queue_order;
+        }
+    };
+
+    static inline bool less(SimTime_t time, const HeapKey& key, SimTime_t rhs_time, const HeapKey& rhs_key)
+    {
+        if ( time != rhs_time ) return time < rhs_time;
+        return key < rhs_key;
+    }
+
+    /** Slot of the heap entry with the given index.  The root is in
+     * slot 7, after 7 empty slots, which lines the children of every
+     * node up on a group of 8 slots. */
+    static inline size_t slot(size_t index) { return index + ARITY - 1; }
+
+    static constexpr size_t ROOT = ARITY - 1;
+
+    static inline size_t parent(size_t pos) { return pos / ARITY + ARITY - 2; }
+    static inline size_t firstChild(size_t pos) { return (pos + 2 - ARITY) * ARITY; }
+
+    inline void makeKey(Activity* activity, SimTime_t& time, HeapKey& key)
+    {
+        activity->setQueueOrder(insertOrder++);
+        time               = activity->getDeliveryTime();
+        key.priority_order = ((uint64_t)(uint32_t)activity->getPriority() << 32) | activity->getOrderTag();
+        key.queue_order    = activity->getQueueOrder();
+        key.activity       = activity;
+    }
+
+    size_t minChild(size_t first, size_t valid) const;
+    void   reserve(size_t count);
+    void   siftUp(size_t pos, SimTime_t time, const HeapKey& key);
+    void   siftDown(size_t pos, SimTime_t time, const HeapKey& key);
+
+    // Data.  Slots past the end of the heap have a time of
+    // MAX_SIMTIME_T, and are allocated in whole groups, so a group of
+    // children can always be loaded at once.
+    SimTime_t*           times;
+    std::vector<HeapKey> keys;
+    size_t               capacity;
+    size_t               count; // Number of entries
+    uint64_t             insertOrder;
+
+    // Need current depth to be atomic if we are thread safe
+    typename std::conditional<TS, std::atomic<uint64_t>, uint64_t>::type current_depth;
+
+    CACHE_ALIGNED(SST::Core::ThreadSafe::Spinlock, slock);
+};
+
+} // namespace IMPL
+} // namespace SST
+
+#endif // SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXSIMDHEAP_H
@@ -0,0 +1,364 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/timevortex/timeVortexSpill.h"
+
+#include "sst/core/event.h"
+#include "sst/core/output.h"
+#include "sst/core/serialization/serializer.h"
+#include "sst/core/simulation_runloop.h"
+#include "sst/core/timeLord.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <unistd.h>
+
+namespace SST {
+namespace IMPL {
+
+template <bool TS>
+TimeVortexSpillBase<TS>::TimeVortexSpillBase(Params& params) :
+    TimeVortex(),
+    far_min(MAX_SIMTIME_T),
+    far_count(0),
+    file(nullptr),
+    insertOrder(0),
+    max_depth(0),
+    spilled(0),
+    current_depth(0)
+{
+    horizon = Simulation_impl::getTimeLord()->getSimCycles(
+        params.find<std::string>("horizon", "1us"), "spill TimeVortex horizon");
+    if ( horizon == 0 ) {
+        Output::getDefaultObject().fatal(
+            CALL_INFO, 1, "ERROR: Spill TimeVortex horizon %s is less than the core timebase\n",
+            params.find<std::string>("horizon", "1us").c_str());
+    }
+    horizon_end = horizon;
+
+    spill_size = params.find<size_t>("spill_size", 1048576);
+    block_size = params.find<size_t>("block_size", 4096);
+    spill_dir  = params.find<std::string>("spill_dir", "");
+    if ( spill_size == 0 || block_size == 0 ) {
+        Output::getDefaultObject().fatal(
+            CALL_INFO, 1, "ERROR: Spill TimeVortex spill_size and block_size must be greater than zero\n");
+    }
+}
+
+template <bool TS>
+TimeVortexSpillBase<TS>::~TimeVortexSpillBase()
+{
+    // Activities in memory all need to be deleted.  The ones in the
+    // file go away with it.
+    while ( !near.empty() ) {
+        delete near.top();
+        near.pop();
+    }
+    for ( auto x : far_mem ) {
+        delete x;
+    }
+    for ( auto x : spill_buf ) {
+        delete x;
+    }
+    if ( file != nullptr ) fclose(file);
+}
+
+template <bool TS>
+bool
+TimeVortexSpillBase<TS>::empty()
+{
+    return current_depth == 0;
+}
+
+template <bool TS>
+int
+TimeVortexSpillBase<TS>::size()
+{
+    return current_depth;
+}
+
+template <bool TS>
+void
+TimeVortexSpillBase<TS>::place(Activity* activity)
+{
+    activity->setQueueOrder(insertOrder++);
+
+    SimTime_t time = activity->getDeliveryTime();
+    if ( time < horizon_end ) {
+        near.push(activity);
+        return;
+    }
+
+    far_min = std::min(far_min, time);
+    far_count++;
+    if ( dynamic_cast<Event*>(activity) == nullptr ) {
+        far_mem.push_back(activity);
+        return;
+    }
+    spill_buf.push_back(activity);
+    if ( spill_buf.size() >= spill_size ) spill();
+}
+
+template <bool TS>
+void
+TimeVortexSpillBase<TS>::insert(Activity* activity)
+{
+    if ( TS ) slock.lock();
+    place(activity);
+    refill();
+    current_depth++;
+    if ( current_depth > max_depth ) { max_depth = current_depth; }
+    if ( TS ) slock.unlock();
+}
+
+template <bool TS>
+void
+TimeVortexSpillBase<TS>::insertBatch(Activity** begin, Activity** end)
+{
+    if ( TS ) slock.lock();
+    for ( Activity** it = begin; it != end; ++it ) {
+        place(*it);
+    }
+    refill();
+    current_depth += end - begin;
+    if ( current_depth > max_depth ) { max_depth = current_depth; }
+    if ( TS ) slock.unlock();
+}
+
+template <bool TS>
+Activity*
+TimeVortexSpillBase<TS>::pop()
+{
+    if ( TS ) slock.lock();
+    if ( near.empty() ) {
+        if ( TS ) slock.unlock();
+        return nullptr;
+    }
+    Activity* ret_val = near.top();
+    near.pop();
+    refill();
+    current_depth--;
+    if ( TS ) slock.unlock();
+    return ret_val;
+}
+
+template <bool TS>
+Activity*
+TimeVortexSpillBase<TS>::front()
+{
+    if ( TS ) slock.lock();
+    auto ret = near.empty() ? nullptr : near.top();
+    if ( TS ) slock.unlock();
+    return ret;
+}
+
+template <bool TS>
+void
+TimeVortexSpillBase<TS>::spill()
+{
+    if ( file == nullptr ) {
+        if ( spill_dir.empty() ) { file = tmpfile(); }
+        else {
+            // Unlinked right away so the file goes away however the
+            // simulation ends
+            std::string name = spill_dir + "/sst_spill_XXXXXX";
+            int         fd   = mkstemp(&name[0]);
+            if ( fd != -1 ) {
+                unlink(name.c_str());
+                file = fdopen(fd, "w+b");
+            }
+        }
+        if ( file == nullptr ) {
+            Output::getDefaultObject().fatal(
+                CALL_INFO, 1, "ERROR: Spill TimeVortex could not create a spill file in %s: %s\n",
+                spill_dir.empty() ? "the temporary directory" : spill_dir.c_str(), strerror(errno));
+        }
+    }
+
+    // Runs are appended to the end of the file
+    std::sort(spill_buf.begin(), spill_buf.end(), Activity::less<true, true, true>());
+    fseeko(file, 0, SEEK_END);
+    off_t offset = ftello(file);
+
+    std::vector<Activity*> activities;
+    std::vector<uint64_t>  orders;
+    for ( size_t start = 0; start < spill_buf.size(); start += block_size ) {
+        size_t end = std::min(start + block_size, spill_buf.size());
+        activities.assign(spill_buf.begin() + start, spill_buf.begin() + end);
+
+        // The queue order isn't serialized with the activities
+        orders.clear();
+        for ( auto x : activities ) {
+            orders.push_back(x->getQueueOrder());
+        }
+
+        SST::Core::Serialization::serializer ser;
+        ser.start_packing(buffer);
+        ser& activities;
+        ser& orders;
+        size_t size = ser.size();
+
+        if ( fwrite(buffer.data(), 1, size, file) != size ) {
+            Output::getDefaultObject().fatal(
+                CALL_INFO, 1, "ERROR: Spill TimeVortex could not write to the spill file: %s\n", strerror(errno));
+        }
+        blocks.push_back(Block { offset, size, activities.front()->getDeliveryTime() });
+        offset += size;
+    }
+
+    spilled += spill_buf.size();
+    for ( auto x : spill_buf ) {
+        delete x;
+    }
+    spill_buf.clear();
+}
+
+template <bool TS>
+void
+TimeVortexSpillBase<TS>::load(const Block& block)
+{
+    buffer.resize(block.size);
+    fseeko(file, block.offset, SEEK_SET);
+    if ( fread(buffer.data(), 1, block.size, file) != block.size ) {
+        Output::getDefaultObject().fatal(
+            CALL_INFO, 1, "ERROR: Spill TimeVortex could not read from the spill file: %s\n", strerror(errno));
+    }
+
+    std::vector<Activity*> activities;
+    std::vector<uint64_t>  orders;
+
+    SST::Core::Serialization::serializer ser;
+    ser.start_unpacking(buffer.data(), block.size);
+    ser& activities;
+    ser& orders;
+
+    for ( size_t i = 0; i < activities.size(); ++i ) {
+        activities[i]->setQueueOrder(orders[i]);
+        near.push(activities[i]);
+    }
+    far_count -= activities.size();
+}
+
+template <bool TS>
+void
+TimeVortexSpillBase<TS>::advance()
+{
+    // Everything not in the priority queue is at or after far_min
+    horizon_end = far_min > MAX_SIMTIME_T - horizon ? MAX_SIMTIME_T : far_min + horizon;
+    far_min     = MAX_SIMTIME_T;
+
+    auto bring_in = [this](std::vector<Activity*>& list) {
+        size_t kept = 0;
+        for ( auto x : list ) {
+            if ( x->getDeliveryTime() < horizon_end ) {
+                near.push(x);
+                far_count--;
+            }
+            else {
+                far_min      = std::min(far_min, x->getDeliveryTime());
+                list[kept++] = x;
+            }
+        }
+        list.resize(kept);
+    };
+    bring_in(far_mem);
+    bring_in(spill_buf);
+
+    // Blocks are read whole, so some of what they hold can be past
+    // the horizon.  That's fine, since everything left out is still
+    // past it.
+    size_t kept = 0;
+    for ( auto& block : blocks ) {
+        if ( block.first_time < horizon_end ) { load(block); }
+        else {
+            far_min        = std::min(far_min, block.first_time);
+            blocks[kept++] = block;
+        }
+    }
+    blocks.resize(kept);
+
+    // Nothing left in the file, so start it over
+    if ( blocks.empty() && file != nullptr ) {
+        fflush(file);
+        if ( ftruncate(fileno(file), 0) != 0 ) {
+            Output::getDefaultObject().fatal(
+                CALL_INFO, 1, "ERROR: Spill TimeVortex could not truncate the spill file: %s\n", strerror(errno));
+        }
+    }
+}
+
+template <bool TS>
+void
+TimeVortexSpillBase<TS>::print(Output& out) const
+{
+    out.output(
+        "TimeVortex state: %zu activities before %" PRIu64 ", %" PRIu64 " after it (%zu blocks on disk, %" PRIu64
+        " events spilled in total)\n",
+        near.size(), horizon_end, far_count, blocks.size(), spilled);
+}
+
+class TimeVortexSpill : public TimeVortexSpillBase<false>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexSpill,
+        "sst",
+        "timevortex.spill",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "[EXPERIMENTAL] TimeVortex that writes events past a time horizon to a temporary file and reads them back as the horizon moves forward.  Every event scheduled past the horizon must be serializable.")
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {"horizon", "Length of simulated time kept in memory", "1us"},
+        {"spill_size", "Number of events past the horizon buffered before they are written to the file", "1048576"},
+        {"block_size", "Number of events in each block read back from the file", "4096"},
+        {"spill_dir", "Directory for the spill file.  Uses the system temporary directory if empty", ""}
+    )
+
+    TimeVortexSpill(Params& params) : TimeVortexSpillBase<false>(params) {}
+    ~TimeVortexSpill() {}
+    SST_ELI_EXPORT(TimeVortexSpill)
+};
+
+class TimeVortexSpill_ts : public TimeVortexSpillBase<true>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexSpill_ts,
+        "sst",
+        "timevortex.spill.ts",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "[EXPERIMENTAL] Thread safe verion of TimeVortex that writes events past a time horizon to a temporary file.  Do not reference this element directly, just specify sst.timevortex.spill and this version will be selected when it is needed based on other parameters.")
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {"horizon", "Length of simulated time kept in memory", "1us"},
+        {"spill_size", "Number of events past the horizon buffered before they are written to the file", "1048576"},
+        {"block_size", "Number of events in each block read back from the file", "4096"},
+        {"spill_dir", "Directory for the spill file.  Uses the system temporary directory if empty", ""}
+    )
+
+    TimeVortexSpill_ts(Params& params) : TimeVortexSpillBase<true>(params) {}
+    ~TimeVortexSpill_ts() {}
+    SST_ELI_EXPORT(TimeVortexSpill_ts)
+};
+
+} // namespace IMPL
+
+// Run loops with the calls to these TimeVortices inlined
+template bool Simulation_impl::runLoop<IMPL::TimeVortexSpillBase<false>>();
+template bool Simulation_impl::runLoop<IMPL::TimeVortexSpillBase<true>>();
+
+} // namespace SST
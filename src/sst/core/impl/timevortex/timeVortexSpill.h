@@ -0,0 +1,143 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXSPILL_H
+#define SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXSPILL_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/timeVortex.h"
+
+#include <cstdio>
+#include <queue>
+#include <string>
+#include <vector>
+
+namespace SST {
+
+class Output;
+
+namespace IMPL {
+
+/**
+ * TimeVortex that keeps only the activities inside a time horizon in
+ * memory.
+ *
+ * Activities due before the end of the horizon go in a priority
+ * queue.  Events due after it are collected in a buffer, and when the
+ * buffer is full it is sorted and written to a temporary file as a run
+ * of serialized blocks, keeping only the first delivery time and
+ * location of each block in memory.  Other activities (clocks, one
+ * shots, etc) are few and aren't serializable, so they stay in memory.
+ * When the priority queue runs out of activities inside the horizon,
+ * the horizon moves forward to start at the earliest activity left and
+ * everything inside it is read back.
+ *
+ * Spilled events are replaced by the copies read back, so every Event
+ * that can be scheduled past the horizon must be serializable, and
+ * nothing may hold a pointer to an event after it is sent, the same
+ * as for events that cross ranks.
+ */
+template <bool TS>
+class TimeVortexSpillBase : public TimeVortex
+{
+
+public:
+    TimeVortexSpillBase(Params& params);
+    ~TimeVortexSpillBase();
+
+    bool      empty() override;
+    int       size() override;
+    void      insert(Activity* activity) override;
+    void      insertBatch(Activity** begin, Activity** end) override;
+    Activity* pop() override;
+    Activity* front() override;
+
+    /** Print the state of the TimeVortex */
+    void print(Output& out) const override;
+
+    uint64_t getCurrentDepth() const override { return current_depth; }
+    uint64_t getMaxDepth() const override { return max_depth; }
+
+private:
+    typedef std::priority_queue<Activity*, std::vector<Activity*>, Activity::greater<true, true, true>> dataType_t;
+
+    /** A sorted block of serialized events in the spill file */
+    struct Block
+    {
+        off_t     offset;
+        size_t    size;
+        SimTime_t first_time;
+    };
+
+    /** Put an activity in the right tier.  Lock must be held */
+    void place(Activity* activity);
+
+    /** Write the spill buffer to the file as a sorted run of blocks */
+    void spill();
+
+    /** Move the horizon to start at the earliest activity not in the
+     * priority queue and bring in everything inside it */
+    void advance();
+
+    /** Read a block back into the priority queue */
+    void load(const Block& block);
+
+    /** Make sure the next activity is in the priority queue.  Called
+     * at the end of everything that changes the queue, so front()
+     * never has to move the horizon */
+    inline void refill()
+    {
+        if ( far_count != 0 && (near.empty() || near.top()->getDeliveryTime() >= horizon_end) ) advance();
+    }
+
+    // Activities due before horizon_end
+    dataType_t near;
+
+    // Activities due at or after horizon_end.  far_min is the earliest
+    // delivery time of all of them and far_count is how many there are
+    std::vector<Activity*> far_mem;
+    std::vector<Activity*> spill_buf;
+    std::vector<Block>     blocks;
+    SimTime_t              far_min;
+    uint64_t               far_count;
+
+    // Width and end of the horizon
+    SimTime_t horizon;
+    SimTime_t horizon_end;
+
+    // Number of events buffered before writing a run, and number of
+    // events in each block of a run
+    size_t spill_size;
+    size_t block_size;
+
+    // Spill file, created the first time a run is written
+    std::string spill_dir;
+    FILE*       file;
+
+    // Reused for packing and unpacking blocks
+    std::vector<char> buffer;
+
+    uint64_t insertOrder;
+
+    // Stats about usage
+    uint64_t max_depth;
+    uint64_t spilled;
+
+    // Need current depth to be atomic if we are thread safe
+    typename std::conditional<TS, std::atomic<uint64_t>, uint64_t>::type current_depth;
+
+    CACHE_ALIGNED(SST::Core::ThreadSafe::Spinlock, slock);
+};
+
+} // namespace IMPL
+} // namespace SST
+
+#endif // SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXSPILL_H
@@ -80,5 +80,28 @@ SimpleNetwork::recvInitData()
     return ret;
 }
 
+size_t
+SimpleNetwork::sendMany(const std::vector<Request*>& reqs, int vn)
+{
+    size_t sent = 0;
+    while ( sent < reqs.size() && send(reqs[sent], vn) ) {
+        sent++;
+    }
+    return sent;
+}
+
+size_t
+SimpleNetwork::recvMany(std::vector<Request*>& reqs, size_t max_count, int vn)
+{
+    size_t received = 0;
+    while ( received < max_count ) {
+        Request* req = recv(vn);
+        if ( nullptr == req ) break;
+        reqs.push_back(req);
+        received++;
+    }
+    return received;
+}
+
 } // namespace Interfaces
 } // namespace SST
@@ -21,8 +21,10 @@
 #include "sst/core/subcomponent.h"
 #include "sst/core/warnmacros.h"
 
+#include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace SST {
 
@@ -68,8 +70,15 @@ public:
         bool   tail;           /*!< True if this is the tail of a steram */
         bool   allow_adaptive; /*!< Indicates whether adaptive routing is allowed or not. */
 
+        /**
+           Payload bytes that are shared by every copy of a request
+           and are never modified after they are given to one
+         */
+        typedef std::shared_ptr<const std::vector<uint8_t>> SharedPayload;
+
     private:
-        Event* payload; /*!< Payload of the request */
+        Event*        payload;        /*!< Payload of the request */
+        SharedPayload shared_payload; /*!< Shared payload of the request */
 
     public:
         /**
@@ -100,6 +109,30 @@ public:
         */
         inline Event* inspectPayload() { return payload; }
 
+        /**
+           Sets the shared payload of this request.  A request can
+           have both an Event payload and a shared payload.  Copies of
+           the request made by clone() refer to the same bytes instead
+           of copying them, so a network can pass a request along
+           every hop without copying a large payload.  The bytes are
+           only serialized when the request crosses ranks.
+           @param data Bytes to share, which must not be modified
+         */
+        inline void giveSharedPayload(SharedPayload data) { shared_payload = std::move(data); }
+
+        /**
+           Returns the shared payload of the request and clears it
+           from the request
+           @return Shared payload, or nullptr if there is none
+         */
+        inline SharedPayload takeSharedPayload() { return std::move(shared_payload); }
+
+        /**
+           Returns the shared payload of the request for inspection
+           @return Shared payload, or nullptr if there is none
+         */
+        inline const SharedPayload& inspectSharedPayload() const { return shared_payload; }
+
         /**
          * Trace types
          */
@@ -144,6 +177,8 @@ public:
             Request* req = new Request(*this);
             // Copy constructor only makes a shallow copy, need to
             // clone the event.//构造函数只进行了浅拷贝，还需要对事件进行深拷贝
+            // The shared payload is immutable, so the copy refers to
+            // the same bytes.
             if ( payload != nullptr ) req->payload = payload->clone();
             return req;
         }
@@ -165,6 +200,22 @@ public:
             ser& trace;
             ser& traceID;
             ser& allow_adaptive;
+
+            // The bytes of a shared payload are sent once per request
+            bool has_shared = (shared_payload != nullptr);
+            ser& has_shared;
+            if ( !has_shared ) return;
+            if ( ser.mode() == SST::Core::Serialization::serializer::UNPACK ) {
+                auto                  data  = std::make_shared<std::vector<uint8_t>>();
+                std::vector<uint8_t>& bytes = *data;
+                ser&                  bytes;
+                shared_payload = std::move(data);
+            }
+            else {
+                // Sizing and packing only read the bytes
+                std::vector<uint8_t>& bytes = const_cast<std::vector<uint8_t>&>(*shared_payload);
+                ser&                  bytes;
+            }
         }
 
     protected:
@@ -299,6 +350,38 @@ public:
      */
     virtual Request* recv(int vn) = 0;
 
+    /**
+     * Send several Requests to the network on the same virtual
+     * network.  Requests are sent in order until one can't be sent.
+     * The ones that were sent belong to the network, the rest still
+     * belong to the caller.
+     *
+     * The default implementation calls send() for each Request.
+     * Implementations can override it to check and take the credits
+     * for the whole batch at once.
+     *
+     * @param reqs Requests to send
+     * @param vn Virtual network to send on
+     * @return Number of Requests sent, from the front of reqs
+     */
+    virtual size_t sendMany(const std::vector<Request*>& reqs, int vn);
+
+    /**
+     * Receive up to max_count Requests from the network.
+     *
+     * The default implementation calls recv() until it returns
+     * nullptr or max_count Requests have been received.
+     * Implementations can override it to return the credits for the
+     * whole batch at once.
+     *
+     * @param reqs Vector the received Requests are appended to.  The
+     * caller is responsible for deleting them.
+     * @param max_count Largest number of Requests to receive
+     * @param vn Virtual network to receive on
+     * @return Number of Requests received
+     */
+    virtual size_t recvMany(std::vector<Request*>& reqs, size_t max_count, int vn);
+
     virtual void setup() override {}
     virtual void init(unsigned int UNUSED(phase)) override {}
     virtual void complete(unsigned int UNUSED(phase)) override {}
@@ -15,3 +15,9 @@
 #include "sst/core/interfaces/stdMem.h"
 
 std::atomic<SST::Interfaces::StandardMem::Request::id_t> SST::Interfaces::StandardMem::Request::main_id(0);
+
+SST::Interfaces::StandardMem::ReadResp*
+SST::Interfaces::StandardMem::Read::makeResponse(Payload&& respData)
+{
+    return new ReadResp(this, std::move(respData));
+}
@@ -15,17 +15,25 @@
 #define SST_CORE_INTERFACES_STANDARDMEM_H
 
 #include "sst/core/link.h"
+#include "sst/core/mempool.h"
 #include "sst/core/params.h"
+#include "sst/core/serialization/serializer.h"
 #include "sst/core/sst_types.h"
 #include "sst/core/ssthandler.h"
 #include "sst/core/subcomponent.h"
 #include "sst/core/warnmacros.h"
 
+#include <algorithm>
 #include <atomic>
 #include <climits>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
 #include <map>
+#include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace SST {
 
@@ -107,9 +115,208 @@ public:
 #define PRI_ADDR PRIx64
 
     /**
-     * Base class for StandardMem commands
+     * Data carried by requests and responses.  It has the interface of
+     * a std::vector<uint8_t> and converts to and from one, but up to a
+     * cache line of data is stored in the object itself, so the common
+     * small accesses don't allocate.  Larger payloads are on the heap.
      */
-    class Request
+    class Payload
+    {
+    public:
+        typedef uint8_t        value_type;
+        typedef size_t         size_type;
+        typedef uint8_t&       reference;
+        typedef const uint8_t& const_reference;
+        typedef uint8_t*       iterator;
+        typedef const uint8_t* const_iterator;
+
+        /** Largest payload stored without allocating */
+        static const size_t INLINE_SIZE = 64;
+
+        Payload() : ptr(buf), len(0), cap(INLINE_SIZE) {}
+        explicit Payload(size_t count, uint8_t value = 0) : Payload() { assign(count, value); }
+        Payload(std::initializer_list<uint8_t> init) : Payload() { assign(init.begin(), init.end()); }
+        Payload(const std::vector<uint8_t>& v) : Payload() { assign(v.begin(), v.end()); }
+        Payload(const Payload& other) : Payload() { assign(other.begin(), other.end()); }
+        Payload(Payload&& other) noexcept : Payload() { take(other); }
+
+        template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+        Payload(InputIt first, InputIt last) : Payload()
+        {
+            assign(first, last);
+        }
+
+        ~Payload()
+        {
+            if ( ptr != buf ) delete[] ptr;
+        }
+
+        Payload& operator=(const Payload& other)
+        {
+            if ( this != &other ) assign(other.begin(), other.end());
+            return *this;
+        }
+
+        Payload& operator=(Payload&& other) noexcept
+        {
+            if ( this != &other ) {
+                if ( ptr != buf ) delete[] ptr;
+                ptr = buf;
+                cap = INLINE_SIZE;
+                take(other);
+            }
+            return *this;
+        }
+
+        Payload& operator=(const std::vector<uint8_t>& v)
+        {
+            assign(v.begin(), v.end());
+            return *this;
+        }
+
+        Payload& operator=(std::initializer_list<uint8_t> init)
+        {
+            assign(init.begin(), init.end());
+            return *this;
+        }
+
+        operator std::vector<uint8_t>() const { return std::vector<uint8_t>(begin(), end()); }
+
+        size_t size() const { return len; }
+        bool   empty() const { return len == 0; }
+        size_t capacity() const { return cap; }
+
+        uint8_t*       data() { return ptr; }
+        const uint8_t* data() const { return ptr; }
+
+        iterator       begin() { return ptr; }
+        iterator       end() { return ptr + len; }
+        const_iterator begin() const { return ptr; }
+        const_iterator end() const { return ptr + len; }
+        const_iterator cbegin() const { return ptr; }
+        const_iterator cend() const { return ptr + len; }
+
+        uint8_t&       operator[](size_t index) { return ptr[index]; }
+        const uint8_t& operator[](size_t index) const { return ptr[index]; }
+
+        uint8_t& at(size_t index)
+        {
+            if ( index >= len ) throw std::out_of_range("StandardMem::Payload::at");
+            return ptr[index];
+        }
+
+        const uint8_t& at(size_t index) const
+        {
+            if ( index >= len ) throw std::out_of_range("StandardMem::Payload::at");
+            return ptr[index];
+        }
+
+        uint8_t&       front() { return ptr[0]; }
+        const uint8_t& front() const { return ptr[0]; }
+        uint8_t&       back() { return ptr[len - 1]; }
+        const uint8_t& back() const { return ptr[len - 1]; }
+
+        void reserve(size_t count)
+        {
+            if ( count <= cap ) return;
+            uint8_t* grown = new uint8_t[count];
+            std::memcpy(grown, ptr, len);
+            if ( ptr != buf ) delete[] ptr;
+            ptr = grown;
+            cap = count;
+        }
+
+        void resize(size_t count, uint8_t value = 0)
+        {
+            reserve(count);
+            if ( count > len ) std::memset(ptr + len, value, count - len);
+            len = count;
+        }
+
+        void clear() { len = 0; }
+
+        void push_back(uint8_t value)
+        {
+            if ( len == cap ) reserve(2 * cap);
+            ptr[len++] = value;
+        }
+
+        void pop_back() { --len; }
+
+        void assign(size_t count, uint8_t value)
+        {
+            clear();
+            resize(count, value);
+        }
+
+        template <typename InputIt>
+        void assign(InputIt first, InputIt last)
+        {
+            clear();
+            insert(end(), first, last);
+        }
+
+        template <typename InputIt>
+        iterator insert(const_iterator pos, InputIt first, InputIt last)
+        {
+            size_t offset = pos - ptr;
+            size_t count  = std::distance(first, last);
+            if ( len + count > cap ) reserve(std::max(len + count, 2 * cap));
+            std::memmove(ptr + offset + count, ptr + offset, len - offset);
+            std::copy(first, last, ptr + offset);
+            len += count;
+            return ptr + offset;
+        }
+
+        iterator insert(const_iterator pos, uint8_t value) { return insert(pos, &value, &value + 1); }
+
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            size_t offset = first - ptr;
+            size_t count  = last - first;
+            std::memmove(ptr + offset, ptr + offset + count, len - offset - count);
+            len -= count;
+            return ptr + offset;
+        }
+
+        iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+
+        bool operator==(const Payload& other) const
+        {
+            return len == other.len && std::equal(begin(), end(), other.begin());
+        }
+        bool operator!=(const Payload& other) const { return !(*this == other); }
+
+    private:
+        // Move the contents of other here.  This object must be empty
+        // and using its inline buffer.
+        void take(Payload& other)
+        {
+            if ( other.ptr != other.buf ) {
+                ptr       = other.ptr;
+                cap       = other.cap;
+                other.ptr = other.buf;
+                other.cap = INLINE_SIZE;
+            }
+            else {
+                std::memcpy(buf, other.buf, other.len);
+            }
+            len       = other.len;
+            other.len = 0;
+        }
+
+        uint8_t* ptr;
+        size_t   len;
+        size_t   cap;
+        uint8_t  buf[INLINE_SIZE];
+    };
+
+    /**
+     * Base class for StandardMem commands.  Requests are allocated
+     * from the same per-thread memory pools as events, so creating
+     * and deleting them does not go through the system allocator.
+     */
+    class Request : public SST::Core::MemPoolItem
     {
     public:
         typedef uint64_t id_t;
@@ -214,6 +421,8 @@ public:
             return str.str();
         }
 
+        NotSerializable(SST::Interfaces::StandardMem::Request)
+
     protected:
         id_t    id;
         flags_t flags;
@@ -261,12 +470,17 @@ public:
          */
         Request* makeResponse() override
         {
-            std::vector<uint8_t> datavec(
-                size, 0); /* Placeholder. If actual data values are used in simulation, the model should update this */
-            ReadResp* resp = new ReadResp(this, datavec);
-            return resp;
+            /* Placeholder. If actual data values are used in simulation, the model should update this */
+            return new ReadResp(this, Payload(size, 0));
         }
 
+        /** Create read response that takes over an existing data buffer,
+         * so the data is not copied.
+         * @param respData Read data, which is moved into the response
+         * @return ReadResp formatted as a response to this Read request
+         */
+        ReadResp* makeResponse(Payload&& respData);
+
         bool needsResponse() override { return true; }
 
         SST::Event* convert(RequestConverter* converter) override { return converter->convert(this); }
@@ -296,23 +510,23 @@ public:
     {
     public:
         ReadResp(
-            id_t rid, Addr physAddr, uint64_t size, std::vector<uint8_t> respData, flags_t flags = 0, Addr virtAddr = 0,
+            id_t rid, Addr physAddr, uint64_t size, Payload respData, flags_t flags = 0, Addr virtAddr = 0,
             Addr instPtr = 0, uint32_t tid = 0) :
             Request(rid, flags),
             pAddr(physAddr),
             vAddr(virtAddr),
             size(size),
-            data(respData),
+            data(std::move(respData)),
             iPtr(instPtr),
             tid(tid)
         {}
 
-        ReadResp(Read* readEv, std::vector<uint8_t> respData) :
+        ReadResp(Read* readEv, Payload respData) :
             Request(readEv->getID(), readEv->getAllFlags()),
             pAddr(readEv->pAddr),
             vAddr(readEv->vAddr),
             size(readEv->size),
-            data(respData),
+            data(std::move(respData)),
             iPtr(readEv->iPtr),
             tid(readEv->tid)
         {}
@@ -335,19 +549,19 @@ public:
             str << ", VirtAddr: 0x" << vAddr << ", Size: " << std::dec << size << ", InstPtr: 0x" << std::hex << iPtr;
             str << ", ThreadID: " << std::dec << tid << ", Payload: 0x" << std::hex;
             str << std::setfill('0');
-            for ( std::vector<uint8_t>::iterator it = data.begin(); it != data.end(); it++ ) {
+            for ( Payload::iterator it = data.begin(); it != data.end(); it++ ) {
                 str << std::setw(2) << static_cast<unsigned>(*it);
             }
             return str.str();
         }
 
         /* Data members */
-        Addr                 pAddr; /* Physical address */
-        Addr                 vAddr; /* Virtual address */
-        uint64_t             size;  /* Number of bytes to read */
-        std::vector<uint8_t> data;  /* Read data */
-        Addr                 iPtr;  /* Instruction pointer - optional metadata */
-        uint32_t             tid;   /* Thread ID */
+        Addr     pAddr; /* Physical address */
+        Addr     vAddr; /* Virtual address */
+        uint64_t size;  /* Number of bytes to read */
+        Payload  data;  /* Read data */
+        Addr     iPtr;  /* Instruction pointer - optional metadata */
+        uint32_t tid;   /* Thread ID */
     };
 
     /** Request to write data.
@@ -359,13 +573,13 @@ public:
     public:
         /* Constructor */
         Write(
-            Addr physAddr, uint64_t size, std::vector<uint8_t> wData, bool posted = false, flags_t flags = 0,
-            Addr virtAddr = 0, Addr instPtr = 0, uint32_t tid = 0) :
+            Addr physAddr, uint64_t size, Payload wData, bool posted = false, flags_t flags = 0, Addr virtAddr = 0,
+            Addr instPtr = 0, uint32_t tid = 0) :
             Request(flags),
             pAddr(physAddr),
             vAddr(virtAddr),
             size(size),
-            data(wData),
+            data(std::move(wData)),
             posted(posted),
             iPtr(instPtr),
             tid(tid)
@@ -390,20 +604,20 @@ public:
             str << ", InstPtr: 0x" << std::hex << iPtr << ", ThreadID: " << std::dec << tid << ", Payload: 0x"
                 << std::hex;
             str << std::setfill('0');
-            for ( std::vector<uint8_t>::iterator it = data.begin(); it != data.end(); it++ ) {
+            for ( Payload::iterator it = data.begin(); it != data.end(); it++ ) {
                 str << std::setw(2) << static_cast<unsigned>(*it);
             }
             return str.str();
         }
 
         /* Data members */
-        Addr                 pAddr;  /* Physical address */
-        Addr                 vAddr;  /* Virtual address */
-        uint64_t             size;   /* Number of bytes to write */
-        std::vector<uint8_t> data;   /* Written data */
-        bool                 posted; /* Whether write is posted (requires no response) */
-        Addr                 iPtr;   /* Instruction pointer - optional metadata */
-        uint32_t             tid;    /* Thread ID */
+        Addr     pAddr;  /* Physical address */
+        Addr     vAddr;  /* Virtual address */
+        uint64_t size;   /* Number of bytes to write */
+        Payload  data;   /* Written data */
+        bool     posted; /* Whether write is posted (requires no response) */
+        Addr     iPtr;   /* Instruction pointer - optional metadata */
+        uint32_t tid;    /* Thread ID */
     };
 
     /** Response to a Write */
@@ -584,9 +798,14 @@ public:
 
         Request* makeResponse() override
         {
-            std::vector<uint8_t> datavec(size, 0); /* This is a placeholder. If actual data values are used in
-                                                      simulation, the model should update this */
-            return new ReadResp(id, pAddr, size, datavec, flags, vAddr, iPtr, tid);
+            /* This is a placeholder. If actual data values are used in simulation, the model should update this */
+            return new ReadResp(id, pAddr, size, Payload(size, 0), flags, vAddr, iPtr, tid);
+        }
+
+        /** Create read response that takes over an existing data buffer */
+        ReadResp* makeResponse(Payload&& respData)
+        {
+            return new ReadResp(id, pAddr, size, std::move(respData), flags, vAddr, iPtr, tid);
         }
 
         bool needsResponse() override { return true; }
@@ -621,13 +840,13 @@ public:
     {
     public:
         WriteUnlock(
-            Addr physAddr, uint64_t size, std::vector<uint8_t> wData, bool posted = false, flags_t flags = 0,
-            Addr virtAddr = 0, Addr instPtr = 0, uint32_t tid = 0) :
+            Addr physAddr, uint64_t size, Payload wData, bool posted = false, flags_t flags = 0, Addr virtAddr = 0,
+            Addr instPtr = 0, uint32_t tid = 0) :
             Request(flags),
             pAddr(physAddr),
             vAddr(virtAddr),
             size(size),
-            data(wData),
+            data(std::move(wData)),
             posted(posted),
             iPtr(instPtr),
             tid(tid)
@@ -652,20 +871,20 @@ public:
             str << ", InstPtr: 0x" << std::hex << iPtr << ", ThreadID: " << std::dec << tid << ", Payload: 0x"
                 << std::hex;
             str << std::setfill('0');
-            for ( std::vector<uint8_t>::iterator it = data.begin(); it != data.end(); it++ ) {
+            for ( Payload::iterator it = data.begin(); it != data.end(); it++ ) {
                 str << std::setw(2) << static_cast<unsigned>(*it);
             }
             return str.str();
         }
 
         /* Data members */
-        Addr                 pAddr;  /* Physical address */
-        Addr                 vAddr;  /* Virtual address */
-        uint64_t             size;   /* Number of bytes to write */
-        std::vector<uint8_t> data;   /* Written data */
-        bool                 posted; /* Whether write is posted (requires no response) */
-        Addr                 iPtr;   /* Instruction pointer - optional metadata */
-        uint32_t             tid;    /* Thread ID */
+        Addr     pAddr;  /* Physical address */
+        Addr     vAddr;  /* Virtual address */
+        uint64_t size;   /* Number of bytes to write */
+        Payload  data;   /* Written data */
+        bool     posted; /* Whether write is posted (requires no response) */
+        Addr     iPtr;   /* Instruction pointer - optional metadata */
+        uint32_t tid;    /* Thread ID */
     };
 
     /**
@@ -692,9 +911,14 @@ public:
 
         Request* makeResponse() override
         {
-            std::vector<uint8_t> datavec(size, 0); /* This is a placeholder. If actual data values are used in
-                                                      simulation, the model should update this */
-            return new ReadResp(id, pAddr, size, datavec, flags, vAddr, iPtr, tid);
+            /* This is a placeholder. If actual data values are used in simulation, the model should update this */
+            return new ReadResp(id, pAddr, size, Payload(size, 0), flags, vAddr, iPtr, tid);
+        }
+
+        /** Create read response that takes over an existing data buffer */
+        ReadResp* makeResponse(Payload&& respData)
+        {
+            return new ReadResp(id, pAddr, size, std::move(respData), flags, vAddr, iPtr, tid);
         }
 
         bool needsResponse() override { return true; }
@@ -729,13 +953,13 @@ public:
     {
     public:
         StoreConditional(
-            Addr physAddr, uint64_t size, std::vector<uint8_t> wData, flags_t flags = 0, Addr virtAddr = 0,
-            Addr instPtr = 0, uint32_t tid = 0) :
+            Addr physAddr, uint64_t size, Payload wData, flags_t flags = 0, Addr virtAddr = 0, Addr instPtr = 0,
+            uint32_t tid = 0) :
             Request(flags),
             pAddr(physAddr),
             vAddr(virtAddr),
             size(size),
-            data(wData),
+            data(std::move(wData)),
             iPtr(instPtr),
             tid(tid)
         {}
@@ -760,19 +984,19 @@ public:
             str << ", InstPtr: 0x" << std::hex << iPtr << ", ThreadID: " << std::dec << tid << ", Payload: 0x"
                 << std::hex;
             str << std::setfill('0');
-            for ( std::vector<uint8_t>::iterator it = data.begin(); it != data.end(); it++ ) {
+            for ( Payload::iterator it = data.begin(); it != data.end(); it++ ) {
                 str << std::setw(2) << static_cast<unsigned>(*it);
             }
             return str.str();
         }
 
         /* Data members */
-        Addr                 pAddr; /* Physical address */
-        Addr                 vAddr; /* Virtual address */
-        uint64_t             size;  /* Number of bytes to write */
-        std::vector<uint8_t> data;  /* Written data */
-        Addr                 iPtr;  /* Instruction pointer - optional metadata */
-        uint32_t             tid;   /* Thread ID */
+        Addr     pAddr; /* Physical address */
+        Addr     vAddr; /* Virtual address */
+        uint64_t size;  /* Number of bytes to write */
+        Payload  data;  /* Written data */
+        Addr     iPtr;  /* Instruction pointer - optional metadata */
+        uint32_t tid;   /* Thread ID */
     };
 
     /* Explicit data movement */
@@ -1207,6 +1431,38 @@ public:
 };
 
 } // namespace Interfaces
+
+namespace Core {
+namespace Serialization {
+
+// Same layout as a std::vector<uint8_t>, so events can switch between them
+template <>
+class serialize<SST::Interfaces::StandardMem::Payload>
+{
+public:
+    void operator()(SST::Interfaces::StandardMem::Payload& v, serializer& ser)
+    {
+        size_t size = v.size();
+        switch ( ser.mode() ) {
+        case serializer::SIZER:
+            ser.size(size);
+            ser.sizer().add(size);
+            break;
+        case serializer::PACK:
+            ser.pack(size);
+            if ( size ) ::memcpy(ser.packer().next_str(size), v.data(), size);
+            break;
+        case serializer::UNPACK:
+            ser.unpack(size);
+            v.resize(size);
+            if ( size ) ::memcpy(v.data(), ser.unpacker().next_str(size), size);
+            break;
+        }
+    }
+};
+
+} // namespace Serialization
+} // namespace Core
 } // namespace SST
 
 #endif // SST_CORE_INTERFACES_STANDARDMEM_H
@@ -25,9 +25,10 @@ class CircularBuffer
 public:
     CircularBuffer(size_t mSize = 0)
     {
-        buffSize   = mSize;
-        readIndex  = 0;
-        writeIndex = 0;
+        buffSize     = mSize;
+        blockingWait = 0;
+        readIndex    = 0;
+        writeIndex   = 0;
     }
 
     bool setBufferSize(const size_t bufferSize)
@@ -42,6 +43,15 @@ public:
         return true;
     }
 
+    /** Set whether a reader waiting on an empty buffer, or a writer
+     * waiting on a full one, sleeps once it has spun for a while.  Must
+     * be set before the buffer is used. */
+    void setBlockingWait(bool blocking)
+    {
+        blockingWait = blocking;
+        __sync_synchronize();
+    }
+
     T read()
     {
         int loop_counter = 0;
@@ -54,11 +64,12 @@ public:
                 readIndex      = (readIndex + 1) % buffSize;
 
                 bufferMutex.unlock();
+                if ( blockingWait ) notFull.notify();
                 return result;
             }
 
             bufferMutex.unlock();
-            bufferMutex.processorPause(loop_counter++);
+            waitNotEmpty(loop_counter);
         }
     }
 
@@ -70,6 +81,7 @@ public:
                 readIndex = (readIndex + 1) % buffSize;
 
                 bufferMutex.unlock();
+                if ( blockingWait ) notFull.notify();
                 return true;
             }
 
@@ -79,6 +91,64 @@ public:
         return false;
     }
 
+    /** Read up to count messages, blocking until at least one is available
+     * return the number of messages read
+     */
+    size_t readMany(T* results, size_t count)
+    {
+        int    loop_counter = 0;
+        size_t n;
+        while ( (n = readManyNB(results, count)) == 0 )
+            waitNotEmpty(loop_counter);
+        return n;
+    }
+
+    /** Read up to count messages without blocking
+     * return the number of messages read, 0 if the buffer was empty
+     * or locked
+     */
+    size_t readManyNB(T* results, size_t count)
+    {
+        size_t n = 0;
+        if ( bufferMutex.try_lock() ) {
+            while ( n < count && readIndex != writeIndex ) {
+                results[n++] = buffer[readIndex];
+                readIndex    = (readIndex + 1) % buffSize;
+            }
+            bufferMutex.unlock();
+            if ( n > 0 && blockingWait ) notFull.notify();
+        }
+        return n;
+    }
+
+    /** Write count messages, blocking until all have been written */
+    void writeMany(const T* values, size_t count)
+    {
+        int loop_counter = 0;
+
+        while ( count > 0 ) {
+            bufferMutex.lock();
+
+            size_t n = 0;
+            while ( n < count && ((writeIndex + 1) % buffSize) != readIndex ) {
+                buffer[writeIndex] = values[n++];
+                writeIndex         = (writeIndex + 1) % buffSize;
+            }
+
+            __sync_synchronize();
+            bufferMutex.unlock();
+
+            if ( n == 0 ) {
+                waitNotFull(loop_counter);
+                continue;
+            }
+            if ( blockingWait ) notEmpty.notify();
+            loop_counter = 0;
+            values += n;
+            count -= n;
+        }
+    }
+
     void write(const T& v)
     {
         int loop_counter = 0;
@@ -92,11 +162,12 @@ public:
 
                 __sync_synchronize();
                 bufferMutex.unlock();
+                if ( blockingWait ) notEmpty.notify();
                 return;
             }
 
             bufferMutex.unlock();
-            bufferMutex.processorPause(loop_counter++);
+            waitNotFull(loop_counter);
         }
     }
 
@@ -108,14 +179,45 @@ public:
         readIndex = writeIndex;
         __sync_synchronize();
         bufferMutex.unlock();
+        if ( blockingWait ) notFull.notify();
     }
 
 private:
-    SSTMutex bufferMutex;
-    size_t   buffSize;
-    size_t   readIndex;
-    size_t   writeIndex;
-    T        buffer[0];
+    void waitNotEmpty(int& loop_counter)
+    {
+        if ( blockingWait && loop_counter >= SST_CORE_INTERPROCESS_SPIN_LIMIT ) {
+            uint32_t seq = notEmpty.prepareWait();
+            if ( __atomic_load_n(&readIndex, __ATOMIC_SEQ_CST) == __atomic_load_n(&writeIndex, __ATOMIC_SEQ_CST) )
+                notEmpty.wait(seq);
+            notEmpty.finishWait();
+        }
+        else {
+            bufferMutex.processorPause(loop_counter++);
+        }
+    }
+
+    void waitNotFull(int& loop_counter)
+    {
+        if ( blockingWait && loop_counter >= SST_CORE_INTERPROCESS_SPIN_LIMIT ) {
+            uint32_t seq = notFull.prepareWait();
+            if ( (__atomic_load_n(&writeIndex, __ATOMIC_SEQ_CST) + 1) % buffSize ==
+                 __atomic_load_n(&readIndex, __ATOMIC_SEQ_CST) )
+                notFull.wait(seq);
+            notFull.finishWait();
+        }
+        else {
+            bufferMutex.processorPause(loop_counter++);
+        }
+    }
+
+    SSTMutex     bufferMutex;
+    size_t       buffSize;
+    int          blockingWait;
+    size_t       readIndex;
+    size_t       writeIndex;
+    SSTWaitQueue notEmpty;
+    SSTWaitQueue notFull;
+    T            buffer[0];
 };
 
 } // namespace Interprocess
@@ -81,6 +81,26 @@ public:
 
         // Finish setup of tunnel with correctly-sized mmap
         tunnel->initialize(shmPtr);
+
+        // The tunnel was added to a TunnelMux, so writes ring its doorbell
+        doorbellPtr = NULL;
+        if ( tunnel->getDoorbellFile() != NULL ) {
+            retval = OS_OpenFD(tunnel->getDoorbellFile(), OS_FILE_OPEN_TYPE_READ | OS_FILE_OPEN_TYPE_WRITE, 0, &fd);
+            if ( OS_RETURN_CODE_IS_SUCCESS(retval) ) {
+                retval = OS_MapFileToMemory(
+                    NATIVE_PID_CURRENT, OS_PAGE_PROTECTION_TYPE_READ | OS_PAGE_PROTECTION_TYPE_WRITE,
+                    sizeof(TunnelDoorbell), OS_MEMORY_FLAGS_SHARED, fd, 0, &doorbellPtr);
+                OS_CloseFD(fd);
+            }
+            if ( !OS_RETURN_CODE_IS_SUCCESS(retval) ) {
+                // Not using Output because IPC means Output might not be available
+                fprintf(
+                    stderr, "Failed to map doorbell '%s' (%d): %s\n", tunnel->getDoorbellFile(),
+                    retval.os_specific_err, strerror(retval.os_specific_err));
+                exit(1);
+            }
+            tunnel->attachDoorbell(doorbellPtr);
+        }
     }
 
     /** Close file and shutdown tunnel */
@@ -88,6 +108,7 @@ public:
     {
         delete tunnel;
         OS_FreeMemory(NATIVE_PID_CURRENT, shmPtr, shmSize);
+        if ( doorbellPtr ) OS_FreeMemory(NATIVE_PID_CURRENT, doorbellPtr, sizeof(TunnelDoorbell));
     }
 
     /** return a pointer to the tunnel */
@@ -100,6 +121,7 @@ private:
     void*       shmPtr;
     std::string filename;
     size_t      shmSize;
+    void*       doorbellPtr;
 
     TunnelType* tunnel;
 };
@@ -12,6 +12,8 @@
 #ifndef SST_CORE_INTERPROCESS_TUNNEL_MMAP_PARENT_H
 #define SST_CORE_INTERPROCESS_TUNNEL_MMAP_PARENT_H
 
+#include "sst/core/interprocess/shmregion.h"
+
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
@@ -45,15 +47,20 @@ public:
      * @param numBuffers Number of buffers for which we should tunnel
      * @param bufferSize How large each core's buffer should be
      * @expectedChildren How many child processes will connect to the tunnel
+     * @param options Huge page and NUMA placement of the region
      */
-    MMAPParent(uint32_t comp_id, size_t numBuffers, size_t bufferSize, uint32_t expectedChildren = 1) :
+    MMAPParent(
+        uint32_t comp_id, size_t numBuffers, size_t bufferSize, uint32_t expectedChildren = 1,
+        const TunnelRegionOptions& options = TunnelRegionOptions()) :
         shmPtr(nullptr),
         fd(-1)
     {
         char key[256];
         memset(key, '\0', sizeof(key));
         do {
-            snprintf(key, sizeof(key), "/tmp/sst_shmem_%u-%" PRIu32 "-%d", getpid(), comp_id, rand());
+            snprintf(
+                key, sizeof(key), "%s/sst_shmem_%u-%" PRIu32 "-%d",
+                options.hugetlbfsDir.empty() ? "/tmp" : options.hugetlbfsDir.c_str(), getpid(), comp_id, rand());
             filename = key;
 
             fd = open(filename.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
@@ -73,7 +80,9 @@ public:
         }
 
         tunnel  = new TunnelType(numBuffers, bufferSize, expectedChildren);
-        shmSize = tunnel->getTunnelSize();
+        // The file may be in hugetlbfs, which can only be sized in whole
+        // huge pages
+        shmSize = RegionUtil::roundToPageSize(fd, tunnel->getTunnelSize());
 
         if ( ftruncate(fd, shmSize) ) {
             // Not using Output because IPC means Output might not be available
@@ -87,6 +96,7 @@ public:
             fprintf(stderr, "mmap failed: %s\n", strerror(errno));
             exit(1);
         }
+        RegionUtil::applyOptions(shmPtr, shmSize, options);
         close(fd);
 
         memset(shmPtr, '\0', shmSize);
@@ -43,7 +43,7 @@ public:
      *
      * @param region_name Name of the shared-memory region to access
      */
-    SHMChild(const std::string& region_name) : shmPtr(nullptr), fd(-1)
+    SHMChild(const std::string& region_name) : shmPtr(nullptr), fd(-1), doorbellPtr(nullptr)
     {
         fd       = shm_open(region_name.c_str(), O_RDWR, S_IRUSR | S_IWUSR);
         filename = region_name;
@@ -74,6 +74,21 @@ public:
         }
         uint32_t childnum = tunnel->initialize(shmPtr);
         if ( childnum == 0 ) { shm_unlink(filename.c_str()); }
+
+        // The tunnel was added to a TunnelMux, so writes ring its doorbell
+        if ( tunnel->getDoorbellFile() != nullptr ) {
+            int bell_fd = open(tunnel->getDoorbellFile(), O_RDWR);
+            if ( bell_fd >= 0 ) {
+                doorbellPtr = mmap(nullptr, sizeof(TunnelDoorbell), PROT_READ | PROT_WRITE, MAP_SHARED, bell_fd, 0);
+                close(bell_fd);
+            }
+            if ( bell_fd < 0 || doorbellPtr == MAP_FAILED ) {
+                // Not using Output because IPC means Output might not be available
+                fprintf(stderr, "Failed to map doorbell '%s': %s\n", tunnel->getDoorbellFile(), strerror(errno));
+                exit(1);
+            }
+            tunnel->attachDoorbell(doorbellPtr);
+        }
     }
 
     /** Destructor */
@@ -89,6 +104,7 @@ public:
             close(fd);
             fd = -1;
         }
+        if ( doorbellPtr ) munmap(doorbellPtr, sizeof(TunnelDoorbell));
     }
 
     /** return a pointer to the tunnel */
@@ -103,6 +119,7 @@ private:
 
     std::string filename;
     size_t      shmSize;
+    void*       doorbellPtr;
 
     TunnelType* tunnel;
 };
@@ -12,6 +12,8 @@
 #ifndef SST_CORE_INTERPROCESS_TUNNEL_SHM_PARENT_H
 #define SST_CORE_INTERPROCESS_TUNNEL_SHM_PARENT_H
 
+#include "sst/core/interprocess/shmregion.h"
+
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
@@ -45,8 +47,12 @@ public:
      * @param numBuffers Number of buffers for which we should tunnel
      * @param bufferSize How large each core's buffer should be
      * @param expectedChildren How many child processes will connect to the tunnel
+     * @param options Huge page and NUMA placement of the region.  Only
+     *   hugePages and numaNode apply to shared memory
      */
-    SHMParent(uint32_t comp_id, size_t numBuffers, size_t bufferSize, uint32_t expectedChildren = 1) :
+    SHMParent(
+        uint32_t comp_id, size_t numBuffers, size_t bufferSize, uint32_t expectedChildren = 1,
+        const TunnelRegionOptions& options = TunnelRegionOptions()) :
         shmPtr(nullptr),
         fd(-1)
     {
@@ -72,7 +78,8 @@ public:
         }
 
         tunnel  = new TunnelType(numBuffers, bufferSize, expectedChildren);
-        shmSize = tunnel->getTunnelSize();
+        // Size the region in whole pages of its file system
+        shmSize = RegionUtil::roundToPageSize(fd, tunnel->getTunnelSize());
 
         if ( ftruncate(fd, shmSize) ) {
             // Not using Output because IPC means Output might not be available
@@ -86,6 +93,7 @@ public:
             fprintf(stderr, "mmap failed: %s\n", strerror(errno));
             exit(1);
         }
+        RegionUtil::applyOptions(shmPtr, shmSize, options);
         memset(shmPtr, '\0', shmSize);
         tunnel->initialize(shmPtr);
     }
@@ -0,0 +1,128 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_INTERPROCESS_SHMREGION_H
+#define SST_CORE_INTERPROCESS_SHMREGION_H
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#include <sys/vfs.h>
+#endif
+
+namespace SST {
+namespace Core {
+namespace Interprocess {
+
+/**
+ * Options for the memory region of a tunnel, given to SHMParent and
+ * MMAPParent.  Huge pages and NUMA placement are only supported on
+ * Linux; elsewhere they are ignored with a warning.
+ */
+struct TunnelRegionOptions
+{
+    /** numaNode value that leaves placement to the kernel */
+    static const int NO_NODE    = -1;
+    /** numaNode value for the node of the thread creating the tunnel,
+     * normally the simulator thread that consumes it */
+    static const int LOCAL_NODE = -2;
+
+    TunnelRegionOptions() : hugePages(false), numaNode(NO_NODE) {}
+
+    /** Ask for transparent huge pages on the region (MADV_HUGEPAGE).
+     * For shared memory this needs
+     * /sys/kernel/mm/transparent_hugepage/shmem_enabled to be "advise"
+     * or "always". */
+    bool hugePages;
+
+    /** MMAPParent only: create the tunnel file in this hugetlbfs mount
+     * (e.g. /dev/hugepages) instead of /tmp, so the region is backed
+     * by preallocated huge pages */
+    std::string hugetlbfsDir;
+
+    /** NUMA node to bind the region to, or NO_NODE or LOCAL_NODE */
+    int numaNode;
+};
+
+namespace RegionUtil {
+
+/** Size of the pages backing fd, which is the huge page size for a
+ * file in hugetlbfs */
+inline size_t
+getPageSize(int fd)
+{
+#if defined(__linux__)
+    struct statfs fs;
+    if ( fstatfs(fd, &fs) == 0 && fs.f_bsize > 0 ) return fs.f_bsize;
+#else
+    (void)fd;
+#endif
+    return sysconf(_SC_PAGESIZE);
+}
+
+/** Round size up to a multiple of the page size of fd, since files in
+ * hugetlbfs can only be sized in whole huge pages */
+inline size_t
+roundToPageSize(int fd, size_t size)
+{
+    size_t page = getPageSize(fd);
+    return (size + page - 1) / page * page;
+}
+
+/** Apply the huge page and NUMA options to a freshly mapped region,
+ * before it is first touched */
+inline void
+applyOptions(void* ptr, size_t size, const TunnelRegionOptions& options)
+{
+#if defined(__linux__)
+    if ( options.hugePages && madvise(ptr, size, MADV_HUGEPAGE) != 0 ) {
+        fprintf(stderr, "WARNING: unable to use huge pages for IPC region: %s\n", strerror(errno));
+    }
+
+    if ( options.numaNode != TunnelRegionOptions::NO_NODE ) {
+        unsigned int cpu  = 0;
+        unsigned int node = options.numaNode;
+        if ( options.numaNode == TunnelRegionOptions::LOCAL_NODE ) syscall(SYS_getcpu, &cpu, &node, NULL);
+
+        unsigned long mask[16];
+        memset(mask, 0, sizeof(mask));
+        if ( node >= sizeof(mask) * 8 ) {
+            fprintf(stderr, "WARNING: NUMA node %u is out of range, IPC region will not be bound\n", node);
+            return;
+        }
+        mask[node / (sizeof(unsigned long) * 8)] |= 1UL << (node % (sizeof(unsigned long) * 8));
+        if ( syscall(SYS_mbind, ptr, size, MPOL_BIND, mask, sizeof(mask) * 8, 0) != 0 ) {
+            fprintf(stderr, "WARNING: unable to bind IPC region to NUMA node %u: %s\n", node, strerror(errno));
+        }
+    }
+#else
+    (void)ptr;
+    (void)size;
+    if ( options.hugePages || options.numaNode != TunnelRegionOptions::NO_NODE ) {
+        fprintf(stderr, "WARNING: huge pages and NUMA placement of IPC regions are only supported on Linux\n");
+    }
+#endif
+}
+
+} // namespace RegionUtil
+
+} // namespace Interprocess
+} // namespace Core
+} // namespace SST
+
+#endif // SST_CORE_INTERPROCESS_SHMREGION_H
@@ -0,0 +1,260 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_INTERPROCESS_SPSCCIRCULARBUFFER_H
+#define SST_CORE_INTERPROCESS_SPSCCIRCULARBUFFER_H
+
+/*
+ * This may be compiled into both SST and an Intel Pin3 tool, so it
+ * has the same restrictions as tunneldef.h (no c++11).  The GCC
+ * __atomic builtins are used in place of std::atomic.
+ */
+
+#include "sstmutex.h"
+
+#include <stddef.h>
+#include <stdio.h>
+
+namespace SST {
+namespace Core {
+namespace Interprocess {
+
+#define SST_CORE_INTERPROCESS_CACHE_LINE 64
+
+/**
+ * Circular buffer for exactly one writer and one reader, which may be
+ * in different processes.  Unlike CircularBuffer, no lock is taken:
+ * the writer only updates writeIndex and the reader only updates
+ * readIndex, and each index is on its own cache line along with the
+ * owner's cached copy of the other index.  The other side's index is
+ * only reloaded when the cached copy says the buffer is full (for the
+ * writer) or empty (for the reader).
+ *
+ * Can be used in place of CircularBuffer in a TunnelDef, provided each
+ * buffer of the tunnel has a single writer and a single reader.
+ *
+ * By default a reader waiting on an empty buffer or a writer waiting on
+ * a full one spins.  With setBlockingWait(true), they spin for a while
+ * and then sleep until the other side makes progress.  This costs the
+ * other side a memory fence per read or write.
+ */
+template <typename T>
+class SPSCCircularBuffer
+{
+
+public:
+    SPSCCircularBuffer(size_t mSize = 0)
+    {
+        buffSize         = mSize;
+        blockingWait     = 0;
+        writeIndex       = 0;
+        cachedReadIndex  = 0;
+        readIndex        = 0;
+        cachedWriteIndex = 0;
+    }
+
+    bool setBufferSize(const size_t bufferSize)
+    {
+        if ( buffSize != 0 ) {
+            fprintf(stderr, "Already specified size for buffer\n");
+            return false;
+        }
+
+        buffSize = bufferSize;
+        __sync_synchronize();
+        return true;
+    }
+
+    /** Set whether waits sleep once they have spun for a while.  Must
+     * be set before the buffer is used. */
+    void setBlockingWait(bool blocking)
+    {
+        blockingWait = blocking;
+        __sync_synchronize();
+    }
+
+    T read()
+    {
+        T result;
+        readMany(&result, 1);
+        return result;
+    }
+
+    bool readNB(T* result) { return readManyNB(result, 1) == 1; }
+
+    /** Read up to count messages, blocking until at least one is available
+     * @param results where to put the messages
+     * @param count maximum number of messages to read
+     * return the number of messages read
+     */
+    size_t readMany(T* results, size_t count)
+    {
+        int    loop_counter = 0;
+        size_t n;
+        while ( (n = readManyNB(results, count)) == 0 )
+            waitNotEmpty(loop_counter);
+        return n;
+    }
+
+    /** Read up to count messages without blocking
+     * @param results where to put the messages
+     * @param count maximum number of messages to read
+     * return the number of messages read, 0 if the buffer was empty
+     */
+    size_t readManyNB(T* results, size_t count)
+    {
+        size_t readPos = readIndex;
+        if ( readPos == cachedWriteIndex ) {
+            cachedWriteIndex = __atomic_load_n(&writeIndex, __ATOMIC_ACQUIRE);
+            if ( readPos == cachedWriteIndex ) return 0;
+        }
+
+        size_t available = cachedWriteIndex >= readPos ? cachedWriteIndex - readPos : buffSize - readPos + cachedWriteIndex;
+        if ( count > available ) count = available;
+
+        // At most two runs, since the buffer wraps around
+        size_t first = buffSize - readPos;
+        if ( first > count ) first = count;
+        copy(results, &buffer[readPos], first);
+        copy(results + first, &buffer[0], count - first);
+
+        readPos += count;
+        if ( readPos >= buffSize ) readPos -= buffSize;
+        __atomic_store_n(&readIndex, readPos, __ATOMIC_RELEASE);
+        if ( blockingWait ) notFull.notify();
+        return count;
+    }
+
+    void write(const T& v) { writeMany(&v, 1); }
+
+    /** Write count messages, blocking until all have been written
+     * @param values messages to write
+     * @param count number of messages
+     */
+    void writeMany(const T* values, size_t count)
+    {
+        int loop_counter = 0;
+        while ( count > 0 ) {
+            size_t n = writeManyNB(values, count);
+            if ( n == 0 ) {
+                waitNotFull(loop_counter);
+                continue;
+            }
+            loop_counter = 0;
+            values += n;
+            count -= n;
+        }
+    }
+
+    /** Write as many of count messages as there is room for, without blocking
+     * @param values messages to write
+     * @param count number of messages
+     * return the number of messages written
+     */
+    size_t writeManyNB(const T* values, size_t count)
+    {
+        // One slot is left empty so a full buffer can be told from an
+        // empty one
+        size_t writePos = writeIndex;
+        size_t space    = freeSpace(writePos, cachedReadIndex);
+        if ( space < count ) {
+            cachedReadIndex = __atomic_load_n(&readIndex, __ATOMIC_ACQUIRE);
+            space           = freeSpace(writePos, cachedReadIndex);
+            if ( space == 0 ) return 0;
+        }
+        if ( count > space ) count = space;
+
+        size_t first = buffSize - writePos;
+        if ( first > count ) first = count;
+        copy(&buffer[writePos], values, first);
+        copy(&buffer[0], values + first, count - first);
+
+        writePos += count;
+        if ( writePos >= buffSize ) writePos -= buffSize;
+        __atomic_store_n(&writeIndex, writePos, __ATOMIC_RELEASE);
+        if ( blockingWait ) notEmpty.notify();
+        return count;
+    }
+
+    ~SPSCCircularBuffer() {}
+
+    /** Discard all unread messages.  Must be called by the reader. */
+    void clearBuffer()
+    {
+        cachedWriteIndex = __atomic_load_n(&writeIndex, __ATOMIC_ACQUIRE);
+        __atomic_store_n(&readIndex, cachedWriteIndex, __ATOMIC_RELEASE);
+        if ( blockingWait ) notFull.notify();
+    }
+
+private:
+    void waitNotEmpty(int& loop_counter)
+    {
+        if ( blockingWait && loop_counter >= SST_CORE_INTERPROCESS_SPIN_LIMIT ) {
+            uint32_t seq = notEmpty.prepareWait();
+            if ( __atomic_load_n(&writeIndex, __ATOMIC_SEQ_CST) == readIndex ) notEmpty.wait(seq);
+            notEmpty.finishWait();
+        }
+        else {
+            SSTMutex::processorPause(loop_counter++);
+        }
+    }
+
+    void waitNotFull(int& loop_counter)
+    {
+        if ( blockingWait && loop_counter >= SST_CORE_INTERPROCESS_SPIN_LIMIT ) {
+            uint32_t seq = notFull.prepareWait();
+            if ( freeSpace(writeIndex, __atomic_load_n(&readIndex, __ATOMIC_SEQ_CST)) == 0 ) notFull.wait(seq);
+            notFull.finishWait();
+        }
+        else {
+            SSTMutex::processorPause(loop_counter++);
+        }
+    }
+
+    size_t freeSpace(size_t writePos, size_t readPos) const
+    {
+        return readPos > writePos ? readPos - writePos - 1 : buffSize - writePos + readPos - 1;
+    }
+
+    static void copy(T* dest, const T* src, size_t count)
+    {
+        for ( size_t i = 0; i < count; i++ )
+            dest[i] = src[i];
+    }
+
+    // Set once before the buffer is used, then only read
+    size_t buffSize;
+    int    blockingWait;
+    char   pad0[SST_CORE_INTERPROCESS_CACHE_LINE - sizeof(size_t) - sizeof(int)];
+
+    // Written by the writer only
+    size_t writeIndex;
+    size_t cachedReadIndex;
+    char   pad1[SST_CORE_INTERPROCESS_CACHE_LINE - 2 * sizeof(size_t)];
+
+    // Written by the reader only
+    size_t readIndex;
+    size_t cachedWriteIndex;
+    char   pad2[SST_CORE_INTERPROCESS_CACHE_LINE - 2 * sizeof(size_t)];
+
+    // Only used with blocking waits
+    SSTWaitQueue notEmpty;
+    SSTWaitQueue notFull;
+    char         pad3[SST_CORE_INTERPROCESS_CACHE_LINE - 2 * sizeof(SSTWaitQueue)];
+
+    T buffer[0];
+};
+
+} // namespace Interprocess
+} // namespace Core
+} // namespace SST
+
+#endif // SST_CORE_INTERPROCESS_SPSCCIRCULARBUFFER_H
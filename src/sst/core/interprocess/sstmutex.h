@@ -13,8 +13,16 @@
 #define SST_CORE_INTERPROCESS_MUTEX_H
 
 #include <sched.h>
+#include <stdint.h>
 #include <time.h>
 
+#if defined(__linux__)
+#include <limits.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 namespace SST {
 namespace Core {
 namespace Interprocess {
@@ -22,13 +30,17 @@ namespace Interprocess {
 #define SST_CORE_INTERPROCESS_LOCKED   1
 #define SST_CORE_INTERPROCESS_UNLOCKED 0
 
+// Number of processorPause() rounds (pauses, then yields) a blocking
+// wait spins for before it goes to sleep
+#define SST_CORE_INTERPROCESS_SPIN_LIMIT 256
+
 class SSTMutex
 {
 
 public:
     SSTMutex() { lockVal = SST_CORE_INTERPROCESS_UNLOCKED; }
 
-    void processorPause(int currentCount)
+    static void processorPause(int currentCount)
     {
         if ( currentCount < 64 ) {
 #if defined(__x86_64__)
@@ -78,6 +90,68 @@ private:
     volatile int lockVal;
 };
 
+/**
+ * Lets a process sleep until another process signals it, through a
+ * futex in shared memory.  Used by the circular buffers to sleep while
+ * they are empty or full instead of spinning.
+ *
+ * A waiter calls prepareWait(), rechecks the condition it is waiting
+ * for, calls wait() only if the condition still does not hold, and then
+ * calls finishWait().  The other side calls notify() after changing the
+ * condition.  notify() only makes a system call if someone is waiting.
+ * Where futexes are not available, wait() sleeps briefly instead.
+ */
+class SSTWaitQueue
+{
+
+public:
+    SSTWaitQueue()
+    {
+        sequence = 0;
+        waiters  = 0;
+    }
+
+    uint32_t prepareWait()
+    {
+        __atomic_fetch_add(&waiters, 1, __ATOMIC_SEQ_CST);
+        return __atomic_load_n(&sequence, __ATOMIC_SEQ_CST);
+    }
+
+    void wait(uint32_t seq)
+    {
+#if defined(__linux__)
+        // Returns at once if a notify() has happened since prepareWait().
+        // The timeout is only a safety net in case the other side exits.
+        struct timespec timeout;
+        timeout.tv_sec  = 0;
+        timeout.tv_nsec = 10000000;
+        syscall(SYS_futex, &sequence, FUTEX_WAIT, seq, &timeout, NULL, 0);
+#else
+        (void)seq;
+        SSTMutex::processorPause(SST_CORE_INTERPROCESS_SPIN_LIMIT);
+#endif
+    }
+
+    void finishWait() { __atomic_fetch_sub(&waiters, 1, __ATOMIC_SEQ_CST); }
+
+    void notify()
+    {
+        // Pairs with prepareWait(): either the waiter sees the new
+        // condition, or this sees the waiter
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        if ( __atomic_load_n(&waiters, __ATOMIC_RELAXED) != 0 ) {
+            __atomic_fetch_add(&sequence, 1, __ATOMIC_SEQ_CST);
+#if defined(__linux__)
+            syscall(SYS_futex, &sequence, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+#endif
+        }
+    }
+
+private:
+    volatile uint32_t sequence;
+    volatile uint32_t waiters;
+};
+
 } // namespace Interprocess
 } // namespace Core
 } // namespace SST
@@ -21,8 +21,10 @@
  */
 
 #include "sst/core/interprocess/circularBuffer.h"
+#include "sst/core/interprocess/spscCircularBuffer.h"
 
 #include <inttypes.h>
+#include <string.h>
 #include <unistd.h>
 #include <vector>
 
@@ -32,31 +34,102 @@ namespace Interprocess {
 
 extern uint32_t globalMMAPIPCCount;
 
+// Number of tunnels a TunnelDoorbell can serve
+#define SST_CORE_INTERPROCESS_DOORBELL_SLOTS 1024
+
+// Space for the name of a doorbell file in a tunnel
+#define SST_CORE_INTERPROCESS_DOORBELL_NAME_LEN 128
+
+/**
+ * A doorbell shared by many tunnels, so one consumer can wait for any
+ * of them to be written to.  It lives in a file of its own, created by
+ * a TunnelMux and mapped by every child of the tunnels added to it.
+ *
+ * Each tunnel has a slot.  A child rings the tunnel's slot after each
+ * write, which sets the slot's ready bit and wakes the consumer if the
+ * bit was clear.  The consumer takes all the ready bits at once, and
+ * must then read everything in those tunnels, since the next write is
+ * all that sets the bit again.
+ */
+struct TunnelDoorbell
+{
+    SSTWaitQueue      queue;
+    volatile uint64_t ready[SST_CORE_INTERPROCESS_DOORBELL_SLOTS / 64];
+
+    void ring(uint32_t slot)
+    {
+        uint64_t bit = (uint64_t)1 << (slot % 64);
+
+        // Orders the write of the message before the check, so either
+        // the consumer takes the bit after the message is visible, or
+        // this sees the bit is clear
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        if ( __atomic_load_n(&ready[slot / 64], __ATOMIC_RELAXED) & bit ) return;
+        __atomic_fetch_or(&ready[slot / 64], bit, __ATOMIC_SEQ_CST);
+        queue.notify();
+    }
+};
+
+// Alignment of the slabs in a tunnel
+#define SST_CORE_INTERPROCESS_SLAB_ALIGN 64
+
+/**
+ * Bookkeeping for the slabs of a tunnel.  A set bit in used marks a
+ * slab that has been allocated and not yet released.
+ */
+struct TunnelSlabPool
+{
+    SSTWaitQueue      freed;
+    size_t            slabSize;
+    size_t            numSlabs;
+    size_t            slabOffset; // from the start of the region
+    volatile uint32_t hint;       // word the last allocation was found in
+    volatile uint64_t used[0];
+};
+
 /* Internal bookkeeping */
 struct InternalSharedData
 {
     volatile uint32_t expectedChildren;
     size_t            shmSegSize;
     size_t            numBuffers;
+    // Doorbell the children ring, set by a TunnelMux.  Empty if none.
+    char              doorbellFile[SST_CORE_INTERPROCESS_DOORBELL_NAME_LEN];
+    uint32_t          doorbellSlot;
+    // Location of the TunnelSlabPool, 0 if the tunnel has no slabs
+    size_t            slabPoolOffset;
     size_t            offsets[0]; // offset[0] points to user region, offset[1]... points to circular buffers
 };
 
 /**
  * This class defines a shared-memory region between a master process and
  * one or more child processes
- * Region has three data structures:
+ * Region has four data structures:
  *  - internal bookkeeping (InternalSharedData),
  *  - user defined shared data (ShareDataType)
  *  - multiple circular-buffer queues with entries of type MsgType
+ *  - optionally, a pool of fixed size slabs
+ *
+ * The slabs are for records too large to copy through a buffer, like
+ * memory snapshots or blocks of instructions.  A writer takes a slab
+ * with allocSlab(), builds the record in place through getSlab(), and
+ * sends only the slab's index (and whatever else describes the record)
+ * in a message.  The reader uses the record where it is and then
+ * gives the slab back with releaseSlab().  Records can be at most the
+ * slab size.
  *
  * @tparam ShareDataType  Type to put in the shared data region
  * @tparam MsgType Type of messages being sent in the circular buffers
+ * @tparam BufferType Type of the circular buffers.  CircularBuffer locks
+ *   on each access, so any number of processes can read and write a
+ *   buffer.  SPSCCircularBuffer is lock-free, but each buffer must have
+ *   a single writer and a single reader.
  */
-template <typename ShareDataType, typename MsgType>
+template <typename ShareDataType, typename MsgType, typename BufferType = CircularBuffer<MsgType> >
 class TunnelDef
 {
 
-    typedef SST::Core::Interprocess::CircularBuffer<MsgType> CircBuff_t;
+    typedef BufferType CircBuff_t;
 
 public:
     /** Create a new tunnel
@@ -64,21 +137,35 @@ public:
      * @param numBuffers Number of buffers for which we should tunnel
      * @param bufferSize How large each buffer should be
      * @param expectedChildren Number of child processes that will connect to this tunnel
+     * @param blockingWait Whether a process waiting on an empty or full buffer
+     *   sleeps once it has spun for a while, instead of spinning until it can go on
+     * @param slabSize Size in bytes of each slab, rounded up to SST_CORE_INTERPROCESS_SLAB_ALIGN
+     * @param numSlabs Number of slabs, 0 for none
      */
-    TunnelDef(size_t numBuffers, size_t bufferSize, uint32_t expectedChildren) : master(true), shmPtr(NULL)
+    TunnelDef(
+        size_t numBuffers, size_t bufferSize, uint32_t expectedChildren, bool blockingWait = false,
+        size_t slabSize = 0, size_t numSlabs = 0) :
+        master(true),
+        shmPtr(NULL),
+        doorbell(NULL),
+        slabPool(NULL),
+        slabBase(NULL)
     {
         // Locally buffer info
         numBuffs = numBuffers;
         buffSize = bufferSize;
         children = expectedChildren;
-        shmSize  = calculateShmemSize(numBuffers, bufferSize);
+        blocking = blockingWait;
+        slabSz   = alignSlab(slabSize);
+        nSlabs   = slabSz == 0 ? 0 : numSlabs;
+        shmSize  = calculateShmemSize(numBuffers, bufferSize, slabSz, nSlabs);
     }
 
     /** Access an existing tunnel
      * Child creates the TunnelDef, reads the shmSize, and then resizes its map accordingly
      * @param sPtr Location of shared memory region
      */
-    TunnelDef(void* sPtr) : master(false), shmPtr(sPtr)
+    TunnelDef(void* sPtr) : master(false), shmPtr(sPtr), doorbell(NULL), slabPool(NULL), slabBase(NULL)
     {
         isd     = (InternalSharedData*)shmPtr;
         shmSize = isd->shmSegSize;
@@ -119,8 +206,28 @@ public:
                 isd->offsets[1 + c]                    = cResult.first;
                 cPtr                                   = cResult.second;
                 if ( !cPtr->setBufferSize(buffSize) ) exit(1); // function prints error message
+                cPtr->setBlockingWait(blocking);
                 circBuffs.push_back(cPtr);
             }
+
+            // Reserve space for the slabs, which start on an aligned
+            // boundary so each one does
+            if ( nSlabs > 0 ) {
+                const size_t words = (nSlabs + 63) / 64;
+
+                std::pair<size_t, TunnelSlabPool*> dResult = reserveSpace<TunnelSlabPool>(words * sizeof(uint64_t));
+                isd->slabPoolOffset                        = dResult.first;
+                slabPool                                   = dResult.second;
+                slabPool->slabSize                         = slabSz;
+                slabPool->numSlabs                         = nSlabs;
+                // Bits past the last slab are never free
+                if ( nSlabs % 64 != 0 ) slabPool->used[words - 1] = ~(uint64_t)0 << (nSlabs % 64);
+
+                size_t offset        = alignSlab(nextAllocPtr - (uint8_t*)shmPtr);
+                slabPool->slabOffset = offset;
+                slabBase             = (uint8_t*)shmPtr + offset;
+                nextAllocPtr         = slabBase + slabSz * nSlabs;
+            }
             return isd->expectedChildren;
         }
         else {
@@ -134,6 +241,11 @@ public:
             }
             numBuffs = isd->numBuffers;
 
+            if ( isd->slabPoolOffset != 0 ) {
+                slabPool = (TunnelSlabPool*)((uint8_t*)shmPtr + isd->slabPoolOffset);
+                slabBase = (uint8_t*)shmPtr + slabPool->slabOffset;
+            }
+
             return --(isd->expectedChildren);
         }
     }
@@ -168,7 +280,11 @@ public:
      * @param buffer which buffer index to write to
      * @param command message to write to buffer
      */
-    void writeMessage(size_t buffer, const MsgType& command) { circBuffs[buffer]->write(command); }
+    void writeMessage(size_t buffer, const MsgType& command)
+    {
+        circBuffs[buffer]->write(command);
+        if ( doorbell ) doorbell->ring(isd->doorbellSlot);
+    }
 
     /** Read data from buffer, blocks until message received
      * @param buffer which buffer to read from
@@ -176,6 +292,39 @@ public:
      */
     MsgType readMessage(size_t buffer) { return circBuffs[buffer]->read(); }
 
+    /** Write several messages to buffer, blocks until all are written
+     * @param buffer which buffer index to write to
+     * @param commands messages to write to buffer
+     * @param count number of messages
+     */
+    void writeMessages(size_t buffer, const MsgType* commands, size_t count)
+    {
+        circBuffs[buffer]->writeMany(commands, count);
+        if ( doorbell ) doorbell->ring(isd->doorbellSlot);
+    }
+
+    /** Read several messages from buffer, blocks until at least one is received
+     * @param buffer which buffer to read from
+     * @param results where to put the messages
+     * @param count maximum number of messages to read
+     * return the number of messages read
+     */
+    size_t readMessages(size_t buffer, MsgType* results, size_t count)
+    {
+        return circBuffs[buffer]->readMany(results, count);
+    }
+
+    /** Read several messages from buffer, non-blocking
+     * @param buffer which buffer to read from
+     * @param results where to put the messages
+     * @param count maximum number of messages to read
+     * return the number of messages read
+     */
+    size_t readMessagesNB(size_t buffer, MsgType* results, size_t count)
+    {
+        return circBuffs[buffer]->readManyNB(results, count);
+    }
+
     /** Read data from buffer, non-blocking
      * @param buffer which buffer to read from
      * @param result pointer to return read message at
@@ -191,6 +340,91 @@ public:
     /** return whether this is a master-side tunnel or a child*/
     bool isMaster() { return master; }
 
+    /** Have the children ring a doorbell when they write.  Called by
+     * TunnelMux on the master side, before any child attaches.
+     * @param file name of the doorbell file
+     * @param slot the tunnel's slot in the doorbell
+     */
+    void setDoorbell(const char* file, uint32_t slot)
+    {
+        strncpy(isd->doorbellFile, file, SST_CORE_INTERPROCESS_DOORBELL_NAME_LEN - 1);
+        isd->doorbellSlot = slot;
+        __sync_synchronize();
+    }
+
+    /** return the name of the doorbell file the children need to map,
+     * or NULL if the tunnel has none */
+    const char* getDoorbellFile() { return isd->doorbellFile[0] == '\0' ? NULL : isd->doorbellFile; }
+
+    /** return the size of each slab, or 0 if the tunnel has none */
+    size_t getSlabSize() { return slabPool ? slabPool->slabSize : 0; }
+
+    /** return the number of slabs */
+    size_t getNumSlabs() { return slabPool ? slabPool->numSlabs : 0; }
+
+    /** Take a free slab, non-blocking
+     * @param index where to put the index of the slab
+     * return whether a slab was free
+     */
+    bool allocSlabNB(uint32_t* index)
+    {
+        const size_t words = (slabPool->numSlabs + 63) / 64;
+        const size_t start = slabPool->hint;
+        for ( size_t i = 0; i < words; i++ ) {
+            size_t   w    = (start + i) % words;
+            uint64_t bits = __atomic_load_n(&slabPool->used[w], __ATOMIC_RELAXED);
+            while ( ~bits != 0 ) {
+                uint64_t bit = ~bits & (bits + 1); // lowest clear bit
+                if ( __atomic_compare_exchange_n(
+                         &slabPool->used[w], &bits, bits | bit, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED) ) {
+                    slabPool->hint = w;
+                    *index         = w * 64 + __builtin_ctzll(bit);
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    /** Take a free slab, blocks until one is released
+     * return the index of the slab
+     */
+    uint32_t allocSlab()
+    {
+        int      loop_counter = 0;
+        uint32_t index;
+        while ( !allocSlabNB(&index) ) {
+            if ( loop_counter < SST_CORE_INTERPROCESS_SPIN_LIMIT ) {
+                SSTMutex::processorPause(loop_counter++);
+                continue;
+            }
+            uint32_t seq = slabPool->freed.prepareWait();
+            if ( !anySlabFree() ) slabPool->freed.wait(seq);
+            slabPool->freed.finishWait();
+        }
+        return index;
+    }
+
+    /** return the location of a slab in this process
+     * @param index which slab
+     */
+    void* getSlab(uint32_t index) { return slabBase + (size_t)index * slabPool->slabSize; }
+
+    /** Give a slab back once its record has been used
+     * @param index which slab
+     */
+    void releaseSlab(uint32_t index)
+    {
+        __atomic_fetch_and(&slabPool->used[index / 64], ~((uint64_t)1 << (index % 64)), __ATOMIC_RELEASE);
+        slabPool->freed.notify();
+    }
+
+    /** Ring the mapped doorbell after each write.  Called by the child
+     * side managers once they have mapped getDoorbellFile().
+     * @param sPtr location of the mapped doorbell
+     */
+    void attachDoorbell(void* sPtr) { doorbell = (TunnelDoorbell*)sPtr; }
+
 private:
     /** Allocate space for a data structure in the shared region
      * @tparam T data structure type to allocate space for
@@ -208,17 +442,40 @@ private:
         return std::make_pair((uint8_t*)ptr - (uint8_t*)shmPtr, ptr);
     }
 
+    /** Whether any slab is free */
+    bool anySlabFree()
+    {
+        const size_t words = (slabPool->numSlabs + 63) / 64;
+        for ( size_t w = 0; w < words; w++ ) {
+            if ( ~__atomic_load_n(&slabPool->used[w], __ATOMIC_SEQ_CST) != 0 ) return true;
+        }
+        return false;
+    }
+
+    /** Round up to the slab alignment */
+    static size_t alignSlab(size_t size)
+    {
+        return (size + SST_CORE_INTERPROCESS_SLAB_ALIGN - 1) & ~(size_t)(SST_CORE_INTERPROCESS_SLAB_ALIGN - 1);
+    }
+
     /** Calculate the size of the tunnel */
-    static size_t calculateShmemSize(size_t numBuffers, size_t bufferSize)
+    static size_t calculateShmemSize(size_t numBuffers, size_t bufferSize, size_t slabSize, size_t numSlabs)
     {
         long   pagesize = sysconf(_SC_PAGESIZE);
         /* Count how many pages are needed, at minimum */
         size_t isd      = 1 + ((sizeof(InternalSharedData) + (1 + numBuffers) * sizeof(size_t)) / pagesize);
-        size_t buffer   = 1 + ((sizeof(CircularBuffer<MsgType>) + bufferSize * sizeof(MsgType)) / pagesize);
+        size_t buffer   = 1 + ((sizeof(CircBuff_t) + bufferSize * sizeof(MsgType)) / pagesize);
         size_t shdata   = 1 + ((sizeof(ShareDataType) + sizeof(InternalSharedData)) / pagesize);
 
+        size_t slabs = 0;
+        if ( numSlabs > 0 ) {
+            slabs = 1 + ((sizeof(TunnelSlabPool) + (numSlabs + 63) / 64 * sizeof(uint64_t) +
+                          SST_CORE_INTERPROCESS_SLAB_ALIGN + slabSize * numSlabs) /
+                         pagesize);
+        }
+
         /* Alloc 2 extra pages just in case */
-        return (2 + isd + shdata + numBuffers * buffer) * pagesize;
+        return (2 + isd + shdata + numBuffers * buffer + slabs) * pagesize;
     }
 
 protected:
@@ -239,10 +496,16 @@ private:
     size_t   numBuffs;
     size_t   buffSize;
     uint32_t children;
+    bool     blocking;
+    size_t   slabSz;
+    size_t   nSlabs;
 
     // Shared objects
     InternalSharedData*      isd;
     std::vector<CircBuff_t*> circBuffs;
+    TunnelDoorbell*          doorbell;
+    TunnelSlabPool*          slabPool;
+    uint8_t*                 slabBase;
 };
 
 } // namespace Interprocess
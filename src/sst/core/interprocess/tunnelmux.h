@@ -0,0 +1,202 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_INTERPROCESS_TUNNEL_MUX_H
+#define SST_CORE_INTERPROCESS_TUNNEL_MUX_H
+
+#include "sst/core/interprocess/tunneldef.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <new>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+namespace SST {
+namespace Core {
+namespace Interprocess {
+
+/** Waits on many tunnels at once for the parent/master process.
+ *
+ * Instead of polling each tunnel, the consumer adds them all to a mux,
+ * which creates a TunnelDoorbell their children ring whenever they
+ * write.  waitReady() then spins and sleeps on the doorbell alone, and
+ * returns the tunnels that were written to.
+ *
+ * Tunnels must be added before their children attach, since the child
+ * side managers (SHMChild, MMAPChild_Pin3) map the doorbell when they
+ * attach.  Only writes by the children ring the doorbell.  A mux is
+ * used by one thread.
+ *
+ * @tparam TunnelType Tunnel definition
+ */
+template <typename TunnelType>
+class TunnelMux
+{
+
+public:
+    /** Create the doorbell
+     * @param comp_id Component ID of owner
+     */
+    TunnelMux(uint32_t comp_id) : doorbell(nullptr)
+    {
+        // In shared memory if possible, but a plain file works too
+        const char* dir = access("/dev/shm", W_OK) == 0 ? "/dev/shm" : "/tmp";
+
+        char key[SST_CORE_INTERPROCESS_DOORBELL_NAME_LEN];
+        int  fd;
+        do {
+            snprintf(key, sizeof(key), "%s/sst_doorbell_%u-%" PRIu32 "-%d", dir, getpid(), comp_id, rand());
+            filename = key;
+
+            fd = open(filename.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+            // Try again if a crashed run left the file behind
+        } while ( (fd < 0) && (errno == EEXIST) );
+
+        if ( fd < 0 ) {
+            // Not using Output because IPC means Output might not be available
+            fprintf(stderr, "Failed to create doorbell '%s': %s\n", filename.c_str(), strerror(errno));
+            exit(1);
+        }
+        if ( ftruncate(fd, sizeof(TunnelDoorbell)) ) {
+            // Not using Output because IPC means Output might not be available
+            fprintf(stderr, "Resizing doorbell '%s' failed: %s\n", filename.c_str(), strerror(errno));
+            exit(1);
+        }
+
+        void* ptr = mmap(nullptr, sizeof(TunnelDoorbell), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+        if ( ptr == MAP_FAILED ) {
+            // Not using Output because IPC means Output might not be available
+            fprintf(stderr, "mmap failed: %s\n", strerror(errno));
+            exit(1);
+        }
+        doorbell = new (ptr) TunnelDoorbell();
+    }
+
+    /** Destructor */
+    virtual ~TunnelMux()
+    {
+        munmap(doorbell, sizeof(TunnelDoorbell));
+        if ( remove(filename.c_str()) != 0 ) {
+            fprintf(stderr, "Error deleting doorbell file: %s\n", filename.c_str());
+        }
+    }
+
+    /** Add a tunnel, before any of its children attach
+     * @param tunnel Master side of the tunnel
+     * return the index of the tunnel in the mux
+     */
+    size_t addTunnel(TunnelType* tunnel)
+    {
+        size_t index = tunnels.size();
+        if ( index >= SST_CORE_INTERPROCESS_DOORBELL_SLOTS ) {
+            // Not using Output because IPC means Output might not be available
+            fprintf(stderr, "A tunnel mux can only hold %d tunnels\n", (int)SST_CORE_INTERPROCESS_DOORBELL_SLOTS);
+            exit(1);
+        }
+        tunnel->setDoorbell(filename.c_str(), index);
+        tunnels.push_back(tunnel);
+
+        // Checked once up front, in case anything is already there
+        requeue(index);
+        return index;
+    }
+
+    /** return a tunnel by its index */
+    TunnelType* getTunnel(size_t index) { return tunnels[index]; }
+
+    /** return the number of tunnels */
+    size_t getNumTunnels() const { return tunnels.size(); }
+
+    /** returns name of the doorbell file */
+    const std::string& getRegionName(void) const { return filename; }
+
+    /** Get the tunnels written to since they were last returned, without
+     * waiting.  Everything in them must be read, or they must be
+     * requeued, since only the next write returns them again.
+     * @param ready the indices of the tunnels are added to it
+     * return the number of tunnels added
+     */
+    size_t pollReady(std::vector<size_t>& ready)
+    {
+        size_t count = 0;
+        size_t words = (tunnels.size() + 63) / 64;
+        for ( size_t w = 0; w < words; w++ ) {
+            if ( __atomic_load_n(&doorbell->ready[w], __ATOMIC_RELAXED) == 0 ) continue;
+            uint64_t bits = __atomic_exchange_n(&doorbell->ready[w], 0, __ATOMIC_SEQ_CST);
+            while ( bits != 0 ) {
+                ready.push_back(w * 64 + __builtin_ctzll(bits));
+                bits &= bits - 1;
+                count++;
+            }
+        }
+        return count;
+    }
+
+    /** Wait until at least one tunnel has been written to, spinning for
+     * a while and then sleeping on the doorbell.  The same rules as
+     * pollReady() apply to the tunnels returned.
+     * @param ready the indices of the tunnels are added to it
+     * return the number of tunnels added
+     */
+    size_t waitReady(std::vector<size_t>& ready)
+    {
+        int    loop_counter = 0;
+        size_t count;
+        while ( (count = pollReady(ready)) == 0 ) {
+            if ( loop_counter < SST_CORE_INTERPROCESS_SPIN_LIMIT ) {
+                SSTMutex::processorPause(loop_counter++);
+                continue;
+            }
+            uint32_t seq = doorbell->queue.prepareWait();
+            if ( !anyReady() ) doorbell->queue.wait(seq);
+            doorbell->queue.finishWait();
+        }
+        return count;
+    }
+
+    /** Return a tunnel from the next poll or wait, for a consumer that
+     * left messages in it
+     * @param index index of the tunnel
+     */
+    void requeue(size_t index)
+    {
+        __atomic_fetch_or(&doorbell->ready[index / 64], (uint64_t)1 << (index % 64), __ATOMIC_SEQ_CST);
+    }
+
+private:
+    bool anyReady()
+    {
+        size_t words = (tunnels.size() + 63) / 64;
+        for ( size_t w = 0; w < words; w++ ) {
+            if ( __atomic_load_n(&doorbell->ready[w], __ATOMIC_SEQ_CST) != 0 ) return true;
+        }
+        return false;
+    }
+
+    std::string              filename;
+    TunnelDoorbell*          doorbell;
+    std::vector<TunnelType*> tunnels;
+};
+
+} // namespace Interprocess
+} // namespace Core
+} // namespace SST
+
+#endif // SST_CORE_INTERPROCESS_TUNNEL_MUX_H
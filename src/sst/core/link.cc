@@ -13,9 +13,11 @@
 
 #include "sst/core/link.h"
 
+#include "sst/core/directDeliveryQueue.h"
 #include "sst/core/event.h"
 #include "sst/core/factory.h"
 #include "sst/core/initQueue.h"
+#include "sst/core/memuse.h"
 #include "sst/core/pollingLinkQueue.h"
 #include "sst/core/profile/eventHandlerProfileTool.h"
 #include "sst/core/simulation_impl.h"
@@ -26,6 +28,7 @@
 #include "sst/core/uninitializedQueue.h"
 #include "sst/core/unitAlgebra.h"
 
+#include <deque>
 #include <utility>
 
 namespace SST {
@@ -82,6 +85,110 @@ private:
     std::vector<std::pair<SST::Profile::EventHandlerProfileTool*, uintptr_t>> tools;
 };
 
+/**
+ * Stands in for the handler of an event sent with sendCancellable()
+ * until the event is delivered, so that a handle can tell whether its
+ * event is still pending.
+ */
+class Link::CancellableSend : public Event::HandlerBase
+{
+public:
+    CancellableSendPool* pool;
+    Event*               event;
+    uintptr_t            info; // Delivery information the event was sent with
+    uint32_t             index;
+    uint32_t             generation;
+    uint32_t             next_free;
+
+private:
+    void operator_impl(Event* ev) override;
+};
+
+class Link::CancellableSendPool
+{
+public:
+    static const uint32_t NIL = UINT32_MAX;
+
+    CancellableSendPool() : free_list(NIL) {}
+
+    CancellableSend* get()
+    {
+        if ( free_list == NIL ) {
+            sends.emplace_back();
+            CancellableSend& send = sends.back();
+            send.pool             = this;
+            send.event            = nullptr;
+            send.index            = sends.size() - 1;
+            send.generation       = 0;
+            return &send;
+        }
+        CancellableSend* send = &sends[free_list];
+        free_list             = send->next_free;
+        return send;
+    }
+
+    void release(CancellableSend* send)
+    {
+        send->event = nullptr;
+        send->generation++;
+        send->next_free = free_list;
+        free_list       = send->index;
+    }
+
+    /** The pending send a handle refers to, or nullptr */
+    CancellableSend* find(CancelHandle handle)
+    {
+        uint32_t index = static_cast<uint32_t>(handle) - 1;
+        if ( handle == NO_CANCEL_HANDLE || index >= sends.size() ) return nullptr;
+        CancellableSend* send = &sends[index];
+        if ( send->event == nullptr || send->generation != static_cast<uint32_t>(handle >> 32) ) return nullptr;
+        return send;
+    }
+
+private:
+    // A deque, so the delivery information held by the events does
+    // not move
+    std::deque<CancellableSend> sends;
+    uint32_t                    free_list;
+};
+
+struct Link::ColdData
+{
+    ColdData() : profile_tools(nullptr), cancellable_sends(nullptr) {}
+    ~ColdData()
+    {
+        delete profile_tools;
+        delete cancellable_sends;
+    }
+
+    LinkSendProfileToolList* profile_tools;
+
+    /** Created by the first sendCancellable() */
+    CancellableSendPool* cancellable_sends;
+
+    /** Partition of the other end, for links that cross partitions */
+    RankInfo peer_rank;
+
+#ifdef __SST_DEBUG_EVENT_TRACKING__
+    std::string comp;
+    std::string ctype;
+    std::string port;
+#endif
+};
+
+// Everything send() uses fits in a single cache line
+static_assert(sizeof(Link) == 64, "Link should be one cache line");
+
+void
+Link::CancellableSend::operator_impl(Event* ev)
+{
+    // ev is nullptr for a NullEvent
+    uintptr_t sent_info  = info;
+    event->delivery_info = sent_info;
+    pool->release(this);
+    (*reinterpret_cast<Event::HandlerBase*>(sent_info))(ev);
+}
+
 Link::Link(LinkId_t tag) :
     send_queue(nullptr),
     delivery_info(0),
@@ -91,9 +198,12 @@ Link::Link(LinkId_t tag) :
     current_time(Simulation_impl::getSimulation()->currentSimCycle),
     type(UNINITIALIZED),
     mode(INIT),
+    self_send(NO_SELF_SEND),
     tag(tag),
-    profile_tools(nullptr)
-{}
+    cold(nullptr)
+{
+    Core::MemoryAccounting::add(Core::MemoryAccounting::LINKS, sizeof(Link));
+}
 
 Link::Link() :
     send_queue(nullptr),
@@ -104,13 +214,18 @@ Link::Link() :
     current_time(Simulation_impl::getSimulation()->currentSimCycle),
     type(UNINITIALIZED),
     mode(INIT),
+    self_send(NO_SELF_SEND),
     tag(-1),
-    profile_tools(nullptr)
-{}
+    cold(nullptr)
+{
+    Core::MemoryAccounting::add(Core::MemoryAccounting::LINKS, sizeof(Link));
+}
 //Link类的析构函数，这段代码是确保当Link对象被销毁时，与之关联的pair_link和profile_tools
 //也被适当的清理，这可以防止资源泄露和未定义行为
 Link::~Link()
 {
+    Core::MemoryAccounting::add(Core::MemoryAccounting::LINKS, -(int64_t)sizeof(Link));
+
     // Check to see if my pair_link is nullptr.  If not, let the other
     // link know I've been deleted
     //首先，析构函数检查 pair_link 指针是否不为 nullptr，并且确保它不指向当
@@ -126,7 +241,7 @@ Link::~Link()
         if ( SYNC == pair_link->type ) delete pair_link;
     }
 
-    if ( profile_tools ) delete profile_tools;
+    delete cold;
 }
 //此方法作用是在Link对象配对的过程中进行最后的设置和调整，这个方法会根据不同的
 //Link类型执行不同的操作，确保Link对象正确地完成配置
@@ -151,7 +266,26 @@ Link::finalizeConfiguration()
     }
     //如果Link对象的type是HANDLER，那么pair_link的send_queue被设置为Simulation_imple
     //::getSimulation()->getTimeVortex()返回的队列，这是一个基于时间的队列，用于处理事件
-    if ( HANDLER == type ) { pair_link->send_queue = Simulation_impl::getSimulation()->getTimeVortex(); }
+    if ( HANDLER == type ) {
+        // Events sent with no latency by a link on this thread can be
+        // for the current time, which the direct delivery queue keeps
+        // out of the TimeVortex
+        Simulation_impl* sim = Simulation_impl::getSimulation();
+        if ( sim->getDirectDeliveryQueue() && 0 == pair_link->latency && SYNC != pair_link->type ) {
+            pair_link->send_queue = sim->getDirectDeliveryQueue();
+        }
+        else {
+            pair_link->send_queue = sim->getTimeVortex();
+        }
+
+        // Self links send straight to their queue, unless the sends
+        // have to be seen by profiling tools or event tracking
+#if !__SST_DEBUG_EVENT_TRACKING__
+        if ( pair_link == this && (cold == nullptr || cold->profile_tools == nullptr) ) {
+            self_send = send_queue == sim->getDirectDeliveryQueue() ? SELF_SEND_DIRECT : SELF_SEND_VORTEX;
+        }
+#endif
+    }
     //如果type为POLL，则 pair_link 的 send_queue 被设置为一个新的 PollingLinkQueue 对象。
     //这是一个轮询队列，用于处理轮询的事件
     else if ( POLL == type ) {
@@ -171,7 +305,8 @@ void
 Link::prepareForComplete()
 {
     //将Link对象的mode成员变量设置为COMPLETE,这表示Link对象正在进入完成状态
-    mode = COMPLETE;
+    mode      = COMPLETE;
+    self_send = NO_SELF_SEND;
 
     //处理SYNC类型的链接，如果Link对象的type成员变量等于SYNC，表示这是一个同步链接
     //对于同步链接，在准备完成时不需要进行任何配置的修改
@@ -279,7 +414,7 @@ Link::replaceFunctor(Event::HandlerBase* functor)
 
 //在模拟环境中发送一个事件，delay表示发送延迟，event表示要发送的事件对象
 void
-Link::send_impl(SimTime_t delay, Event* event)
+Link::send_checked(SimTime_t delay, Event* event)
 {
     //如果Link对象的mode成员变量不为RUN
     if ( RUN != mode ) {
@@ -295,6 +430,103 @@ Link::send_impl(SimTime_t delay, Event* event)
                 CALL_INFO, 1, "ERROR: Trying to call send or recv during complete phase.");
         }
     }
+    event = prepare_send(delay, event);
+    send_queue->insert(event);
+}
+
+void
+Link::sendBatch_impl(SimTime_t delay, std::vector<Event*>& events)
+{
+    // Polling links receive one event at a time, and send_impl()
+    // reports sends outside of the run phase
+    bool batch    = RUN == mode && POLL != pair_link->type && events.size() > 1;
+    auto priority = [](Event* event) { return event ? event->getPriority() : EVENTPRIORITY; };
+    for ( size_t i = 1; batch && i < events.size(); ++i ) {
+        // Events of different priorities are not delivered together
+        batch = priority(events[i]) == priority(events[0]);
+    }
+    if ( !batch ) {
+        for ( Event* event : events ) {
+            send_impl(delay, event);
+        }
+        events.clear();
+        return;
+    }
+
+    EventBatch* send = nullptr;
+    for ( Event* event : events ) {
+        event = prepare_send(delay, event);
+        if ( send == nullptr )
+            send = new EventBatch(event);
+        else
+            send->add(event);
+    }
+    events.clear();
+    send_queue->insert(send);
+}
+
+Link::CancelHandle
+Link::sendCancellable_impl(SimTime_t delay, Event* event)
+{
+    Simulation_impl* sim = Simulation_impl::getSimulation();
+    if ( RUN != mode ) {
+        sim->getSimulationOutput().fatal(
+            CALL_INFO, 1, "ERROR: Cancellable events can only be sent during the run phase.\n");
+    }
+    // The send and its cancel both touch the event after it is queued,
+    // so the event has to stay on this thread.  Links to other threads
+    // with --interthread-links are handler links too, but queue
+    // directly into the other thread's TimeVortex.
+    if ( HANDLER != pair_link->type ||
+         (send_queue != sim->getTimeVortex() && send_queue != sim->getDirectDeliveryQueue()) ) {
+        sim->getSimulationOutput().fatal(
+            CALL_INFO, 1,
+            "ERROR: Cancellable events can only be sent on links that deliver to an event handler on the same "
+            "thread.\n");
+    }
+    event = prepare_send(delay, event);
+
+    ColdData* data = getColdData();
+    if ( data->cancellable_sends == nullptr ) data->cancellable_sends = new CancellableSendPool();
+    CancellableSend* send = data->cancellable_sends->get();
+    send->event           = event;
+    send->info            = event->delivery_info;
+    event->delivery_info  = reinterpret_cast<uintptr_t>(static_cast<Event::HandlerBase*>(send));
+
+    send_queue->insert(event);
+    return (static_cast<CancelHandle>(send->generation) << 32) | (send->index + 1);
+}
+
+bool
+Link::cancel(CancelHandle handle)
+{
+    if ( cold == nullptr || cold->cancellable_sends == nullptr ) return false;
+    CancellableSend* send = cold->cancellable_sends->find(handle);
+    if ( send == nullptr ) return false;
+
+    send->event->cancel();
+    cold->cancellable_sends->release(send);
+    Simulation_impl::getSimulation()->getTimeVortex()->activityCancelled();
+    return true;
+}
+
+uintptr_t
+Link::getSentDeliveryInfo(Event* event)
+{
+    auto* send = dynamic_cast<CancellableSend*>(reinterpret_cast<Event::HandlerBase*>(event->delivery_info));
+    return send ? send->info : event->delivery_info;
+}
+
+void
+Link::releaseCancellable(Event* event)
+{
+    auto* send = dynamic_cast<CancellableSend*>(reinterpret_cast<Event::HandlerBase*>(event->delivery_info));
+    if ( send ) send->pool->release(send);
+}
+
+Event*
+Link::prepare_send(SimTime_t delay, Event* event)
+{
     //计算事件的发送时延
     Cycle_t cycle = current_time + delay + latency;
     //如果没有提供事件对象，方法会创建一个新的NullEvent对象
@@ -303,12 +535,46 @@ Link::send_impl(SimTime_t delay, Event* event)
     event->setDeliveryInfo(tag, delivery_info);
 //如果编译时定义了_SST_DEBUG_EVENT_TRACKING_,这意味着在调试模式下，事件跟踪功能被启用
 #if __SST_DEBUG_EVENT_TRACKING__
-    event->addSendComponent(comp, ctype, port);
-    event->addRecvComponent(pair_link->comp, pair_link->ctype, pair_link->port);
+    event->addSendComponent(getSendingComponentName(), getSendingComponentType(), getSendingPort());
+    event->addRecvComponent(
+        pair_link->getSendingComponentName(), pair_link->getSendingComponentType(), pair_link->getSendingPort());
 #endif
 
-    if ( profile_tools ) profile_tools->eventSent(event);
-    send_queue->insert(event);
+    if ( cold && cold->profile_tools ) cold->profile_tools->eventSent(event);
+    return event;
+}
+
+void
+Link::sendBatch_sync(Activity** begin, Activity** end, SimTime_t current_cycle)
+{
+    // Links on the same thread almost always share a send_queue (the
+    // TimeVortex), so collect runs of events headed to the same queue
+    ActivityQueue* queue = nullptr;
+    Activity**     start = begin;
+    for ( Activity** it = begin; it != end; ++it ) {
+        Event* ev   = static_cast<Event*>(*it);
+        Link*  link = ev->getDeliveryLink();
+        link->prepare_send((ev->getDeliveryTime() - current_cycle) * link->defaultTimeBase, ev);
+
+        // Polling links receive one event at a time, so batches from
+        // the SyncQueue are taken apart for them
+        EventBatch* batch = POLL == link->pair_link->type ? dynamic_cast<EventBatch*>(ev) : nullptr;
+        if ( link->send_queue != queue || batch != nullptr ) {
+            if ( queue != nullptr ) queue->insertBatch(start, it);
+            queue = link->send_queue;
+            start = it;
+        }
+        if ( batch != nullptr ) {
+            batch->prepareEvents();
+            for ( Event* event : batch->events ) {
+                queue->insert(event);
+            }
+            batch->events.clear();
+            delete batch;
+            queue = nullptr;
+        }
+    }
+    if ( queue != nullptr ) queue->insertBatch(start, end);
 }
 
 //定义了Link类的recv方法
@@ -366,8 +632,9 @@ Link::sendUntimedData(Event* data)
 //跟踪功能被启用。在这种情况下，方法会调用data->addSendComponent和data->addRecvComponent
 //方法来记录发送和接收事件的组件消息。这些信息包括组件的名称、类型和端口
 #if __SST_DEBUG_EVENT_TRACKING__
-    data->addSendComponent(comp, ctype, port);
-    data->addRecvComponent(pair_link->comp, pair_link->ctype, pair_link->port);
+    data->addSendComponent(getSendingComponentName(), getSendingComponentType(), getSendingPort());
+    data->addRecvComponent(
+        pair_link->getSendingComponentName(), pair_link->getSendingComponentType(), pair_link->getSendingPort());
 #endif
 }
 
@@ -380,6 +647,18 @@ Link::sendUntimedData_sync(Event* data)
     //赋值给send_queue.这个队列用于存储在初始化阶段发送未定时的数据
     if ( send_queue == nullptr ) { send_queue = new InitQueue(); }
 
+    // Untimed data is received one event at a time, so batches from
+    // the SyncQueue are taken apart
+    if ( EventBatch* batch = dynamic_cast<EventBatch*>(data) ) {
+        batch->prepareEvents();
+        for ( Event* event : batch->events ) {
+            send_queue->insert(event);
+        }
+        batch->events.clear();
+        delete batch;
+        return;
+    }
+
     send_queue->insert(data);
 }
 
@@ -442,11 +721,62 @@ Link::addProfileTool(SST::Profile::EventHandlerProfileTool* tool, const EventHan
 {
     //若profile_tools是nullptr，表示Link对象尚未拥有管理虚拟分析工具的列表，因此需要
     //创建一个新的LinkSendProfileToolList对象并将其赋值给profile_tools
-    if ( !profile_tools ) profile_tools = new LinkSendProfileToolList();
+    ColdData* data = getColdData();
+    if ( !data->profile_tools ) data->profile_tools = new LinkSendProfileToolList();
     //若已经初始化，则调用addProfileTool方法，使得Link对象能够添加性能分析工具
     //以便在模拟过程中收集和分析事件处理的性能数据
-    profile_tools->addProfileTool(tool, mdata);
+    data->profile_tools->addProfileTool(tool, mdata);
+}
+
+void
+Link::setPeerRank(const RankInfo& rank)
+{
+    getColdData()->peer_rank = rank;
+}
+
+RankInfo
+Link::getPeerRank() const
+{
+    return cold ? cold->peer_rank : RankInfo();
+}
+
+Link::ColdData*
+Link::getColdData()
+{
+    if ( cold == nullptr ) cold = new ColdData();
+    return cold;
 }
 
+#ifdef __SST_DEBUG_EVENT_TRACKING__
+void
+Link::setSendingComponentInfo(const std::string& comp_in, const std::string& type_in, const std::string& port_in)
+{
+    ColdData* data = getColdData();
+    data->comp     = comp_in;
+    data->ctype    = type_in;
+    data->port     = port_in;
+}
+
+static const std::string no_tracking_info;
+
+const std::string&
+Link::getSendingComponentName()
+{
+    return cold ? cold->comp : no_tracking_info;
+}
+
+const std::string&
+Link::getSendingComponentType()
+{
+    return cold ? cold->ctype : no_tracking_info;
+}
+
+const std::string&
+Link::getSendingPort()
+{
+    return cold ? cold->port : no_tracking_info;
+}
+#endif
+
 
 } // namespace SST
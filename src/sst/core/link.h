@@ -12,15 +12,17 @@
 #ifndef SST_CORE_LINK_H
 #define SST_CORE_LINK_H
 
+#include "sst/core/directDeliveryQueue.h"
 #include "sst/core/event.h"
 #include "sst/core/sst_types.h"
 #include "sst/core/timeConverter.h"
 
+#include <vector>
+
 namespace SST {
 
 #define _LINK_DBG(fmt, args...) __DBG(DBG_LINK, Link, fmt, ##args)
 
-class ActivityQueue;
 class BaseComponent;
 class TimeConverter;
 class LinkPair;
@@ -36,10 +38,13 @@ class EventHandlerProfileTool;
 /** Link between two components. Carries events */
 class alignas(64) Link
 {
-    enum Type_t : uint16_t { POLL, HANDLER, SYNC, UNINITIALIZED };
-    enum Mode_t : uint16_t { INIT, RUN, COMPLETE };
+    enum Type_t : uint8_t { POLL, HANDLER, SYNC, UNINITIALIZED };
+    enum Mode_t : uint8_t { INIT, RUN, COMPLETE };
+    /** Queue a self link sends straight to in the run phase */
+    enum SelfSend_t : uint8_t { NO_SELF_SEND, SELF_SEND_VORTEX, SELF_SEND_DIRECT };
 
 public:
+    friend class BoundaryTrace;
     friend class LinkPair;
     friend class RankSync;
     friend class ThreadSync;
@@ -112,6 +117,79 @@ public:
      */
     inline void send(Event* event) { send_impl(0, event); }
 
+    /** Send a batch of events over the link with additional delay.
+     * The events are delivered in order at the same time, as a single
+     * event in the TimeVortex and the rank sync, and the handler is
+     * called once for each of them.  The link takes ownership of the
+     * events and clears events.
+     * @param delay - additional delay
+     * @param tc - time converter to specify units for the additional delay
+     * @param events - the Events to send
+     */
+    inline void sendBatch(SimTime_t delay, TimeConverter* tc, std::vector<Event*>& events)
+    {
+        sendBatch_impl(tc->convertToCoreTime(delay), events);
+    }
+
+    /** Send a batch of events with additional delay, specified by the
+     * Link's default timebase.  See sendBatch(SimTime_t,
+     * TimeConverter*, std::vector<Event*>&).
+     * @param delay The additional delay, in units of the default Link timebase
+     * @param events The Events to send
+     */
+    inline void sendBatch(SimTime_t delay, std::vector<Event*>& events)
+    {
+        sendBatch_impl(delay * defaultTimeBase, events);
+    }
+
+    /** Send a batch of events with the Link's default delay.  See
+     * sendBatch(SimTime_t, TimeConverter*, std::vector<Event*>&).
+     * @param events The Events to send
+     */
+    inline void sendBatch(std::vector<Event*>& events) { sendBatch_impl(0, events); }
+
+    /** Identifies an event sent with sendCancellable() */
+    typedef uint64_t CancelHandle;
+
+    /** Handle that never refers to a pending event */
+    static const CancelHandle NO_CANCEL_HANDLE = 0;
+
+    /** Send an event that can be cancelled until it is delivered.
+     * Otherwise the same as send(SimTime_t, TimeConverter*, Event*).
+     * Only available on links that deliver to an event handler on the
+     * same thread, such as self links.
+     * @param delay - additional delay
+     * @param tc - time converter to specify units for the additional delay
+     * @param event - the Event to send
+     * @return Handle to pass to cancel()
+     */
+    inline CancelHandle sendCancellable(SimTime_t delay, TimeConverter* tc, Event* event)
+    {
+        return sendCancellable_impl(tc->convertToCoreTime(delay), event);
+    }
+
+    /** Send a cancellable event with additional delay, using the
+     * Link's default timebase.  See sendCancellable(SimTime_t,
+     * TimeConverter*, Event*).
+     * @param delay The additional delay, in units of the default Link timebase
+     * @param event The event to send
+     * @return Handle to pass to cancel()
+     */
+    inline CancelHandle sendCancellable(SimTime_t delay, Event* event)
+    {
+        return sendCancellable_impl(delay * defaultTimeBase, event);
+    }
+
+    /** Cancel an event sent on this link with sendCancellable().  The
+     * event is deleted without being delivered.  It is only removed
+     * from the TimeVortex when it comes out or the TimeVortex is
+     * compacted, but it does not cost a handler call.
+     * @param handle Handle returned by sendCancellable()
+     * @return true if the event was cancelled, false if it was already
+     * delivered or cancelled
+     */
+    bool cancel(CancelHandle handle);
+
 
     /** Retrieve a pending event from the Link. For links which do not
      * have a set event handler, they can be polled with this function.
@@ -182,16 +260,11 @@ public:
     bool isConfigured() { return type != UNINITIALIZED; }
 
 #ifdef __SST_DEBUG_EVENT_TRACKING__
-    void setSendingComponentInfo(const std::string& comp_in, const std::string& type_in, const std::string& port_in)
-    {
-        comp  = comp_in;
-        ctype = type_in;
-        port  = port_in;
-    }
+    void setSendingComponentInfo(const std::string& comp_in, const std::string& type_in, const std::string& port_in);
 
-    const std::string& getSendingComponentName() { return comp; }
-    const std::string& getSendingComponentType() { return ctype; }
-    const std::string& getSendingPort() { return port; }
+    const std::string& getSendingComponentName();
+    const std::string& getSendingComponentType();
+    const std::string& getSendingPort();
 
 #endif
 
@@ -212,7 +285,43 @@ protected:
      * @param delay - additional total delay to add
      * @param event - the Event to send
      */
-    void send_impl(SimTime_t delay, Event* event);
+    inline void send_impl(SimTime_t delay, Event* event)
+    {
+        // Self links are the most common way to schedule events, so in
+        // the run phase they skip the checks and insert into the queue
+        // right here.  The direct delivery queue is final, so inserting
+        // into it is not a virtual call.
+        if ( NO_SELF_SEND != self_send && event != nullptr ) {
+            event->setDeliveryTime(current_time + delay + latency);
+            event->setDeliveryInfo(tag, delivery_info);
+            if ( SELF_SEND_DIRECT == self_send )
+                static_cast<DirectDeliveryQueue*>(send_queue)->insert(event);
+            else
+                send_queue->insert(event);
+            return;
+        }
+        send_checked(delay, event);
+    }
+
+    /** The part of send_impl() used by every link other than a self
+     * link in the run phase */
+    void send_checked(SimTime_t delay, Event* event);
+
+    /** Send a batch of events over the link with additional delay.
+     * @param delay - additional total delay to add
+     * @param events - the Events to send
+     */
+    void sendBatch_impl(SimTime_t delay, std::vector<Event*>& events);
+
+    /** Sets up an event for delivery the way send_impl() does, but
+     * does not insert it into send_queue */
+    Event* prepare_send(SimTime_t delay, Event* event);
+
+    /** Send a cancellable event over the link with additional delay.
+     * @param delay - additional total delay to add
+     * @param event - the Event to send
+     */
+    CancelHandle sendCancellable_impl(SimTime_t delay, Event* event);
 
     // Since Links are found in pairs, I will keep all the information
     // needed for me to send and deliver an event to the other side of
@@ -257,6 +366,7 @@ private:
     SimTime_t& current_time;
     Type_t     type;
     Mode_t     mode;
+    SelfSend_t self_send;
     LinkId_t   tag;
 
     /** Create a new link with a given tag
@@ -285,20 +395,45 @@ private:
     void setLatency(Cycle_t lat);
 
     void sendUntimedData_sync(Event* data);
+
+    /** Called by the sync objects to deliver a window of events
+     * received during a sync.  Each event is sent on its delivery
+     * link, and events going to the same queue are inserted with a
+     * single call to ActivityQueue::insertBatch(). */
+    static void sendBatch_sync(Activity** begin, Activity** end, SimTime_t current_cycle);
+
+    /** Delivery information an event was sent with.  For an event that
+     * can still be cancelled this is not what the event holds. */
+    static uintptr_t getSentDeliveryInfo(Event* event);
+
+    /** Called for an event that is deleted without being delivered, so
+     * a cancel handle no longer refers to it */
+    static void releaseCancellable(Event* event);
     void finalizeConfiguration();
     void prepareForComplete();
 
     void addProfileTool(SST::Profile::EventHandlerProfileTool* tool, const EventHandlerMetaData& mdata);
 
+    /** Set the partition of the other end of a link that crosses
+     * threads or ranks */
+    void setPeerRank(const RankInfo& rank);
 
-    LinkSendProfileToolList* profile_tools;
+    /** Partition of the other end of the link, which is unassigned
+     * unless the link crosses threads or ranks */
+    RankInfo getPeerRank() const;
 
+    class CancellableSend;
+    class CancellableSendPool;
+    struct ColdData;
 
-#ifdef __SST_DEBUG_EVENT_TRACKING__
-    std::string comp;
-    std::string ctype;
-    std::string port;
-#endif
+    /** Returns the cold data, creating it if needed */
+    ColdData* getColdData();
+
+    /** Profiling, cancellable send and event tracking state.  Most
+     * links never use any of it, so it is kept out of the Link and
+     * only created when first needed.  This keeps everything send()
+     * touches in one cache line. */
+    ColdData* cold;
 };
 
 /** Self Links are links from a component to itself */
@@ -16,8 +16,9 @@
 #include "sst/core/link.h"
 #include "sst/core/sst_types.h"
 
-#include <map>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace SST {
 
@@ -28,9 +29,10 @@ class LinkMap
 {
 
 private:
-    std::map<std::string, Link*> linkMap;
+    // Hashed, since components like crossbars can have thousands of ports
+    std::unordered_map<std::string, Link*> linkMap;
     // const std::vector<std::string> * allowedPorts;
-    std::vector<std::string>     selfPorts;
+    std::unordered_set<std::string>        selfPorts;
 
     // bool checkPort(const char *def, const char *offered) const
     // {
@@ -126,7 +128,7 @@ public:
     ~LinkMap()
     {
         // Delete all the links in the map
-        for ( std::map<std::string, Link*>::iterator it = linkMap.begin(); it != linkMap.end(); ++it ) {
+        for ( auto it = linkMap.begin(); it != linkMap.end(); ++it ) {
             delete it->second;
         }
         linkMap.clear();
@@ -144,17 +146,9 @@ public:
      * Add a port name to the list of allowed ports.
      * Used by SelfLinks, as these are undocumented.
      */
-    void addSelfPort(const std::string& name) { selfPorts.push_back(name); }
+    void addSelfPort(const std::string& name) { selfPorts.insert(name); }
 
-    bool isSelfPort(const std::string& name) const
-    {
-        for ( std::vector<std::string>::const_iterator i = selfPorts.begin(); i != selfPorts.end(); ++i ) {
-            /* Compare name with stored name, which may have wildcards */
-            // if ( checkPort(i->c_str(), x) ) {
-            if ( name == *i ) { return true; }
-        }
-        return false;
-    }
+    bool isSelfPort(const std::string& name) const { return selfPorts.count(name) != 0; }
 
     /** Inserts a new pair of name and link into the map */
     void insertLink(const std::string& name, Link* link) { linkMap.insert(std::pair<std::string, Link*>(name, link)); }
@@ -170,7 +164,7 @@ public:
         //             std::cerr << "Warning:  Using undocumented port '" << name << "'." << std::endl;
         // #endif
         //         }
-        std::map<std::string, Link*>::iterator it = linkMap.find(name);
+        auto it = linkMap.find(name);
         if ( it == linkMap.end() )
             return nullptr;
         else
@@ -186,7 +180,7 @@ public:
     // FIXME: Kludge for now, fix later.  Need to make LinkMap look
     // like a regular map instead.
     /** Return a reference to the internal map */
-    std::map<std::string, Link*>& getLinkMap() { return linkMap; }
+    std::unordered_map<std::string, Link*>& getLinkMap() { return linkMap; }
 };
 
 } // namespace SST
@@ -42,29 +42,45 @@ REENABLE_WARNING
 #include "sst/core/model/sstmodel.h"
 #include "sst/core/objectComms.h"
 #include "sst/core/rankInfo.h"
+#include "sst/core/serialization/serializable.h"
 #include "sst/core/simulation_impl.h"
 #include "sst/core/statapi/statengine.h"
 #include "sst/core/stringize.h"
+#include "sst/core/threadAffinity.h"
 #include "sst/core/threadsafe.h"
 #include "sst/core/timeLord.h"
 #include "sst/core/timeVortex.h"
 
+#include <algorithm>
 #include <cinttypes>
+#include <climits>
+#include <cstring>
 #include <exception>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <map>
+#include <numeric>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
 #include <signal.h>
 #include <sys/resource.h>
+#include <sys/wait.h>
+#include <thread>
 #include <time.h>
+#include <unistd.h>
 
 // Configuration Graph Generation Options
+#include "sst/core/cfgoutput/binaryConfigOutput.h"
 #include "sst/core/cfgoutput/dotConfigOutput.h"
 #include "sst/core/cfgoutput/jsonConfigOutput.h"
 #include "sst/core/cfgoutput/pythonConfigOutput.h"
 #include "sst/core/configGraphOutput.h"
 #include "sst/core/eli/elementinfo.h"
 
+#include "nlohmann/json.hpp"
+
 using namespace SST::Core;
 using namespace SST::Partition;
 using namespace std;
@@ -200,6 +216,414 @@ dump_partition(Config& cfg, ConfigGraph* graph, const RankInfo& size)
     }
 }
 
+// Print the load and communication of each partition so partitioners
+// can be compared without running the simulation.  Traffic is
+// estimated by assuming each cut link carries one event per latency.
+static void
+print_partition_report(Config& cfg, ConfigGraph* graph, const RankInfo& size)
+{
+    size_t                num_parts = size.rank * size.thread;
+    std::vector<size_t>   counts(num_parts, 0);
+    std::vector<double>   weights(num_parts, 0.0);
+    std::vector<size_t>   cuts(num_parts, 0);
+    ConfigComponentMap_t& comps = graph->getComponentMap();
+
+    for ( auto* comp : comps ) {
+        size_t part = comp->rank.rank * size.thread + comp->rank.thread;
+        counts[part]++;
+        weights[part] += comp->weight;
+    }
+
+    size_t    rank_cuts      = 0;
+    size_t    thread_cuts    = 0;
+    SimTime_t min_rank_lat   = MAX_SIMTIME_T;
+    SimTime_t min_thread_lat = MAX_SIMTIME_T;
+    double    rank_traffic   = 0.0;
+    double    thread_traffic = 0.0;
+    for ( auto* link : graph->getLinkMap() ) {
+        const RankInfo& a = comps[COMPONENT_ID_MASK(link->component[0])]->rank;
+        const RankInfo& b = comps[COMPONENT_ID_MASK(link->component[1])]->rank;
+        if ( a == b ) continue;
+        cuts[a.rank * size.thread + a.thread]++;
+        cuts[b.rank * size.thread + b.thread]++;
+        SimTime_t lat = std::max<SimTime_t>(1, link->getMinLatency());
+        if ( a.rank != b.rank ) {
+            rank_cuts++;
+            min_rank_lat = std::min(min_rank_lat, lat);
+            rank_traffic += 1.0 / lat;
+        }
+        else {
+            thread_cuts++;
+            min_thread_lat = std::min(min_thread_lat, lat);
+            thread_traffic += 1.0 / lat;
+        }
+    }
+
+    UnitAlgebra time_base = Simulation_impl::getTimeLord()->getTimeBase();
+
+    auto to_time = [&](SimTime_t cycles) {
+        UnitAlgebra t = time_base;
+        t *= cycles;
+        return t.toStringBestSI();
+    };
+    auto to_rate = [&](double events_per_cycle) {
+        UnitAlgebra r = time_base;
+        r.invert();
+        r *= events_per_cycle;
+        return r.toStringBestSI();
+    };
+
+    double total_weight = std::accumulate(weights.begin(), weights.end(), 0.0);
+    double max_weight   = *std::max_element(weights.begin(), weights.end());
+
+    g_output.output(
+        "# Partition report (%s, %" PRIu32 " ranks, %" PRIu32 " threads per rank)\n", cfg.partitioner().c_str(),
+        size.rank, size.thread);
+    g_output.output("#   Rank.Thread  Components       Weight   Cut links\n");
+    for ( uint32_t i = 0; i < size.rank; i++ ) {
+        for ( uint32_t t = 0; t < size.thread; t++ ) {
+            size_t part = i * size.thread + t;
+            g_output.output(
+                "#   %6" PRIu32 ".%-4" PRIu32 " %10zu %12.2f %11zu\n", i, t, counts[part], weights[part], cuts[part]);
+        }
+    }
+    if ( total_weight > 0.0 ) {
+        g_output.output("#   Weight imbalance (max / mean):  %.3f\n", max_weight * num_parts / total_weight);
+    }
+    g_output.output("#   Links:                          %zu\n", graph->getLinkMap().size());
+    g_output.output("#   Cross rank links:               %zu\n", rank_cuts);
+    g_output.output("#   Cross thread links:             %zu\n", thread_cuts);
+    if ( min_rank_lat != MAX_SIMTIME_T ) {
+        g_output.output("#   Min cross rank latency:         %s (rank sync interval)\n", to_time(min_rank_lat).c_str());
+        g_output.output("#   Est. cross rank traffic:        %s events\n", to_rate(rank_traffic).c_str());
+    }
+    if ( min_thread_lat != MAX_SIMTIME_T ) {
+        g_output.output(
+            "#   Min cross thread latency:       %s (thread sync interval)\n", to_time(min_thread_lat).c_str());
+        g_output.output("#   Est. cross thread traffic:      %s events\n", to_rate(thread_traffic).c_str());
+    }
+}
+
+// Returns the node of each rank, numbering the nodes in the order of
+// their lowest rank.  Must be called on all ranks.
+static std::vector<uint32_t>
+getRankNodes(const RankInfo& world_size)
+{
+    std::vector<uint32_t> rank_node(world_size.rank, 0);
+#ifdef SST_CONFIG_HAVE_MPI
+    if ( world_size.rank == 1 ) return rank_node;
+
+    int my_rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+    MPI_Comm node_comm;
+    MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, my_rank, MPI_INFO_NULL, &node_comm);
+    // Rank 0 of the node communicator is the lowest rank on the node
+    int leader = my_rank;
+    MPI_Bcast(&leader, 1, MPI_INT, 0, node_comm);
+    MPI_Comm_free(&node_comm);
+
+    std::vector<int> leaders(world_size.rank);
+    MPI_Allgather(&leader, 1, MPI_INT, leaders.data(), 1, MPI_INT, MPI_COMM_WORLD);
+    std::map<int, uint32_t> nodes;
+    for ( uint32_t r = 0; r < world_size.rank; r++ )
+        rank_node[r] = nodes.emplace(leaders[r], nodes.size()).first->second;
+#endif
+    return rank_node;
+}
+
+// Set component weights from a file of measured costs.  The file can
+// hold the output of any number of profiling tools; in each section
+// the time column is used if there is one, otherwise the count.
+// Profile data is scaled to the average weight of the components it
+// covers.  Lines outside a profile section are read as "name, weight"
+// and used as is.  Subcomponent and port entries are added to the
+// component they belong to.  Traffic on each link from the event comm
+// profile tool (collected at subcomponent level with track_ports) is
+// used to weight the links.
+static void
+load_partition_weights(Config& cfg, ConfigGraph* graph)
+{
+    if ( cfg.partition_weights() == "" ) return;
+
+    ifstream weight_file(cfg.partition_weights().c_str());
+    if ( !weight_file.is_open() ) {
+        g_output.fatal(CALL_INFO, 1, "Unable to open partition weights file: %s\n", cfg.partition_weights().c_str());
+    }
+
+    std::map<ComponentId_t, double> profiled;
+    std::map<ComponentId_t, double> direct;
+    bool                            in_profile = false;
+    bool                            in_traffic = false;
+    bool                            in_links   = false;
+    size_t                          column     = 1;
+    size_t                          unmatched  = 0;
+    size_t                          links      = 0;
+    std::string                     line;
+    while ( std::getline(weight_file, line) ) {
+        SST::trim(line);
+        if ( line.empty() || line[0] == '#' ) continue;
+
+        std::vector<std::string> fields;
+        SST::tokenize(fields, line, ",", true);
+        if ( fields.size() < 2 || line.back() == ':' ) {
+            // Profile tool name or partition heading, which starts a
+            // new section
+            in_profile = false;
+            in_traffic = false;
+            column     = 1;
+            continue;
+        }
+
+        if ( fields[0] == "Source" || fields[0] == "Link" ) {
+            // Header of traffic between partitions or on links
+            in_profile = false;
+            in_traffic = true;
+            in_links   = fields[0] == "Link";
+            continue;
+        }
+
+        if ( in_traffic ) {
+            if ( !in_links || fields.size() < 3 ) continue;
+            // Link names are the component or subcomponent name
+            // followed by the port
+            auto             index = fields[0].rfind(":");
+            ConfigComponent* comp =
+                index == std::string::npos ? nullptr : graph->findComponentByName(fields[0].substr(0, index));
+            if ( comp == nullptr ) {
+                unmatched++;
+                continue;
+            }
+            std::string port   = fields[0].substr(index + 1);
+            double      events = strtod(fields[2].c_str(), nullptr);
+            for ( auto id : comp->links ) {
+                ConfigLink* link = graph->getLinkMap()[id];
+                for ( int side = 0; side < 2; ++side ) {
+                    if ( link->component[side] == comp->id && link->port[side] == port ) {
+                        link->traffic += events;
+                        links++;
+                    }
+                }
+            }
+            continue;
+        }
+
+        if ( fields[0] == "Name" ) {
+            // Header line; use the first time column if there is one
+            in_profile = true;
+            column     = 1;
+            for ( size_t i = 1; i < fields.size(); ++i ) {
+                if ( fields[i].find("time (s)") != std::string::npos ) {
+                    column = i;
+                    break;
+                }
+            }
+            continue;
+        }
+
+        if ( column >= fields.size() ) continue;
+
+        char*  end;
+        double value = strtod(fields[column].c_str(), &end);
+        if ( end == fields[column].c_str() || value < 0.0 ) {
+            g_output.fatal(
+                CALL_INFO, 1, "Invalid weight '%s' for %s in partition weights file %s\n", fields[column].c_str(),
+                fields[0].c_str(), cfg.partition_weights().c_str());
+        }
+
+        ConfigComponent* comp = graph->findComponentByName(fields[0].substr(0, fields[0].find(":")));
+        if ( comp == nullptr ) {
+            // Global or type level profile data, or a component
+            // that is not in this model
+            unmatched++;
+            continue;
+        }
+        if ( in_profile )
+            profiled[comp->id] += value;
+        else
+            direct[comp->id] += value;
+    }
+
+    // Weights given directly take precedence over profile data
+    for ( auto& x : direct ) {
+        profiled.erase(x.first);
+    }
+
+    if ( links > 0 ) {
+        g_output.verbose(
+            CALL_INFO, 1, 0, "# Set traffic of %zu link ends from %s\n", links, cfg.partition_weights().c_str());
+    }
+
+    if ( profiled.empty() && direct.empty() ) {
+        if ( links > 0 ) return;
+        g_output.output(
+            "WARNING: No component weights found in partition weights file %s\n", cfg.partition_weights().c_str());
+        return;
+    }
+
+    if ( !profiled.empty() ) {
+        // Scale the measured values so they have the same average as
+        // the weights they replace.  This keeps them comparable to the
+        // weights of components with no measurement.
+        double old_total = 0.0;
+        double new_total = 0.0;
+        for ( auto& x : profiled ) {
+            old_total += graph->findComponent(x.first)->weight;
+            new_total += x.second;
+        }
+        double scale = new_total > 0.0 ? old_total / new_total : 0.0;
+
+        // Components with no measurable work still get a small weight
+        double min_weight = 0.01 * old_total / profiled.size();
+        for ( auto& x : profiled ) {
+            graph->findComponent(x.first)->setWeight(std::max(min_weight, x.second * scale));
+        }
+    }
+
+    for ( auto& x : direct ) {
+        graph->findComponent(x.first)->setWeight(x.second);
+    }
+
+    g_output.verbose(
+        CALL_INFO, 1, 0, "# Set weights of %zu components from %s (%zu entries did not match a component)\n",
+        profiled.size() + direct.size(), cfg.partition_weights().c_str(), unmatched);
+}
+
+// Header of a partition cache file.  It is followed by the rank and
+// thread of each component, in component order.
+struct PartitionCacheHeader
+{
+    char     magic[8];
+    uint64_t key;
+    uint64_t count;
+};
+
+static const char partition_cache_magic[8] = { 'S', 'S', 'T', 'P', 'A', 'R', 'T', '1' };
+
+// Hash of everything a partition depends on, so a cached partition is
+// only used for the same graph, weights, partitioner and world size
+static uint64_t
+partition_cache_key(Config& cfg, ConfigGraph* graph, const RankInfo& world_size)
+{
+    // FNV-1a
+    uint64_t hash = 14695981039346656037ull;
+    auto     add  = [&hash](const void* data, size_t len) {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for ( size_t i = 0; i < len; i++ ) {
+            hash ^= bytes[i];
+            hash *= 1099511628211ull;
+        }
+    };
+
+    add(cfg.partitioner().data(), cfg.partitioner().size());
+    add(&world_size.rank, sizeof(world_size.rank));
+    add(&world_size.thread, sizeof(world_size.thread));
+    for ( auto comp : graph->getComponentMap() ) {
+        add(&comp->id, sizeof(comp->id));
+        add(&comp->weight, sizeof(comp->weight));
+        add(&comp->rank.rank, sizeof(comp->rank.rank));
+        add(&comp->rank.thread, sizeof(comp->rank.thread));
+        add(comp->coords.data(), comp->coords.size() * sizeof(double));
+    }
+    for ( auto link : graph->getLinkMap() ) {
+        add(link->component, sizeof(link->component));
+        add(link->latency, sizeof(link->latency));
+        add(&link->no_cut, sizeof(link->no_cut));
+    }
+    return hash;
+}
+
+// Set the ranks of the components from a partition cache file.
+// Returns false, leaving the graph alone, if the file doesn't exist or
+// is for a different graph.
+static bool
+load_partition_cache(Config& cfg, ConfigGraph* graph, uint64_t key)
+{
+    std::ifstream in(cfg.partition_cache(), std::ios::binary);
+    if ( !in ) return false;
+
+    ConfigComponentMap_t& comps = graph->getComponentMap();
+    PartitionCacheHeader  header;
+    in.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if ( !in || std::memcmp(header.magic, partition_cache_magic, sizeof(header.magic)) != 0 || header.key != key ||
+         header.count != comps.size() ) {
+        g_output.verbose(
+            CALL_INFO, 1, 0, "# Partition cache %s is for a different graph, partitioning again\n",
+            cfg.partition_cache().c_str());
+        return false;
+    }
+
+    std::vector<uint32_t> ranks(2 * header.count);
+    in.read(reinterpret_cast<char*>(ranks.data()), ranks.size() * sizeof(uint32_t));
+    if ( !in ) {
+        g_output.verbose(
+            CALL_INFO, 1, 0, "# Partition cache %s is truncated, partitioning again\n", cfg.partition_cache().c_str());
+        return false;
+    }
+
+    size_t i = 0;
+    for ( auto comp : comps ) {
+        comp->rank = RankInfo(ranks[i], ranks[i + 1]);
+        i += 2;
+    }
+    g_output.verbose(CALL_INFO, 1, 0, "# Using the partition cached in %s\n", cfg.partition_cache().c_str());
+    return true;
+}
+
+// Save the ranks of the components to a partition cache file.  The
+// file is written under a temporary name and then renamed, so other
+// runs never read a partly written file.
+static void
+save_partition_cache(Config& cfg, ConfigGraph* graph, uint64_t key)
+{
+    ConfigComponentMap_t& comps = graph->getComponentMap();
+    PartitionCacheHeader  header;
+    std::memcpy(header.magic, partition_cache_magic, sizeof(header.magic));
+    header.key   = key;
+    header.count = comps.size();
+
+    std::vector<uint32_t> ranks;
+    ranks.reserve(2 * header.count);
+    for ( auto comp : comps ) {
+        ranks.push_back(comp->rank.rank);
+        ranks.push_back(comp->rank.thread);
+    }
+
+    std::string   tmp_name = cfg.partition_cache() + ".tmp" + std::to_string(getpid());
+    std::ofstream out(tmp_name, std::ios::binary);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(ranks.data()), ranks.size() * sizeof(uint32_t));
+    out.close();
+    if ( !out || std::rename(tmp_name.c_str(), cfg.partition_cache().c_str()) != 0 ) {
+        std::remove(tmp_name.c_str());
+        g_output.output("WARNING: Unable to write partition cache %s\n", cfg.partition_cache().c_str());
+        return;
+    }
+    g_output.verbose(CALL_INFO, 1, 0, "# Saved the partition to %s\n", cfg.partition_cache().c_str());
+}
+
+static void
+add_graph_libraries(ConfigComponent* comp, std::set<std::string>& lib_names)
+{
+    lib_names.insert(comp->type.substr(0, comp->type.find('.')));
+    for ( auto* sub : comp->subComponents ) {
+        add_graph_libraries(sub, lib_names);
+    }
+}
+
+// Find and read the libraries of every component in this rank's part
+// of the graph in parallel before the threads start, so they don't
+// wait on the filesystem one library at a time when the components
+// are built
+static void
+prefetch_graph_libraries(ConfigGraph* graph)
+{
+    std::set<std::string> lib_names;
+    for ( auto* comp : graph->getComponentMap() ) {
+        add_graph_libraries(comp, lib_names);
+    }
+    Factory::getFactory()->prefetchLibraries(lib_names);
+}
+
 static void
 do_graph_wireup(ConfigGraph* graph, SST::Simulation_impl* sim, const RankInfo& myRank, SimTime_t min_part)
 {
@@ -211,6 +635,29 @@ do_graph_wireup(ConfigGraph* graph, SST::Simulation_impl* sim, const RankInfo& m
     sim->performWireUp(*graph, myRank, min_part);
 }
 
+// Give the memory freed after the build back to the OS, so the heap
+// doesn't keep the high water mark of graph construction
+static void
+release_free_memory()
+{
+#ifdef __GLIBC__
+    malloc_trim(0);
+#endif
+    g_output.verbose(CALL_INFO, 1, 0, "# Released the memory freed after building the simulation\n");
+}
+
+// With --fast-exit, the simulation objects are left for the OS to
+// reclaim when the process exits.  Undeleted events can only be dumped
+// after teardown, so --event-dump-file turns it off.
+static bool
+skip_teardown(const Config& cfg)
+{
+#ifdef USE_MEMPOOL
+    if ( cfg.event_dump_file() != "" ) return false;
+#endif
+    return cfg.fast_exit();
+}
+
 // Functions to do shared (static) initialization and notificaion for
 // stats engines.  Right now, the StatGroups are per MPI rank and
 // everything else in StatEngine is per partition.
@@ -248,10 +695,18 @@ do_link_preparation(ConfigGraph* graph, SST::Simulation_impl* sim, const RankInf
     sim->prepareLinks(*graph, myRank, min_part);
 }
 
-// Returns the extension, or an empty string if there was no extension
+// Returns the extension, or an empty string if there was no extension.
+// A .gz suffix for compressed output is kept at the end, and isn't
+// part of the returned extension.
 static std::string
 addRankToFileName(std::string& file_name, int rank)
 {
+    std::string gz;
+    if ( file_name.size() > 3 && file_name.compare(file_name.size() - 3, 3, ".gz") == 0 ) {
+        gz = ".gz";
+        file_name.resize(file_name.size() - 3);
+    }
+
     auto        index = file_name.find_last_of(".");
     std::string base;
     std::string ext;
@@ -263,10 +718,333 @@ addRankToFileName(std::string& file_name, int rank)
     else {
         base = file_name;
     }
-    file_name = base + std::to_string(rank) + ext;
+    file_name = base + std::to_string(rank) + ext + gz;
     return ext;
 }
 
+// Variants of an ensemble that is forked after setup.  They are copied
+// from the graph, which is deleted once the components are built.
+static std::vector<ConfigGraph::EnsembleVariant> ensemble_variants;
+
+// Run the variants of an ensemble in child processes, which share
+// everything done so far copy-on-write.  Returns the index of the
+// variant in each child, and -1 in the parent once all the children
+// are done, with status set to 1 if any of them failed.
+static int
+run_ensemble(Config& cfg, size_t num_variants, const RankInfo& world_size, int& status)
+{
+    uint32_t jobs = cfg.ensemble_jobs();
+    if ( jobs == 0 ) jobs = std::max(1u, std::thread::hardware_concurrency() / world_size.thread);
+
+    g_output.verbose(
+        CALL_INFO, 1, 0, "# Running an ensemble of %zu variants, %" PRIu32 " at a time\n", num_variants, jobs);
+
+    // Don't let the children write out what is still buffered
+    fflush(stdout);
+    fflush(stderr);
+
+    std::map<pid_t, size_t> running;
+    size_t                  next = 0;
+    status                       = 0;
+    while ( next < num_variants || !running.empty() ) {
+        if ( next < num_variants && running.size() < jobs ) {
+            pid_t pid = fork();
+            if ( pid == 0 ) return next;
+            if ( pid < 0 ) {
+                g_output.fatal(
+                    CALL_INFO, 1, "ERROR: Unable to start ensemble variant %zu: %s\n", next, strerror(errno));
+            }
+            running[pid] = next++;
+            continue;
+        }
+
+        int   child_status;
+        pid_t pid = waitpid(-1, &child_status, 0);
+        if ( pid < 0 ) {
+            if ( errno == EINTR ) continue;
+            g_output.fatal(CALL_INFO, 1, "ERROR: Unable to wait for ensemble variants: %s\n", strerror(errno));
+        }
+        auto it = running.find(pid);
+        if ( it == running.end() ) continue;
+        if ( WIFEXITED(child_status) && WEXITSTATUS(child_status) == 0 ) {
+            g_output.verbose(CALL_INFO, 1, 0, "# Ensemble variant %zu finished\n", it->second);
+        }
+        else {
+            g_output.output("WARNING: Ensemble variant %zu failed\n", it->second);
+            status = 1;
+        }
+        running.erase(it);
+    }
+    return -1;
+}
+
+// Send the output of the run of a variant to ensemble<index>.out
+static void
+redirect_ensemble_output(size_t index)
+{
+    std::string out_name = "ensemble.out";
+    addRankToFileName(out_name, index);
+    if ( freopen(out_name.c_str(), "w", stdout) == nullptr ) {
+        g_output.fatal(CALL_INFO, 1, "ERROR: Unable to open %s: %s\n", out_name.c_str(), strerror(errno));
+    }
+    dup2(fileno(stdout), fileno(stderr));
+}
+
+// Set up the child of run_ensemble() that runs a variant from the
+// graph.  Its statistic files get the index added to their names,
+// like the rank in parallel runs.
+static void
+start_ensemble_variant(ConfigGraph* graph, size_t index)
+{
+    redirect_ensemble_output(index);
+    ConfigGraph::applyEnsembleVariant(graph->getEnsembleVariants()[index]);
+
+    for ( auto& out : graph->getStatOutputs() ) {
+        if ( !out.params.contains("filepath") ) continue;
+        std::string file = out.params.find<std::string>("filepath");
+        addRankToFileName(file, index);
+        out.params.insert("filepath", file);
+    }
+}
+
+// Fork the runs of an ensemble after setup.  The parent exits once
+// they are done, and each child goes on to run its variant.  Only
+// params that components read after setup see the variant.
+static void
+fork_ensemble_after_setup(Config& cfg, const RankInfo& world_size)
+{
+    int status  = 0;
+    int variant = run_ensemble(cfg, ensemble_variants.size(), world_size, status);
+    if ( variant < 0 ) {
+#ifdef SST_CONFIG_HAVE_MPI
+        MPI_Finalize();
+#endif
+        exit(status);
+    }
+
+    redirect_ensemble_output(variant);
+    ConfigGraph::applyEnsembleVariant(ensemble_variants[variant]);
+    Statistics::StatisticProcessingEngine::addIndexToOutputFiles(variant);
+}
+
+#ifdef SST_CONFIG_HAVE_MPI
+// Size at which a piece of a graph being sent to another rank is
+// closed.  Each side only holds a couple of pieces at a time instead of
+// the whole serialized graph.
+static const size_t graph_chunk_bytes = 64 * 1024 * 1024;
+
+// Number of ways each rank splits its graph when distributing it.
+// Each split is a single pass over the graph, so a wider split means
+// fewer passes on rank 0, at the cost of more sends before it can
+// split again.
+static const size_t graph_split_fanout = 8;
+
+// Pack objects from it onwards into buffer until the end or the size
+// limit is reached.  The number of objects packed goes in front of the
+// data.  Returns the number of bytes used.
+template <typename iterT>
+static size_t
+pack_graph_chunk(iterT& it, iterT end, std::vector<char>& buffer)
+{
+    SST::Core::Serialization::serializer ser;
+    ser.start_packing(buffer, sizeof(uint32_t));
+    // Repeated strings are only written once per piece
+    ConfigStringTable::Scope strings;
+
+    uint32_t count = 0;
+    while ( it != end && ser.size() < graph_chunk_bytes ) {
+        auto obj = *it;
+        ser&     obj;
+        ++it;
+        ++count;
+    }
+    memcpy(buffer.data(), &count, sizeof(count));
+
+    size_t size = sizeof(count) + ser.size();
+    if ( size > INT_MAX ) {
+        g_output.fatal(CALL_INFO, -1, "Error sending graph: a single object serializes to more than 2GB\n");
+    }
+    return size;
+}
+
+// Unpack a piece of a graph made by pack_graph_chunk() into map.
+// Returns the number of objects added.
+template <typename T, typename mapT>
+static uint32_t
+unpack_graph_chunk(char* buffer, size_t size, mapT& map)
+{
+    uint32_t count;
+    memcpy(&count, buffer, sizeof(count));
+
+    SST::Core::Serialization::serializer ser;
+    ser.start_unpacking(buffer + sizeof(count), size - sizeof(count));
+    ConfigStringTable::Scope strings;
+
+    for ( uint32_t i = 0; i < count; i++ ) {
+        T* obj = nullptr;
+        ser& obj;
+        // Objects arrive in key order, so each one goes at the end
+        map.insert(obj);
+    }
+    return count;
+}
+
+// Send a graph to another rank in pieces.  The next piece is packed
+// while the previous one is in flight, so rank 0 serializes while the
+// receiver deserializes.
+static void
+send_graph(int dest, int tag, ConfigGraph& graph)
+{
+    ConfigComponentMap_t& comps = graph.getComponentMap();
+    ConfigLinkMap_t&      links = graph.getLinkMap();
+
+    // Everything but the components and links, along with how many of
+    // those follow
+    std::vector<char> buffers[2];
+    MPI_Request       reqs[2] = { MPI_REQUEST_NULL, MPI_REQUEST_NULL };
+    {
+        SST::Core::Serialization::serializer ser;
+        ser.start_packing(buffers[0]);
+        uint64_t num_comps = comps.size();
+        uint64_t num_links = links.size();
+        ser&     num_comps;
+        ser&     num_links;
+        graph.serialize_statistics(ser);
+        MPI_Send(buffers[0].data(), ser.size(), MPI_BYTE, dest, tag, MPI_COMM_WORLD);
+    }
+
+    int  current = 0;
+    auto comp    = comps.begin();
+    while ( comp != comps.end() ) {
+        MPI_Wait(&reqs[current], MPI_STATUS_IGNORE);
+        size_t size = pack_graph_chunk(comp, comps.end(), buffers[current]);
+        MPI_Isend(buffers[current].data(), size, MPI_BYTE, dest, tag, MPI_COMM_WORLD, &reqs[current]);
+        current = 1 - current;
+    }
+    auto link = links.begin();
+    while ( link != links.end() ) {
+        MPI_Wait(&reqs[current], MPI_STATUS_IGNORE);
+        size_t size = pack_graph_chunk(link, links.end(), buffers[current]);
+        MPI_Isend(buffers[current].data(), size, MPI_BYTE, dest, tag, MPI_COMM_WORLD, &reqs[current]);
+        current = 1 - current;
+    }
+    MPI_Waitall(2, reqs, MPI_STATUSES_IGNORE);
+}
+
+// Receive a graph sent with send_graph() into an empty graph
+static void
+recv_graph(int src, int tag, ConfigGraph& graph)
+{
+    std::vector<char> buffer;
+    auto              recv_chunk = [&]() -> size_t {
+        MPI_Status status;
+        MPI_Probe(src, tag, MPI_COMM_WORLD, &status);
+        // All the pieces come from the same rank
+        src = status.MPI_SOURCE;
+        int size;
+        MPI_Get_count(&status, MPI_BYTE, &size);
+        if ( buffer.size() < (size_t)size ) buffer.resize(size);
+        MPI_Recv(buffer.data(), size, MPI_BYTE, src, tag, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+        return size;
+    };
+
+    uint64_t num_comps;
+    uint64_t num_links;
+    {
+        size_t                               size = recv_chunk();
+        SST::Core::Serialization::serializer ser;
+        ser.start_unpacking(buffer.data(), size);
+        ser& num_comps;
+        ser& num_links;
+        graph.serialize_statistics(ser);
+    }
+
+    uint64_t count = 0;
+    while ( count < num_comps ) {
+        size_t size = recv_chunk();
+        count += unpack_graph_chunk<ConfigComponent>(buffer.data(), size, graph.getComponentMap());
+    }
+    count = 0;
+    while ( count < num_links ) {
+        size_t size = recv_chunk();
+        count += unpack_graph_chunk<ConfigLink>(buffer.data(), size, graph.getLinkMap());
+    }
+    graph.setComponentConfigGraphPointers();
+}
+
+// For --parallel-load=NODE, hand each rank on the node its part of the
+// full graph, which only node rank 0 has.  Node rank 0 packs the parts
+// into a window shared by the node, and the other ranks unpack theirs
+// straight from it, so the graph is never sent over MPI.
+static void
+share_node_graph(MPI_Comm node_comm, const RankInfo& myRank, ConfigGraph*& graph)
+{
+    int node_rank, node_size;
+    MPI_Comm_rank(node_comm, &node_rank);
+    MPI_Comm_size(node_comm, &node_size);
+
+    std::vector<uint32_t> node_ranks(node_size);
+    uint32_t              my_rank = myRank.rank;
+    MPI_Allgather(&my_rank, 1, MPI_UINT32_T, node_ranks.data(), 1, MPI_UINT32_T, node_comm);
+
+    // Split off the part of each rank on the node in one pass.
+    // Components on other nodes are dropped, except for ghosts.
+    std::vector<ConfigGraph*> parts;
+    std::vector<uint64_t>     offsets(node_size + 1, 0);
+    if ( node_rank == 0 ) {
+        std::vector<std::set<uint32_t>> rank_sets(node_size);
+        for ( int i = 0; i < node_size; i++ )
+            rank_sets[i].insert(node_ranks[i]);
+        parts = graph->splitGraph(rank_sets);
+
+        for ( int i = 1; i < node_size; i++ ) {
+            SST::Core::Serialization::serializer ser;
+            ser.start_sizing();
+            ser& *parts[i - 1];
+            offsets[i + 1] = offsets[i] + ser.size();
+        }
+    }
+    if ( node_size == 1 ) return;
+    MPI_Bcast(offsets.data(), node_size + 1, MPI_UINT64_T, 0, node_comm);
+
+    // Only node rank 0 allocates; the others get the address of its
+    // memory
+    char*   base;
+    MPI_Win window;
+    MPI_Win_allocate_shared(node_rank == 0 ? offsets[node_size] : 0, 1, MPI_INFO_NULL, node_comm, &base, &window);
+    MPI_Aint win_size;
+    int      disp_unit;
+    MPI_Win_shared_query(window, 0, &win_size, &disp_unit, &base);
+
+    if ( node_rank == 0 ) {
+        for ( int i = 1; i < node_size; i++ ) {
+            SST::Core::Serialization::serializer ser;
+            ser.start_packing(base + offsets[i], offsets[i + 1] - offsets[i]);
+            ser& *parts[i - 1];
+            delete parts[i - 1];
+        }
+    }
+
+    // Make the parts visible before any rank on the node reads them
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, window);
+    MPI_Win_sync(window);
+    MPI_Barrier(node_comm);
+    MPI_Win_sync(window);
+    MPI_Win_unlock_all(window);
+
+    if ( node_rank != 0 ) {
+        delete graph;
+        graph = new ConfigGraph();
+        SST::Core::Serialization::serializer ser;
+        ser.start_unpacking(base + offsets[node_rank], offsets[node_rank + 1] - offsets[node_rank]);
+        ser& *graph;
+    }
+
+    // Freeing the window waits for every rank to be done with it
+    MPI_Win_free(&window);
+}
+#endif
+
 static void
 doSerialOnlyGraphOutput(SST::Config* cfg, ConfigGraph* graph)
 {
@@ -311,6 +1089,24 @@ doParallelCapableGraphOutput(SST::Config* cfg, ConfigGraph* graph, const RankInf
         JSONConfigGraphOutput out(file_name.c_str());
         out.generate(cfg, graph);
     }
+
+    // User asked us to dump a binary snapshot of the config graph
+    if ( cfg->output_binary() != "" ) {
+        // The extension is how the model is recognized when it is
+        // read back in, so check it whether or not the output is split
+        std::string       file_name(cfg->output_binary());
+        const std::string ext(".sstgraph");
+        if ( file_name.size() <= ext.size() ||
+             file_name.compare(file_name.size() - ext.size(), ext.size(), ext) != 0 ) {
+            g_output.fatal(CALL_INFO, 1, "--output-binary requires a filename with a .sstgraph extension\n");
+        }
+        if ( cfg->parallel_output() ) {
+            // Append rank number to base filename
+            addRankToFileName(file_name, myRank.rank);
+        }
+        BinaryConfigGraphOutput out(file_name.c_str());
+        out.generate(cfg, graph);
+    }
 }
 
 typedef struct
@@ -329,13 +1125,46 @@ typedef struct
     uint64_t    current_tv_depth;
     uint64_t    sync_data_size;
 
+    // Run loop balance information
+    uint64_t events_executed;
+    double   run_loop_time;
+    double   sync_time;
+    double   run_barrier_time;
+
+    // Time spent in each phase, for --timing-info-json
+    double              init_time;
+    std::vector<double> init_round_times;
+    double              setup_time;
+    double              run_phase_time;
+    double              complete_time;
+    double              finish_time;
+    double              stat_output_time;
+    double              teardown_time;
+
 } SimThreadInfo_t;
 
+// Records the memory use of the core subsystems at the end of a
+// phase.  Thread 0 walks the data of all the threads while the others
+// wait.
+static void
+record_memory_use(
+    uint32_t tid, SimThreadInfo_t& info, Core::ThreadSafe::Barrier& barrier, Core::MemoryAccounting::Phase phase)
+{
+    if ( !info.config->print_memory() ) return;
+    if ( tid == 0 ) Simulation_impl::recordMemoryUse(phase);
+    barrier.wait();
+}
+
 static void
 start_simulation(uint32_t tid, SimThreadInfo_t& info, Core::ThreadSafe::Barrier& barrier)
 {
+    // Pin the thread first, so everything it allocates is placed on
+    // its NUMA node
+    Core::ThreadAffinity::pinSimulationThread(tid);
+
     // Setup Mempools
     Core::MemPoolAccessor::initializeLocalData(tid);
+    Core::ThreadSafe::Barrier::setThreadIndex(tid);
     info.myRank.thread = tid;
     double start_build = sst_get_cpu_time();
 
@@ -388,7 +1217,12 @@ start_simulation(uint32_t tid, SimThreadInfo_t& info, Core::ThreadSafe::Barrier&
     do_graph_wireup(info.graph, sim, info.myRank, info.min_part);
     barrier.wait();
 
-    if ( tid == 0 ) { delete info.graph; }
+    if ( tid == 0 ) {
+        if ( info.config->print_memory() )
+            Simulation_impl::recordMemoryUse(Core::MemoryAccounting::CONSTRUCTION, info.graph);
+        delete info.graph;
+        if ( info.config->release_build_memory() ) release_free_memory();
+    }
 
     force_rank_sequential_stop(info.config->rank_seq_startup(), info.myRank, info.world_size);
 
@@ -432,6 +1266,15 @@ start_simulation(uint32_t tid, SimThreadInfo_t& info, Core::ThreadSafe::Barrier&
         // g_output.output("info.config.stopAtCycle = %s\n",info.config->stopAtCycle.c_str());
         sim->setStopAtCycle(info.config);
 
+        // Returns the time since the last call
+        double phase_start = sst_get_cpu_time();
+        auto   lap         = [&phase_start]() {
+            double now     = sst_get_cpu_time();
+            double elapsed = now - phase_start;
+            phase_start    = now;
+            return elapsed;
+        };
+
         if ( tid == 0 && info.world_size.rank > 1 ) {
             // If we are a MPI_parallel job, need to makes sure that all used
             // libraries are loaded on all ranks.
@@ -459,24 +1302,76 @@ start_simulation(uint32_t tid, SimThreadInfo_t& info, Core::ThreadSafe::Barrier&
 
             Comms::broadcast(lib_names, 0);
             Factory::getFactory()->loadUnloadedLibraries(lib_names);
+
+            // With the same libraries everywhere, every rank numbers
+            // the serializable classes the same way, and events sent
+            // between ranks can use the short numbers instead of the
+            // full class ids.  Only use them if all ranks agree.
+            using SST::Core::Serialization::serializable_factory;
+            uint64_t type_hash    = serializable_factory::build_dense_ids();
+            uint64_t type_in[2]   = { type_hash, ~type_hash };
+            uint64_t type_out[2]  = { 0, 0 };
+            MPI_Allreduce(type_in, type_out, 2, MPI_UINT64_T, MPI_MIN, MPI_COMM_WORLD);
+            if ( type_out[0] != type_hash || type_out[1] != ~type_hash ) {
+                if ( info.myRank.rank == 0 )
+                    g_output.verbose(
+                        CALL_INFO, 1, 0, "# Ranks have different serializable classes, using full class ids\n");
+                serializable_factory::clear_dense_ids();
+            }
 #endif
         }
         barrier.wait();
 
-        sim->initialize();
-        barrier.wait();
+        if ( info.config->load_checkpoint() == "" ) {
+            lap();
+            sim->initialize();
+            barrier.wait();
+            info.init_time        = lap();
+            info.init_round_times = sim->getInitRoundTimes();
 
-        /* Run Set */
-        sim->setup();
-        barrier.wait();
+            /* Run Set */
+            sim->setup();
+            barrier.wait();
+            info.setup_time = lap();
+            record_memory_use(tid, info, barrier, Core::MemoryAccounting::INIT);
+
+#ifdef USE_MEMPOOL
+            // Events that were only needed during init and setup have
+            // been deleted, so return the arenas they leave empty
+            if ( info.config->mempool_trim() ) {
+                if ( tid == 0 ) {
+                    int64_t arenas = 0, bytes = 0;
+                    Core::MemPoolAccessor::releaseFreeArenas(arenas, bytes);
+                    g_output.verbose(
+                        CALL_INFO, 1, 0, "# Released %" PRId64 " free mempool arenas (%" PRId64 " bytes)\n", arenas,
+                        bytes);
+                }
+                barrier.wait();
+            }
+#endif
+
+            // The runs of an ensemble share the init phase
+            if ( !ensemble_variants.empty() ) fork_ensemble_after_setup(*info.config, info.world_size);
+        }
+        else {
+            /* Restarting from a checkpoint, so the untimed phases have
+             * already been run and their effects are in the restored
+             * component state */
+            sim->prepareForRestart();
+            barrier.wait();
+        }
 
         /* Finalize all the stat outputs */
+        lap();
         do_statoutput_start_simulation(info.myRank);
         barrier.wait();
+        info.stat_output_time = lap();
 
         /* Run Simulation */
         sim->run();
         barrier.wait();
+        info.run_phase_time = lap();
+        record_memory_use(tid, info, barrier, Core::MemoryAccounting::RUN);
 
         /* Adjust clocks at simulation end to
          * reflect actual simulation end if that
@@ -485,15 +1380,20 @@ start_simulation(uint32_t tid, SimThreadInfo_t& info, Core::ThreadSafe::Barrier&
         sim->adjustTimeAtSimEnd();
         barrier.wait();
 
+        lap();
         sim->complete();
         barrier.wait();
+        info.complete_time = lap();
+        record_memory_use(tid, info, barrier, Core::MemoryAccounting::COMPLETE);
 
         sim->finish();
         barrier.wait();
+        info.finish_time = lap();
 
         /* Tell stat outputs simulation is done */
         do_statoutput_end_simulation(info.myRank);
         barrier.wait();
+        info.stat_output_time += lap();
     }
 
     barrier.wait();
@@ -551,20 +1451,227 @@ start_simulation(uint32_t tid, SimThreadInfo_t& info, Core::ThreadSafe::Barrier&
     // Put in info about sync memory usage
     info.sync_data_size = sim->getSyncQueueDataSize();
 
-    delete sim;
+    info.events_executed  = sim->getEventsExecuted();
+    info.run_loop_time    = sim->getRunLoopTime();
+    info.sync_time        = sim->getSyncTime();
+    info.run_barrier_time = sim->getRunBarrierTime();
+
+    if ( !skip_teardown(*info.config) ) {
+        double teardown_start = sst_get_cpu_time();
+        delete sim;
+        info.teardown_time = sst_get_cpu_time() - teardown_start;
+    }
 }
 
+// Print the run loop balance of every rank and thread.  Busy time is
+// the run loop time not spent in syncs, which is the time spent in
+// handlers and the core's event delivery.  Since every thread has to
+// get through its own busy time, the busiest thread is used as the
+// estimate of the critical path: the run loop time if the syncs cost
+// nothing.  Must be called on all ranks.
+static void
+print_imbalance_info(const std::vector<SimThreadInfo_t>& threadInfo, const RankInfo& myRank, const RankInfo& world_size)
+{
+    enum { BUSY = 0, SYNC, WAIT, LOOP, NUM_TIMES };
+
+    std::vector<uint64_t> local_events(world_size.thread);
+    std::vector<double>   local_times(world_size.thread * NUM_TIMES);
+    for ( uint32_t i = 0; i < world_size.thread; i++ ) {
+        local_events[i]                  = threadInfo[i].events_executed;
+        local_times[i * NUM_TIMES + BUSY] = threadInfo[i].run_loop_time - threadInfo[i].sync_time;
+        local_times[i * NUM_TIMES + SYNC] = threadInfo[i].sync_time;
+        local_times[i * NUM_TIMES + WAIT] = threadInfo[i].run_barrier_time;
+        local_times[i * NUM_TIMES + LOOP] = threadInfo[i].run_loop_time;
+    }
+
+#ifdef SST_CONFIG_HAVE_MPI
+    std::vector<uint64_t> events;
+    std::vector<double>   times;
+    if ( myRank.rank == 0 ) {
+        events.resize(local_events.size() * world_size.rank);
+        times.resize(local_times.size() * world_size.rank);
+    }
+    MPI_Gather(
+        local_events.data(), local_events.size(), MPI_UINT64_T, events.data(), local_events.size(), MPI_UINT64_T, 0,
+        MPI_COMM_WORLD);
+    MPI_Gather(
+        local_times.data(), local_times.size(), MPI_DOUBLE, times.data(), local_times.size(), MPI_DOUBLE, 0,
+        MPI_COMM_WORLD);
+#else
+    std::vector<uint64_t>& events = local_events;
+    std::vector<double>&   times  = local_times;
+#endif
+
+    if ( myRank.rank != 0 ) return;
+
+    size_t   num_partitions = events.size();
+    double   max_busy       = 0.0;
+    double   total_busy     = 0.0;
+    double   max_loop       = 0.0;
+    uint32_t busiest        = 0;
+    for ( size_t i = 0; i < num_partitions; i++ ) {
+        double busy = times[i * NUM_TIMES + BUSY];
+        total_busy += busy;
+        max_loop = std::max(max_loop, times[i * NUM_TIMES + LOOP]);
+        if ( busy > max_busy ) {
+            max_busy = busy;
+            busiest  = i;
+        }
+    }
+    double mean_busy = total_busy / num_partitions;
+
+    g_output.output("\n");
+    g_output.output("------------------------------------------------------------\n");
+    g_output.output("Simulation Imbalance Information (Wall Clock Times):\n");
+    g_output.output("  Rank Thread           Events     Busy (s)     Sync (s)   End wait (s)\n");
+    for ( size_t i = 0; i < num_partitions; i++ ) {
+        g_output.output(
+            "  %4zu %6zu %16" PRIu64 " %12.6f %12.6f %14.6f\n", i / world_size.thread, i % world_size.thread, events[i],
+            times[i * NUM_TIMES + BUSY], times[i * NUM_TIMES + SYNC], times[i * NUM_TIMES + WAIT]);
+    }
+
+    if ( world_size.rank > 1 && world_size.thread > 1 ) {
+        g_output.output("\n");
+        g_output.output("  Rank           Events Max busy (s)\n");
+        for ( uint32_t rank = 0; rank < world_size.rank; rank++ ) {
+            uint64_t rank_events = 0;
+            double   rank_busy   = 0.0;
+            for ( uint32_t thread = 0; thread < world_size.thread; thread++ ) {
+                size_t i = rank * world_size.thread + thread;
+                rank_events += events[i];
+                rank_busy = std::max(rank_busy, times[i * NUM_TIMES + BUSY]);
+            }
+            g_output.output("  %4" PRIu32 " %16" PRIu64 " %12.6f\n", rank, rank_events, rank_busy);
+        }
+    }
+
+    g_output.output("\n");
+    g_output.output(
+        "  Critical path estimate:          %f seconds (rank %" PRIu32 ", thread %" PRIu32 ")\n", max_busy,
+        busiest / world_size.thread, busiest % world_size.thread);
+    g_output.output("  Max run loop time:               %f seconds\n", max_loop);
+    g_output.output("  Mean busy time:                  %f seconds\n", mean_busy);
+    if ( mean_busy > 0.0 ) {
+        g_output.output("  Imbalance (max / mean busy):     %.3f\n", max_busy / mean_busy);
+    }
+    if ( max_loop > 0.0 ) {
+        g_output.output("  Parallel efficiency:             %.1f%%\n", 100.0 * mean_busy / max_loop);
+    }
+    g_output.output("------------------------------------------------------------\n");
+    g_output.output("\n");
+}
+
+// Write the wall clock time each rank spent in each phase of the run,
+// its peak RSS and the events it executed, to the --timing-info-json
+// file along with the min, max and average across ranks.  Must be
+// called on all ranks.
+static void
+write_timing_json(
+    const Config& cfg, const std::vector<std::pair<std::string, double>>& phases, uint64_t events,
+    const RankInfo& myRank, const RankInfo& world_size)
+{
+    // Every rank has the same phases, with the peak RSS and events at
+    // the end
+    std::vector<double> local_values;
+    for ( auto& phase : phases )
+        local_values.push_back(phase.second);
+    local_values.push_back(static_cast<double>(localMemSize()));
+    local_values.push_back(static_cast<double>(events));
+
+#ifdef SST_CONFIG_HAVE_MPI
+    std::vector<double> values;
+    if ( myRank.rank == 0 ) values.resize(local_values.size() * world_size.rank);
+    MPI_Gather(
+        local_values.data(), local_values.size(), MPI_DOUBLE, values.data(), local_values.size(), MPI_DOUBLE, 0,
+        MPI_COMM_WORLD);
+#else
+    std::vector<double>& values = local_values;
+#endif
+
+    if ( myRank.rank != 0 ) return;
+
+    const size_t num_values = local_values.size();
+    auto         summarize  = [&](size_t index) {
+        std::vector<double> ranks(world_size.rank);
+        for ( uint32_t i = 0; i < world_size.rank; i++ )
+            ranks[i] = values[i * num_values + index];
+
+        nlohmann::json entry;
+        entry["min"]   = *std::min_element(ranks.begin(), ranks.end());
+        entry["max"]   = *std::max_element(ranks.begin(), ranks.end());
+        entry["avg"]   = std::accumulate(ranks.begin(), ranks.end(), 0.0) / world_size.rank;
+        entry["ranks"] = ranks;
+        return entry;
+    };
+
+    nlohmann::json report;
+    report["ranks"]   = world_size.rank;
+    report["threads"] = world_size.thread;
+    report["phases"]  = nlohmann::json::array();
+    for ( size_t i = 0; i < phases.size(); i++ ) {
+        nlohmann::json entry = summarize(i);
+        entry["name"]        = phases[i].first;
+        report["phases"].push_back(entry);
+    }
+    report["max_rss_kb"] = summarize(phases.size());
+    report["events"]     = summarize(phases.size() + 1);
+
+    uint64_t total_events = 0;
+    for ( uint32_t i = 0; i < world_size.rank; i++ )
+        total_events += static_cast<uint64_t>(values[i * num_values + num_values - 1]);
+    report["events"]["total"] = total_events;
+
+    std::ofstream file(cfg.timing_json());
+    if ( !file.is_open() ) {
+        g_output.fatal(CALL_INFO, 1, "ERROR: Unable to open timing info file %s\n", cfg.timing_json().c_str());
+    }
+    file << std::setw(2) << report << std::endl;
+}
+
+#ifdef SST_CONFIG_HAVE_MPI
+// Returns true if --rank-sync=overlap is on the command line.  MPI has
+// to be initialized before the command line is parsed, so this only
+// looks for the option itself.
+static bool
+rank_sync_overlap_requested(int argc, char* argv[])
+{
+    for ( int i = 1; i < argc; ++i ) {
+        if ( !strcmp(argv[i], "--rank-sync=overlap") ) return true;
+        if ( !strcmp(argv[i], "--rank-sync") && i + 1 < argc && !strcmp(argv[i + 1], "overlap") ) return true;
+    }
+    return false;
+}
+#endif
+
 int
 main(int argc, char* argv[])
 {
 #ifdef SST_CONFIG_HAVE_MPI
-    MPI_Init(&argc, &argv);
+    // The overlapping rank sync calls MPI from its own thread, so it
+    // needs MPI_THREAD_MULTIPLE.  Everything else only calls MPI from
+    // one thread at a time and keeps the default level.
+    bool overlap      = rank_sync_overlap_requested(argc, argv);
+    int  thread_level = MPI_THREAD_SINGLE;
+    if ( overlap ) { MPI_Init_thread(&argc, &argv, MPI_THREAD_MULTIPLE, &thread_level); }
+    else {
+        MPI_Init(&argc, &argv);
+    }
 
     int myrank = 0;
     int mysize = 0;
     MPI_Comm_rank(MPI_COMM_WORLD, &myrank);
     MPI_Comm_size(MPI_COMM_WORLD, &mysize);
 
+    if ( overlap && thread_level < MPI_THREAD_MULTIPLE ) {
+        if ( myrank == 0 ) {
+            fprintf(
+                stderr, "ERROR: --rank-sync=overlap needs MPI_THREAD_MULTIPLE, but the MPI library only provides a "
+                        "lower thread level\n");
+        }
+        MPI_Finalize();
+        return -1;
+    }
+
     RankInfo world_size(mysize, 1);
     RankInfo myRank(myrank, 0);
 #else
@@ -587,6 +1694,7 @@ main(int argc, char* argv[])
 
     // Set the debug output location
     Output::setFileName(cfg.debugFile() != "/dev/null" ? cfg.debugFile() : "sst_output");
+    Output::setDeferredFileOutput(cfg.deferred_file_output());
 
 
     if ( cfg.parallel_load() && cfg.parallel_load_mode_multi() && world_size.rank != 1 ) {
@@ -617,6 +1725,19 @@ main(int argc, char* argv[])
     // Get the memory before we create the graph
     const uint64_t pre_graph_create_rss = maxGlobalMemSize();
 
+    // Ranks that build the graph.  With --parallel-load=NODE, only the
+    // lowest rank on each node does, and the other ranks on the node
+    // get their parts from it.
+    int node_rank = 0;
+#ifdef SST_CONFIG_HAVE_MPI
+    MPI_Comm node_comm = MPI_COMM_NULL;
+    if ( cfg.parallel_load_mode_node() ) {
+        MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, myRank.rank, MPI_INFO_NULL, &node_comm);
+        MPI_Comm_rank(node_comm, &node_rank);
+    }
+#endif
+    const bool build_graph = myRank.rank == 0 || (cfg.parallel_load() && node_rank == 0);
+
     force_rank_sequential_start(cfg.rank_seq_startup(), myRank, world_size);
 
     double start = sst_get_cpu_time();
@@ -641,7 +1762,7 @@ main(int argc, char* argv[])
             return -1;
         }
 
-        if ( myRank.rank == 0 || cfg.parallel_load() ) {
+        if ( build_graph ) {
             modelGen = factory->Create<SSTModelDescription>(model_name, cfg.configFile(), cfg.verbose(), &cfg, start);
         }
     }
@@ -655,7 +1776,8 @@ main(int argc, char* argv[])
 
     // Only rank 0 will populate the graph, unless we are using
     // parallel load.  In this case, all ranks will load the graph
-    if ( myRank.rank == 0 || cfg.parallel_load() ) {
+    // (or one rank per node with NODE)
+    if ( build_graph ) {
         try {
             graph = modelGen->createConfigGraph();
         }
@@ -676,6 +1798,16 @@ main(int argc, char* argv[])
             g_output.fatal(CALL_INFO, -1, "Error encountered broadcasting configuration object: %s\n", e.what());
         }
     }
+    else if ( node_comm != MPI_COMM_NULL ) {
+        // The model may have set options, so the rest of the node needs
+        // the configuration from the rank that ran it
+        try {
+            Comms::broadcast(cfg, 0, node_comm);
+        }
+        catch ( std::exception& e ) {
+            g_output.fatal(CALL_INFO, -1, "Error encountered broadcasting configuration object: %s\n", e.what());
+        }
+    }
 #endif
 
     world_size.thread = cfg.num_threads();
@@ -697,11 +1829,11 @@ main(int argc, char* argv[])
     // Need to initialize TimeLord
     Simulation_impl::getTimeLord()->init(cfg.timeBase());
 
-    if ( myRank.rank == 0 || cfg.parallel_load() ) {
+    if ( build_graph ) {
         graph->postCreationCleanup();
 
         // Check config graph to see if there are structural errors.
-        if ( graph->checkForStructuralErrors() ) {
+        if ( graph->checkForStructuralErrors(world_size.thread) ) {
             g_output.fatal(CALL_INFO, 1, "Structure errors found in the ConfigGraph.\n");
         }
     }
@@ -714,7 +1846,9 @@ main(int argc, char* argv[])
     // ranks already have their parts of the graph.
     uint64_t comp_count = 0;
     if ( cfg.verbose() >= 1 ) {
-        if ( !cfg.parallel_load() && myRank.rank == 0 ) { comp_count = graph->getNumComponents(); }
+        if ( (!cfg.parallel_load() || cfg.parallel_load_mode_replicate()) && myRank.rank == 0 ) {
+            comp_count = graph->getNumComponents();
+        }
 #ifdef SST_CONFIG_HAVE_MPI
         else if ( cfg.parallel_load() ) {
             uint64_t my_count = graph->getNumComponentsInMPIRank(myRank.rank);
@@ -748,43 +1882,77 @@ main(int argc, char* argv[])
     ////// Start Partitioning //////
     double start_part = sst_get_cpu_time();
 
-    if ( !cfg.parallel_load() ) {
-        // Normal partitioning
+    // Placement of the threads is needed by the partitioner
+    Core::ThreadAffinity::init(cfg.thread_affinity(), world_size.thread, g_output);
+
+    if ( !cfg.parallel_load() || cfg.parallel_load_mode_replicate() ) {
+        // Normal partitioning.  If the graph was replicated, every
+        // rank (or node) has the full graph and does the same
+        // partitioning.
+        bool have_graph = build_graph;
 
         // If this is a serial job, just use the single partitioner,
         // but the same code path
         if ( world_size.rank == 1 && world_size.thread == 1 ) cfg.partitioner_ = "sst.single";
+        else if ( have_graph ) {
+            load_partition_weights(cfg, graph);
+        }
 
         // Get the partitioner.  Built in partitioners are in the "sst" library.
         SSTPartitioner* partitioner = factory->CreatePartitioner(cfg.partitioner(), world_size, myRank, cfg.verbose());
 
-        try {
-            if ( partitioner->requiresConfigGraph() ) { partitioner->performPartition(graph); }
-            else {
-                PartitionGraph* pgraph;
-                if ( myRank.rank == 0 ) { pgraph = graph->getCollapsedPartitionGraph(); }
+        std::vector<uint32_t> thread_socket;
+        for ( uint32_t i = 0; i < world_size.thread; i++ )
+            thread_socket.push_back(Core::ThreadAffinity::threadSocket(i));
+        partitioner->setMachineLayout(getRankNodes(world_size), thread_socket);
+
+        if ( cfg.parallel_load() && partitioner->spawnOnAllRanks() ) {
+            g_output.fatal(
+                CALL_INFO, 1, "Partitioner %s cannot be used with --parallel-load=%s\n", cfg.partitioner().c_str(),
+                cfg.parallel_load_str().c_str());
+        }
+
+        bool     cached    = false;
+        uint64_t cache_key = 0;
+        // Partitioners that run on every rank can't be skipped by just
+        // the ranks that have the graph
+        bool use_cache = have_graph && cfg.partition_cache() != "" && !partitioner->spawnOnAllRanks();
+        if ( use_cache ) {
+            cache_key = partition_cache_key(cfg, graph, world_size);
+            cached    = load_partition_cache(cfg, graph, cache_key);
+        }
+
+        if ( !cached ) {
+            try {
+                if ( partitioner->requiresConfigGraph() ) { partitioner->performPartition(graph); }
                 else {
-                    pgraph = new PartitionGraph();
-                }
+                    PartitionGraph* pgraph;
+                    if ( have_graph ) { pgraph = graph->getCollapsedPartitionGraph(); }
+                    else {
+                        pgraph = new PartitionGraph();
+                    }
 
-                if ( myRank.rank == 0 || partitioner->spawnOnAllRanks() ) {
-                    partitioner->performPartition(pgraph);
+                    if ( have_graph || partitioner->spawnOnAllRanks() ) {
+                        partitioner->performPartition(pgraph);
 
-                    if ( myRank.rank == 0 ) graph->annotateRanks(pgraph);
-                }
+                        if ( have_graph ) graph->annotateRanks(pgraph);
+                    }
 
-                delete pgraph;
+                    delete pgraph;
+                }
             }
-        }
-        catch ( std::exception& e ) {
-            g_output.fatal(CALL_INFO, -1, "Error encountered during graph partitioning phase: %s\n", e.what());
+            catch ( std::exception& e ) {
+                g_output.fatal(CALL_INFO, -1, "Error encountered during graph partitioning phase: %s\n", e.what());
+            }
+
+            if ( use_cache && myRank.rank == 0 ) save_partition_cache(cfg, graph, cache_key);
         }
 
         delete partitioner;
     }
 
     // Check the partitioning to make sure it is sane
-    if ( myRank.rank == 0 || cfg.parallel_load() ) {
+    if ( build_graph ) {
         if ( !graph->checkRanks(world_size) ) {
             g_output.fatal(CALL_INFO, 1, "ERROR: Bad partitioning; partition included unknown ranks.\n");
         }
@@ -793,7 +1961,7 @@ main(int argc, char* argv[])
     const uint64_t post_graph_create_rss = maxGlobalMemSize();
 
     if ( myRank.rank == 0 ) {
-        if ( !cfg.parallel_load() )
+        if ( !cfg.parallel_load() || cfg.parallel_load_mode_replicate() )
             g_output.verbose(CALL_INFO, 1, 0, "# Graph partitioning took %lg seconds.\n", (end_part - start_part));
         g_output.verbose(
             CALL_INFO, 1, 0, "# Graph construction and partition raised RSS by %" PRIu64 " KB\n",
@@ -802,6 +1970,23 @@ main(int argc, char* argv[])
 
         // Output the partition information if user requests it
         dump_partition(cfg, graph, world_size);
+
+        if ( cfg.partition_report() || cfg.partition_only() ) {
+            if ( !cfg.parallel_load() || cfg.parallel_load_mode_replicate() )
+                print_partition_report(cfg, graph, world_size);
+            else
+                g_output.output("WARNING: --partition-report needs the whole graph on one rank, no report printed\n");
+        }
+    }
+
+    // Dry run: stop once the partition is known
+    if ( cfg.partition_only() ) {
+        delete graph;
+        Output::setDeferredFileOutput(false);
+#ifdef SST_CONFIG_HAVE_MPI
+        MPI_Finalize();
+#endif
+        return 0;
     }
 
     ////// End Partitioning //////
@@ -811,7 +1996,7 @@ main(int argc, char* argv[])
     SimTime_t min_part       = 0xffffffffffffffffl;
     if ( world_size.rank > 1 ) {
         // Check the graph for the minimum latency crossing a partition boundary
-        if ( myRank.rank == 0 || cfg.parallel_load() ) {
+        if ( build_graph ) {
             ConfigComponentMap_t& comps = graph->getComponentMap();
             ConfigLinkMap_t&      links = graph->getLinkMap();
             // Find the minimum latency across a partition
@@ -851,6 +2036,8 @@ main(int argc, char* argv[])
         g_output.verbose(CALL_INFO, 1, 0, "Signal handlers are disabled by user input\n");
     }
 
+    double start_broadcast = sst_get_cpu_time();
+
     ////// Write out the graph, if requested //////
     if ( myRank.rank == 0 ) {
         doSerialOnlyGraphOutput(&cfg, graph);
@@ -868,72 +2055,119 @@ main(int argc, char* argv[])
             Comms::broadcast(Params::global_params, 0);
 
             std::set<uint32_t> my_ranks;
-            std::set<uint32_t> your_ranks;
 
             if ( 0 == myRank.rank ) {
-                // Split the rank space in half
-                for ( uint32_t i = 0; i < world_size.rank / 2; i++ ) {
+                for ( uint32_t i = 0; i < world_size.rank; i++ ) {
                     my_ranks.insert(i);
                 }
-
-                for ( uint32_t i = world_size.rank / 2; i < world_size.rank; i++ ) {
-                    your_ranks.insert(i);
-                }
-
-                // Need to send the your_ranks set and the proper
-                // subgraph for further distribution
-                // ConfigGraph* your_graph = graph->getSubGraph(your_ranks);
-                ConfigGraph* your_graph = graph->splitGraph(my_ranks, your_ranks);
-                int          dest       = *your_ranks.begin();
-                Comms::send(dest, 0, your_ranks);
-                Comms::send(dest, 0, *your_graph);
-                your_ranks.clear();
-                delete your_graph;
             }
             else {
                 Comms::recv(MPI_ANY_SOURCE, 0, my_ranks);
-                Comms::recv(MPI_ANY_SOURCE, 0, *graph);
+                recv_graph(MPI_ANY_SOURCE, 0, *graph);
             }
 
             while ( my_ranks.size() != 1 ) {
-                // This means I have more data to pass on to other ranks
-                std::set<uint32_t>::iterator mid = my_ranks.begin();
-                for ( unsigned int i = 0; i < my_ranks.size() / 2; i++ ) {
-                    ++mid;
+                // This means I have more data to pass on to other
+                // ranks.  Split the ranks into contiguous groups and
+                // the graph along with them in one pass, keep the
+                // first group and send each of the others to its
+                // lowest rank for further distribution.
+                size_t                          num_groups = std::min<size_t>(graph_split_fanout, my_ranks.size());
+                std::vector<std::set<uint32_t>> groups(num_groups);
+                size_t                          index = 0;
+                for ( uint32_t rank : my_ranks ) {
+                    groups[index * num_groups / my_ranks.size()].insert(rank);
+                    index++;
                 }
 
-                your_ranks.insert(mid, my_ranks.end());
-                my_ranks.erase(mid, my_ranks.end());
-
-                // // ConfigGraph* your_graph = graph->getSubGraph(your_ranks);
-                ConfigGraph* your_graph = graph->splitGraph(my_ranks, your_ranks);
-
-                uint32_t dest = *your_ranks.begin();
-
-                Comms::send(dest, 0, your_ranks);
-                Comms::send(dest, 0, *your_graph);
-                your_ranks.clear();
-                delete your_graph;
+                std::vector<ConfigGraph*> your_graphs = graph->splitGraph(groups);
+                for ( size_t i = 1; i < num_groups; i++ ) {
+                    uint32_t dest = *groups[i].begin();
+                    Comms::send(dest, 0, groups[i]);
+                    send_graph(dest, 0, *your_graphs[i - 1]);
+                    delete your_graphs[i - 1];
+                }
+                my_ranks.swap(groups[0]);
             }
         }
         catch ( std::exception& e ) {
             g_output.fatal(CALL_INFO, -1, "Error encountered during graph broadcast: %s\n", e.what());
         }
     }
+    else if ( world_size.rank > 1 && cfg.parallel_load_mode_node() ) {
+        try {
+            // Only node rank 0 has the parameter tables
+            Comms::broadcast(Params::keyMap, 0, node_comm);
+            Comms::broadcast(Params::keyMapReverse, 0, node_comm);
+            Comms::broadcast(Params::nextKeyID, 0, node_comm);
+            Comms::broadcast(Params::global_params, 0, node_comm);
+
+            share_node_graph(node_comm, myRank, graph);
+        }
+        catch ( std::exception& e ) {
+            g_output.fatal(CALL_INFO, -1, "Error encountered during graph sharing: %s\n", e.what());
+        }
+    }
+    else if ( world_size.rank > 1 && cfg.parallel_load_mode_replicate() ) {
+        // Every rank has the full graph, so just drop the parts that
+        // belong to other ranks.  Components on the other end of
+        // links leaving this rank are kept as ghosts.
+        std::set<uint32_t> my_ranks;
+        my_ranks.insert(myRank.rank);
+        delete graph->splitGraph(my_ranks, std::set<uint32_t>());
+    }
+    if ( node_comm != MPI_COMM_NULL ) MPI_Comm_free(&node_comm);
 #endif
 
     ////// End Broadcast Graph //////
+    prefetch_graph_libraries(graph);
+
     if ( cfg.parallel_output() ) { doParallelCapableGraphOutput(&cfg, graph, myRank, world_size); }
 
+    double end_broadcast = sst_get_cpu_time();
+
+    ////// Run an Ensemble //////
+    // Everything up to here is shared by the variants.  The parent
+    // only waits for them, and each child runs one like a normal run.
+    if ( !graph->getEnsembleVariants().empty() ) {
+        if ( world_size.rank > 1 ) {
+            g_output.fatal(CALL_INFO, 1, "ERROR: Ensembles of variants can only be run on a single rank\n");
+        }
+
+        if ( cfg.ensemble_fork() == "setup" ) {
+            // Forking only copies the calling thread
+            if ( world_size.thread > 1 ) {
+                g_output.fatal(
+                    CALL_INFO, 1, "ERROR: Ensembles forked after setup can only be run with a single thread\n");
+            }
+            ensemble_variants = graph->getEnsembleVariants();
+        }
+        else {
+            int status  = 0;
+            int variant = run_ensemble(cfg, graph->getEnsembleVariants().size(), world_size, status);
+            if ( variant < 0 ) {
+                delete graph;
+#ifdef SST_CONFIG_HAVE_MPI
+                MPI_Finalize();
+#endif
+                return status;
+            }
+            start_ensemble_variant(graph, variant);
+        }
+    }
+
 
     ////// Create Simulation //////
+    Core::ThreadSafe::Barrier::setTreeBarriers(cfg.thread_barrier() == "tree");
     Core::ThreadSafe::Barrier mainBarrier(world_size.thread);
 
     Simulation_impl::factory    = factory;
     Simulation_impl::sim_output = g_output;
     Simulation_impl::resizeBarriers(world_size.thread);
 #ifdef USE_MEMPOOL
-    MemPoolAccessor::initializeGlobalData(world_size.thread, cfg.cache_align_mempools());
+    MemPoolAccessor::initializeGlobalData(
+        world_size.thread, cfg.cache_align_mempools(), cfg.mempool_thread_return(), cfg.mempool_huge_pages(),
+        cfg.mempool_numa_local());
 #endif
 
     std::vector<std::thread>     threads(world_size.thread);
@@ -948,6 +2182,9 @@ main(int argc, char* argv[])
     }
 
     double end_serial_build = sst_get_cpu_time();
+    double shutdown_time    = 0.0;
+
+    if ( cfg.print_memory() ) Simulation_impl::recordMemoryUse(Core::MemoryAccounting::GRAPH_BUILD, graph);
 
     try {
         Output::setThreadID(std::this_thread::get_id(), 0);
@@ -961,7 +2198,9 @@ main(int argc, char* argv[])
             threads[i].join();
         }
 
+        double start_shutdown = sst_get_cpu_time();
         Simulation_impl::shutdown();
+        shutdown_time = sst_get_cpu_time() - start_shutdown;
     }
     catch ( std::exception& e ) {
         g_output.fatal(CALL_INFO, -1, "Error encountered during simulation: %s\n", e.what());
@@ -969,6 +2208,44 @@ main(int argc, char* argv[])
 
     double total_end_time = sst_get_cpu_time();
 
+    if ( cfg.print_imbalance() ) print_imbalance_info(threadInfo, myRank, world_size);
+    if ( cfg.print_memory() ) Core::MemoryAccounting::print(g_output);
+
+    if ( cfg.timing_json() != "" ) {
+        // Per thread phases use the slowest thread of the rank
+        auto slowest = [&](double SimThreadInfo_t::*field) {
+            double max = 0.0;
+            for ( auto& info : threadInfo )
+                max = std::max(max, info.*field);
+            return max;
+        };
+
+        std::vector<std::pair<std::string, double>> phases;
+        phases.emplace_back("model", end_graph_gen - start);
+        phases.emplace_back("partition", end_part - start_part);
+        phases.emplace_back("graph_broadcast", end_broadcast - start_broadcast);
+        phases.emplace_back(
+            "construction", (end_serial_build - end_broadcast) + slowest(&SimThreadInfo_t::build_time));
+        phases.emplace_back("init", slowest(&SimThreadInfo_t::init_time));
+        for ( size_t i = 0; i < threadInfo[0].init_round_times.size(); i++ ) {
+            double round = 0.0;
+            for ( auto& info : threadInfo )
+                round = std::max(round, info.init_round_times[i]);
+            phases.emplace_back("init_round_" + std::to_string(i), round);
+        }
+        phases.emplace_back("setup", slowest(&SimThreadInfo_t::setup_time));
+        phases.emplace_back("run", slowest(&SimThreadInfo_t::run_phase_time));
+        phases.emplace_back("complete", slowest(&SimThreadInfo_t::complete_time));
+        phases.emplace_back("finish", slowest(&SimThreadInfo_t::finish_time));
+        phases.emplace_back("stat_output", slowest(&SimThreadInfo_t::stat_output_time));
+        phases.emplace_back("teardown", slowest(&SimThreadInfo_t::teardown_time) + shutdown_time);
+        phases.emplace_back("total", total_end_time - start);
+        uint64_t events = 0;
+        for ( auto& info : threadInfo )
+            events += info.events_executed;
+        write_timing_json(cfg, phases, events, myRank, world_size);
+    }
+
     for ( uint32_t i = 1; i < world_size.thread; i++ ) {
         threadInfo[0].simulated_time = std::max(threadInfo[0].simulated_time, threadInfo[i].simulated_time);
         threadInfo[0].run_time       = std::max(threadInfo[0].run_time, threadInfo[i].run_time);
@@ -1022,6 +2299,24 @@ main(int argc, char* argv[])
     global_active_activities  = active_activities;
 #endif
 
+#ifdef USE_MEMPOOL
+    int64_t huge_page_bytes = 0, global_huge_page_bytes = 0;
+    int64_t remote_arenas = 0, global_remote_arenas = 0;
+    Core::MemPoolAccessor::getArenaPlacement(huge_page_bytes, remote_arenas);
+
+    int64_t released_arenas = 0, released_bytes = 0, global_released_bytes = 0;
+    Core::MemPoolAccessor::getReleasedArenas(released_arenas, released_bytes);
+#ifdef SST_CONFIG_HAVE_MPI
+    MPI_Allreduce(&huge_page_bytes, &global_huge_page_bytes, 1, MPI_INT64_T, MPI_SUM, MPI_COMM_WORLD);
+    MPI_Allreduce(&remote_arenas, &global_remote_arenas, 1, MPI_INT64_T, MPI_SUM, MPI_COMM_WORLD);
+    MPI_Allreduce(&released_bytes, &global_released_bytes, 1, MPI_INT64_T, MPI_SUM, MPI_COMM_WORLD);
+#else
+    global_huge_page_bytes = huge_page_bytes;
+    global_remote_arenas   = remote_arenas;
+    global_released_bytes  = released_bytes;
+#endif
+#endif
+
     const uint64_t local_max_rss     = maxLocalMemSize();
     const uint64_t global_max_rss    = maxGlobalMemSize();
     const uint64_t local_max_pf      = maxLocalPageFaults();
@@ -1069,6 +2364,21 @@ main(int argc, char* argv[])
         g_output.output("  Max Input Blocks:                %" PRIu64 " blocks\n", global_max_io_in);
         g_output.output("  Max mempool usage:               %s\n", max_mempool_size_ua.toStringBestSI().c_str());
         g_output.output("  Global mempool usage:            %s\n", global_mempool_size_ua.toStringBestSI().c_str());
+#ifdef USE_MEMPOOL
+        if ( cfg.mempool_huge_pages() || cfg.mempool_numa_local() ) {
+            ua_buffer = format_string("%" PRId64 "B", global_huge_page_bytes);
+            UnitAlgebra global_huge_page_bytes_ua(ua_buffer);
+            g_output.output(
+                "  Global mempool huge page usage:  %s\n", global_huge_page_bytes_ua.toStringBestSI().c_str());
+            g_output.output("  Global mempool remote arenas:    %" PRId64 " arenas\n", global_remote_arenas);
+        }
+        if ( cfg.mempool_trim() ) {
+            ua_buffer = format_string("%" PRId64 "B", global_released_bytes);
+            UnitAlgebra global_released_bytes_ua(ua_buffer);
+            g_output.output(
+                "  Global mempool released:         %s\n", global_released_bytes_ua.toStringBestSI().c_str());
+        }
+#endif
         g_output.output("  Global active activities:        %" PRIu64 " activities\n", global_active_activities);
         g_output.output("  Current global TimeVortex depth: %" PRIu64 " entries\n", global_current_tv_depth);
         g_output.output("  Max TimeVortex depth:            %" PRIu64 " entries\n", global_max_tv_depth);
@@ -1091,6 +2401,17 @@ main(int argc, char* argv[])
 #endif
 
 #ifdef USE_MEMPOOL
+    if ( cfg.print_mempool_stats() ) {
+        // All threads have finished, so it is safe to walk the arenas
+        if ( world_size.rank > 1 ) {
+            g_output.output("\nMempool stats for rank %d at end of simulation:\n", myRank.rank);
+        }
+        else {
+            g_output.output("\nMempool stats at end of simulation:\n");
+        }
+        MemPoolAccessor::printMemPoolStats("  ", g_output, true);
+    }
+
     if ( cfg.event_dump_file() != "" ) {
         bool   print_header = false;
         Output out("", 0, 0, Output::FILE, cfg.event_dump_file());
@@ -1115,9 +2436,21 @@ main(int argc, char* argv[])
     }
 #endif
 
+    // Write out any deferred output before the files are closed
+    Output::setDeferredFileOutput(false);
+
 #ifdef SST_CONFIG_HAVE_MPI
     MPI_Finalize();
 #endif
 
+    if ( skip_teardown(cfg) ) {
+        // Skip the destructors of the global objects as well, but make
+        // sure everything written so far gets out
+        std::cout.flush();
+        std::cerr.flush();
+        fflush(nullptr);
+        _exit(0);
+    }
+
     return 0;
 }
@@ -17,12 +17,21 @@
 #include "sst/core/output.h"
 #include "sst/core/threadsafe.h"
 
+#include <algorithm>
+#include <atomic>
 #include <list>
+#include <map>
+#include <set>
 #include <sstream>
 #include <sys/mman.h>
 #include <sys/time.h>
 #include <vector>
 
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 namespace SST {
 namespace Core {
 
@@ -88,17 +97,125 @@ public:
         }
         return found;
     }
+
+    /** Drops the items that pred returns true for from all the lists.
+     * Only safe to call when no thread is allocating. */
+    template <typename Pred>
+    void removeIf(Pred pred)
+    {
+        std::lock_guard<ThreadSafe::Spinlock> slock(lock);
+        for ( auto& x : store ) {
+            for ( auto& list : x.lists ) {
+                list.erase(std::remove_if(list.begin(), list.end(), pred), list.end());
+            }
+            x.lists.erase(
+                std::remove_if(
+                    x.lists.begin(), x.lists.end(), [](const std::vector<void*>& list) { return list.empty(); }),
+                x.lists.end());
+        }
+    }
+};
+
+/**
+   Address ranges of arenas that are being released, sorted by start
+   address
+ */
+class ArenaRanges
+{
+    std::vector<std::pair<uint8_t*, uint8_t*>> ranges;
+
+public:
+    void add(uint8_t* start, size_t size) { ranges.emplace_back(start, start + size); }
+    void sort() { std::sort(ranges.begin(), ranges.end()); }
+    bool empty() const { return ranges.empty(); }
+
+    const std::vector<std::pair<uint8_t*, uint8_t*>>& get() const { return ranges; }
+
+    /** Whether ptr is in one of the ranges.  Only valid after sort() */
+    bool contains(void* ptr) const
+    {
+        uint8_t* p  = static_cast<uint8_t*>(ptr);
+        auto     it = std::upper_bound(
+            ranges.begin(), ranges.end(), p,
+            [](uint8_t* value, const std::pair<uint8_t*, uint8_t*>& range) { return value < range.first; });
+        if ( it == ranges.begin() ) return false;
+        --it;
+        return p < it->second;
+    }
 };
 
 
 // Controls whether or not the mempools cache align their entries
 static bool memPoolCacheAlign = false;
 
+// Controls whether items freed on a thread other than the one that
+// allocated them are sent back to the allocating thread's pool
+static bool memPoolThreadReturn = false;
+
+// Controls whether arenas are backed by huge pages
+static bool memPoolHugePages = false;
+
+// Controls whether arenas are placed on the NUMA node of the thread
+// that allocates them
+static bool memPoolNumaLocal = false;
+
+
+///////////////////////////////////////////////////////////////////////
+// NUMA placement helpers.  These use the raw system calls so that
+// libnuma isn't needed.  On other platforms they do nothing.
+///////////////////////////////////////////////////////////////////////
+
+#if defined(__linux__) && defined(SYS_getcpu) && defined(SYS_mbind) && defined(SYS_get_mempolicy)
+#define SST_MEMPOOL_HAVE_NUMA 1
+
+// Values from linux/mempolicy.h
+#define SST_MPOL_PREFERRED 1
+#define SST_MPOL_F_NODE    (1 << 0)
+#define SST_MPOL_F_ADDR    (1 << 1)
+
+// Largest node number that can be put in the node mask
+#define SST_MEMPOOL_MAX_NODES 1024
+
+/** Returns the NUMA node the calling thread is running on, or -1 */
+static int
+currentNumaNode()
+{
+    unsigned cpu  = 0;
+    unsigned node = 0;
+    if ( 0 != syscall(SYS_getcpu, &cpu, &node, nullptr) ) return -1;
+    return (int)node;
+}
+
+/** Sets the preferred node for a range of memory.  Must be called
+ * before the memory is first touched. */
+static void
+preferNumaNode(void* addr, size_t len, int node)
+{
+    if ( node < 0 || node >= SST_MEMPOOL_MAX_NODES ) return;
+    const size_t  bits_per_word = sizeof(unsigned long) * 8;
+    unsigned long mask[SST_MEMPOOL_MAX_NODES / (sizeof(unsigned long) * 8)] = {};
+    mask[node / bits_per_word] |= 1UL << (node % bits_per_word);
+    syscall(SYS_mbind, addr, len, SST_MPOL_PREFERRED, mask, SST_MEMPOOL_MAX_NODES, 0);
+}
+
+/** Returns the NUMA node backing the page at addr, or -1 */
+static int
+pageNumaNode(void* addr)
+{
+    int node = -1;
+    if ( 0 != syscall(SYS_get_mempolicy, &node, nullptr, 0, addr, SST_MPOL_F_NODE | SST_MPOL_F_ADDR) ) return -1;
+    return node;
+}
+#endif
+
 
 /**
  * Simple Memory Pool class.  The class instance is only ever accessed
  * by a single thread.  Only have to mutex when putting things in the
- * overflow store.
+ * overflow store.  The one exception is the remote free list, which
+ * other threads push items onto when mempool thread return is
+ * enabled.  It is a lock free stack that the owning thread empties in
+ * one exchange, so it can't suffer from the ABA problem.
  */
 class MemPoolNoMutex
 {
@@ -110,11 +227,18 @@ class MemPoolNoMutex
 public:
     /** Create a new Memory Pool.
      * @param elementSize - Size of each Element
+     * @param owner - Thread that owns this pool
      * @param initialSize - Size of the memory pool (in bytes)
      */
-    MemPoolNoMutex(size_t elementSize, size_t initialSize = (2 << 20)) :
+    MemPoolNoMutex(size_t elementSize, int owner, size_t initialSize = (2 << 20)) :
         numAlloc(0),
         numFree(0),
+        hugePageBytes(0),
+        remoteArenas(0),
+        releasedArenas(0),
+        reportedAlloc(0),
+        owner_thread(owner),
+        remote_head(nullptr),
         elemSize(elementSize),
         arenaSize(initialSize),
         max_freelist_size(0)
@@ -136,8 +260,9 @@ public:
 
     ~MemPoolNoMutex()
     {
+        // Arenas are mapped, not malloced
         for ( std::list<uint8_t*>::iterator i = arenas.begin(); i != arenas.end(); ++i ) {
-            ::free(*i);
+            munmap(*i, arenaSize);
         }
     }
 
@@ -159,6 +284,13 @@ public:
             return ret;
         }
 
+        // Take back anything other threads have freed
+        if ( drainRemote() ) {
+            void* ret = freelist.back();
+            freelist.pop_back();
+            return ret;
+        }
+
         // Check overflow.
         if ( !overflow.empty() ) {
             void* ret = overflow.back();
@@ -186,17 +318,26 @@ public:
     inline void free(void* ptr)
     {
         numFree++;
-        // Goes in freelist if we aren't at max capacity.  Otherwise
-        // goes in overflow.
-        if ( freelist.size() >= max_freelist_size ) {
-            overflow.push_back(ptr);
-            if ( overflow.size() == max_overflow_size ) { shared_overflow.insert(elemSize, overflow); }
-        }
-        else {
-            freelist.push_back(ptr);
-        }
+        insertFree(ptr);
+    }
+
+    /** Return an element allocated from this pool while running on a
+     * different thread.  The element is linked through its second
+     * word, since the first holds the pool header.  The caller counts
+     * the free in its own pool so the counters stay thread local.
+     */
+    inline void remoteFree(void* ptr)
+    {
+        void** link = reinterpret_cast<void**>(ptr) + 1;
+        void*  head = remote_head.load(std::memory_order_relaxed);
+        do {
+            *link = head;
+        } while ( !remote_head.compare_exchange_weak(head, ptr, std::memory_order_release, std::memory_order_relaxed) );
     }
 
+    /** Thread that owns this pool */
+    int getOwnerThread() const { return owner_thread; }
+
     /**
        Approximates the current memory usage of the mempool. Some
        overheads are not taken into account.
@@ -217,6 +358,15 @@ public:
     int64_t numAlloc;
     /** Counter:  Number times elements have been freed */
     int64_t numFree;
+    /** Counter:  Bytes of arenas backed by huge pages */
+    int64_t hugePageBytes;
+    /** Counter:  Number of arenas that ended up on a different NUMA
+     * node than the thread that allocated them */
+    int64_t remoteArenas;
+    /** Counter:  Number of arenas released back to the OS */
+    int64_t releasedArenas;
+    /** Value of numAlloc the last time stats were printed */
+    int64_t reportedAlloc;
 
     size_t getArenaSize() const { return arenaSize; }
     size_t getNumArenas() const { return arenas.size(); }
@@ -225,14 +375,130 @@ public:
 
     const std::list<uint8_t*>& getArenas() { return arenas; }
 
+    /** Number of items in use in an arena.  Freed items have their
+     * pool header cleared, so this is found by walking the arena
+     * rather than counted on every allocation. */
+    size_t getArenaOccupancy(const uint8_t* arena) const
+    {
+        size_t nelem = arenaSize / allocSize;
+        size_t live  = 0;
+        for ( size_t i = 0; i < nelem; i++ ) {
+            if ( *(const uint64_t*)(arena + (allocSize * i)) != 0 ) live++;
+        }
+        return live;
+    }
+
+    /** Takes the arenas that have nothing in use out of the pool and
+     * adds them to released.  Their items are still on the free lists
+     * of this and possibly other pools until removeFreeItems() is
+     * called on all of them, and the arenas must not be unmapped
+     * before then.  Only safe to call when no thread is allocating.
+     */
+    void detachFreeArenas(ArenaRanges& released)
+    {
+        // Items freed by other threads have to be in the free lists
+        // before the arenas they are in go away
+        drainRemote();
+
+        size_t nelem = arenaSize / allocSize;
+        for ( auto i = arenas.begin(); i != arenas.end(); ) {
+            if ( getArenaOccupancy(*i) != 0 ) {
+                ++i;
+                continue;
+            }
+            released.add(*i, arenaSize);
+            if ( hugeArenas.erase(*i) ) hugePageBytes -= arenaSize;
+            max_freelist_size -= nelem;
+            releasedArenas++;
+            i = arenas.erase(i);
+        }
+    }
+
+    /** Drops the items in the released arenas from the free lists */
+    void removeFreeItems(const ArenaRanges& released)
+    {
+        auto in_released = [&released](void* ptr) { return released.contains(ptr); };
+        freelist.erase(std::remove_if(freelist.begin(), freelist.end(), in_released), freelist.end());
+        overflow.erase(std::remove_if(overflow.begin(), overflow.end(), in_released), overflow.end());
+        freelist.shrink_to_fit();
+        overflow.shrink_to_fit();
+    }
+
+    /** Drops the items in the released arenas from the lists shared
+     * between threads */
+    static void removeSharedFreeItems(const ArenaRanges& released)
+    {
+        shared_overflow.removeIf([&released](void* ptr) { return released.contains(ptr); });
+    }
+
 private:
+    // Goes in freelist if we aren't at max capacity.  Otherwise goes
+    // in overflow.
+    inline void insertFree(void* ptr)
+    {
+        if ( freelist.size() >= max_freelist_size ) {
+            overflow.push_back(ptr);
+            if ( overflow.size() == max_overflow_size ) { shared_overflow.insert(elemSize, overflow); }
+        }
+        else {
+            freelist.push_back(ptr);
+        }
+    }
+
+    // Move everything other threads have returned into the free
+    // lists.  Returns true if the freelist has anything in it
+    // afterwards.
+    inline bool drainRemote()
+    {
+        if ( nullptr == remote_head.load(std::memory_order_relaxed) ) return false;
+        void* item = remote_head.exchange(nullptr, std::memory_order_acquire);
+        while ( item ) {
+            void* next = *(reinterpret_cast<void**>(item) + 1);
+            insertFree(item);
+            item = next;
+        }
+        return !freelist.empty();
+    }
+
     // allocPool will only ever be called by one thread, no need for locking
     // version that will cache align each memory chunk for an event
     bool allocPool()
     {
-        uint8_t* newPool = (uint8_t*)mmap(nullptr, arenaSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
-        if ( MAP_FAILED == newPool ) { return false; }
+        uint8_t* newPool = (uint8_t*)MAP_FAILED;
+#ifdef MAP_HUGETLB
+        // Try explicit huge pages first.  This will fail if the
+        // system has no huge pages reserved, in which case we fall
+        // back to normal pages and ask for transparent huge pages.
+        if ( memPoolHugePages ) {
+            newPool = (uint8_t*)mmap(
+                nullptr, arenaSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON | MAP_HUGETLB, -1, 0);
+            if ( MAP_FAILED != newPool ) {
+                hugePageBytes += arenaSize;
+                hugeArenas.insert(newPool);
+            }
+        }
+#endif
+        if ( MAP_FAILED == newPool ) {
+            newPool = (uint8_t*)mmap(nullptr, arenaSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
+            if ( MAP_FAILED == newPool ) { return false; }
+#ifdef MADV_HUGEPAGE
+            if ( memPoolHugePages ) madvise(newPool, arenaSize, MADV_HUGEPAGE);
+#endif
+        }
+
+#ifdef SST_MEMPOOL_HAVE_NUMA
+        // Set the placement before the memset below first touches the
+        // pages, then check where they actually went
+        int node = -1;
+        if ( memPoolNumaLocal ) {
+            node = currentNumaNode();
+            preferNumaNode(newPool, arenaSize, node);
+        }
+#endif
         std::memset(newPool, 0, arenaSize);
+#ifdef SST_MEMPOOL_HAVE_NUMA
+        if ( memPoolNumaLocal && node >= 0 && pageNumaNode(newPool) != node ) remoteArenas++;
+#endif
         arenas.push_back(newPool);
         size_t nelem = arenaSize / allocSize;
         for ( size_t i = 0; i < nelem; i++ ) {
@@ -243,6 +509,9 @@ private:
         return true;
     }
 
+    int                owner_thread;
+    std::atomic<void*> remote_head;
+
     size_t elemSize;
     size_t arenaSize;
     size_t max_freelist_size;
@@ -250,6 +519,9 @@ private:
     size_t allocSize;
 
     std::list<uint8_t*> arenas;
+
+    // Arenas backed by explicit huge pages
+    std::set<uint8_t*> hugeArenas;
 };
 
 
@@ -274,9 +546,16 @@ struct PoolInfo_t
 // call delete[] if we use an array with new.
 static std::vector<std::vector<PoolInfo_t>> memPoolThreadVector;
 
+// Items up to this size (most events: credits, NullEvents, short
+// StringEvents, ...) all share one pool of fixed size slots.  Keeping
+// them together means one hot free list per thread instead of one per
+// class, and lets the allocation path skip the search for the pool.
+static const std::size_t SMALL_ITEM_SLOT_SIZE = 64;
+
 // My local thread number
 thread_local int                      thread_num = -1;
 thread_local std::vector<PoolInfo_t>* myPools;
+thread_local MemPoolNoMutex*          mySmallItemPool = nullptr;
 
 
 inline MemPoolNoMutex*
@@ -284,6 +563,11 @@ getMemPool(std::size_t size) noexcept
 {
     MemPoolNoMutex* pool = nullptr;
 
+    if ( size <= SMALL_ITEM_SLOT_SIZE ) {
+        if ( nullptr != mySmallItemPool ) return mySmallItemPool;
+        size = SMALL_ITEM_SLOT_SIZE;
+    }
+
     for ( auto& x : *myPools ) {
         if ( x.size == size ) {
             pool = x.pool;
@@ -294,19 +578,24 @@ getMemPool(std::size_t size) noexcept
     if ( nullptr == pool ) {
         /* Still can't find it, alloc a new one */
         // pool = new Core::MemPoolNoMutex(size + sizeof(PoolData_t));
-        pool = new Core::MemPoolNoMutex(size + sizeof(uint64_t*));
+        pool = new Core::MemPoolNoMutex(size + sizeof(uint64_t*), thread_num);
         myPools->emplace_back(size, pool);
     }
+    if ( size == SMALL_ITEM_SLOT_SIZE ) mySmallItemPool = pool;
     return pool;
 }
 
 
 void
-MemPoolAccessor::initializeGlobalData(int num_threads, bool cache_align)
+MemPoolAccessor::initializeGlobalData(
+    int num_threads, bool cache_align, bool thread_return, bool huge_pages, bool numa_local)
 {
     // Only resize once
     if ( memPoolThreadVector.size() == 0 ) { memPoolThreadVector.resize(num_threads); }
-    memPoolCacheAlign = cache_align;
+    memPoolCacheAlign   = cache_align;
+    memPoolThreadReturn = thread_return;
+    memPoolHugePages    = huge_pages;
+    memPoolNumaLocal    = numa_local;
 }
 
 void
@@ -359,6 +648,80 @@ MemPoolAccessor::getMemPoolUsage(int64_t& bytes, int64_t& active_entries)
     active_entries = alloced - freed;
 }
 
+void
+MemPoolAccessor::getMemPoolUsageBySize(std::map<size_t, int64_t>& bytes)
+{
+    for ( auto&& pool_group : memPoolThreadVector ) {
+        for ( auto&& entry : pool_group ) {
+            bytes[entry.size] += entry.pool->getBytesMemUsed();
+        }
+    }
+}
+
+void
+MemPoolAccessor::getArenaPlacement(int64_t& huge_page_bytes, int64_t& remote_arenas)
+{
+    for ( auto&& pool_group : memPoolThreadVector ) {
+        for ( auto&& entry : pool_group ) {
+            huge_page_bytes += entry.pool->hugePageBytes;
+            remote_arenas += entry.pool->remoteArenas;
+        }
+    }
+}
+
+void
+MemPoolAccessor::getArenaOccupancy(int64_t& arenas, int64_t& free_arenas)
+{
+    for ( auto&& pool_group : memPoolThreadVector ) {
+        for ( auto&& entry : pool_group ) {
+            for ( auto arena : entry.pool->getArenas() ) {
+                arenas++;
+                if ( entry.pool->getArenaOccupancy(arena) == 0 ) free_arenas++;
+            }
+        }
+    }
+}
+
+void
+MemPoolAccessor::releaseFreeArenas(int64_t& arenas, int64_t& bytes)
+{
+    // Items move between the pools of the same size on different
+    // threads, so every pool has to drop the released items before
+    // any arena can be unmapped
+    ArenaRanges released;
+    for ( auto&& pool_group : memPoolThreadVector ) {
+        for ( auto&& entry : pool_group ) {
+            entry.pool->detachFreeArenas(released);
+        }
+    }
+    if ( released.empty() ) return;
+
+    released.sort();
+    for ( auto&& pool_group : memPoolThreadVector ) {
+        for ( auto&& entry : pool_group ) {
+            entry.pool->removeFreeItems(released);
+        }
+    }
+    MemPoolNoMutex::removeSharedFreeItems(released);
+
+    for ( auto& range : released.get() ) {
+        munmap(range.first, range.second - range.first);
+        arenas++;
+        bytes += range.second - range.first;
+    }
+}
+
+void
+MemPoolAccessor::getReleasedArenas(int64_t& arenas, int64_t& bytes)
+{
+    for ( auto&& pool_group : memPoolThreadVector ) {
+        for ( auto&& entry : pool_group ) {
+            arenas += entry.pool->releasedArenas;
+            bytes += entry.pool->releasedArenas * entry.pool->getArenaSize();
+        }
+    }
+}
+
 void
 MemPoolAccessor::printUndeletedMemPoolItems(const std::string& header, Output& out)
 {
@@ -382,12 +745,83 @@ MemPoolAccessor::printUndeletedMemPoolItems(const std::string& header, Output& o
 }
 
 
+void
+MemPoolAccessor::printMemPoolStats(const std::string& header, Output& out, bool by_type)
+{
+    // Pools of the same size on different threads are combined.
+    // Items allocated on one thread and freed on another are counted
+    // as freed on the freeing thread, so only the sums are meaningful.
+    struct SizeUsage_t
+    {
+        int64_t live      = 0;
+        int64_t allocated = 0;
+    };
+    std::map<size_t, SizeUsage_t> sizes;
+    for ( auto&& pool_group : memPoolThreadVector ) {
+        for ( auto&& entry : pool_group ) {
+            SizeUsage_t& usage = sizes[entry.size];
+            usage.live += entry.pool->numAlloc - entry.pool->numFree;
+            usage.allocated += entry.pool->numAlloc - entry.pool->reportedAlloc;
+            entry.pool->reportedAlloc = entry.pool->numAlloc;
+        }
+    }
+
+    out.output("%sMempool usage by size:\n", header.c_str());
+    for ( auto& x : sizes ) {
+        out.output(
+            "%s  %6zu B: %12" PRId64 " live, %12" PRId64 " allocated since last report\n", header.c_str(), x.first,
+            x.second.live, x.second.allocated);
+    }
+
+    if ( !by_type ) return;
+
+    struct TypeUsage_t
+    {
+        uint64_t live  = 0;
+        uint64_t bytes = 0;
+    };
+    std::map<std::string, TypeUsage_t> types;
+    for ( auto&& pool_group : memPoolThreadVector ) {
+        for ( auto&& entry : pool_group ) {
+            const std::list<uint8_t*>& arenas    = entry.pool->getArenas();
+            size_t                     arenaSize = entry.pool->getArenaSize();
+            size_t                     allocSize = entry.pool->getAllocSize();
+            size_t                     nelem     = arenaSize / allocSize;
+            for ( auto iter = arenas.begin(); iter != arenas.end(); ++iter ) {
+                for ( size_t j = 0; j < nelem; j++ ) {
+                    uint64_t* ptr = (uint64_t*)((*iter) + (allocSize * j));
+                    if ( *ptr != 0 ) {
+                        MemPoolItem* act   = (MemPoolItem*)(ptr + 1);
+                        TypeUsage_t& usage = types[act->cls_name()];
+                        usage.live++;
+                        usage.bytes += entry.size;
+                    }
+                }
+            }
+        }
+    }
+
+    // Print the classes with the most live items first
+    std::vector<std::pair<std::string, TypeUsage_t>> sorted(types.begin(), types.end());
+    std::stable_sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) {
+        return a.second.live > b.second.live;
+    });
+
+    out.output("%sMempool usage by class:\n", header.c_str());
+    for ( auto& x : sorted ) {
+        out.output(
+            "%s  %s: %" PRIu64 " live, %" PRIu64 " B\n", header.c_str(), x.first.c_str(), x.second.live,
+            x.second.bytes);
+    }
+}
+
+
 void*
 MemPoolItem::operator new(std::size_t size) noexcept
 {
     /* 1) Find memory pool
      * 2) Alloc item from pool
-     * 3) Append PoolID to item, increment pointer
+     * 3) Append pool pointer to item, increment pointer
      */
     MemPoolNoMutex* pool = getMemPool(size);
 
@@ -396,7 +830,7 @@ MemPoolItem::operator new(std::size_t size) noexcept
         fprintf(stderr, "Memory Pool failed to allocate a new object.  Error: %s\n", strerror(errno));
         return nullptr;
     }
-    *ptr = size;
+    *ptr = reinterpret_cast<uint64_t>(pool);
     return (void*)(ptr + 1);
 }
 
@@ -406,22 +840,35 @@ MemPoolItem::operator delete(void* ptr)
 {
     /* 1) Decrement pointer
      * 2) Determine Pool Pointer
-     * 2b) Set Pool_id field to 0 to allow tracking
-     * 3) Return to local pool
+     * 2b) Set pool field to 0 to allow tracking
+     * 3) Return to local pool, or to the owning pool if thread
+     *    return is on
      */
     uint64_t* ptr8 = ((uint64_t*)ptr) - 1;
-    uint64_t  size = *ptr8;
     if ( *ptr8 == 0 ) {
         // This item has already been deleted, error
         Output::getDefaultObject().fatal(
             CALL_INFO, 1, "ERROR: Double deletion of mempool item detected: %s",
             static_cast<MemPoolItem*>(ptr)->toString().c_str());
     }
-    *ptr8 = 0;
+    MemPoolNoMutex* owner = reinterpret_cast<MemPoolNoMutex*>(*ptr8);
+    *ptr8                 = 0;
 
-    // find the pool
-    MemPoolNoMutex* pool = getMemPool(size);
-    pool->free(ptr8);
+    // Freed on the thread that allocated it
+    if ( owner->getOwnerThread() == thread_num ) {
+        owner->free(ptr8);
+        return;
+    }
+
+    // Find this thread's pool for the same size
+    MemPoolNoMutex* pool = getMemPool(owner->getElementSize() - sizeof(uint64_t*));
+    if ( memPoolThreadReturn ) {
+        pool->numFree++;
+        owner->remoteFree(ptr8);
+    }
+    else {
+        pool->free(ptr8);
+    }
 }
 
 
@@ -429,7 +876,9 @@ MemPoolItem::operator delete(void* ptr)
 
 
 void
-MemPoolAccessor::initializeGlobalData(int UNUSED(num_threads), bool UNUSED(cache_align))
+MemPoolAccessor::initializeGlobalData(
+    int UNUSED(num_threads), bool UNUSED(cache_align), bool UNUSED(thread_return), bool UNUSED(huge_pages),
+    bool UNUSED(numa_local))
 {}
 
 void
@@ -465,12 +914,36 @@ MemPoolAccessor::getMemPoolUsage(int64_t& bytes, int64_t& active_entries)
     active_entries = 0;
 }
 
+void
+MemPoolAccessor::getMemPoolUsageBySize(std::map<size_t, int64_t>& UNUSED(bytes))
+{}
+
+void
+MemPoolAccessor::getArenaPlacement(int64_t& UNUSED(huge_page_bytes), int64_t& UNUSED(remote_arenas))
+{}
+
+void
+MemPoolAccessor::getArenaOccupancy(int64_t& UNUSED(arenas), int64_t& UNUSED(free_arenas))
+{}
+
+void
+MemPoolAccessor::releaseFreeArenas(int64_t& UNUSED(arenas), int64_t& UNUSED(bytes))
+{}
+
+void
+MemPoolAccessor::getReleasedArenas(int64_t& UNUSED(arenas), int64_t& UNUSED(bytes))
+{}
+
 void
 MemPoolAccessor::printUndeletedMemPoolItems(const std::string& UNUSED(header), Output& UNUSED(out))
 {
     return;
 }
 
+void
+MemPoolAccessor::printMemPoolStats(const std::string& UNUSED(header), Output& UNUSED(out), bool UNUSED(by_type))
+{}
+
 
 void*
 MemPoolItem::operator new(std::size_t size) noexcept
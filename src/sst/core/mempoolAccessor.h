@@ -12,9 +12,12 @@
 #ifndef SST_CORE_MEMPOOL_ACCESSOR_H
 #define SST_CORE_MEMPOOL_ACCESSOR_H
 
+#include <map>
 
 namespace SST {
 
+class Output;
+
 namespace Core {
 
 // Class to access stats/data about the mempools.  This is here to
@@ -42,13 +45,62 @@ public:
     // aren't enabled, then nothing will be counted.
     static void getMemPoolUsage(int64_t& bytes, int64_t& active_entries);
 
-    // Initialize the global mempool data structures
-    static void initializeGlobalData(int num_threads, bool cache_align = false);
+    // Gets the mempool usage for the rank in bytes, broken down by the
+    // item size of the pools.  Bytes are added to the values in the
+    // map.  If mempools aren't enabled, then nothing will be counted.
+    static void getMemPoolUsageBySize(std::map<size_t, int64_t>& bytes);
+
+    // Gets the arena placement statistics for the rank: the bytes of
+    // arenas backed by explicit huge pages and the number of arenas
+    // that were placed on a different NUMA node than the thread that
+    // allocated them (only checked when NUMA local arenas are on).
+    // Values are added to the ones passed in.  If mempools aren't
+    // enabled, then nothing will be counted.
+    static void getArenaPlacement(int64_t& huge_page_bytes, int64_t& remote_arenas);
+
+    // Gets the number of arenas for the rank and how many of them have
+    // no items in use.  Values are added to the ones passed in.  This
+    // walks all the arenas, so it must only be called when no other
+    // thread can be allocating.  If mempools aren't enabled, then
+    // nothing will be counted.
+    static void getArenaOccupancy(int64_t& arenas, int64_t& free_arenas);
+
+    // Releases the arenas for the rank that have no items in use back
+    // to the operating system.  Meant for phase boundaries, such as
+    // after init, where items that were only needed for the phase
+    // have been deleted.  The number of arenas and bytes released are
+    // added to the values passed in.  Must only be called when no
+    // other thread can be allocating or freeing.  If mempools aren't
+    // enabled, nothing is released.
+    static void releaseFreeArenas(int64_t& arenas, int64_t& bytes);
+
+    // Gets the total number of arenas and bytes released for the rank
+    // by releaseFreeArenas().  Values are added to the ones passed in.
+    static void getReleasedArenas(int64_t& arenas, int64_t& bytes);
+
+    // Initialize the global mempool data structures.  If thread_return
+    // is true, items deleted on a thread other than the one that
+    // allocated them are handed back to the allocating thread's pool.
+    // If huge_pages is true, arenas are backed by huge pages when
+    // possible.  If numa_local is true, arenas are placed on the NUMA
+    // node of the thread that allocates them.
+    static void initializeGlobalData(
+        int num_threads, bool cache_align = false, bool thread_return = false, bool huge_pages = false,
+        bool numa_local = false);
 
     // Initialize the per thread mempool ata structures
     static void initializeLocalData(int thread);
 
     static void printUndeletedMemPoolItems(const std::string& header, Output& out);
+
+    // Prints the mempool usage for the rank broken down by pool size:
+    // live items and the number allocated since the last call.  If
+    // by_type is true, live items and bytes are also broken down by
+    // class, as reported by cls_name().  The breakdown by class walks
+    // all the arenas, so it must only be requested when no other
+    // thread can be allocating.  If mempools aren't enabled, nothing
+    // will be printed.
+    static void printMemPoolStats(const std::string& header, Output& out, bool by_type);
 };
 
 } // namespace Core
@@ -13,8 +13,12 @@
 
 #include "sst/core/memuse.h"
 
+#include "sst/core/output.h"
+#include "sst/core/stringize.h"
+#include "sst/core/unitAlgebra.h"
 #include "sst/core/warnmacros.h"
 
+#include <algorithm>
 #include <sys/resource.h>
 
 #ifdef SST_CONFIG_HAVE_MPI
@@ -108,3 +112,135 @@ SST::Core::globalPageFaults()
 
     return global_pf;
 };
+
+std::atomic<int64_t> MemoryAccounting::current[MemoryAccounting::NUM_SUBSYSTEMS];
+std::atomic<int64_t> MemoryAccounting::high_water[MemoryAccounting::NUM_SUBSYSTEMS];
+int64_t              MemoryAccounting::peak[MemoryAccounting::NUM_PHASES][MemoryAccounting::NUM_SUBSYSTEMS];
+int64_t              MemoryAccounting::mempool_current[MemoryAccounting::NUM_SIZE_CLASSES];
+int64_t              MemoryAccounting::mempool_peak[MemoryAccounting::NUM_PHASES][MemoryAccounting::NUM_SIZE_CLASSES];
+
+void
+MemoryAccounting::set(Subsystem sub, int64_t bytes)
+{
+    current[sub].store(bytes, std::memory_order_relaxed);
+    high_water[sub].store(bytes, std::memory_order_relaxed);
+}
+
+int
+MemoryAccounting::getSizeClass(size_t size)
+{
+    int    size_class = 0;
+    size_t limit      = 64;
+    while ( size > limit && size_class < NUM_SIZE_CLASSES - 1 ) {
+        limit *= 2;
+        size_class++;
+    }
+    return size_class;
+}
+
+void
+MemoryAccounting::setMemPoolSizeClass(int size_class, int64_t bytes)
+{
+    mempool_current[size_class] = bytes;
+}
+
+void
+MemoryAccounting::endPhase(Phase phase)
+{
+    for ( int i = 0; i < NUM_SUBSYSTEMS; ++i ) {
+        // The high water mark covers counted subsystems that grew and
+        // shrank again since the last phase ended
+        int64_t now    = current[i].load(std::memory_order_relaxed);
+        int64_t high   = high_water[i].exchange(now, std::memory_order_relaxed);
+        peak[phase][i] = std::max(peak[phase][i], std::max(now, high));
+    }
+    for ( int i = 0; i < NUM_SIZE_CLASSES; ++i ) {
+        mempool_peak[phase][i] = std::max(mempool_peak[phase][i], mempool_current[i]);
+    }
+}
+
+static std::string
+formatBytes(int64_t bytes)
+{
+    SST::UnitAlgebra ua(SST::format_string("%" PRId64 "B", bytes));
+    return ua.toStringBestSI(3);
+}
+
+void
+MemoryAccounting::print(Output& out)
+{
+    static const char* subsystem_names[NUM_SUBSYSTEMS] = { "ConfigGraph", "Params",     "Links",         "TimeVortex",
+                                                           "Mempools",    "Statistics", "SharedObjects", "Sync" };
+    static const char* phase_names[NUM_PHASES] = { "Graph build", "Construction", "Init", "Run", "Complete" };
+
+    // Mempool size classes are reported as extra rows
+    const int num_rows = NUM_SUBSYSTEMS + NUM_SIZE_CLASSES;
+    int64_t   local[NUM_PHASES * num_rows];
+    for ( int p = 0; p < NUM_PHASES; ++p ) {
+        for ( int i = 0; i < NUM_SUBSYSTEMS; ++i ) {
+            local[p * num_rows + i] = peak[p][i];
+        }
+        for ( int i = 0; i < NUM_SIZE_CLASSES; ++i ) {
+            local[p * num_rows + NUM_SUBSYSTEMS + i] = mempool_peak[p][i];
+        }
+    }
+
+    int64_t max[NUM_PHASES * num_rows];
+    int64_t min[NUM_PHASES * num_rows];
+    int     rank      = 0;
+    int     num_ranks = 1;
+#ifdef SST_CONFIG_HAVE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+    MPI_Allreduce(local, max, NUM_PHASES * num_rows, MPI_INT64_T, MPI_MAX, MPI_COMM_WORLD);
+    MPI_Allreduce(local, min, NUM_PHASES * num_rows, MPI_INT64_T, MPI_MIN, MPI_COMM_WORLD);
+#else
+    std::copy(local, local + NUM_PHASES * num_rows, max);
+    std::copy(local, local + NUM_PHASES * num_rows, min);
+#endif
+    if ( rank != 0 ) return;
+
+    // With more than one rank each entry is the largest rank's peak
+    // and the smallest rank's
+    out.output("\n");
+    out.output(
+        "Approximate memory use by subsystem (peak in each phase%s):\n",
+        num_ranks > 1 ? ", largest rank / smallest rank" : "");
+    std::string line = format_string("  %-16s", "");
+    for ( int p = 0; p < NUM_PHASES; ++p ) {
+        line += format_string(num_ranks > 1 ? " %-21s" : " %-12s", phase_names[p]);
+    }
+    out.output("%s\n", line.c_str());
+
+    for ( int i = 0; i < num_rows; ++i ) {
+        std::string name;
+        if ( i < NUM_SUBSYSTEMS ) { name = subsystem_names[i]; }
+        else {
+            int size_class = i - NUM_SUBSYSTEMS;
+            if ( size_class == NUM_SIZE_CLASSES - 1 ) { name = format_string("  > %d B", 64 << (size_class - 1)); }
+            else {
+                name = format_string("  <= %d B", 64 << size_class);
+            }
+
+            // Only show the size classes that were used
+            bool used = false;
+            for ( int p = 0; p < NUM_PHASES; ++p ) {
+                used = used || max[p * num_rows + i] != 0;
+            }
+            if ( !used ) continue;
+        }
+
+        line = format_string("  %-16s", name.c_str());
+        for ( int p = 0; p < NUM_PHASES; ++p ) {
+            std::string cell = formatBytes(max[p * num_rows + i]);
+            if ( num_ranks > 1 ) {
+                cell += " / " + formatBytes(min[p * num_rows + i]);
+                line += format_string(" %-21s", cell.c_str());
+            }
+            else {
+                line += format_string(" %-12s", cell.c_str());
+            }
+        }
+        out.output("%s\n", line.c_str());
+    }
+}
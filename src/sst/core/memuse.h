@@ -12,9 +12,14 @@
 #ifndef SST_CORE_MEMUSE_H
 #define SST_CORE_MEMUSE_H
 
+#include <atomic>
+#include <cstddef>
 #include <inttypes.h>
 
 namespace SST {
+
+class Output;
+
 namespace Core {
 
 uint64_t localMemSize();
@@ -23,6 +28,75 @@ uint64_t maxGlobalMemSize();
 uint64_t maxLocalPageFaults();
 uint64_t globalPageFaults();
 
+/**
+   Approximate memory accounting for the major core subsystems, so
+   the RSS can be attributed.
+
+   Subsystems whose objects come and go during a phase (links and
+   statistics) are counted as the objects are created and deleted.
+   The rest are estimated from the containers they hold and set at
+   the end of each phase.  The largest value seen in each phase is
+   kept per subsystem.  The sizes leave out allocator overhead and
+   memory owned by elements, so they show where the core's memory
+   goes rather than adding up to the RSS.
+ */
+class MemoryAccounting
+{
+public:
+    enum Subsystem {
+        CONFIG_GRAPH,
+        PARAMS,
+        LINKS,
+        TIME_VORTEX,
+        MEMPOOL,
+        STATISTICS,
+        SHARED_OBJECTS,
+        SYNC,
+        NUM_SUBSYSTEMS
+    };
+
+    enum Phase { GRAPH_BUILD, CONSTRUCTION, INIT, RUN, COMPLETE, NUM_PHASES };
+
+    /** Adjust the size of a counted subsystem.  Safe to call from
+     * any thread. */
+    static void add(Subsystem sub, int64_t bytes)
+    {
+        int64_t now  = current[sub].fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        int64_t high = high_water[sub].load(std::memory_order_relaxed);
+        while ( now > high && !high_water[sub].compare_exchange_weak(high, now, std::memory_order_relaxed) ) {}
+    }
+
+    /** Set the size of an estimated subsystem */
+    static void set(Subsystem sub, int64_t bytes);
+
+    /** Mempool pools are grouped into size classes by powers of two,
+     * from 64 bytes up to 4 KiB and one class for anything larger */
+    static const int NUM_SIZE_CLASSES = 8;
+
+    /** Size class a mempool item size falls in */
+    static int getSizeClass(size_t size);
+
+    /** Set the size of a mempool size class.  The total for the
+     * mempools is set separately with set(MEMPOOL, ...). */
+    static void setMemPoolSizeClass(int size_class, int64_t bytes);
+
+    /** Record the sizes as of the end of a phase.  Must only be
+     * called from one thread at a time. */
+    static void endPhase(Phase phase);
+
+    /** Print the peak of each subsystem in each phase, as the largest
+     * and smallest over the ranks.  Must be called on every rank;
+     * only rank 0 prints. */
+    static void print(Output& out);
+
+private:
+    static std::atomic<int64_t> current[NUM_SUBSYSTEMS];
+    static std::atomic<int64_t> high_water[NUM_SUBSYSTEMS];
+    static int64_t              peak[NUM_PHASES][NUM_SUBSYSTEMS];
+    static int64_t              mempool_current[NUM_SIZE_CLASSES];
+    static int64_t              mempool_peak[NUM_PHASES][NUM_SIZE_CLASSES];
+};
+
 } // namespace Core
 } // namespace SST
 
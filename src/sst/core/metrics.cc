@@ -0,0 +1,144 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/metrics.h"
+
+#include "sst/core/cputimer.h"
+#include "sst/core/mempoolAccessor.h"
+#include "sst/core/output.h"
+#include "sst/core/simulation_impl.h"
+#include "sst/core/timeVortex.h"
+#include "sst/core/unitAlgebra.h"
+
+#include <cerrno>
+#include <chrono>
+#include <cinttypes>
+#include <cstring>
+
+namespace SST {
+
+SimulatorMetrics::SimulatorMetrics(
+    const std::string& filename, double period, RankInfo my_rank, RankInfo num_ranks) :
+    period(period),
+    rank(my_rank.rank),
+    start_time(sst_get_cpu_time()),
+    last(num_ranks.thread),
+    done(false)
+{
+    std::string file = filename;
+    if ( num_ranks.rank > 1 ) {
+        // Add the rank before the extension, if there is one
+        auto index = file.find_last_of(".");
+        if ( index != std::string::npos && file.find('/', index) == std::string::npos ) {
+            file.insert(index, std::to_string(my_rank.rank));
+        }
+        else {
+            file += std::to_string(my_rank.rank);
+        }
+    }
+
+    fp = fopen(file.c_str(), "w");
+    if ( nullptr == fp ) {
+        Simulation_impl::getSimulationOutput().fatal(
+            CALL_INFO, 1, "ERROR: Unable to open metrics file %s: %s\n", file.c_str(), strerror(errno));
+    }
+
+    for ( auto& state : last )
+        state.wall_time = start_time;
+}
+
+SimulatorMetrics::~SimulatorMetrics()
+{
+    stop();
+    if ( fp ) fclose(fp);
+}
+
+void
+SimulatorMetrics::start()
+{
+    timer = std::thread(&SimulatorMetrics::timerLoop, this);
+}
+
+void
+SimulatorMetrics::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(timer_mutex);
+        done = true;
+    }
+    timer_cv.notify_all();
+    if ( timer.joinable() ) timer.join();
+}
+
+void
+SimulatorMetrics::timerLoop()
+{
+    auto                         wait = std::chrono::duration<double>(period);
+    std::unique_lock<std::mutex> lock(timer_mutex);
+    while ( !timer_cv.wait_for(lock, wait, [this] { return done; }) ) {
+        Simulation_impl::postSignal(REPORT_SIGNAL);
+    }
+}
+
+void
+SimulatorMetrics::report(Simulation_impl* sim, uint64_t events, double sync_time)
+{
+    RankInfo        my_rank  = sim->getRank();
+    thread_state_t& prev     = last[my_rank.thread];
+    double          now      = sst_get_cpu_time();
+    double          sim_time = sim->getElapsedSimTime().getDoubleValue();
+
+    // Rates are over the time since this thread's previous report
+    double interval       = now - prev.wall_time;
+    double events_per_sec = 0.0;
+    double sim_wall_ratio = 0.0;
+    double sync_fraction  = 0.0;
+    if ( interval > 0.0 ) {
+        events_per_sec = (events - prev.events) / interval;
+        sim_wall_ratio = (sim_time - prev.sim_time) / interval;
+        sync_fraction  = (sync_time - prev.sync_time) / interval;
+    }
+
+    prev.wall_time = now;
+    prev.sim_time  = sim_time;
+    prev.sync_time = sync_time;
+    prev.events    = events;
+
+    TimeVortex* tv = sim->getTimeVortex();
+
+    char line[1024];
+    int  len = snprintf(
+        line, sizeof(line),
+        "{\"wall_time\": %.6f, \"rank\": %" PRIu32 ", \"thread\": %" PRIu32 ", \"sim_time\": %.12g, "
+        "\"events\": %" PRIu64 ", \"events_per_sec\": %.6g, \"sim_wall_ratio\": %.6g, \"sync_time\": %.6f, "
+        "\"sync_fraction\": %.6g, \"tv_depth\": %" PRIu64 ", \"tv_max_depth\": %" PRIu64,
+        now - start_time, rank, my_rank.thread, sim_time, events, events_per_sec, sim_wall_ratio, sync_time,
+        sync_fraction, tv->getCurrentDepth(), tv->getMaxDepth());
+
+    // The mempools are shared by all the threads of the rank, so only
+    // thread 0 reports them
+    if ( my_rank.thread == 0 ) {
+        int64_t mempool_size      = 0;
+        int64_t active_activities = 0;
+        Core::MemPoolAccessor::getMemPoolUsage(mempool_size, active_activities);
+        len += snprintf(
+            line + len, sizeof(line) - len, ", \"mempool_bytes\": %" PRId64 ", \"mempool_active\": %" PRId64,
+            mempool_size, active_activities);
+    }
+
+    std::lock_guard<std::mutex> lock(write_mutex);
+    fprintf(fp, "%s}\n", line);
+    fflush(fp);
+}
+
+} // namespace SST
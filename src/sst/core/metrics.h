@@ -0,0 +1,90 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_METRICS_H
+#define SST_CORE_METRICS_H
+
+#include "sst/core/rankInfo.h"
+#include "sst/core/sst_types.h"
+
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace SST {
+
+class Simulation_impl;
+
+/**
+  \class SimulatorMetrics
+    Optional live performance metrics of a running simulation.  A
+    timer thread wakes up every period of wall-clock time and asks the
+    simulation threads to report, through the same flag that signals
+    use.  Each thread then appends one JSON object per line to the
+    metrics file of its rank, so the run loop does no extra checks.
+*/
+class SimulatorMetrics
+{
+public:
+    /** Value of the signal flag that asks a thread for a report */
+    static const int REPORT_SIGNAL = -1;
+
+    /**
+       Create the metrics writer of this rank.  The rank is added to
+       filename when there is more than one rank.
+     */
+    SimulatorMetrics(const std::string& filename, double period, RankInfo my_rank, RankInfo num_ranks);
+    ~SimulatorMetrics();
+
+    /** Start the timer.  Called once all the simulation threads exist. */
+    void start();
+
+    /** Stop the timer */
+    void stop();
+
+    /**
+       Write a line for the calling simulation thread
+       @param sim Simulation of the thread
+       @param events Number of activities executed by the thread
+       @param sync_time Wall-clock seconds the thread spent in syncs
+     */
+    void report(Simulation_impl* sim, uint64_t events, double sync_time);
+
+private:
+    struct thread_state_t
+    {
+        double   wall_time = 0.0;
+        double   sim_time  = 0.0;
+        double   sync_time = 0.0;
+        uint64_t events    = 0;
+    };
+
+    void timerLoop();
+
+    FILE*                       fp;
+    double                      period;
+    uint32_t                    rank;
+    double                      start_time;
+    std::vector<thread_state_t> last; // Values at each thread's previous report
+    std::mutex                  write_mutex;
+
+    std::thread             timer;
+    std::mutex              timer_mutex;
+    std::condition_variable timer_cv;
+    bool                    done;
+};
+
+} // namespace SST
+
+#endif // SST_CORE_METRICS_H
@@ -0,0 +1,130 @@
+// -*- c++ -*-
+
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/model/binary/binarymodel.h"
+
+#include "sst/core/cfgoutput/binaryConfigOutput.h"
+#include "sst/core/params.h"
+#include "sst/core/serialization/serializer.h"
+#include "sst/core/warnmacros.h"
+
+#include <cstring>
+#include <fcntl.h>
+#include <map>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+using namespace SST;
+using namespace SST::Core;
+
+SSTBinaryModelDefinition::SSTBinaryModelDefinition(
+    const std::string& script_file, int verbosity, Config* configObj, double UNUSED(start_time)) :
+    SSTModelDescription(configObj),
+    fileName(script_file),
+    output(nullptr),
+    loadProgramOptions(true)
+{
+    output = new Output("SSTBinaryModel: ", verbosity, 0, SST::Output::STDOUT);
+
+    output->verbose(CALL_INFO, 2, 0, "SST loading a binary graph snapshot from: %s\n", script_file.c_str());
+}
+
+SSTBinaryModelDefinition::~SSTBinaryModelDefinition()
+{
+    delete output;
+}
+
+ConfigGraph*
+SSTBinaryModelDefinition::createConfigGraph()
+{
+    int fd = open(fileName.c_str(), O_RDONLY);
+    if ( fd < 0 ) { output->fatal(CALL_INFO, 1, "Error opening binary graph snapshot: %s\n", fileName.c_str()); }
+
+    struct stat st;
+    if ( fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(BinaryConfigGraphOutput::Header) ) {
+        output->fatal(CALL_INFO, 1, "File %s is not a binary graph snapshot\n", fileName.c_str());
+    }
+
+    size_t file_size = st.st_size;
+    void*  base      = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if ( base == MAP_FAILED ) {
+        output->fatal(CALL_INFO, 1, "Error mapping binary graph snapshot: %s\n", fileName.c_str());
+    }
+
+    BinaryConfigGraphOutput::Header header;
+    memcpy(&header, base, sizeof(header));
+    if ( memcmp(header.magic, BinaryConfigGraphOutput::file_magic, sizeof(header.magic)) != 0 ) {
+        output->fatal(CALL_INFO, 1, "File %s is not a binary graph snapshot\n", fileName.c_str());
+    }
+    if ( header.version != BinaryConfigGraphOutput::file_version ) {
+        output->fatal(
+            CALL_INFO, 1, "Binary graph snapshot %s has version %" PRIu32 ", expected %" PRIu32 "\n",
+            fileName.c_str(), header.version, BinaryConfigGraphOutput::file_version);
+    }
+    if ( header.payload_size > file_size - sizeof(header) ) {
+        output->fatal(CALL_INFO, 1, "Binary graph snapshot %s is truncated\n", fileName.c_str());
+    }
+
+    // The unpacker only reads from the buffer, so it can work
+    // directly on the read-only mapping
+    SST::Core::Serialization::serializer ser;
+    ser.start_unpacking(static_cast<char*>(base) + sizeof(header), header.payload_size);
+
+    std::map<std::string, std::string> options;
+    ser&                               options;
+    if ( loadProgramOptions ) {
+        for ( auto& x : options ) {
+            setOptionFromModel(x.first, x.second);
+        }
+    }
+
+    // Map the key IDs in the file to the key IDs in this process.
+    // ID 0 always holds the global set name.
+    std::vector<std::string> key_names;
+    ser&                     key_names;
+    std::vector<uint32_t>    remap(key_names.size(), 0);
+    bool                     identity = true;
+    for ( size_t i = 1; i < key_names.size(); ++i ) {
+        remap[i] = Params::getKey(key_names[i]);
+        if ( remap[i] != i ) identity = false;
+    }
+
+    std::map<std::string, std::map<std::string, std::string>> globals;
+    ser&                                                      globals;
+    for ( auto& set : globals ) {
+        Params::global_params[set.first][0] = set.first;
+        for ( auto& kv : set.second ) {
+            if ( kv.first == Params::keyMapReverse[0] ) continue;
+            insertGlobalParameter(set.first, kv.first, kv.second);
+        }
+    }
+
+    ConfigGraph* graph = new ConfigGraph();
+    Params::keyRemap   = identity ? nullptr : &remap;
+    ser&*        graph;
+    Params::keyRemap = nullptr;
+    graph->restoreLookupTables();
+
+    munmap(base, file_size);
+    close(fd);
+
+    output->verbose(
+        CALL_INFO, 1, 0, "Loaded %zu components from binary graph snapshot %s\n", graph->getNumComponents(),
+        fileName.c_str());
+
+    return graph;
+}
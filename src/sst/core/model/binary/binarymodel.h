@@ -0,0 +1,63 @@
+// -*- c++ -*-
+
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_MODEL_BINARY_BINARYMODEL_H
+#define SST_CORE_MODEL_BINARY_BINARYMODEL_H
+
+#include "sst/core/config.h"
+#include "sst/core/configGraph.h"
+#include "sst/core/model/sstmodel.h"
+#include "sst/core/output.h"
+
+#include <string>
+
+namespace SST {
+namespace Core {
+
+/**
+ * Loads a graph snapshot written with --output-binary.  The file is
+ * mapped into memory and unpacked directly into a ConfigGraph, so no
+ * input language has to be parsed or executed.
+ */
+class SSTBinaryModelDefinition : public SSTModelDescription
+{
+public:
+    SST_ELI_REGISTER_MODEL_DESCRIPTION(
+          SST::Core::SSTBinaryModelDefinition,
+          "sst",
+          "model.binary",
+          SST_ELI_ELEMENT_VERSION(1,0,0),
+          "Binary graph snapshot model for reloading SST simulation graphs",
+          true)
+
+    SST_ELI_DOCUMENT_MODEL_SUPPORTED_EXTENSIONS(".sstgraph")
+
+    SSTBinaryModelDefinition(const std::string& script_file, int verbosity, Config* config, double start_time);
+    virtual ~SSTBinaryModelDefinition();
+
+    ConfigGraph* createConfigGraph() override;
+
+    /** Set whether the program options in the snapshot are applied
+     * when it is loaded.  Defaults to true. */
+    void setLoadProgramOptions(bool load) { loadProgramOptions = load; }
+
+protected:
+    std::string fileName;
+    Output*     output;
+    bool        loadProgramOptions;
+};
+
+} // namespace Core
+} // namespace SST
+
+#endif // SST_CORE_MODEL_BINARY_BINARYMODEL_H
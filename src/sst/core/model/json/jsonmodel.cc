@@ -30,7 +30,11 @@ SSTJSONModelDefinition::SSTJSONModelDefinition(
     config(configObj),
     graph(nullptr),
     nextComponentId(0),
-    start_time(start_time)
+    start_time(start_time),
+    foundComponents(false),
+    foundLinks(false),
+    componentsDone(false),
+    shardedLoad(configObj->parallel_load() && configObj->parallel_load_mode_multi() && configObj->num_ranks() > 1)
 {
     output = new Output("SSTJSONModel: ", verbosity, 0, SST::Output::STDOUT);
 
@@ -128,7 +132,7 @@ SSTJSONModelDefinition::recursiveSubcomponent(ConfigComponent* Parent, const nlo
 }
 
 void
-SSTJSONModelDefinition::discoverComponents(const json& jFile)
+SSTJSONModelDefinition::discoverComponent(const json& compArray)
 {
     std::string      Name;
     std::string      Type;
@@ -137,69 +141,81 @@ SSTJSONModelDefinition::discoverComponents(const json& jFile)
     uint32_t         rank   = 0;
     uint32_t         thread = 0;
 
-    if ( !jFile.contains("components") ) {
-        output->fatal(CALL_INFO, 1, "Error, no \"components\" section in json file: %s\n", scriptName.c_str());
+    // -- Name
+    auto x = compArray.find("name");
+    if ( x != compArray.end() ) { Name = x.value(); }
+    else {
+        output->fatal(CALL_INFO, 1, "Error discovering component name from script: %s\n", scriptName.c_str());
     }
 
-    for ( auto& compArray : jFile["components"] ) {
-        // -- Name
-        auto x = compArray.find("name");
-        if ( x != compArray.end() ) { Name = x.value(); }
-        else {
-            output->fatal(CALL_INFO, 1, "Error discovering component name from script: %s\n", scriptName.c_str());
-        }
-
-        // -- Type
-        x = compArray.find("type");
-        if ( x != compArray.end() ) { Type = x.value(); }
-        else {
-            output->fatal(CALL_INFO, 1, "Error discovering component type from script: %s\n", scriptName.c_str());
-        }
+    // -- Type
+    x = compArray.find("type");
+    if ( x != compArray.end() ) { Type = x.value(); }
+    else {
+        output->fatal(CALL_INFO, 1, "Error discovering component type from script: %s\n", scriptName.c_str());
+    }
 
-        // Add the component so we have the ComponentID
-        Id = graph->addComponent(Name, Type);
+    // Add the component so we have the ComponentID
+    Id = graph->addComponent(Name, Type);
 
-        Comp = graph->findComponent(Id);
+    Comp = graph->findComponent(Id);
 
-        // read all the parameters
-        if ( compArray.contains("params") ) {
-            for ( auto& paramArray : compArray["params"].items() ) {
-                Comp->addParameter(paramArray.key(), paramArray.value(), false);
-            }
+    // read all the parameters
+    x = compArray.find("params");
+    if ( x != compArray.end() ) {
+        for ( auto& paramArray : x->items() ) {
+            Comp->addParameter(paramArray.key(), paramArray.value(), false);
         }
+    }
 
-        // read all the global parameters
-        if ( compArray.contains("params_global_sets") ) {
-            for ( auto& globalArray : compArray["params_global_sets"].items() ) {
-                Comp->addGlobalParamSet(globalArray.value().get<std::string>());
-            }
+    // read all the global parameters
+    x = compArray.find("params_global_sets");
+    if ( x != compArray.end() ) {
+        for ( auto& globalArray : x->items() ) {
+            Comp->addGlobalParamSet(globalArray.value().get<std::string>());
         }
+    }
 
-        // read the partition info
-        if ( compArray.contains("partition") ) {
-            for ( auto& partArray : compArray["partition"].items() ) {
-                if ( partArray.key() == "rank" ) { rank = partArray.value(); }
-                else if ( partArray.key() == "thread" ) {
-                    thread = partArray.value();
-                }
+    // read the partition info
+    x = compArray.find("partition");
+    if ( x != compArray.end() ) {
+        for ( auto& partArray : x->items() ) {
+            if ( partArray.key() == "rank" ) { rank = partArray.value(); }
+            else if ( partArray.key() == "thread" ) {
+                thread = partArray.value();
             }
         }
+    }
 
-        // set the rank information
-        RankInfo Rank(rank, thread);
-        Comp->setRank(Rank);
+    // A MULTI load is not partitioned again, so each component in a
+    // shard must say which rank it is on.  Components from other ranks
+    // are the stubs that the cross rank links connect to.
+    if ( shardedLoad ) {
+        if ( x == compArray.end() ) {
+            output->fatal(
+                CALL_INFO, 1,
+                "Error, component %s has no partition info in %s.  Files for --parallel-load=MULTI must be "
+                "written with --parallel-output\n",
+                Name.c_str(), scriptName.c_str());
+        }
+        if ( rank >= config->num_ranks() ) {
+            output->fatal(
+                CALL_INFO, 1,
+                "Error, component %s in %s is on rank %" PRIu32 ", but the simulation only has %" PRIu32 " ranks\n",
+                Name.c_str(), scriptName.c_str(), rank, config->num_ranks());
+        }
+    }
 
-        // recursively read the subcomponents
-        recursiveSubcomponent(Comp, compArray);
+    // set the rank information
+    RankInfo Rank(rank, thread);
+    Comp->setRank(Rank);
 
-        // reset the variables
-        Id   = -1;
-        Comp = nullptr;
-    }
+    // recursively read the subcomponents
+    recursiveSubcomponent(Comp, compArray);
 }
 
 void
-SSTJSONModelDefinition::discoverLinks(const json& jFile)
+SSTJSONModelDefinition::discoverLink(const json& linkArray)
 {
     std::string   Name;
     std::string   Comp[2];
@@ -208,64 +224,58 @@ SSTJSONModelDefinition::discoverLinks(const json& jFile)
     bool          NoCut = false;
     ComponentId_t LinkID;
 
-    if ( !jFile.contains("links") ) {
-        output->fatal(CALL_INFO, 1, "Error, no \"links\" section in json file: %s\n", scriptName.c_str());
+    // -- Name
+    auto x = linkArray.find("name");
+    if ( x != linkArray.end() ) { Name = x.value(); }
+    else {
+        output->fatal(CALL_INFO, 1, "Error discovering link name from script: %s\n", scriptName.c_str());
     }
 
-    for ( auto& linkArray : jFile["links"] ) {
-        // -- Name
-        auto x = linkArray.find("name");
-        if ( x != linkArray.end() ) { Name = x.value(); }
-        else {
-            output->fatal(CALL_INFO, 1, "Error discovering link name from script: %s\n", scriptName.c_str());
+    // -- NoCut
+    x = linkArray.find("noCut");
+    if ( x != linkArray.end() ) { NoCut = x.value(); }
+    else {
+        NoCut = false;
+    }
+
+    // -- Components
+    std::string sides[2] = { "left", "right" };
+    for ( int i = 0; i < 2; ++i ) {
+        auto side = linkArray.find(sides[i]);
+        if ( side == linkArray.end() ) {
+            output->fatal(
+                CALL_INFO, 1, "Error discovering %s link component for Link=%s from script: %s\n", sides[i].c_str(),
+                Name.c_str(), scriptName.c_str());
         }
 
-        // -- NoCut
-        x = linkArray.find("noCut");
-        if ( x != linkArray.end() ) { NoCut = x.value(); }
+        auto item = side->find("component");
+        if ( item != side->end() ) { Comp[i] = item.value(); }
         else {
-            NoCut = false;
+            output->fatal(
+                CALL_INFO, 1, "Error finding component field of %s link component for Link=%s from script: %s\n",
+                sides[i].c_str(), Name.c_str(), scriptName.c_str());
         }
 
-        // -- Components
-        std::string sides[2] = { "left", "right" };
-        for ( int i = 0; i < 2; ++i ) {
-            auto side = linkArray.find(sides[i]);
-            if ( side == linkArray.end() ) {
-                output->fatal(
-                    CALL_INFO, 1, "Error discovering %s link component for Link=%s from script: %s\n", sides[i].c_str(),
-                    Name.c_str(), scriptName.c_str());
-            }
-
-            auto item = side->find("component");
-            if ( item != side->end() ) { Comp[i] = item.value(); }
-            else {
-                output->fatal(
-                    CALL_INFO, 1, "Error finding component field of %s link component for Link=%s from script: %s\n",
-                    sides[i].c_str(), Name.c_str(), scriptName.c_str());
-            }
-
-            // -- Port
-            item = side->find("port");
-            if ( item != side->end() ) { Port[i] = item.value(); }
-            else {
-                output->fatal(
-                    CALL_INFO, 1, "Error finding port field of %s link component for Link=%s from script: %s\n",
-                    sides[i].c_str(), Name.c_str(), scriptName.c_str());
-            }
-
-            // -- Latency
-            item = side->find("latency");
-            if ( item != side->end() ) { Latency[i] = item.value(); }
-            else {
-                output->fatal(
-                    CALL_INFO, 1, "Error finding latency field of %s link component for Link=%s from script: %s\n",
-                    sides[i].c_str(), Name.c_str(), scriptName.c_str());
-            }
+        // -- Port
+        item = side->find("port");
+        if ( item != side->end() ) { Port[i] = item.value(); }
+        else {
+            output->fatal(
+                CALL_INFO, 1, "Error finding port field of %s link component for Link=%s from script: %s\n",
+                sides[i].c_str(), Name.c_str(), scriptName.c_str());
+        }
 
-            LinkID = findComponentIdByName(Comp[i]);
-            graph->addLink(LinkID, Name, Port[i], Latency[i], NoCut);
+        // -- Latency
+        item = side->find("latency");
+        if ( item != side->end() ) { Latency[i] = item.value(); }
+        else {
+            output->fatal(
+                CALL_INFO, 1, "Error finding latency field of %s link component for Link=%s from script: %s\n",
+                sides[i].c_str(), Name.c_str(), scriptName.c_str());
         }
+
+        LinkID = findComponentIdByName(Comp[i]);
+        graph->addLink(LinkID, Name, Port[i], Latency[i], NoCut);
     }
 }
 
@@ -294,6 +304,41 @@ SSTJSONModelDefinition::discoverGlobalParams(const json& jFile)
     }
 }
 
+bool
+SSTJSONModelDefinition::parseCallback(int depth, json::parse_event_t event, json& parsed)
+{
+    // Track which top level section is being read
+    if ( depth == 1 ) {
+        if ( event == json::parse_event_t::key ) {
+            section = parsed.get<std::string>();
+            if ( section == "components" ) foundComponents = true;
+            if ( section == "links" ) foundLinks = true;
+        }
+        else if ( event == json::parse_event_t::array_end && section == "components" ) {
+            componentsDone = true;
+        }
+        return true;
+    }
+
+    // Entries of the components and links arrays are added to the
+    // graph as soon as they are complete, then dropped from the
+    // document
+    if ( depth != 2 || event != json::parse_event_t::object_end ) return true;
+
+    if ( section == "components" ) {
+        discoverComponent(parsed);
+        return false;
+    }
+    if ( section == "links" ) {
+        if ( componentsDone ) { discoverLink(parsed); }
+        else {
+            pendingLinks.push_back(std::move(parsed));
+        }
+        return false;
+    }
+    return true;
+}
+
 ConfigGraph*
 SSTJSONModelDefinition::createConfigGraph()
 {
@@ -304,24 +349,35 @@ SSTJSONModelDefinition::createConfigGraph()
         return nullptr;
     }
 
-    // create parsed json object
-    json jFile = json::parse(ifs);
+    // parse the file, building the components and links as they are
+    // read.  Only the program options and global params are left in
+    // the parsed json object.
+    json jFile = json::parse(ifs, [this](int depth, json::parse_event_t event, json& parsed) {
+        return parseCallback(depth, event, parsed);
+    });
 
     // close the file
     ifs.close();
 
+    if ( !foundComponents ) {
+        output->fatal(CALL_INFO, 1, "Error, no \"components\" section in json file: %s\n", scriptName.c_str());
+    }
+    if ( !foundLinks ) {
+        output->fatal(CALL_INFO, 1, "Error, no \"links\" section in json file: %s\n", scriptName.c_str());
+    }
+
+    // add any links that came before the components
+    for ( auto& link : pendingLinks ) {
+        discoverLink(link);
+    }
+    pendingLinks.clear();
+
     // discover all the globals
     discoverProgramOptions(jFile);
 
     // discover the global parameters
     discoverGlobalParams(jFile);
 
-    // discover the components
-    discoverComponents(jFile);
-
-    // discover the links
-    discoverLinks(jFile);
-
     // TODO: discover statistics
 
     return graph;
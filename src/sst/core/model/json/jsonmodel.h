@@ -39,6 +39,24 @@ using json = nlohmann::json;
 namespace SST {
 namespace Core {
 
+/**
+   Builds the ConfigGraph from a JSON file.
+
+   The file is parsed as a stream: each entry of the "components" and
+   "links" sections is added to the graph as soon as it has been read
+   and is then dropped, so the whole file is never held in memory.
+   Only the small "program_options" and "global_params" sections are
+   kept until the end of the parse.  Links that appear in the file
+   before the components they connect are held until the components
+   have been read.
+
+   For parallel loads in MULTI mode, each rank reads only its own
+   shard, as written by --parallel-output.  A shard holds the rank's
+   components and links plus a stub (name, type, subcomponents and
+   partition, but no params) for each remote component that one of
+   those links connects to.  The graph is not partitioned again, so
+   every component in a shard must have partition info.
+ */
 class SSTJSONModelDefinition : public SSTModelDescription
 {
 public:
@@ -66,12 +84,23 @@ protected:
     double        start_time;
 
 private:
+    /** Called by the parser for each parse event, adds the
+     * components and links to the graph as they complete */
+    bool parseCallback(int depth, json::parse_event_t event, json& parsed);
+
     void          recursiveSubcomponent(ConfigComponent* Parent, const nlohmann::basic_json<>& compArray);
     void          discoverProgramOptions(const json& jFile);
-    void          discoverComponents(const json& jFile);
-    void          discoverLinks(const json& jFile);
+    void          discoverComponent(const json& compArray);
+    void          discoverLink(const json& linkArray);
     void          discoverGlobalParams(const json& jFile);
     ComponentId_t findComponentIdByName(const std::string& Name);
+
+    std::string       section;         /*!< Top level section being parsed */
+    bool              foundComponents; /*!< "components" section has been seen */
+    bool              foundLinks;      /*!< "links" section has been seen */
+    bool              componentsDone;  /*!< "components" section has been fully read */
+    std::vector<json> pendingLinks;    /*!< Links read before the components */
+    bool              shardedLoad;     /*!< Reading one rank's shard for --parallel-load=MULTI */
 };
 
 } // namespace Core
@@ -20,8 +20,10 @@
 #include "sst/core/cputimer.h"
 #include "sst/core/factory.h"
 #include "sst/core/memuse.h"
+#include "sst/core/model/binary/binarymodel.h"
 #include "sst/core/model/element_python.h"
 #include "sst/core/model/python/pymacros.h"
+#include "sst/core/model/python/pymodel_cache.h"
 #include "sst/core/model/python/pymodel_comp.h"
 #include "sst/core/model/python/pymodel_link.h"
 #include "sst/core/model/python/pymodel_stat.h"
@@ -29,6 +31,7 @@
 #include "sst/core/model/python/pymodel_unitalgebra.h"
 #include "sst/core/simulation_impl.h"
 #include "sst/core/sst_types.h"
+#include "sst/core/topologyBuilder.h"
 #include "sst/core/warnmacros.h"
 
 DISABLE_WARN_DEPRECATED_REGISTER
@@ -41,7 +44,9 @@ DISABLE_WARN_MISSING_OVERRIDE
 REENABLE_WARNING
 #endif
 
+#include <algorithm>
 #include <string>
+#include <vector>
 
 DISABLE_WARN_STRICT_ALIASING
 
@@ -263,6 +268,266 @@ findComponentByName(PyObject* UNUSED(self), PyObject* args)
     return Py_None;
 }
 
+// Gets the string form of an object, as the __str__ function would
+static bool
+getString(PyObject* obj, std::string& str)
+{
+    PyObject* pstr = PyObject_Str(obj);
+    if ( nullptr == pstr ) return false;
+    const char* cstr = SST_ConvertToCppString(pstr);
+    if ( nullptr != cstr ) str = cstr;
+    Py_DECREF(pstr);
+    return nullptr != cstr;
+}
+
+// Argument to the bulk functions that is either a single value used
+// for every entry or a sequence with one value per entry
+class BulkStringArg
+{
+public:
+    BulkStringArg() : seq(nullptr) {}
+    ~BulkStringArg() { Py_XDECREF(seq); }
+
+    bool init(PyObject* obj, Py_ssize_t count, const char* arg_name)
+    {
+        if ( PyUnicode_Check(obj) || !PySequence_Check(obj) ) {
+            // Single value used for all entries
+            return getString(obj, value);
+        }
+        seq = PySequence_Fast(obj, arg_name);
+        if ( nullptr == seq ) return false;
+        if ( PySequence_Fast_GET_SIZE(seq) != count ) {
+            PyErr_Format(PyExc_ValueError, "%s must have the same length as names", arg_name);
+            return false;
+        }
+        return true;
+    }
+
+    bool get(Py_ssize_t index, std::string& str) const
+    {
+        if ( nullptr == seq ) {
+            str = value;
+            return true;
+        }
+        return getString(PySequence_Fast_GET_ITEM(seq, index), str);
+    }
+
+private:
+    PyObject*   seq;
+    std::string value;
+};
+
+// Gets the component ids for a bulk connect.  The components are
+// either a buffer of 64-bit ids (array.array('Q'), a numpy uint64
+// array, ...), which is read directly, or a sequence of Component and
+// SubComponent objects and ids.
+static bool
+getComponentIds(PyObject* obj, Py_ssize_t count, const char* arg_name, std::vector<ComponentId_t>& ids)
+{
+    ids.clear();
+    if ( PyObject_CheckBuffer(obj) ) {
+        Py_buffer view;
+        if ( 0 == PyObject_GetBuffer(obj, &view, PyBUF_FORMAT | PyBUF_C_CONTIGUOUS) ) {
+            const char* fmt = view.format ? view.format + strlen(view.format) - 1 : "B";
+            if ( view.ndim == 1 && view.itemsize == sizeof(ComponentId_t) && strchr("QqLl", *fmt) ) {
+                const ComponentId_t* data = static_cast<const ComponentId_t*>(view.buf);
+                ids.assign(data, data + view.len / view.itemsize);
+            }
+            PyBuffer_Release(&view);
+        }
+        else {
+            PyErr_Clear();
+        }
+    }
+
+    if ( ids.empty() ) {
+        PyObject* seq = PySequence_Fast(obj, arg_name);
+        if ( nullptr == seq ) return false;
+        Py_ssize_t size = PySequence_Fast_GET_SIZE(seq);
+        ids.reserve(size);
+        for ( Py_ssize_t i = 0; i < size; ++i ) {
+            PyObject* item = PySequence_Fast_GET_ITEM(seq, i);
+            if ( PyObject_TypeCheck(item, &PyModel_ComponentType) ||
+                 PyObject_TypeCheck(item, &PyModel_SubComponentType) ) {
+                ids.push_back(((ComponentPy_t*)item)->obj->getID());
+            }
+            else if ( PyLong_Check(item) ) {
+                ids.push_back(PyLong_AsUnsignedLongLong(item));
+            }
+            else {
+                PyErr_Format(PyExc_TypeError, "%s must contain Components, SubComponents or component ids", arg_name);
+                Py_DECREF(seq);
+                return false;
+            }
+        }
+        Py_DECREF(seq);
+        if ( PyErr_Occurred() ) return false;
+    }
+
+    if ( (Py_ssize_t)ids.size() != count ) {
+        PyErr_Format(PyExc_ValueError, "%s must have the same length as names", arg_name);
+        return false;
+    }
+    for ( auto id : ids ) {
+        if ( !gModel->getGraph()->containsComponent(COMPONENT_ID_MASK(id)) ||
+             nullptr == gModel->getGraph()->findComponent(id) ) {
+            PyErr_Format(PyExc_ValueError, "%s contains an unknown component id %" PRIu64, arg_name, id);
+            return false;
+        }
+    }
+    return true;
+}
+
+static PyObject*
+createComponents(PyObject* UNUSED(self), PyObject* args)
+{
+    char*     type;
+    PyObject* names;
+    PyObject* params = nullptr;
+    if ( !PyArg_ParseTuple(args, "sO|O", &type, &names, &params) ) return nullptr;
+
+    if ( nullptr != params && Py_None != params && !PyDict_Check(params) ) {
+        PyErr_SetString(PyExc_TypeError, "params must be a dict");
+        return nullptr;
+    }
+
+    // The parameters are the same for every component, so only
+    // convert them once
+    std::vector<std::pair<std::string, std::string>> param_list;
+    if ( nullptr != params && Py_None != params ) {
+        Py_ssize_t pos = 0;
+        PyObject * key, *val;
+        while ( PyDict_Next(params, &pos, &key, &val) ) {
+            std::string kstr, vstr;
+            if ( !getString(key, kstr) || !getString(val, vstr) ) return nullptr;
+            param_list.emplace_back(kstr, vstr);
+        }
+    }
+
+    PyObject* seq = PySequence_Fast(names, "names must be a sequence of strings");
+    if ( nullptr == seq ) return nullptr;
+    Py_ssize_t count = PySequence_Fast_GET_SIZE(seq);
+    PyObject*  ret   = PyList_New(count);
+
+    for ( Py_ssize_t i = 0; i < count; ++i ) {
+        std::string name;
+        if ( !getString(PySequence_Fast_GET_ITEM(seq, i), name) ) {
+            Py_DECREF(ret);
+            Py_DECREF(seq);
+            return nullptr;
+        }
+
+        char*         prefixed_name = gModel->addNamePrefix(name.c_str());
+        ComponentId_t id            = gModel->addComponent(prefixed_name, type);
+        free(prefixed_name);
+
+        ConfigComponent* cc = gModel->getGraph()->findComponent(id);
+        for ( auto& p : param_list ) {
+            cc->addParameter(p.first, p.second, true);
+        }
+
+        // Build the Python object directly rather than going through
+        // Component() so the name is not parsed and looked up again
+        ComponentPy_t* comp = (ComponentPy_t*)PyModel_ComponentType.tp_alloc(&PyModel_ComponentType, 0);
+        comp->obj           = new PyComponent(comp, id);
+        PyList_SET_ITEM(ret, i, (PyObject*)comp);
+    }
+    Py_DECREF(seq);
+
+    gModel->getOutput()->verbose(
+        CALL_INFO, 3, 0, "Created %zd components of type [%s]\n", (ssize_t)count, type);
+    return ret;
+}
+
+static PyObject*
+connectLinks(PyObject* UNUSED(self), PyObject* args)
+{
+    PyObject *names, *comps0, *ports0, *comps1, *ports1, *latency;
+    if ( !PyArg_ParseTuple(args, "OOOOOO", &names, &comps0, &ports0, &comps1, &ports1, &latency) ) return nullptr;
+
+    PyObject* seq = PySequence_Fast(names, "names must be a sequence of strings");
+    if ( nullptr == seq ) return nullptr;
+    Py_ssize_t count = PySequence_Fast_GET_SIZE(seq);
+
+    std::vector<ComponentId_t> ids0, ids1;
+    BulkStringArg              p0, p1, lat;
+    if ( !getComponentIds(comps0, count, "comps0", ids0) || !getComponentIds(comps1, count, "comps1", ids1) ||
+         !p0.init(ports0, count, "ports0") || !p1.init(ports1, count, "ports1") ||
+         !lat.init(latency, count, "latency") ) {
+        Py_DECREF(seq);
+        return nullptr;
+    }
+
+    std::string name, port0, port1, lat_str;
+    for ( Py_ssize_t i = 0; i < count; ++i ) {
+        if ( !getString(PySequence_Fast_GET_ITEM(seq, i), name) || !p0.get(i, port0) || !p1.get(i, port1) ||
+             !lat.get(i, lat_str) ) {
+            Py_DECREF(seq);
+            return nullptr;
+        }
+
+        char* prefixed_name = gModel->addNamePrefix(name.c_str());
+        gModel->addLink(ids0[i], prefixed_name, port0.c_str(), lat_str.c_str(), false);
+        gModel->addLink(ids1[i], prefixed_name, port1.c_str(), lat_str.c_str(), false);
+        free(prefixed_name);
+    }
+    Py_DECREF(seq);
+
+    gModel->getOutput()->verbose(CALL_INFO, 3, 0, "Connected %zd links\n", (ssize_t)count);
+    return SST_ConvertToPythonLong(count);
+}
+
+static PyObject*
+buildTopology(PyObject* UNUSED(self), PyObject* args)
+{
+    char*     type;
+    PyObject* params = nullptr;
+    if ( !PyArg_ParseTuple(args, "s|O", &type, &params) ) return nullptr;
+
+    if ( nullptr != params && Py_None != params && !PyDict_Check(params) ) {
+        PyErr_SetString(PyExc_TypeError, "params must be a dict");
+        return nullptr;
+    }
+
+    // Under a parallel load every rank runs the model and builds only
+    // its own part.  A replicated load builds everything and then
+    // partitions it like a serial load.
+    Config*  cfg           = gModel->getConfig();
+    bool     parallel_load = cfg->parallel_load() && !cfg->parallel_load_mode_replicate();
+    RankInfo world_size(cfg->num_ranks(), cfg->num_threads());
+    int      my_rank = 0;
+#ifdef SST_CONFIG_HAVE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+#endif
+
+    Params           p       = SST::Core::pythonToCppParams(params);
+    TopologyBuilder* builder = Factory::getFactory()->CreateWithParams<TopologyBuilder>(type, p, p);
+
+    char*    prefix = gModel->addNamePrefix("");
+    uint64_t count  = builder->populate(gModel->getGraph(), prefix, parallel_load, world_size, RankInfo(my_rank, 0));
+    free(prefix);
+    delete builder;
+
+    gModel->getOutput()->verbose(
+        CALL_INFO, 3, 0, "Built %" PRIu64 " components with topology builder [%s]\n", count, type);
+    return SST_ConvertToPythonLong(count);
+}
+
+static PyObject*
+cacheGraph(PyObject* UNUSED(self), PyObject* args)
+{
+    Py_ssize_t count = PyTuple_Size(args);
+    if ( count < 1 || !PyCallable_Check(PyTuple_GetItem(args, 0)) ) {
+        PyErr_SetString(PyExc_TypeError, "cacheGraph() takes a function that builds the graph, followed by its inputs");
+        return nullptr;
+    }
+
+    PyObject* inputs = PyTuple_GetSlice(args, 1, count);
+    PyObject* ret    = gModel->cacheGraph(PyTuple_GetItem(args, 0), inputs);
+    Py_DECREF(inputs);
+    return ret;
+}
+
 static PyObject*
 setProgramOption(PyObject* UNUSED(self), PyObject* args)
 {
@@ -306,11 +571,20 @@ getProgramOptions(PyObject* UNUSED(self), PyObject* UNUSED(args))
     PyDict_SetItem(dict, SST_ConvertToPythonString("num-ranks"), SST_ConvertToPythonLong(cfg->num_ranks()));
     PyDict_SetItem(dict, SST_ConvertToPythonString("num-threads"), SST_ConvertToPythonLong(cfg->num_threads()));
     PyDict_SetItem(dict, SST_ConvertToPythonString("sdl-file"), SST_ConvertToPythonString(cfg->configFile().c_str()));
+    PyDict_SetItem(
+        dict, SST_ConvertToPythonString("model-cache"), SST_ConvertToPythonString(cfg->model_cache().c_str()));
+    PyDict_SetItem(
+        dict, SST_ConvertToPythonString("model-cache-key"), SST_ConvertToPythonString(cfg->model_cache_key().c_str()));
     PyDict_SetItem(dict, SST_ConvertToPythonString("print-timing-info"), SST_ConvertToPythonBool(cfg->print_timing()));
     PyDict_SetItem(dict, SST_ConvertToPythonString("stop-at"), SST_ConvertToPythonString(cfg->stop_at().c_str()));
     PyDict_SetItem(dict, SST_ConvertToPythonString("exit-after"), SST_ConvertToPythonLong(cfg->exit_after()));
     PyDict_SetItem(
         dict, SST_ConvertToPythonString("partitioner"), SST_ConvertToPythonString(cfg->partitioner().c_str()));
+    PyDict_SetItem(
+        dict, SST_ConvertToPythonString("partition-weights"),
+        SST_ConvertToPythonString(cfg->partition_weights().c_str()));
+    PyDict_SetItem(
+        dict, SST_ConvertToPythonString("partition-cache"), SST_ConvertToPythonString(cfg->partition_cache().c_str()));
     PyDict_SetItem(
         dict, SST_ConvertToPythonString("heartbeat-period"), SST_ConvertToPythonString(cfg->heartbeatPeriod().c_str()));
     PyDict_SetItem(
@@ -326,6 +600,8 @@ getProgramOptions(PyObject* UNUSED(self), PyObject* UNUSED(args))
         SST_ConvertToPythonString(cfg->output_config_graph().c_str()));
     PyDict_SetItem(
         dict, SST_ConvertToPythonString("output-json"), SST_ConvertToPythonString(cfg->output_json().c_str()));
+    PyDict_SetItem(
+        dict, SST_ConvertToPythonString("output-binary"), SST_ConvertToPythonString(cfg->output_binary().c_str()));
     PyDict_SetItem(dict, SST_ConvertToPythonString("parallel-output"), SST_ConvertToPythonBool(cfg->parallel_output()));
 
     // Graph output options
@@ -343,6 +619,23 @@ getProgramOptions(PyObject* UNUSED(self), PyObject* UNUSED(args))
         dict, SST_ConvertToPythonString("time-vortex"), SST_ConvertToPythonString(cfg->timeVortex().c_str()));
     PyDict_SetItem(
         dict, SST_ConvertToPythonString("interthread-links"), SST_ConvertToPythonBool(cfg->interthread_links()));
+    PyDict_SetItem(
+        dict, SST_ConvertToPythonString("interthread-lookahead"),
+        SST_ConvertToPythonBool(cfg->interthread_lookahead()));
+    PyDict_SetItem(
+        dict, SST_ConvertToPythonString("direct-delivery"), SST_ConvertToPythonBool(cfg->direct_delivery()));
+    PyDict_SetItem(
+        dict, SST_ConvertToPythonString("tight-clock-loop"), SST_ConvertToPythonBool(cfg->tight_clock_loop()));
+    PyDict_SetItem(
+        dict, SST_ConvertToPythonString("sync-compress-threshold"),
+        SST_ConvertToPythonLong(cfg->sync_compress_threshold()));
+    PyDict_SetItem(
+        dict, SST_ConvertToPythonString("construct-threads"), SST_ConvertToPythonLong(cfg->construct_threads()));
+    PyDict_SetItem(
+        dict, SST_ConvertToPythonString("active-untimed-phases"),
+        SST_ConvertToPythonBool(cfg->active_untimed_phases()));
+    PyDict_SetItem(
+        dict, SST_ConvertToPythonString("deferred-file-output"), SST_ConvertToPythonBool(cfg->deferred_file_output()));
     PyDict_SetItem(dict, SST_ConvertToPythonString("debug-file"), SST_ConvertToPythonString(cfg->debugFile().c_str()));
     PyDict_SetItem(dict, SST_ConvertToPythonString("lib-path"), SST_ConvertToPythonString(cfg->libpath().c_str()));
     PyDict_SetItem(
@@ -361,6 +654,8 @@ getProgramOptions(PyObject* UNUSED(self), PyObject* UNUSED(args))
     PyDict_SetItem(
         dict, SST_ConvertToPythonString("output-undeleted-events"),
         SST_ConvertToPythonString(cfg->event_dump_file().c_str()));
+    PyDict_SetItem(
+        dict, SST_ConvertToPythonString("print-mempool-stats"), SST_ConvertToPythonBool(cfg->print_mempool_stats()));
 #endif
     PyDict_SetItem(
         dict, SST_ConvertToPythonString("force-rank-seq-startup"), SST_ConvertToPythonBool(cfg->rank_seq_startup()));
@@ -519,8 +814,10 @@ enableAllStatisticsForAllComponents(PyObject* UNUSED(self), PyObject* args)
     argOK = PyArg_ParseTuple(args, "|O!", &PyDict_Type, &statParamDict);
 
     if ( argOK ) {
+        // All the components share the one copy of the params
+        auto params = pythonToCppParams(statParamDict);
         for ( auto cc : gModel->components() ) {
-            cc->enableStatistic(STATALLFLAG, pythonToCppParams(statParamDict), true /*recursive*/);
+            cc->enableStatistic(STATALLFLAG, params, true /*recursive*/);
         }
     }
     else {
@@ -873,6 +1170,40 @@ globalAddParams(PyObject* UNUSED(self), PyObject* args)
     return SST_ConvertToPythonLong(count);
 }
 
+static PyObject*
+addEnsembleVariant(PyObject* UNUSED(self), PyObject* arg)
+{
+    if ( !PyDict_Check(arg) ) {
+        PyErr_SetString(PyExc_TypeError, "variant must be a dict of global param set names to dicts of params");
+        return nullptr;
+    }
+
+    ConfigGraph::EnsembleVariant variant;
+    Py_ssize_t                   pos = 0;
+    PyObject *                   set, *params;
+    while ( PyDict_Next(arg, &pos, &set, &params) ) {
+        if ( !PyDict_Check(params) ) {
+            PyErr_SetString(PyExc_TypeError, "variant must be a dict of global param set names to dicts of params");
+            return nullptr;
+        }
+        PyObject* sstr = PyObject_CallMethod(set, (char*)"__str__", nullptr);
+        auto&     vals = variant[SST_ConvertToCppString(sstr)];
+        Py_XDECREF(sstr);
+
+        Py_ssize_t ppos = 0;
+        PyObject * key, *val;
+        while ( PyDict_Next(params, &ppos, &key, &val) ) {
+            PyObject* kstr = PyObject_CallMethod(key, (char*)"__str__", nullptr);
+            PyObject* vstr = PyObject_CallMethod(val, (char*)"__str__", nullptr);
+            vals[SST_ConvertToCppString(kstr)] = SST_ConvertToCppString(vstr);
+            Py_XDECREF(kstr);
+            Py_XDECREF(vstr);
+        }
+    }
+    gModel->addEnsembleVariant(variant);
+    return SST_ConvertToPythonLong(gModel->getGraph()->getEnsembleVariants().size() - 1);
+}
+
 static PyObject*
 getElapsedExecutionTime(PyObject* UNUSED(self), PyObject* UNUSED(args))
 {
@@ -943,8 +1274,29 @@ static PyMethodDef sstModuleMethods[] = {
     { "findComponentByName", findComponentByName, METH_O,
       "Looks up to find a previously created component/subcomponent, based off of its name.  Returns None if none "
       "are to be found." },
+    { "createComponents", createComponents, METH_VARARGS,
+      "Creates one component of the given type for each name in a list, all with the same optional dict of "
+      "parameters.  Returns the list of Components." },
+    { "connectLinks", connectLinks, METH_VARARGS,
+      "Creates and connects one link for each name in a list: connectLinks(names, comps0, ports0, comps1, ports1, "
+      "latency).  The components are lists of Components or component ids, or arrays of 64-bit ids.  The ports and "
+      "latency are either one value used for every link or a list with one value per link.  Returns the number of "
+      "links." },
+    { "buildTopology", buildTopology, METH_VARARGS,
+      "Adds the components and links of a topology from a topology builder in an element library: "
+      "buildTopology(type, params).  Under a parallel load, only the components on this rank are added.  Returns "
+      "the number of components added." },
+    { "cacheGraph", cacheGraph, METH_VARARGS,
+      "Calls build(*inputs) to add the components and links of the model: cacheGraph(build, *inputs).  With "
+      "--model-cache, a graph an earlier run built with the same function and inputs is loaded from the cache "
+      "instead, and the rest of the script, such as parameter overrides, runs on it as usual.  The function has to "
+      "get everything it depends on from its inputs, which should have a repr() that doesn't change from run to "
+      "run.  Must be called before anything is added to the graph.  Returns True if the graph came from the cache." },
     { "addGlobalParam", globalAddParam, METH_VARARGS, "Add a parameter to the specified global set." },
     { "addGlobalParams", globalAddParams, METH_VARARGS, "Add parameters in dictionary to the specified global set." },
+    { "addEnsembleVariant", addEnsembleVariant, METH_O,
+      "Adds a run to the ensemble of runs of the model, given as a dict of global param set names to dicts of the "
+      "params to set in them.  Returns the index of the run." },
     { "getElapsedExecutionTime", getElapsedExecutionTime, METH_NOARGS,
       "Gets the real elapsed time since simluation start, returned as a UnitAlgebra.  Not precise enough for "
       "getting fine timings.  For that, use the built-in time module." },
@@ -1099,7 +1451,9 @@ SSTPythonModelDefinition::SSTPythonModelDefinition(
     namePrefix(nullptr),
     namePrefixLen(0),
     start_time(start_time),
-    callPythonFinalize(false)
+    callPythonFinalize(false),
+    cache(nullptr),
+    graphCached(false)
 {
     std::vector<std::string> argv_vector;
     argv_vector.push_back("sstsim.x");
@@ -1160,27 +1514,157 @@ SSTPythonModelDefinition::SSTPythonModelDefinition(
     // Init the model
     initModel(script_file, verbosity, configObj, argc, argv);
 
+    if ( !configObj->model_cache().empty() ) cache = new PythonModelCache(configObj->model_cache(), output);
+
     // Free the vector
     free(argv);
 }
 
 SSTPythonModelDefinition::~SSTPythonModelDefinition()
 {
+    delete cache;
     delete output;
     gModel = nullptr;
 
     if ( nullptr != namePrefix ) free(namePrefix);
-    if ( callPythonFinalize ) { Py_Finalize(); }
+    if ( callPythonFinalize || config->release_build_memory() ) { Py_Finalize(); }
     else {
         PyGC_Collect();
     }
 }
 
+static int
+getMyRank()
+{
+    int myrank = 0;
+#ifdef SST_CONFIG_HAVE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &myrank);
+#endif
+    return myrank;
+}
+
+bool
+SSTPythonModelDefinition::loadCachedGraph(uint64_t key)
+{
+    std::map<std::string, std::string> options;
+    if ( !cache->lookup(key, options) ) return false;
+
+    // The program options in the snapshot include the command line of
+    // the run that saved it, so only the ones the model set are used
+    SSTBinaryModelDefinition loader(cache->snapshotName(key), output->getVerboseLevel(), config, start_time);
+    loader.setLoadProgramOptions(false);
+    ConfigGraph* cached = loader.createConfigGraph();
+    delete graph;
+    graph = cached;
+
+    // Components the script adds afterwards must not reuse the IDs of
+    // the loaded ones
+    for ( auto* comp : graph->getComponentMap() ) {
+        nextComponentId = std::max<ComponentId_t>(nextComponentId, COMPONENT_ID_MASK(comp->id) + 1);
+    }
+
+    for ( auto& x : options ) {
+        setConfigEntryFromModel(x.first, x.second);
+    }
+
+    // The model isn't run, so say which entry it came from in case the
+    // entry is stale
+    output->output(
+        "# Loaded %zu components from the model cache entry %s\n", graph->getNumComponents(),
+        cache->snapshotName(key).c_str());
+    return true;
+}
+
+PyObject*
+SSTPythonModelDefinition::cacheGraph(PyObject* build, PyObject* inputs)
+{
+    if ( graphCached ) {
+        PyErr_SetString(PyExc_RuntimeError, "cacheGraph() can only be called once");
+        return nullptr;
+    }
+    if ( graph->getNumComponents() != 0 ) {
+        PyErr_SetString(PyExc_RuntimeError, "cacheGraph() must be called before any components are added");
+        return nullptr;
+    }
+    graphCached = true;
+
+    // The key covers the source of the function and its inputs instead
+    // of the whole script, so the rest of the script can change
+    uint64_t key       = 0;
+    bool     use_cache = nullptr != cache;
+    if ( use_cache ) {
+        PyObject* source  = nullptr;
+        PyObject* inspect = PyImport_ImportModule("inspect");
+        if ( nullptr != inspect ) {
+            source = PyObject_CallMethod(inspect, "getsource", "O", build);
+            Py_DECREF(inspect);
+        }
+        if ( nullptr == source ) {
+            PyErr_Clear();
+            output->verbose(CALL_INFO, 1, 0, "Source of the cacheGraph() function not found, not caching the graph\n");
+            use_cache = false;
+        }
+
+        PyObject* input_repr = PyObject_Repr(inputs);
+        if ( nullptr == input_repr ) {
+            Py_XDECREF(source);
+            return nullptr;
+        }
+
+        if ( use_cache ) {
+            key = PythonModelCache::hash(PythonModelCache::baseKey(config, getMyRank()), "graph");
+            key = PythonModelCache::hash(key, SST_ConvertToCppString(source));
+            key = PythonModelCache::hash(key, SST_ConvertToCppString(input_repr));
+            for ( auto& file : cacheInputFiles ) {
+                use_cache = use_cache && PythonModelCache::hashFile(key, file);
+            }
+        }
+        Py_XDECREF(source);
+        Py_DECREF(input_repr);
+
+        if ( use_cache && loadCachedGraph(key) ) {
+            Py_RETURN_TRUE;
+        }
+    }
+
+    // Only the program options set by the function belong to the entry
+    std::map<std::string, std::string> earlier_options;
+    earlier_options.swap(modelOptions);
+
+    PyObject* ret = PyObject_Call(build, inputs, nullptr);
+    if ( nullptr != ret && use_cache ) cache->save(key, config, graph, modelOptions);
+
+    for ( auto& x : modelOptions ) {
+        earlier_options[x.first] = x.second;
+    }
+    modelOptions.swap(earlier_options);
+
+    if ( nullptr == ret ) return nullptr;
+    Py_DECREF(ret);
+    Py_RETURN_FALSE;
+}
+
 ConfigGraph*
 SSTPythonModelDefinition::createConfigGraph()
 {
     output->verbose(CALL_INFO, 1, 0, "Creating config graph for SST using Python model...\n");
 
+    // An unchanged model isn't run at all
+    uint64_t key       = 0;
+    bool     use_cache = nullptr != cache;
+    if ( use_cache ) {
+        key       = PythonModelCache::hash(PythonModelCache::baseKey(config, getMyRank()), "model");
+        key       = PythonModelCache::hash(key, config->model_options());
+        use_cache = PythonModelCache::hashFile(key, scriptName);
+        for ( auto& file : cacheInputFiles ) {
+            use_cache = use_cache && PythonModelCache::hashFile(key, file);
+        }
+
+        if ( use_cache && loadCachedGraph(key) ) {
+            return graph;
+        }
+    }
+
     FILE* fp = fopen(scriptName.c_str(), "r");
     if ( !fp ) { output->fatal(CALL_INFO, 1, "Unable to open python script %s\n", scriptName.c_str()); }
     int createReturn = PyRun_AnyFileEx(fp, scriptName.c_str(), 1);
@@ -1201,6 +1685,8 @@ SSTPythonModelDefinition::createConfigGraph()
         output->fatal(CALL_INFO, 1, "Error occured handling the creation of the component graph in Python.\n");
     }
 
+    if ( use_cache ) cache->save(key, config, graph, modelOptions);
+
     return graph;
 }
 
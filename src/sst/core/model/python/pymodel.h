@@ -38,6 +38,8 @@ using namespace SST;
 namespace SST {
 namespace Core {
 
+class PythonModelCache;
+
 class SSTPythonModelDefinition : public SSTModelDescription
 {
 public:
@@ -61,6 +63,7 @@ public:
 
 protected:
     void                initModel(const std::string& script_file, int verbosity, Config* config, int argc, char** argv);
+    bool                loadCachedGraph(uint64_t key);
     std::string         scriptName;
     Output*             output;
     Config*             config;
@@ -72,12 +75,18 @@ protected:
     ComponentId_t                        nextComponentId;
     double                               start_time;
     bool                                 callPythonFinalize;
+    PythonModelCache*                    cache;
+    std::map<std::string, std::string>   modelOptions;    // Program options set by the model
+    std::vector<std::string>             cacheInputFiles; // Read by the model, besides the script
+    bool                                 graphCached;
 
 public: /* Public, but private.  Called only from Python functions */
     Config* getConfig(void) const { return config; }
 
     bool setConfigEntryFromModel(const std::string& entryName, const std::string& value)
     {
+        // Kept to be restored when the graph is loaded from the cache
+        modelOptions[entryName] = value;
         return setOptionFromModel(entryName, value);
     }
 
@@ -117,6 +126,8 @@ public: /* Public, but private.  Called only from Python functions */
     }
     void setStatisticLoadLevel(uint8_t loadLevel) { graph->setStatisticLoadLevel(loadLevel); }
 
+    void addEnsembleVariant(const ConfigGraph::EnsembleVariant& variant) { graph->addEnsembleVariant(variant); }
+
     void addGlobalParameter(const char* set, const char* key, const char* value, bool overwrite)
     {
         insertGlobalParameter(set, key, value, overwrite);
@@ -126,6 +137,16 @@ public: /* Public, but private.  Called only from Python functions */
     UnitAlgebra getLocalMemoryUsage() const;
 
     void setCallPythonFinalize(bool state) { callPythonFinalize = state; }
+
+    /** Build the graph by calling build(*inputs), or load the graph an
+     * earlier call built with the same function and inputs from the
+     * model cache.  Sets a Python exception and returns nullptr on
+     * error, otherwise returns True if the graph was loaded. */
+    PyObject* cacheGraph(PyObject* build, PyObject* inputs);
+
+    /** Add a file, other than the script, that the graph depends on
+     * when the model is cached */
+    void addCacheInputFile(const std::string& file) { cacheInputFiles.push_back(file); }
 };
 
 // For xml inputs (.xml or .sdl), we just use a python script to parse
@@ -155,6 +176,7 @@ public:
 
         actual_model_ =
             new SSTPythonModelDefinition(SST_INSTALL_PREFIX "/libexec/xmlToPython.py", verbosity, config, start_time);
+        actual_model_->addCacheInputFile(script_file);
     }
 
     ConfigGraph* createConfigGraph() override { return actual_model_->createConfigGraph(); }
@@ -0,0 +1,242 @@
+// -*- c++ -*-
+
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/model/python/pymodel_cache.h"
+
+#include "sst/core/cfgoutput/binaryConfigOutput.h"
+#include "sst/core/model/python/pymacros.h"
+#include "sst/core/serialization/serializer.h"
+#include "sst/core/warnmacros.h"
+
+DISABLE_WARN_DEPRECATED_REGISTER
+#include <Python.h>
+REENABLE_WARNING
+
+#include <cerrno>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace SST;
+using namespace SST::Core;
+
+PythonModelCache::PythonModelCache(const std::string& dir, Output* output) : dir(dir), output(output)
+{
+    if ( mkdir(dir.c_str(), 0755) != 0 && errno != EEXIST ) {
+        output->output("WARNING: Unable to create model cache directory %s: %s\n", dir.c_str(), strerror(errno));
+    }
+}
+
+uint64_t
+PythonModelCache::hash(uint64_t key, const void* data, size_t len)
+{
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for ( size_t i = 0; i < len; i++ ) {
+        key ^= bytes[i];
+        key *= 1099511628211ull;
+    }
+    return key;
+}
+
+bool
+PythonModelCache::hashFile(uint64_t& key, const std::string& file)
+{
+    std::ifstream in(file, std::ios::binary);
+    if ( !in ) return false;
+
+    char buffer[65536];
+    while ( in ) {
+        in.read(buffer, sizeof(buffer));
+        key = hash(key, buffer, in.gcount());
+    }
+    return in.eof();
+}
+
+uint64_t
+PythonModelCache::baseKey(const Config* cfg, int rank)
+{
+    // The model can ask for any of these, and build a different graph
+    uint64_t key = hash(initial_key, PACKAGE_VERSION);
+    uint32_t num_ranks   = cfg->num_ranks();
+    uint32_t num_threads = cfg->num_threads();
+    key                  = hash(key, &num_ranks, sizeof(num_ranks));
+    key                  = hash(key, &num_threads, sizeof(num_threads));
+    key                  = hash(key, &rank, sizeof(rank));
+    key                  = hash(key, cfg->parallel_load_str());
+    key                  = hash(key, cfg->model_cache_key());
+    return key;
+}
+
+std::string
+PythonModelCache::entryName(uint64_t key, const char* ext) const
+{
+    char name[32];
+    snprintf(name, sizeof(name), "/%016" PRIx64 "%s", key, ext);
+    return dir + std::string(name);
+}
+
+std::string
+PythonModelCache::snapshotName(uint64_t key) const
+{
+    return entryName(key, ".sstgraph");
+}
+
+bool
+PythonModelCache::lookup(uint64_t key, std::map<std::string, std::string>& options)
+{
+    std::string   deps_name = entryName(key, ".deps");
+    std::ifstream in(deps_name, std::ios::binary);
+    if ( !in ) return false;
+
+    Header header;
+    in.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if ( !in || memcmp(header.magic, file_magic, sizeof(header.magic)) != 0 || header.version != file_version ) {
+        output->verbose(CALL_INFO, 1, 0, "Model cache entry %s is not valid, building the graph\n", deps_name.c_str());
+        return false;
+    }
+
+    std::vector<char> buffer(header.payload_size);
+    in.read(buffer.data(), buffer.size());
+    if ( !in ) {
+        output->verbose(CALL_INFO, 1, 0, "Model cache entry %s is truncated, building the graph\n", deps_name.c_str());
+        return false;
+    }
+
+    std::map<std::string, uint64_t>      files;
+    SST::Core::Serialization::serializer ser;
+    ser.start_unpacking(buffer.data(), buffer.size());
+    ser& options;
+    ser& files;
+
+    for ( auto& file : files ) {
+        uint64_t file_key = initial_key;
+        if ( !hashFile(file_key, file.first) || file_key != file.second ) {
+            output->verbose(
+                CALL_INFO, 1, 0, "Model cache entry %s is out of date, %s has changed\n", deps_name.c_str(),
+                file.first.c_str());
+            return false;
+        }
+    }
+
+    return access(snapshotName(key).c_str(), R_OK) == 0;
+}
+
+void
+PythonModelCache::save(
+    uint64_t key, const Config* cfg, ConfigGraph* graph, const std::map<std::string, std::string>& options)
+{
+    std::string deps_name = entryName(key, ".deps");
+
+    // Without the modules, changes to them wouldn't be noticed
+    std::vector<std::string> module_files;
+    if ( !getModuleFiles(module_files) ) {
+        output->output("WARNING: Unable to find the Python modules of model cache entry %s\n", deps_name.c_str());
+        return;
+    }
+    std::map<std::string, uint64_t> files;
+    for ( auto& file : module_files ) {
+        uint64_t file_key = initial_key;
+        if ( hashFile(file_key, file) ) files[file] = file_key;
+    }
+
+    std::string suffix    = ".tmp" + std::to_string(getpid());
+    std::string snap_name = snapshotName(key);
+    std::string snap_tmp  = snap_name + suffix;
+    std::string deps_tmp  = deps_name + suffix;
+
+    bool ok = true;
+    try {
+        BinaryConfigGraphOutput out(snap_tmp.c_str());
+        out.generate(cfg, graph);
+    }
+    catch ( ConfigGraphOutputException& ) {
+        ok = false;
+    }
+
+    if ( ok ) {
+        std::map<std::string, std::string>   opts = options;
+        SST::Core::Serialization::serializer ser;
+        ser.start_sizing();
+        ser& opts;
+        ser& files;
+
+        std::vector<char> buffer(ser.size());
+        ser.start_packing(buffer.data(), buffer.size());
+        ser& opts;
+        ser& files;
+
+        Header header;
+        memcpy(header.magic, file_magic, sizeof(header.magic));
+        header.version      = file_version;
+        header.reserved     = 0;
+        header.payload_size = buffer.size();
+
+        std::ofstream out(deps_tmp, std::ios::binary);
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(buffer.data(), buffer.size());
+        out.close();
+        ok = out && std::rename(snap_tmp.c_str(), snap_name.c_str()) == 0 &&
+             std::rename(deps_tmp.c_str(), deps_name.c_str()) == 0;
+    }
+
+    if ( !ok ) {
+        std::remove(snap_tmp.c_str());
+        std::remove(deps_tmp.c_str());
+        output->output("WARNING: Unable to write model cache entry %s\n", deps_name.c_str());
+        return;
+    }
+    output->verbose(CALL_INFO, 1, 0, "Saved the graph to model cache entry %s\n", deps_name.c_str());
+}
+
+bool
+PythonModelCache::getModuleFiles(std::vector<std::string>& files)
+{
+    // Modules from the Python installation (including any virtual
+    // environment) are left out, since they only change when Python
+    // packages are updated.  So is the script, which the caller
+    // covers in the key if the graph depends on all of it.
+    static const char* code =
+        "import os, sys\n"
+        "_prefixes = tuple(set(os.path.realpath(p) + os.sep for p in\n"
+        "                      (sys.prefix, sys.base_prefix, sys.exec_prefix, sys.base_exec_prefix)))\n"
+        "_files = set()\n"
+        "for _n, _m in list(sys.modules.items()):\n"
+        "    _f = getattr(_m, '__file__', None)\n"
+        "    if _n == '__main__': continue\n"
+        "    if isinstance(_f, str) and os.path.isfile(_f):\n"
+        "        _f = os.path.realpath(_f)\n"
+        "        if not _f.startswith(_prefixes): _files.add(_f)\n"
+        "files = sorted(_files)\n";
+
+    PyObject* globals = PyDict_New();
+    PyDict_SetItemString(globals, "__builtins__", PyEval_GetBuiltins());
+    PyObject* result = PyRun_String(code, Py_file_input, globals, globals);
+    PyObject* list   = PyDict_GetItemString(globals, "files");
+    bool      found  = nullptr != result && nullptr != list && PyList_Check(list);
+    if ( found ) {
+        for ( Py_ssize_t i = 0; i < PyList_Size(list); i++ ) {
+            files.push_back(SST_ConvertToCppString(PyList_GetItem(list, i)));
+        }
+    }
+    else {
+        PyErr_Clear();
+    }
+    Py_XDECREF(result);
+    Py_DECREF(globals);
+    return found;
+}
@@ -0,0 +1,107 @@
+// -*- c++ -*-
+
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_MODEL_PYTHON_PYMODEL_CACHE_H
+#define SST_CORE_MODEL_PYTHON_PYMODEL_CACHE_H
+
+#include "sst/core/config.h"
+#include "sst/core/configGraph.h"
+#include "sst/core/output.h"
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace SST {
+namespace Core {
+
+/**
+ * Cache of graphs built by Python models, for --model-cache.
+ *
+ * Each entry is a pair of files in the cache directory named after the
+ * key of the entry.  <key>.sstgraph is a binary graph snapshot, as
+ * written by --output-binary, and <key>.deps holds the program options
+ * the model set and the hash of every Python module file that was
+ * imported while the graph was built.  An entry is only used if all of
+ * those files are unchanged.
+ *
+ * The key covers everything else the graph depends on, and is built by
+ * the caller starting from baseKey().  Files are written under a
+ * temporary name and then renamed, with the .deps file last, so other
+ * runs never use a partly written entry.
+ */
+class PythonModelCache
+{
+public:
+    /** Entry file header */
+    struct Header
+    {
+        char     magic[8];     /*!< Always "SSTMODEL" */
+        uint32_t version;      /*!< Format version */
+        uint32_t reserved;     /*!< Unused, set to 0 */
+        uint64_t payload_size; /*!< Bytes of serialized data after the header */
+    };
+
+    static constexpr const char* file_magic   = "SSTMODEL";
+    static constexpr uint32_t    file_version = 1;
+
+    /** Key with nothing added to it */
+    static constexpr uint64_t initial_key = 14695981039346656037ull;
+
+    PythonModelCache(const std::string& dir, Output* output);
+
+    /** Add data to a key (FNV-1a) */
+    static uint64_t hash(uint64_t key, const void* data, size_t len);
+    static uint64_t hash(uint64_t key, const std::string& str) { return hash(key, str.data(), str.size() + 1); }
+
+    /** Add the contents of a file to a key
+     * @return false if the file can't be read
+     */
+    static bool hashFile(uint64_t& key, const std::string& file);
+
+    /** Start of a key, covering the SST version, the ranks and threads
+     * the model is built for and --model-cache-key */
+    static uint64_t baseKey(const Config* cfg, int rank);
+
+    /** Look for an entry that is still valid
+     * @param key key of the entry
+     * @param options filled with the program options the model set
+     * @return true if the entry can be used
+     */
+    bool lookup(uint64_t key, std::map<std::string, std::string>& options);
+
+    /** Save an entry.  Failures only print a warning. */
+    void save(
+        uint64_t key, const Config* cfg, ConfigGraph* graph, const std::map<std::string, std::string>& options);
+
+    /** Name of the graph snapshot of an entry */
+    std::string snapshotName(uint64_t key) const;
+
+private:
+    std::string entryName(uint64_t key, const char* ext) const;
+
+    /** Get the files of the Python modules loaded from outside the
+     * Python installation, which includes the script itself
+     * @return false if they couldn't be found
+     */
+    static bool getModuleFiles(std::vector<std::string>& files);
+
+    std::string dir;
+    Output*     output;
+};
+
+} // namespace Core
+} // namespace SST
+
+#endif // SST_CORE_MODEL_PYTHON_PYMODEL_CACHE_H
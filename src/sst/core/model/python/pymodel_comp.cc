@@ -270,6 +270,12 @@ compGetType(PyObject* self, PyObject* UNUSED(args))
     return PyUnicode_FromString(getComp(self)->type.c_str());
 }
 
+static PyObject*
+compGetID(PyObject* self, PyObject* UNUSED(args))
+{
+    return PyLong_FromUnsignedLongLong(((ComponentPy_t*)self)->obj->getID());
+}
+
 static PyObject*
 compSetSubComponent(PyObject* self, PyObject* args)
 {
@@ -541,6 +547,7 @@ static PyMethodDef componentMethods[] = {
     { "addLink", compAddLink, METH_VARARGS, "Connects this component to a Link" },
     { "getFullName", compGetFullName, METH_NOARGS, "Returns the full name of the component." },
     { "getType", compGetType, METH_NOARGS, "Returns the type of the component." },
+    { "getID", compGetID, METH_NOARGS, "Returns the id of the component, as used by sst.connectLinks()." },
     { "setStatisticLoadLevel", compSetStatisticLoadLevel, METH_VARARGS,
       "Sets the statistics load level for this component" },
     { "createStatistic", compCreateStatistic, METH_VARARGS,
@@ -655,6 +662,7 @@ static PyMethodDef subComponentMethods[] = {
     { "addLink", compAddLink, METH_VARARGS, "Connects this subComponent to a Link" },
     { "getFullName", compGetFullName, METH_NOARGS, "Returns the full name, after any prefix, of the component." },
     { "getType", compGetType, METH_NOARGS, "Returns the type of the component." },
+    { "getID", compGetID, METH_NOARGS, "Returns the id of the component, as used by sst.connectLinks()." },
     { "setStatisticLoadLevel", compSetStatisticLoadLevel, METH_VARARGS,
       "Sets the statistics load level for this component" },
     { "enableAllStatistics", compEnableAllStatistics, METH_VARARGS,
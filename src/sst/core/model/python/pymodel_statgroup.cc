@@ -149,12 +149,24 @@ sgSetFreq(PyObject* self, PyObject* args)
     return SST_ConvertToPythonLong(0);
 }
 
+static PyObject*
+sgSetReduce(PyObject* self, PyObject* args)
+{
+    int val = PyObject_IsTrue(args);
+    if ( val < 0 ) return nullptr;
+    ((StatGroupPy_t*)self)->ptr->setReduce(val != 0);
+
+    return SST_ConvertToPythonLong(0);
+}
+
 static PyMethodDef sgMethods[] = {
     { "addStatistic", sgAddStat, METH_VARARGS, "Add a new statistic to the group" },
     { "addComponent", sgAddComp, METH_O, "Add a component to the group" },
     { "setOutput", sgSetOutput, METH_O, "Configure how the stats should be written" },
     { "setFrequency", sgSetFreq, METH_O,
       "Set the frequency or rate (ie: \"10ms\", \"25khz\") to write out the statistics" },
+    { "setReduce", sgSetReduce, METH_O,
+      "Merge each statistic across the components of the group and write out only the merged statistic" },
     { nullptr, nullptr, 0, nullptr }
 };
 
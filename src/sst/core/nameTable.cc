@@ -0,0 +1,93 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/nameTable.h"
+
+namespace SST {
+
+NameTable::NameId_t
+NameTable::intern(const std::string& name)
+{
+    NameId_t node  = Root;
+    size_t   start = 0;
+    while ( true ) {
+        size_t end = name.find('.', start);
+        if ( end == std::string::npos ) end = name.size();
+
+        std::string segment(name, start, end - start);
+        auto        seg = segment_ids.try_emplace(segment, static_cast<uint32_t>(segments.size()));
+        if ( seg.second ) segments.push_back(std::move(segment));
+
+        auto child = children.try_emplace(childKey(node, seg.first->second), static_cast<NameId_t>(nodes.size()));
+        if ( child.second ) nodes.push_back(Node { node, seg.first->second });
+        node = child.first->second;
+
+        if ( end == name.size() ) return node;
+        start = end + 1;
+    }
+}
+
+NameTable::NameId_t
+NameTable::find(const std::string& name) const
+{
+    NameId_t node  = Root;
+    size_t   start = 0;
+    // Reused for each segment to save allocations
+    std::string segment;
+    while ( true ) {
+        size_t end = name.find('.', start);
+        if ( end == std::string::npos ) end = name.size();
+
+        segment.assign(name, start, end - start);
+        auto seg = segment_ids.find(segment);
+        if ( seg == segment_ids.end() ) return NoName;
+
+        auto child = children.find(childKey(node, seg->second));
+        if ( child == children.end() ) return NoName;
+        node = child->second;
+
+        if ( end == name.size() ) return node;
+        start = end + 1;
+    }
+}
+
+std::string
+NameTable::getName(NameId_t id) const
+{
+    // Walk up to the root, then build the name from the top
+    std::vector<uint32_t> path;
+    size_t                length = 0;
+    for ( NameId_t node = id; node != Root; node = nodes[node].parent ) {
+        path.push_back(nodes[node].segment);
+        length += segments[nodes[node].segment].size() + 1;
+    }
+
+    std::string name;
+    name.reserve(length);
+    for ( auto it = path.rbegin(); it != path.rend(); ++it ) {
+        if ( it != path.rbegin() ) name += '.';
+        name += segments[*it];
+    }
+    return name;
+}
+
+void
+NameTable::clear()
+{
+    segment_ids.clear();
+    segments.clear();
+    nodes.clear();
+    children.clear();
+}
+
+} // namespace SST
@@ -0,0 +1,79 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_NAMETABLE_H
+#define SST_CORE_NAMETABLE_H
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace SST {
+
+/**
+ * Table of hierarchical names, such as "system.node12.core3.l1".
+ *
+ * Names are stored as a trie of dot separated segments, with each
+ * distinct segment kept once.  Each name gets a compact ID that can be
+ * used as a map key in place of the full string, and the full name is
+ * only put back together when asked for.
+ */
+class NameTable
+{
+public:
+    typedef uint32_t NameId_t;
+
+    /** ID returned by find() for names that aren't in the table */
+    static const NameId_t NoName = UINT32_MAX;
+
+    NameTable() {}
+
+    /** Get the ID of a name, adding it if it isn't in the table */
+    NameId_t intern(const std::string& name);
+
+    /** Get the ID of a name, or NoName if it isn't in the table */
+    NameId_t find(const std::string& name) const;
+
+    /** Put the full name of an ID back together */
+    std::string getName(NameId_t id) const;
+
+    /** Number of names and prefixes of names in the table */
+    size_t size() const { return nodes.size(); }
+
+    void clear();
+
+private:
+    // Root of the trie, the parent of the first segment of each name
+    static const NameId_t Root = UINT32_MAX;
+
+    struct Node
+    {
+        NameId_t parent;
+        uint32_t segment;
+    };
+
+    static uint64_t childKey(NameId_t parent, uint32_t segment)
+    {
+        return (static_cast<uint64_t>(parent) << 32) | segment;
+    }
+
+    // Distinct segments
+    std::unordered_map<std::string, uint32_t> segment_ids;
+    std::vector<std::string>                  segments;
+
+    std::vector<Node>                      nodes;
+    std::unordered_map<uint64_t, NameId_t> children;
+};
+
+} // namespace SST
+
+#endif // SST_CORE_NAMETABLE_H
@@ -31,29 +31,29 @@ namespace Comms {
 #ifdef SST_CONFIG_HAVE_MPI
 template <typename dataType>
 void
-broadcast(dataType& data, int root)
+broadcast(dataType& data, int root, MPI_Comm comm = MPI_COMM_WORLD)
 {
     int rank = 0;
-    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_rank(comm, &rank);
     if ( root == rank ) {
         // Serialize the data
         std::vector<char> buffer = Comms::serialize(data);
 
         // Now broadcast the size of the data
         int size = buffer.size();
-        MPI_Bcast(&size, 1, MPI_INT, root, MPI_COMM_WORLD);
+        MPI_Bcast(&size, 1, MPI_INT, root, comm);
 
         // Now broadcast the data
-        MPI_Bcast(buffer.data(), buffer.size(), MPI_BYTE, root, MPI_COMM_WORLD);
+        MPI_Bcast(buffer.data(), buffer.size(), MPI_BYTE, root, comm);
     }
     else {
         // Get the size of the broadcast
         int size = 0;
-        MPI_Bcast(&size, 1, MPI_INT, root, MPI_COMM_WORLD);
+        MPI_Bcast(&size, 1, MPI_INT, root, comm);
 
         // Now get the data
         auto buffer = std::unique_ptr<char[]>(new char[size]);
-        MPI_Bcast(buffer.get(), size, MPI_BYTE, root, MPI_COMM_WORLD);
+        MPI_Bcast(buffer.get(), size, MPI_BYTE, root, comm);
 
         // Now deserialize data
         Comms::deserialize(buffer.get(), size, data);
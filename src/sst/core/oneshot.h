@@ -79,6 +79,9 @@ public:
     void print(const std::string& header, Output& out) const override;
 
 private:
+    // Saves and restores the pending handler times in a checkpoint
+    friend class Simulation_impl;
+
     typedef std::vector<OneShot::HandlerBase*> HandlerList_t;
 
     // Since this only gets fixed latency events, the times will fire
@@ -18,12 +18,18 @@
 
 // Core Headers
 #include "sst/core/simulation_impl.h"
+#include "sst/core/threadsafe.h"
 #include "sst/core/warnmacros.h"
 
 // C++ System Headers
 #include <atomic>
 #include <cerrno>
+#include <chrono>
 #include <cinttypes>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <set>
 
 // System Headers
 #ifdef HAVE_EXECINFO_H
@@ -41,6 +47,399 @@ namespace SST {
 // Atomic to control access to calling MPI_Abort or exit() in fatal() call
 std::atomic<int> fatal_count = 0;
 
+namespace {
+
+// Deferred FILE output.  Each call appends a record to a buffer of the
+// calling thread, which the writer thread swaps out and formats.  A
+// record holds its size, the target FILE*, its kind, the values used
+// by the prefix, the format string and then the arguments of each
+// conversion.  Strings are saved as a uint32_t length and the text, so
+// the caller's strings can change or go away after the call returns.
+enum deferred_kind_t : uint8_t { DEFER_FORMAT, DEFER_TEXT };
+
+enum deferred_arg_t : uint8_t {
+    ARG_INT,
+    ARG_LONG,
+    ARG_LLONG,
+    ARG_INTMAX,
+    ARG_PTRDIFF,
+    ARG_UINT,
+    ARG_ULONG,
+    ARG_ULLONG,
+    ARG_UINTMAX,
+    ARG_SIZE,
+    ARG_DOUBLE,
+    ARG_LDOUBLE,
+    ARG_STRING,
+    ARG_POINTER,
+    ARG_INVALID
+};
+
+static const int PRECISION_NONE = -1;
+static const int PRECISION_STAR = -2;
+
+// Wake the writer thread early when a thread has this much saved
+static const size_t DEFERRED_WAKE_SIZE = 1 << 20;
+// Have the calling thread write out the output past this much
+static const size_t DEFERRED_MAX_SIZE = 64 << 20;
+
+struct conversion_t
+{
+    deferred_arg_t type;
+    bool           width_star;
+    int            precision;
+};
+
+// Parse a printf conversion specification, starting after the '%'.
+// Returns the character after it.  Positional arguments, %n and wide
+// characters are ARG_INVALID, and are formatted by the caller.
+const char*
+parseConversion(const char* p, conversion_t& conv)
+{
+    conv.type       = ARG_INVALID;
+    conv.width_star = false;
+    conv.precision  = PRECISION_NONE;
+
+    while ( *p && strchr("-+ #0'", *p) )
+        p++;
+    if ( *p == '*' ) {
+        conv.width_star = true;
+        p++;
+    }
+    else {
+        while ( *p >= '0' && *p <= '9' )
+            p++;
+        if ( *p == '$' ) return p;
+    }
+    if ( *p == '.' ) {
+        p++;
+        if ( *p == '*' ) {
+            conv.precision = PRECISION_STAR;
+            p++;
+        }
+        else {
+            conv.precision = 0;
+            while ( *p >= '0' && *p <= '9' )
+                conv.precision = conv.precision * 10 + (*p++ - '0');
+        }
+    }
+
+    // 'H' is hh and 'q' is ll
+    char length = 0;
+    switch ( *p ) {
+    case 'h':
+        length = *p++;
+        if ( *p == 'h' ) {
+            length = 'H';
+            p++;
+        }
+        break;
+    case 'l':
+        length = *p++;
+        if ( *p == 'l' ) {
+            length = 'q';
+            p++;
+        }
+        break;
+    case 'q':
+    case 'j':
+    case 'z':
+    case 't':
+    case 'L':
+        length = *p++;
+        break;
+    default:
+        break;
+    }
+
+    switch ( *p ) {
+    case 'd':
+    case 'i':
+        switch ( length ) {
+        case 0:
+        case 'H':
+        case 'h':
+            conv.type = ARG_INT;
+            break;
+        case 'l':
+            conv.type = ARG_LONG;
+            break;
+        case 'q':
+            conv.type = ARG_LLONG;
+            break;
+        case 'j':
+            conv.type = ARG_INTMAX;
+            break;
+        case 'z':
+        case 't':
+            conv.type = ARG_PTRDIFF;
+            break;
+        }
+        break;
+    case 'o':
+    case 'u':
+    case 'x':
+    case 'X':
+        switch ( length ) {
+        case 0:
+        case 'H':
+        case 'h':
+            conv.type = ARG_UINT;
+            break;
+        case 'l':
+            conv.type = ARG_ULONG;
+            break;
+        case 'q':
+            conv.type = ARG_ULLONG;
+            break;
+        case 'j':
+            conv.type = ARG_UINTMAX;
+            break;
+        case 'z':
+        case 't':
+            conv.type = ARG_SIZE;
+            break;
+        }
+        break;
+    case 'f':
+    case 'F':
+    case 'e':
+    case 'E':
+    case 'g':
+    case 'G':
+    case 'a':
+    case 'A':
+        if ( length == 'L' )
+            conv.type = ARG_LDOUBLE;
+        else if ( length == 0 || length == 'l' )
+            conv.type = ARG_DOUBLE;
+        break;
+    case 'c':
+        if ( length == 0 ) conv.type = ARG_INT;
+        break;
+    case 's':
+        if ( length == 0 ) conv.type = ARG_STRING;
+        break;
+    case 'p':
+        if ( length == 0 ) conv.type = ARG_POINTER;
+        break;
+    default:
+        break;
+    }
+    return *p ? p + 1 : p;
+}
+
+template <typename T>
+inline void
+putValue(std::vector<char>& buffer, T value)
+{
+    size_t pos = buffer.size();
+    buffer.resize(pos + sizeof(T));
+    memcpy(buffer.data() + pos, &value, sizeof(T));
+}
+
+inline void
+putString(std::vector<char>& buffer, const char* str, size_t length)
+{
+    putValue<uint32_t>(buffer, length);
+    buffer.insert(buffer.end(), str, str + length);
+}
+
+template <typename T>
+inline T
+getValue(const char*& p)
+{
+    T value;
+    memcpy(&value, p, sizeof(T));
+    p += sizeof(T);
+    return value;
+}
+
+inline std::string
+getString(const char*& p)
+{
+    uint32_t    length = getValue<uint32_t>(p);
+    std::string str(p, length);
+    p += length;
+    return str;
+}
+
+template <typename T>
+int
+formatValue(char* buf, size_t size, const char* spec, const int* stars, int num_stars, T value)
+{
+    switch ( num_stars ) {
+    case 0:
+        return snprintf(buf, size, spec, value);
+    case 1:
+        return snprintf(buf, size, spec, stars[0], value);
+    default:
+        return snprintf(buf, size, spec, stars[0], stars[1], value);
+    }
+}
+
+// Format one saved argument with its conversion specification
+template <typename T>
+void
+appendValue(std::string& out, const std::string& spec, const int* stars, int num_stars, T value)
+{
+    char buf[128];
+    int  len = formatValue(buf, sizeof(buf), spec.c_str(), stars, num_stars, value);
+    if ( len < 0 ) return;
+    if ( static_cast<size_t>(len) < sizeof(buf) ) {
+        out.append(buf, len);
+        return;
+    }
+    std::vector<char> big(len + 1);
+    formatValue(big.data(), big.size(), spec.c_str(), stars, num_stars, value);
+    out.append(big.data(), len);
+}
+
+// Format a DEFER_FORMAT record, reading its arguments from p
+void
+formatDeferred(std::string& out, const char* format, const char*& p)
+{
+    std::string spec;
+    while ( *format ) {
+        const char* start = strchr(format, '%');
+        if ( nullptr == start ) {
+            out += format;
+            break;
+        }
+        out.append(format, start - format);
+        if ( start[1] == '%' ) {
+            out += '%';
+            format = start + 2;
+            continue;
+        }
+
+        conversion_t conv;
+        format = parseConversion(start + 1, conv);
+        spec.assign(start, format);
+
+        int stars[2];
+        int num_stars = 0;
+        if ( conv.width_star ) stars[num_stars++] = getValue<int>(p);
+        if ( conv.precision == PRECISION_STAR ) stars[num_stars++] = getValue<int>(p);
+
+        switch ( conv.type ) {
+        case ARG_INT:
+            appendValue(out, spec, stars, num_stars, getValue<int>(p));
+            break;
+        case ARG_LONG:
+            appendValue(out, spec, stars, num_stars, getValue<long>(p));
+            break;
+        case ARG_LLONG:
+            appendValue(out, spec, stars, num_stars, getValue<long long>(p));
+            break;
+        case ARG_INTMAX:
+            appendValue(out, spec, stars, num_stars, getValue<intmax_t>(p));
+            break;
+        case ARG_PTRDIFF:
+            appendValue(out, spec, stars, num_stars, getValue<ptrdiff_t>(p));
+            break;
+        case ARG_UINT:
+            appendValue(out, spec, stars, num_stars, getValue<unsigned int>(p));
+            break;
+        case ARG_ULONG:
+            appendValue(out, spec, stars, num_stars, getValue<unsigned long>(p));
+            break;
+        case ARG_ULLONG:
+            appendValue(out, spec, stars, num_stars, getValue<unsigned long long>(p));
+            break;
+        case ARG_UINTMAX:
+            appendValue(out, spec, stars, num_stars, getValue<uintmax_t>(p));
+            break;
+        case ARG_SIZE:
+            appendValue(out, spec, stars, num_stars, getValue<size_t>(p));
+            break;
+        case ARG_DOUBLE:
+            appendValue(out, spec, stars, num_stars, getValue<double>(p));
+            break;
+        case ARG_LDOUBLE:
+            appendValue(out, spec, stars, num_stars, getValue<long double>(p));
+            break;
+        case ARG_STRING:
+            appendValue(out, spec, stars, num_stars, getString(p).c_str());
+            break;
+        case ARG_POINTER:
+            appendValue(out, spec, stars, num_stars, getValue<void*>(p));
+            break;
+        case ARG_INVALID:
+            // Records with these are saved as DEFER_TEXT
+            break;
+        }
+    }
+}
+
+// Check whether any of the tokens follow an '@' in an output prefix
+bool
+prefixUses(const std::string& prefix, const char* tokens)
+{
+    for ( size_t i = prefix.find('@'); i != std::string::npos && i + 1 < prefix.size(); i = prefix.find('@', i + 1) ) {
+        if ( strchr(tokens, prefix[i + 1]) ) return true;
+    }
+    return false;
+}
+
+struct DeferredBuffer
+{
+    Core::ThreadSafe::Spinlock lock;
+    std::vector<char>          records;
+};
+
+struct DeferredOutput
+{
+    std::atomic<bool> enabled { false };
+
+    // Buffers of every thread that has saved output
+    std::mutex                   buffers_mutex;
+    std::vector<DeferredBuffer*> buffers;
+
+    // Only one thread writes at a time, so output stays in order
+    std::mutex        write_mutex;
+    std::vector<char> write_records;
+
+    std::thread             writer;
+    std::mutex              writer_mutex;
+    std::condition_variable writer_cv;
+    bool                    done = false;
+
+    ~DeferredOutput()
+    {
+        Output::setDeferredFileOutput(false);
+        for ( auto* buffer : buffers )
+            delete buffer;
+    }
+
+    DeferredBuffer* getBuffer()
+    {
+        thread_local DeferredBuffer* buffer = nullptr;
+        if ( nullptr == buffer ) {
+            buffer = new DeferredBuffer();
+            std::lock_guard<std::mutex> lock(buffers_mutex);
+            buffers.push_back(buffer);
+        }
+        return buffer;
+    }
+
+    void writerLoop()
+    {
+        std::unique_lock<std::mutex> lock(writer_mutex);
+        while ( !done ) {
+            writer_cv.wait_for(lock, std::chrono::milliseconds(10));
+            lock.unlock();
+            Output::flushDeferredFileOutput();
+            lock.lock();
+        }
+    }
+};
+
+// Defined before the Output statics so it is destroyed after them
+DeferredOutput deferred_output;
+
+} // namespace
+
 // Initialize The Static Member Variables
 Output      Output::m_defaultObject;
 std::string Output::m_sstGlobalSimFileName        = "";
@@ -164,6 +563,9 @@ Output::fatal(uint32_t line, const char* file, const char* func, int exit_code,
 
     newFmt = std::string("FATAL: ") + buildPrefixString(line, file, func) + format;
 
+    // Write out the output that came before this
+    flushDeferredFileOutput();
+
     // Get the argument list
     va_start(arg1, format);
     // Always output to STDERR
@@ -253,6 +655,228 @@ Output::setFileName(const std::string& filename) /* STATIC METHOD */
     }
 }
 
+void
+Output::setDeferredFileOutput(bool enable) /* STATIC METHOD */
+{
+    if ( enable ) {
+        if ( deferred_output.enabled.exchange(true) ) return;
+        deferred_output.done   = false;
+        deferred_output.writer = std::thread(&DeferredOutput::writerLoop, &deferred_output);
+        return;
+    }
+
+    if ( !deferred_output.enabled.load() ) return;
+    {
+        std::lock_guard<std::mutex> lock(deferred_output.writer_mutex);
+        deferred_output.done = true;
+    }
+    deferred_output.writer_cv.notify_all();
+    if ( deferred_output.writer.joinable() ) deferred_output.writer.join();
+
+    // Write what is left before output goes straight to the files again
+    flushDeferredFileOutput();
+    deferred_output.enabled.store(false);
+}
+
+void
+Output::flushDeferredFileOutput() /* STATIC METHOD */
+{
+    if ( !deferred_output.enabled.load(std::memory_order_relaxed) ) return;
+
+    std::lock_guard<std::mutex>  write_lock(deferred_output.write_mutex);
+    std::vector<DeferredBuffer*> buffers;
+    {
+        std::lock_guard<std::mutex> lock(deferred_output.buffers_mutex);
+        buffers = deferred_output.buffers;
+    }
+
+    std::vector<char>& records = deferred_output.write_records;
+    for ( auto* buffer : buffers ) {
+        {
+            std::lock_guard<Core::ThreadSafe::Spinlock> lock(buffer->lock);
+            records.swap(buffer->records);
+        }
+        if ( records.empty() ) continue;
+        writeDeferred(records);
+        records.clear();
+    }
+}
+
+void
+Output::deferOutput(
+    uint32_t line, const std::string& file, const std::string& func, bool use_prefix, const char* format,
+    va_list arg) const
+{
+    thread_local std::vector<char> record;
+    record.clear();
+
+    putValue<uint32_t>(record, 0); // Size, filled in at the end
+    putValue<std::FILE*>(record, *m_targetOutputRef);
+    size_t kind_pos = record.size();
+    putValue<uint8_t>(record, DEFER_FORMAT);
+    putValue<uint8_t>(record, use_prefix);
+    if ( use_prefix ) {
+        // Only look up the values the prefix prints
+        putValue<uint32_t>(record, line);
+        putValue<uint32_t>(record, prefixUses(m_outputPrefix, "iIxX") ? getThreadRank() : 0);
+        putValue<uint64_t>(
+            record, prefixUses(m_outputPrefix, "t") ? Simulation_impl::getThreadSimCycle() : 0);
+        putString(record, m_outputPrefix.data(), m_outputPrefix.size());
+        putString(record, file.data(), file.size());
+        putString(record, func.data(), func.size());
+    }
+    size_t format_pos = record.size();
+    putString(record, format, strlen(format));
+
+    // Save the arguments of each conversion
+    va_list args;
+    va_copy(args, arg);
+    bool supported = true;
+    for ( const char* p = format; *p && supported; ) {
+        if ( *p++ != '%' ) continue;
+        if ( *p == '%' ) {
+            p++;
+            continue;
+        }
+
+        conversion_t conv;
+        p = parseConversion(p, conv);
+        if ( conv.width_star ) putValue<int>(record, va_arg(args, int));
+        if ( conv.precision == PRECISION_STAR ) {
+            conv.precision = va_arg(args, int);
+            putValue<int>(record, conv.precision);
+        }
+
+        switch ( conv.type ) {
+        case ARG_INT:
+            putValue(record, va_arg(args, int));
+            break;
+        case ARG_LONG:
+            putValue(record, va_arg(args, long));
+            break;
+        case ARG_LLONG:
+            putValue(record, va_arg(args, long long));
+            break;
+        case ARG_INTMAX:
+            putValue(record, va_arg(args, intmax_t));
+            break;
+        case ARG_PTRDIFF:
+            putValue(record, va_arg(args, ptrdiff_t));
+            break;
+        case ARG_UINT:
+            putValue(record, va_arg(args, unsigned int));
+            break;
+        case ARG_ULONG:
+            putValue(record, va_arg(args, unsigned long));
+            break;
+        case ARG_ULLONG:
+            putValue(record, va_arg(args, unsigned long long));
+            break;
+        case ARG_UINTMAX:
+            putValue(record, va_arg(args, uintmax_t));
+            break;
+        case ARG_SIZE:
+            putValue(record, va_arg(args, size_t));
+            break;
+        case ARG_DOUBLE:
+            putValue(record, va_arg(args, double));
+            break;
+        case ARG_LDOUBLE:
+            putValue(record, va_arg(args, long double));
+            break;
+        case ARG_STRING:
+        {
+            // A precision may limit a string that is not terminated
+            const char* str = va_arg(args, const char*);
+            if ( nullptr == str ) str = "(null)";
+            putString(record, str, conv.precision >= 0 ? strnlen(str, conv.precision) : strlen(str));
+            break;
+        }
+        case ARG_POINTER:
+            putValue(record, va_arg(args, void*));
+            break;
+        case ARG_INVALID:
+            supported = false;
+            break;
+        }
+    }
+    va_end(args);
+
+    if ( !supported ) {
+        // Format it now instead
+        record.resize(format_pos);
+        record[kind_pos] = DEFER_TEXT;
+
+        va_list size_args;
+        va_copy(size_args, arg);
+        int len = std::vsnprintf(nullptr, 0, format, size_args);
+        va_end(size_args);
+        if ( len < 0 ) len = 0;
+
+        putValue<uint32_t>(record, len);
+        size_t pos = record.size();
+        record.resize(pos + len + 1);
+        std::vsnprintf(record.data() + pos, len + 1, format, arg);
+        record.resize(pos + len);
+    }
+
+    uint32_t size = record.size();
+    memcpy(record.data(), &size, sizeof(size));
+
+    DeferredBuffer* buffer = deferred_output.getBuffer();
+    size_t          saved;
+    {
+        std::lock_guard<Core::ThreadSafe::Spinlock> lock(buffer->lock);
+        buffer->records.insert(buffer->records.end(), record.begin(), record.end());
+        saved = buffer->records.size();
+    }
+    if ( saved > DEFERRED_MAX_SIZE )
+        flushDeferredFileOutput();
+    else if ( saved > DEFERRED_WAKE_SIZE )
+        deferred_output.writer_cv.notify_one();
+}
+
+void
+Output::writeDeferred(const std::vector<char>& records) /* STATIC METHOD */
+{
+    std::set<std::FILE*> targets;
+    std::string          text;
+
+    const char* end  = records.data() + records.size();
+    const char* next = records.data();
+    while ( next < end ) {
+        const char* p = next;
+        next += getValue<uint32_t>(p);
+
+        std::FILE* target     = getValue<std::FILE*>(p);
+        uint8_t    kind       = getValue<uint8_t>(p);
+        uint8_t    use_prefix = getValue<uint8_t>(p);
+
+        text.clear();
+        if ( use_prefix ) {
+            uint32_t    line        = getValue<uint32_t>(p);
+            uint32_t    thread_rank = getValue<uint32_t>(p);
+            uint64_t    cycle       = getValue<uint64_t>(p);
+            std::string prefix      = getString(p);
+            std::string file        = getString(p);
+            std::string func        = getString(p);
+            text                    = buildPrefixString(prefix, line, file, func, thread_rank, cycle);
+        }
+
+        std::string format = getString(p);
+        if ( DEFER_TEXT == kind )
+            text += format;
+        else
+            formatDeferred(text, format.c_str(), p);
+
+        std::fwrite(text.data(), 1, text.size(), target);
+        targets.insert(target);
+    }
+
+    for ( auto* target : targets )
+        std::fflush(target);
+}
+
 void
 Output::setTargetOutput(output_location_t location)
 {
@@ -338,6 +962,8 @@ Output::closeSSTTargetFile()
 
         // If the access count is zero, and the file has been opened, then close it
         if ( (0 == *m_targetFileAccessCountRef) && (nullptr != *m_targetFileHandleRef) && (FILE == m_targetLoc) ) {
+            // Deferred output may still be waiting to be written to it
+            flushDeferredFileOutput();
             fclose(*m_targetFileHandleRef);
         }
     }
@@ -345,6 +971,16 @@ Output::closeSSTTargetFile()
 
 std::string
 Output::buildPrefixString(uint32_t line, const std::string& file, const std::string& func) const
+{
+    uint32_t thread_rank = prefixUses(m_outputPrefix, "iIxX") ? getThreadRank() : 0;
+    uint64_t cycle       = prefixUses(m_outputPrefix, "t") ? Simulation_impl::getThreadSimCycle() : 0;
+    return buildPrefixString(m_outputPrefix, line, file, func, thread_rank, cycle);
+}
+
+std::string
+Output::buildPrefixString(
+    const std::string& prefix, uint32_t line, const std::string& file, const std::string& func, uint32_t thread_rank,
+    uint64_t cycle) /* STATIC METHOD */
 {
     std::string rtnstring  = "";
     size_t      startindex = 0;
@@ -355,16 +991,16 @@ Output::buildPrefixString(uint32_t line, const std::string& file, const std::str
     while ( std::string::npos != findindex ) {
 
         // Find the next '@' from the starting index
-        findindex = m_outputPrefix.find("@", startindex);
+        findindex = prefix.find("@", startindex);
 
         // Check to see if we found anything
         if ( std::string::npos != findindex ) {
 
             // We found the @, copy the string up to this point
-            rtnstring += m_outputPrefix.substr(startindex, findindex - startindex);
+            rtnstring += prefix.substr(startindex, findindex - startindex);
 
             // check the next character to see what we need to do
-            switch ( m_outputPrefix[findindex + 1] ) {
+            switch ( prefix[findindex + 1] ) {
             case 'f':
                 rtnstring += file;
                 startindex = findindex + 2;
@@ -379,48 +1015,48 @@ Output::buildPrefixString(uint32_t line, const std::string& file, const std::str
                 startindex = findindex + 2;
                 break;
             case 'r':
-                if ( 1 == getMPIWorldSize() ) { rtnstring += ""; }
+                if ( 1 == m_worldSize.rank ) { rtnstring += ""; }
                 else {
-                    snprintf(tempBuf, 256, "%d", getMPIWorldRank());
+                    snprintf(tempBuf, 256, "%d", m_mpiRank);
                     rtnstring += tempBuf;
                 }
                 startindex = findindex + 2;
                 break;
             case 'R':
-                if ( 1 == getMPIWorldSize() ) { rtnstring += "0"; }
+                if ( 1 == m_worldSize.rank ) { rtnstring += "0"; }
                 else {
-                    snprintf(tempBuf, 256, "%d", getMPIWorldRank());
+                    snprintf(tempBuf, 256, "%d", m_mpiRank);
                     rtnstring += tempBuf;
                 }
                 startindex = findindex + 2;
                 break;
             case 'i':
-                if ( 1 == getNumThreads() ) { rtnstring += ""; }
+                if ( 1 == m_worldSize.thread ) { rtnstring += ""; }
                 else {
-                    snprintf(tempBuf, 256, "%u", getThreadRank());
+                    snprintf(tempBuf, 256, "%u", thread_rank);
                     rtnstring += tempBuf;
                 }
                 startindex = findindex + 2;
                 break;
             case 'I':
-                snprintf(tempBuf, 256, "%u", getThreadRank());
+                snprintf(tempBuf, 256, "%u", thread_rank);
                 rtnstring += tempBuf;
                 startindex = findindex + 2;
                 break;
             case 'x':
-                if ( getMPIWorldSize() != 1 || getNumThreads() != 1 ) {
-                    snprintf(tempBuf, 256, "[%d:%u]", getMPIWorldRank(), getThreadRank());
+                if ( m_worldSize.rank != 1 || m_worldSize.thread != 1 ) {
+                    snprintf(tempBuf, 256, "[%d:%u]", m_mpiRank, thread_rank);
                     rtnstring += tempBuf;
                 }
                 startindex = findindex + 2;
                 break;
             case 'X':
-                snprintf(tempBuf, 256, "[%d:%u]", getMPIWorldRank(), getThreadRank());
+                snprintf(tempBuf, 256, "[%d:%u]", m_mpiRank, thread_rank);
                 rtnstring += tempBuf;
                 startindex = findindex + 2;
                 break;
             case 't':
-                snprintf(tempBuf, 256, "%" PRIu64, Simulation_impl::getSimulation()->getCurrentSimCycle());
+                snprintf(tempBuf, 256, "%" PRIu64, cycle);
                 rtnstring += tempBuf;
                 startindex = findindex + 2;
                 break;
@@ -434,7 +1070,7 @@ Output::buildPrefixString(uint32_t line, const std::string& file, const std::str
         }
     }
     // copy the remainder of the string from the start index to the end.
-    rtnstring += m_outputPrefix.substr(startindex);
+    rtnstring += prefix.substr(startindex);
 
     return rtnstring;
 }
@@ -450,6 +1086,10 @@ Output::outputprintf(
 
     // Check to make sure output location is not NONE
     if ( NONE != m_targetLoc ) {
+        if ( FILE == m_targetLoc && deferred_output.enabled.load(std::memory_order_relaxed) ) {
+            deferOutput(line, file, func, true, format, arg);
+            return;
+        }
         newFmt = buildPrefixString(line, file, func) + format;
         std::vfprintf(*m_targetOutputRef, newFmt.c_str(), arg);
         if ( FILE == m_targetLoc ) fflush(*m_targetOutputRef);
@@ -464,6 +1104,10 @@ Output::outputprintf(const char* format, va_list arg) const
 
     // Check to make sure output location is not NONE
     if ( NONE != m_targetLoc ) {
+        if ( FILE == m_targetLoc && deferred_output.enabled.load(std::memory_order_relaxed) ) {
+            deferOutput(0, "", "", false, format, arg);
+            return;
+        }
         std::vfprintf(*m_targetOutputRef, format, arg);
         if ( FILE == m_targetLoc ) fflush(*m_targetOutputRef);
     }
@@ -29,6 +29,7 @@
 #include <stdarg.h>
 #include <thread>
 #include <unordered_map>
+#include <vector>
 
 extern int main(int argc, char** argv);
 
@@ -465,7 +466,11 @@ public:
     output_location_t getOutputLocation() const;
 
     /** This method allows for the manual flushing of the output. */
-    inline void flush() const { std::fflush(*m_targetOutputRef); }
+    inline void flush() const
+    {
+        if ( FILE == m_targetLoc ) flushDeferredFileOutput();
+        std::fflush(*m_targetOutputRef);
+    }
 
     /** This method sets the static filename used by SST.  It can only be called
         once, and is automatically called by the SST Core.  No components should
@@ -475,6 +480,21 @@ public:
 
     static Output& getDefaultObject() { return m_defaultObject; }
 
+    /** This method sets whether Output objects with a FILE location only
+        save the format and arguments of each call in a buffer of the
+        calling thread.  A background thread then builds the prefix,
+        formats the output and writes it, so a call no longer costs a
+        format and a fflush().  Turning it off writes out everything
+        that was saved and stops the background thread.  It is called by
+        the SST Core, no components should call this method.
+     */
+    static void setDeferredFileOutput(bool enable);
+
+    /** This method writes out all the output saved by deferred FILE
+        outputs and flushes the files.
+     */
+    static void flushDeferredFileOutput();
+
 private:
     friend class TraceFunction;
     // Support Methods
@@ -491,6 +511,15 @@ private:
                uint32_t line, const std::string& file, const std::string& func, const char* format, va_list arg) const;
     void outputprintf(const char* format, va_list arg) const;
 
+    // Deferred FILE output
+    static std::string buildPrefixString(
+        const std::string& prefix, uint32_t line, const std::string& file, const std::string& func,
+        uint32_t thread_rank, uint64_t cycle);
+    void deferOutput(
+        uint32_t line, const std::string& file, const std::string& func, bool use_prefix, const char* format,
+        va_list arg) const;
+    static void writeDeferred(const std::vector<char>& records);
+
     friend int ::main(int argc, char** argv);
     static Output& setDefaultObject(
         const std::string& prefix, uint32_t verbose_level, uint32_t verbose_mask, output_location_t location,
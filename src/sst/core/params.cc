@@ -16,6 +16,7 @@
 
 #include "sst/core/unitAlgebra.h"
 
+#include <algorithm>
 #include <map>
 #include <stdexcept>
 #include <string>
@@ -30,6 +31,11 @@ const std::string&
 Params::getString(const std::string& name, bool& found) const
 {
     static std::string empty;
+    if ( isFrozen() ) {
+        const FrozenEntry* entry = findFrozen(name);
+        found                    = entry != nullptr;
+        return found ? *entry->value : empty;
+    }
     for ( auto map : data ) {
         auto value = map->find(getKey(name));
         if ( value != map->end() ) {
@@ -53,18 +59,24 @@ Params::empty() const
     return getKeys().empty();
 }
 
-Params::Params() : my_data(), verify_enabled(true)
+Params::Params() :
+    my_data(std::make_shared<std::map<uint32_t, std::string>>()),
+    verify_enabled(true),
+    frozen_valid(false),
+    frozen_generation(0)
 {
-    data.push_back(&my_data);
+    data.push_back(my_data.get());
 }
 
 Params::Params(const Params& old) :
     my_data(old.my_data),
     data(old.data),
     allowedKeys(old.allowedKeys),
-    verify_enabled(old.verify_enabled)
+    verify_enabled(old.verify_enabled),
+    frozen_valid(false),
+    frozen_generation(0)
 {
-    data[0] = &my_data;
+    data[0] = my_data.get();
 }
 
 Params&
@@ -72,23 +84,26 @@ Params::operator=(const Params& old)
 {
     my_data        = old.my_data;
     data           = old.data;
-    data[0]        = &my_data;
+    data[0]        = my_data.get();
     verify_enabled = old.verify_enabled;
     allowedKeys    = old.allowedKeys;
+    thaw();
     return *this;
 }
 
 void
 Params::clear()
 {
-    my_data.clear();
+    my_data = std::make_shared<std::map<uint32_t, std::string>>();
     data.clear();
-    data.push_back(&my_data);
+    data.push_back(my_data.get());
+    thaw();
 }
 
 size_t
 Params::count(const key_type& k) const
 {
+    if ( isFrozen() ) return findFrozen(k) != nullptr ? 1 : 0;
     int key = getKey(k);
     for ( auto map : data ) {
         size_t count = map->count(key);
@@ -140,17 +155,26 @@ Params::print_all_params(Output& out, const std::string& prefix) const
 void
 Params::insert(const std::string& key, const std::string& value, bool overwrite)
 {
-    if ( overwrite ) { my_data[getKey(key)] = value; }
+    thaw();
+    if ( overwrite ) { localData()[getKey(key)] = value; }
     else {
         uint32_t id = getKey(key);
-        my_data.insert(std::make_pair(id, value));
+        localData().insert(std::make_pair(id, value));
     }
 }
 
 void
 Params::insert(const Params& params)
 {
-    my_data.insert(params.my_data.begin(), params.my_data.end());
+    thaw();
+    if ( my_data->empty() ) {
+        // Nothing to merge with, so share the other object's params
+        my_data = params.my_data;
+        data[0] = my_data.get();
+    }
+    else if ( !params.my_data->empty() ) {
+        localData().insert(params.my_data->begin(), params.my_data->end());
+    }
     for ( size_t i = 1; i < params.data.size(); ++i ) {
         bool already_there = false;
         for ( auto x : data ) {
@@ -195,6 +219,7 @@ Params::get_scoped_params(const std::string& scope) const
 bool
 Params::contains(const key_type& k) const
 {
+    if ( isFrozen() ) return findFrozen(k) != nullptr;
     for ( auto map : data ) {
         if ( map->find(getKey(k)) != map->end() ) return true;
     }
@@ -247,7 +272,47 @@ Params::getParamName(uint32_t id)
 void
 Params::serialize_order(SST::Core::Serialization::serializer& ser)
 {
-    ser&                     my_data;
+    // Local params, written once per table if shared
+    SharedDataTable* table = SharedDataTable::active;
+    uint32_t         idx   = 0;
+    switch ( ser.mode() ) {
+    case SST::Core::Serialization::serializer::PACK:
+    case SST::Core::Serialization::serializer::SIZER:
+        if ( table ) {
+            auto res = table->index.try_emplace(my_data.get(), static_cast<uint32_t>(table->index.size()));
+            idx      = res.first->second;
+            ser& idx;
+            if ( !res.second ) break;
+        }
+        ser& *my_data;
+        break;
+    case SST::Core::Serialization::serializer::UNPACK:
+    {
+        thaw();
+        if ( table ) {
+            ser& idx;
+            if ( idx < table->datas.size() ) {
+                my_data = table->datas[idx];
+                data[0] = my_data.get();
+                break;
+            }
+        }
+        auto unpacked = std::make_shared<std::map<uint32_t, std::string>>();
+        ser& *unpacked;
+        if ( keyRemap != nullptr ) {
+            std::map<uint32_t, std::string> remapped;
+            for ( auto& x : *unpacked ) {
+                remapped.emplace((*keyRemap)[x.first], std::move(x.second));
+            }
+            unpacked->swap(remapped);
+        }
+        my_data = unpacked;
+        data[0] = my_data.get();
+        if ( table ) table->datas.push_back(my_data);
+        break;
+    }
+    }
+
     // Serialize global params
     std::vector<std::string> globals;
     switch ( ser.mode() ) {
@@ -282,6 +347,48 @@ Params::getKey(const std::string& str)
     return i->second;
 }
 
+std::map<uint32_t, std::string>&
+Params::localData()
+{
+    if ( my_data.use_count() > 1 ) {
+        my_data = std::make_shared<std::map<uint32_t, std::string>>(*my_data);
+        data[0] = my_data.get();
+    }
+    return *my_data;
+}
+
+void
+Params::DataPool::share(Params& params)
+{
+    size_t hash = params.my_data->size();
+    for ( auto& x : *params.my_data ) {
+        hash = hash * 31 + (x.first ^ std::hash<std::string>()(x.second));
+    }
+
+    auto range = pool.equal_range(hash);
+    for ( auto it = range.first; it != range.second; ++it ) {
+        if ( it->second == params.my_data ) return;
+        if ( *it->second == *params.my_data ) {
+            params.thaw();
+            params.my_data = it->second;
+            params.data[0] = params.my_data.get();
+            return;
+        }
+    }
+    pool.emplace(hash, params.my_data);
+}
+
+Params::SharedDataTable::Scope::Scope() : prev(active)
+{
+    active = new SharedDataTable();
+}
+
+Params::SharedDataTable::Scope::~Scope()
+{
+    delete active;
+    active = prev;
+}
+
 void
 Params::addGlobalParamSet(const std::string& set)
 {
@@ -289,12 +396,61 @@ Params::addGlobalParamSet(const std::string& set)
     if ( global_params.count(set) == 0 ) { global_params[set][0] = set; }
 
     data.push_back(&global_params[set]);
+    thaw();
+}
+
+void
+Params::freeze()
+{
+    frozen.clear();
+    for ( auto map : data ) {
+        for ( auto& value : *map ) {
+            // ID 0 holds the name of global sets
+            if ( value.first == 0 ) continue;
+            frozen.push_back(FrozenEntry { keyMapReverse[value.first], &value.second, nullptr, nullptr });
+        }
+    }
+
+    // Local params come first, followed by the global sets in search
+    // order, so keeping the first of each key gives the same answer
+    // as searching the maps
+    std::stable_sort(frozen.begin(), frozen.end(), [](const FrozenEntry& a, const FrozenEntry& b) {
+        return a.name < b.name;
+    });
+    frozen.erase(
+        std::unique(
+            frozen.begin(), frozen.end(),
+            [](const FrozenEntry& a, const FrozenEntry& b) { return a.name == b.name; }),
+        frozen.end());
+    frozen.shrink_to_fit();
+
+    frozen_valid      = true;
+    frozen_generation = global_generation;
+}
+
+void
+Params::thaw()
+{
+    if ( !frozen_valid ) return;
+    frozen.clear();
+    frozen.shrink_to_fit();
+    frozen_valid = false;
+}
+
+const Params::FrozenEntry*
+Params::findFrozen(const std::string& k) const
+{
+    auto it = std::lower_bound(
+        frozen.begin(), frozen.end(), k, [](const FrozenEntry& a, const std::string& b) { return a.name < b; });
+    if ( it == frozen.end() || it->name != k ) return nullptr;
+    return &(*it);
 }
 
 void
 Params::insert_global(const std::string& global_key, const std::string& key, const std::string& value, bool overwrite)
 {
     std::lock_guard<SST::Core::ThreadSafe::Spinlock> lock(globalLock);
+    global_generation++;
     if ( global_params.count(global_key) == 0 ) { global_params[global_key][0] = global_key; }
     if ( overwrite ) { global_params[global_key][getKey(key)] = value; }
     else {
@@ -419,6 +575,29 @@ Params::getGlobalParamSetNames()
 }
 
 
+size_t
+Params::getSharedMemoryEstimate()
+{
+    // Tree nodes carry about four pointers of overhead each
+    const size_t node = 4 * sizeof(void*);
+    size_t       ret  = 0;
+    {
+        std::lock_guard<SST::Core::ThreadSafe::Spinlock> lock(keyLock);
+        for ( auto& x : keyMapReverse ) {
+            // Each key is stored in both directions
+            ret += 2 * (sizeof(std::string) + x.capacity()) + sizeof(uint32_t) + node;
+        }
+    }
+    std::lock_guard<SST::Core::ThreadSafe::Spinlock> lock(globalLock);
+    for ( auto& set : global_params ) {
+        ret += sizeof(std::string) + set.first.capacity() + node;
+        for ( auto& x : set.second ) {
+            ret += sizeof(uint32_t) + sizeof(std::string) + x.second.capacity() + node;
+        }
+    }
+    return ret;
+}
+
 std::vector<std::string>
 Params::getLocalKeys() const
 {
@@ -510,7 +689,11 @@ Core::ThreadSafe::Spinlock      Params::keyLock;
 Core::ThreadSafe::Spinlock      Params::globalLock;
 // ID 0 is reserved for holding metadata
 bool                            Params::g_verify_enabled = false;
+uint64_t                        Params::global_generation = 0;
 
 std::map<std::string, std::map<uint32_t, std::string>> Params::global_params;
 
+thread_local const std::vector<uint32_t>* Params::keyRemap = nullptr;
+thread_local Params::SharedDataTable*     Params::SharedDataTable::active = nullptr;
+
 } // namespace SST
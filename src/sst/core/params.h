@@ -22,11 +22,15 @@
 #include <inttypes.h>
 #include <iostream>
 #include <map>
+#include <memory>
 #include <sstream>
 #include <stack>
 #include <stdexcept>
 #include <stdlib.h>
+#include <typeinfo>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 int main(int argc, char* argv[]);
 
@@ -37,7 +41,9 @@ class ConfigComponent;
 class SSTModelDescription;
 
 namespace Core {
+class BinaryConfigGraphOutput;
 class ConfigGraphOutput;
+class SSTBinaryModelDefinition;
 } // namespace Core
 
 /**
@@ -128,6 +134,40 @@ NO_VARIABLE:
         }
     }
 
+    /** Entry in the lookup table built by freeze().  The last value
+     * converted from the string is kept so repeated finds of the same
+     * type skip the conversion. */
+    struct FrozenEntry
+    {
+        std::string                   name;
+        const std::string*            value;
+        mutable const std::type_info* cached_type;
+        mutable std::shared_ptr<void> cached_value;
+    };
+
+    /** Returns true if the lookup table built by freeze() is still
+     * valid for this object */
+    inline bool isFrozen() const { return frozen_valid && frozen_generation == global_generation; }
+
+    /** Find a key in the lookup table built by freeze().  Returns
+     * nullptr if the key is not in the set. */
+    const FrozenEntry* findFrozen(const std::string& k) const;
+
+    /** Throw away the lookup table built by freeze() */
+    void thaw();
+
+    /** Return the value of a frozen entry converted to type T, using
+     * the cached conversion if there is one */
+    template <class T>
+    inline const T& cachedValue(const FrozenEntry& entry) const
+    {
+        if ( entry.cached_type == nullptr || *entry.cached_type != typeid(T) ) {
+            entry.cached_value = std::make_shared<T>(convert_value<T>(entry.name, *entry.value));
+            entry.cached_type  = &typeid(T);
+        }
+        return *static_cast<const T*>(entry.cached_value.get());
+    }
+
     /** Private utility function to find a Parameter value in the set,
      * and return its value as a type T.
      *
@@ -145,6 +185,12 @@ NO_VARIABLE:
     inline T find_impl(const std::string& k, T default_value, bool& found) const
     {
         verifyKey(k);
+        if ( isFrozen() ) {
+            const FrozenEntry* entry = findFrozen(k);
+            found                    = entry != nullptr;
+            if ( !found ) return default_value;
+            return cachedValue<T>(*entry);
+        }
         // const_iterator i = data.find(getKey(k));
         const std::string& value = getString(k, found);
         if ( !found ) { return default_value; }
@@ -167,6 +213,13 @@ NO_VARIABLE:
     inline T find_impl(const std::string& k, const std::string& default_value, bool& found) const
     {
         verifyKey(k);
+        if ( isFrozen() ) {
+            const FrozenEntry* entry = findFrozen(k);
+            if ( entry != nullptr ) {
+                found = true;
+                return cachedValue<T>(*entry);
+            }
+        }
         const std::string& value = getString(k, found);
         if ( !found ) {
             try {
@@ -253,6 +306,15 @@ public:
      */
     static void enableVerify() { g_verify_enabled = true; };
 
+    /**
+     * Get the approximate number of bytes used by the data shared by
+     * all Params objects: the table of key names and the global param
+     * sets.  The values held by each Params object are not included.
+     *
+     * @return approximate size of the shared data in bytes
+     */
+    static size_t getSharedMemoryEstimate();
+
     /**
      * Returns the size of the Params.  This will count both local and
      * global params.
@@ -271,6 +333,16 @@ public:
     /** Create a new, empty Params */
     Params();
 
+    /**
+     * Build a compact, read-only lookup table of all the local and
+     * global params in this object.  Later finds search the table
+     * instead of the key map and param sets, and do not repeat
+     * conversions that have already been done.  Any change to this
+     * object throws the table away, and it is rebuilt the next time
+     * freeze() is called.
+     */
+    void freeze();
+
     /** Create a copy of a Params object */
     Params(const Params& old);
 
@@ -842,6 +914,36 @@ public:
     void serialize_order(SST::Core::Serialization::serializer& ser) override;
     ImplementSerializable(SST::Params)
 
+public:
+    /**
+     * Local params that have already been serialized, so that ones
+     * shared by several Params objects are only written once.  Only
+     * used while a Scope is active; outside of that, each object's
+     * local params are serialized in full.
+     */
+    class SharedDataTable
+    {
+    public:
+        /** Makes a table active for the lifetime of the object */
+        class Scope
+        {
+        public:
+            Scope();
+            ~Scope();
+
+        private:
+            SharedDataTable* prev;
+        };
+
+    private:
+        friend class Params;
+
+        std::unordered_map<const void*, uint32_t>                      index;
+        std::vector<std::shared_ptr<std::map<uint32_t, std::string>>> datas;
+
+        static thread_local SharedDataTable* active;
+    };
+
 private:
     //// Functions used by model descriptions and config graph
     //// outputters (classes that use it are friended below)
@@ -850,6 +952,10 @@ private:
     friend class SST::Core::ConfigGraphOutput;
     friend class SST::SSTModelDescription;
 
+    // Binary graph snapshots need to save and restore the key IDs
+    friend class SST::Core::BinaryConfigGraphOutput;
+    friend class SST::Core::SSTBinaryModelDefinition;
+
     /**
      * @param k   Key to check for validity
      * @return    True if the key is considered allowed
@@ -919,8 +1025,29 @@ private:
      */
     std::vector<std::string> getSubscribedGlobalParamSets() const;
 
+    /**
+     * Local params by content, used to make Params objects with
+     * identical local params share a single copy
+     */
+    class DataPool
+    {
+    public:
+        /** Make params use the pooled copy of its local params, adding
+            them to the pool if they are new */
+        void share(Params& params);
+
+    private:
+        std::unordered_multimap<size_t, std::shared_ptr<std::map<uint32_t, std::string>>> pool;
+    };
+
 
     // Private functions used by Params
+    /**
+     * Get the local params for changing them.  They are copied first
+     * if they are shared with other Params objects.
+     */
+    std::map<uint32_t, std::string>& localData();
+
     /**
      * @param k   Key to check for validity
      * @return    True if the key is considered allowed
@@ -929,12 +1056,22 @@ private:
 
 
     // Private data
-    std::map<uint32_t, std::string>               my_data;
-    std::vector<std::map<uint32_t, std::string>*> data;
+    // Local params, shared copy-on-write between copies of the object
+    std::shared_ptr<std::map<uint32_t, std::string>> my_data;
+    std::vector<std::map<uint32_t, std::string>*>    data;
     std::vector<KeySet_t>                         allowedKeys;
     bool                                          verify_enabled;
     static bool                                   g_verify_enabled;
 
+    // Lookup table built by freeze(), sorted by key name
+    std::vector<FrozenEntry> frozen;
+    bool                     frozen_valid;
+    uint64_t                 frozen_generation;
+
+    /* Incremented when a global param set is changed so frozen
+     * lookup tables that reference it are no longer used */
+    static uint64_t global_generation;
+
     static uint32_t getKey(const std::string& str);
 
     /**
@@ -954,6 +1091,11 @@ private:
     static uint32_t                        nextKeyID;
 
     static std::map<std::string, std::map<uint32_t, std::string>> global_params;
+
+    /* If set, key IDs are translated through this table when
+     * unpacking.  Used when loading params that were serialized by
+     * another process, which may have assigned different IDs. */
+    static thread_local const std::vector<uint32_t>* keyRemap;
 };
 
 #if 0
@@ -15,12 +15,12 @@
 
 namespace SST {
 
-PollingLinkQueue::PollingLinkQueue() : ActivityQueue() {}
+PollingLinkQueue::PollingLinkQueue() : ActivityQueue(), data(16, nullptr), head(0), count(0) {}
 PollingLinkQueue::~PollingLinkQueue()
 {
     // Need to delete any events left in the queue
-    for ( auto it = data.begin(); it != data.end(); ++it ) {
-        delete *it;
+    for ( size_t i = 0; i < count; ++i ) {
+        delete data[index(i)];
     }
     data.clear();
 }
@@ -28,36 +28,58 @@ PollingLinkQueue::~PollingLinkQueue()
 bool
 PollingLinkQueue::empty()
 {
-    return data.empty();
+    return count == 0;
 }
 
 int
 PollingLinkQueue::size()
 {
-    return data.size();
+    return count;
 }
 
 void
 PollingLinkQueue::insert(Activity* activity)
 {
-    data.insert(activity);
+    if ( count == data.size() ) grow();
+
+    // Walk back over any events due later than this one; in the
+    // common in-order case the loop does not run at all
+    SimTime_t time = activity->getDeliveryTime();
+    size_t    pos  = count;
+    while ( pos > 0 && data[index(pos - 1)]->getDeliveryTime() > time ) {
+        data[index(pos)] = data[index(pos - 1)];
+        --pos;
+    }
+    data[index(pos)] = activity;
+    ++count;
 }
 
 Activity*
 PollingLinkQueue::pop()
 {
-    if ( data.size() == 0 ) return nullptr;
-    auto      it      = data.begin();
-    Activity* ret_val = (*it);
-    data.erase(it);
+    if ( count == 0 ) return nullptr;
+    Activity* ret_val = data[head];
+    head              = index(1);
+    --count;
     return ret_val;
 }
 
 Activity*
 PollingLinkQueue::front()
 {
-    if ( data.size() == 0 ) return nullptr;
-    return *data.begin();
+    if ( count == 0 ) return nullptr;
+    return data[head];
+}
+
+void
+PollingLinkQueue::grow()
+{
+    std::vector<Activity*> bigger(data.size() * 2, nullptr);
+    for ( size_t i = 0; i < count; ++i ) {
+        bigger[i] = data[index(i)];
+    }
+    data.swap(bigger);
+    head = 0;
 }
 
 } // namespace SST
@@ -14,12 +14,17 @@
 
 #include "sst/core/activityQueue.h"
 
-#include <set>
+#include <vector>
 
 namespace SST {
 
 /**
  * A link queue which is used for polling only.
+ *
+ * Events on a link almost always arrive in delivery time order, so
+ * they are held in a ring buffer and appended at the back.  An event
+ * that arrives out of order is moved back to its sorted position,
+ * after any events with the same delivery time.
  */
 class PollingLinkQueue : public ActivityQueue
 {
@@ -34,7 +39,15 @@ public:
     Activity* front() override;
 
 private:
-    std::multiset<Activity*, Activity::less<true, false, false>> data;
+    /** Double the capacity of the ring, keeping the events in order */
+    void grow();
+
+    /** Index into data of the i-th event from the front */
+    size_t index(size_t i) const { return (head + i) & (data.size() - 1); }
+
+    std::vector<Activity*> data;  /*!< Ring storage, size is a power of two */
+    size_t                 head;  /*!< Index of the front event */
+    size_t                 count; /*!< Number of events in the queue */
 };
 
 } // namespace SST
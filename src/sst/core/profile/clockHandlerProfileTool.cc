@@ -93,10 +93,47 @@ ClockHandlerProfileToolCount::outputData(FILE* fp)
 }
 
 
+ClockHandlerProfileToolSample::ClockHandlerProfileToolSample(const std::string& name, Params& params) :
+    ClockHandlerProfileTool(name, params)
+{
+    uint64_t period = params.find<uint64_t>("period", 1000);
+    if ( period == 0 ) {
+        Output::getDefaultObject().fatal(
+            CALL_INFO_LONG, 1, "ERROR: period for ClockHandlerProfileToolSample must be greater than 0\n");
+    }
+    HandlerSampler::start(period);
+}
+
+ClockHandlerProfileToolSample::~ClockHandlerProfileToolSample()
+{
+    HandlerSampler::stop();
+}
+
+uintptr_t
+ClockHandlerProfileToolSample::registerHandler(const HandlerMetaData& mdata)
+{
+    return reinterpret_cast<uintptr_t>(&samples_[getKeyForHandler(mdata)]);
+}
+
+void
+ClockHandlerProfileToolSample::outputData(FILE* fp)
+{
+    HandlerSampler::output(fp, name, samples_);
+}
+
+
 template <typename T>
 ClockHandlerProfileToolTime<T>::ClockHandlerProfileToolTime(const std::string& name, Params& params) :
-    ClockHandlerProfileTool(name, params)
-{}
+    ClockHandlerProfileTool(name, params),
+    countdown_(1),
+    timing_(false)
+{
+    sample_interval_ = params.find<uint64_t>("sample_interval", 1);
+    if ( sample_interval_ == 0 ) {
+        Output::getDefaultObject().fatal(
+            CALL_INFO_LONG, 1, "ERROR: sample_interval for %s must be greater than 0\n", name.c_str());
+    }
+}
 
 template <typename T>
 uintptr_t
@@ -112,9 +149,13 @@ ClockHandlerProfileToolTime<T>::outputData(FILE* fp)
     fprintf(fp, "%s\n", name.c_str());
     fprintf(fp, "Name, count, handler time (s), avg. handler time (ns)\n");
     for ( auto& x : times_ ) {
+        // The time of the calls that weren't timed is estimated from
+        // the ones that were
+        double scale = x.second.timed_count == 0 ? 0.0 : (double)x.second.count / x.second.timed_count;
         fprintf(
             fp, "%s, %" PRIu64 ", %lf, %" PRIu64 "\n", x.first.c_str(), x.second.count,
-            ((double)x.second.time) / 1000000000.0, x.second.count == 0 ? 0 : x.second.time / x.second.count);
+            ((double)x.second.time) * scale / 1000000000.0,
+            x.second.timed_count == 0 ? 0 : x.second.time / x.second.timed_count);
     }
 }
 
@@ -131,6 +172,10 @@ public:
         "Profiler that will time handlers using a high resolution clock"
     )
 
+    SST_ELI_DOCUMENT_PARAMS(
+        { "sample_interval", "Time one in this many handler calls, and scale up the time of each handler to cover its other calls", "1" },
+    )
+
     ClockHandlerProfileToolTimeHighResolution(const std::string& name, Params& params) :
         ClockHandlerProfileToolTime<std::chrono::high_resolution_clock>(name, params)
     {}
@@ -152,6 +197,10 @@ public:
         "Profiler that will time handlers using a steady clock"
     )
 
+    SST_ELI_DOCUMENT_PARAMS(
+        { "sample_interval", "Time one in this many handler calls, and scale up the time of each handler to cover its other calls", "1" },
+    )
+
     ClockHandlerProfileToolTimeSteady(const std::string& name, Params& params) :
         ClockHandlerProfileToolTime<std::chrono::steady_clock>(name, params)
     {}
@@ -15,6 +15,7 @@
 #include "sst/core/clock.h"
 #include "sst/core/eli/elementinfo.h"
 #include "sst/core/sst_types.h"
+#include "sst/core/profile/handlerSampler.h"
 #include "sst/core/ssthandler.h"
 #include "sst/core/warnmacros.h"
 
@@ -85,10 +86,11 @@ class ClockHandlerProfileToolTime : public ClockHandlerProfileTool
 {
     struct clock_data_t
     {
-        uint64_t time;
+        uint64_t time; // Of the timed calls only
         uint64_t count;
+        uint64_t timed_count;
 
-        clock_data_t() : time(0), count(0) {}
+        clock_data_t() : time(0), count(0), timed_count(0) {}
     };
 
 public:
@@ -98,23 +100,77 @@ public:
 
     uintptr_t registerHandler(const HandlerMetaData& mdata) override;
 
-    void handlerStart(uintptr_t UNUSED(key)) override { start_time_ = T::now(); }
+    void handlerStart(uintptr_t UNUSED(key)) override
+    {
+        // Only one in sample_interval_ calls is timed, counted down
+        // across all the handlers
+        timing_ = --countdown_ == 0;
+        if ( !timing_ ) return;
+        countdown_  = sample_interval_;
+        start_time_ = T::now();
+    }
 
     void handlerEnd(uintptr_t key) override
     {
-        auto          total_time = T::now() - start_time_;
-        clock_data_t* entry      = reinterpret_cast<clock_data_t*>(key);
-        entry->time += std::chrono::duration_cast<std::chrono::nanoseconds>(total_time).count();
+        clock_data_t* entry = reinterpret_cast<clock_data_t*>(key);
         entry->count++;
+        if ( !timing_ ) return;
+        auto total_time = T::now() - start_time_;
+        entry->time += std::chrono::duration_cast<std::chrono::nanoseconds>(total_time).count();
+        entry->timed_count++;
     }
 
     void outputData(FILE* fp) override;
 
 private:
     typename T::time_point              start_time_;
+    uint64_t                            sample_interval_;
+    uint64_t                            countdown_;
+    bool                                timing_;
     std::map<std::string, clock_data_t> times_;
 };
 
+/**
+   Profile tool that will attribute time to handlers by sampling
+   which handler is running on a CPU time timer.  Costs much less than
+   timing every call, at the expense of only estimating the share of
+   time spent in each handler.
+ */
+class ClockHandlerProfileToolSample : public ClockHandlerProfileTool
+{
+public:
+    SST_ELI_REGISTER_PROFILETOOL(
+        ClockHandlerProfileToolSample,
+        SST::Profile::ClockHandlerProfileTool,
+        "sst",
+        "profile.handler.clock.sample",
+        SST_ELI_ELEMENT_VERSION(0, 1, 0),
+        "Profiler that will sample which handler functions are running"
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "period", "Sampling period in microseconds of CPU time", "1000" },
+    )
+
+    ClockHandlerProfileToolSample(const std::string& name, Params& params);
+
+    virtual ~ClockHandlerProfileToolSample();
+
+    uintptr_t registerHandler(const HandlerMetaData& mdata) override;
+
+    void handlerStart(uintptr_t key) override
+    {
+        HandlerSampler::enter(reinterpret_cast<HandlerSampler::Counter*>(key));
+    }
+
+    void handlerEnd(uintptr_t UNUSED(key)) override { HandlerSampler::leave(); }
+
+    void outputData(FILE* fp) override;
+
+private:
+    std::map<std::string, HandlerSampler::Counter> samples_;
+};
+
 } // namespace Profile
 } // namespace SST
 
@@ -81,13 +81,15 @@ uintptr_t
 ComponentCodeSegmentProfileToolCount::registerProfilePoint(
     const std::string& point, ComponentId_t id, const std::string& name, const std::string& type)
 {
-    return reinterpret_cast<uintptr_t>(&counts_[getKeyForCodeSegment(point, id, name, type)]);
+    auto key = keys_.emplace(getKeyForCodeSegment(point, id, name, type), counts_.size());
+    if ( key.second ) counts_.push_back(0);
+    return key.first->second;
 }
 
 void
 ComponentCodeSegmentProfileToolCount::codeSegmentStart(uintptr_t key)
 {
-    (*reinterpret_cast<uint64_t*>(key))++;
+    counts_[key]++;
 }
 
 void
@@ -95,9 +97,9 @@ ComponentCodeSegmentProfileToolCount::outputData(FILE* fp)
 {
     fprintf(fp, "%s\n", name.c_str());
     fprintf(fp, "Name, Count\n");
-    for ( auto& x : counts_ ) {
+    for ( auto& x : keys_ ) {
         fprintf(fp, "%s", x.first.c_str());
-        fprintf(fp, ", %" PRIu64 "\n", x.second);
+        fprintf(fp, ", %" PRIu64 "\n", counts_[x.second]);
     }
 }
 
@@ -112,7 +114,9 @@ uintptr_t
 ComponentCodeSegmentProfileToolTime<T>::registerProfilePoint(
     const std::string& point, ComponentId_t id, const std::string& name, const std::string& type)
 {
-    return reinterpret_cast<uintptr_t>(&times_[getKeyForCodeSegment(point, id, name, type)]);
+    auto key = keys_.emplace(getKeyForCodeSegment(point, id, name, type), times_.size());
+    if ( key.second ) times_.emplace_back();
+    return key.first->second;
 }
 
 template <typename T>
@@ -121,11 +125,12 @@ ComponentCodeSegmentProfileToolTime<T>::outputData(FILE* fp)
 {
     fprintf(fp, "%s\n", name.c_str());
     fprintf(fp, "Name, count, time (s), avg time (ns)\n");
-    for ( auto& x : times_ ) {
+    for ( auto& x : keys_ ) {
+        segment_data_t& entry = times_[x.second];
         fprintf(fp, "%s", x.first.c_str());
         fprintf(
-            fp, ", %" PRIu64 ", %lf, %" PRIu64 "\n", x.second.count, ((double)x.second.time) / 1000000000.0,
-            x.second.count == 0 ? 0 : x.second.time / x.second.count);
+            fp, ", %" PRIu64 ", %lf, %" PRIu64 "\n", entry.count, ((double)entry.time) / 1000000000.0,
+            entry.count == 0 ? 0 : entry.time / entry.count);
     }
 }
 
@@ -19,6 +19,7 @@
 
 #include <chrono>
 #include <map>
+#include <vector>
 
 namespace SST {
 
@@ -145,7 +146,10 @@ public:
     void outputData(FILE* fp) override;
 
 private:
-    std::map<std::string, uint64_t> counts_;
+    // Keys are indices into counts_, so the counters are contiguous
+    // and are only matched to names for output
+    std::map<std::string, size_t> keys_;
+    std::vector<uint64_t>         counts_;
 };
 
 /**
@@ -157,8 +161,9 @@ class ComponentCodeSegmentProfileToolTime : public ComponentCodeSegmentProfileTo
 {
     struct segment_data_t
     {
-        uint64_t time;
-        uint64_t count;
+        typename T::time_point start; // Kept per point, so points can be nested
+        uint64_t               time;
+        uint64_t               count;
 
         segment_data_t() : time(0), count(0) {}
     };
@@ -171,21 +176,22 @@ public:
     uintptr_t registerProfilePoint(
         const std::string& point, ComponentId_t id, const std::string& name, const std::string& type) override;
 
-    void codeSegmentStart(uintptr_t UNUSED(key)) override { start_time_ = T::now(); }
+    void codeSegmentStart(uintptr_t key) override { times_[key].start = T::now(); }
 
     void codeSegmentEnd(uintptr_t key) override
     {
-        auto            total_time = T::now() - start_time_;
-        segment_data_t* entry      = reinterpret_cast<segment_data_t*>(key);
-        entry->time += std::chrono::duration_cast<std::chrono::nanoseconds>(total_time).count();
-        entry->count++;
+        segment_data_t& entry      = times_[key];
+        auto            total_time = T::now() - entry.start;
+        entry.time += std::chrono::duration_cast<std::chrono::nanoseconds>(total_time).count();
+        entry.count++;
     }
 
     void outputData(FILE* fp) override;
 
 private:
-    typename T::time_point                start_time_;
-    std::map<std::string, segment_data_t> times_;
+    // Keys are indices into times_, as for the count tool
+    std::map<std::string, size_t> keys_;
+    std::vector<segment_data_t>   times_;
 };
 
 } // namespace Profile
@@ -14,6 +14,7 @@
 #include "sst/core/profile/eventHandlerProfileTool.h"
 
 #include "sst/core/output.h"
+#include "sst/core/simulation_impl.h"
 #include "sst/core/sst_types.h"
 
 #include <chrono>
@@ -112,10 +113,103 @@ EventHandlerProfileToolCount::outputData(FILE* fp)
 }
 
 
+EventHandlerProfileToolSample::EventHandlerProfileToolSample(const std::string& name, Params& params) :
+    EventHandlerProfileTool(name, params)
+{
+    uint64_t period = params.find<uint64_t>("period", 1000);
+    if ( period == 0 ) {
+        Output::getDefaultObject().fatal(
+            CALL_INFO_LONG, 1, "ERROR: period for EventHandlerProfileToolSample must be greater than 0\n");
+    }
+    HandlerSampler::start(period);
+}
+
+EventHandlerProfileToolSample::~EventHandlerProfileToolSample()
+{
+    HandlerSampler::stop();
+}
+
+uintptr_t
+EventHandlerProfileToolSample::registerHandler(const HandlerMetaData& mdata)
+{
+    return reinterpret_cast<uintptr_t>(&samples_[getKeyForHandler(mdata)]);
+}
+
+void
+EventHandlerProfileToolSample::outputData(FILE* fp)
+{
+    HandlerSampler::output(fp, name, samples_);
+}
+
+
+EventHandlerProfileToolComm::EventHandlerProfileToolComm(const std::string& name, Params& params) :
+    EventHandlerProfileTool(name, params),
+    my_rank_(Simulation_impl::getSimulation()->getRank())
+{
+    size_events_      = params.find<bool>("size_events", true);
+    profile_sends_    = true;
+    profile_receives_ = false;
+}
+
+uintptr_t
+EventHandlerProfileToolComm::registerHandler(const HandlerMetaData& mdata)
+{
+    const EventHandlerMetaData& data  = dynamic_cast<const EventHandlerMetaData&>(mdata);
+    link_data_t&                entry = links_[std::make_pair(getKeyForHandler(mdata), data.peer_rank)];
+    entry.remote                      = data.peer_rank.rank != my_rank_.rank;
+    return reinterpret_cast<uintptr_t>(&entry);
+}
+
+void
+EventHandlerProfileToolComm::eventSent(uintptr_t key, Event* ev)
+{
+    link_data_t* entry = reinterpret_cast<link_data_t*>(key);
+    entry->count++;
+    if ( size_events_ && entry->remote ) {
+        sizer_.start_sizing();
+        Activity* act = ev;
+        sizer_&   act;
+        entry->bytes += sizer_.size();
+    }
+}
+
+void
+EventHandlerProfileToolComm::outputData(FILE* fp)
+{
+    std::map<RankInfo, link_data_t> partitions;
+    for ( auto& x : links_ ) {
+        link_data_t& total = partitions[x.first.second];
+        total.count += x.second.count;
+        total.bytes += x.second.bytes;
+    }
+
+    fprintf(fp, "%s\n", name.c_str());
+    fprintf(fp, "Source, destination, events, bytes\n");
+    for ( auto& x : partitions ) {
+        fprintf(
+            fp, "%" PRIu32 ".%" PRIu32 ", %" PRIu32 ".%" PRIu32 ", %" PRIu64 ", %" PRIu64 "\n", my_rank_.rank,
+            my_rank_.thread, x.first.rank, x.first.thread, x.second.count, x.second.bytes);
+    }
+    fprintf(fp, "Link, destination, events, bytes\n");
+    for ( auto& x : links_ ) {
+        fprintf(
+            fp, "%s, %" PRIu32 ".%" PRIu32 ", %" PRIu64 ", %" PRIu64 "\n", x.first.first.c_str(), x.first.second.rank,
+            x.first.second.thread, x.second.count, x.second.bytes);
+    }
+}
+
 template <typename T>
 EventHandlerProfileToolTime<T>::EventHandlerProfileToolTime(const std::string& name, Params& params) :
-    EventHandlerProfileTool(name, params)
-{}
+    EventHandlerProfileTool(name, params),
+    countdown_(1),
+    timing_(false)
+{
+    sample_interval_ = params.find<uint64_t>("sample_interval", 1);
+    if ( sample_interval_ == 0 ) {
+        Output::getDefaultObject().fatal(
+            CALL_INFO_LONG, 1, "ERROR: sample_interval for %s must be greater than 0\n", name.c_str());
+    }
+}
 
 template <typename T>
 uintptr_t
@@ -134,11 +228,15 @@ EventHandlerProfileToolTime<T>::outputData(FILE* fp)
     if ( profile_sends_ ) fprintf(fp, ", send count");
     fprintf(fp, "\n");
     for ( auto& x : times_ ) {
+        // The time of the calls that weren't timed is estimated from
+        // the ones that were
+        double scale = x.second.timed_count == 0 ? 0.0 : (double)x.second.recv_count / x.second.timed_count;
         fprintf(fp, "%s", x.first.c_str());
         if ( profile_receives_ )
             fprintf(
-                fp, ", %" PRIu64 ", %lf, %" PRIu64, x.second.recv_count, ((double)x.second.recv_time) / 1000000000.0,
-                x.second.recv_count == 0 ? 0 : x.second.recv_time / x.second.recv_count);
+                fp, ", %" PRIu64 ", %lf, %" PRIu64, x.second.recv_count,
+                ((double)x.second.recv_time) * scale / 1000000000.0,
+                x.second.timed_count == 0 ? 0 : x.second.recv_time / x.second.timed_count);
         if ( profile_sends_ ) fprintf(fp, ", %" PRIu64, x.second.send_count);
         fprintf(fp, "\n");
     }
@@ -157,6 +255,10 @@ public:
         "Profiler that will time handlers using a high resolution clock"
     )
 
+    SST_ELI_DOCUMENT_PARAMS(
+        { "sample_interval", "Time one in this many handler calls, and scale up the time of each handler to cover its other calls", "1" },
+    )
+
     EventHandlerProfileToolTimeHighResolution(const std::string& name, Params& params) :
         EventHandlerProfileToolTime<std::chrono::high_resolution_clock>(name, params)
     {}
@@ -178,6 +280,10 @@ public:
         "Profiler that will time handlers using a steady clock"
     )
 
+    SST_ELI_DOCUMENT_PARAMS(
+        { "sample_interval", "Time one in this many handler calls, and scale up the time of each handler to cover its other calls", "1" },
+    )
+
     EventHandlerProfileToolTimeSteady(const std::string& name, Params& params) :
         EventHandlerProfileToolTime<std::chrono::steady_clock>(name, params)
     {}
@@ -15,11 +15,15 @@
 #include "sst/core/eli/elementinfo.h"
 #include "sst/core/event.h"
 #include "sst/core/sst_types.h"
+#include "sst/core/profile/handlerSampler.h"
+#include "sst/core/rankInfo.h"
+#include "sst/core/serialization/serializer.h"
 #include "sst/core/ssthandler.h"
 #include "sst/core/warnmacros.h"
 
 #include <chrono>
 #include <map>
+#include <utility>
 
 namespace SST {
 
@@ -97,6 +101,59 @@ private:
     std::map<std::string, event_data_t> counts_;
 };
 
+/**
+   Profile tool that will count the events and serialized bytes sent
+   between partitions.  Output has the traffic from this partition to
+   each partition it sends to, followed by the traffic on each link
+   (at the level the tool is set to).  Bytes are only counted for
+   events sent to other ranks, since events between threads of a rank
+   aren't serialized.  Sends are always profiled and receives never
+   are.
+ */
+class EventHandlerProfileToolComm : public EventHandlerProfileTool
+{
+    struct link_data_t
+    {
+        uint64_t count;
+        uint64_t bytes;
+        bool     remote; // Peer is on another rank, so events are serialized
+
+        link_data_t() : count(0), bytes(0), remote(false) {}
+    };
+
+public:
+    SST_ELI_REGISTER_PROFILETOOL(
+        EventHandlerProfileToolComm,
+        SST::Profile::EventHandlerProfileTool,
+        "sst",
+        "profile.handler.event.comm",
+        SST_ELI_ELEMENT_VERSION(0, 1, 0),
+        "Profiler that will count events and bytes sent between partitions"
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "size_events", "Controls whether the serialized size of events sent to other ranks is measured", "true" },
+    )
+
+    EventHandlerProfileToolComm(const std::string& name, Params& params);
+
+    virtual ~EventHandlerProfileToolComm() {}
+
+    uintptr_t registerHandler(const HandlerMetaData& mdata) override;
+
+    void eventSent(uintptr_t key, Event* ev) override;
+
+    void outputData(FILE* fp) override;
+
+private:
+    RankInfo my_rank_;
+    bool     size_events_;
+
+    SST::Core::Serialization::serializer sizer_;
+
+    std::map<std::pair<std::string, RankInfo>, link_data_t> links_;
+};
+
 /**
    Profile tool that will count the number of times a handler is
    called
@@ -106,11 +163,12 @@ class EventHandlerProfileToolTime : public EventHandlerProfileTool
 {
     struct event_data_t
     {
-        uint64_t recv_time;
+        uint64_t recv_time; // Of the timed calls only
         uint64_t recv_count;
+        uint64_t timed_count;
         uint64_t send_count;
 
-        event_data_t() : recv_time(0), recv_count(0), send_count(0) {}
+        event_data_t() : recv_time(0), recv_count(0), timed_count(0), send_count(0) {}
     };
 
 public:
@@ -120,14 +178,24 @@ public:
 
     uintptr_t registerHandler(const HandlerMetaData& mdata) override;
 
-    void handlerStart(uintptr_t UNUSED(key)) override { start_time_ = T::now(); }
+    void handlerStart(uintptr_t UNUSED(key)) override
+    {
+        // Only one in sample_interval_ calls is timed, counted down
+        // across all the handlers
+        timing_ = --countdown_ == 0;
+        if ( !timing_ ) return;
+        countdown_  = sample_interval_;
+        start_time_ = T::now();
+    }
 
     void handlerEnd(uintptr_t key) override
     {
-        auto          total_time = T::now() - start_time_;
-        event_data_t* entry      = reinterpret_cast<event_data_t*>(key);
-        entry->recv_time += std::chrono::duration_cast<std::chrono::nanoseconds>(total_time).count();
+        event_data_t* entry = reinterpret_cast<event_data_t*>(key);
         entry->recv_count++;
+        if ( !timing_ ) return;
+        auto total_time = T::now() - start_time_;
+        entry->recv_time += std::chrono::duration_cast<std::chrono::nanoseconds>(total_time).count();
+        entry->timed_count++;
     }
 
     void eventSent(uintptr_t key, Event* UNUSED(ev)) override { reinterpret_cast<event_data_t*>(key)->send_count++; }
@@ -136,9 +204,53 @@ public:
 
 private:
     typename T::time_point              start_time_;
+    uint64_t                            sample_interval_;
+    uint64_t                            countdown_;
+    bool                                timing_;
     std::map<std::string, event_data_t> times_;
 };
 
+/**
+   Profile tool that will attribute time to handlers by sampling
+   which handler is running on a CPU time timer.  Costs much less than
+   timing every call, at the expense of only estimating the share of
+   time spent in each handler.
+ */
+class EventHandlerProfileToolSample : public EventHandlerProfileTool
+{
+public:
+    SST_ELI_REGISTER_PROFILETOOL(
+        EventHandlerProfileToolSample,
+        SST::Profile::EventHandlerProfileTool,
+        "sst",
+        "profile.handler.event.sample",
+        SST_ELI_ELEMENT_VERSION(0, 1, 0),
+        "Profiler that will sample which handler functions are running"
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "period", "Sampling period in microseconds of CPU time", "1000" },
+    )
+
+    EventHandlerProfileToolSample(const std::string& name, Params& params);
+
+    virtual ~EventHandlerProfileToolSample();
+
+    uintptr_t registerHandler(const HandlerMetaData& mdata) override;
+
+    void handlerStart(uintptr_t key) override
+    {
+        HandlerSampler::enter(reinterpret_cast<HandlerSampler::Counter*>(key));
+    }
+
+    void handlerEnd(uintptr_t UNUSED(key)) override { HandlerSampler::leave(); }
+
+    void outputData(FILE* fp) override;
+
+private:
+    std::map<std::string, HandlerSampler::Counter> samples_;
+};
+
 } // namespace Profile
 } // namespace SST
 
@@ -0,0 +1,189 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/profile/eventTraceProfileTool.h"
+
+#include "sst/core/output.h"
+#include "sst/core/serialization/serializer.h"
+#include "sst/core/simulation_impl.h"
+
+#include <cerrno>
+#include <cstring>
+
+namespace SST {
+namespace Profile {
+
+static const uint32_t trace_version = 1;
+
+EventHandlerProfileToolTrace::EventHandlerProfileToolTrace(const std::string& name, Params& params) :
+    EventHandlerProfileTool(name, params),
+    sim_(Simulation_impl::getSimulation()),
+    last_type_info_(nullptr),
+    last_type_(0),
+    dropped_(0),
+    tail_cache_(0),
+    stop_(false)
+{
+    RankInfo rank = sim_->getRank();
+
+    filename_ = params.find<std::string>("file", "sst_trace") + "_" + std::to_string(rank.rank) + "_" +
+                std::to_string(rank.thread) + ".sstt";
+    record_size_ = params.find<bool>("record_size", false);
+
+    uint64_t size = params.find<uint64_t>("buffer_size", 65536);
+    uint64_t capacity = 1;
+    while ( capacity < size )
+        capacity <<= 1;
+    buffer_.resize(capacity);
+    mask_ = capacity - 1;
+    head_.store(0);
+    tail_.store(0);
+
+    fp_ = fopen(filename_.c_str(), "wb");
+    if ( nullptr == fp_ ) {
+        Output::getDefaultObject().fatal(
+            CALL_INFO_LONG, 1, "ERROR: Unable to open trace file %s: %s\n", filename_.c_str(), strerror(errno));
+    }
+
+    uint32_t header[4] = { trace_version, rank.rank, rank.thread, sizeof(TraceRecord) };
+    fwrite("SSTTRACE", 1, 8, fp_);
+    fwrite(header, sizeof(uint32_t), 4, fp_);
+
+    flusher_ = std::thread(&EventHandlerProfileToolTrace::flushLoop, this);
+}
+
+EventHandlerProfileToolTrace::~EventHandlerProfileToolTrace()
+{
+    finish();
+}
+
+uintptr_t
+EventHandlerProfileToolTrace::registerHandler(const HandlerMetaData& mdata)
+{
+    handlers_.push_back(getKeyForHandler(mdata));
+    return handlers_.size() - 1;
+}
+
+SimTime_t
+EventHandlerProfileToolTrace::simTime()
+{
+    return sim_->getCurrentSimCycle();
+}
+
+void
+EventHandlerProfileToolTrace::eventSent(uintptr_t key, Event* ev)
+{
+    // Events of one type are usually sent in runs, so the type table
+    // is only searched when the type changes.  cls_id() can't be used,
+    // since it aborts for events that are not serializable.
+    const std::type_info& info = typeid(*ev);
+    if ( &info != last_type_info_ ) {
+        auto it = types_.find(info);
+        if ( it == types_.end() ) {
+            it = types_.emplace(info, type_names_.size()).first;
+            type_names_.push_back(ev->cls_name());
+        }
+        last_type_info_ = &info;
+        last_type_      = it->second;
+    }
+
+    uint32_t size = 0;
+    if ( record_size_ ) {
+        SST::Core::Serialization::serializer ser;
+        ser.start_sizing();
+        ser& ev;
+        size = ser.size();
+    }
+
+    push({ simTime(), wallTime(), (uint32_t)key, last_type_, size, SEND });
+}
+
+void
+EventHandlerProfileToolTrace::flushLoop()
+{
+    std::unique_lock<std::mutex> lock(flush_lock_);
+    while ( !stop_ ) {
+        lock.unlock();
+        writeRecords();
+        lock.lock();
+        flush_cv_.wait_for(lock, std::chrono::milliseconds(1));
+    }
+}
+
+void
+EventHandlerProfileToolTrace::writeRecords()
+{
+    uint64_t tail = tail_.load(std::memory_order_relaxed);
+    uint64_t head = head_.load(std::memory_order_acquire);
+
+    // The records between tail and head are at most two runs in the
+    // buffer, since it wraps around
+    while ( tail != head ) {
+        uint64_t start = tail & mask_;
+        uint64_t count = std::min(head - tail, (uint64_t)buffer_.size() - start);
+        fwrite(&buffer_[start], sizeof(TraceRecord), count, fp_);
+        tail += count;
+        tail_.store(tail, std::memory_order_release);
+    }
+}
+
+void
+EventHandlerProfileToolTrace::finish()
+{
+    if ( nullptr == fp_ ) return;
+
+    {
+        std::lock_guard<std::mutex> lock(flush_lock_);
+        stop_ = true;
+    }
+    flush_cv_.notify_one();
+    flusher_.join();
+
+    // The flusher has stopped, so write whatever it left
+    writeRecords();
+    TraceRecord end = { simTime(), wallTime(), 0, 0, 0, END };
+    fwrite(&end, sizeof(TraceRecord), 1, fp_);
+
+    uint32_t count = handlers_.size();
+    fwrite(&count, sizeof(count), 1, fp_);
+    for ( auto& name : handlers_ ) {
+        uint32_t len = name.size();
+        fwrite(&len, sizeof(len), 1, fp_);
+        fwrite(name.data(), 1, len, fp_);
+    }
+
+    count = type_names_.size();
+    fwrite(&count, sizeof(count), 1, fp_);
+    for ( auto* type : type_names_ ) {
+        uint32_t len = strlen(type);
+        fwrite(&len, sizeof(len), 1, fp_);
+        fwrite(type, 1, len, fp_);
+    }
+
+    fwrite(&dropped_, sizeof(dropped_), 1, fp_);
+    fclose(fp_);
+    fp_ = nullptr;
+}
+
+void
+EventHandlerProfileToolTrace::outputData(FILE* fp)
+{
+    finish();
+
+    fprintf(fp, "%s\n", name.c_str());
+    fprintf(fp, "Trace file, records dropped\n");
+    fprintf(fp, "%s, %" PRIu64 "\n", filename_.c_str(), dropped_);
+}
+
+} // namespace Profile
+} // namespace SST
@@ -0,0 +1,170 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_PROFILE_EVENTTRACEPROFILETOOL_H
+#define SST_CORE_PROFILE_EVENTTRACEPROFILETOOL_H
+
+#include "sst/core/profile/eventHandlerProfileTool.h"
+#include "sst/core/threadsafe.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+namespace SST {
+
+class Simulation_impl;
+
+namespace Profile {
+
+/**
+   Profile tool that records a timeline of event sends and handler
+   calls.  Each record is a fixed size binary struct, written by the
+   simulation thread into a lock-free ring buffer.  A flusher thread
+   owned by the tool drains the ring buffer to a file, so the
+   simulation thread never does any I/O.  If the flusher falls behind
+   and the ring buffer is full, records are dropped and counted.
+
+   There is one tool, and so one file, per thread.  The file is
+   "<file>_<rank>_<thread>.sstt" and is laid out as:
+
+     Header       "SSTTRACE", then uint32 version, rank, thread and
+                  record size
+     Records      TraceRecord, up to a record with kind END
+     Handlers     uint32 count, then per handler uint32 length and name
+     Event types  uint32 count, then per type uint32 length and name
+     Dropped      uint64 number of records dropped
+
+   All values are in the native byte order.  sst-trace-to-chrome
+   converts the files of a run to the Chrome/Perfetto trace format.
+ */
+class EventHandlerProfileToolTrace : public EventHandlerProfileTool
+{
+public:
+    SST_ELI_REGISTER_PROFILETOOL(
+        EventHandlerProfileToolTrace,
+        SST::Profile::EventHandlerProfileTool,
+        "sst",
+        "profile.handler.event.trace",
+        SST_ELI_ELEMENT_VERSION(0, 1, 0),
+        "Profiler that writes a binary timeline of event sends and handler calls"
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "file", "Prefix of the trace files, one per rank and thread", "sst_trace" },
+        { "buffer_size", "Number of records in the ring buffer of each thread, rounded up to a power of 2", "65536" },
+        { "record_size", "Record the serialized size of sent events.  Each event is sized when it is sent, and all events sent must be serializable", "false" },
+    )
+
+    enum TraceKind : uint32_t { SEND = 0, RECV = 1, END = 2 };
+
+    /** Record written for each send and each handler call */
+    struct TraceRecord
+    {
+        uint64_t time;     // Simulated time, in core time units
+        uint64_t wall;     // Steady clock time in ns (start of the handler for RECV)
+        uint32_t handler;  // Index of the handler in the handler table
+        uint32_t type;     // Index of the sent event type in the type table, unused for RECV
+        uint32_t value;    // Serialized size for SEND, duration in ns for RECV
+        uint32_t kind;     // TraceKind
+    };
+
+    EventHandlerProfileToolTrace(const std::string& name, Params& params);
+
+    virtual ~EventHandlerProfileToolTrace();
+
+    uintptr_t registerHandler(const HandlerMetaData& mdata) override;
+
+    void handlerStart(uintptr_t UNUSED(key)) override { start_times_.push_back(wallTime()); }
+
+    void handlerEnd(uintptr_t key) override
+    {
+        uint64_t start = start_times_.back();
+        start_times_.pop_back();
+        uint64_t duration = wallTime() - start;
+        push({ simTime(), start, (uint32_t)key, 0, duration > UINT32_MAX ? UINT32_MAX : (uint32_t)duration, RECV });
+    }
+
+    void eventSent(uintptr_t key, Event* ev) override;
+
+    void outputData(FILE* fp) override;
+
+private:
+    static uint64_t wallTime()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    SimTime_t simTime();
+
+    /** Add a record to the ring buffer.  Only called on the thread
+     * the tool belongs to. */
+    void push(const TraceRecord& rec)
+    {
+        uint64_t head = head_.load(std::memory_order_relaxed);
+        if ( head - tail_cache_ > mask_ ) {
+            tail_cache_ = tail_.load(std::memory_order_acquire);
+            if ( head - tail_cache_ > mask_ ) {
+                dropped_++;
+                return;
+            }
+        }
+        buffer_[head & mask_] = rec;
+        head_.store(head + 1, std::memory_order_release);
+    }
+
+    void flushLoop();
+    void writeRecords();
+    void finish();
+
+    Simulation_impl*      sim_;
+    std::string           filename_;
+    FILE*                 fp_;
+    bool                  record_size_;
+    std::vector<uint64_t> start_times_;
+
+    // Handler names, indexed by key, and names of the sent event
+    // types, indexed by type
+    std::vector<std::string>                      handlers_;
+    std::vector<const char*>                      type_names_;
+    std::unordered_map<std::type_index, uint32_t> types_;
+    const std::type_info*                         last_type_info_;
+    uint32_t                                      last_type_;
+
+    // Ring buffer.  head_ is only written by the simulation thread and
+    // tail_ only by the flusher, so they are kept on separate cache
+    // lines.
+    std::vector<TraceRecord> buffer_;
+    uint64_t                 mask_;
+    uint64_t                 dropped_;
+    uint64_t                 tail_cache_;
+    CACHE_ALIGNED(std::atomic<uint64_t>, head_);
+    CACHE_ALIGNED(std::atomic<uint64_t>, tail_);
+
+    std::thread             flusher_;
+    std::mutex              flush_lock_;
+    std::condition_variable flush_cv_;
+    bool                    stop_;
+};
+
+} // namespace Profile
+} // namespace SST
+
+#endif // SST_CORE_PROFILE_EVENTTRACEPROFILETOOL_H
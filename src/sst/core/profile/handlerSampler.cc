@@ -0,0 +1,106 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#include "sst_config.h"
+
+#include "sst/core/profile/handlerSampler.h"
+
+#include "sst/core/output.h"
+#include "sst/core/warnmacros.h"
+
+#include <cerrno>
+#include <csignal>
+#include <mutex>
+#include <sys/time.h>
+
+namespace SST {
+namespace Profile {
+
+// Only touched by the signal handler and output(), so don't need
+// to be ordered with anything else
+static std::atomic<uint64_t> total_samples { 0 };
+static std::atomic<uint64_t> core_samples { 0 };
+
+static std::mutex       timer_lock;
+static int              timer_users = 0;
+static uint64_t         timer_period_us;
+static struct sigaction saved_action;
+
+void
+HandlerSampler::handleSignal(int UNUSED(sig))
+{
+    int saved_errno = errno;
+    total_samples.fetch_add(1, std::memory_order_relaxed);
+    Counter* counter = current_;
+    if ( counter )
+        counter->samples.fetch_add(1, std::memory_order_relaxed);
+    else
+        core_samples.fetch_add(1, std::memory_order_relaxed);
+    errno = saved_errno;
+}
+
+void
+HandlerSampler::start(uint64_t period_us)
+{
+    std::lock_guard<std::mutex> lock(timer_lock);
+    if ( timer_users++ > 0 ) return;
+
+    timer_period_us = period_us;
+
+    struct sigaction action;
+    action.sa_handler = &HandlerSampler::handleSignal;
+    sigemptyset(&action.sa_mask);
+    // Don't make the rest of the simulator deal with EINTR
+    action.sa_flags = SA_RESTART;
+    if ( sigaction(SIGPROF, &action, &saved_action) != 0 ) {
+        Output::getDefaultObject().fatal(CALL_INFO, 1, "ERROR: unable to install SIGPROF handler for sampling\n");
+    }
+
+    struct itimerval timer;
+    timer.it_interval.tv_sec  = period_us / 1000000;
+    timer.it_interval.tv_usec = period_us % 1000000;
+    timer.it_value            = timer.it_interval;
+    if ( setitimer(ITIMER_PROF, &timer, nullptr) != 0 ) {
+        Output::getDefaultObject().fatal(CALL_INFO, 1, "ERROR: unable to start profiling timer for sampling\n");
+    }
+}
+
+void
+HandlerSampler::stop()
+{
+    std::lock_guard<std::mutex> lock(timer_lock);
+    if ( --timer_users > 0 ) return;
+
+    struct itimerval timer = {};
+    setitimer(ITIMER_PROF, &timer, nullptr);
+    sigaction(SIGPROF, &saved_action, nullptr);
+}
+
+void
+HandlerSampler::output(FILE* fp, const std::string& name, const std::map<std::string, Counter>& counters)
+{
+    uint64_t total = total_samples.load(std::memory_order_relaxed);
+    fprintf(fp, "%s\n", name.c_str());
+    fprintf(
+        fp, "Sample period (us) = %" PRIu64 ", total samples = %" PRIu64 ", core samples = %" PRIu64 "\n",
+        timer_period_us, total, core_samples.load(std::memory_order_relaxed));
+    fprintf(fp, "Name, samples, percent of samples\n");
+    for ( auto& x : counters ) {
+        uint64_t samples = x.second.samples.load(std::memory_order_relaxed);
+        fprintf(
+            fp, "%s, %" PRIu64 ", %.2lf\n", x.first.c_str(), samples,
+            total == 0 ? 0.0 : 100.0 * (double)samples / (double)total);
+    }
+}
+
+} // namespace Profile
+} // namespace SST
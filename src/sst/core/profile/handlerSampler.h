@@ -0,0 +1,74 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef SST_CORE_PROFILE_HANDLERSAMPLER_H
+#define SST_CORE_PROFILE_HANDLERSAMPLER_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <string>
+
+namespace SST {
+namespace Profile {
+
+/**
+   Statistical sampler for the handler profile tools.
+
+   A SIGPROF timer interrupts the process every period of CPU time.
+   While a sampled handler runs, its thread's slot points at the
+   counter for the handler, and the signal handler adds one to
+   whichever counter the interrupted thread was pointing at.  Handlers
+   only pay for setting and clearing the slot, so the overhead doesn't
+   depend on how short the handlers are.
+
+   Samples taken while no sampled handler was running are counted as
+   core time (time vortex, syncs, clocks or events that aren't being
+   sampled, etc).  The timer is shared by all the sampling tools and
+   runs from when the first one is created until the last one is
+   destroyed.
+ */
+class HandlerSampler
+{
+public:
+    struct Counter
+    {
+        std::atomic<uint64_t> samples { 0 };
+    };
+
+    /** Start the timer, if it isn't already running.  The period of
+     * the first tool to start is used for all of them */
+    static void start(uint64_t period_us);
+
+    /** Stop the timer once every tool that started it is done */
+    static void stop();
+
+    /** Attribute samples on this thread to counter */
+    static void enter(Counter* counter) { current_ = counter; }
+
+    /** Attribute samples on this thread to the core */
+    static void leave() { current_ = nullptr; }
+
+    /** Write samples per key as a share of all the samples taken */
+    static void output(FILE* fp, const std::string& name, const std::map<std::string, Counter>& counters);
+
+private:
+    static void handleSignal(int sig);
+
+    static inline thread_local Counter* current_ = nullptr;
+};
+
+} // namespace Profile
+} // namespace SST
+
+#endif // SST_CORE_PROFILE_HANDLERSAMPLER_H
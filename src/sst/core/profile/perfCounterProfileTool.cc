@@ -0,0 +1,204 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+// The hardware counter tools are only built where perf_event is
+// available
+#ifdef HAVE_LINUX_PERF_EVENT_H
+
+#include "sst/core/profile/perfCounterProfileTool.h"
+
+#include "sst/core/output.h"
+
+#include <cerrno>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace SST {
+namespace Profile {
+
+static const struct
+{
+    uint64_t    config;
+    const char* name;
+} perf_counters[PerfCounterGroup::NUM_COUNTERS] = {
+    { PERF_COUNT_HW_CPU_CYCLES, "cycles" },
+    { PERF_COUNT_HW_INSTRUCTIONS, "instructions" },
+    { PERF_COUNT_HW_CACHE_MISSES, "LLC misses" },
+    { PERF_COUNT_HW_BRANCH_MISSES, "branch misses" },
+};
+
+PerfCounterGroup::PerfCounterGroup(const std::string& tool_name) : leader_fd_(-1), num_open_(0), start_()
+{
+    int first_errno = 0;
+    for ( int i = 0; i < NUM_COUNTERS; ++i ) {
+        struct perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size        = sizeof(attr);
+        attr.type        = PERF_TYPE_HARDWARE;
+        attr.config      = perf_counters[i].config;
+        attr.read_format = PERF_FORMAT_GROUP;
+        // Only count user space, which also keeps the counters usable
+        // with the default perf_event_paranoid setting
+        attr.exclude_kernel = 1;
+        attr.exclude_hv     = 1;
+
+        // pid 0 and cpu -1 count the calling thread on any cpu
+        fds_[i] = syscall(__NR_perf_event_open, &attr, 0, -1, leader_fd_, 0);
+        if ( fds_[i] < 0 ) {
+            if ( 0 == first_errno ) first_errno = errno;
+            index_[i] = -1;
+            continue;
+        }
+        if ( leader_fd_ < 0 ) leader_fd_ = fds_[i];
+        index_[i] = num_open_++;
+    }
+
+    if ( 0 == num_open_ ) {
+        Output::getDefaultObject().fatal(
+            CALL_INFO_LONG, 1,
+            "ERROR: %s was unable to open any hardware counters: %s.  Check that the processor exposes hardware "
+            "counters and that /proc/sys/kernel/perf_event_paranoid allows user space counting\n",
+            tool_name.c_str(), strerror(first_errno));
+    }
+
+    ioctl(leader_fd_, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(leader_fd_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+PerfCounterGroup::~PerfCounterGroup()
+{
+    for ( int i = 0; i < NUM_COUNTERS; ++i ) {
+        if ( fds_[i] >= 0 ) close(fds_[i]);
+    }
+}
+
+void
+PerfCounterGroup::read(uint64_t* values)
+{
+    // With PERF_FORMAT_GROUP the leader returns the number of counters
+    // followed by the value of each
+    uint64_t buf[1 + NUM_COUNTERS];
+    if ( ::read(leader_fd_, buf, sizeof(buf)) < 0 ) return;
+    for ( int i = 0; i < NUM_COUNTERS; ++i )
+        values[i] = index_[i] < 0 ? 0 : buf[1 + index_[i]];
+}
+
+void
+PerfCounterGroup::printHeader(FILE* fp)
+{
+    for ( int i = 0; i < NUM_COUNTERS; ++i ) {
+        if ( index_[i] >= 0 ) fprintf(fp, ", %s", perf_counters[i].name);
+    }
+    if ( index_[CYCLES] >= 0 && index_[INSTRUCTIONS] >= 0 ) fprintf(fp, ", IPC");
+}
+
+void
+PerfCounterGroup::printValues(FILE* fp, const counter_data_t& entry)
+{
+    for ( int i = 0; i < NUM_COUNTERS; ++i ) {
+        if ( index_[i] >= 0 ) fprintf(fp, ", %" PRIu64, entry.counters[i]);
+    }
+    if ( index_[CYCLES] >= 0 && index_[INSTRUCTIONS] >= 0 ) {
+        fprintf(
+            fp, ", %lf",
+            entry.counters[CYCLES] == 0 ? 0.0
+                                        : (double)entry.counters[INSTRUCTIONS] / (double)entry.counters[CYCLES]);
+    }
+}
+
+
+ClockHandlerProfileToolPerf::ClockHandlerProfileToolPerf(const std::string& name, Params& params) :
+    ClockHandlerProfileTool(name, params),
+    counters_(name)
+{}
+
+uintptr_t
+ClockHandlerProfileToolPerf::registerHandler(const HandlerMetaData& mdata)
+{
+    return reinterpret_cast<uintptr_t>(&data_[getKeyForHandler(mdata)]);
+}
+
+void
+ClockHandlerProfileToolPerf::outputData(FILE* fp)
+{
+    fprintf(fp, "%s\n", name.c_str());
+    fprintf(fp, "Name, count");
+    counters_.printHeader(fp);
+    fprintf(fp, "\n");
+    for ( auto& x : data_ ) {
+        fprintf(fp, "%s, %" PRIu64, x.first.c_str(), x.second.count);
+        counters_.printValues(fp, x.second);
+        fprintf(fp, "\n");
+    }
+}
+
+
+EventHandlerProfileToolPerf::EventHandlerProfileToolPerf(const std::string& name, Params& params) :
+    EventHandlerProfileTool(name, params),
+    counters_(name)
+{}
+
+uintptr_t
+EventHandlerProfileToolPerf::registerHandler(const HandlerMetaData& mdata)
+{
+    return reinterpret_cast<uintptr_t>(&data_[getKeyForHandler(mdata)]);
+}
+
+void
+EventHandlerProfileToolPerf::outputData(FILE* fp)
+{
+    fprintf(fp, "%s\n", name.c_str());
+    fprintf(fp, "Name, recv count, send count");
+    counters_.printHeader(fp);
+    fprintf(fp, "\n");
+    for ( auto& x : data_ ) {
+        fprintf(fp, "%s, %" PRIu64 ", %" PRIu64, x.first.c_str(), x.second.count, x.second.send_count);
+        counters_.printValues(fp, x.second);
+        fprintf(fp, "\n");
+    }
+}
+
+
+ComponentCodeSegmentProfileToolPerf::ComponentCodeSegmentProfileToolPerf(const std::string& name, Params& params) :
+    ComponentCodeSegmentProfileTool(name, params),
+    counters_(name)
+{}
+
+uintptr_t
+ComponentCodeSegmentProfileToolPerf::registerProfilePoint(
+    const std::string& point, ComponentId_t id, const std::string& name, const std::string& type)
+{
+    return reinterpret_cast<uintptr_t>(&data_[getKeyForCodeSegment(point, id, name, type)]);
+}
+
+void
+ComponentCodeSegmentProfileToolPerf::outputData(FILE* fp)
+{
+    fprintf(fp, "%s\n", name.c_str());
+    fprintf(fp, "Name, count");
+    counters_.printHeader(fp);
+    fprintf(fp, "\n");
+    for ( auto& x : data_ ) {
+        fprintf(fp, "%s, %" PRIu64, x.first.c_str(), x.second.count);
+        counters_.printValues(fp, x.second);
+        fprintf(fp, "\n");
+    }
+}
+
+} // namespace Profile
+} // namespace SST
+
+#endif // HAVE_LINUX_PERF_EVENT_H
@@ -0,0 +1,199 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_PROFILE_PERFCOUNTERPROFILETOOL_H
+#define SST_CORE_PROFILE_PERFCOUNTERPROFILETOOL_H
+
+#include "sst/core/profile/clockHandlerProfileTool.h"
+#include "sst/core/profile/componentProfileTool.h"
+#include "sst/core/profile/eventHandlerProfileTool.h"
+
+#include <cstdio>
+#include <map>
+#include <string>
+
+namespace SST {
+namespace Profile {
+
+/**
+   Group of hardware counters read through perf_event.  The counters
+   count user space events of the thread that created the group, and
+   all of them are read with a single read() call.  Counters the
+   kernel or the processor does not support are left out; if none of
+   them can be opened, the simulation is stopped.
+ */
+class PerfCounterGroup
+{
+public:
+    enum Counter { CYCLES = 0, INSTRUCTIONS, CACHE_MISSES, BRANCH_MISSES, NUM_COUNTERS };
+
+    /** Counter totals of one profiled handler or code segment */
+    struct counter_data_t
+    {
+        uint64_t count;
+        uint64_t counters[NUM_COUNTERS];
+
+        counter_data_t() : count(0), counters() {}
+    };
+
+    /** Opens the counters.  Must be called on the thread to be
+     * counted. */
+    explicit PerfCounterGroup(const std::string& tool_name);
+    ~PerfCounterGroup();
+
+    void start() { read(start_); }
+
+    /** Adds the counts since the last start() to entry */
+    void end(counter_data_t* entry)
+    {
+        uint64_t now[NUM_COUNTERS];
+        read(now);
+        for ( int i = 0; i < NUM_COUNTERS; ++i )
+            entry->counters[i] += now[i] - start_[i];
+        entry->count++;
+    }
+
+    /** Prints the names of the open counters, starting with a comma */
+    void printHeader(FILE* fp);
+    /** Prints the values of the open counters, starting with a comma */
+    void printValues(FILE* fp, const counter_data_t& entry);
+
+private:
+    void read(uint64_t* values);
+
+    int      leader_fd_;
+    int      fds_[NUM_COUNTERS];
+    // Position of each open counter in the values returned by read()
+    int      index_[NUM_COUNTERS];
+    int      num_open_;
+    uint64_t start_[NUM_COUNTERS];
+};
+
+
+/**
+   Profile tool that will read hardware counters around clock handlers
+ */
+class ClockHandlerProfileToolPerf : public ClockHandlerProfileTool
+{
+public:
+    SST_ELI_REGISTER_PROFILETOOL(
+        ClockHandlerProfileToolPerf,
+        SST::Profile::ClockHandlerProfileTool,
+        "sst",
+        "profile.handler.clock.perf",
+        SST_ELI_ELEMENT_VERSION(0, 1, 0),
+        "Profiler that will count cycles, instructions, cache misses and branch misses in handlers using perf_event"
+    )
+
+    ClockHandlerProfileToolPerf(const std::string& name, Params& params);
+
+    virtual ~ClockHandlerProfileToolPerf() {}
+
+    uintptr_t registerHandler(const HandlerMetaData& mdata) override;
+
+    void handlerStart(uintptr_t UNUSED(key)) override { counters_.start(); }
+
+    void handlerEnd(uintptr_t key) override
+    {
+        counters_.end(reinterpret_cast<PerfCounterGroup::counter_data_t*>(key));
+    }
+
+    void outputData(FILE* fp) override;
+
+private:
+    PerfCounterGroup                                        counters_;
+    std::map<std::string, PerfCounterGroup::counter_data_t> data_;
+};
+
+
+/**
+   Profile tool that will read hardware counters around event handlers
+ */
+class EventHandlerProfileToolPerf : public EventHandlerProfileTool
+{
+    struct event_data_t : public PerfCounterGroup::counter_data_t
+    {
+        uint64_t send_count;
+
+        event_data_t() : send_count(0) {}
+    };
+
+public:
+    SST_ELI_REGISTER_PROFILETOOL(
+        EventHandlerProfileToolPerf,
+        SST::Profile::EventHandlerProfileTool,
+        "sst",
+        "profile.handler.event.perf",
+        SST_ELI_ELEMENT_VERSION(0, 1, 0),
+        "Profiler that will count cycles, instructions, cache misses and branch misses in handlers using perf_event"
+    )
+
+    EventHandlerProfileToolPerf(const std::string& name, Params& params);
+
+    virtual ~EventHandlerProfileToolPerf() {}
+
+    uintptr_t registerHandler(const HandlerMetaData& mdata) override;
+
+    void handlerStart(uintptr_t UNUSED(key)) override { counters_.start(); }
+
+    void handlerEnd(uintptr_t key) override { counters_.end(reinterpret_cast<event_data_t*>(key)); }
+
+    void eventSent(uintptr_t key, Event* UNUSED(ev)) override { reinterpret_cast<event_data_t*>(key)->send_count++; }
+
+    void outputData(FILE* fp) override;
+
+private:
+    PerfCounterGroup                    counters_;
+    std::map<std::string, event_data_t> data_;
+};
+
+
+/**
+   Profile tool that will read hardware counters around marked code
+   segments
+ */
+class ComponentCodeSegmentProfileToolPerf : public ComponentCodeSegmentProfileTool
+{
+public:
+    SST_ELI_REGISTER_PROFILETOOL(
+        ComponentCodeSegmentProfileToolPerf,
+        SST::Profile::ComponentCodeSegmentProfileTool,
+        "sst",
+        "profile.component.codesegment.perf",
+        SST_ELI_ELEMENT_VERSION(0, 1, 0),
+        "Profiler that will count cycles, instructions, cache misses and branch misses in marked code segments using perf_event"
+    )
+
+    ComponentCodeSegmentProfileToolPerf(const std::string& name, Params& params);
+
+    virtual ~ComponentCodeSegmentProfileToolPerf() {}
+
+    uintptr_t registerProfilePoint(
+        const std::string& point, ComponentId_t id, const std::string& name, const std::string& type) override;
+
+    void codeSegmentStart(uintptr_t UNUSED(key)) override { counters_.start(); }
+
+    void codeSegmentEnd(uintptr_t key) override
+    {
+        counters_.end(reinterpret_cast<PerfCounterGroup::counter_data_t*>(key));
+    }
+
+    void outputData(FILE* fp) override;
+
+private:
+    PerfCounterGroup                                        counters_;
+    std::map<std::string, PerfCounterGroup::counter_data_t> data_;
+};
+
+} // namespace Profile
+} // namespace SST
+
+#endif // SST_CORE_PROFILE_PERFCOUNTERPROFILETOOL_H
@@ -24,6 +24,38 @@ namespace Profile {
 
 SyncProfileTool::SyncProfileTool(const std::string& name, Params& UNUSED(params)) : ProfileTool(name) {}
 
+const char*
+SyncProfileTool::getPhaseName(Phase phase)
+{
+    switch ( phase ) {
+    case SERIALIZE:
+        return "Serialize";
+    case MPI_WAIT:
+        return "MPI Wait";
+    case DESERIALIZE:
+        return "Deserialize";
+    case BARRIER:
+        return "Barrier";
+    case THREAD_SYNC:
+        return "Thread Sync";
+    default:
+        return "Unknown";
+    }
+}
+
+// Prints the number of messages and bytes sent to each rank
+static void
+outputSentData(FILE* fp, const std::map<uint32_t, std::pair<uint64_t, uint64_t>>& sent_data)
+{
+    if ( sent_data.empty() ) return;
+    fprintf(fp, "  Data Sent:\n");
+    for ( auto& x : sent_data ) {
+        fprintf(
+            fp, "    Rank %" PRIu32 ": %" PRIu64 " messages, %" PRIu64 " bytes\n", x.first, x.second.first,
+            x.second.second);
+    }
+}
+
 SyncProfileToolCount::SyncProfileToolCount(const std::string& name, Params& params) : SyncProfileTool(name, params) {}
 
 void
@@ -33,11 +65,21 @@ SyncProfileToolCount::syncManagerStart()
 }
 
 
+void
+SyncProfileToolCount::syncDataSent(uint32_t rank, uint64_t bytes)
+{
+    auto& entry = sent_data[rank];
+    entry.first++;
+    entry.second += bytes;
+}
+
+
 void
 SyncProfileToolCount::outputData(FILE* fp)
 {
     fprintf(fp, "%s\n", name.c_str());
     fprintf(fp, "  SyncManager Count = %" PRIu64 "\n", syncmanager_count);
+    outputSentData(fp, sent_data);
 }
 
 
@@ -53,6 +95,24 @@ SyncProfileToolTime<T>::outputData(FILE* fp)
     fprintf(fp, "  SyncManager Count = %" PRIu64 "\n", syncmanager_count);
     fprintf(fp, "  Total SyncManager Time = %lfs\n", (float)syncmanager_time / 1000000000.0);
     fprintf(fp, "  Average SyncManager Time = %" PRIu64 "ns\n", syncmanager_time / syncmanager_count);
+
+    fprintf(fp, "  Phases:\n");
+    for ( int i = 0; i < NUM_PHASES; ++i ) {
+        if ( phase_count[i] == 0 ) continue;
+        fprintf(
+            fp, "    %-12s Count = %" PRIu64 ", Total Time = %lfs\n", getPhaseName(static_cast<Phase>(i)),
+            phase_count[i], (double)phase_time[i] / 1000000000.0);
+    }
+
+    outputSentData(fp, sent_data);
+
+    if ( phase_count[BARRIER] != 0 ) {
+        fprintf(fp, "  Barrier Wait Histogram:\n");
+        for ( int i = 0; i < 64; ++i ) {
+            if ( barrier_histogram[i] == 0 ) continue;
+            fprintf(fp, "    < 2^%-2d ns: %" PRIu64 "\n", i, barrier_histogram[i]);
+        }
+    }
 }
 
 
@@ -17,6 +17,7 @@
 #include "sst/core/ssthandler.h"
 #include "sst/core/warnmacros.h"
 
+#include <array>
 #include <chrono>
 #include <map>
 
@@ -36,10 +37,30 @@ public:
     )
     // enum class Profile_Level { Global, Type, Component, Subcomponent };
 
+    /** Phases of a sync that are reported separately */
+    enum Phase {
+        SERIALIZE = 0, /* Serializing events to send to other ranks */
+        MPI_WAIT,      /* Waiting on MPI sends, receives and reductions */
+        DESERIALIZE,   /* Deserializing events received from other ranks */
+        BARRIER,       /* Waiting on the other threads of the rank */
+        THREAD_SYNC,   /* Exchanging events between threads */
+        NUM_PHASES
+    };
+
+    static const char* getPhaseName(Phase phase);
+
     SyncProfileTool(const std::string& name, Params& params);
 
     virtual void syncManagerStart() {}
     virtual void syncManagerEnd() {}
+
+    /** Called around each phase of a sync done by the calling thread.
+     * A phase can be entered more than once in a sync. */
+    virtual void syncPhaseStart(Phase UNUSED(phase)) {}
+    virtual void syncPhaseEnd(Phase UNUSED(phase)) {}
+
+    /** Called for each message sent to another rank during a sync */
+    virtual void syncDataSent(uint32_t UNUSED(rank), uint64_t UNUSED(bytes)) {}
 };
 
 
@@ -66,10 +87,15 @@ public:
 
     void syncManagerStart() override;
 
+    void syncDataSent(uint32_t rank, uint64_t bytes) override;
+
     void outputData(FILE* fp) override;
 
 private:
     uint64_t syncmanager_count = 0;
+
+    // Messages and bytes sent to each rank
+    std::map<uint32_t, std::pair<uint64_t, uint64_t>> sent_data;
 };
 
 /**
@@ -93,13 +119,46 @@ public:
         syncmanager_count++;
     }
 
+    void syncPhaseStart(Phase phase) override { phase_start_[phase] = T::now(); }
+
+    void syncPhaseEnd(Phase phase) override
+    {
+        uint64_t time = std::chrono::duration_cast<std::chrono::nanoseconds>(T::now() - phase_start_[phase]).count();
+        phase_time[phase] += time;
+        phase_count[phase]++;
+        if ( phase == BARRIER ) {
+            // Bucket i holds waits of less than 2^i ns
+            int bucket = 0;
+            while ( time != 0 && bucket < 63 ) {
+                time >>= 1;
+                bucket++;
+            }
+            barrier_histogram[bucket]++;
+        }
+    }
+
+    void syncDataSent(uint32_t rank, uint64_t bytes) override
+    {
+        auto& entry = sent_data[rank];
+        entry.first++;
+        entry.second += bytes;
+    }
+
     void outputData(FILE* fp) override;
 
 private:
     uint64_t syncmanager_time  = 0;
     uint64_t syncmanager_count = 0;
 
-    typename T::time_point start_time_;
+    std::array<uint64_t, NUM_PHASES> phase_time  = {};
+    std::array<uint64_t, NUM_PHASES> phase_count = {};
+    std::array<uint64_t, 64>         barrier_histogram = {};
+
+    // Messages and bytes sent to each rank
+    std::map<uint32_t, std::pair<uint64_t, uint64_t>> sent_data;
+
+    typename T::time_point                           start_time_;
+    std::array<typename T::time_point, NUM_PHASES> phase_start_;
 };
 
 } // namespace Profile
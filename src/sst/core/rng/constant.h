@@ -48,6 +48,15 @@ public:
     */
     double getNextDouble() { return mean; }
 
+    /**
+        Fills out with n copies of the constant value
+    */
+    void fill(double* out, size_t n)
+    {
+        for ( size_t i = 0; i < n; ++i )
+            out[i] = mean;
+    }
+
     /**
         Gets the constant value for the distribution
         \return Constant value specified by the user when creating the class
@@ -18,6 +18,7 @@
 #include "rng.h"
 
 #include <cstdlib> // for malloc/free
+#include <vector>
 
 using namespace SST::RNG;
 
@@ -29,49 +30,56 @@ namespace RNG {
 
     Creates a discrete distribution for use within SST. This distribution is the same across
     platforms and compilers.
+
+    By default each sample searches the cumulative probabilities, which
+    is O(n) in the number of outcomes.  Constructing the distribution
+    with ALIAS_TABLE builds a Vose alias table instead, which samples in
+    O(1) time.  Both methods draw one uniform per sample and give each
+    outcome the same probability, but map a given uniform to different
+    outcomes, so switching methods changes the sequence of samples.
 */
 class DiscreteDistribution : public SST::RNG::RandomDistribution
 {
 
 public:
+    /**
+        Methods used to turn a uniform random number into an outcome
+    */
+    enum SampleMethod {
+        CUMULATIVE_SEARCH, /*!< Linear search of the cumulative probabilities */
+        ALIAS_TABLE        /*!< Constant time lookup in a Vose alias table */
+    };
+
     /**
         Creates a discrete probability distribution
         \param probs An array of probabilities for each outcome
         \param probsCount The number of discrete outcomes
+        \param method How samples are drawn from the distribution
     */
-    DiscreteDistribution(const double* probs, const uint32_t probsCount) :
+    DiscreteDistribution(
+        const double* probs, const uint32_t probsCount, SampleMethod method = CUMULATIVE_SEARCH) :
         SST::RNG::RandomDistribution(),
         probCount(probsCount)
     {
-
-        probabilities   = (double*)malloc(sizeof(double) * probsCount);
-        double prob_sum = 0;
-
-        for ( uint32_t i = 0; i < probsCount; i++ ) {
-            probabilities[i] = prob_sum;
-            prob_sum += probs[i];
-        }
+        initialize(probs, method);
 
         baseDistrib   = new MersenneRNG();
         deleteDistrib = true;
     }
 
     /**
-        Creates an exponential distribution with a specific lambda and a base random number generator
-        \param lambda The lambda of the exponential distribution
+        Creates a discrete probability distribution with a base random number generator
+        \param probs An array of probabilities for each outcome
+        \param probsCount The number of discrete outcomes
         \param baseDist The base random number generator to take the distribution from.
+        \param method How samples are drawn from the distribution
     */
-    DiscreteDistribution(const double* probs, const uint32_t probsCount, SST::RNG::Random* baseDist) :
+    DiscreteDistribution(
+        const double* probs, const uint32_t probsCount, SST::RNG::Random* baseDist,
+        SampleMethod method = CUMULATIVE_SEARCH) :
         probCount(probsCount)
     {
-
-        probabilities   = (double*)malloc(sizeof(double) * probsCount);
-        double prob_sum = 0;
-
-        for ( uint32_t i = 0; i < probsCount; i++ ) {
-            probabilities[i] = prob_sum;
-            prob_sum += probs[i];
-        }
+        initialize(probs, method);
 
         baseDistrib   = baseDist;
         deleteDistrib = false;
@@ -92,9 +100,109 @@ public:
         \return The next random double from the discrete distribution, this is the double converted of the index where
        the probability is located
     */
-    double getNextDouble()
+    double getNextDouble() { return sample(baseDistrib->nextUniform()); }
+
+    /**
+        Fills out with the next n doubles from the distribution
+    */
+    void fill(double* out, size_t n)
+    {
+        baseDistrib->fillUniform(out, n);
+        for ( size_t i = 0; i < n; ++i )
+            out[i] = sample(out[i]);
+    }
+
+    /**
+        Gets the method used to draw samples
+        \return The sampling method the distribution was created with
+    */
+    SampleMethod getSampleMethod() const { return sampleMethod; }
+
+protected:
+    /**
+        Builds the cumulative probabilities and, if requested, the alias table
+    */
+    void initialize(const double* probs, SampleMethod method)
     {
-        const double nextD = baseDistrib->nextUniform();
+        sampleMethod = method;
+
+        probabilities   = (double*)malloc(sizeof(double) * probCount);
+        double prob_sum = 0;
+
+        for ( uint32_t i = 0; i < probCount; i++ ) {
+            probabilities[i] = prob_sum;
+            prob_sum += probs[i];
+        }
+
+        // There is nothing to look up with no outcomes, so leave that
+        // case to the search
+        if ( probCount == 0 ) sampleMethod = CUMULATIVE_SEARCH;
+        if ( sampleMethod == ALIAS_TABLE ) buildAliasTable();
+    }
+
+    /**
+        Builds a Vose alias table that gives each outcome the same
+        probability as the cumulative search.  The search returns
+        outcome i (1 <= i < probCount) when the uniform falls in
+        (probabilities[i-1], probabilities[i]] and probCount when it is
+        past the last entry, so those intervals (clamped to [0,1)) are
+        the outcome weights.
+    */
+    void buildAliasTable()
+    {
+        const uint32_t      n = probCount;
+        std::vector<double> scaled(n);
+
+        double prev = 0.0;
+        for ( uint32_t i = 0; i < n; i++ ) {
+            double upper = (i + 1 < n) ? probabilities[i + 1] : 1.0;
+            upper        = upper < 0.0 ? 0.0 : (upper > 1.0 ? 1.0 : upper);
+            scaled[i]    = upper > prev ? (upper - prev) * n : 0.0;
+            if ( upper > prev ) prev = upper;
+        }
+
+        aliasProb.assign(n, 1.0);
+        aliasIndex.resize(n);
+        std::vector<uint32_t> small;
+        std::vector<uint32_t> large;
+        for ( uint32_t i = 0; i < n; i++ ) {
+            aliasIndex[i] = i;
+            if ( scaled[i] < 1.0 )
+                small.push_back(i);
+            else
+                large.push_back(i);
+        }
+
+        while ( !small.empty() && !large.empty() ) {
+            uint32_t l = small.back();
+            small.pop_back();
+            uint32_t g = large.back();
+            large.pop_back();
+
+            aliasProb[l]  = scaled[l];
+            aliasIndex[l] = g;
+            scaled[g]     = (scaled[g] + scaled[l]) - 1.0;
+            if ( scaled[g] < 1.0 )
+                small.push_back(g);
+            else
+                large.push_back(g);
+        }
+        // Anything left over is 1.0 up to rounding error, so it keeps
+        // aliasProb of 1.0 and never uses its alias
+    }
+
+    /**
+        Turns a uniform random number in [0,1) into an outcome
+    */
+    double sample(double nextD) const
+    {
+        if ( sampleMethod == ALIAS_TABLE ) {
+            const double scaled = nextD * probCount;
+            uint32_t     column = (uint32_t)scaled;
+            if ( column >= probCount ) column = probCount - 1;
+            const double frac = scaled - column;
+            return (double)((frac < aliasProb[column] ? column : aliasIndex[column]) + 1);
+        }
 
         uint32_t index = 0;
 
@@ -105,7 +213,6 @@ public:
         return (double)index;
     }
 
-protected:
     /**
         Sets the base random number generator for the distribution.
     */
@@ -125,6 +232,18 @@ protected:
         Count of discrete probabilities
     */
     uint32_t probCount;
+
+    /**
+        How samples are drawn from the distribution
+    */
+    SampleMethod sampleMethod;
+
+    /**
+        Alias table: the chance of keeping each column and the outcome
+        used otherwise.  Only built for ALIAS_TABLE.
+    */
+    std::vector<double>   aliasProb;
+    std::vector<uint32_t> aliasIndex;
 };
 
 using SSTDiscreteDistribution = SST::RNG::DiscreteDistribution;
@@ -12,6 +12,8 @@
 #ifndef SST_CORE_RNG_DISTRIB_H
 #define SST_CORE_RNG_DISTRIB_H
 
+#include <stddef.h>
+
 namespace SST {
 namespace RNG {
 
@@ -29,6 +31,20 @@ public:
     */
     virtual double getNextDouble() = 0;
 
+    /**
+        Fills out with the next n doubles from the distribution.  The
+        values are the same as n calls to getNextDouble(), but
+        distributions override this to draw from their base generator
+        in bulk.
+        \param out Array of at least n doubles to fill
+        \param n Number of doubles to generate
+    */
+    virtual void fill(double* out, size_t n)
+    {
+        for ( size_t i = 0; i < n; ++i )
+            out[i] = getNextDouble();
+    }
+
     /**
         Destroys the distribution
     */
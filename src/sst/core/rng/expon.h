@@ -75,6 +75,16 @@ public:
         return log(1 - next) / (-1 * lambda);
     }
 
+    /**
+        Fills out with the next n doubles from the distribution
+    */
+    void fill(double* out, size_t n)
+    {
+        baseDistrib->fillUniform(out, n);
+        for ( size_t i = 0; i < n; ++i )
+            out[i] = log(1 - out[i]) / (-1 * lambda);
+    }
+
     /**
         Gets the lambda with which the distribution was created
         \return The lambda which the user created the distribution with
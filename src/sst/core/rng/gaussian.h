@@ -104,6 +104,18 @@ public:
         }
     }
 
+    /**
+        Fills out with the next n doubles from the distribution.  The
+        rejection loop uses a varying number of uniforms per sample, so
+        they are still drawn one at a time, but the per sample virtual
+        call is avoided.
+    */
+    void fill(double* out, size_t n)
+    {
+        for ( size_t i = 0; i < n; ++i )
+            out[i] = GaussianDistribution::getNextDouble();
+    }
+
     /**
         Gets the mean of the distribution
         \return The mean of the Guassian distribution
@@ -138,6 +138,41 @@ MarsagliaRNG::generateNextInt32()
     return returnInt32;
 }
 
+// The fill functions make direct, non-virtual calls to the generator
+// so it can be inlined into the loop.  They produce exactly the same
+// values as the single number versions above.
+void
+MarsagliaRNG::fillUniform(double* out, size_t n)
+{
+    for ( size_t i = 0; i < n; ++i ) {
+        double next_dbl;
+        do {
+            next_dbl = static_cast<double>(generateNext() + 1) * 2.328306435454494e-10;
+        } while ( UNLIKELY(next_dbl >= 1.0) );
+        out[i] = next_dbl;
+    }
+}
+
+void
+MarsagliaRNG::fillUInt32(uint32_t* out, size_t n)
+{
+    for ( size_t i = 0; i < n; ++i )
+        out[i] = generateNext();
+}
+
+void
+MarsagliaRNG::fillUInt64(uint64_t* out, size_t n)
+{
+    // Same layout as generateNextInt64(): the first 32-bit number
+    // fills the low addressed half
+    for ( size_t i = 0; i < n; ++i ) {
+        uint32_t halves[2];
+        halves[0] = generateNext();
+        halves[1] = generateNext();
+        std::memcpy(&out[i], halves, sizeof(halves));
+    }
+}
+
 void
 MarsagliaRNG::seed(uint64_t newSeed)
 {
@@ -87,6 +87,21 @@ public:
     */
     int32_t generateNextInt32() override;
 
+    /**
+        Fills out with the next n random numbers in the range [0,1)
+    */
+    void fillUniform(double* out, size_t n) override;
+
+    /**
+        Fills out with the next n random numbers as unsigned 32-bit integers
+    */
+    void fillUInt32(uint32_t* out, size_t n) override;
+
+    /**
+        Fills out with the next n random numbers as unsigned 64-bit integers
+    */
+    void fillUInt64(uint64_t* out, size_t n) override;
+
     /**
         Seed the XOR RNG
     */
@@ -107,6 +122,15 @@ private:
         The W seed of the Marsaglia generator
     */
     unsigned int m_w;
+
+public:
+    void serialize_order(SST::Core::Serialization::serializer& ser) override
+    {
+        ser& m_z;
+        ser& m_w;
+    }
+
+    ImplementSerializable(SST::RNG::MarsagliaRNG)
 };
 
 } // namespace RNG
@@ -139,6 +139,42 @@ MersenneRNG::generateNextInt32()
     return castReturn;
 }
 
+// The fill functions make direct, non-virtual calls to the generator
+// so it can be inlined into the loop.  They produce exactly the same
+// values as the single number versions above.
+void
+MersenneRNG::fillUniform(double* out, size_t n)
+{
+    for ( size_t i = 0; i < n; ++i ) {
+        double temp_dbl;
+        do {
+            temp_dbl =
+                static_cast<double>(MersenneRNG::generateNextUInt32()) / static_cast<double>(MERSENNE_UINT32_MAX);
+        } while ( UNLIKELY(temp_dbl >= 1.0) );
+        out[i] = temp_dbl;
+    }
+}
+
+void
+MersenneRNG::fillUInt32(uint32_t* out, size_t n)
+{
+    for ( size_t i = 0; i < n; ++i )
+        out[i] = MersenneRNG::generateNextUInt32();
+}
+
+void
+MersenneRNG::fillUInt64(uint64_t* out, size_t n)
+{
+    // Same layout as generateNextInt64(): the first 32-bit number
+    // fills the low addressed half
+    for ( size_t i = 0; i < n; ++i ) {
+        uint32_t halves[2];
+        halves[0] = MersenneRNG::generateNextUInt32();
+        halves[1] = MersenneRNG::generateNextUInt32();
+        std::memcpy(&out[i], halves, sizeof(halves));
+    }
+}
+
 void
 MersenneRNG::seed(uint64_t seed)
 {
@@ -73,6 +73,21 @@ public:
     */
     int32_t generateNextInt32() override;
 
+    /**
+       Fills out with the next n random numbers in the range [0,1)
+    */
+    void fillUniform(double* out, size_t n) override;
+
+    /**
+       Fills out with the next n random numbers as unsigned 32-bit integers
+    */
+    void fillUInt32(uint32_t* out, size_t n) override;
+
+    /**
+       Fills out with the next n random numbers as unsigned 64-bit integers
+    */
+    void fillUInt64(uint64_t* out, size_t n) override;
+
     /**
        Seed the XOR RNG
     */
@@ -98,6 +113,17 @@ private:
        Tells us what index of the random number list the next returnable number should come from
     */
     int index;
+
+public:
+    void serialize_order(SST::Core::Serialization::serializer& ser) override
+    {
+        for ( int i = 0; i < 624; i++ ) {
+            ser& numbers[i];
+        }
+        ser& index;
+    }
+
+    ImplementSerializable(SST::RNG::MersenneRNG)
 };
 
 } // namespace RNG
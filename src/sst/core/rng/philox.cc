@@ -0,0 +1,171 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "philox.h"
+
+#include "sst/core/sst_types.h"
+
+#include "rng.h"
+
+#include <cstring>
+
+using namespace SST;
+using namespace SST::RNG;
+
+// Philox4x32 multipliers and Weyl sequence constants for the key schedule
+#define PHILOX_M4x32_0 0xD2511F53U
+#define PHILOX_M4x32_1 0xCD9E8D57U
+#define PHILOX_W32_0   0x9E3779B9U
+#define PHILOX_W32_1   0xBB67AE85U
+
+PhiloxRNG::PhiloxRNG(uint64_t startSeed, uint64_t stream) : SST::RNG::Random(), stream(stream)
+{
+    seed(startSeed);
+}
+
+/*
+    The counter is the block number in the low 64 bits and the stream
+    in the high 64 bits, so every (stream, block) pair maps to a unique
+    counter and streams never overlap.
+*/
+void
+PhiloxRNG::generateBlock(uint64_t block)
+{
+    uint32_t c0 = (uint32_t)block;
+    uint32_t c1 = (uint32_t)(block >> 32);
+    uint32_t c2 = (uint32_t)stream;
+    uint32_t c3 = (uint32_t)(stream >> 32);
+    uint32_t k0 = key[0];
+    uint32_t k1 = key[1];
+
+    for ( int round = 0; round < 10; ++round ) {
+        if ( round > 0 ) {
+            k0 += PHILOX_W32_0;
+            k1 += PHILOX_W32_1;
+        }
+        const uint64_t p0 = (uint64_t)PHILOX_M4x32_0 * c0;
+        const uint64_t p1 = (uint64_t)PHILOX_M4x32_1 * c2;
+
+        c0 = (uint32_t)(p1 >> 32) ^ c1 ^ k0;
+        c1 = (uint32_t)p1;
+        c2 = (uint32_t)(p0 >> 32) ^ c3 ^ k1;
+        c3 = (uint32_t)p0;
+    }
+
+    output[0]    = c0;
+    output[1]    = c1;
+    output[2]    = c2;
+    output[3]    = c3;
+    output_block = block;
+    output_valid = true;
+}
+
+uint32_t
+PhiloxRNG::next()
+{
+    const uint64_t block = position >> 2;
+    if ( UNLIKELY(!output_valid || block != output_block) ) generateBlock(block);
+    return output[position++ & 0x3];
+}
+
+/*
+    Use 53 bits from two 32-bit numbers so the result is evenly spaced
+    over [0, 1) and can never round up to 1.0.
+*/
+double
+PhiloxRNG::nextUniform()
+{
+    return static_cast<double>(PhiloxRNG::generateNextUInt64() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+uint32_t
+PhiloxRNG::generateNextUInt32()
+{
+    return next();
+}
+
+uint64_t
+PhiloxRNG::generateNextUInt64()
+{
+    // Same layout as the other generators: the first 32-bit number
+    // fills the low addressed half
+    uint32_t halves[2];
+    halves[0] = next();
+    halves[1] = next();
+
+    uint64_t returnUInt64;
+    std::memcpy(&returnUInt64, halves, sizeof(returnUInt64));
+    return returnUInt64;
+}
+
+int64_t
+PhiloxRNG::generateNextInt64()
+{
+    uint64_t nextUInt64  = PhiloxRNG::generateNextUInt64();
+    int64_t  returnInt64 = 0;
+
+    std::memcpy(&returnInt64, &nextUInt64, sizeof(nextUInt64));
+
+    return returnInt64;
+}
+
+int32_t
+PhiloxRNG::generateNextInt32()
+{
+    uint32_t nextUInt32  = next();
+    int32_t  returnInt32 = 0;
+
+    std::memcpy(&returnInt32, &nextUInt32, sizeof(nextUInt32));
+
+    return returnInt32;
+}
+
+void
+PhiloxRNG::fillUniform(double* out, size_t n)
+{
+    for ( size_t i = 0; i < n; ++i )
+        out[i] = PhiloxRNG::nextUniform();
+}
+
+void
+PhiloxRNG::fillUInt32(uint32_t* out, size_t n)
+{
+    for ( size_t i = 0; i < n; ++i )
+        out[i] = next();
+}
+
+void
+PhiloxRNG::fillUInt64(uint64_t* out, size_t n)
+{
+    for ( size_t i = 0; i < n; ++i )
+        out[i] = PhiloxRNG::generateNextUInt64();
+}
+
+void
+PhiloxRNG::seed(uint64_t newSeed)
+{
+    key[0]       = (uint32_t)newSeed;
+    key[1]       = (uint32_t)(newSeed >> 32);
+    position     = 0;
+    output_valid = false;
+}
+
+void
+PhiloxRNG::setStream(uint64_t newStream)
+{
+    stream       = newStream;
+    position     = 0;
+    output_valid = false;
+}
+
+PhiloxRNG::~PhiloxRNG() {}
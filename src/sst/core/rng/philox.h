@@ -0,0 +1,171 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_RNG_PHILOX_H
+#define SST_CORE_RNG_PHILOX_H
+
+#include "rng.h"
+
+#include <stdint.h>
+
+namespace SST {
+namespace RNG {
+/**
+    \class PhiloxRNG philox.h "sst/core/rng/philox.h"
+
+    Implements the Philox4x32-10 counter based random number generator
+    (Salmon et al., "Parallel Random Numbers: As Easy as 1, 2, 3", SC
+    2011).  Each number is a pure function of the seed, a 64-bit stream
+    id and the position within the stream, so there is no state to
+    carry from one number to the next.  This makes it possible to jump
+    to any position in a stream in constant time, and to give every
+    component its own independent stream by using the component id as
+    the stream id:
+
+        rng = new PhiloxRNG(seed, getId());
+
+    Since component ids do not depend on how the simulation is
+    partitioned, a component seeded this way draws the same numbers
+    regardless of the number of ranks or threads.
+*/
+class PhiloxRNG : public SST::RNG::Random
+{
+
+public:
+    /**
+        Create a new Philox RNG
+        @param[in] seed The seed (Philox key) for this RNG
+        @param[in] stream The stream to draw numbers from
+    */
+    PhiloxRNG(uint64_t seed, uint64_t stream = 0);
+
+    /**
+        Generates the next random number as a double value between 0 and 1.
+    */
+    double nextUniform() override;
+
+    /**
+        Generates the next random number as an unsigned 32-bit integer
+    */
+    uint32_t generateNextUInt32() override;
+
+    /**
+        Generates the next random number as an unsigned 64-bit integer
+    */
+    uint64_t generateNextUInt64() override;
+
+    /**
+        Generates the next random number as a signed 64-bit integer
+    */
+    int64_t generateNextInt64() override;
+
+    /**
+        Generates the next random number as a signed 32-bit integer
+    */
+    int32_t generateNextInt32() override;
+
+    /**
+        Fills out with the next n random numbers in the range [0,1)
+    */
+    void fillUniform(double* out, size_t n) override;
+
+    /**
+        Fills out with the next n random numbers as unsigned 32-bit integers
+    */
+    void fillUInt32(uint32_t* out, size_t n) override;
+
+    /**
+        Fills out with the next n random numbers as unsigned 64-bit integers
+    */
+    void fillUInt64(uint64_t* out, size_t n) override;
+
+    /**
+        Seed the Philox RNG.  This restarts the current stream from
+        the beginning.
+    */
+    void seed(uint64_t newSeed);
+
+    /**
+        Switch to a different stream, starting at its beginning
+        @param[in] stream The stream to draw numbers from
+    */
+    void setStream(uint64_t stream);
+
+    /**
+        @return The stream numbers are being drawn from
+    */
+    uint64_t getStream() const { return stream; }
+
+    /**
+        Skip ahead in the current stream.  The position is counted in
+        32-bit numbers; nextUniform() and the 64-bit functions each
+        use two.
+        @param[in] count Number of 32-bit numbers to skip
+    */
+    void jump(uint64_t count) { position += count; }
+
+    /**
+        Move to an absolute position in the current stream
+        @param[in] pos Number of 32-bit numbers from the start of the stream
+    */
+    void setPosition(uint64_t pos) { position = pos; }
+
+    /**
+        @return The number of 32-bit numbers drawn from the start of the current stream
+    */
+    uint64_t getPosition() const { return position; }
+
+    /**
+        Destructor for Philox
+    */
+    ~PhiloxRNG();
+
+protected:
+    PhiloxRNG() {} // For serialization only
+
+    /**
+        Returns the next 32-bit number, generating a new block of four
+        when the current one has been used
+    */
+    uint32_t next();
+
+    /**
+        Runs the Philox4x32-10 bijection on the counter for block
+    */
+    void generateBlock(uint64_t block);
+
+    uint32_t key[2];
+    uint64_t stream;
+    uint64_t position;
+
+    // The last block generated and its block number
+    uint32_t output[4];
+    uint64_t output_block;
+    bool     output_valid;
+
+public:
+    void serialize_order(SST::Core::Serialization::serializer& ser) override
+    {
+        ser& key;
+        ser& stream;
+        ser& position;
+        ser& output;
+        ser& output_block;
+        ser& output_valid;
+    }
+
+    ImplementSerializable(SST::RNG::PhiloxRNG)
+};
+
+} // namespace RNG
+} // namespace SST
+
+#endif // SST_CORE_RNG_PHILOX_H
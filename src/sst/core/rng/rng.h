@@ -12,6 +12,9 @@
 #ifndef SST_CORE_RNG_RNG_H
 #define SST_CORE_RNG_RNG_H
 
+#include "sst/core/serialization/serializable.h"
+
+#include <stddef.h>
 #include <stdint.h>
 
 namespace SST {
@@ -23,8 +26,12 @@ namespace RNG {
     Implements the base class for random number generators for the SST core. This does not
     implement an actual RNG itself only the base class which describes the methods each
     class will implement.
+
+    Generators are serializable so that their state can be saved in a
+    checkpoint, e.g. with ser & *rng in the serialize_order() of the
+    component that owns the generator.
 */
-class Random
+class Random : public SST::Core::Serialization::serializable
 {
 
 public:
@@ -53,10 +60,45 @@ public:
     */
     virtual int32_t generateNextInt32() = 0;
 
+    /**
+        Fills out with the next n random numbers in the range [0,1).  The
+        values are the same as n calls to nextUniform(), but generators
+        override this to avoid a virtual call per number.
+    */
+    virtual void fillUniform(double* out, size_t n)
+    {
+        for ( size_t i = 0; i < n; ++i )
+            out[i] = nextUniform();
+    }
+
+    /**
+        Fills out with the next n random numbers as unsigned 32-bit
+        integers.  The values are the same as n calls to
+        generateNextUInt32().
+    */
+    virtual void fillUInt32(uint32_t* out, size_t n)
+    {
+        for ( size_t i = 0; i < n; ++i )
+            out[i] = generateNextUInt32();
+    }
+
+    /**
+        Fills out with the next n random numbers as unsigned 64-bit
+        integers.  The values are the same as n calls to
+        generateNextUInt64().
+    */
+    virtual void fillUInt64(uint64_t* out, size_t n)
+    {
+        for ( size_t i = 0; i < n; ++i )
+            out[i] = generateNextUInt64();
+    }
+
     /**
         Destroys the random number generator
     */
     virtual ~Random() {}
+
+    ImplementVirtualSerializable(SST::RNG::Random)
 };
 
 } // namespace RNG
@@ -91,6 +91,23 @@ public:
         return static_cast<double>(current_bin - 1);
     }
 
+    /**
+        Fills out with the next n doubles from the distribution
+    */
+    void fill(double* out, size_t n)
+    {
+        baseDistrib->fillUniform(out, n);
+        for ( size_t i = 0; i < n; ++i ) {
+            uint32_t current_bin = 1;
+
+            while ( out[i] > (static_cast<double>(current_bin) * probPerBin) ) {
+                current_bin++;
+            }
+
+            out[i] = static_cast<double>(current_bin - 1);
+        }
+    }
+
 protected:
     /**
         Sets the base random number generator for the distribution.
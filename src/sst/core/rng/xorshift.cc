@@ -19,6 +19,7 @@
 
 #include <cassert>
 #include <cstdlib>
+#include <cstring>
 
 using namespace SST;
 using namespace SST::RNG;
@@ -128,6 +129,42 @@ XORShiftRNG::generateNextInt32()
     return returnInt32;
 }
 
+// The fill functions make direct, non-virtual calls to the generator
+// so it can be inlined into the loop.  They produce exactly the same
+// values as the single number versions above.
+void
+XORShiftRNG::fillUniform(double* out, size_t n)
+{
+    for ( size_t i = 0; i < n; ++i ) {
+        double temp_dbl;
+        do {
+            temp_dbl =
+                static_cast<double>(XORShiftRNG::generateNextUInt32()) / static_cast<double>(XORSHIFT_UINT32_MAX);
+        } while ( UNLIKELY(temp_dbl >= 1.0) );
+        out[i] = temp_dbl;
+    }
+}
+
+void
+XORShiftRNG::fillUInt32(uint32_t* out, size_t n)
+{
+    for ( size_t i = 0; i < n; ++i )
+        out[i] = XORShiftRNG::generateNextUInt32();
+}
+
+void
+XORShiftRNG::fillUInt64(uint64_t* out, size_t n)
+{
+    // Same layout as generateNextInt64(): the first 32-bit number
+    // fills the low addressed half
+    for ( size_t i = 0; i < n; ++i ) {
+        uint32_t halves[2];
+        halves[0] = XORShiftRNG::generateNextUInt32();
+        halves[1] = XORShiftRNG::generateNextUInt32();
+        std::memcpy(&out[i], halves, sizeof(halves));
+    }
+}
+
 void
 XORShiftRNG::seed(uint64_t seed)
 {
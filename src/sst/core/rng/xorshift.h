@@ -74,6 +74,21 @@ public:
     */
     int32_t generateNextInt32() override;
 
+    /**
+        Fills out with the next n random numbers in the range [0,1)
+    */
+    void fillUniform(double* out, size_t n) override;
+
+    /**
+        Fills out with the next n random numbers as unsigned 32-bit integers
+    */
+    void fillUInt32(uint32_t* out, size_t n) override;
+
+    /**
+        Fills out with the next n random numbers as unsigned 64-bit integers
+    */
+    void fillUInt64(uint64_t* out, size_t n) override;
+
     /**
         Seed the XOR RNG
     */
@@ -89,6 +104,17 @@ protected:
     uint32_t y;
     uint32_t z;
     uint32_t w;
+
+public:
+    void serialize_order(SST::Core::Serialization::serializer& ser) override
+    {
+        ser& x;
+        ser& y;
+        ser& z;
+        ser& w;
+    }
+
+    ImplementSerializable(SST::RNG::XORShiftRNG)
 };
 
 } // namespace RNG
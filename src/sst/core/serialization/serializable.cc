@@ -17,6 +17,7 @@
 #include "sst/core/output.h"
 #include "sst/core/serialization/statics.h"
 
+#include <algorithm>
 #include <cstring>
 #include <iostream>
 
@@ -26,6 +27,9 @@ namespace Serialization {
 
 static need_delete_statics<serializable_factory> del_statics;
 serializable_factory::builder_map*               serializable_factory::builders_ = nullptr;
+std::unordered_map<uint32_t, uint32_t>*          serializable_factory::cls_indices_    = nullptr;
+std::unordered_map<uint32_t, uint16_t>*          serializable_factory::dense_ids_      = nullptr;
+std::vector<serializable_builder*>*              serializable_factory::dense_builders_ = nullptr;
 
 void
 serializable::serializable_abort(uint32_t line, const char* file, const char* func, const char* obj)
@@ -38,7 +42,10 @@ uint32_t
 // serializable_factory::add_builder(serializable_builder* builder, uint32_t cls_id)
 serializable_factory::add_builder(serializable_builder* builder, const char* name)
 {
-    if ( builders_ == nullptr ) { builders_ = new builder_map; }
+    if ( builders_ == nullptr ) {
+        builders_    = new builder_map;
+        cls_indices_ = new std::unordered_map<uint32_t, uint32_t>;
+    }
 
     const char* key  = name;
     int         len  = ::strlen(key);
@@ -63,14 +70,53 @@ serializable_factory::add_builder(serializable_builder* builder, const char* nam
         abort();
     }
     current = builder;
+    cls_indices_->emplace(hash, cls_indices_->size());
+    return hash;
+}
+
+uint64_t
+serializable_factory::build_dense_ids()
+{
+    clear_dense_ids();
+    if ( builders_ == nullptr ) return 0;
+
+    std::vector<uint32_t> ids;
+    for ( auto& x : *builders_ )
+        ids.push_back(x.first);
+    std::sort(ids.begin(), ids.end());
+
+    // Too many classes for the short ids, everything keeps its cls_id
+    if ( ids.size() >= EscapeDenseId ) return 0;
+
+    dense_ids_      = new std::unordered_map<uint32_t, uint16_t>;
+    dense_builders_ = new std::vector<serializable_builder*>;
+
+    // FNV-1a of the ids in order
+    uint64_t hash = 14695981039346656037ULL;
+    for ( size_t i = 0; i < ids.size(); ++i ) {
+        (*dense_ids_)[ids[i]] = i;
+        dense_builders_->push_back((*builders_)[ids[i]]);
+        hash = (hash ^ ids[i]) * 1099511628211ULL;
+    }
     return hash;
 }
 
+void
+serializable_factory::clear_dense_ids()
+{
+    delete dense_ids_;
+    delete dense_builders_;
+    dense_ids_      = nullptr;
+    dense_builders_ = nullptr;
+}
+
 void
 serializable_factory::delete_statics()
 {
     //  delete_vals(*builders_);
     delete builders_;
+    delete cls_indices_;
+    clear_dense_ids();
 }
 
 serializable*
@@ -19,6 +19,7 @@
 #include <stdint.h>
 #include <typeinfo>
 #include <unordered_map>
+#include <vector>
 
 namespace SST {
 namespace Core {
@@ -127,6 +128,12 @@ public:
     virtual uint32_t    cls_id() const             = 0;
     virtual std::string serialization_name() const = 0;
 
+    static constexpr uint32_t NullClsIndex = std::numeric_limits<uint32_t>::max();
+
+    /** Compact index of the class, NullClsIndex if it can't be
+     * serialized.  See serializable_factory::get_cls_index(). */
+    virtual uint32_t cls_index() const { return NullClsIndex; }
+
     virtual ~serializable() {}
 
 protected:
@@ -163,18 +170,22 @@ public:
     }                                                                                                             \
     virtual const char* cls_name() const override { return #obj; }
 
-#define ImplementSerializableDefaultConstructor(obj, obj_str)                             \
-public:                                                                                   \
-    virtual const char* cls_name() const override { return obj_str; }                     \
-    virtual uint32_t    cls_id() const override                                           \
-    {                                                                                     \
-        return SST::Core::Serialization::serializable_builder_impl<obj>::static_cls_id(); \
-    }                                                                                     \
-    static obj*         construct_deserialize_stub() { return new obj; }                  \
-    virtual std::string serialization_name() const override { return obj_str; }           \
-                                                                                          \
-private:                                                                                  \
-    friend class SST::Core::Serialization::serializable_builder_impl<obj>;                \
+#define ImplementSerializableDefaultConstructor(obj, obj_str)                                \
+public:                                                                                      \
+    virtual const char* cls_name() const override { return obj_str; }                        \
+    virtual uint32_t    cls_id() const override                                              \
+    {                                                                                        \
+        return SST::Core::Serialization::serializable_builder_impl<obj>::static_cls_id();    \
+    }                                                                                        \
+    virtual uint32_t cls_index() const override                                              \
+    {                                                                                        \
+        return SST::Core::Serialization::serializable_builder_impl<obj>::static_cls_index(); \
+    }                                                                                        \
+    static obj*         construct_deserialize_stub() { return new obj; }                     \
+    virtual std::string serialization_name() const override { return obj_str; }              \
+                                                                                             \
+private:                                                                                     \
+    friend class SST::Core::Serialization::serializable_builder_impl<obj>;                   \
     static bool you_forgot_to_add_ImplementSerializable_to_this_class() { return false; }
 
 #define SER_FORWARD_AS_ONE(...) __VA_ARGS__
@@ -213,6 +224,8 @@ public:
 
     static uint32_t static_cls_id() { return cls_id_; }
 
+    static uint32_t static_cls_index();
+
     static const char* static_name() { return name_; }
 
     bool sanity(serializable* ser) override { return (typeid(T) == typeid(*ser)); }
@@ -224,9 +237,46 @@ protected:
     typedef std::unordered_map<long, serializable_builder*> builder_map;
     static builder_map*                                     builders_;
 
+    // Indices from add_builder(), keyed by cls_id
+    static std::unordered_map<uint32_t, uint32_t>* cls_indices_;
+
+    // Short ids from build_dense_ids()
+    static std::unordered_map<uint32_t, uint16_t>* dense_ids_;
+    static std::vector<serializable_builder*>*     dense_builders_;
+
 public:
+    /** Short id of a null pointer */
+    static constexpr uint16_t NullDenseId   = 0xffff;
+    /** Short id of a class without one, the cls_id follows it */
+    static constexpr uint16_t EscapeDenseId = 0xfffe;
+
     static serializable* get_serializable(uint32_t cls_id);
 
+    /**
+       Number the classes registered so far 0 to N-1 in order of
+       cls_id, so processes with the same libraries loaded get the
+       same numbers.  Classes registered later keep using their
+       cls_id.
+       @return A hash of the numbered cls_ids, for checking that
+       other processes have the same table
+    */
+    static uint64_t build_dense_ids();
+
+    /** Drop the table made by build_dense_ids() */
+    static void clear_dense_ids();
+
+    /** Whether build_dense_ids() has made a table */
+    static bool have_dense_ids() { return dense_builders_ != nullptr; }
+
+    /** Short id of a class, EscapeDenseId if it has none */
+    static uint16_t get_dense_id(uint32_t cls_id)
+    {
+        auto it = dense_ids_->find(cls_id);
+        return it == dense_ids_->end() ? EscapeDenseId : it->second;
+    }
+
+    static serializable* get_serializable_dense(uint16_t dense_id) { return (*dense_builders_)[dense_id]->build(); }
+
     /**
        @return The cls id for the given builder
     */
@@ -234,11 +284,35 @@ public:
     // add_builder(serializable_builder* builder, uint32_t cls_id);
     add_builder(serializable_builder* builder, const char* name);
 
+    /**
+       Compact index of a class, for tables indexed by type.  Classes
+       are numbered 0 to N-1 as they are registered, which is when
+       their library is loaded, so the index is only the same between
+       processes that loaded the same libraries in the same order.
+       Use cls_id or the dense ids for anything sent between them.
+       @return The index, or NullClsIndex if the class isn't registered
+    */
+    static uint32_t get_cls_index(uint32_t cls_id)
+    {
+        auto it = cls_indices_->find(cls_id);
+        return it == cls_indices_->end() ? serializable::NullClsIndex : it->second;
+    }
+
     static bool sanity(serializable* ser, uint32_t cls_id) { return (*builders_)[cls_id]->sanity(ser); }
 
     static void delete_statics();
 };
 
+template <class T>
+uint32_t
+serializable_builder_impl<T>::static_cls_index()
+{
+    // Looked up once, the first time it is needed after the library
+    // with the class is loaded
+    static const uint32_t index = serializable_factory::get_cls_index(cls_id_);
+    return index;
+}
+
 template <class T>
 const char* serializable_builder_impl<T>::name_ = typeid(T).name();
 template <class T>
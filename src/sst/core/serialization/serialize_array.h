@@ -14,6 +14,9 @@
 
 #include "sst/core/serialization/serializer.h"
 
+#include <cstring>
+#include <type_traits>
+
 namespace SST {
 namespace Core {
 namespace Serialization {
@@ -46,6 +49,14 @@ public:
     raw_ptr_wrapper(TPtr*& ptr) : bufptr(ptr) {}
 };
 
+class ser_block_wrapper
+{
+public:
+    char*  start;
+    size_t size;
+    ser_block_wrapper(char* start, size_t size) : start(start), size(size) {}
+};
+
 } // namespace pvt
 /** I have typedefing pointers, but no other way.
  *  T could be "void and TPtr void* */
@@ -70,6 +81,41 @@ raw_ptr(TPtr*& ptr)
     return pvt::raw_ptr_wrapper<TPtr>(ptr);
 }
 
+/**
+   Serialize a run of adjacent trivially copyable members as one block
+   of raw bytes, from the start of first through the end of last.  The
+   members must be declared consecutively, with first declared before
+   last, and every member in between (including any padding) is copied
+   as is.  This replaces one ser& call per member with a single memcpy,
+   so is worth using for groups of plain scalars in frequently sent
+   events.  Only the first and last members can be checked for being
+   trivially copyable, so it is up to the caller to make sure nothing
+   else lives in the range.
+ */
+template <class T, class U>
+inline pvt::ser_block_wrapper
+block(T& first, U& last)
+{
+    static_assert(
+        std::is_trivially_copyable<T>::value && std::is_trivially_copyable<U>::value,
+        "Only trivially copyable members can be serialized as a block");
+    char* start = reinterpret_cast<char*>(&first);
+    char* end   = reinterpret_cast<char*>(&last) + sizeof(U);
+    return pvt::ser_block_wrapper(start, end - start);
+}
+
+/**
+   Serialize a single trivially copyable object (for example, a struct
+   of plain scalars) as one block of raw bytes.
+ */
+template <class T>
+inline pvt::ser_block_wrapper
+block(T& t)
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable objects can be serialized as a block");
+    return pvt::ser_block_wrapper(reinterpret_cast<char*>(&t), sizeof(T));
+}
+
 /*****       Specializations of serialize class       *****/
 
 /***    For statically allocated arrays ***/
@@ -146,7 +192,7 @@ public:
     void operator()(pvt::ser_array_wrapper<void, IntType> arr, serializer& ser) { ser.binary(arr.bufptr, arr.sizeptr); }
 };
 
-/***   Other Specializations (raw_ptr and trivially_serializable)  ***/
+/***   Other Specializations (raw_ptr, block and trivially_serializable)  ***/
 
 /**
    Version of serialize that works for copying raw pointers (only
@@ -161,6 +207,30 @@ public:
     void operator()(pvt::raw_ptr_wrapper<TPtr> ptr, serializer& ser) { ser.primitive(ptr.bufptr); }
 };
 
+/**
+   Version of serialize that copies a block of trivially copyable
+   members
+ */
+template <>
+class serialize<pvt::ser_block_wrapper>
+{
+public:
+    void operator()(pvt::ser_block_wrapper blk, serializer& ser)
+    {
+        switch ( ser.mode() ) {
+        case serializer::SIZER:
+            ser.sizer().add(blk.size);
+            break;
+        case serializer::PACK:
+            ::memcpy(ser.packer().next_str(blk.size), blk.start, blk.size);
+            break;
+        case serializer::UNPACK:
+            ::memcpy(blk.start, ser.unpacker().next_str(blk.size), blk.size);
+            break;
+        }
+    }
+};
+
 // Needed only because the default version in serialize.h can't get
 // the template expansions quite right trying to look through several
 // levels of expansion
@@ -181,6 +251,12 @@ operator&(serializer& ser, pvt::raw_ptr_wrapper<TPtr> ptr)
     serialize<pvt::raw_ptr_wrapper<TPtr>>()(ptr, ser);
 }
 
+inline void
+operator&(serializer& ser, pvt::ser_block_wrapper blk)
+{
+    serialize<pvt::ser_block_wrapper>()(blk, ser);
+}
+
 } // namespace Serialization
 } // namespace Core
 } // namespace SST
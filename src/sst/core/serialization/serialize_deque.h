@@ -53,6 +53,7 @@ public:
         {
             size_t size;
             ser.unpack(size);
+            v.clear();
             for ( size_t i = 0; i < size; ++i ) {
                 T t = {};
                 serialize<T>()(t, ser);
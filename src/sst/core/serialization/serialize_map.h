@@ -59,6 +59,7 @@ public:
         {
             size_t size;
             ser.unpack(size);
+            m.clear();
             for ( size_t i = 0; i < size; ++i ) {
                 Key   k = {};
                 Value v = {};
@@ -110,6 +111,7 @@ public:
         {
             size_t size;
             ser.unpack(size);
+            m.clear();
             for ( size_t i = 0; i < size; ++i ) {
                 Key   k = {};
                 Value v = {};
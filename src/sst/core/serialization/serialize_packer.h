@@ -15,6 +15,7 @@
 #include "sst/core/serialization/serialize_buffer_accessor.h"
 
 #include <string>
+#include <vector>
 
 namespace SST {
 namespace Core {
@@ -24,13 +25,51 @@ namespace pvt {
 class ser_packer : public ser_buffer_accessor
 {
 public:
+    ser_packer() : growable_(nullptr), offset_(0) {}
+
     template <class T>
     void pack(T& t)
     {
-        T* buf = ser_buffer_accessor::next<T>();
+        T* buf = next<T>();
         *buf   = t;
     }
 
+    template <class T>
+    T* next()
+    {
+        return reinterpret_cast<T*>(next_str(sizeof(T)));
+    }
+
+    char* next_str(size_t size)
+    {
+        if ( growable_ && size_ + size > max_size_ ) grow(size_ + size);
+        return ser_buffer_accessor::next_str(size);
+    }
+
+    /** Pack into a fixed buffer */
+    void init(void* buffer, size_t size)
+    {
+        growable_ = nullptr;
+        ser_buffer_accessor::init(buffer, size);
+    }
+
+    /**
+     * Pack into a vector that is enlarged as needed, so the data
+     * doesn't have to be sized first.  Pointers into the vector are
+     * only valid until the next call that packs data.
+     *
+     * @param buffer Vector to pack into.  Its size is the space
+     * available, not the size of the packed data.
+     * @param offset Bytes at the start of buffer to leave alone
+     */
+    void init(std::vector<char>& buffer, size_t offset)
+    {
+        growable_ = &buffer;
+        offset_   = offset;
+        if ( buffer.size() < offset ) buffer.resize(offset);
+        ser_buffer_accessor::init(buffer.data() + offset, buffer.size() - offset);
+    }
+
     /**
      * @brief pack_buffer
      * @param buf  Must be non-null
@@ -39,6 +78,13 @@ public:
     void pack_buffer(void* buf, int size);
 
     void pack_string(std::string& str);
+
+private:
+    /** Make room for at least needed bytes of packed data */
+    void grow(size_t needed);
+
+    std::vector<char>* growable_;
+    size_t             offset_;
 };
 
 } // namespace pvt
@@ -25,14 +25,35 @@ static const long null_ptr_id = -1;
 void
 size_serializable(serializable* s, serializer& ser)
 {
-    long dummy = 0;
-    ser.size(dummy);
+    if ( ser.compact_types() ) {
+        uint16_t id = s ? serializable_factory::get_dense_id(s->cls_id()) : serializable_factory::NullDenseId;
+        ser.size(id);
+        if ( id == serializable_factory::EscapeDenseId ) {
+            uint32_t cls_id = 0;
+            ser.size(cls_id);
+        }
+    }
+    else {
+        long dummy = 0;
+        ser.size(dummy);
+    }
     if ( s ) { s->serialize_order(ser); }
 }
 
 void
 pack_serializable(serializable* s, serializer& ser)
 {
+    if ( ser.compact_types() ) {
+        uint16_t id = s ? serializable_factory::get_dense_id(s->cls_id()) : serializable_factory::NullDenseId;
+        ser.pack(id);
+        if ( id == serializable_factory::EscapeDenseId ) {
+            uint32_t cls_id = s->cls_id();
+            ser.pack(cls_id);
+        }
+        if ( s ) { s->serialize_order(ser); }
+        return;
+    }
+
     if ( s ) {
         // debug_printf(dbg::serialize,
         //   "object with class id %ld: %s",
@@ -51,6 +72,25 @@ pack_serializable(serializable* s, serializer& ser)
 void
 unpack_serializable(serializable*& s, serializer& ser)
 {
+    if ( ser.compact_types() ) {
+        uint16_t id;
+        ser.unpack(id);
+        if ( id == serializable_factory::NullDenseId ) {
+            s = nullptr;
+            return;
+        }
+        if ( id == serializable_factory::EscapeDenseId ) {
+            uint32_t cls_id;
+            ser.unpack(cls_id);
+            s = serializable_factory::get_serializable(cls_id);
+        }
+        else {
+            s = serializable_factory::get_serializable_dense(id);
+        }
+        s->serialize_order(ser);
+        return;
+    }
+
     long cls_id;
     ser.unpack(cls_id);
     if ( cls_id == null_ptr_id ) {
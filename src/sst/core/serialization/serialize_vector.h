@@ -14,6 +14,8 @@
 
 #include "sst/core/serialization/serializer.h"
 
+#include <cstring>
+#include <type_traits>
 #include <vector>
 
 namespace SST {
@@ -25,6 +27,39 @@ class serialize<std::vector<T>>
 {
     typedef std::vector<T> Vector;
 
+    // Fundamental types and enums are packed by primitive() as their
+    // raw bytes, so a vector of them has the same layout in the buffer
+    // as the vector's own storage and can be copied as a single block.
+    // bool is serialized as an int, so it is left on the element by
+    // element path.
+    typedef std::integral_constant<
+        bool, (std::is_fundamental<T>::value || std::is_enum<T>::value) && !std::is_same<T, bool>::value>
+        is_block_copy;
+
+    void serialize_elements(Vector& v, serializer& ser, std::false_type)
+    {
+        for ( size_t i = 0; i < v.size(); ++i ) {
+            serialize<T>()(v[i], ser);
+        }
+    }
+
+    void serialize_elements(Vector& v, serializer& ser, std::true_type)
+    {
+        if ( v.empty() ) return;
+        size_t nbytes = v.size() * sizeof(T);
+        switch ( ser.mode() ) {
+        case serializer::SIZER:
+            ser.sizer().add(nbytes);
+            break;
+        case serializer::PACK:
+            ::memcpy(ser.packer().next_str(nbytes), v.data(), nbytes);
+            break;
+        case serializer::UNPACK:
+            ::memcpy(v.data(), ser.unpacker().next_str(nbytes), nbytes);
+            break;
+        }
+    }
+
 public:
     void operator()(Vector& v, serializer& ser)
     {
@@ -50,9 +85,7 @@ public:
         }
         }
 
-        for ( size_t i = 0; i < v.size(); ++i ) {
-            serialize<T>()(v[i], ser);
-        }
+        serialize_elements(v, ser, is_block_copy());
     }
 };
 
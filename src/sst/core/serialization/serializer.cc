@@ -46,6 +46,19 @@ ser_packer::pack_buffer(void* buf, int size)
     ::memcpy(charstr, buf, size);
 }
 
+void
+ser_packer::grow(size_t needed)
+{
+    size_t capacity = 2 * max_size_;
+    if ( capacity < needed ) capacity = needed;
+    if ( capacity < 256 ) capacity = 256;
+    growable_->resize(offset_ + capacity);
+
+    bufstart_ = growable_->data() + offset_;
+    bufptr_   = bufstart_ + size_;
+    max_size_ = capacity;
+}
+
 void
 ser_unpacker::unpack_string(std::string& str)
 {
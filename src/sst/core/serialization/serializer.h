@@ -37,7 +37,7 @@ public:
     typedef enum { SIZER, PACK, UNPACK } SERIALIZE_MODE;
 
 public:
-    serializer() : mode_(SIZER) // just sizing by default
+    serializer() : mode_(SIZER), compact_types_(false) // just sizing by default
     {}
 
     pvt::ser_packer& packer() { return packer_; }
@@ -71,6 +71,14 @@ public:
 
     void set_mode(SERIALIZE_MODE mode) { mode_ = mode; }
 
+    /** Write polymorphic objects with the short type ids of
+        serializable_factory::build_dense_ids() instead of their
+        cls_id.  Both sides must agree, and the ids are only valid
+        within one run. */
+    void set_compact_types(bool compact) { compact_types_ = compact; }
+
+    bool compact_types() const { return compact_types_; }
+
     void reset()
     {
         sizer_.reset();
@@ -170,6 +178,14 @@ public:
         mode_ = PACK;
     }
 
+    /** Pack into a vector that grows as needed, which saves sizing the
+        data first.  size() gives the number of bytes packed. */
+    void start_packing(std::vector<char>& buffer, size_t offset = 0)
+    {
+        packer_.init(buffer, offset);
+        mode_ = PACK;
+    }
+
     void start_sizing()
     {
         sizer_.reset();
@@ -202,6 +218,7 @@ protected:
     pvt::ser_unpacker unpacker_;
     pvt::ser_sizer    sizer_;
     SERIALIZE_MODE    mode_;
+    bool              compact_types_;
 };
 
 } // namespace Serialization
@@ -15,6 +15,14 @@
 #include "sst/core/shared/sharedObject.h"
 #include "sst/core/sst_types.h"
 
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <type_traits>
+#include <unistd.h>
 #include <vector>
 
 namespace SST {
@@ -100,10 +108,61 @@ public:
         return ret;
     }
 
+    /**
+       Initialize the SharedArray from the contents of a file.  The
+       file is mapped read-only, so every rank on a node shares the
+       same physical copy of the data through the page cache, and the
+       array cannot be written.  The file holds the raw values of the
+       array, so T must be trivially copyable, and the length of the
+       array is the size of the file divided by sizeof(T).  The file
+       must be readable by every rank under the same name.
+
+       Other instances can get access to the array by calling
+       initialize() with a length of 0.
+
+       @param obj_name Name of the object.  This name is how the
+       object is uniquely identified across ranks.
+
+       @param filename File to map
+
+       @return returns the number of instances that have intialized
+       themselve before this instance on this MPI rank.
+     */
+    int initializeFromFile(const std::string& obj_name, const std::string& filename)
+    {
+        static_assert(
+            std::is_trivially_copyable<T>::value, "SharedArray can only be mapped from a file for trivially copyable types");
+
+        if ( data ) {
+            Private::getSimulationOutput().fatal(
+                CALL_INFO, 1, "ERROR: called initialize() of SharedArray %s more than once\n", obj_name.c_str());
+        }
+
+        data    = manager.getSharedObjectData<Data>(obj_name);
+        int ret = incShareCount(data);
+        data->mapFile(filename);
+        return ret;
+    }
+
+    /**
+       Request that, once the init phase is over, the array be moved
+       into memory shared by all ranks on a node, so the node holds
+       one copy of the data instead of one per rank.  Has no effect
+       when running on a single rank or when the array was mapped
+       from a file.  T must be trivially copyable.  Any instance of
+       the array on any rank can make the request.
+     */
+    void useNodeSharedMemory()
+    {
+        static_assert(
+            std::is_trivially_copyable<T>::value, "SharedArray can only use node shared memory for trivially copyable types");
+        data->requestNodeShared();
+    }
+
     /*** Typedefs and functions to mimic parts of the vector API ***/
 
-    typedef typename std::vector<T>::const_iterator         const_iterator;
-    typedef typename std::vector<T>::const_reverse_iterator const_reverse_iterator;
+    typedef const T*                              const_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
 
     /**
        Get the length of the array.
@@ -117,27 +176,27 @@ public:
 
        @return true if array is empty (size = 0), false otherwise
      */
-    inline bool empty() const { return data->array.empty(); }
+    inline bool empty() const { return data->getSize() == 0; }
 
     /**
        Get const_iterator to beginning of underlying map
      */
-    const_iterator begin() const { return data->array.cbegin(); }
+    const_iterator begin() const { return data->values; }
 
     /**
        Get const_iterator to end of underlying map
      */
-    const_iterator end() const { return data->array.cend(); }
+    const_iterator end() const { return data->values + data->length; }
 
     /**
        Get const_reverse_iterator to beginning of underlying map
      */
-    const_reverse_iterator rbegin() const { return data->array.crbegin(); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
 
     /**
        Get const_reverse_iterator to end of underlying map
      */
-    const_reverse_iterator rend() const { return data->array.crend(); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
 
     /**
        Indicate that the calling element has written all the data it
@@ -224,12 +283,96 @@ private:
         T                 init;
         verify_type       verify;
 
-        Data(const std::string& name) : SharedObjectData(name), change_set(nullptr), verify(VERIFY_UNINITIALIZED)
+        // Where reads come from: either the data of array or the
+        // mapped file
+        const T* values;
+        size_t   length;
+
+        // Mapped file, if the array was initialized from a file
+        std::string filename;
+        void*       mapping;
+        size_t      mapping_size;
+
+        // Whether the array should be moved to node shared memory
+        // after init, and whether it has been
+        bool node_shared_requested;
+        bool is_node_shared;
+
+        Data(const std::string& name) :
+            SharedObjectData(name),
+            change_set(nullptr),
+            verify(VERIFY_UNINITIALIZED),
+            values(nullptr),
+            length(0),
+            mapping(nullptr),
+            mapping_size(0),
+            node_shared_requested(false),
+            is_node_shared(false)
         {
             if ( Private::getNumRanks().rank > 1 ) { change_set = new ChangeSet(name); }
         }
 
-        ~Data() { delete change_set; }
+        ~Data()
+        {
+            delete change_set;
+            if ( mapping ) munmap(mapping, mapping_size);
+        }
+
+        /**
+           Map the array from a file.  Every instance that maps the
+           array must use the same file.
+        */
+        void mapFile(const std::string& file)
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            if ( !filename.empty() ) {
+                if ( filename != file ) {
+                    Private::getSimulationOutput().fatal(
+                        CALL_INFO, 1, "ERROR: Two different files passed into SharedArray %s\n", name.c_str());
+                }
+                return;
+            }
+            if ( !array.empty() ) {
+                Private::getSimulationOutput().fatal(
+                    CALL_INFO, 1, "ERROR: SharedArray %s was given both a length and a file to map\n", name.c_str());
+            }
+
+            int fd = open(file.c_str(), O_RDONLY);
+            if ( fd < 0 ) {
+                Private::getSimulationOutput().fatal(
+                    CALL_INFO, 1, "ERROR: unable to open %s for SharedArray %s: %s\n", file.c_str(), name.c_str(),
+                    strerror(errno));
+            }
+            struct stat st;
+            fstat(fd, &st);
+            if ( st.st_size % sizeof(T) != 0 ) {
+                Private::getSimulationOutput().fatal(
+                    CALL_INFO, 1, "ERROR: size of %s is not a multiple of the element size of SharedArray %s\n",
+                    file.c_str(), name.c_str());
+            }
+            if ( st.st_size > 0 ) {
+                mapping = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+                if ( mapping == MAP_FAILED ) {
+                    Private::getSimulationOutput().fatal(
+                        CALL_INFO, 1, "ERROR: unable to map %s for SharedArray %s: %s\n", file.c_str(), name.c_str(),
+                        strerror(errno));
+                }
+            }
+            close(fd);
+
+            filename     = file;
+            mapping_size = st.st_size;
+            values       = static_cast<const T*>(mapping);
+            length       = st.st_size / sizeof(T);
+            if ( change_set ) change_set->setFile(file);
+        }
+
+        void requestNodeShared()
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            node_shared_requested = true;
+            if ( change_set ) change_set->setNodeShared();
+        }
 
         /**
            Set the size of the array.  An element can only write up to the
@@ -244,9 +387,15 @@ private:
             // If the data is uninitialized, then there is nothing to do
             if ( v_type == VERIFY_UNINITIALIZED ) return;
             std::lock_guard<std::mutex> lock(mtx);
+            if ( !filename.empty() ) {
+                Private::getSimulationOutput().fatal(
+                    CALL_INFO, 1, "ERROR: SharedArray %s was given both a length and a file to map\n", name.c_str());
+            }
             if ( size > array.size() ) {
                 // Need to resize the vector
                 array.resize(size, init_data);
+                values = array.data();
+                length = array.size();
                 if ( v_type == FE_VERIFY ) { written.resize(size); }
                 if ( change_set ) change_set->setSize(size, init_data, v_type);
             }
@@ -271,8 +420,10 @@ private:
 
         size_t getSize()
         {
+            // No writes can happen once the array is locked
+            if ( locked ) return length;
             std::lock_guard<std::mutex> lock(mtx);
-            return array.size();
+            return length;
         }
 
         void update_write(int index, const T& data)
@@ -304,6 +455,10 @@ private:
         {
             std::lock_guard<std::mutex> lock(mtx);
             check_lock_for_write("SharedArray");
+            if ( !filename.empty() ) {
+                Private::getSimulationOutput().fatal(
+                    CALL_INFO, 1, "ERROR: write to SharedArray %s, which was mapped from a file\n", name.c_str());
+            }
             update_write(index, data);
             if ( verify == FE_VERIFY ) written[index] = true;
             if ( change_set ) change_set->addChange(index, data);
@@ -314,20 +469,37 @@ private:
         // the array may be resized by another thread.  If there is a
         // danger of the array being resized during init, use the
         // mutex_read function until after the init phase.
-        inline const T& read(int index) const { return array[index]; }
+        inline const T& read(int index) const { return values[index]; }
 
         // Mutexed read for use if you are resizing the array as you go
         inline const T& mutex_read(int index) const
         {
             std::lock_guard<std::mutex> lock(mtx);
-            auto                        ret = array[index];
-            return ret;
+            return values[index];
         }
 
         // Functions inherited from SharedObjectData
         virtual SharedObjectChangeSet* getChangeSet() override { return change_set; }
         virtual void                   resetChangeSet() override { change_set->clear(); }
 
+        size_t getNodeSharedSize() override
+        {
+            // A mapped file is already shared through the page cache
+            if ( !node_shared_requested || is_node_shared || !filename.empty() ) return 0;
+            return length * sizeof(T);
+        }
+
+        size_t getMemoryEstimate() override { return array.capacity() * sizeof(T) + written.capacity() / 8; }
+
+        void moveToNodeShared(void* ptr, bool copy) override
+        {
+            if ( copy ) std::copy(array.begin(), array.end(), static_cast<T*>(ptr));
+            std::vector<T>().swap(array);
+            std::vector<bool>().swap(written);
+            values         = static_cast<const T*>(ptr);
+            is_node_shared = true;
+        }
+
     private:
         class ChangeSet : public SharedObjectChangeSet
         {
@@ -336,6 +508,8 @@ private:
             size_t                         size;
             T                              init;
             verify_type                    verify;
+            std::string                    file;
+            bool                           node_shared;
 
             void serialize_order(SST::Core::Serialization::serializer& ser) override
             {
@@ -344,6 +518,8 @@ private:
                 ser& size;
                 ser& init;
                 ser& verify;
+                ser& file;
+                ser& node_shared;
             }
 
             ImplementSerializable(SST::Shared::SharedArray<T>::Data::ChangeSet);
@@ -351,7 +527,12 @@ private:
         public:
             // For serialization
             ChangeSet() : SharedObjectChangeSet() {}
-            ChangeSet(const std::string& name) : SharedObjectChangeSet(name), size(0), verify(VERIFY_UNINITIALIZED) {}
+            ChangeSet(const std::string& name) :
+                SharedObjectChangeSet(name),
+                size(0),
+                verify(VERIFY_UNINITIALIZED),
+                node_shared(false)
+            {}
 
             void addChange(int index, const T& value) { changes.emplace_back(index, value); }
 
@@ -363,15 +544,34 @@ private:
             }
             size_t getSize() { return size; }
 
+            void setFile(const std::string& filename) { file = filename; }
+
+            void setNodeShared() { node_shared = true; }
+
             void applyChanges(SharedObjectDataManager* manager) override
             {
                 auto data = manager->getSharedObjectData<Data>(getName());
+                if ( !file.empty() ) data->mapFile(file);
+                if ( node_shared ) data->requestNodeShared();
                 data->setSize(size, init, verify);
                 for ( auto x : changes ) {
                     data->update_write(x.first, x.second);
                 }
             }
 
+            void merge(SharedObjectChangeSet* other) override
+            {
+                auto cs = static_cast<ChangeSet*>(other);
+                changes.insert(changes.end(), cs->changes.begin(), cs->changes.end());
+                if ( cs->size > size ) size = cs->size;
+                if ( verify == VERIFY_UNINITIALIZED ) {
+                    init   = cs->init;
+                    verify = cs->verify;
+                }
+                if ( file.empty() ) file = cs->file;
+                node_shared = node_shared || cs->node_shared;
+            }
+
             void clear() override { changes.clear(); }
         };
     };
@@ -587,6 +787,8 @@ private:
 
         ~Data() { delete change_set; }
 
+        size_t getMemoryEstimate() override { return (array.capacity() + written.capacity()) / 8; }
+
         /**
            Set the size of the array.  An element can only write up to the
            current size (reading or writing beyond the size will create
@@ -727,6 +929,17 @@ private:
                 }
             }
 
+            void merge(SharedObjectChangeSet* other) override
+            {
+                auto cs = static_cast<ChangeSet*>(other);
+                changes.insert(changes.end(), cs->changes.begin(), cs->changes.end());
+                if ( cs->size > size ) size = cs->size;
+                if ( verify == VERIFY_UNINITIALIZED ) {
+                    init   = cs->init;
+                    verify = cs->verify;
+                }
+            }
+
             void clear() override { changes.clear(); }
         };
     };
@@ -15,7 +15,10 @@
 #include "sst/core/shared/sharedObject.h"
 #include "sst/core/sst_types.h"
 
+#include <algorithm>
 #include <map>
+#include <stdexcept>
+#include <vector>
 
 namespace SST {
 namespace Shared {
@@ -75,9 +78,28 @@ public:
         return ret;
     }
 
+    /**
+       Request that the map be frozen once the init phase is over.  A
+       frozen map is converted from a std::map to a sorted array of
+       entries in cache line aligned memory, which is smaller and
+       faster to search for large, read-mostly maps.  The map can be
+       read in the same way before and after it is frozen.  Any
+       instance of the map on a rank can make the request.
+     */
+    void useFrozenLayout() { data->requestFreeze(); }
+
+    /**
+       Request the frozen layout along with an open addressing hash
+       index over it, so find() and reads take a probe or two instead
+       of a binary search.  Iteration and lower_bound()/upper_bound()
+       still use the sorted array.  The index adds about 4 to 11 bytes
+       per entry.  Needs std::hash for the key type.
+     */
+    void useHashedLayout() { data->requestHash(); }
+
     /*** Typedefs and functions to mimic parts of the vector API ***/
-    typedef typename std::map<keyT, valT>::const_iterator         const_iterator;
-    typedef typename std::map<keyT, valT>::const_reverse_iterator const_reverse_iterator;
+    typedef Private::FrozenIterator<typename std::map<keyT, valT>::const_iterator> const_iterator;
+    typedef std::reverse_iterator<const_iterator>                                  const_reverse_iterator;
 
     /**
        Get the size of the map.
@@ -91,7 +113,7 @@ public:
 
        @return true if map is empty, false otherwise
      */
-    inline bool empty() const { return data->map.empty(); }
+    inline bool empty() const { return data->getSize() == 0; }
 
     /**
        Counts elements with a specific key.  Becuase this is not a
@@ -99,7 +121,7 @@ public:
 
        @return Count of elements with specified key
      */
-    size_t count(const keyT& k) const { return data->map.count(k); }
+    size_t count(const keyT& k) const { return find(k) == end() ? 0 : 1; }
 
     /**
        Searches the container for an element with a key equivalent to
@@ -108,27 +130,27 @@ public:
 
        @param key key to search for
      */
-    const_iterator find(const keyT& key) const { return data->map.find(key); }
+    const_iterator find(const keyT& key) const { return data->find(key); }
 
     /**
        Get const_iterator to beginning of underlying map
      */
-    const_iterator begin() const { return data->map.cbegin(); }
+    const_iterator begin() const { return data->begin(); }
 
     /**
        Get const_iterator to end of underlying map
      */
-    const_iterator end() const { return data->map.cend(); }
+    const_iterator end() const { return data->end(); }
 
     /**
        Get const_reverse_iterator to beginning of underlying map
      */
-    const_reverse_iterator rbegin() const { return data->map.crbegin(); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
 
     /**
        Get const_reverse_iterator to end of underlying map
      */
-    const_reverse_iterator rend() const { return data->map.crend(); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
 
     /**
        Returns an iterator pointing to the first element in the
@@ -137,7 +159,7 @@ public:
 
        @param key key to compare to
      */
-    inline const_iterator lower_bound(const keyT& key) const { return data->map.lower_bound(key); }
+    inline const_iterator lower_bound(const keyT& key) const { return data->lower_bound(key); }
 
     /**
        Returns an iterator pointing to the first element in the
@@ -145,7 +167,7 @@ public:
 
        @param key key to compare to
     */
-    inline const_iterator upper_bound(const keyT& key) const { return data->map.lower_bound(key); }
+    inline const_iterator upper_bound(const keyT& key) const { return data->upper_bound(key); }
 
     /**
        Indicate that the calling element has written all the data it
@@ -230,12 +252,26 @@ private:
         // Forward declaration.  Defined below
         class ChangeSet;
 
+        typedef std::pair<const keyT, valT> entry_t;
+
     public:
         std::map<keyT, valT> map;
         ChangeSet*           change_set;
         verify_type          verify;
 
-        Data(const std::string& name) : SharedObjectData(name), change_set(nullptr), verify(VERIFY_UNINITIALIZED)
+        // Sorted copy of the map once it has been frozen, at which
+        // point map is emptied
+        std::vector<entry_t, Private::CacheAlignedAllocator<entry_t>> frozen;
+        bool                                                          freeze_requested;
+        bool                                                          is_frozen;
+        Private::FrozenHashIndex<keyT>                                hash_index;
+
+        Data(const std::string& name) :
+            SharedObjectData(name),
+            change_set(nullptr),
+            verify(VERIFY_UNINITIALIZED),
+            freeze_requested(false),
+            is_frozen(false)
         {
             if ( Private::getNumRanks().rank > 1 ) { change_set = new ChangeSet(name); }
         }
@@ -252,7 +288,74 @@ private:
             if ( change_set ) change_set->setVerify(v_type);
         }
 
-        size_t getSize() const { return map.size(); }
+        size_t getSize() const { return is_frozen ? frozen.size() : map.size(); }
+
+        // Tree nodes carry about four pointers of overhead each
+        size_t getMemoryEstimate() override
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            return map.size() * (sizeof(entry_t) + 4 * sizeof(void*)) + frozen.capacity() * sizeof(entry_t) +
+                   hash_index.getMemoryEstimate();
+        }
+
+        void requestFreeze()
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            freeze_requested = true;
+        }
+
+        void requestHash()
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            freeze_requested = true;
+            hash_index.useStdHash();
+        }
+
+        static const keyT& keyOf(const entry_t& entry) { return entry.first; }
+
+        void freeze() override
+        {
+            if ( !freeze_requested || is_frozen || map.empty() ) return;
+            frozen.reserve(map.size());
+            for ( auto& x : map )
+                frozen.emplace_back(x);
+            std::map<keyT, valT>().swap(map);
+            hash_index.build(frozen.data(), frozen.size(), keyOf);
+            is_frozen = true;
+        }
+
+        const_iterator begin() const { return is_frozen ? const_iterator(frozen.data()) : const_iterator(map.cbegin()); }
+
+        const_iterator end() const
+        {
+            return is_frozen ? const_iterator(frozen.data() + frozen.size()) : const_iterator(map.cend());
+        }
+
+        const_iterator lower_bound(const keyT& key) const
+        {
+            if ( !is_frozen ) return map.lower_bound(key);
+            return const_iterator(std::lower_bound(
+                frozen.data(), frozen.data() + frozen.size(), key,
+                [](const entry_t& entry, const keyT& k) { return entry.first < k; }));
+        }
+
+        const_iterator upper_bound(const keyT& key) const
+        {
+            if ( !is_frozen ) return map.upper_bound(key);
+            return const_iterator(std::upper_bound(
+                frozen.data(), frozen.data() + frozen.size(), key,
+                [](const keyT& k, const entry_t& entry) { return k < entry.first; }));
+        }
+
+        const_iterator find(const keyT& key) const
+        {
+            if ( !is_frozen ) return map.find(key);
+            if ( hash_index.isBuilt() )
+                return const_iterator(hash_index.find(frozen.data(), frozen.size(), key, keyOf));
+            const_iterator it = lower_bound(key);
+            if ( it == end() || key < it->first ) return end();
+            return it;
+        }
 
         void update_write(const keyT& key, const valT& value)
         {
@@ -283,14 +386,19 @@ private:
         // thread.  If there is a danger of simultaneous access
         // during init, use the mutex_read function until after the
         // init phase.
-        inline const valT& read(const keyT& key) { return map.at(key); }
+        inline const valT& read(const keyT& key)
+        {
+            if ( !is_frozen ) return map.at(key);
+            const_iterator it = find(key);
+            if ( it == end() ) throw std::out_of_range("SharedMap");
+            return it->second;
+        }
 
         // Mutexed read for use if you are resizing the array as you go
         inline const valT& mutex_read(const keyT& key)
         {
             std::lock_guard<std::mutex> lock(mtx);
-            auto                        ret = map.at(key);
-            return ret;
+            return read(key);
         }
 
         // Functions inherited from SharedObjectData
@@ -331,6 +439,14 @@ private:
                 }
             }
 
+            void merge(SharedObjectChangeSet* other) override
+            {
+                auto cs = static_cast<ChangeSet*>(other);
+                // Matching entries were checked when other was applied
+                changes.insert(cs->changes.begin(), cs->changes.end());
+                if ( verify == VERIFY_UNINITIALIZED ) verify = cs->verify;
+            }
+
             void clear() override { changes.clear(); }
         };
     };
@@ -22,6 +22,12 @@
 #include "sst/core/simulation_impl.h"
 #include "sst/core/warnmacros.h"
 
+#ifdef SST_CONFIG_HAVE_MPI
+DISABLE_WARN_MISSING_OVERRIDE
+#include <mpi.h>
+REENABLE_WARNING
+#endif
+
 namespace SST {
 namespace Shared {
 
@@ -45,36 +51,84 @@ std::mutex              SharedObjectDataManager::mtx;
 
 std::mutex SharedObjectDataManager::update_mtx;
 
+#ifdef SST_CONFIG_HAVE_MPI
+// Window holding the objects that are shared by all ranks on a node,
+// and the communicator of the ranks on this node
+static MPI_Win  node_window = MPI_WIN_NULL;
+static MPI_Comm node_comm   = MPI_COMM_NULL;
+
+// Each object is padded to a whole number of cache lines in the window
+static size_t
+nodeSharedAlign(size_t size)
+{
+    return (size + 63) & ~size_t(63);
+}
+#endif
+
 void
 SharedObjectDataManager::updateState(bool finalize)
 {
     std::lock_guard<std::mutex> lock(update_mtx);
 
 #ifdef SST_CONFIG_HAVE_MPI
-    // Exchange data between ranks
+    // Exchange data between ranks.  The changesets are merged up a
+    // binomial tree to rank 0, which then broadcasts the combined
+    // changes, so each rank sends and receives O(log(ranks))
+    // messages instead of the changesets of every other rank.
     if ( Simulation_impl::getSimulation()->getNumRanks().rank > 1 ) {
-        int                                 myRank = Simulation_impl::getSimulation()->getRank().rank;
-        // Create a vector off all my changesets
-        std::vector<SharedObjectChangeSet*> myChanges;
+        int myRank = Simulation_impl::getSimulation()->getRank().rank;
+        int nRanks = Simulation_impl::getSimulation()->getNumRanks().rank;
 
-        // Create a vector to check to see if regions are fully
+        // Whether each SharedObject in this subtree is fully
         // published
-        std::vector<std::pair<std::string, bool>> myFullPub;
+        std::map<std::string, bool> pub_map;
         for ( auto x : shared_data ) {
-            myChanges.push_back(x.second->getChangeSet());
-            myFullPub.emplace_back(x.second->getName(), x.second->getPublishCount() == x.second->getShareCount());
+            pub_map[x.first] = x.second->getPublishCount() == x.second->getShareCount();
         }
 
-        std::vector<std::vector<SharedObjectChangeSet*>>       allChanges;
-        std::vector<std::vector<std::pair<std::string, bool>>> allFullyPub;
+        // Reduce.  Applying the changes of a child also checks them
+        // against the data already on this rank.
+        for ( int step = 1; step < nRanks; step <<= 1 ) {
+            if ( myRank & step ) {
+                std::vector<SharedObjectChangeSet*> myChanges;
+                for ( auto x : shared_data ) {
+                    myChanges.push_back(x.second->getChangeSet());
+                }
+                Comms::send(myRank - step, 0, myChanges);
+                Comms::send(myRank - step, 0, pub_map);
+                break;
+            }
+            if ( myRank + step >= nRanks ) continue;
 
-        // Get and apply all the changes
-        Comms::all_gather(myChanges, allChanges);
-        for ( size_t i = 0; i < allChanges.size(); ++i ) {
-            if ( i == (size_t)myRank ) continue;
+            std::vector<SharedObjectChangeSet*> childChanges;
+            std::map<std::string, bool>         childPub;
+            Comms::recv(myRank + step, 0, childChanges);
+            Comms::recv(myRank + step, 0, childPub);
+            for ( auto cs : childChanges ) {
+                cs->applyChanges(this);
+                shared_data[cs->getName()]->getChangeSet()->merge(cs);
+                delete cs;
+            }
+            for ( auto x : childPub ) {
+                auto it = pub_map.find(x.first);
+                if ( it == pub_map.end() ) { pub_map[x.first] = x.second; }
+                else {
+                    it->second = it->second & x.second;
+                }
+            }
+        }
 
-            for ( size_t j = 0; j < allChanges[i].size(); ++j ) {
-                auto cs = allChanges[i][j];
+        // Broadcast the combined changes from rank 0
+        std::vector<SharedObjectChangeSet*> allChanges;
+        if ( myRank == 0 ) {
+            for ( auto x : shared_data ) {
+                allChanges.push_back(x.second->getChangeSet());
+            }
+        }
+        Comms::broadcast(allChanges, 0);
+        Comms::broadcast(pub_map, 0);
+        if ( myRank != 0 ) {
+            for ( auto cs : allChanges ) {
                 cs->applyChanges(this);
                 delete cs;
             }
@@ -83,19 +137,6 @@ SharedObjectDataManager::updateState(bool finalize)
             x.second->getChangeSet()->clear();
         }
 
-        // See if the SharedObjects are ready
-        Comms::all_gather(myFullPub, allFullyPub);
-        std::map<std::string, bool> pub_map;
-        for ( auto x : allFullyPub ) {
-            for ( auto y : x ) {
-                auto it = pub_map.find(y.first);
-                if ( it == pub_map.end() ) { pub_map[y.first] = y.second; }
-                else {
-                    it->second = it->second & y.second;
-                }
-            }
-        }
-
         for ( auto x : pub_map ) {
             shared_data[x.first]->fully_published = x.second;
         }
@@ -118,9 +159,66 @@ SharedObjectDataManager::updateState(bool finalize)
         for ( auto x : shared_data ) {
             x.second->lock();
             x.second->fully_published = true;
+            x.second->freeze();
         }
         locked = true;
+
+#ifdef SST_CONFIG_HAVE_MPI
+        // Move the objects that asked for it into a single window
+        // shared by the ranks on each node.  After the exchange above
+        // every rank holds the same objects with the same contents,
+        // and shared_data is sorted by name, so all ranks compute the
+        // same layout.
+        if ( Simulation_impl::getSimulation()->getNumRanks().rank > 1 && node_window == MPI_WIN_NULL ) {
+            size_t total = 0;
+            for ( auto x : shared_data ) {
+                total += nodeSharedAlign(x.second->getNodeSharedSize());
+            }
+
+            if ( total > 0 ) {
+                int node_rank;
+                MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &node_comm);
+                MPI_Comm_rank(node_comm, &node_rank);
+
+                // Only the first rank on the node allocates; the others
+                // get the address of its memory
+                char* base;
+                MPI_Win_allocate_shared(
+                    node_rank == 0 ? total : 0, 1, MPI_INFO_NULL, node_comm, &base, &node_window);
+                MPI_Aint win_size;
+                int      disp_unit;
+                MPI_Win_shared_query(node_window, 0, &win_size, &disp_unit, &base);
+
+                size_t offset = 0;
+                for ( auto x : shared_data ) {
+                    size_t size = x.second->getNodeSharedSize();
+                    if ( size == 0 ) continue;
+                    x.second->moveToNodeShared(base + offset, node_rank == 0);
+                    offset += nodeSharedAlign(size);
+                }
+
+                // Make the copies visible before any rank on the node
+                // reads them
+                MPI_Win_lock_all(MPI_MODE_NOCHECK, node_window);
+                MPI_Win_sync(node_window);
+                MPI_Barrier(node_comm);
+                MPI_Win_sync(node_window);
+                MPI_Win_unlock_all(node_window);
+            }
+        }
+#endif
+    }
+}
+
+void
+SharedObjectDataManager::releaseNodeSharedMemory()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    if ( node_window != MPI_WIN_NULL ) {
+        MPI_Win_free(&node_window);
+        MPI_Comm_free(&node_comm);
     }
+#endif
 }
 
 } // namespace Shared
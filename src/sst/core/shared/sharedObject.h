@@ -17,8 +17,13 @@
 #include "sst/core/serialization/serializable.h"
 #include "sst/core/sst_types.h"
 
+#include <cstddef>
+#include <functional>
+#include <iterator>
 #include <mutex>
+#include <new>
 #include <string>
+#include <vector>
 
 namespace SST {
 
@@ -29,6 +34,171 @@ namespace Shared {
 namespace Private {
 Output&  getSimulationOutput();
 RankInfo getNumRanks();
+
+/**
+   Allocator that starts the storage of a container on a cache line.
+   Used for the read-only layout of frozen shared objects.
+ */
+template <typename T>
+struct CacheAlignedAllocator
+{
+    typedef T value_type;
+
+    CacheAlignedAllocator() {}
+    template <typename U>
+    CacheAlignedAllocator(const CacheAlignedAllocator<U>&)
+    {}
+
+    T* allocate(size_t n) { return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(64))); }
+    void deallocate(T* p, size_t) { ::operator delete(p, std::align_val_t(64)); }
+
+    template <typename U>
+    bool operator==(const CacheAlignedAllocator<U>&) const
+    {
+        return true;
+    }
+    template <typename U>
+    bool operator!=(const CacheAlignedAllocator<U>&) const
+    {
+        return false;
+    }
+};
+
+/**
+   Iterator over a shared object that walks either the std container
+   used during init, or the sorted array the object was converted to
+   when it was frozen.
+ */
+template <typename ContainerIter>
+class FrozenIterator
+{
+public:
+    typedef std::bidirectional_iterator_tag                             iterator_category;
+    typedef typename std::iterator_traits<ContainerIter>::value_type value_type;
+    typedef std::ptrdiff_t                                              difference_type;
+    typedef const value_type*                                           pointer;
+    typedef const value_type&                                           reference;
+
+    FrozenIterator() : ptr(nullptr) {}
+    FrozenIterator(ContainerIter it) : it(it), ptr(nullptr) {}
+    explicit FrozenIterator(const value_type* ptr) : ptr(ptr) {}
+
+    reference operator*() const { return ptr ? *ptr : *it; }
+    pointer   operator->() const { return &**this; }
+
+    FrozenIterator& operator++()
+    {
+        if ( ptr )
+            ++ptr;
+        else
+            ++it;
+        return *this;
+    }
+    FrozenIterator operator++(int)
+    {
+        FrozenIterator ret = *this;
+        ++*this;
+        return ret;
+    }
+    FrozenIterator& operator--()
+    {
+        if ( ptr )
+            --ptr;
+        else
+            --it;
+        return *this;
+    }
+    FrozenIterator operator--(int)
+    {
+        FrozenIterator ret = *this;
+        --*this;
+        return ret;
+    }
+
+    bool operator==(const FrozenIterator& o) const { return ptr ? ptr == o.ptr : (!o.ptr && it == o.it); }
+    bool operator!=(const FrozenIterator& o) const { return !(*this == o); }
+
+private:
+    ContainerIter     it;
+    const value_type* ptr;
+};
+
+/**
+   Open addressing hash index over the sorted array of a frozen shared
+   object, so a lookup takes a probe or two instead of a binary search.
+   The slots hold positions in the array and are probed linearly.  The
+   array is still used for iteration and ordered searches.
+ */
+template <typename Key>
+class FrozenHashIndex
+{
+public:
+    FrozenHashIndex() : hash(nullptr), shift(0) {}
+
+    /** Hash with std::hash.  Only instantiated for objects that ask
+     * for the index, so other key types don't need a hash. */
+    void useStdHash()
+    {
+        hash = [](const Key& key) -> size_t { return std::hash<Key>()(key); };
+    }
+
+    /** Whether the index was asked for and has been built */
+    bool isBuilt() const { return !slots.empty(); }
+
+    /** Build the index over the array.  key_of gets the key of an
+     * entry.  Does nothing if no hash was set. */
+    template <typename T, typename KeyOf>
+    void build(const T* data, size_t count, KeyOf key_of)
+    {
+        if ( hash == nullptr || count == 0 || count >= EMPTY ) return;
+
+        // A power of two at least 4/3 the count, so the load is
+        // between 3/8 and 3/4
+        size_t size = 1;
+        int    bits = 0;
+        while ( size < count + count / 3 + 1 ) {
+            size <<= 1;
+            bits++;
+        }
+        shift = 64 - bits;
+        slots.assign(size, EMPTY);
+        for ( size_t i = 0; i < count; i++ ) {
+            size_t s = slot(key_of(data[i]));
+            while ( slots[s] != EMPTY )
+                s = (s + 1) & (size - 1);
+            slots[s] = i;
+        }
+    }
+
+    /** Find a key in the array the index was built over.  Returns
+     * data + count if it is not there. */
+    template <typename T, typename KeyOf>
+    const T* find(const T* data, size_t count, const Key& key, KeyOf key_of) const
+    {
+        const size_t mask = slots.size() - 1;
+        for ( size_t s = slot(key); slots[s] != EMPTY; s = (s + 1) & mask ) {
+            const T& entry = data[slots[s]];
+            if ( !(key < key_of(entry)) && !(key_of(entry) < key) ) return &entry;
+        }
+        return data + count;
+    }
+
+    size_t getMemoryEstimate() const { return slots.capacity() * sizeof(uint32_t); }
+
+private:
+    static constexpr uint32_t EMPTY = 0xffffffff;
+
+    // Fibonacci hashing spreads hashes like std::hash of an integer,
+    // which is the integer itself, across the table
+    size_t slot(const Key& key) const { return ((uint64_t)hash(key) * 0x9e3779b97f4a7c15ull) >> shift; }
+
+    typedef size_t (*hash_func)(const Key&);
+
+    hash_func                                              hash;
+    int                                                    shift;
+    std::vector<uint32_t, CacheAlignedAllocator<uint32_t>> slots;
+};
+
 } // namespace Private
 
 // NOTE: The classes in this header file are not part of the public
@@ -56,6 +226,14 @@ public:
      */
     virtual void applyChanges(SharedObjectDataManager* UNUSED(manager)) = 0;
 
+    /**
+       Merge the changes in other into this changeset.  other holds
+       changes made to the same shared data on another rank, and has
+       already been applied to the data on this rank.  Used to combine
+       changesets on their way up the reduction tree.
+     */
+    virtual void merge(SharedObjectChangeSet* other) = 0;
+
     /**
        Clears the data.  Used after transfering data to other ranks to
        prepare for the next round of init.  Child classes should call
@@ -185,6 +363,37 @@ protected:
      */
     void lock() { locked = true; }
 
+    /**
+       Called by the core after lock().  Objects can convert their data
+       to a read-only layout here, since it will not change again.
+       Must be safe to call more than once.
+     */
+    virtual void freeze() {}
+
+    /**
+       Called by the core after freeze() to find how many bytes the
+       object wants placed in memory shared by all ranks on a node.
+       Returns 0 if the object does not use node shared memory.  Must
+       return the same value on every rank.
+     */
+    virtual size_t getNodeSharedSize() { return 0; }
+
+    /**
+       Approximate number of bytes of data the object holds on this
+       rank, for the core's memory accounting.  Node shared memory is
+       not counted.
+     */
+    virtual size_t getMemoryEstimate() { return 0; }
+
+    /**
+       Called by the core to move the data of the object into node
+       shared memory of getNodeSharedSize() bytes.  On each node, one
+       rank is passed copy = true and must copy the data in; the
+       others must only drop their own copy.  The memory cannot be
+       read until the core has synchronized the node.
+     */
+    virtual void moveToNodeShared(void* UNUSED(ptr), bool UNUSED(copy)) {}
+
     /**
        Constructor for SharedObjectData
 
@@ -255,6 +464,27 @@ public:
     }
 
     void updateState(bool finalize);
+
+    /**
+       Approximate number of bytes of data held by all the shared
+       objects on this rank
+     */
+    size_t getMemoryEstimate()
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        size_t                      total = 0;
+        for ( auto x : shared_data ) {
+            total += x.second->getMemoryEstimate();
+        }
+        return total;
+    }
+
+    /**
+       Release the node shared memory used by the shared objects.
+       Must be called by every rank once the simulation is over, and
+       no shared objects can be read afterwards.
+     */
+    void releaseNodeSharedMemory();
 };
 
 class SharedObject
@@ -14,32 +14,57 @@
 #include "sst/core/simulation_impl.h"
 // simulation_impl header should stay here
 
+#include "sst/core/boundaryTrace.h"
+#include "sst/core/checkpointAction.h"
 #include "sst/core/clock.h"
 #include "sst/core/config.h"
 #include "sst/core/configGraph.h"
+#include "sst/core/directDeliveryQueue.h"
 #include "sst/core/exit.h"
 #include "sst/core/factory.h"
 #include "sst/core/heartbeat.h"
+#include "sst/core/impl/timevortex/timeVortexAdaptive.h"
+#include "sst/core/impl/timevortex/timeVortexBinnedRing.h"
+#include "sst/core/impl/timevortex/timeVortexBucketed.h"
+#include "sst/core/impl/timevortex/timeVortexCalendarQueue.h"
+#include "sst/core/impl/timevortex/timeVortexDHeap.h"
+#include "sst/core/impl/timevortex/timeVortexPQ.h"
+#include "sst/core/impl/timevortex/timeVortexSimdHeap.h"
+#include "sst/core/impl/timevortex/timeVortexSpill.h"
 #include "sst/core/linkMap.h"
 #include "sst/core/linkPair.h"
+#include "sst/core/mempoolAccessor.h"
+#include "sst/core/metrics.h"
+#include "sst/core/oneshot.h"
 #include "sst/core/output.h"
 #include "sst/core/profile/clockHandlerProfileTool.h"
 #include "sst/core/profile/eventHandlerProfileTool.h"
 #include "sst/core/profile/syncProfileTool.h"
 #include "sst/core/shared/sharedObject.h"
+#include "sst/core/simulation_runloop.h"
 #include "sst/core/statapi/statengine.h"
 #include "sst/core/stopAction.h"
 #include "sst/core/stringize.h"
 #include "sst/core/sync/syncManager.h"
 #include "sst/core/sync/syncQueue.h"
+#include "sst/core/threadAffinity.h"
 #include "sst/core/timeConverter.h"
 #include "sst/core/timeLord.h"
 #include "sst/core/timeVortex.h"
 #include "sst/core/unitAlgebra.h"
 #include "sst/core/warnmacros.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cinttypes>
+#include <cstring>
+#include <set>
+#include <sstream>
+#include <string_view>
+#include <thread>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
 #define SST_SIMTIME_MAX 0xffffffffffffffff
 
@@ -48,6 +73,398 @@ using namespace SST::Shared;
 
 namespace SST {
 
+namespace {
+
+using SST::Core::Serialization::serializer;
+
+const char CHECKPOINT_MAGIC[8] = { 'S', 'S', 'T', 'C', 'K', 'P', 'T', '\0' };
+
+// Kinds of activity saved from the TimeVortex
+enum CheckpointActivityType : int32_t {
+    CKPT_EVENT,
+    CKPT_CLOCK,
+    CKPT_ONESHOT,
+    CKPT_EXIT,
+    CKPT_HEARTBEAT,
+    CKPT_CLOCK_WAKEUP
+};
+
+struct CheckpointActivity
+{
+    int32_t       type;
+    SimTime_t     time;
+    SimTime_t     factor   = 0; // Key of a Clock or OneShot
+    int32_t       priority = 0;
+    ComponentId_t comp     = 0; // Port an Event is delivered to
+    std::string   port;
+    Event*        event = nullptr;
+    Cycle_t       cycle = 0; // Cycle a Clock that skipped ahead fires on
+};
+
+struct CheckpointClock
+{
+    SimTime_t factor;
+    int32_t   priority;
+    Cycle_t   current_cycle;
+    SimTime_t next;
+    bool                 scheduled;
+    uint64_t             handlers;
+    std::vector<Cycle_t>  wakes; // Next cycle of each handler that can skip ahead
+    std::vector<uint64_t> awake; // Bitmap of the suspendable handlers that are awake
+};
+
+struct CheckpointOneShot
+{
+    SimTime_t                                   factor;
+    int32_t                                     priority;
+    bool                                        scheduled;
+    std::vector<std::pair<SimTime_t, uint64_t>> entries; // Time and handler count, newest first
+};
+
+struct CheckpointData
+{
+    uint32_t                                    rank;
+    uint32_t                                    num_ranks;
+    uint32_t                                    thread;
+    uint32_t                                    num_threads;
+    uint32_t                                    index;
+    SimTime_t                                   cycle;
+    int32_t                                     priority;
+    SimTime_t                                   rank_sync_time;
+    SimTime_t                                   thread_sync_time;
+    uint64_t                                    event_id;
+    std::map<ComponentId_t, std::vector<char>> components;
+    std::map<ComponentId_t, std::vector<char>> statistics;
+    std::map<ComponentId_t, uint32_t>          component_refs; // Unchanged since the checkpoint with this index
+    std::map<ComponentId_t, uint32_t>          statistic_refs;
+    std::vector<CheckpointClock>                clocks;
+    std::vector<CheckpointOneShot>              oneshots;
+    std::vector<ComponentId_t>                  exit_ids;
+    SimTime_t                                   exit_end_time;
+    std::vector<CheckpointActivity>             activities;
+};
+
+template <typename T, typename F>
+void
+serializeCheckpointVector(serializer& ser, std::vector<T>& vec, F func)
+{
+    size_t count = vec.size();
+    ser&   count;
+    if ( ser.mode() == serializer::UNPACK ) vec.resize(count);
+    for ( auto& item : vec ) {
+        func(item);
+    }
+}
+
+void
+serializeCheckpoint(serializer& ser, CheckpointData& data)
+{
+    ser& data.rank;
+    ser& data.num_ranks;
+    ser& data.thread;
+    ser& data.num_threads;
+    ser& data.index;
+    ser& data.cycle;
+    ser& data.priority;
+    ser& data.rank_sync_time;
+    ser& data.thread_sync_time;
+    ser& data.event_id;
+    ser& data.components;
+    ser& data.statistics;
+    ser& data.component_refs;
+    ser& data.statistic_refs;
+    serializeCheckpointVector(ser, data.clocks, [&](CheckpointClock& clock) {
+        ser& clock.factor;
+        ser& clock.priority;
+        ser& clock.current_cycle;
+        ser& clock.next;
+        ser& clock.scheduled;
+        ser& clock.handlers;
+        ser& clock.wakes;
+        ser& clock.awake;
+    });
+    serializeCheckpointVector(ser, data.oneshots, [&](CheckpointOneShot& oneshot) {
+        ser& oneshot.factor;
+        ser& oneshot.priority;
+        ser& oneshot.scheduled;
+        serializeCheckpointVector(ser, oneshot.entries, [&](std::pair<SimTime_t, uint64_t>& entry) {
+            ser& entry.first;
+            ser& entry.second;
+        });
+    });
+    ser& data.exit_ids;
+    ser& data.exit_end_time;
+    serializeCheckpointVector(ser, data.activities, [&](CheckpointActivity& act) {
+        ser& act.type;
+        ser& act.time;
+        ser& act.factor;
+        ser& act.priority;
+        ser& act.comp;
+        ser& act.port;
+        if ( act.type == CKPT_EVENT ) ser& act.event;
+        ser& act.cycle;
+    });
+}
+
+// Sizes and then packs the data serialized by func into a buffer
+template <typename F>
+std::vector<char>
+packCheckpoint(F func)
+{
+    serializer ser;
+
+    ser.start_sizing();
+    func(ser);
+
+    std::vector<char> buffer(ser.size());
+    ser.start_packing(buffer.data(), buffer.size());
+    func(ser);
+    return buffer;
+}
+
+// Collects the components and subcomponents that have been created
+std::vector<ComponentInfo*>
+collectComponentInfos(ComponentInfoMap& map)
+{
+    std::vector<ComponentInfo*> infos;
+    for ( auto* info : map.getTree() ) {
+        if ( info->getComponent() ) infos.push_back(info);
+    }
+    return infos;
+}
+
+std::string
+getCheckpointFileName(const std::string& checkpoint, const RankInfo& rank)
+{
+    return checkpoint + "_" + std::to_string(rank.rank) + "_" + std::to_string(rank.thread) + ".sstcpt";
+}
+
+// Writes a packed checkpoint to file, then prints message if it is
+// not empty
+void
+writeCheckpointFile(const std::string& filename, const std::vector<char>& buffer, const std::string& message)
+{
+    Output& out = Simulation_impl::getSimulationOutput();
+    FILE*   fp  = fopen(filename.c_str(), "wb");
+    if ( nullptr == fp ) {
+        out.fatal(CALL_INFO, 1, "ERROR: Unable to open checkpoint file %s: %s\n", filename.c_str(), strerror(errno));
+    }
+    uint64_t size = buffer.size();
+    bool     ok   = fwrite(CHECKPOINT_MAGIC, 1, sizeof(CHECKPOINT_MAGIC), fp) == sizeof(CHECKPOINT_MAGIC) &&
+              fwrite(&size, sizeof(size), 1, fp) == 1 && fwrite(buffer.data(), 1, size, fp) == size;
+    if ( fclose(fp) != 0 || !ok ) {
+        out.fatal(CALL_INFO, 1, "ERROR: Unable to write checkpoint file %s\n", filename.c_str());
+    }
+    if ( !message.empty() ) out.output("%s", message.c_str());
+}
+
+// Reads and unpacks a checkpoint file
+void
+readCheckpointFile(const std::string& filename, CheckpointData& data)
+{
+    Output&           out = Simulation_impl::getSimulationOutput();
+    std::vector<char> buffer;
+    char              magic[sizeof(CHECKPOINT_MAGIC)];
+    uint64_t          size = 0;
+
+    FILE* fp = fopen(filename.c_str(), "rb");
+    if ( nullptr == fp ) {
+        out.fatal(CALL_INFO, 1, "ERROR: Unable to open checkpoint file %s: %s\n", filename.c_str(), strerror(errno));
+    }
+    bool ok = fread(magic, 1, sizeof(magic), fp) == sizeof(magic) &&
+              memcmp(magic, CHECKPOINT_MAGIC, sizeof(magic)) == 0 && fread(&size, sizeof(size), 1, fp) == 1;
+    if ( ok ) {
+        buffer.resize(size);
+        ok = fread(buffer.data(), 1, size, fp) == size;
+    }
+    fclose(fp);
+    if ( !ok ) { out.fatal(CALL_INFO, 1, "ERROR: %s is not a valid checkpoint file\n", filename.c_str()); }
+
+    serializer ser;
+    ser.start_unpacking(buffer.data(), buffer.size());
+    serializeCheckpoint(ser, data);
+}
+
+// Reads the file of checkpoint written by a rank and thread.  The
+// state of components that had not changed since an earlier
+// incremental checkpoint is read from that checkpoint.
+void
+loadCheckpointFile(const std::string& checkpoint, const RankInfo& rank, CheckpointData& data)
+{
+    Output&     out      = Simulation_impl::getSimulationOutput();
+    std::string filename = getCheckpointFileName(checkpoint, rank);
+    readCheckpointFile(filename, data);
+
+    if ( data.component_refs.empty() && data.statistic_refs.empty() ) return;
+
+    std::string suffix = "_" + std::to_string(data.index);
+    if ( checkpoint.size() <= suffix.size() ||
+         checkpoint.compare(checkpoint.size() - suffix.size(), suffix.size(), suffix) != 0 ) {
+        out.fatal(
+            CALL_INFO, 1,
+            "ERROR: Checkpoint file %s is incremental and must be loaded by its name PREFIX%s, so the checkpoints it "
+            "refers to can be found\n",
+            filename.c_str(), suffix.c_str());
+    }
+    std::string prefix = checkpoint.substr(0, checkpoint.size() - suffix.size());
+
+    std::map<uint32_t, CheckpointData> earlier;
+    auto resolve = [&](std::map<ComponentId_t, uint32_t>& refs, std::map<ComponentId_t, std::vector<char>>& saved,
+                       std::map<ComponentId_t, std::vector<char>> CheckpointData::*field) {
+        for ( auto& ref : refs ) {
+            std::string earlier_name = getCheckpointFileName(prefix + "_" + std::to_string(ref.second), rank);
+            if ( !earlier.count(ref.second) ) {
+                CheckpointData& loaded = earlier[ref.second];
+                readCheckpointFile(earlier_name, loaded);
+                // Only the component state is needed
+                for ( auto& act : loaded.activities ) {
+                    if ( act.type == CKPT_EVENT ) delete act.event;
+                }
+            }
+            auto& from = earlier[ref.second].*field;
+            auto  it   = from.find(ref.first);
+            if ( it == from.end() ) {
+                out.fatal(
+                    CALL_INFO, 1, "ERROR: Checkpoint file %s does not hold the state of component %" PRIu64 "\n",
+                    earlier_name.c_str(), ref.first);
+            }
+            saved[ref.first] = std::move(it->second);
+        }
+    };
+    resolve(data.component_refs, data.components, &CheckpointData::components);
+    resolve(data.statistic_refs, data.statistics, &CheckpointData::statistics);
+}
+
+// Moves the parts of a checkpoint file written with a different
+// number of ranks or threads that are needed by the components in
+// local into data.  Component state and events go with the component
+// they belong to.  Clocks, OneShots and the heartbeat run at the same
+// times on every thread that has them, so they are taken from the
+// first file that has them.
+void
+mergeCheckpoint(CheckpointData& from, const std::set<ComponentId_t>& local, CheckpointData& data)
+{
+    for ( auto& comp : from.components ) {
+        if ( local.count(comp.first) ) data.components[comp.first] = std::move(comp.second);
+    }
+    for ( auto& stat : from.statistics ) {
+        if ( local.count(stat.first) ) data.statistics[stat.first] = std::move(stat.second);
+    }
+
+    std::set<std::pair<SimTime_t, int>> clocks;
+    std::set<std::pair<SimTime_t, int>> oneshots;
+    for ( auto& clock : from.clocks ) {
+        bool found = false;
+        for ( auto& saved : data.clocks ) {
+            found = found || (saved.factor == clock.factor && saved.priority == clock.priority);
+        }
+        if ( found ) continue;
+        clocks.emplace(clock.factor, clock.priority);
+        data.clocks.push_back(clock);
+    }
+    for ( auto& oneshot : from.oneshots ) {
+        bool found = false;
+        for ( auto& saved : data.oneshots ) {
+            found = found || (saved.factor == oneshot.factor && saved.priority == oneshot.priority);
+        }
+        if ( found ) continue;
+        oneshots.emplace(oneshot.factor, oneshot.priority);
+        data.oneshots.push_back(oneshot);
+    }
+
+    for ( auto id : from.exit_ids ) {
+        if ( local.count(id) ) data.exit_ids.push_back(id);
+    }
+    data.exit_end_time = std::max(data.exit_end_time, from.exit_end_time);
+    data.event_id      = std::max(data.event_id, from.event_id);
+
+    bool heartbeat = false;
+    for ( auto& act : data.activities ) {
+        heartbeat = heartbeat || act.type == CKPT_HEARTBEAT;
+    }
+    for ( auto& act : from.activities ) {
+        std::pair<SimTime_t, int> key(act.factor, act.priority);
+        bool                      keep = false;
+        switch ( act.type ) {
+        case CKPT_EVENT:
+            keep = local.count(act.comp);
+            if ( !keep ) delete act.event;
+            break;
+        case CKPT_CLOCK:
+        case CKPT_CLOCK_WAKEUP:
+            keep = clocks.count(key);
+            break;
+        case CKPT_ONESHOT:
+            keep = oneshots.count(key);
+            break;
+        case CKPT_HEARTBEAT:
+            keep = !heartbeat;
+            break;
+        default:
+            // Exit is only scheduled when running on one thread of
+            // one rank, otherwise the syncs check for the end of the
+            // simulation
+            break;
+        }
+        if ( keep ) data.activities.push_back(act);
+    }
+}
+
+} // anonymous namespace
+
+// State of a thread saved in memory by saveSnapshot().  Clocks,
+// OneShots and the other actions live through the rollback, so only
+// their fields are copied.  Events are delivered and deleted, so
+// packed copies are kept.
+struct Simulation_impl::Snapshot
+{
+    struct ClockState
+    {
+        Cycle_t                          current_cycle;
+        Clock::StaticHandlerMap_t        handlers;
+        size_t                           num_handlers;
+        SimTime_t                        next;
+        bool                             scheduled;
+        bool                             grouped;
+        std::vector<Clock::HandlerBase*> suspendable;
+        std::vector<uint64_t>            awake;
+        size_t                           num_awake;
+    };
+
+    struct GroupState
+    {
+        SimTime_t time;
+        bool      scheduled;
+    };
+
+    struct OneShotState
+    {
+        std::vector<std::pair<SimTime_t, OneShot::HandlerList_t>> entries;
+        bool                                                      scheduled;
+    };
+
+    // One entry of the TimeVortex, in the order they were popped
+    struct Entry
+    {
+        SimTime_t         time;
+        Activity*         action     = nullptr;
+        std::vector<char> event;                // Packed Event if action is not set
+        Clock*            wake_clock = nullptr; // Clock of a WakeUp
+        Cycle_t           wake_cycle = 0;
+    };
+
+    SimTime_t                                                  cycle;
+    int                                                        priority;
+    uint64_t                                                   event_id;
+    std::vector<std::pair<BaseComponent*, std::vector<char>>> components; // State and statistics
+    std::map<Clock*, ClockState>                               clocks;
+    std::map<Clock::Group*, GroupState>                        groups;
+    std::map<OneShot*, OneShotState>                           oneshots;
+    std::unordered_set<ComponentId_t>                          exit_ids;
+    SimTime_t                                                  exit_end_time;
+    std::vector<Entry>                                         activities;
+};
+
 /**   Simulation functions **/
 
 /** Non-static functions **/
@@ -95,7 +512,9 @@ Simulation_impl::~Simulation_impl()
 
     // Delete the timeVortex first.  This will delete all events left
     // in the queue, as well as the Sync, Exit and Clock objects.
+    delete directQueue;
     delete timeVortex;
+    delete snapshot;
 
     // Delete all the components
     // for ( CompMap_t::iterator it = compMap.begin(); it != compMap.end(); ++it ) {
@@ -105,6 +524,13 @@ Simulation_impl::~Simulation_impl()
 
     // Clocks already got deleted by timeVortex, simply clear the clockMap
     clockMap.clear();
+    clockGroupMap.clear();
+
+    // The batches' handlers went with the clocks, but not the batches
+    for ( auto& entry : clockBatchMap ) {
+        delete entry.second;
+    }
+    clockBatchMap.clear();
 
     // OneShots already got deleted by timeVortex, simply clear the onsShotMap
     oneShotMap.clear();
@@ -112,10 +538,14 @@ Simulation_impl::~Simulation_impl()
     // Clear out Components
     compInfoMap.clear();
 
+    delete boundary_trace;
+
     // Clean up the profile tools
     for ( auto x : profile_tools )
         delete x.second;
 
+    if ( current_instance == this ) current_instance = nullptr;
+
     // // Delete any remaining links.  This should never happen now, but
     // // when we add an API to have components build subcomponents, user
     // // error could cause LinkMaps to be left.
@@ -143,9 +573,14 @@ Simulation_impl::createSimulation(Config* config, RankInfo my_rank, RankInfo num
 
     std::lock_guard<std::mutex> lock(simulationMutex);
     instanceMap[tid] = instance;
+    current_instance = instance;
     instanceVec.resize(num_ranks.thread);
     instanceVec[my_rank.thread] = instance;
     instance->intializeProfileTools(config->enabledProfiling());
+    // One metrics writer per rank, created by whichever thread gets here first
+    if ( config->metrics_file() != "" && m_metrics == nullptr ) {
+        m_metrics = new SimulatorMetrics(config->metrics_file(), config->metrics_period(), my_rank, num_ranks);
+    }
     return instance;
 }
 
@@ -153,15 +588,32 @@ void
 Simulation_impl::shutdown()
 {
     instanceMap.clear();
+    // Node shared memory must be released before MPI is finalized
+    SharedObject::manager.releaseNodeSharedMemory();
     // Done with sync object, delete it
     delete Simulation_impl::m_exit;
+    delete Simulation_impl::m_metrics;
+    Simulation_impl::m_metrics = nullptr;
 }
 
 Simulation_impl::Simulation_impl(Config* cfg, RankInfo my_rank, RankInfo num_ranks) :
     Simulation(),
     timeVortex(nullptr),
+    directQueue(nullptr),
+    tight_clock_loop(cfg->tight_clock_loop() && num_ranks.thread == 1),
     interThreadMinLatency(MAX_SIMTIME_T),
+    interThreadLookahead(MAX_SIMTIME_T),
+    m_heartbeat(nullptr),
+    boundary_trace(nullptr),
+    events_executed(0),
     endSim(false),
+    checkpoint_period(0),
+    next_checkpoint(0),
+    checkpoint_index(0),
+    checkpoint_prefix(cfg->checkpoint_prefix()),
+    load_checkpoint(cfg->load_checkpoint()),
+    checkpoint_async(cfg->checkpoint_async()),
+    checkpoint_incremental(cfg->checkpoint_incremental()),
     untimed_phase(0),
     lastRecvdSignal(0),
     shutdown_mode(SHUTDOWN_CLEAN),
@@ -170,24 +622,49 @@ Simulation_impl::Simulation_impl(Config* cfg, RankInfo my_rank, RankInfo num_ran
     currentSimCycle(0),
     currentPriority(0),
     endSimCycle(0),
+    stopAtCycle(MAX_SIMTIME_T),
     my_rank(my_rank),
     num_ranks(num_ranks),
     run_phase_start_time(0.0),
     run_phase_total_time(0.0),
+    run_loop_time(0.0),
+    run_barrier_time(0.0),
+    track_sync_time(cfg->metrics_file() != "" || cfg->print_imbalance()),
     init_phase_start_time(0.0),
     init_phase_total_time(0.0),
     complete_phase_start_time(0.0),
-    complete_phase_total_time(0.0)
+    complete_phase_total_time(0.0),
+    snapshot(nullptr)
 {
     sim_output.init(cfg->output_core_prefix(), cfg->verbose(), 0, Output::STDOUT);
     output_directory = cfg->output_directory();
     Params p;
     // params get passed twice - both the params and a ctor argument
-    direct_interthread = cfg->interthread_links();
+    direct_interthread      = cfg->interthread_links();
+    interthread_lookahead   = cfg->interthread_lookahead();
+    sync_compress_threshold = cfg->sync_compress_threshold();
+    sync_nonblocking_reduce = cfg->sync_nonblocking_reduce();
+    sync_sparse_untimed     = cfg->sync_sparse_untimed();
+    rank_sync               = cfg->rank_sync();
+    optimistic_window       = 0;
+    construct_threads       = cfg->construct_threads();
+    active_untimed_phases   = cfg->active_untimed_phases();
+    parallel_construct      = false;
     std::string timevortex_type(cfg->timeVortex());
     if ( direct_interthread && num_ranks.thread > 1 ) timevortex_type = timevortex_type + ".ts";
+    p.insert("thread_count", std::to_string(num_ranks.thread));
+    std::stringstream vortex_params(cfg->timeVortexParams());
+    std::string       param;
+    while ( std::getline(vortex_params, param, ',') ) {
+        size_t eq = param.find('=');
+        p.insert(param.substr(0, eq), param.substr(eq + 1));
+    }
     timeVortex = factory->Create<TimeVortex>(timevortex_type, p);
-    if ( my_rank.thread == 0 ) { m_exit = new Exit(num_ranks.thread, num_ranks.rank == 1); }
+    run_loop   = selectRunLoop(timevortex_type);
+    if ( cfg->direct_delivery() ) { directQueue = new DirectDeliveryQueue(timeVortex, currentSimCycle); }
+    if ( my_rank.thread == 0 ) {
+        m_exit = new Exit(num_ranks.thread, num_ranks.rank == 1, cfg->deferred_exit_check());
+    }
 
     if ( cfg->heartbeatPeriod() != "" && my_rank.thread == 0 ) {
         sim_output.output("# Creating simulation heartbeat at period of %s.\n", cfg->heartbeatPeriod().c_str());
@@ -195,6 +672,38 @@ Simulation_impl::Simulation_impl(Config* cfg, RankInfo my_rank, RankInfo num_ran
             new SimulatorHeartbeat(cfg, my_rank.rank, this, timeLord.getTimeConverter(cfg->heartbeatPeriod()));
     }
 
+    if ( cfg->checkpoint_period() != "" ) {
+        checkpoint_period = timeLord.getSimCycles(cfg->checkpoint_period(), "checkpoint period");
+        if ( checkpoint_period == 0 ) {
+            sim_output.fatal(
+                CALL_INFO, 1, "ERROR: Checkpoint period %s is less than the core timebase\n",
+                cfg->checkpoint_period().c_str());
+        }
+        next_checkpoint = checkpoint_period;
+        if ( my_rank.rank == 0 && my_rank.thread == 0 ) {
+            sim_output.output("# Writing checkpoints at period of %s.\n", cfg->checkpoint_period().c_str());
+        }
+    }
+
+    if ( cfg->boundary_record() != "" || cfg->boundary_replay() != "" ) {
+        if ( num_ranks.rank > 1 || num_ranks.thread > 1 ) {
+            sim_output.fatal(CALL_INFO, 1, "ERROR: Boundary traces can only be recorded or replayed on one thread\n");
+        }
+        if ( cfg->boundary_record() != "" && cfg->boundary_replay() != "" ) {
+            sim_output.fatal(CALL_INFO, 1, "ERROR: --boundary-record and --boundary-replay can't be used together\n");
+        }
+        if ( cfg->boundary_components() == "" ) {
+            sim_output.fatal(CALL_INFO, 1, "ERROR: Boundary traces require --boundary-components\n");
+        }
+        bool replay    = cfg->boundary_replay() != "";
+        boundary_trace = new BoundaryTrace(
+            cfg->boundary_components(), replay ? cfg->boundary_replay() : cfg->boundary_record(), replay);
+    }
+
+    if ( cfg->optimistic_window() != "" ) {
+        optimistic_window = timeLord.getSimCycles(cfg->optimistic_window(), "optimistic window");
+    }
+
     // Need to create the thread sync if there is more than one thread
     if ( num_ranks.thread > 1 ) {}
 }
@@ -204,6 +713,7 @@ Simulation_impl::setStopAtCycle(Config* cfg)
 {
     SimTime_t stopAt = timeLord.getSimCycles(cfg->stop_at(), "StopAction configure");
     if ( stopAt != 0 ) {
+        stopAtCycle    = stopAt;
         StopAction* sa = new StopAction();
         sa->setDeliveryTime(stopAt);
         timeVortex->insert(sa);
@@ -225,6 +735,7 @@ Simulation_impl::requireLibrary(const std::string& name)
 SimTime_t
 Simulation_impl::getNextActivityTime() const
 {
+    if ( directQueue && !directQueue->empty() ) return currentSimCycle;
     return timeVortex->front()->getDeliveryTime();
 }
 
@@ -239,6 +750,24 @@ Simulation_impl::getLocalMinimumNextActivityTime()
     return ret;
 }
 
+SimTime_t
+Simulation_impl::getLocalMinimumNextSyncTime()
+{
+    // Nothing a thread does before its next activity can send an
+    // event to another thread, and anything it sends after that will
+    // take at least its lookahead to arrive.  This reads the other
+    // threads' TimeVortex through front(), which leaves it unchanged
+    SimTime_t ret = MAX_SIMTIME_T;
+    for ( auto&& instance : instanceVec ) {
+        if ( instance->interThreadLookahead == MAX_SIMTIME_T ) continue;
+        SimTime_t next = instance->getNextActivityTime();
+        if ( next > MAX_SIMTIME_T - instance->interThreadLookahead ) continue;
+        next += instance->interThreadLookahead;
+        if ( next < ret ) { ret = next; }
+    }
+    return ret;
+}
+
 void
 Simulation_impl::processGraphInfo(ConfigGraph& graph, const RankInfo& UNUSED(myRank), SimTime_t min_part)
 {
@@ -253,7 +782,8 @@ Simulation_impl::processGraphInfo(ConfigGraph& graph, const RankInfo& UNUSED(myR
     }
 
     interThreadMinLatency      = MAX_SIMTIME_T;
-    int num_cross_thread_links = 0;
+    int                 num_cross_thread_links = 0;
+    std::vector<size_t> cross_thread_counts(num_ranks.thread, 0);
     if ( num_ranks.thread > 1 ) {
         // Need to determine the lookahead for the thread synchronization
         ConfigComponentMap_t comps = graph.getComponentMap();
@@ -287,14 +817,29 @@ Simulation_impl::processGraphInfo(ConfigGraph& graph, const RankInfo& UNUSED(myR
                 if ( clink->getMinLatency() < interThreadLatencies[rank[1].thread] ) {
                     interThreadLatencies[rank[1].thread] = clink->getMinLatency();
                 }
+                cross_thread_counts[rank[1].thread]++;
             }
             else if ( rank[1].thread == my_rank.thread ) {
                 if ( clink->getMinLatency() < interThreadLatencies[rank[0].thread] ) {
                     interThreadLatencies[rank[0].thread] = clink->getMinLatency();
                 }
+                cross_thread_counts[rank[0].thread]++;
             }
         }
     }
+
+    // Size the slots for pairing the direct links to higher numbered
+    // threads.  There is a barrier before prepareLinks() uses them.
+    if ( direct_interthread ) {
+        cross_thread_slots.resize(num_ranks.thread);
+        for ( uint32_t i = my_rank.thread + 1; i < num_ranks.thread; i++ ) {
+            cross_thread_slots[i] = std::vector<std::atomic<Link*>>(cross_thread_counts[i]);
+        }
+    }
+    interThreadLookahead = MAX_SIMTIME_T;
+    for ( auto lat : interThreadLatencies ) {
+        if ( lat < interThreadLookahead ) interThreadLookahead = lat;
+    }
     // Create the SyncManager for this rank.  It gets created even if
     // we are single rank/single thread because it also manages the
     // Exit and Heartbeat actions.
@@ -309,6 +854,8 @@ Simulation_impl::processGraphInfo(ConfigGraph& graph, const RankInfo& UNUSED(myR
         syncManager->addProfileTool(tool);
     }
 
+    if ( track_sync_time ) syncManager->trackSyncTime();
+
 
     // Determine if this thread is independent.  That means there is
     // no need to synchronize with any other threads or ranks.
@@ -326,15 +873,23 @@ Simulation_impl::initializeStatisticEngine(ConfigGraph& graph)
 }
 
 
+bool
+Simulation_impl::isReplaced(const ConfigComponent* ccomp) const
+{
+    return boundary_trace != nullptr && boundary_trace->isReplaying() && !boundary_trace->isInside(ccomp->name);
+}
+
 int
 Simulation_impl::prepareLinks(ConfigGraph& graph, const RankInfo& myRank, SimTime_t UNUSED(min_part))
 {
+    cross_thread_next.assign(num_ranks.thread, 0);
+
     // First, go through all the components that are in this rank and
     // create the ComponentInfo object for it
     // Now, build all the components
     for ( ConfigComponentMap_t::const_iterator iter = graph.comps.begin(); iter != graph.comps.end(); ++iter ) {
         ConfigComponent* ccomp = *iter;
-        if ( ccomp->rank == myRank ) {
+        if ( ccomp->rank == myRank && !isReplaced(ccomp) ) {
             compInfoMap.insert(new ComponentInfo(ccomp, ccomp->name, nullptr, new LinkMap()));
         }
     }
@@ -352,6 +907,36 @@ Simulation_impl::prepareLinks(ConfigGraph& graph, const RankInfo& myRank, SimTim
             // Nothing to be done
             continue;
         }
+
+        // Links into the components a boundary trace is recorded for
+        // or replayed to.  There is only one rank and thread.
+        if ( boundary_trace != nullptr ) {
+            ConfigComponent* ccomp[2] = { graph.comps[COMPONENT_ID_MASK(clink->component[0])],
+                                          graph.comps[COMPONENT_ID_MASK(clink->component[1])] };
+            if ( isReplaced(ccomp[0]) && isReplaced(ccomp[1]) ) continue;
+
+            bool inside = boundary_trace->isInside(ccomp[0]->name);
+            if ( inside != boundary_trace->isInside(ccomp[1]->name) ) {
+                int local = inside ? 0 : 1;
+
+                LinkPair lp(clink->order);
+                lp.getLeft()->setLatency(clink->latency[local]);
+                lp.getRight()->setLatency(clink->latency[1 - local]);
+                compInfoMap.getByID(clink->component[local])
+                    ->getLinkMap()
+                    ->insertLink(clink->port[local], lp.getLeft());
+
+                // When replaying, the trace stands in for the other end
+                if ( !boundary_trace->isReplaying() ) {
+                    compInfoMap.getByID(clink->component[1 - local])
+                        ->getLinkMap()
+                        ->insertLink(clink->port[1 - local], lp.getRight());
+                }
+                boundary_trace->addLink(ccomp[local]->name + ":" + clink->port[local], lp.getRight());
+                continue;
+            }
+        }
+
         // Same rank, same thread
         else if ( rank[0] == rank[1] ) {
             // Check to see if this is loopback link
@@ -403,25 +988,20 @@ Simulation_impl::prepareLinks(ConfigGraph& graph, const RankInfo& myRank, SimTim
 
             Link* link = new Link(clink->order);
             link->setLatency(clink->latency[local]);
-
-            // Need to mutex to access cross_thread_links
-            {
-                std::lock_guard<SST::Core::ThreadSafe::Spinlock> lock(cross_thread_lock);
-                if ( cross_thread_links.find(clink->id) != cross_thread_links.end() ) {
-                    // The other side already initialized.  Hook them
-                    // together as a pair.
-                    Link* other_link      = cross_thread_links[clink->id];
-                    link->pair_link       = other_link;
-                    other_link->pair_link = link;
-                    // Remove entry from map
-                    cross_thread_links.erase(clink->id);
-                }
-                else {
-                    // Nothing to do until the other side is created.
-                    // Just add myself to the map so the other side can
-                    // find me later.
-                    cross_thread_links[clink->id] = link;
-                }
+            link->setPeerRank(rank[1 - local]);
+
+            // Both threads find the links between them in the same
+            // order, so they use the same slot for this one.  Whoever
+            // gets there second hooks them together as a pair.
+            uint32_t peer  = rank[1 - local].thread;
+            uint32_t lower = std::min(peer, my_rank.thread);
+            uint32_t upper = std::max(peer, my_rank.thread);
+            Link*    other_link =
+                instanceVec[lower]->cross_thread_slots[upper][cross_thread_next[peer]++].exchange(
+                    link, std::memory_order_acq_rel);
+            if ( other_link != nullptr ) {
+                link->pair_link       = other_link;
+                other_link->pair_link = link;
             }
             ComponentInfo* cinfo = compInfoMap.getByID(clink->component[local]);
             if ( cinfo == nullptr ) { sim_output.fatal(CALL_INFO, 1, "Couldn't find ComponentInfo in map."); }
@@ -444,6 +1024,7 @@ Simulation_impl::prepareLinks(ConfigGraph& graph, const RankInfo& myRank, SimTim
             LinkPair lp(clink->order);
 
             lp.getLeft()->setLatency(clink->latency[local]);
+            lp.getLeft()->setPeerRank(rank[remote]);
             lp.getRight()->setLatency(0);
             lp.getRight()->setDefaultTimeBase(minPartToTC(1));
 
@@ -476,25 +1057,68 @@ Simulation_impl::performWireUp(ConfigGraph& graph, const RankInfo& myRank, SimTi
     // Params objects should now start verifying parameters
     Params::enableVerify();
 
+    // All the threads are done pairing cross thread links
+    cross_thread_slots.clear();
+    cross_thread_slots.shrink_to_fit();
+
 
     // Now, build all the components
+    std::vector<ConfigComponent*> to_build;
     for ( auto iter = graph.comps.begin(); iter != graph.comps.end(); ++iter ) {
         ConfigComponent* ccomp = *iter;
 
-        if ( ccomp->rank == myRank ) {
-            Component* tmp;
-
+        if ( ccomp->rank == myRank && !isReplaced(ccomp) ) {
             // Check to make sure there are any entries in the component's LinkMap
             ComponentInfo* cinfo = compInfoMap.getByID(ccomp->id);
             if ( !cinfo->hasLinks() ) {
                 printf("WARNING: Building component \"%s\" with no links assigned.\n", ccomp->name.c_str());
             }
+            to_build.push_back(ccomp);
+        }
+    } // end for all vertex
 
-            tmp = createComponent(ccomp->id, ccomp->type, ccomp->params);
+    // Each component only touches its own ComponentInfo and LinkMap
+    // while being constructed, so components can be built in any
+    // order.  Anything shared across components is protected by
+    // getConstructLock() while parallel_construct is set.
+    std::atomic<size_t> next_comp(0);
+    auto                build = [&]() {
+        size_t i;
+        while ( (i = next_comp++) < to_build.size() ) {
+            ConfigComponent* ccomp = to_build[i];
+            Component*       tmp   = createComponent(ccomp->id, ccomp->type, ccomp->params);
+            compInfoMap.getByID(ccomp->id)->setComponent(tmp);
+        }
+    };
 
-            cinfo->setComponent(tmp);
+#ifdef USE_MEMPOOL
+    // The memory pools belong to a thread and aren't thread safe, and
+    // component constructors allocate from them (events, etc) without
+    // taking any lock, so build the components serially
+    uint32_t num_workers = 1;
+#else
+    uint32_t num_workers = std::min<size_t>(construct_threads, to_build.size());
+#endif
+    if ( num_workers > 1 ) {
+        parallel_construct = true;
+        std::vector<std::thread> workers;
+        for ( uint32_t i = 1; i < num_workers; ++i ) {
+            workers.emplace_back([&]() {
+                Core::ThreadAffinity::placeHelperThread(my_rank.thread);
+                current_instance = this;
+                build();
+                current_instance = nullptr;
+            });
         }
-    } // end for all vertex
+        build();
+        for ( auto& t : workers ) {
+            t.join();
+        }
+        parallel_construct = false;
+    }
+    else {
+        build();
+    }
     // Done with vertices, delete them;
     /*  TODO:  THREADING:  Clear only once everybody is done.
     graph.comps.clear();
@@ -523,13 +1147,16 @@ Simulation_impl::initialize()
     if ( my_rank.thread == 0 ) { SharedObject::manager.updateState(false); }
 
     do {
+        double round_start = sst_get_cpu_time();
         initBarrier.wait();
         if ( my_rank.thread == 0 ) untimed_msg_count = 0;
         initBarrier.wait();
+        if ( boundary_trace != nullptr ) boundary_trace->startUntimedPhase(untimed_phase);
 
-        for ( auto iter = compInfoMap.begin(); iter != compInfoMap.end(); ++iter ) {
-            // printf("Calling init on %s: %p\n",(*iter)->getName().c_str(),(*iter)->getComponent());
-            (*iter)->getComponent()->init(untimed_phase);
+        for ( size_t i = 0; i < compInfoMap.size(); ++i ) {
+            if ( !callUntimedPhase(i) ) continue;
+            // printf("Calling init on %s: %p\n",compInfoMap[i]->getName().c_str(),compInfoMap[i]->getComponent());
+            compInfoMap[i]->getComponent()->init(untimed_phase);
         }
 
         initBarrier.wait();
@@ -539,15 +1166,14 @@ Simulation_impl::initialize()
         if ( untimed_msg_count == 0 ) done = true;
         if ( my_rank.thread == 0 ) { SharedObject::manager.updateState(false); }
         untimed_phase++;
+        init_round_times.push_back(sst_get_cpu_time() - round_start);
     } while ( !done );
 
     init_phase_total_time = sst_get_cpu_time() - init_phase_start_time;
 
     // Walk through all the links and call finalizeConfiguration
 
-    for ( auto& i : compInfoMap ) {
-        i->finalizeLinkConfiguration();
-    }
+    compInfoMap.finalizeLinkConfiguration();
 #if 0
     for ( auto i = compInfoMap.begin(); i != compInfoMap.end(); ++i) {
         std::map<std::string,Link*>& map = (*i)->getLinkMap()->getLinkMap();
@@ -557,6 +1183,20 @@ Simulation_impl::initialize()
     }
 #endif
     syncManager->finalizeLinkConfigurations();
+    if ( boundary_trace != nullptr ) boundary_trace->startRun();
+}
+
+bool
+Simulation_impl::callUntimedPhase(size_t index)
+{
+    if ( !active_untimed_phases ) return true;
+
+    // Every component gets phase 0.  After that, only the ones that
+    // have data to receive or asked for it in the last phase do.
+    ComponentInfo* info     = compInfoMap[index];
+    bool           call     = untimed_phase == 0 || info->untimed_requested || compInfoMap.hasUntimedData(index);
+    info->untimed_requested = false;
+    return call;
 }
 
 void
@@ -566,9 +1206,8 @@ Simulation_impl::complete()
     completeBarrier.wait();
     untimed_phase = 0;
     // Walk through all the links and call prepareForComplete()
-    for ( auto& i : compInfoMap ) {
-        i->prepareForComplete();
-    }
+    compInfoMap.prepareForComplete();
+    if ( boundary_trace != nullptr ) boundary_trace->prepareForComplete();
 
     syncManager->prepareForComplete();
 
@@ -580,8 +1219,9 @@ Simulation_impl::complete()
         if ( my_rank.thread == 0 ) untimed_msg_count = 0;
         completeBarrier.wait();
 
-        for ( auto iter = compInfoMap.begin(); iter != compInfoMap.end(); ++iter ) {
-            (*iter)->getComponent()->complete(untimed_phase);
+        for ( size_t i = 0; i < compInfoMap.size(); ++i ) {
+            if ( !callUntimedPhase(i) ) continue;
+            compInfoMap[i]->getComponent()->complete(untimed_phase);
         }
 
         completeBarrier.wait();
@@ -606,13 +1246,67 @@ Simulation_impl::setup()
 
     setupBarrier.wait();
 
-    for ( auto iter = compInfoMap.begin(); iter != compInfoMap.end(); ++iter ) {
-        (*iter)->getComponent()->setup();
+    for ( size_t i = 0; i < compInfoMap.size(); ++i ) {
+        compInfoMap[i]->getComponent()->setup();
     }
 
     setupBarrier.wait();
 }
 
+// The run loop for TimeVortices that aren't built in
+template bool Simulation_impl::runLoop<TimeVortex>();
+
+// The run loops for the built-in TimeVortices are instantiated in the
+// files that define them
+extern template bool Simulation_impl::runLoop<IMPL::TimeVortexPQBase<false>>();
+extern template bool Simulation_impl::runLoop<IMPL::TimeVortexPQBase<true>>();
+extern template bool Simulation_impl::runLoop<IMPL::TimeVortexPQStaged>();
+extern template bool Simulation_impl::runLoop<IMPL::TimeVortexDHeapBase<false>>();
+extern template bool Simulation_impl::runLoop<IMPL::TimeVortexDHeapBase<true>>();
+extern template bool Simulation_impl::runLoop<IMPL::TimeVortexSimdHeapBase<false>>();
+extern template bool Simulation_impl::runLoop<IMPL::TimeVortexSimdHeapBase<true>>();
+extern template bool Simulation_impl::runLoop<IMPL::TimeVortexCalendarQueueBase<false>>();
+extern template bool Simulation_impl::runLoop<IMPL::TimeVortexCalendarQueueBase<true>>();
+extern template bool Simulation_impl::runLoop<IMPL::TimeVortexBucketedBase<false>>();
+extern template bool Simulation_impl::runLoop<IMPL::TimeVortexBucketedBase<true>>();
+extern template bool Simulation_impl::runLoop<IMPL::TimeVortexBinnedRingBase<false>>();
+extern template bool Simulation_impl::runLoop<IMPL::TimeVortexBinnedRingBase<true>>();
+extern template bool Simulation_impl::runLoop<IMPL::TimeVortexAdaptiveBase<false>>();
+extern template bool Simulation_impl::runLoop<IMPL::TimeVortexAdaptiveBase<true>>();
+extern template bool Simulation_impl::runLoop<IMPL::TimeVortexSpillBase<false>>();
+extern template bool Simulation_impl::runLoop<IMPL::TimeVortexSpillBase<true>>();
+
+Simulation_impl::RunLoop_t
+Simulation_impl::selectRunLoop(const std::string& timevortex_type)
+{
+    // Keyed by the ELI names, since the classes they register don't
+    // override anything of the templates the loops are specialized on
+    static const std::unordered_map<std::string, RunLoop_t> loops = {
+        { "sst.timevortex.priority_queue", &Simulation_impl::runLoop<IMPL::TimeVortexPQBase<false>> },
+        { "sst.timevortex.priority_queue.ts", &Simulation_impl::runLoop<IMPL::TimeVortexPQBase<true>> },
+        { "sst.timevortex.priority_queue.staged", &Simulation_impl::runLoop<IMPL::TimeVortexPQBase<false>> },
+        { "sst.timevortex.priority_queue.staged.ts", &Simulation_impl::runLoop<IMPL::TimeVortexPQStaged> },
+        { "sst.timevortex.dheap", &Simulation_impl::runLoop<IMPL::TimeVortexDHeapBase<false>> },
+        { "sst.timevortex.dheap.ts", &Simulation_impl::runLoop<IMPL::TimeVortexDHeapBase<true>> },
+        { "sst.timevortex.simdheap", &Simulation_impl::runLoop<IMPL::TimeVortexSimdHeapBase<false>> },
+        { "sst.timevortex.simdheap.ts", &Simulation_impl::runLoop<IMPL::TimeVortexSimdHeapBase<true>> },
+        { "sst.timevortex.calendar_queue", &Simulation_impl::runLoop<IMPL::TimeVortexCalendarQueueBase<false>> },
+        { "sst.timevortex.calendar_queue.ts", &Simulation_impl::runLoop<IMPL::TimeVortexCalendarQueueBase<true>> },
+        { "sst.timevortex.bucketed", &Simulation_impl::runLoop<IMPL::TimeVortexBucketedBase<false>> },
+        { "sst.timevortex.bucketed.ts", &Simulation_impl::runLoop<IMPL::TimeVortexBucketedBase<true>> },
+        { "sst.timevortex.ring.binned", &Simulation_impl::runLoop<IMPL::TimeVortexBinnedRingBase<false>> },
+        { "sst.timevortex.ring.binned.ts", &Simulation_impl::runLoop<IMPL::TimeVortexBinnedRingBase<true>> },
+        { "sst.timevortex.adaptive", &Simulation_impl::runLoop<IMPL::TimeVortexAdaptiveBase<false>> },
+        { "sst.timevortex.adaptive.ts", &Simulation_impl::runLoop<IMPL::TimeVortexAdaptiveBase<true>> },
+        { "sst.timevortex.spill", &Simulation_impl::runLoop<IMPL::TimeVortexSpillBase<false>> },
+        { "sst.timevortex.spill.ts", &Simulation_impl::runLoop<IMPL::TimeVortexSpillBase<true>> },
+    };
+
+    auto it = loops.find(timevortex_type);
+    if ( it == loops.end() ) return &Simulation_impl::runLoop<TimeVortex>;
+    return it->second;
+}
+
 void
 Simulation_impl::run()
 {
@@ -637,6 +1331,15 @@ Simulation_impl::run()
         }
     }
 
+    if ( load_checkpoint != "" ) restoreCheckpoint();
+
+    // Simulations that never sync write their checkpoints from their
+    // own action, the others at the syncs chosen by the SyncManager
+    if ( checkpoint_period != 0 && minPart == MAX_SIMTIME_T &&
+         (num_ranks.thread == 1 || interThreadMinLatency == MAX_SIMTIME_T) ) {
+        new CheckpointAction(this, checkpoint_period);
+    }
+
     // Tell the Statistics Engine that the simulation is beginning
     stat_engine.startOfSimulation();
 
@@ -653,7 +1356,7 @@ Simulation_impl::run()
 
 #if SST_RUNTIME_PROFILING
 #if SST_HIGH_RESOLUTION_CLOCK
-    auto start = std::chrono::high_resolution_clock::now();
+    run_start = std::chrono::high_resolution_clock::now();
 #else
     gettimeofday(&start, NULL);
 #endif
@@ -661,68 +1364,16 @@ Simulation_impl::run()
 
     run_phase_start_time = sst_get_cpu_time();
 
-    // Will check to make sure time doesn't "go backwards".  This will
-    // also catch the case of rollover (exceeding the 64-bit value
-    // space of SimTime_t).  To avoid yet another branch in the main
-    // run loop, we will check for a time fault, but will execute the
-    // next event and only exit the run loop on the next iteration.
-    // If there was a fault, a message will be printed.
-    bool time_fault = false;
-    while ( LIKELY(!endSim && !time_fault) ) {
-        current_activity = timeVortex->pop();
-
-        // Check for time fault
-        SimTime_t event_time = current_activity->getDeliveryTime();
-        time_fault           = event_time < currentSimCycle;
-
-        currentSimCycle = event_time;
-        currentPriority = current_activity->getPriority();
-        current_activity->execute();
-
-#if SST_PERIODIC_PRINT
-        periodicCounter++;
-#endif
+    // All of the threads exist by now, so the metrics timer can
+    // signal them
+    if ( m_metrics && my_rank.thread == 0 ) m_metrics->start();
 
-        if ( UNLIKELY(0 != lastRecvdSignal) ) {
-            switch ( lastRecvdSignal ) {
-            case SIGUSR1:
-                printStatus(false);
-                break;
-            case SIGUSR2:
-                printStatus(true);
-                break;
-            case SIGALRM:
-            case SIGINT:
-            case SIGTERM:
-                shutdown_mode = SHUTDOWN_SIGNAL;
-                sim_output.output("EMERGENCY SHUTDOWN (%u,%u)!\n", my_rank.rank, my_rank.thread);
-                sim_output.output(
-                    "# Simulated time:                  %s\n", getElapsedSimTime().toStringBestSI().c_str());
-                endSim = true;
-                break;
-            default:
-                break;
-            }
-            lastRecvdSignal = 0;
-        }
+    bool time_fault = (this->*run_loop)();
 
-#if SST_PERIODIC_PRINT
-        if ( periodicCounter >= SST_PERIODIC_PRINT_THRESHOLD ) {
-#if SST_RUNTIME_PROFILING
-#if SST_HIGH_RESOLUTION_CLOCK
-            auto finish = std::chrono::high_resolution_clock::now();
-            runtime     = std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start).count();
-#else
-            gettimeofday(&end, NULL);
-            timersub(&end, &start, &diff);
-            runtime = diff.tv_usec + diff.tv_sec * 1e6;
-#endif
-#endif
-            periodicCounter = 0;
-            printPerformanceInfo();
-        }
-#endif
-    }
+    run_loop_time = sst_get_cpu_time() - run_phase_start_time;
+
+    // Wait for a checkpoint that is still being written
+    if ( checkpoint_writer.joinable() ) checkpoint_writer.join();
 
     // Check to see if there was a time fault
     if ( time_fault ) {
@@ -736,7 +1387,22 @@ Simulation_impl::run()
 
     /* We shouldn't need to do this, but to be safe... */
 
+    double barrier_start = sst_get_cpu_time();
     runBarrier.wait(); // TODO<- Is this needed?
+    run_barrier_time = sst_get_cpu_time() - barrier_start;
+
+    // Print the usage from the last heartbeat, which is still being
+    // reduced
+    if ( m_heartbeat ) m_heartbeat->finish();
+
+    // All ranks started the same deferred Exit checks
+    if ( my_rank.thread == 0 ) m_exit->finish();
+
+    // Write the final metrics once every thread has left the run loop
+    if ( m_metrics ) {
+        if ( my_rank.thread == 0 ) m_metrics->stop();
+        m_metrics->report(this, events_executed, syncManager->getSyncTime());
+    }
 
     run_phase_total_time = sst_get_cpu_time() - run_phase_start_time;
 
@@ -749,7 +1415,7 @@ Simulation_impl::run()
 #if SST_RUNTIME_PROFILING
 #if SST_HIGH_RESOLUTION_CLOCK
     auto finish = std::chrono::high_resolution_clock::now();
-    runtime     = std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start).count();
+    runtime     = std::chrono::duration_cast<std::chrono::nanoseconds>(finish - run_start).count();
 #else
     gettimeofday(&end, NULL);
     timersub(&end, &start, &diff);
@@ -765,6 +1431,665 @@ Simulation_impl::run()
     if ( num_ranks.rank != 1 && num_ranks.thread == 0 ) delete m_exit;
 }
 
+void
+Simulation_impl::prepareForRestart()
+{
+    setupBarrier.wait();
+
+    /* Enforce finalization of SharedObjects */
+    if ( my_rank.thread == 0 ) { SharedObject::manager.updateState(true); }
+
+    setupBarrier.wait();
+
+    // Same link configuration as at the end of initialize()
+    compInfoMap.finalizeLinkConfiguration();
+    syncManager->finalizeLinkConfigurations();
+
+    setupBarrier.wait();
+}
+
+void
+Simulation_impl::checkpoint(SimTime_t rank_sync_time, SimTime_t thread_sync_time)
+{
+    CheckpointData data;
+    data.rank             = my_rank.rank;
+    data.num_ranks        = num_ranks.rank;
+    data.thread           = my_rank.thread;
+    data.num_threads      = num_ranks.thread;
+    data.index            = checkpoint_index;
+    data.cycle            = currentSimCycle;
+    data.priority         = currentPriority;
+    data.rank_sync_time   = rank_sync_time;
+    data.thread_sync_time = thread_sync_time;
+    data.event_id         = Event::id_counter;
+
+    std::vector<ComponentInfo*> infos = collectComponentInfos(compInfoMap);
+
+    // Saves the state of a component, or for incremental checkpoints
+    // just where to find it if it has not changed since it was last
+    // saved
+    auto save = [&](ComponentId_t id, std::vector<char>&& state, std::map<ComponentId_t, std::vector<char>>& saved,
+                    std::map<ComponentId_t, uint32_t>& unchanged, std::map<ComponentId_t, CheckpointRef>& last) {
+        if ( checkpoint_incremental ) {
+            size_t hash = std::hash<std::string_view>()(std::string_view(state.data(), state.size()));
+            auto   it   = last.find(id);
+            if ( it != last.end() && it->second.hash == hash && it->second.size == state.size() ) {
+                unchanged[id] = it->second.index;
+                return;
+            }
+            last[id] = { checkpoint_index, hash, state.size() };
+        }
+        saved[id] = std::move(state);
+    };
+
+    // Component and statistic state.  Events are delivered on the
+    // pair of the link on their port, so that is what identifies the
+    // port of an event in the TimeVortex.
+    std::map<std::pair<uint32_t, uintptr_t>, std::pair<ComponentId_t, std::string>> ports;
+    for ( auto* info : infos ) {
+        ComponentId_t  id   = info->getID();
+        BaseComponent* comp = info->getComponent();
+
+        save(id, packCheckpoint([&](serializer& ser) { comp->serialize_order(ser); }), data.components,
+             data.component_refs, checkpoint_component_refs);
+        save(id, packCheckpoint([&](serializer& ser) { comp->serializeStatistics(ser); }), data.statistics,
+             data.statistic_refs, checkpoint_statistic_refs);
+
+        for ( auto& port : info->getLinkMap()->getLinkMap() ) {
+            Link* pair = port.second->pair_link;
+            ports[std::make_pair(pair->tag, pair->delivery_info)] = std::make_pair(id, port.first);
+        }
+    }
+
+    // Clock and OneShot state, keyed the same way as their maps
+    std::map<Activity*, std::pair<SimTime_t, int>> actions;
+    for ( auto& entry : clockMap ) {
+        Clock*          clock = entry.second;
+        CheckpointClock saved = {
+            entry.first.first, entry.first.second, clock->currentCycle, clock->next, clock->scheduled,
+            clock->numHandlers, {}, clock->awake
+        };
+        for ( auto& handler : clock->staticHandlerMap ) {
+            if ( handler.handler || handler.skip_handler ) saved.wakes.push_back(handler.wake);
+        }
+        actions[entry.second] = entry.first;
+        data.clocks.push_back(saved);
+    }
+    for ( auto& entry : oneShotMap ) {
+        OneShot*          oneshot = entry.second;
+        CheckpointOneShot saved   = { entry.first.first, entry.first.second, oneshot->m_scheduled, {} };
+        for ( auto& handlers : oneshot->m_HandlerVectorMap ) {
+            saved.entries.emplace_back(handlers.first, handlers.second->size());
+        }
+        actions[entry.second] = entry.first;
+        data.oneshots.push_back(saved);
+    }
+
+    // Primary components of this thread that have not said it is OK
+    // to end the simulation
+    {
+        Exit::ThreadState&                          state = m_exit->m_threads[my_rank.thread];
+        std::lock_guard<Core::ThreadSafe::Spinlock> lock(state.lock);
+        for ( auto* info : infos ) {
+            if ( state.ids.count(info->getID()) ) data.exit_ids.push_back(info->getID());
+        }
+        data.exit_end_time = m_exit->getEndTime();
+    }
+
+    // Everything that is scheduled.  The TimeVortex is emptied and
+    // then refilled in the same order, so ties are still broken the
+    // same way.
+    if ( directQueue ) directQueue->flush();
+    std::vector<Activity*> pending;
+    while ( !timeVortex->empty() ) {
+        pending.push_back(timeVortex->pop());
+    }
+    for ( Activity* act : pending ) {
+        CheckpointActivity saved;
+        saved.time     = act->getDeliveryTime();
+        saved.priority = act->getPriority();
+
+        if ( Event* ev = dynamic_cast<Event*>(act) ) {
+            // Cancelled events are left to be dropped, restarts don't
+            // see them
+            if ( ev->isCancelled() ) continue;
+            auto port = ports.find(std::make_pair(ev->getOrderTag(), Link::getSentDeliveryInfo(ev)));
+            if ( port == ports.end() ) {
+                sim_output.fatal(
+                    CALL_INFO, 1, "ERROR: Unable to checkpoint event not delivered to a component port: %s\n",
+                    ev->toString().c_str());
+            }
+            saved.type  = CKPT_EVENT;
+            saved.comp  = port->second.first;
+            saved.port  = port->second.second;
+            saved.event = ev;
+        }
+        else if ( actions.count(act) ) {
+            saved.type     = dynamic_cast<Clock*>(act) ? CKPT_CLOCK : CKPT_ONESHOT;
+            saved.factor   = actions[act].first;
+            saved.priority = actions[act].second;
+        }
+        else if ( Clock::Group* group = dynamic_cast<Clock::Group*>(act) ) {
+            // Saved as the ticks of its clocks, in the order it fires
+            // them.  They rejoin the group after their first tick.
+            for ( Clock* clock : group->clocks ) {
+                if ( !clock->grouped ) continue;
+                saved.type     = CKPT_CLOCK;
+                saved.time     = clock->next;
+                saved.factor   = actions[clock].first;
+                saved.priority = actions[clock].second;
+                data.activities.push_back(saved);
+            }
+            continue;
+        }
+        else if ( Clock::WakeUp* wakeup = dynamic_cast<Clock::WakeUp*>(act) ) {
+            // Cancelled ones are left over from clocks that were
+            // scheduled again
+            if ( !wakeup->clock ) continue;
+            saved.type     = CKPT_CLOCK_WAKEUP;
+            saved.factor   = actions[wakeup->clock].first;
+            saved.priority = actions[wakeup->clock].second;
+            saved.cycle    = wakeup->cycle;
+        }
+        else if ( act == m_exit ) {
+            saved.type = CKPT_EXIT;
+        }
+        else if ( act == m_heartbeat ) {
+            saved.type = CKPT_HEARTBEAT;
+        }
+        else if (
+            act == syncManager || dynamic_cast<StopAction*>(act) != nullptr ||
+            dynamic_cast<CheckpointAction*>(act) != nullptr ) {
+            // Recreated from the configuration on a restart
+            continue;
+        }
+        else {
+            sim_output.fatal(CALL_INFO, 1, "ERROR: Unable to checkpoint activity: %s\n", act->toString().c_str());
+        }
+        data.activities.push_back(saved);
+    }
+
+    std::vector<char> buffer = packCheckpoint([&](serializer& ser) { serializeCheckpoint(ser, data); });
+
+    for ( Activity* act : pending ) {
+        timeVortex->insert(act);
+    }
+
+    std::string filename = getCheckpointFileName(checkpoint_prefix + "_" + std::to_string(checkpoint_index), my_rank);
+    std::string message;
+    if ( my_rank.rank == 0 && my_rank.thread == 0 ) {
+        message = "# Checkpoint " + std::to_string(checkpoint_index) + " written at " +
+                  getElapsedSimTime().toStringBestSI() + "\n";
+    }
+
+    // Only one checkpoint is written at a time, so at most one
+    // snapshot is held in memory while the simulation continues
+    if ( checkpoint_writer.joinable() ) checkpoint_writer.join();
+    if ( checkpoint_async ) {
+        checkpoint_writer = std::thread(writeCheckpointFile, filename, std::move(buffer), message);
+    }
+    else {
+        writeCheckpointFile(filename, buffer, message);
+    }
+
+    checkpoint_index++;
+    next_checkpoint = (currentSimCycle / checkpoint_period + 1) * checkpoint_period;
+}
+
+void
+Simulation_impl::restoreCheckpoint()
+{
+    std::vector<ComponentInfo*> infos = collectComponentInfos(compInfoMap);
+    std::set<ComponentId_t>     local;
+    for ( auto* info : infos ) {
+        local.insert(info->getID());
+    }
+
+    // The first file tells how many ranks and threads wrote the
+    // checkpoint.  If it is not the same as now, every file is read
+    // and the parts for the components of this thread are kept.
+    CheckpointData first;
+    loadCheckpointFile(load_checkpoint, RankInfo(0, 0), first);
+    bool same_layout = first.num_ranks == num_ranks.rank && first.num_threads == num_ranks.thread;
+
+    CheckpointData data;
+    if ( same_layout && my_rank.rank == 0 && my_rank.thread == 0 ) {
+        data = std::move(first);
+    }
+    else if ( same_layout ) {
+        for ( auto& act : first.activities ) {
+            if ( act.type == CKPT_EVENT ) delete act.event;
+        }
+        loadCheckpointFile(load_checkpoint, my_rank, data);
+    }
+    else {
+        data.index         = first.index;
+        data.cycle         = first.cycle;
+        data.priority      = first.priority;
+        data.event_id      = 0;
+        data.exit_end_time = 0;
+        // The syncs of the new partition start again at the current
+        // time
+        data.rank_sync_time   = first.cycle;
+        data.thread_sync_time = first.cycle;
+        mergeCheckpoint(first, local, data);
+        for ( uint32_t r = 0; r < first.num_ranks; ++r ) {
+            for ( uint32_t t = 0; t < first.num_threads; ++t ) {
+                if ( r == 0 && t == 0 ) continue;
+                CheckpointData other;
+                loadCheckpointFile(load_checkpoint, RankInfo(r, t), other);
+                mergeCheckpoint(other, local, data);
+            }
+        }
+        // Put the activities back in the order the TimeVortex of a
+        // single file would have them
+        std::stable_sort(
+            data.activities.begin(), data.activities.end(),
+            [](const CheckpointActivity& a, const CheckpointActivity& b) {
+                return a.time != b.time ? a.time < b.time : a.priority < b.priority;
+            });
+    }
+
+    bool same_components = infos.size() == data.components.size();
+    for ( auto* info : infos ) {
+        same_components = same_components && data.components.count(info->getID());
+    }
+    if ( !same_components ) {
+        sim_output.fatal(
+            CALL_INFO, 1,
+            "ERROR: The components in checkpoint %s do not match the ones built from the input file.  A restart "
+            "must use the same input file%s\n",
+            load_checkpoint.c_str(), same_layout ? " and partition" : "");
+    }
+
+    currentSimCycle = data.cycle;
+    currentPriority = data.priority;
+
+    serializer ser;
+    for ( auto* info : infos ) {
+        std::vector<char>& comp_data = data.components[info->getID()];
+        ser.start_unpacking(comp_data.data(), comp_data.size());
+        info->getComponent()->serialize_order(ser);
+
+        std::vector<char>& stat_data = data.statistics[info->getID()];
+        ser.start_unpacking(stat_data.data(), stat_data.size());
+        info->getComponent()->serializeStatistics(ser);
+    }
+
+    // Empty the TimeVortex.  Only the StopActions from the
+    // configuration are kept, everything else is put back from the
+    // checkpoint.
+    std::vector<Activity*> stops;
+    if ( directQueue ) directQueue->flush();
+    while ( !timeVortex->empty() ) {
+        Activity* act = timeVortex->pop();
+        if ( dynamic_cast<StopAction*>(act) ) {
+            if ( act->getDeliveryTime() < currentSimCycle ) act->setDeliveryTime(currentSimCycle);
+            stops.push_back(act);
+        }
+        else if ( dynamic_cast<Event*>(act) ) {
+            delete act;
+        }
+    }
+    for ( Activity* act : stops ) {
+        timeVortex->insert(act);
+    }
+
+    // Clocks and OneShots must have the same handlers as when the
+    // checkpoint was written, since only their counts are saved.  With
+    // a different partition the handlers are spread over other
+    // threads, so the counts cannot be checked.
+    std::set<std::pair<SimTime_t, int>> restored;
+    for ( auto& saved : data.clocks ) {
+        std::pair<SimTime_t, int> key(saved.factor, saved.priority);
+        auto                      it = clockMap.find(key);
+        if ( it == clockMap.end() && !same_layout ) continue;
+        // The components register their suspendable handlers awake.
+        // With a different partition they are all left awake, and
+        // suspend themselves again the next time they are called.
+        if ( it != clockMap.end() && same_layout && saved.awake.size() == it->second->awake.size() ) {
+            for ( size_t slot = 0; slot < it->second->suspendable.size(); ++slot ) {
+                if ( !(saved.awake[slot / 64] & (uint64_t(1) << (slot % 64))) ) it->second->suspend(slot);
+            }
+        }
+        if ( it == clockMap.end() || (same_layout && it->second->numHandlers != saved.handlers) ) {
+            sim_output.fatal(
+                CALL_INFO, 1,
+                "ERROR: Clock with period %" PRIu64 " and priority %d does not have the same handlers as when the "
+                "checkpoint was written\n",
+                saved.factor, saved.priority);
+        }
+        it->second->currentCycle = saved.current_cycle;
+        it->second->next         = saved.next;
+        it->second->scheduled    = saved.scheduled;
+        // With a different partition handlers that skip ahead are
+        // called on the next cycle and tell the clock again when they
+        // next need to be
+        if ( same_layout && saved.wakes.size() == it->second->staticHandlerMap.size() ) {
+            for ( size_t i = 0; i < saved.wakes.size(); ++i ) {
+                it->second->staticHandlerMap[i].wake = saved.wakes[i];
+            }
+        }
+        restored.insert(key);
+    }
+    for ( auto& entry : clockMap ) {
+        if ( restored.count(entry.first) ) continue;
+        if ( entry.second->numHandlers != 0 ) {
+            sim_output.fatal(
+                CALL_INFO, 1, "ERROR: Clock with period %" PRIu64 " and priority %d is not in the checkpoint\n",
+                entry.first.first, entry.first.second);
+        }
+        entry.second->scheduled = false;
+    }
+
+    restored.clear();
+    for ( auto& saved : data.oneshots ) {
+        std::pair<SimTime_t, int> key(saved.factor, saved.priority);
+        auto                      it = oneShotMap.find(key);
+        if ( it == oneShotMap.end() && (saved.entries.empty() || !same_layout) ) continue;
+
+        bool same = it != oneShotMap.end();
+        if ( same ) {
+            // The oldest entries were delivered before the checkpoint
+            // was written
+            auto& entries = it->second->m_HandlerVectorMap;
+            while ( entries.size() > saved.entries.size() ) {
+                delete entries.back().second;
+                entries.pop_back();
+            }
+            same = entries.size() == saved.entries.size();
+            for ( size_t i = 0; same && i < entries.size(); ++i ) {
+                same = entries[i].first == saved.entries[i].first &&
+                       (!same_layout || entries[i].second->size() == saved.entries[i].second);
+            }
+        }
+        if ( !same ) {
+            sim_output.fatal(
+                CALL_INFO, 1,
+                "ERROR: OneShot with delay %" PRIu64 " and priority %d does not have the same handlers as when the "
+                "checkpoint was written\n",
+                saved.factor, saved.priority);
+        }
+        it->second->m_scheduled = saved.scheduled;
+        restored.insert(key);
+    }
+    for ( auto& entry : oneShotMap ) {
+        if ( restored.count(entry.first) ) continue;
+        if ( !entry.second->m_HandlerVectorMap.empty() ) {
+            sim_output.fatal(
+                CALL_INFO, 1, "ERROR: OneShot with delay %" PRIu64 " and priority %d is not in the checkpoint\n",
+                entry.first.first, entry.first.second);
+        }
+        entry.second->m_scheduled = false;
+    }
+
+    // Put back everything that was scheduled, in the order it was
+    // saved in
+    for ( auto& saved : data.activities ) {
+        std::pair<SimTime_t, int> key(saved.factor, saved.priority);
+        switch ( saved.type ) {
+        case CKPT_EVENT:
+        {
+            ComponentInfo* info = compInfoMap.getByID(saved.comp);
+            Link*          link = info ? info->getLinkMap()->getLink(saved.port) : nullptr;
+            if ( nullptr == link ) {
+                sim_output.fatal(
+                    CALL_INFO, 1, "ERROR: Port %s of component %" PRIu64 " in the checkpoint was not found\n",
+                    saved.port.c_str(), saved.comp);
+            }
+            saved.event->setDeliveryInfo(link->pair_link->tag, link->pair_link->delivery_info);
+            insertActivity(saved.time, saved.event);
+            break;
+        }
+        case CKPT_CLOCK:
+            if ( clockMap.count(key) ) insertActivity(saved.time, clockMap[key]);
+            break;
+        case CKPT_CLOCK_WAKEUP:
+            if ( !clockMap.count(key) ) break;
+            if ( same_layout ) {
+                clockMap[key]->wakeup = new Clock::WakeUp(clockMap[key], saved.cycle);
+                insertActivity(saved.time, clockMap[key]->wakeup);
+            }
+            else {
+                clockMap[key]->schedule();
+            }
+            break;
+        case CKPT_ONESHOT:
+            if ( oneShotMap.count(key) ) insertActivity(saved.time, oneShotMap[key]);
+            break;
+        case CKPT_EXIT:
+            insertActivity(saved.time, m_exit);
+            break;
+        case CKPT_HEARTBEAT:
+            if ( m_heartbeat ) insertActivity(saved.time, m_heartbeat);
+            break;
+        default:
+            break;
+        }
+    }
+
+    // Primary components that said it is OK to end the simulation
+    // before the checkpoint was written
+    {
+        Exit::ThreadState&                          state = m_exit->m_threads[my_rank.thread];
+        std::lock_guard<Core::ThreadSafe::Spinlock> lock(state.lock);
+        std::set<ComponentId_t>                     primary(data.exit_ids.begin(), data.exit_ids.end());
+        for ( auto* info : infos ) {
+            ComponentId_t id = info->getID();
+            if ( state.ids.count(id) && !primary.count(id) ) state.ids.erase(id);
+        }
+        state.count.store(state.ids.size());
+        if ( data.exit_end_time > m_exit->end_time ) m_exit->end_time = data.exit_end_time;
+    }
+
+    syncManager->restoreSyncTimes(data.rank_sync_time, data.thread_sync_time);
+
+    if ( my_rank.thread == 0 ) Event::id_counter = data.event_id;
+
+    checkpoint_index = data.index + 1;
+    if ( checkpoint_period != 0 ) next_checkpoint = (currentSimCycle / checkpoint_period + 1) * checkpoint_period;
+
+    if ( my_rank.rank == 0 && my_rank.thread == 0 ) {
+        sim_output.output(
+            "# Restarted from checkpoint %s at %s\n", load_checkpoint.c_str(),
+            getElapsedSimTime().toStringBestSI().c_str());
+    }
+}
+
+void
+Simulation_impl::saveSnapshot()
+{
+    if ( snapshot == nullptr ) snapshot = new Snapshot();
+    Snapshot& snap = *snapshot;
+
+    snap.cycle    = currentSimCycle;
+    snap.priority = currentPriority;
+    snap.event_id = Event::id_counter;
+
+    std::vector<ComponentInfo*> infos = collectComponentInfos(compInfoMap);
+    snap.components.clear();
+    for ( auto* info : infos ) {
+        BaseComponent* comp = info->getComponent();
+        snap.components.emplace_back(
+            comp, packCheckpoint([&](serializer& ser) {
+                comp->serialize_order(ser);
+                comp->serializeStatistics(ser);
+            }));
+    }
+
+    snap.clocks.clear();
+    for ( auto& entry : clockMap ) {
+        Clock* clock       = entry.second;
+        snap.clocks[clock] = { clock->currentCycle, clock->staticHandlerMap, clock->numHandlers,
+                               clock->next,         clock->scheduled,        clock->grouped,
+                               clock->suspendable,  clock->awake,            clock->numAwake };
+    }
+    snap.groups.clear();
+    for ( auto& entry : clockGroupMap ) {
+        snap.groups[entry.second] = { entry.second->time, entry.second->scheduled };
+    }
+    snap.oneshots.clear();
+    for ( auto& entry : oneShotMap ) {
+        Snapshot::OneShotState& saved = snap.oneshots[entry.second];
+        saved.scheduled               = entry.second->m_scheduled;
+        for ( auto& handlers : entry.second->m_HandlerVectorMap ) {
+            saved.entries.emplace_back(handlers.first, *handlers.second);
+        }
+    }
+
+    {
+        Exit::ThreadState&                          state = m_exit->m_threads[my_rank.thread];
+        std::lock_guard<Core::ThreadSafe::Spinlock> lock(state.lock);
+        snap.exit_ids      = state.ids;
+        snap.exit_end_time = m_exit->getEndTime();
+    }
+
+    // Everything that is scheduled, put back in the same order
+    if ( directQueue ) directQueue->flush();
+    std::vector<Activity*> pending;
+    while ( !timeVortex->empty() ) {
+        pending.push_back(timeVortex->pop());
+    }
+    snap.activities.clear();
+    for ( Activity* act : pending ) {
+        Snapshot::Entry saved;
+        saved.time = act->getDeliveryTime();
+        if ( Event* ev = dynamic_cast<Event*>(act) ) {
+            if ( ev->isCancelled() ) continue;
+            // Restored as a plain event, since the cancel handle will
+            // no longer refer to it
+            uintptr_t info    = ev->delivery_info;
+            ev->delivery_info = Link::getSentDeliveryInfo(ev);
+            saved.event       = packCheckpoint([&](serializer& ser) { ser& ev; });
+            ev->delivery_info = info;
+        }
+        else if ( Clock::WakeUp* wakeup = dynamic_cast<Clock::WakeUp*>(act) ) {
+            if ( !wakeup->clock ) continue;
+            saved.wake_clock = wakeup->clock;
+            saved.wake_cycle = wakeup->cycle;
+        }
+        else if (
+            dynamic_cast<Clock*>(act) || dynamic_cast<Clock::Group*>(act) || dynamic_cast<OneShot*>(act) ||
+            dynamic_cast<StopAction*>(act) || act == m_exit || act == m_heartbeat ) {
+            saved.action = act;
+        }
+        else {
+            sim_output.fatal(
+                CALL_INFO, 1, "ERROR: Unable to save activity for rollback: %s\n", act->toString().c_str());
+        }
+        snap.activities.push_back(std::move(saved));
+    }
+    for ( Activity* act : pending ) {
+        timeVortex->insert(act);
+    }
+}
+
+void
+Simulation_impl::restoreSnapshot()
+{
+    Snapshot& snap = *snapshot;
+
+    // Events and WakeUps scheduled since the snapshot are deleted, the
+    // actions are put back below
+    if ( directQueue ) directQueue->flush();
+    while ( !timeVortex->empty() ) {
+        Activity* act = timeVortex->pop();
+        if ( Event* ev = dynamic_cast<Event*>(act) ) {
+            Link::releaseCancellable(ev);
+            delete ev;
+        }
+        else if ( dynamic_cast<Clock::WakeUp*>(act) ) {
+            delete act;
+        }
+    }
+
+    currentSimCycle   = snap.cycle;
+    currentPriority   = snap.priority;
+    Event::id_counter = snap.event_id;
+
+    serializer ser;
+    for ( auto& comp : snap.components ) {
+        ser.start_unpacking(comp.second.data(), comp.second.size());
+        comp.first->serialize_order(ser);
+        comp.first->serializeStatistics(ser);
+    }
+
+    // Clocks and OneShots created since the snapshot go back to
+    // having nothing registered
+    for ( auto& entry : clockMap ) {
+        Clock* clock      = entry.second;
+        auto   it         = snap.clocks.find(clock);
+        clock->numRemoved = 0;
+        clock->wakeup     = nullptr;
+        if ( it == snap.clocks.end() ) {
+            clock->staticHandlerMap.clear();
+            clock->suspendable.clear();
+            clock->awake.clear();
+            clock->numAwake    = 0;
+            clock->numHandlers = 0;
+            clock->scheduled   = false;
+            clock->grouped     = false;
+            continue;
+        }
+        clock->currentCycle     = it->second.current_cycle;
+        clock->staticHandlerMap = it->second.handlers;
+        clock->numHandlers      = it->second.num_handlers;
+        clock->next             = it->second.next;
+        clock->scheduled        = it->second.scheduled;
+        clock->grouped          = it->second.grouped;
+        clock->suspendable      = it->second.suspendable;
+        clock->awake            = it->second.awake;
+        clock->numAwake         = it->second.num_awake;
+    }
+    for ( auto& entry : clockGroupMap ) {
+        Clock::Group* group = entry.second;
+        auto          it    = snap.groups.find(group);
+        group->running      = false;
+        group->time         = it == snap.groups.end() ? 0 : it->second.time;
+        group->scheduled    = it == snap.groups.end() ? false : it->second.scheduled;
+    }
+    for ( auto& entry : oneShotMap ) {
+        OneShot* oneshot = entry.second;
+        for ( auto& handlers : oneshot->m_HandlerVectorMap ) {
+            delete handlers.second;
+        }
+        oneshot->m_HandlerVectorMap.clear();
+        oneshot->m_scheduled = false;
+
+        auto it = snap.oneshots.find(oneshot);
+        if ( it == snap.oneshots.end() ) continue;
+        for ( auto& handlers : it->second.entries ) {
+            oneshot->m_HandlerVectorMap.emplace_back(handlers.first, new OneShot::HandlerList_t(handlers.second));
+        }
+        oneshot->m_scheduled = it->second.scheduled;
+    }
+
+    {
+        Exit::ThreadState&                          state = m_exit->m_threads[my_rank.thread];
+        std::lock_guard<Core::ThreadSafe::Spinlock> lock(state.lock);
+
+        state.ids = snap.exit_ids;
+        state.count.store(state.ids.size());
+        state.end_time.store(snap.exit_end_time);
+        m_exit->end_time = snap.exit_end_time;
+    }
+
+    for ( auto& saved : snap.activities ) {
+        Activity* act = saved.action;
+        if ( saved.wake_clock ) {
+            saved.wake_clock->wakeup = new Clock::WakeUp(saved.wake_clock, saved.wake_cycle);
+            act                      = saved.wake_clock->wakeup;
+        }
+        else if ( act == nullptr ) {
+            Event* ev = nullptr;
+            ser.start_unpacking(saved.event.data(), saved.event.size());
+            ser& ev;
+            act = ev;
+        }
+        timeVortex->insert(act);
+    }
+}
+
 void
 Simulation_impl::emergencyShutdown()
 {
@@ -819,8 +2144,8 @@ void
 Simulation_impl::finish()
 {
 
-    for ( auto iter = compInfoMap.begin(); iter != compInfoMap.end(); ++iter ) {
-        (*iter)->getComponent()->finish();
+    for ( size_t i = 0; i < compInfoMap.size(); ++i ) {
+        compInfoMap[i]->getComponent()->finish();
     }
 
     finishBarrier.wait();
@@ -849,6 +2174,16 @@ Simulation_impl::setSignal(int signal)
         instance->lastRecvdSignal = signal;
 }
 
+void
+Simulation_impl::postSignal(int signal)
+{
+    // A signal arriving between the check and the store can still be
+    // replaced, which is no worse than setSignal()
+    for ( auto& instance : instanceVec ) {
+        if ( instance->lastRecvdSignal == 0 ) instance->lastRecvdSignal = signal;
+    }
+}
+
 void
 Simulation_impl::printStatus(bool fullStatus)
 {
@@ -910,21 +2245,67 @@ Simulation_impl::registerClock(const UnitAlgebra& freq, Clock::HandlerBase* hand
 
 TimeConverter*
 Simulation_impl::registerClock(TimeConverter* tcFreq, Clock::HandlerBase* handler, int priority)
+{
+    return registerClockHandler(tcFreq, handler, priority);
+}
+
+TimeConverter*
+Simulation_impl::registerClock(TimeConverter* tcFreq, Clock::SkipHandlerBase* handler, int priority)
+{
+    return registerClockHandler(tcFreq, handler, priority);
+}
+
+Clock::SuspendHandle
+Simulation_impl::registerSuspendableClock(TimeConverter* tcFreq, Clock::HandlerBase* handler, int priority)
+{
+    auto   lock  = getConstructLock();
+    Clock* clock = getClock(tcFreq, priority);
+    return Clock::SuspendHandle { clock, clock->registerSuspendable(handler) };
+}
+
+Clock*
+Simulation_impl::getClock(TimeConverter* tcFreq, int priority)
 {
     clockMap_t::key_type mapKey = std::make_pair(tcFreq->getFactor(), priority);
     if ( clockMap.find(mapKey) == clockMap.end() ) {
         Clock* ce        = new Clock(tcFreq, priority);
         clockMap[mapKey] = ce;
 
+        Clock::Group*& group = clockGroupMap[priority];
+        if ( !group ) group = new Clock::Group(priority);
+        group->addClock(ce);
+
         ce->schedule();
     }
-    clockMap[mapKey]->registerHandler(handler);
+    return clockMap[mapKey];
+}
+
+template <typename HandlerT>
+TimeConverter*
+Simulation_impl::registerClockHandler(TimeConverter* tcFreq, HandlerT* handler, int priority)
+{
+    auto lock = getConstructLock();
+    getClock(tcFreq, priority)->registerHandler(handler);
     return tcFreq;
 }
 
 Cycle_t
 Simulation_impl::reregisterClock(TimeConverter* tc, Clock::HandlerBase* handler, int priority)
 {
+    return reregisterClockHandler(tc, handler, priority);
+}
+
+Cycle_t
+Simulation_impl::reregisterClock(TimeConverter* tc, Clock::SkipHandlerBase* handler, int priority)
+{
+    return reregisterClockHandler(tc, handler, priority);
+}
+
+template <typename HandlerT>
+Cycle_t
+Simulation_impl::reregisterClockHandler(TimeConverter* tc, HandlerT* handler, int priority)
+{
+    auto lock = getConstructLock();
     clockMap_t::key_type mapKey = std::make_pair(tc->getFactor(), priority);
     if ( clockMap.find(mapKey) == clockMap.end() ) {
         Output out("Simulation: @R:@t:", 0, 0, Output::STDERR);
@@ -937,6 +2318,7 @@ Simulation_impl::reregisterClock(TimeConverter* tc, Clock::HandlerBase* handler,
 Cycle_t
 Simulation_impl::getNextClockCycle(TimeConverter* tc, int priority)
 {
+    auto lock = getConstructLock();
     clockMap_t::key_type mapKey = std::make_pair(tc->getFactor(), priority);
     if ( clockMap.find(mapKey) == clockMap.end() ) {
         Output out("Simulation: @R:@t:", 0, 0, Output::STDERR);
@@ -946,9 +2328,35 @@ Simulation_impl::getNextClockCycle(TimeConverter* tc, int priority)
     return clockMap[mapKey]->getNextCycle();
 }
 
+ClockBatch*
+Simulation_impl::getClockBatch(TimeConverter* tc, const std::type_info& type, ClockBatch* (*create)())
+{
+    auto         lock  = getConstructLock();
+    ClockBatch*& batch = clockBatchMap[std::make_pair(std::type_index(type), tc->getFactor())];
+    if ( batch == nullptr ) {
+        batch = create();
+        registerClockHandler(tc, new Clock::Handler2<ClockBatch, &ClockBatch::tick>(batch), CLOCKPRIORITY);
+    }
+    return batch;
+}
+
 void
 Simulation_impl::unregisterClock(TimeConverter* tc, Clock::HandlerBase* handler, int priority)
 {
+    unregisterClockHandler(tc, handler, priority);
+}
+
+void
+Simulation_impl::unregisterClock(TimeConverter* tc, Clock::SkipHandlerBase* handler, int priority)
+{
+    unregisterClockHandler(tc, handler, priority);
+}
+
+template <typename HandlerT>
+void
+Simulation_impl::unregisterClockHandler(TimeConverter* tc, HandlerT* handler, int priority)
+{
+    auto lock = getConstructLock();
     clockMap_t::key_type mapKey = std::make_pair(tc->getFactor(), priority);
     if ( clockMap.find(mapKey) != clockMap.end() ) {
         bool empty;
@@ -967,6 +2375,7 @@ Simulation_impl::registerOneShot(const UnitAlgebra& timeDelay, OneShot::HandlerB
 {
     TimeConverter*       tcTimeDelay = timeLord.getTimeConverter(timeDelay);
     clockMap_t::key_type mapKey      = std::make_pair(tcTimeDelay->getFactor(), priority);
+    auto                 lock        = getConstructLock();
 
     // Search the oneShot map for a oneShot with the associated timeDelay factor
     if ( oneShotMap.find(mapKey) == oneShotMap.end() ) {
@@ -985,10 +2394,28 @@ Simulation_impl::registerOneShot(const UnitAlgebra& timeDelay, OneShot::HandlerB
 void
 Simulation_impl::insertActivity(SimTime_t time, Activity* ev)
 {
+    auto lock = getConstructLock();
     ev->setDeliveryTime(time);
     timeVortex->insert(ev);
 }
 
+bool
+Simulation_impl::runNext(Activity* act, SimTime_t time)
+{
+    // Signals and the end of the simulation are handled by the run loop
+    if ( !tight_clock_loop || endSim || lastRecvdSignal != 0 ) return false;
+    if ( directQueue != nullptr && !directQueue->empty() ) return false;
+
+    // Ties go to what is already in the TimeVortex, which was inserted
+    // first
+    act->setDeliveryTime(time);
+    if ( !timeVortex->empty() && !Activity::less<true, true, false>()(act, timeVortex->front()) ) return false;
+
+    currentSimCycle = time;
+    events_executed++;
+    return true;
+}
+
 uint64_t
 Simulation_impl::getTimeVortexMaxDepth() const
 {
@@ -1007,6 +2434,64 @@ Simulation_impl::getSyncQueueDataSize() const
     return syncManager->getDataSize();
 }
 
+void
+Simulation_impl::recordMemoryUse(Core::MemoryAccounting::Phase phase, ConfigGraph* graph)
+{
+    using Core::MemoryAccounting;
+
+    // The serialized graph holds about as much as the graph itself,
+    // apart from the strings that are only written once
+    int64_t graph_size = 0;
+    if ( graph != nullptr ) {
+        SST::Core::Serialization::serializer ser;
+        ser.start_sizing();
+        ser& graph;
+        graph_size = ser.size();
+    }
+    MemoryAccounting::set(MemoryAccounting::CONFIG_GRAPH, graph_size);
+    MemoryAccounting::set(MemoryAccounting::PARAMS, Params::getSharedMemoryEstimate());
+
+    // The activities themselves are in the mempools, so only the
+    // queue entries count.  The max depth covers the whole run.
+    int64_t tv_entries = 0;
+    int64_t sync_size  = 0;
+    for ( auto* instance : instanceVec ) {
+        if ( instance == nullptr ) continue;
+        if ( instance->timeVortex != nullptr ) {
+            tv_entries += phase == MemoryAccounting::RUN ? instance->getTimeVortexMaxDepth()
+                                                         : instance->getTimeVortexCurrentDepth();
+        }
+        if ( instance->syncManager != nullptr ) sync_size += instance->getSyncQueueDataSize();
+    }
+    MemoryAccounting::set(MemoryAccounting::TIME_VORTEX, tv_entries * sizeof(Activity*));
+    MemoryAccounting::set(MemoryAccounting::SYNC, sync_size);
+
+    int64_t mempool_bytes = 0;
+    int64_t mempool_items = 0;
+    Core::MemPoolAccessor::getMemPoolUsage(mempool_bytes, mempool_items);
+    MemoryAccounting::set(MemoryAccounting::MEMPOOL, mempool_bytes);
+
+    std::map<size_t, int64_t> by_size;
+    Core::MemPoolAccessor::getMemPoolUsageBySize(by_size);
+    int64_t by_class[MemoryAccounting::NUM_SIZE_CLASSES] = {};
+    for ( auto& x : by_size ) {
+        by_class[MemoryAccounting::getSizeClass(x.first)] += x.second;
+    }
+    for ( int i = 0; i < MemoryAccounting::NUM_SIZE_CLASSES; ++i ) {
+        MemoryAccounting::setMemPoolSizeClass(i, by_class[i]);
+    }
+
+    MemoryAccounting::set(MemoryAccounting::SHARED_OBJECTS, SharedObject::manager.getMemoryEstimate());
+
+    MemoryAccounting::endPhase(phase);
+}
+
+double
+Simulation_impl::getSyncTime() const
+{
+    return syncManager->getSyncTime();
+}
+
 Statistics::StatisticProcessingEngine*
 Simulation_impl::getStatisticsProcessingEngine(void)
 {
@@ -1204,6 +2689,15 @@ Simulation_impl::intializeProfileTools(const std::string& config)
             if ( index == std::string::npos ) {
                 // No do, see if it's one of the built-in points
                 if ( p == "clock" || p == "event" || p == "sync" ) { valid = true; }
+#ifdef SST_DISABLE_HANDLER_PROFILING
+                if ( p == "clock" || p == "event" ) {
+                    sim_output.fatal(
+                        CALL_INFO_LONG, 1,
+                        "ERROR: Profile point %s is not available, SST was configured with "
+                        "--disable-handler-profiling\n",
+                        tok.c_str());
+                }
+#endif
             }
             else {
                 // Get the type and the point
@@ -1321,25 +2815,29 @@ Simulation_impl::printPerformanceInfo()
 #endif
 
 /* Define statics */
-Factory*                   Simulation_impl::factory;
-TimeLord                   Simulation_impl::timeLord;
-std::map<LinkId_t, Link*>  Simulation_impl::cross_thread_links;
-Output                     Simulation_impl::sim_output;
-Core::ThreadSafe::Barrier  Simulation_impl::initBarrier;
-Core::ThreadSafe::Barrier  Simulation_impl::completeBarrier;
-Core::ThreadSafe::Barrier  Simulation_impl::setupBarrier;
-Core::ThreadSafe::Barrier  Simulation_impl::runBarrier;
-Core::ThreadSafe::Barrier  Simulation_impl::exitBarrier;
-Core::ThreadSafe::Barrier  Simulation_impl::finishBarrier;
-std::mutex                 Simulation_impl::simulationMutex;
-Core::ThreadSafe::Spinlock Simulation_impl::cross_thread_lock;
-TimeConverter*             Simulation_impl::minPartTC = nullptr;
-SimTime_t                  Simulation_impl::minPart;
+Factory*                  Simulation_impl::factory;
+TimeLord                  Simulation_impl::timeLord;
+Output                    Simulation_impl::sim_output;
+Core::ThreadSafe::Barrier Simulation_impl::initBarrier;
+Core::ThreadSafe::Barrier Simulation_impl::completeBarrier;
+Core::ThreadSafe::Barrier Simulation_impl::setupBarrier;
+Core::ThreadSafe::Barrier Simulation_impl::runBarrier;
+Core::ThreadSafe::Barrier Simulation_impl::exitBarrier;
+Core::ThreadSafe::Barrier Simulation_impl::finishBarrier;
+std::mutex                Simulation_impl::simulationMutex;
+TimeConverter*            Simulation_impl::minPartTC = nullptr;
+SimTime_t                 Simulation_impl::minPart;
 
 /* Define statics (Simulation) */
 std::unordered_map<std::thread::id, Simulation_impl*> Simulation_impl::instanceMap;
+thread_local Simulation_impl*                          Simulation_impl::current_instance = nullptr;
 std::vector<Simulation_impl*>                         Simulation_impl::instanceVec;
 std::atomic<int>                                      Simulation_impl::untimed_msg_count;
 Exit*                                                 Simulation_impl::m_exit;
+SimulatorMetrics*                                     Simulation_impl::m_metrics = nullptr;
+
+/* Define statics (Barrier) */
+bool                Core::ThreadSafe::Barrier::use_tree     = false;
+thread_local size_t Core::ThreadSafe::Barrier::thread_index = 0;
 
 } // namespace SST
@@ -15,7 +15,9 @@
 #define SST_CORE_SIMULATION_IMPL_H
 
 #include "sst/core/clock.h"
+#include "sst/core/clockBatch.h"
 #include "sst/core/componentInfo.h"
+#include "sst/core/memuse.h"
 #include "sst/core/oneshot.h"
 #include "sst/core/output.h"
 #include "sst/core/profile/profiletool.h"
@@ -26,10 +28,13 @@
 #include "sst/core/unitAlgebra.h"
 
 #include <atomic>
+#include <chrono>
 #include <cstdio>
 #include <iostream>
+#include <mutex>
 #include <signal.h>
 #include <thread>
+#include <typeindex>
 #include <unordered_map>
 
 /* Forward declare for Friendship */
@@ -41,9 +46,12 @@ namespace SST {
 #define STATALLFLAG            "--ALLSTATS--"
 
 class Activity;
+class BoundaryTrace;
 class Component;
 class Config;
+class ConfigComponent;
 class ConfigGraph;
+class DirectDeliveryQueue;
 class Exit;
 class Factory;
 class SimulatorHeartbeat;
@@ -52,6 +60,7 @@ class LinkMap;
 class Params;
 class SharedRegionManager;
 class SimulatorHeartbeat;
+class SimulatorMetrics;
 class SyncBase;
 class SyncManager;
 class ThreadSync;
@@ -122,15 +131,31 @@ public:
 
     /******** End Public API from Simulation ********/
 
-    typedef std::map<std::pair<SimTime_t, int>, Clock*>   clockMap_t;   /*!< Map of times to clocks */
-    typedef std::map<std::pair<SimTime_t, int>, OneShot*> oneShotMap_t; /*!< Map of times to OneShots */
+    typedef std::map<std::pair<SimTime_t, int>, Clock*>   clockMap_t;      /*!< Map of times to clocks */
+    typedef std::map<int, Clock::Group*>                  clockGroupMap_t; /*!< Map of priorities to clock groups */
+    typedef std::map<std::pair<SimTime_t, int>, OneShot*> oneShotMap_t;    /*!< Map of times to OneShots */
+
+    /** Map of batch types and clock periods to clock batches */
+    typedef std::map<std::pair<std::type_index, SimTime_t>, ClockBatch*> clockBatchMap_t;
 
     ~Simulation_impl();
 
     /*********  Static Core-only Functions *********/
 
     /** Return a pointer to the singleton instance of the Simulation */
-    static Simulation_impl* getSimulation() { return instanceMap.at(std::this_thread::get_id()); }
+    static Simulation_impl* getSimulation()
+    {
+        if ( current_instance != nullptr ) return current_instance;
+        return instanceMap.at(std::this_thread::get_id());
+    }
+
+    /** Return the current simulation time of the calling thread's
+     * Simulation, without a virtual call */
+    static SimTime_t getThreadSimCycle() { return getSimulation()->currentSimCycle; }
+
+    /** Return the current priority of the calling thread's Simulation,
+     * without a virtual call */
+    static int getThreadPriority() { return getSimulation()->currentPriority; }
 
     /** Return the TimeLord associated with this Simulation */
     static TimeLord* getTimeLord(void) { return &timeLord; }
@@ -153,9 +178,21 @@ public:
     /** Sets an internal flag for signaling the simulation.  Used internally */
     static void setSignal(int signal);
 
+    /** Like setSignal(), but does not replace a signal that has not
+     * been handled yet.  Used by the metrics timer */
+    static void postSignal(int signal);
+
     /** Insert an activity to fire at a specified time */
     void insertActivity(SimTime_t time, Activity* ev);
 
+    /** With the tight clock loop, check whether act would be the next
+        activity out of the TimeVortex if it was inserted for time.  If
+        so, the simulation moves to time and act runs again right away
+        instead of being inserted.
+        @return true if act should run now, false if it should be inserted
+     */
+    bool runNext(Activity* act, SimTime_t time);
+
     /** Return the exit event */
     Exit* getExit() const { return m_exit; }
 
@@ -174,17 +211,60 @@ public:
     /** Set cycle count, which, if reached, will cause the simulation to halt. */
     void setStopAtCycle(Config* cfg);
 
+    /** Cycle the simulation halts at, MAX_SIMTIME_T if there is no
+     * --stop-at time */
+    SimTime_t getStopAtCycle() const { return stopAtCycle; }
+
     /** Perform the init() phase of simulation */
     void initialize();
 
     /** Perform the complete() phase of simulation */
     void complete();
 
+    /** Check whether init() or complete() is called on a Component in
+     * the current untimed phase */
+    bool callUntimedPhase(size_t index);
+
     /** Perform the setup() and run phases of the simulation. */
     void setup();
 
     void run();
 
+    /** Type of the run loops, which return true on a time fault */
+    typedef bool (Simulation_impl::*RunLoop_t)();
+
+    /** Prepare a simulation that is restarting from a checkpoint to
+     * run.  Used in place of initialize() and setup(), which were run
+     * before the checkpoint was written.
+     */
+    void prepareForRestart();
+
+    /** Returns true if a checkpoint should be written at the current
+     * sync point */
+    bool checkpointDue() const { return checkpoint_period != 0 && currentSimCycle >= next_checkpoint; }
+
+    /** Write a checkpoint of this thread's part of the simulation.
+     * Must be called by all threads of all ranks at the same
+     * simulated time, at a point where no events are in flight
+     * between threads or ranks.
+     * @param rank_sync_time - Time of the next rank sync
+     * @param thread_sync_time - Time of the next thread sync
+     */
+    void checkpoint(SimTime_t rank_sync_time, SimTime_t thread_sync_time);
+
+    /** Save the state of this thread in memory, replacing the last
+     * saved state.  Used by syncs that run ahead optimistically, at
+     * points where no events are in flight between ranks.  All
+     * components must support checkpointing.
+     */
+    void saveSnapshot();
+
+    /** Roll this thread back to the state saved by saveSnapshot().
+     * Events sent to other ranks since then are not undone, so the
+     * RankSync has to drop them.
+     */
+    void restoreSnapshot();
+
     void finish();
 
     /** Adjust clocks and time to reflect precise simulation end time which
@@ -210,6 +290,18 @@ public:
 
     SimTime_t getInterThreadMinLatency() const { return interThreadMinLatency; }
 
+    /** Minimum latency of the cross-thread links attached to this thread */
+    SimTime_t getInterThreadLookahead() const { return interThreadLookahead; }
+
+    /** Minimum size of a rank sync buffer that will be compressed */
+    uint32_t getSyncCompressThreshold() const { return sync_compress_threshold; }
+
+    /** Whether rank syncs overlap the next sync time reduction with the exchange */
+    bool getSyncNonblockingReduce() const { return sync_nonblocking_reduce; }
+
+    /** Whether rank syncs use the sparse exchange for untimed data */
+    bool getSyncSparseUntimed() const { return sync_sparse_untimed; }
+
     static TimeConverter* getMinPartTC() { return minPartTC; }
 
     LinkMap* getComponentLinkMap(ComponentId_t id) const
@@ -260,6 +352,13 @@ public:
      */
     static SimTime_t getLocalMinimumNextActivityTime();
 
+    /**
+     *  Gets the earliest time an event sent between threads in the
+     *  Rank could arrive, computed from the next activity time and
+     *  the cross-thread link lookahead of each thread
+     */
+    static SimTime_t getLocalMinimumNextSyncTime();
+
     /**
      * Returns true when the Wireup is finished.
      */
@@ -271,6 +370,31 @@ public:
 
     uint64_t getSyncQueueDataSize() const;
 
+    /** Set the estimated sizes of the core subsystems on this rank and
+     * record them for the end of a phase.  The graph is only counted
+     * if one is passed in.  Must be called from one thread while the
+     * others wait.
+     */
+    static void recordMemoryUse(Core::MemoryAccounting::Phase phase, ConfigGraph* graph = nullptr);
+
+    /** Number of activities executed by the run loop of this thread */
+    uint64_t getEventsExecuted() const { return events_executed; }
+
+    /** Wall-clock seconds this thread spent in the run loop */
+    double getRunLoopTime() const { return run_loop_time; }
+
+    /** Wall-clock seconds this thread spent in syncs during the run
+     * loop.  Only measured with --metrics-file or
+     * --print-imbalance-info, 0 otherwise. */
+    double getSyncTime() const;
+
+    /** Wall-clock seconds this thread waited at the end of the run
+     * loop for the other threads to finish */
+    double getRunBarrierTime() const { return run_barrier_time; }
+
+    /** Wall-clock seconds this thread spent in each round of init */
+    const std::vector<double>& getInitRoundTimes() const { return init_round_times; }
+
     /******** API provided through BaseComponent only ***********/
 
     /** Register a handler to be called on a set frequency */
@@ -280,20 +404,46 @@ public:
 
     TimeConverter* registerClock(TimeConverter* tcFreq, Clock::HandlerBase* handler, int priority);
 
+    /** Register a handler that can skip ahead to be called on a set frequency */
+    TimeConverter* registerClock(TimeConverter* tcFreq, Clock::SkipHandlerBase* handler, int priority);
+
+    /** Register a handler that can be suspended and resumed (see
+     * Clock::registerSuspendable()) to be called on a set frequency */
+    Clock::SuspendHandle registerSuspendableClock(TimeConverter* tcFreq, Clock::HandlerBase* handler, int priority);
+
     /** Remove a clock handler from the list of active clock handlers */
     void unregisterClock(TimeConverter* tc, Clock::HandlerBase* handler, int priority);
 
+    void unregisterClock(TimeConverter* tc, Clock::SkipHandlerBase* handler, int priority);
+
     /** Reactivate an existing clock and handler.
      * @return time when handler will next fire
      */
     Cycle_t reregisterClock(TimeConverter* tc, Clock::HandlerBase* handler, int priority);
 
+    Cycle_t reregisterClock(TimeConverter* tc, Clock::SkipHandlerBase* handler, int priority);
+
     /** Returns the next Cycle that the TImeConverter would fire. */
     Cycle_t getNextClockCycle(TimeConverter* tc, int priority = CLOCKPRIORITY);
 
+    /** Return this thread's batch of the given type on a clock, creating
+     * it with create and registering it on the clock if needed */
+    ClockBatch* getClockBatch(TimeConverter* tc, const std::type_info& type, ClockBatch* (*create)());
+
     /** Return the Statistic Processing Engine associated with this Simulation */
     Statistics::StatisticProcessingEngine* getStatisticsProcessingEngine(void);
 
+    /** Returns a lock that must be held while changing state shared
+     * by the components of this Simulation.  The lock is only taken
+     * while components are being constructed by more than one
+     * thread (see --construct-threads); otherwise the returned lock
+     * does not own anything. */
+    std::unique_lock<std::recursive_mutex> getConstructLock()
+    {
+        if ( parallel_construct ) return std::unique_lock<std::recursive_mutex>(construct_lock);
+        return std::unique_lock<std::recursive_mutex>();
+    }
+
 
     friend class Link;
     friend class Action;
@@ -323,15 +473,38 @@ public:
     static Core::ThreadSafe::Barrier finishBarrier;
     static std::mutex                simulationMutex;
 
-    // Support for crossthread links
-    static Core::ThreadSafe::Spinlock cross_thread_lock;
-    static std::map<LinkId_t, Link*>  cross_thread_links;
-    bool                              direct_interthread;
+    // Support for crossthread links.  The links between two threads
+    // are paired through slots owned by the lower numbered thread,
+    // one for each link in the order both threads find them in the
+    // graph, so no lock is needed.  Indexed by the other thread.
+    std::vector<std::vector<std::atomic<Link*>>> cross_thread_slots;
+    std::vector<size_t>                          cross_thread_next;
+
+    bool        direct_interthread;
+    bool        interthread_lookahead;
+    uint32_t    sync_compress_threshold;
+    bool        sync_nonblocking_reduce;
+    bool        sync_sparse_untimed;
+    std::string rank_sync;
+    SimTime_t   optimistic_window; // 0 uses the default of the optimistic rank sync
+
+    // Support for constructing components with more than one thread
+    uint32_t             construct_threads;
+    bool                 parallel_construct;
+    std::recursive_mutex construct_lock;
+    /* Simulation of the calling thread, so getSimulation() doesn't have
+     * to look up the thread id.  Construction worker threads set it to
+     * the Simulation they are building components for. */
+    static thread_local Simulation_impl* current_instance;
 
     Component* createComponent(ComponentId_t id, const std::string& name, Params& params);
 
     TimeVortex* getTimeVortex() const { return timeVortex; }
 
+    /** Send queue for zero latency links, nullptr unless direct
+     * delivery is enabled */
+    DirectDeliveryQueue* getDirectDeliveryQueue() const { return directQueue; }
+
     /** Emergency Shutdown
      * Called when a SIGINT or SIGTERM has been seen
      */
@@ -349,28 +522,61 @@ public:
 
     friend class SyncManager;
 
+    /** The event loop of run(), specialized on the type of the
+     * TimeVortex.  Defined in simulation_runloop.h. */
+    template <typename TV>
+    bool runLoop();
+
+    /** Get the run loop specialized for a built-in TimeVortex, or the
+     * one that makes virtual calls for any other type */
+    static RunLoop_t selectRunLoop(const std::string& timevortex_type);
+
+    /** Whether a component is left out because a boundary trace is
+     * replayed in its place */
+    bool isReplaced(const ConfigComponent* ccomp) const;
+
     TimeVortex*             timeVortex;
+    RunLoop_t               run_loop;
+    DirectDeliveryQueue*    directQueue;
+    bool                    tight_clock_loop; // Run clock ticks back to back, only with one thread per rank
     TimeConverter*          threadMinPartTC;
     Activity*               current_activity;
     static SimTime_t        minPart;
     static TimeConverter*   minPartTC;
     std::vector<SimTime_t>  interThreadLatencies;
     SimTime_t               interThreadMinLatency;
+    SimTime_t               interThreadLookahead;
     SyncManager*            syncManager;
     // ThreadSync*      threadSync;
     ComponentInfoMap        compInfoMap;
     clockMap_t              clockMap;
+    clockGroupMap_t         clockGroupMap;
+    clockBatchMap_t         clockBatchMap;
     oneShotMap_t            oneShotMap;
     static Exit*            m_exit;
     SimulatorHeartbeat*     m_heartbeat;
+    BoundaryTrace*          boundary_trace; // nullptr unless recording or replaying a boundary trace
+    uint64_t                events_executed; // Activities executed by the run loop
     bool                    endSim;
     bool                    independent; // true if no links leave thread (i.e. no syncs required)
     static std::atomic<int> untimed_msg_count;
+    SimTime_t               checkpoint_period; // 0 if no checkpoints are written
+    SimTime_t               next_checkpoint;
+    uint32_t                checkpoint_index;
+    std::string             checkpoint_prefix;
+    std::string             load_checkpoint;
+    bool                    checkpoint_async;
+    bool                    checkpoint_incremental;
+    std::thread             checkpoint_writer; // Writes the last checkpoint if checkpoint_async
     unsigned int            untimed_phase;
+    bool                    active_untimed_phases; // Only call components with untimed work after phase 0
     volatile sig_atomic_t   lastRecvdSignal;
     ShutdownMode_t          shutdown_mode;
     bool                    wireUpFinished;
 
+    /** Live metrics writer, nullptr unless --metrics-file is given */
+    static SimulatorMetrics* m_metrics;
+
     /** TimeLord of the simulation */
     static TimeLord timeLord;
     /** Output */
@@ -442,6 +648,9 @@ public:
     uint64_t       runtime = 0;
     struct timeval start, end, diff;
     struct timeval sumstart, sumend, sumdiff;
+#if SST_HIGH_RESOLUTION_CLOCK
+    std::chrono::high_resolution_clock::time_point run_start;
+#endif
 #endif
 
 
@@ -484,6 +693,7 @@ public:
     SimTime_t currentSimCycle;
     int       currentPriority;
     SimTime_t endSimCycle;
+    SimTime_t stopAtCycle;
 
     // Rank information
     RankInfo my_rank;
@@ -494,11 +704,16 @@ public:
 
     double run_phase_start_time;
     double run_phase_total_time;
+    double run_loop_time;
+    double run_barrier_time;
+    bool   track_sync_time; // Have the SyncManager time the syncs
     double init_phase_start_time;
     double init_phase_total_time;
     double complete_phase_start_time;
     double complete_phase_total_time;
 
+    std::vector<double> init_round_times;
+
     static std::unordered_map<std::thread::id, Simulation_impl*> instanceMap;
     static std::vector<Simulation_impl*>                         instanceVec;
 
@@ -511,6 +726,38 @@ private:
      * that is in the TImeVortex of the Simulation
      */
     SimTime_t getNextActivityTime() const;
+
+    /** Find the clock with a period and priority, creating it if it
+     * doesn't exist yet.  Called with the construct lock held. */
+    Clock* getClock(TimeConverter* tcFreq, int priority);
+
+    /** Implementation of the clock registration functions for both
+     * kinds of clock handler */
+    template <typename HandlerT>
+    TimeConverter* registerClockHandler(TimeConverter* tcFreq, HandlerT* handler, int priority);
+    template <typename HandlerT>
+    void unregisterClockHandler(TimeConverter* tc, HandlerT* handler, int priority);
+    template <typename HandlerT>
+    Cycle_t reregisterClockHandler(TimeConverter* tc, HandlerT* handler, int priority);
+
+    /** Restore the state written by checkpoint() from load_checkpoint */
+    void restoreCheckpoint();
+
+    /** Checkpoint that holds the last saved state of a component, and
+     * the hash and size of that state, for incremental checkpoints */
+    struct CheckpointRef
+    {
+        uint32_t index;
+        size_t   hash;
+        size_t   size;
+    };
+
+    std::map<ComponentId_t, CheckpointRef> checkpoint_component_refs;
+    std::map<ComponentId_t, CheckpointRef> checkpoint_statistic_refs;
+
+    /** State saved by saveSnapshot() */
+    struct Snapshot;
+    Snapshot* snapshot;
 };
 
 // Function to allow for easy serialization of threads while debugging
@@ -0,0 +1,206 @@
+// -*- c++ -*-
+
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_SIMULATION_RUNLOOP_H
+#define SST_CORE_SIMULATION_RUNLOOP_H
+
+#include "sst/core/directDeliveryQueue.h"
+#include "sst/core/metrics.h"
+#include "sst/core/simulation_impl.h"
+#include "sst/core/sync/syncManager.h"
+#include "sst/core/timeVortex.h"
+
+#include <signal.h>
+#include <sys/time.h>
+#include <type_traits>
+#include <vector>
+
+namespace SST {
+
+/**
+ * The body of the run loop, specialized on the type of the TimeVortex.
+ *
+ * simulation.cc instantiates it for TimeVortex, which is used for any
+ * TimeVortex loaded from an element library.  Each built-in TimeVortex
+ * instantiates it for its own type in the file that defines its pop()
+ * and front(), so they can be inlined into the loop.  Only use a TV
+ * whose pop(), front(), empty() and popBatch() aren't overridden by
+ * the actual type of the TimeVortex.
+ */
+template <typename TV>
+bool
+Simulation_impl::runLoop()
+{
+    // Calls qualified with TV aren't virtual.  TimeVortex itself is
+    // abstract, so its loop keeps the virtual calls.
+    TV*  vortex = static_cast<TV*>(timeVortex);
+    auto front  = [vortex]() {
+        if constexpr ( std::is_same<TV, TimeVortex>::value )
+            return vortex->front();
+        else
+            return vortex->TV::front();
+    };
+    auto pop = [vortex]() {
+        if constexpr ( std::is_same<TV, TimeVortex>::value )
+            return vortex->pop();
+        else
+            return vortex->TV::pop();
+    };
+    auto empty = [vortex]() {
+        if constexpr ( std::is_same<TV, TimeVortex>::value )
+            return vortex->empty();
+        else
+            return vortex->TV::empty();
+    };
+    auto pop_batch = [vortex, &front, &pop, &empty](std::vector<Activity*>& batch) {
+        if constexpr ( std::is_same<TV, TimeVortex>::value ) { vortex->popBatch(batch); }
+        else if constexpr ( std::is_same<decltype(&TV::popBatch), decltype(&TimeVortex::popBatch)>::value ) {
+            // Same as the default popBatch(), but with the calls to
+            // TV inlined
+            Activity* first = pop();
+            batch.push_back(first);
+            while ( !empty() && front()->getDeliveryTime() == first->getDeliveryTime() &&
+                    front()->getPriority() == first->getPriority() ) {
+                batch.push_back(pop());
+            }
+        }
+        else {
+            vortex->TV::popBatch(batch);
+        }
+    };
+    auto execute = [this](Activity* activity) {
+        current_activity = activity;
+        currentPriority  = activity->getPriority();
+        activity->execute();
+        events_executed++;
+#if SST_PERIODIC_PRINT
+        periodicCounter++;
+#endif
+    };
+
+    // Activities with the same time and priority are popped together,
+    // so the checks below are done once for all of them.  Syncs, stops
+    // and checkpoints are popped one at a time, since they depend on
+    // what's left in the TimeVortex.  So are activities when there is
+    // a direct delivery queue, since zero latency events can go
+    // between them.
+    std::vector<Activity*> batch;
+
+    // Will check to make sure time doesn't "go backwards".  This will
+    // also catch the case of rollover (exceeding the 64-bit value
+    // space of SimTime_t).  To avoid yet another branch in the main
+    // run loop, we will check for a time fault, but will execute the
+    // next event and only exit the run loop on the next iteration.
+    // If there was a fault, a message will be printed.
+    bool time_fault = false;
+    while ( LIKELY(!endSim && !time_fault) ) {
+        // Events for the current time from zero latency links are
+        // merged in by the same ordering the TimeVortex uses.  On a
+        // tie the TimeVortex goes first, since it was inserted into
+        // earlier.
+        if ( UNLIKELY(directQueue != nullptr) ) {
+            if ( !directQueue->empty() && Activity::less<true, true, false>()(directQueue->front(), front()) ) {
+                batch.push_back(directQueue->pop());
+            }
+            else {
+                batch.push_back(pop());
+            }
+        }
+        else if ( front()->getPriority() < CLOCKPRIORITY ) {
+            batch.push_back(pop());
+        }
+        else {
+            pop_batch(batch);
+        }
+
+        // Check for time fault
+        SimTime_t event_time = batch.front()->getDeliveryTime();
+        time_fault           = event_time < currentSimCycle;
+
+        currentSimCycle = event_time;
+        size_t count    = batch.size();
+        for ( size_t i = 0; i < count; ++i ) {
+            if ( i + 1 == count ) {
+                execute(batch[i]);
+                break;
+            }
+            __builtin_prefetch(batch[i + 1]);
+            execute(batch[i]);
+
+            // Something inserted ahead of the rest of the batch, like
+            // a stop at the current time, runs first, the same as it
+            // would have without batching
+            while ( !empty() && Activity::less<true, true, false>()(front(), batch[i + 1]) ) {
+                execute(pop());
+            }
+
+            // Whatever didn't run stays in the TimeVortex to be
+            // cleaned up with it
+            if ( UNLIKELY(endSim) ) {
+                for ( size_t j = i + 1; j < count; ++j ) {
+                    timeVortex->insert(batch[j]);
+                }
+                break;
+            }
+        }
+        batch.clear();
+
+        if ( UNLIKELY(0 != lastRecvdSignal) ) {
+            switch ( lastRecvdSignal ) {
+            case SIGUSR1:
+                printStatus(false);
+                break;
+            case SIGUSR2:
+                printStatus(true);
+                break;
+            case SimulatorMetrics::REPORT_SIGNAL:
+                m_metrics->report(this, events_executed, syncManager->getSyncTime());
+                break;
+            case SIGALRM:
+            case SIGINT:
+            case SIGTERM:
+                shutdown_mode = SHUTDOWN_SIGNAL;
+                sim_output.output("EMERGENCY SHUTDOWN (%u,%u)!\n", my_rank.rank, my_rank.thread);
+                sim_output.output(
+                    "# Simulated time:                  %s\n", getElapsedSimTime().toStringBestSI().c_str());
+                endSim = true;
+                break;
+            default:
+                break;
+            }
+            lastRecvdSignal = 0;
+        }
+
+#if SST_PERIODIC_PRINT
+        if ( periodicCounter >= SST_PERIODIC_PRINT_THRESHOLD ) {
+#if SST_RUNTIME_PROFILING
+#if SST_HIGH_RESOLUTION_CLOCK
+            auto finish = std::chrono::high_resolution_clock::now();
+            runtime     = std::chrono::duration_cast<std::chrono::nanoseconds>(finish - run_start).count();
+#else
+            gettimeofday(&end, NULL);
+            timersub(&end, &start, &diff);
+            runtime = diff.tv_usec + diff.tv_sec * 1e6;
+#endif
+#endif
+            periodicCounter = 0;
+            printPerformanceInfo();
+        }
+#endif
+    }
+    return time_fault;
+}
+
+} // namespace SST
+
+#endif // SST_CORE_SIMULATION_RUNLOOP_H
@@ -59,7 +59,7 @@ typedef double volts;
 enum class SimulationRunMode {
     UNKNOWN, /*!< Unknown mode - Invalid for running */
     INIT,    /*!< Initialize-only.  Useful for debugging initialization and graph generation */
-    RUN,     /*!< Run-only.  Useful when restoring from a checkpoint (not currently supported) */
+    RUN,     /*!< Run-only.  Used when restoring from a checkpoint */
     BOTH     /*!< Default.  Both initialize and Run the simulation */
 };
 
@@ -15,6 +15,8 @@
 #include "sst/core/profile/profiletool.h"
 #include "sst/core/sst_types.h"
 
+#include <vector>
+
 namespace SST {
 
 class Params;
@@ -83,6 +85,33 @@ public:
 
 // new Class::Handler<Class,int>(this, &Class::callback_function, 1)
 
+// When the callback is known at compile time, SSTHandler2 takes the
+// member function as a template argument instead of storing a pointer
+// to it.  Calling the handler is then a single virtual call with the
+// callback inlined into it, rather than a virtual call followed by a
+// call through a member function pointer:
+
+// template <typename classT, auto funcT, typename dataT = void>
+// using Handler2 = SSTHandler2<return_type_of_callback, arg_type_of_callback, classT, dataT, funcT>;
+
+// new Class::Handler2<Class, &Class::callback_function>(this)
+
+// Or:
+
+// new Class::Handler2<Class, &Class::callback_function, int>(this, 1)
+
+// SSTDispatchHandler calls a different member function for each type
+// of argument, picked with a table lookup instead of casts:
+
+// template <typename classT>
+// using DispatchHandler = SSTDispatchHandler<return_type_of_callback, arg_base_type, classT>;
+
+// auto* handler = new Class::DispatchHandler<Class>(this, &Class::fallback_function);
+// handler->on<DerivedType, &Class::derived_function>();
+
+// If SST is configured with --disable-handler-profiling, the check for
+// ProfileTools is compiled out of all handlers.
+
 
 /// Functor classes for Event handling
 
@@ -177,6 +206,7 @@ public:
 
     inline returnT operator()(argT arg)
     {
+#ifndef SST_DISABLE_HANDLER_PROFILING
         if ( profile_tools ) {
             // NotifyGuard guard(profile_tools);
             // return operator_impl(arg);
@@ -185,6 +215,7 @@ public:
             profile_tools->handlerEnd();
             return ret;
         }
+#endif
         return operator_impl(arg);
     }
 };
@@ -201,12 +232,14 @@ public:
 
     inline void operator()(argT arg)
     {
+#ifndef SST_DISABLE_HANDLER_PROFILING
         if ( profile_tools ) {
             profile_tools->handlerStart();
             operator_impl(arg);
             profile_tools->handlerEnd();
             return;
         }
+#endif
         operator_impl(arg);
     }
 };
@@ -264,6 +297,114 @@ public:
 };
 
 
+/**
+ * Handler class with user-data argument and the member function
+ * fixed at compile time
+ */
+template <typename returnT, typename argT, typename classT, typename dataT, auto funcT>
+class SSTHandler2 final : public SSTHandlerBase<returnT, argT>
+{
+private:
+    classT* object;
+    dataT   data;
+
+public:
+    /** Constructor
+     * @param object - Pointer to Object upon which to call the handler
+     * @param data - Additional argument to pass to handler
+     */
+    SSTHandler2(classT* const object, dataT data) : SSTHandlerBase<returnT, argT>(), object(object), data(data) {}
+
+    returnT operator_impl(argT arg) override { return (object->*funcT)(arg, data); }
+};
+
+
+/**
+ * Handler class with no user-data and the member function fixed at
+ * compile time
+ */
+template <typename returnT, typename argT, typename classT, auto funcT>
+class SSTHandler2<returnT, argT, classT, void, funcT> final : public SSTHandlerBase<returnT, argT>
+{
+private:
+    classT* object;
+
+public:
+    /** Constructor
+     * @param object - Pointer to Object upon which to call the handler
+     */
+    SSTHandler2(classT* const object) : SSTHandlerBase<returnT, argT>(), object(object) {}
+
+    returnT operator_impl(argT arg) override { return (object->*funcT)(arg); }
+};
+
+
+/**
+ * Handler class that calls a different member function for each
+ * concrete type of argument, picked from a table indexed by the type
+ * id of the argument.  This replaces a chain of dynamic_casts in a
+ * single callback.  argT is the base type of the argument, which
+ * must provide getTypeId() and the static template typeId<T>(), like
+ * Event does.  Arguments of any type without a callback, and null
+ * arguments, go to the fallback.
+ */
+template <typename returnT, typename argT, typename classT>
+class SSTDispatchHandler final : public SSTHandlerBase<returnT, argT*>
+{
+private:
+    typedef returnT (classT::*PtrMember)(argT*);
+    typedef returnT (*Thunk)(classT*, argT*);
+
+    classT*            object;
+    const PtrMember    fallback;
+    std::vector<Thunk> table;
+
+    // One per callback, with the callback inlined and the argument
+    // cast without checking, since the table already matched its type
+    template <typename T, returnT (classT::*funcT)(T*)>
+    static returnT thunk(classT* object, argT* arg)
+    {
+        return (object->*funcT)(static_cast<T*>(arg));
+    }
+
+public:
+    /** Constructor
+     * @param object - Pointer to Object upon which to call the handler
+     * @param fallback - Member function to call for arguments whose
+     * type has no callback
+     */
+    SSTDispatchHandler(classT* const object, PtrMember fallback) :
+        SSTHandlerBase<returnT, argT*>(),
+        object(object),
+        fallback(fallback)
+    {}
+
+    /** Add the callback for arguments of type T.  Only arguments that
+     * are exactly a T use it, not ones of classes derived from T.
+     * Types that can't be serialized have no type id and always go to
+     * the fallback.
+     * @return this, so callbacks can be chained
+     */
+    template <typename T, returnT (classT::*funcT)(T*)>
+    SSTDispatchHandler* on()
+    {
+        uint32_t id = argT::template typeId<T>();
+        if ( id >= table.size() ) table.resize(id + 1, nullptr);
+        table[id] = &thunk<T, funcT>;
+        return this;
+    }
+
+    returnT operator_impl(argT* arg) override
+    {
+        if ( arg != nullptr ) {
+            uint32_t id = arg->getTypeId();
+            if ( id < table.size() && table[id] != nullptr ) return table[id](object, arg);
+        }
+        return (object->*fallback)(arg);
+    }
+};
+
+
 /// Handlers with no arguments to callback from caller
 template <typename returnT>
 class SSTHandlerBaseNoArgs : public SSTHandlerBaseProfile
@@ -280,12 +421,14 @@ public:
 
     inline returnT operator()()
     {
+#ifndef SST_DISABLE_HANDLER_PROFILING
         if ( profile_tools ) {
             profile_tools->handlerStart();
             auto ret = operator_impl();
             profile_tools->handlerEnd();
             return ret;
         }
+#endif
         return operator_impl();
     }
 };
@@ -305,12 +448,14 @@ public:
 
     inline void operator()()
     {
+#ifndef SST_DISABLE_HANDLER_PROFILING
         if ( profile_tools ) {
             profile_tools->handlerStart();
             operator_impl();
             profile_tools->handlerEnd();
             return;
         }
+#endif
         return operator_impl();
     }
 };
@@ -422,6 +422,10 @@ processSSTElementFiles()
         addELI(loader, l, g_configuration.processAllElements());
     }
 
+    if ( !g_configuration.getElementCacheFile().empty() ) {
+        loader.writeElementCache(g_configuration.getElementCacheFile(), std::cerr);
+    }
+
     // Store info strings for interactive mode
     if ( g_configuration.interactiveEnabled() ) {
         for ( size_t x = 0; x < g_libInfoArray.size(); x++ ) {
@@ -559,6 +563,11 @@ SSTInfoConfig::SSTInfoConfig(bool suppress_print) : ConfigShared(suppress_print,
         "Element libraries to process (all, <element>) [default: all]. <element> can be an element library, or it can "
         "be a single element within the library.",
         std::bind(&SSTInfoConfig::setLibs, this, _1), false);
+    DEF_ARG(
+        "element-cache", 0, "FILE",
+        "Write the locations of all processed element libraries to FILE.  Setting SST_CORE_ELEMENT_CACHE=FILE lets sst "
+        "and sst-info open cached libraries directly instead of searching the library path.",
+        std::bind(&SSTInfoConfig::setElementCache, this, _1), false);
     addLibraryPathOptions();
 
     DEF_SECTION_HEADING("Advanced Options - Environment");
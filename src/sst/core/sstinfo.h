@@ -73,6 +73,8 @@ public:
     bool doVerbose() const { return m_optionBits & CFG_VERBOSE; }
     /** @return True if interactive is enabled, otherwise False */
     bool interactiveEnabled() const { return m_interactive; }
+    /** @return File to write the element cache to, empty if no cache should be written */
+    const std::string& getElementCacheFile() const { return m_elementCacheFile; }
     void addFilter(const std::string& name);
 
 protected:
@@ -136,6 +138,12 @@ private:
         return 0;
     }
 
+    int setElementCache(const std::string& arg)
+    {
+        m_elementCacheFile = arg;
+        return 0;
+    }
+
     int setQuiet(const std::string& UNUSED(arg))
     {
         m_optionBits &= ~CFG_VERBOSE;
@@ -149,6 +157,7 @@ private:
     std::string              m_XMLFilePath;
     bool                     m_debugEnabled;
     bool                     m_interactive;
+    std::string              m_elementCacheFile;
     FilterMap_t              m_filters;
 };
 
@@ -17,6 +17,7 @@
 #include "sst/core/warnmacros.h"
 
 #include <map>
+#include <vector>
 
 namespace SST {
 
@@ -59,6 +60,19 @@ public:
      */
     virtual void performPartition(ConfigGraph* graph);
 
+    /**
+     * Tells the partitioner how the ranks and threads are laid out on
+     * the machine, before performPartition() is called.  Partitioners
+     * that don't use the layout can ignore it.
+     *
+     * @param rank_node Node of each rank, numbered from 0
+     * @param thread_socket Socket of each thread of a rank, numbered
+     * from 0.  All the threads are on socket 0 unless they are pinned.
+     */
+    virtual void setMachineLayout(
+        const std::vector<uint32_t>& UNUSED(rank_node), const std::vector<uint32_t>& UNUSED(thread_socket))
+    {}
+
     virtual bool requiresConfigGraph() { return false; }
 
     virtual bool spawnOnAllRanks() { return false; }
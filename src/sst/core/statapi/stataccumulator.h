@@ -155,6 +155,20 @@ public:
         this->setCollectionCount(0);
     }
 
+    bool isMergeable() const override { return true; }
+
+    void mergeStatisticData(StatisticBase* other) override
+    {
+        auto* stat = static_cast<AccumulatorStatistic<NumberBase>*>(other);
+        if ( 0 == stat->getCount() ) return;
+
+        m_sum += stat->m_sum;
+        m_sum_sq += stat->m_sum_sq;
+        m_min = (stat->m_min < m_min) ? stat->m_min : m_min;
+        m_max = (stat->m_max > m_max) ? stat->m_max : m_max;
+        this->setCollectionCount(getCount() + stat->getCount());
+    }
+
     void registerOutputFields(StatisticFieldsOutput* statOutput) override
     {
         h_sum   = statOutput->registerField<NumberBase>("Sum");
@@ -180,6 +194,15 @@ public:
         }
     }
 
+    void serialize_order(SST::Core::Serialization::serializer& ser) override
+    {
+        StatisticBase::serialize_order(ser);
+        ser& m_sum;
+        ser& m_sum_sq;
+        ser& m_min;
+        ser& m_max;
+    }
+
     bool isStatModeSupported(StatisticBase::StatMode_t mode) const override
     {
         switch ( mode ) {
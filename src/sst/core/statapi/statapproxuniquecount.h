@@ -0,0 +1,196 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_STATAPI_STATAPPROXUNIQUECOUNT_H
+#define SST_CORE_STATAPI_STATAPPROXUNIQUECOUNT_H
+
+#include "sst/core/output.h"
+#include "sst/core/sst_types.h"
+#include "sst/core/statapi/statbase.h"
+#include "sst/core/warnmacros.h"
+
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace SST {
+class BaseComponent;
+namespace Statistics {
+
+/**
+    \class ApproxUniqueCountStatistic
+
+    Creates a Statistic which estimates the number of unique values
+    provided to it using a HyperLogLog sketch.
+
+    Unlike UniqueCountStatistic, which keeps every value in a set, the
+    sketch is a fixed array of 2^precision one byte registers, so
+    adding a value is a hash and one register update and the memory
+    used does not grow with the number of unique values.  The relative
+    standard error of the estimate is about 1.04 / sqrt(2^precision),
+    1.6% at the default precision of 12.  Small counts are estimated
+    with linear counting and are close to exact.
+
+    @tparam T A template for holding the main data type of this statistic
+*/
+
+template <typename T>
+class ApproxUniqueCountStatistic : public Statistic<T>
+{
+public:
+    SST_ELI_DECLARE_STATISTIC_TEMPLATE(
+        ApproxUniqueCountStatistic,
+        "sst",
+        "ApproxUniqueCountStatistic",
+        SST_ELI_ELEMENT_VERSION(1, 0, 0),
+        "Estimate unique occurrences of statistic with a HyperLogLog sketch",
+        "SST::Statistic<T>")
+
+    ApproxUniqueCountStatistic(
+        BaseComponent* comp, const std::string& statName, const std::string& statSubId, Params& statParams) :
+        Statistic<T>(comp, statName, statSubId, statParams)
+    {
+        // Identify what keys are Allowed in the parameters
+        Params::KeySet_t allowedKeySet;
+        allowedKeySet.insert("precision");
+        statParams.pushAllowedKeys(allowedKeySet);
+
+        precision = statParams.find<uint32_t>("precision", 12);
+        if ( precision < 4 || precision > 18 ) {
+            Output::getDefaultObject().fatal(
+                CALL_INFO, 1, "ApproxUniqueCountStatistic %s: precision must be between 4 and 18, got %" PRIu32 "\n",
+                statName.c_str(), precision);
+        }
+        registers.assign(size_t(1) << precision, 0);
+
+        // Set the Name of this Statistic
+        this->setStatisticTypeName("ApproxUniqueCount");
+    }
+
+    ~ApproxUniqueCountStatistic() {};
+
+protected:
+    /**
+    Present a new value to the Statistic to be included in the estimate
+        @param data New data item to be included in the estimate
+    */
+    void addData_impl(T data) override
+    {
+        uint64_t hash = hashValue(data);
+
+        // The top bits pick the register, which keeps the longest run
+        // of leading zeros seen in the rest of the hash.  The low bit
+        // that is shifted in bounds the run when the rest is all zeros.
+        uint64_t index = hash >> (64 - precision);
+        uint8_t  rank  = __builtin_clzll((hash << precision) | (uint64_t(1) << (precision - 1))) + 1;
+        if ( rank > registers[index] ) registers[index] = rank;
+    }
+
+private:
+    void clearStatisticData() override { registers.assign(registers.size(), 0); }
+
+    /** Shared sketches must all use the same precision */
+    bool isMergeable() const override { return true; }
+
+    void mergeStatisticData(StatisticBase* other) override
+    {
+        auto* stat = static_cast<ApproxUniqueCountStatistic<T>*>(other);
+        if ( stat->precision != precision ) {
+            Output::getDefaultObject().fatal(
+                CALL_INFO, 1, "ERROR: Shared statistic %s - All copies must have the same precision\n",
+                this->getFullStatName().c_str());
+        }
+
+        // The sketch of the union keeps the larger of each register
+        for ( size_t i = 0; i < registers.size(); ++i ) {
+            if ( stat->registers[i] > registers[i] ) registers[i] = stat->registers[i];
+        }
+    }
+
+    void serialize_order(SST::Core::Serialization::serializer& ser) override
+    {
+        StatisticBase::serialize_order(ser);
+        ser& precision;
+        ser& registers;
+    }
+
+    void registerOutputFields(StatisticFieldsOutput* statOutput) override
+    {
+        uniqueCountField = statOutput->registerField<uint64_t>("UniqueItems");
+    }
+
+    void outputStatisticFields(StatisticFieldsOutput* statOutput, bool UNUSED(EndOfSimFlag)) override
+    {
+        statOutput->outputField(uniqueCountField, getEstimate());
+    }
+
+    /** Mix the bits of a value into a well distributed 64-bit hash */
+    static uint64_t hashValue(T data)
+    {
+        // Treat -0.0 and 0.0 as the same value, as UniqueCountStatistic does
+        if ( data == 0 ) data = 0;
+
+        uint64_t bits = 0;
+        memcpy(&bits, &data, sizeof(T));
+
+        // splitmix64 finalizer
+        bits ^= bits >> 30;
+        bits *= 0xbf58476d1ce4e5b9ULL;
+        bits ^= bits >> 27;
+        bits *= 0x94d049bb133111ebULL;
+        bits ^= bits >> 31;
+        return bits;
+    }
+
+    /** Estimate the number of unique values from the registers */
+    uint64_t getEstimate() const
+    {
+        double   m     = registers.size();
+        double   sum   = 0.0;
+        uint64_t zeros = 0;
+        for ( uint8_t r : registers ) {
+            sum += std::ldexp(1.0, -r);
+            if ( r == 0 ) zeros++;
+        }
+
+        double alpha;
+        switch ( precision ) {
+        case 4:
+            alpha = 0.673;
+            break;
+        case 5:
+            alpha = 0.697;
+            break;
+        case 6:
+            alpha = 0.709;
+            break;
+        default:
+            alpha = 0.7213 / (1.0 + 1.079 / m);
+            break;
+        }
+
+        double estimate = alpha * m * m / sum;
+
+        // Use linear counting while some registers are still empty
+        if ( estimate <= 2.5 * m && zeros != 0 ) { estimate = m * std::log(m / zeros); }
+        return (uint64_t)std::llround(estimate);
+    }
+
+private:
+    uint32_t                       precision;
+    std::vector<uint8_t>           registers;
+    StatisticOutput::fieldHandle_t uniqueCountField;
+};
+
+} // namespace Statistics
+} // namespace SST
+
+#endif // SST_CORE_STATAPI_STATAPPROXUNIQUECOUNT_H
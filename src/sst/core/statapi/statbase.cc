@@ -14,15 +14,21 @@
 #include "sst/core/statapi/statbase.h"
 
 #include "sst/core/baseComponent.h"
+#include "sst/core/memuse.h"
 #include "sst/core/simulation_impl.h"
 #include "sst/core/statapi/stataccumulator.h"
+#include "sst/core/statapi/statapproxuniquecount.h"
+#include "sst/core/statapi/stathdrhistogram.h"
 #include "sst/core/statapi/stathistogram.h"
 #include "sst/core/statapi/statnull.h"
 #include "sst/core/statapi/statoutputcsv.h"
 #include "sst/core/statapi/statoutputjson.h"
 #include "sst/core/statapi/statoutputtxt.h"
+#include "sst/core/statapi/statquantilesketch.h"
 #include "sst/core/statapi/statuniquecount.h"
 
+#include <cmath>
+
 namespace SST {
 namespace Statistics {
 
@@ -35,8 +41,18 @@ StatisticBase::StatisticBase(
     m_statParams = statParams;
 
     initializeProperties();
+    initializeSampling(statParams);
 
     m_clearDataOnOutput = statParams.find<bool>("resetOnOutput", false);
+
+    // Only the base is counted, since the size of the collected data
+    // depends on the type
+    Core::MemoryAccounting::add(Core::MemoryAccounting::STATISTICS, sizeof(StatisticBase));
+}
+
+StatisticBase::~StatisticBase()
+{
+    Core::MemoryAccounting::add(Core::MemoryAccounting::STATISTICS, -(int64_t)sizeof(StatisticBase));
 }
 
 const std::vector<ElementInfoParam>&
@@ -49,6 +65,7 @@ StatisticBase::ELI_getParams()
 const std::string&
 StatisticBase::getCompName() const
 {
+    if ( !m_sharedName.empty() ) return m_sharedName;
     return m_component->getName();
 }
 
@@ -135,11 +152,79 @@ StatisticBase::initializeProperties()
     m_collectionDelayed        = false;
     m_savedStatEnabled         = true;
     m_savedOutputEnabled       = true;
+    m_sampleMode               = SAMPLE_ALL;
+    m_sampleInterval           = 1;
+    m_sampleSkip               = 0;
+    m_sampleRngState           = 0;
     m_outputDelayedHandler     = new OneShot::Handler<StatisticBase>(this, &StatisticBase::delayOutputExpiredHandler);
     m_collectionDelayedHandler =
         new OneShot::Handler<StatisticBase>(this, &StatisticBase::delayCollectionExpiredHandler);
 }
 
+void
+StatisticBase::initializeSampling(Params& statParams)
+{
+    std::string mode = statParams.find<std::string>("samplemode", "all");
+    m_sampleInterval = statParams.find<uint64_t>("sampleinterval", 1);
+    m_sampleRngState = statParams.find<uint64_t>("sampleseed", 1);
+
+    if ( mode == "all" ) { m_sampleMode = SAMPLE_ALL; }
+    else if ( mode == "interval" ) {
+        m_sampleMode = SAMPLE_INTERVAL;
+    }
+    else if ( mode == "random" ) {
+        m_sampleMode = SAMPLE_RANDOM;
+    }
+    else {
+        Simulation_impl::getSimulation()->getSimulationOutput().fatal(
+            CALL_INFO, 1, "Statistic %s - samplemode must be all, interval or random, not %s\n",
+            getFullStatName().c_str(), mode.c_str());
+    }
+    if ( 0 == m_sampleInterval ) {
+        Simulation_impl::getSimulation()->getSimulationOutput().fatal(
+            CALL_INFO, 1, "Statistic %s - sampleinterval must be at least 1\n", getFullStatName().c_str());
+    }
+
+    // Recording one value in every one is recording them all
+    if ( 1 == m_sampleInterval ) m_sampleMode = SAMPLE_ALL;
+
+    // The random mode starts at a random point, the interval mode at the first value
+    if ( m_sampleMode == SAMPLE_RANDOM ) scheduleNextSample();
+}
+
+void
+StatisticBase::scheduleNextSample()
+{
+    if ( m_sampleMode == SAMPLE_INTERVAL ) {
+        m_sampleSkip = m_sampleInterval - 1;
+        return;
+    }
+
+    // Recording each value with probability p leaves geometrically
+    // distributed gaps between the recorded values, so draw the gap
+    // once per recorded value instead of a random number per value.
+    // The uniform draw is a splitmix64 step, u is in (0, 1].
+    uint64_t z = (m_sampleRngState += 0x9e3779b97f4a7c15ULL);
+    z          = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z          = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    z ^= z >> 31;
+    double u     = ((z >> 11) + 1) * (1.0 / 9007199254740992.0);
+    m_sampleSkip = (uint64_t)std::floor(std::log(u) / std::log1p(-1.0 / m_sampleInterval));
+}
+
+uint64_t
+StatisticBase::countSamples(uint64_t N)
+{
+    uint64_t recorded = 0;
+    while ( N > m_sampleSkip ) {
+        N -= m_sampleSkip + 1;
+        recorded++;
+        scheduleNextSample();
+    }
+    m_sampleSkip -= N;
+    return recorded;
+}
+
 void
 StatisticBase::checkEventForOutput()
 {
@@ -203,6 +288,23 @@ StatisticBase::delayCollectionExpiredHandler()
     m_collectionDelayed = false;
 }
 
+void
+StatisticBase::serialize_order(SST::Core::Serialization::serializer& ser)
+{
+    // Only the state that changes while the simulation runs, the
+    // rest is set up again when the statistic is registered
+    ser& m_currentCollectionCount;
+    ser& m_outputCollectionCount;
+    ser& m_statEnabled;
+    ser& m_outputEnabled;
+    ser& m_outputDelayed;
+    ser& m_collectionDelayed;
+    ser& m_savedStatEnabled;
+    ser& m_savedOutputEnabled;
+    ser& m_sampleSkip;
+    ser& m_sampleRngState;
+}
+
 SST_ELI_INSTANTIATE_STATISTIC(AccumulatorStatistic, int32_t);
 SST_ELI_INSTANTIATE_STATISTIC(AccumulatorStatistic, uint32_t);
 SST_ELI_INSTANTIATE_STATISTIC(AccumulatorStatistic, int64_t);
@@ -217,6 +319,20 @@ SST_ELI_INSTANTIATE_STATISTIC(HistogramStatistic, uint64_t);
 SST_ELI_INSTANTIATE_STATISTIC(HistogramStatistic, float);
 SST_ELI_INSTANTIATE_STATISTIC(HistogramStatistic, double);
 
+SST_ELI_INSTANTIATE_STATISTIC(HdrHistogramStatistic, int32_t);
+SST_ELI_INSTANTIATE_STATISTIC(HdrHistogramStatistic, uint32_t);
+SST_ELI_INSTANTIATE_STATISTIC(HdrHistogramStatistic, int64_t);
+SST_ELI_INSTANTIATE_STATISTIC(HdrHistogramStatistic, uint64_t);
+SST_ELI_INSTANTIATE_STATISTIC(HdrHistogramStatistic, float);
+SST_ELI_INSTANTIATE_STATISTIC(HdrHistogramStatistic, double);
+
+SST_ELI_INSTANTIATE_STATISTIC(QuantileSketchStatistic, int32_t);
+SST_ELI_INSTANTIATE_STATISTIC(QuantileSketchStatistic, uint32_t);
+SST_ELI_INSTANTIATE_STATISTIC(QuantileSketchStatistic, int64_t);
+SST_ELI_INSTANTIATE_STATISTIC(QuantileSketchStatistic, uint64_t);
+SST_ELI_INSTANTIATE_STATISTIC(QuantileSketchStatistic, float);
+SST_ELI_INSTANTIATE_STATISTIC(QuantileSketchStatistic, double);
+
 SST_ELI_INSTANTIATE_STATISTIC(UniqueCountStatistic, int32_t);
 SST_ELI_INSTANTIATE_STATISTIC(UniqueCountStatistic, uint32_t);
 SST_ELI_INSTANTIATE_STATISTIC(UniqueCountStatistic, int64_t);
@@ -224,5 +340,12 @@ SST_ELI_INSTANTIATE_STATISTIC(UniqueCountStatistic, uint64_t);
 SST_ELI_INSTANTIATE_STATISTIC(UniqueCountStatistic, float);
 SST_ELI_INSTANTIATE_STATISTIC(UniqueCountStatistic, double);
 
+SST_ELI_INSTANTIATE_STATISTIC(ApproxUniqueCountStatistic, int32_t);
+SST_ELI_INSTANTIATE_STATISTIC(ApproxUniqueCountStatistic, uint32_t);
+SST_ELI_INSTANTIATE_STATISTIC(ApproxUniqueCountStatistic, int64_t);
+SST_ELI_INSTANTIATE_STATISTIC(ApproxUniqueCountStatistic, uint64_t);
+SST_ELI_INSTANTIATE_STATISTIC(ApproxUniqueCountStatistic, float);
+SST_ELI_INSTANTIATE_STATISTIC(ApproxUniqueCountStatistic, double);
+
 } // namespace Statistics
 } // namespace SST
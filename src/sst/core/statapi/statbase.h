@@ -22,6 +22,17 @@
 
 #include <string>
 
+/**
+ * Statistics collected through Statistic<T>::addDataAtLevel() with an
+ * enable level above SST_STATISTICS_COMPILE_LEVEL compile to nothing.
+ * Define it (e.g. -DSST_STATISTICS_COMPILE_LEVEL=2) when building an
+ * element library to remove the cost of its detailed statistics
+ * entirely.  By default no statistics are compiled out.
+ */
+#ifndef SST_STATISTICS_COMPILE_LEVEL
+#define SST_STATISTICS_COMPILE_LEVEL 255
+#endif
+
 namespace SST {
 class BaseComponent;
 class Factory;
@@ -58,6 +69,15 @@ public:
     gathered and processed into various (extensible) output forms. Statistics
     are expected to be named so that they can be located in the simulation
     output files.
+
+    A statistic can record a sample of the values presented to it instead
+    of all of them, set by the "samplemode" parameter:
+        all      - Record every value (default)
+        interval - Record every "sampleinterval"th value, starting with the first
+        random   - Record each value with probability 1 / "sampleinterval",
+                   seeded by "sampleseed" (default 1)
+    Skipped values are not counted in the collection count, so the count
+    and count based output see only the recorded values.
 */
 
 class StatisticBase
@@ -66,6 +86,9 @@ public:
     /** Statistic collection mode */
     typedef enum { STAT_MODE_UNDEFINED, STAT_MODE_COUNT, STAT_MODE_PERIODIC, STAT_MODE_DUMP_AT_END } StatMode_t;
 
+    /** Statistic sampling mode */
+    typedef enum { SAMPLE_ALL, SAMPLE_INTERVAL, SAMPLE_RANDOM } SampleMode_t;
+
     // Enable/Disable of Statistic
     /** Enable Statistic for collections */
     void enable() { m_statEnabled = true; }
@@ -109,7 +132,7 @@ public:
     void setFlagOutputAtEndOfSim(bool flag) { m_outputAtEndOfSim = flag; }
 
     // Get Data & Information on Statistic
-    /** Return the Component Name */
+    /** Return the Component Name, or the shared name for a shared statistic */
     const std::string& getCompName() const;
 
     /** Return the Statistic Name */
@@ -166,6 +189,12 @@ public:
     /** Return the collection mode that is registered */
     StatMode_t getRegisteredCollectionMode() const { return m_registeredCollectionMode; }
 
+    /** Return the sampling mode */
+    SampleMode_t getSampleMode() const { return m_sampleMode; }
+
+    /** Return the sampling interval */
+    uint64_t getSampleInterval() const { return m_sampleInterval; }
+
     // Delay Methods (Uses OneShot to disable Statistic or Collection)
     /** Delay the statistic from outputting data for a specified delay time
      * @param delayTime - Value in UnitAlgebra format for delay (i.e. 10ns).
@@ -201,7 +230,7 @@ protected:
     StatisticBase(BaseComponent* comp, const std::string& statName, const std::string& statSubId, Params& statParams);
 
     // Destructor
-    virtual ~StatisticBase() {}
+    virtual ~StatisticBase();
 
     /** Return the Statistic Parameters */
     Params& getParams() { return m_statParams; }
@@ -212,6 +241,43 @@ protected:
     /** Set an optional Statistic Type Name */
     void setStatisticTypeName(const char* typeName) { m_statTypeName = typeName; }
 
+    /** Save or restore the collected data of the statistic for a
+     * checkpoint.  Statistics that hold data must call this version
+     * and then serialize their own data.
+     * @param ser - The serializer used to save or restore the data
+     */
+    virtual void serialize_order(SST::Core::Serialization::serializer& ser);
+
+    /** Indicate if the Statistic can be shared with the "sharedname"
+     * parameter.  Statistics that return true must implement
+     * mergeStatisticData().
+     */
+    virtual bool isMergeable() const { return false; }
+
+    /** Add the data collected by another statistic into this one.
+     * Used to combine the per component copies of a shared statistic.
+     * @param other - Statistic of the same type and data type
+     */
+    virtual void mergeStatisticData(StatisticBase* UNUSED(other)) {}
+
+    /** Indicate if the next value presented to the Statistic should be
+     * recorded under the sampling mode
+     */
+    bool isSampled()
+    {
+        if ( m_sampleSkip != 0 ) {
+            --m_sampleSkip;
+            return false;
+        }
+        if ( m_sampleMode != SAMPLE_ALL ) scheduleNextSample();
+        return true;
+    }
+
+    /** Return how many of the next N values presented to the Statistic
+     * should be recorded under the sampling mode
+     */
+    uint64_t getSampledCount(uint64_t N) { return m_sampleMode == SAMPLE_ALL ? N : countSamples(N); }
+
 private:
     friend class SST::BaseComponent;
 
@@ -252,8 +318,13 @@ private:
     void initializeStatName(const std::string& compName, const std::string& statName, const std::string& statSubId);
 
     void initializeProperties();
+    void initializeSampling(Params& statParams);
     void checkEventForOutput();
 
+    // Sampling:
+    void     scheduleNextSample();
+    uint64_t countSamples(uint64_t N);
+
     // OneShot Callbacks:
     void delayOutputExpiredHandler();     // Enable Output in handler
     void delayCollectionExpiredHandler(); // Enable Collection in Handler
@@ -270,6 +341,7 @@ private:
     std::string                     m_statSubId;
     std::string                     m_statFullName;
     std::string                     m_statTypeName;
+    std::string                     m_sharedName;
     Params                          m_statParams;
     StatMode_t                      m_registeredCollectionMode;
     uint64_t                        m_currentCollectionCount;
@@ -283,6 +355,11 @@ private:
     bool m_clearDataOnOutput;
     bool m_outputAtEndOfSim;
 
+    SampleMode_t m_sampleMode;
+    uint64_t     m_sampleInterval;
+    uint64_t     m_sampleSkip;
+    uint64_t     m_sampleRngState;
+
     bool                  m_outputDelayed;
     bool                  m_collectionDelayed;
     bool                  m_savedStatEnabled;
@@ -379,7 +456,7 @@ public:
     {
         // Call the Derived Statistic's implementation
         //  of addData and increment the count
-        if ( isEnabled() ) {
+        if ( isEnabled() && isSampled() ) {
             addData_impl(std::forward<InArgs>(args)...);
             incrementCollectionCount(1);
         }
@@ -391,11 +468,30 @@ public:
         // Call the Derived Statistic's implementation
         //  of addData and increment the count
         if ( isEnabled() ) {
-            addData_impl_Ntimes(N, std::forward<InArgs>(args)...);
-            incrementCollectionCount(N);
+            uint64_t sampled = getSampledCount(N);
+            if ( sampled == 0 ) return;
+            addData_impl_Ntimes(sampled, std::forward<InArgs>(args)...);
+            incrementCollectionCount(sampled);
         }
     }
 
+    /** Add data to a Statistic with the given enable level
+     * Level should match the enable level in the ELI documentation of the
+     * statistic.  If it is above SST_STATISTICS_COMPILE_LEVEL, the call is
+     * removed at compile time; otherwise it is the same as addData().
+     */
+    template <uint8_t Level, class... InArgs>
+    void addDataAtLevel(InArgs&&... args)
+    {
+        if constexpr ( Level <= SST_STATISTICS_COMPILE_LEVEL ) { addData(std::forward<InArgs>(args)...); }
+    }
+
+    template <uint8_t Level, class... InArgs>
+    void addDataNTimesAtLevel(uint64_t N, InArgs&&... args)
+    {
+        if constexpr ( Level <= SST_STATISTICS_COMPILE_LEVEL ) { addDataNTimes(N, std::forward<InArgs>(args)...); }
+    }
+
     static fieldType_t fieldId() { return StatisticFieldType<T>::id(); }
 
 protected:
@@ -26,12 +26,16 @@
 #include "sst/core/warnmacros.h"
 
 #include <algorithm>
+#include <numeric>
 #include <string>
+#include <typeinfo>
 
 namespace SST {
 namespace Statistics {
 
-std::vector<StatisticOutput*> StatisticProcessingEngine::m_statOutputs;
+std::vector<StatisticOutput*>                      StatisticProcessingEngine::m_statOutputs;
+std::map<std::string, std::vector<StatisticBase*>> StatisticProcessingEngine::m_sharedStats;
+std::mutex                                         StatisticProcessingEngine::m_sharedStatsLock;
 
 StatisticProcessingEngine::StatisticProcessingEngine() : m_output(Output::getDefaultObject()) {}
 
@@ -50,13 +54,43 @@ StatisticProcessingEngine::stat_outputs_simulation_start()
 {
     for ( auto& so : m_statOutputs ) {
         so->startOfSimulation();
+        so->startAsyncOutput();
+        so->startEndOfSimOutput();
+    }
+}
+
+void
+StatisticProcessingEngine::addIndexToOutputFiles(size_t index)
+{
+    for ( auto& so : m_statOutputs ) {
+        Params& params = so->getOutputParameters();
+        if ( !params.contains("filepath") ) continue;
+
+        // Add it before the extension, if there is one
+        std::string file = params.find<std::string>("filepath");
+        size_t      dot  = file.find_last_of(".");
+        if ( dot == std::string::npos ) dot = file.size();
+        file.insert(dot, std::to_string(index));
+        params.insert("filepath", file);
+
+        // The outputs read their parameters when they are checked
+        so->checkOutputParameters();
     }
 }
 
 void
 StatisticProcessingEngine::stat_outputs_simulation_end()
 {
+    // The threads' own output goes first, as it did when they wrote it
+    // as they finished
     for ( auto& so : m_statOutputs ) {
+        so->finishEndOfSimOutput();
+    }
+
+    outputSharedStatistics();
+
+    for ( auto& so : m_statOutputs ) {
+        so->stopAsyncOutput();
         so->endOfSimulation();
     }
 }
@@ -67,8 +101,9 @@ StatisticProcessingEngine::setup(Simulation_impl* sim, ConfigGraph* graph)
 {
     m_sim = sim;
 
-    m_SimulationStarted = false;
-    m_statLoadLevel     = graph->getStatLoadLevel();
+    m_SimulationStarted   = false;
+    m_periodicClockFactor = 0;
+    m_statLoadLevel       = graph->getStatLoadLevel();
 
     m_defaultGroup.output = m_statOutputs[0];
     for ( auto& cfg : graph->getStatGroups() ) {
@@ -107,6 +142,9 @@ StatisticProcessingEngine::registerStatisticCore(StatisticBase* stat)
         return false;
     }
 
+    std::string sharedName = stat->m_statParams.find<std::string>("sharedname", "");
+    if ( !sharedName.empty() ) return addSharedStatistic(sharedName, stat);
+
     StatisticGroup& group = getGroupForStatistic(stat);
     if ( group.isDefault ) {
         // If the mode is Periodic Based, the add the statistic to the
@@ -175,6 +213,23 @@ StatisticProcessingEngine::registerStatisticCore(StatisticBase* stat)
 void
 StatisticProcessingEngine::finalizeInitialization()
 {
+    // Periodic Based Statistics can't be registered after wire up, so
+    // all the rates are known and one clock can serve all of them
+    for ( auto& it_m : m_PeriodicStatisticMap ) {
+        m_periodicClockFactor = std::gcd(m_periodicClockFactor, it_m.first);
+    }
+    if ( 0 != m_periodicClockFactor ) {
+        // Set the clock priority so that normal clocks events will occur before
+        // this clock event.
+        TimeLord*      timeLord = Simulation_impl::getTimeLord();
+        TimeConverter* tcPeriod = timeLord->getTimeConverter(timeLord->getTimeBase() * m_periodicClockFactor);
+        Simulation_impl::getSimulation()->registerClock(
+            tcPeriod,
+            new Clock::SkipHandler<StatisticProcessingEngine>(
+                this, &StatisticProcessingEngine::handlePeriodicClockEvent),
+            STATISTICCLOCKPRIORITY);
+    }
+
     for ( auto& g : m_statGroups ) {
         g.output->registerGroup(&g);
 
@@ -287,30 +342,81 @@ StatisticProcessingEngine::addEndOfSimStatistic(StatisticBase* /*stat*/)
 }
 
 bool
-StatisticProcessingEngine::addPeriodicBasedStatistic(const UnitAlgebra& freq, StatisticBase* stat)
+StatisticProcessingEngine::addSharedStatistic(const std::string& sharedName, StatisticBase* stat)
 {
-    Simulation_impl*    sim      = Simulation_impl::getSimulation();
-    TimeConverter*      tcFreq   = sim->getTimeLord()->getTimeConverter(freq);
-    SimTime_t           tcFactor = tcFreq->getFactor();
-    Clock::HandlerBase* ClockHandler;
-    StatArray_t*        statArray;
+    if ( !stat->isMergeable() ) {
+        m_output.fatal(
+            CALL_INFO, 1, "ERROR: Statistic %s - Statistics of type %s cannot be shared\n",
+            stat->getFullStatName().c_str(), stat->getStatTypeName().c_str());
+    }
+    if ( !getGroupForStatistic(stat).isDefault ) {
+        m_output.fatal(
+            CALL_INFO, 1, "ERROR: Statistic %s - Shared statistics cannot be in a statistic group\n",
+            stat->getFullStatName().c_str());
+    }
+    if ( stat->m_statParams.find<SST::UnitAlgebra>("rate", "0ns").getValue() != 0 ) {
+        m_output.fatal(
+            CALL_INFO, 1,
+            "ERROR: Statistic %s - Shared statistics are only output at the end of simulation and cannot set a "
+            "rate\n",
+            stat->getFullStatName().c_str());
+    }
+    if ( true == Simulation_impl::getSimulation()->isWireUpFinished() ) {
+        m_output.fatal(
+            CALL_INFO, 1, "ERROR: Statistic %s - Shared statistics must be registered on Component creation\n",
+            stat->getFullStatName().c_str());
+    }
 
-    // See if the map contains an entry for this factor
-    if ( m_PeriodicStatisticMap.find(tcFactor) == m_PeriodicStatisticMap.end() ) {
+    // Components on all threads register their copies
+    std::lock_guard<std::mutex> lock(m_sharedStatsLock);
+    auto&                       copies = m_sharedStats[sharedName];
+    if ( !copies.empty() && typeid(*copies.front()) != typeid(*stat) ) {
+        m_output.fatal(
+            CALL_INFO, 1,
+            "ERROR: Statistic %s - Statistics shared as %s must all have the same type and data type\n",
+            stat->getFullStatName().c_str(), sharedName.c_str());
+    }
+
+    // The merged statistic is output under the shared name
+    stat->m_sharedName   = sharedName;
+    stat->m_statFullName = StatisticBase::buildStatisticFullName(sharedName, stat->getStatName(), stat->getStatSubId());
+    m_defaultGroup.addStatistic(stat);
+    if ( copies.empty() ) { getOutputForStatistic(stat)->registerStatistic(stat); }
+    copies.push_back(stat);
 
-        // Check to see if the freq is zero.  Only add a new clock if the freq is non zero
-        if ( 0 != freq.getValue() ) {
+    setStatisticStartTime(stat);
+    setStatisticStopTime(stat);
 
-            // This tcFactor is not found in the map, so create a new clock handler.
-            ClockHandler = new Clock::Handler<StatisticProcessingEngine, SimTime_t>(
-                this, &StatisticProcessingEngine::handleStatisticEngineClockEvent, tcFactor);
+    return true;
+}
 
-            // Set the clock priority so that normal clocks events will occur before
-            // this clock event.
-            sim->registerClock(freq, ClockHandler, STATISTICCLOCKPRIORITY);
+void
+StatisticProcessingEngine::outputSharedStatistics()
+{
+    // Called on one thread once all the threads have finished, so the
+    // copies can be read without locking
+    for ( auto& shared : m_sharedStats ) {
+        StatisticBase* stat = shared.second.front();
+        for ( size_t i = 1; i < shared.second.size(); ++i ) {
+            stat->mergeStatisticData(shared.second[i]);
         }
+        if ( stat->isOutputEnabled() ) { stat->getGroup()->output->output(stat, true); }
+    }
+    m_sharedStats.clear();
+}
+
+bool
+StatisticProcessingEngine::addPeriodicBasedStatistic(const UnitAlgebra& freq, StatisticBase* stat)
+{
+    Simulation_impl* sim      = Simulation_impl::getSimulation();
+    TimeConverter*   tcFreq   = sim->getTimeLord()->getTimeConverter(freq);
+    SimTime_t        tcFactor = tcFreq->getFactor();
+    StatArray_t*     statArray;
 
-        // Also create a new Array of Statistics and relate it to the map
+    // See if the map contains an entry for this factor.  A zero freq
+    // has a zero factor, and is never output by the periodic clock
+    if ( m_PeriodicStatisticMap.find(tcFactor) == m_PeriodicStatisticMap.end() ) {
+        // Create a new Array of Statistics and relate it to the map
         statArray                        = new std::vector<StatisticBase*>();
         m_PeriodicStatisticMap[tcFactor] = statArray;
     }
@@ -318,7 +424,7 @@ StatisticProcessingEngine::addPeriodicBasedStatistic(const UnitAlgebra& freq, St
     // The Statistic Map has the time factor registered.
     statArray = m_PeriodicStatisticMap[tcFactor];
 
-    // Add the statistic to the lists of statistics to be called when the clock fires.
+    // Add the statistic to the lists of statistics to be output when the rate is due.
     statArray->push_back(stat);
 
     return true;
@@ -466,6 +572,7 @@ StatisticProcessingEngine::performStatisticGroupOutputImpl(StatisticGroup& group
     // Has the simulation started?
     if ( true == m_SimulationStarted ) {
 
+        group.reduceStatistics();
         statOutput->outputGroup(&group, endOfSimFlag);
 
         if ( false == endOfSimFlag ) {
@@ -507,25 +614,28 @@ StatisticProcessingEngine::performGlobalStatisticOutput(bool endOfSimFlag /*=fal
     }
 }
 
-bool
-StatisticProcessingEngine::handleStatisticEngineClockEvent(Cycle_t UNUSED(CycleNum), SimTime_t timeFactor)
+Cycle_t
+StatisticProcessingEngine::handlePeriodicClockEvent(Cycle_t UNUSED(CycleNum))
 {
-    StatArray_t*   statArray;
-    StatisticBase* stat;
-    unsigned int   x;
-
-    // Get the array for the timeFactor
-    statArray = m_PeriodicStatisticMap[timeFactor];
-
-    // Walk the array, and call the output method of each statistic
-    for ( x = 0; x < statArray->size(); x++ ) {
-        stat = statArray->at(x);
-
-        // Perform the output
-        performStatisticOutputImpl(stat, false);
+    SimTime_t now  = m_sim->getCurrentSimCycle();
+    SimTime_t next = MAX_SIMTIME_T;
+
+    // Rates that are due together are output longest first, which is
+    // the order they had when each rate had a clock of its own
+    for ( auto it_m = m_PeriodicStatisticMap.rbegin(); it_m != m_PeriodicStatisticMap.rend(); ++it_m ) {
+        SimTime_t timeFactor = it_m->first;
+        if ( 0 == timeFactor ) continue;
+
+        if ( 0 == now % timeFactor ) {
+            for ( StatisticBase* stat : *it_m->second ) {
+                performStatisticOutputImpl(stat, false);
+            }
+        }
+        next = std::min(next, (now / timeFactor + 1) * timeFactor);
     }
-    // Return false to keep the clock going
-    return false;
+
+    // Skip ahead to the next cycle a rate is due on
+    return next / m_periodicClockFactor;
 }
 
 bool
@@ -594,7 +704,7 @@ StatisticProcessingEngine::isStatisticInCompStatMap(
     for ( StatArray_t::iterator it_v = statArray->begin(); it_v != statArray->end(); it_v++ ) {
         TestStat = *it_v;
 
-        if ( (TestStat->getCompName() == compName) && (TestStat->getStatName() == statName) &&
+        if ( (TestStat->getComponent()->getName() == compName) && (TestStat->getStatName() == statName) &&
              (TestStat->getStatSubId() == statSubId) && (TestStat->getStatDataType() == fieldType) ) {
             return TestStat;
         }
@@ -23,6 +23,11 @@
 #include "sst/core/threadsafe.h"
 #include "sst/core/unitAlgebra.h"
 
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
 /* Forward declare for Friendship */
 extern int  main(int argc, char** argv);
 extern void finalize_statEngineConfig(void);
@@ -46,6 +51,17 @@ class StatisticOutput;
 
     An SST core component that handles timing and event processing informing
     all registered Statistics to generate their outputs at desired rates.
+
+    Periodic Based Statistics of all rates are output by one clock.  It
+    ticks at the greatest common divisor of the rates and skips ahead to
+    the next tick that one of the rates is due on.
+
+    Statistics enabled with a "sharedname" parameter are shared by all
+    the components on the rank that use that name, whichever thread
+    they run on.  Each component still updates its own copy, so adding
+    data takes no locks.  The copies are only merged at the end of
+    simulation, after all threads are done, and are output as one
+    statistic that has the shared name as its component name.
 */
 
 class StatisticProcessingEngine
@@ -94,6 +110,13 @@ public:
      */
     static void stat_outputs_simulation_end();
 
+    /** Add index to the name of the file of each StatOutput that has a
+       filepath parameter.  Used by the runs of an ensemble that are
+       forked after the StatOutputs are created, before they have
+       opened their files.
+     */
+    static void addIndexToOutputFiles(size_t index);
+
 private:
     friend class SST::Simulation_impl;
     friend int ::main(int argc, char** argv);
@@ -112,6 +135,7 @@ private:
     bool             addPeriodicBasedStatistic(const UnitAlgebra& freq, StatisticBase* Stat);
     bool             addEventBasedStatistic(const UnitAlgebra& count, StatisticBase* Stat);
     bool             addEndOfSimStatistic(StatisticBase* Stat);
+    bool             addSharedStatistic(const std::string& sharedName, StatisticBase* stat);
     UnitAlgebra      getParamTime(StatisticBase* stat, const std::string& pName) const;
     void             setStatisticStartTime(StatisticBase* Stat);
     void             setStatisticStopTime(StatisticBase* Stat);
@@ -120,10 +144,12 @@ private:
     void startOfSimulation();
     void endOfSimulation();
 
+    static void outputSharedStatistics();
+
     void performStatisticOutputImpl(StatisticBase* stat, bool endOfSimFlag);
     void performStatisticGroupOutputImpl(StatisticGroup& group, bool endOfSimFlag);
 
-    bool           handleStatisticEngineClockEvent(Cycle_t CycleNum, SimTime_t timeFactor);
+    Cycle_t        handlePeriodicClockEvent(Cycle_t CycleNum);
     bool           handleGroupClockEvent(Cycle_t CycleNum, StatisticGroup* group);
     void           handleStatisticEngineStartTimeEvent(SimTime_t timeFactor);
     void           handleStatisticEngineStopTimeEvent(SimTime_t timeFactor);
@@ -140,6 +166,7 @@ private:
 
     StatArray_t   m_EventStatisticArray;  /*!< Array of Event Based Statistics */
     StatMap_t     m_PeriodicStatisticMap; /*!< Map of Array's of Periodic Based Statistics */
+    SimTime_t     m_periodicClockFactor;  /*!< Factor of the clock that outputs all Periodic Based Statistics */
     StatMap_t     m_StartTimeMap;         /*!< Map of Array's of Statistics that are started at a sim time */
     StatMap_t     m_StopTimeMap;          /*!< Map of Array's of Statistics that are stopped at a sim time */
     CompStatMap_t m_CompStatMap;          /*!< Map of Arrays of Statistics tied to Component Id's */
@@ -153,6 +180,11 @@ private:
 
     // Outputs are per MPI rank, so have to be static data
     static std::vector<StatisticOutput*> m_statOutputs;
+
+    /** Copies of each shared statistic, keyed by shared name.  The
+     * first copy registered is the one that is output. */
+    static std::map<std::string, std::vector<StatisticBase*>> m_sharedStats;
+    static std::mutex                                         m_sharedStatsLock;
 };
 
 } // namespace Statistics
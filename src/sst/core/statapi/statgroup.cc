@@ -22,6 +22,7 @@
 #include "sst/core/statapi/statoutput.h"
 
 #include <algorithm>
+#include <typeinfo>
 
 namespace SST {
 namespace Statistics {
@@ -31,6 +32,7 @@ StatisticGroup::StatisticGroup(const ConfigStatGroup& csg, StatisticProcessingEn
     name(csg.name),
     output(const_cast<StatisticOutput*>(engine->getStatOutputs()[csg.outputID])),
     outputFreq(csg.outputFrequency),
+    reduce(csg.reduce),
     components(csg.components)
 {
 
@@ -50,7 +52,11 @@ bool
 StatisticGroup::containsStatistic(const StatisticBase* stat) const
 {
     if ( isDefault ) return true;
-    return std::find(stats.begin(), stats.end(), stat) != stats.end();
+    if ( std::find(stats.begin(), stats.end(), stat) != stats.end() ) return true;
+    for ( auto& reduced : reducedStats ) {
+        if ( reduced.first == stat ) return true;
+    }
+    return false;
 }
 
 bool
@@ -68,8 +74,46 @@ StatisticGroup::claimsStatistic(const StatisticBase* stat) const
 void
 StatisticGroup::addStatistic(StatisticBase* stat)
 {
-    stats.push_back(stat);
     stat->setGroup(this);
+    if ( !reduce ) {
+        stats.push_back(stat);
+        return;
+    }
+
+    if ( !stat->isMergeable() ) {
+        Output::getDefaultObject().fatal(
+            CALL_INFO, 1, "ERROR: Statistic %s - Statistics of type %s cannot be reduced in statistic group %s\n",
+            stat->getFullStatName().c_str(), stat->getStatTypeName().c_str(), name.c_str());
+    }
+
+    // The first copy of each statistic is output for the whole group
+    for ( auto* target : stats ) {
+        if ( target->getStatName() != stat->getStatName() || target->getStatSubId() != stat->getStatSubId() )
+            continue;
+        if ( typeid(*target) != typeid(*stat) ) {
+            Output::getDefaultObject().fatal(
+                CALL_INFO, 1,
+                "ERROR: Statistic %s - Statistics reduced in statistic group %s must all have the same type and data "
+                "type\n",
+                stat->getFullStatName().c_str(), name.c_str());
+        }
+        reducedStats.emplace_back(stat, target);
+        return;
+    }
+
+    stat->m_sharedName   = name;
+    stat->m_statFullName = StatisticBase::buildStatisticFullName(name, stat->getStatName(), stat->getStatSubId());
+    stats.push_back(stat);
+}
+
+void
+StatisticGroup::reduceStatistics()
+{
+    for ( auto& reduced : reducedStats ) {
+        reduced.second->mergeStatisticData(reduced.first);
+        reduced.first->clearStatisticData();
+        reduced.first->setCollectionCount(0);
+    }
 }
 
 } // namespace Statistics
@@ -16,6 +16,7 @@
 #include "sst/core/unitAlgebra.h"
 
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace SST {
@@ -28,21 +29,31 @@ class StatisticProcessingEngine;
 class StatisticGroup
 {
 public:
-    StatisticGroup() : isDefault(true), name("default") {};
+    StatisticGroup() : isDefault(true), name("default"), reduce(false) {};
     StatisticGroup(const ConfigStatGroup& csg, StatisticProcessingEngine* engine);
 
     bool containsStatistic(const StatisticBase* stat) const;
     bool claimsStatistic(const StatisticBase* stat) const;
     void addStatistic(StatisticBase* stat);
 
+    /**
+     * Merge the data of each reduced statistic into the statistic that
+     * is output for it, and clear the reduced statistic
+     */
+    void reduceStatistics();
+
     bool             isDefault;
     std::string      name;
     StatisticOutput* output;
     UnitAlgebra      outputFreq;
+    bool             reduce;
 
     std::vector<ComponentId_t>  components;
     std::vector<std::string>    statNames;
     std::vector<StatisticBase*> stats;
+
+    /** Statistics that are only output merged into another one of stats */
+    std::vector<std::pair<StatisticBase*, StatisticBase*>> reducedStats;
 };
 
 } // namespace Statistics
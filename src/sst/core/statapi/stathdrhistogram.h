@@ -0,0 +1,357 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_STATAPI_STATHDRHISTOGRAM_H
+#define SST_CORE_STATAPI_STATHDRHISTOGRAM_H
+
+#include "sst/core/output.h"
+#include "sst/core/sst_types.h"
+#include "sst/core/statapi/statbase.h"
+#include "sst/core/statapi/statoutput.h"
+#include "sst/core/warnmacros.h"
+
+#include <sstream>
+#include <type_traits>
+#include <vector>
+
+namespace SST {
+class BaseComponent;
+namespace Statistics {
+
+/**
+    \class HdrHistogramStatistic
+
+    Histogram with log-linear buckets, in the style of HdrHistogram, for
+    data such as latencies that span several orders of magnitude.
+
+    Values are grouped by their highest set bit, and each of those
+    groups is split into linear sub-buckets, so that every value is
+    kept to the given number of significant decimal digits.  Values
+    below 2 * 10^precision are counted exactly.  Adding a value is a
+    count-leading-zeros, a shift and an increment, and the bucket array
+    only grows as far as the largest value seen, so shared copies merge
+    in time proportional to the range they actually saw.
+
+    Only non-negative values can be recorded.  Floating point values
+    are truncated to integers, so the data should be in the units that
+    the precision applies to (e.g. ns).  Negative values and values
+    above maxvalue are counted as out of bounds.
+
+    Instead of every bucket, the output has the count, min, max, mean
+    and the 50th, 90th, 99th and 99.9th percentiles.  A percentile is
+    the highest value of the bucket it falls in, so it is within the
+    precision of the true value.  The buckets can be dumped as well, up
+    to maxvalue.
+
+    @tparam T A template for holding the main data type of this statistic
+*/
+
+template <typename T>
+class HdrHistogramStatistic : public Statistic<T>
+{
+public:
+    SST_ELI_DECLARE_STATISTIC_TEMPLATE(
+        HdrHistogramStatistic,
+        "sst",
+        "HdrHistogramStatistic",
+        SST_ELI_ELEMENT_VERSION(1, 0, 0),
+        "Track distribution of statistic across log-linear buckets",
+        "SST::Statistic<T>")
+
+    HdrHistogramStatistic(
+        BaseComponent* comp, const std::string& statName, const std::string& statSubId, Params& statParams) :
+        Statistic<T>(comp, statName, statSubId, statParams)
+    {
+        // Identify what keys are Allowed in the parameters
+        Params::KeySet_t allowedKeySet;
+        allowedKeySet.insert("precision");
+        allowedKeySet.insert("maxvalue");
+        allowedKeySet.insert("dumpbinsonoutput");
+        allowedKeySet.insert("includeoutofbounds");
+        statParams.pushAllowedKeys(allowedKeySet);
+
+        precision            = statParams.find<uint32_t>("precision", 2);
+        maxValue             = statParams.find<uint64_t>("maxvalue", 1000000000000ULL);
+        m_dumpBinsOnOutput   = statParams.find<bool>("dumpbinsonoutput", false);
+        m_includeOutOfBounds = statParams.find<bool>("includeoutofbounds", true);
+        if ( precision < 1 || precision > 5 ) {
+            Output::getDefaultObject().fatal(
+                CALL_INFO, 1, "HdrHistogramStatistic %s: precision must be between 1 and 5, got %" PRIu32 "\n",
+                statName.c_str(), precision);
+        }
+
+        // Enough linear sub-buckets in each group to tell apart values
+        // that differ in the last significant digit
+        uint64_t needed = 2;
+        for ( uint32_t i = 0; i < precision; ++i )
+            needed *= 10;
+        subBucketHalfMagnitude = 0;
+        while ( (uint64_t(2) << subBucketHalfMagnitude) < needed )
+            subBucketHalfMagnitude++;
+
+        clearStatisticData();
+
+        // Set the Name of this Statistic
+        this->setStatisticTypeName("HdrHistogram");
+    }
+
+    ~HdrHistogramStatistic() {}
+
+protected:
+    /**
+        Adds a new value to the histogram.  Values that can't be
+        recorded are only counted as out of bounds.
+    */
+    void addData_impl_Ntimes(uint64_t N, T value) override
+    {
+        if constexpr ( std::is_signed<T>::value ) {
+            if ( value < 0 ) {
+                m_OOBMinCount += N;
+                return;
+            }
+        }
+        // Floating point values are checked before the conversion,
+        // which could overflow
+        if constexpr ( std::is_floating_point<T>::value ) {
+            if ( value > (double)maxValue ) {
+                m_OOBMaxCount += N;
+                return;
+            }
+        }
+        uint64_t v = (uint64_t)value;
+        if ( v > maxValue ) {
+            m_OOBMaxCount += N;
+            return;
+        }
+
+        size_t index = getIndex(v);
+        if ( index >= m_counts.size() ) m_counts.resize(index + 1, 0);
+        m_counts[index] += N;
+
+        if ( m_itemsRecordedCount == 0 || v < m_minRecorded ) m_minRecorded = v;
+        if ( v > m_maxRecorded ) m_maxRecorded = v;
+        m_totalSummed += (double)N * v;
+        m_itemsRecordedCount += N;
+    }
+
+    void addData_impl(T value) override { addData_impl_Ntimes(1, value); }
+
+private:
+    /** Index of the bucket holding a value */
+    size_t getIndex(uint64_t value) const
+    {
+        // The group is the position of the highest set bit above the
+        // first two groups, which share the smallest bucket width
+        uint64_t subBucketMask = (uint64_t(2) << subBucketHalfMagnitude) - 1;
+        uint32_t group         = 63 - __builtin_clzll(value | subBucketMask) - subBucketHalfMagnitude;
+        uint64_t subBucket     = value >> group;
+        return ((size_t)(group + 1) << subBucketHalfMagnitude) + (subBucket - (uint64_t(1) << subBucketHalfMagnitude));
+    }
+
+    /** Smallest value that goes in a bucket */
+    uint64_t getLowestValue(size_t index) const
+    {
+        uint64_t half      = uint64_t(1) << subBucketHalfMagnitude;
+        int64_t  group     = (int64_t)(index >> subBucketHalfMagnitude) - 1;
+        uint64_t subBucket = (index & (half - 1)) + half;
+        if ( group < 0 ) {
+            subBucket -= half;
+            group = 0;
+        }
+        return subBucket << group;
+    }
+
+    /** Largest value that goes in a bucket */
+    uint64_t getHighestValue(size_t index) const
+    {
+        int64_t group = (int64_t)(index >> subBucketHalfMagnitude) - 1;
+        if ( group < 0 ) group = 0;
+        return getLowestValue(index) + (uint64_t(1) << group) - 1;
+    }
+
+    void clearStatisticData() override
+    {
+        // Keep the allocation, the range seen is likely to be the same
+        m_counts.clear();
+        m_OOBMinCount        = 0;
+        m_OOBMaxCount        = 0;
+        m_itemsRecordedCount = 0;
+        m_minRecorded        = 0;
+        m_maxRecorded        = 0;
+        m_totalSummed        = 0;
+        this->setCollectionCount(0);
+    }
+
+    /** Shared histograms must all use the same precision */
+    bool isMergeable() const override { return true; }
+
+    void mergeStatisticData(StatisticBase* other) override
+    {
+        auto* stat = static_cast<HdrHistogramStatistic<T>*>(other);
+        if ( stat->precision != precision || stat->maxValue != maxValue ) {
+            Output::getDefaultObject().fatal(
+                CALL_INFO, 1, "ERROR: Shared histogram %s - All copies must have the same precision and maxvalue\n",
+                this->getFullStatName().c_str());
+        }
+
+        if ( stat->m_counts.size() > m_counts.size() ) m_counts.resize(stat->m_counts.size(), 0);
+        for ( size_t i = 0; i < stat->m_counts.size(); ++i ) {
+            m_counts[i] += stat->m_counts[i];
+        }
+
+        if ( stat->m_itemsRecordedCount != 0 ) {
+            if ( m_itemsRecordedCount == 0 || stat->m_minRecorded < m_minRecorded ) m_minRecorded = stat->m_minRecorded;
+            if ( stat->m_maxRecorded > m_maxRecorded ) m_maxRecorded = stat->m_maxRecorded;
+        }
+        m_OOBMinCount += stat->m_OOBMinCount;
+        m_OOBMaxCount += stat->m_OOBMaxCount;
+        m_itemsRecordedCount += stat->m_itemsRecordedCount;
+        m_totalSummed += stat->m_totalSummed;
+        this->setCollectionCount(this->getCollectionCount() + stat->getCollectionCount());
+    }
+
+    void registerOutputFields(StatisticFieldsOutput* statOutput) override
+    {
+        m_Fields.push_back(statOutput->registerField<uint64_t>("NumItemsCollected"));
+        m_Fields.push_back(statOutput->registerField<uint64_t>("NumItemsRecorded"));
+        m_Fields.push_back(statOutput->registerField<uint64_t>("Min"));
+        m_Fields.push_back(statOutput->registerField<uint64_t>("Max"));
+        m_Fields.push_back(statOutput->registerField<double>("Mean"));
+        m_Fields.push_back(statOutput->registerField<uint64_t>("P50"));
+        m_Fields.push_back(statOutput->registerField<uint64_t>("P90"));
+        m_Fields.push_back(statOutput->registerField<uint64_t>("P99"));
+        m_Fields.push_back(statOutput->registerField<uint64_t>("P999"));
+
+        if ( true == m_includeOutOfBounds ) {
+            m_Fields.push_back(statOutput->registerField<uint64_t>("NumOutOfBounds-MinValue"));
+            m_Fields.push_back(statOutput->registerField<uint64_t>("NumOutOfBounds-MaxValue"));
+        }
+
+        // Do we also need to dump the bucket counts on output
+        if ( true == m_dumpBinsOnOutput ) {
+            size_t numBins = getIndex(maxValue) + 1;
+            for ( size_t i = 0; i < numBins; ++i ) {
+                std::stringstream ss;
+                ss << "Bin" << i << ":" << getLowestValue(i) << "-" << getHighestValue(i);
+                m_Fields.push_back(statOutput->registerField<uint64_t>(ss.str().c_str()));
+            }
+        }
+    }
+
+    void outputStatisticFields(StatisticFieldsOutput* statOutput, bool UNUSED(EndOfSimFlag)) override
+    {
+        // The percentiles are found in one pass over the buckets
+        static const uint64_t perMille[]     = { 500, 900, 990, 999 };
+        static const size_t   numPercentiles = sizeof(perMille) / sizeof(perMille[0]);
+
+        uint64_t percentiles[numPercentiles] = {};
+
+        size_t   next       = 0;
+        uint64_t cumulative = 0;
+        for ( size_t i = 0; i < m_counts.size() && next < numPercentiles; ++i ) {
+            cumulative += m_counts[i];
+            while ( next < numPercentiles && cumulative * 1000 >= perMille[next] * m_itemsRecordedCount ) {
+                uint64_t value = getHighestValue(i);
+                if ( value > m_maxRecorded ) value = m_maxRecorded;
+                percentiles[next++] = value;
+            }
+        }
+
+        uint32_t x = 0;
+        statOutput->outputField(m_Fields[x++], this->getCollectionCount());
+        statOutput->outputField(m_Fields[x++], m_itemsRecordedCount);
+        statOutput->outputField(m_Fields[x++], m_minRecorded);
+        statOutput->outputField(m_Fields[x++], m_maxRecorded);
+        statOutput->outputField(
+            m_Fields[x++], m_itemsRecordedCount == 0 ? 0.0 : m_totalSummed / (double)m_itemsRecordedCount);
+        for ( size_t i = 0; i < numPercentiles; ++i ) {
+            statOutput->outputField(m_Fields[x++], percentiles[i]);
+        }
+
+        if ( true == m_includeOutOfBounds ) {
+            statOutput->outputField(m_Fields[x++], m_OOBMinCount);
+            statOutput->outputField(m_Fields[x++], m_OOBMaxCount);
+        }
+
+        // The bucket fields were registered last, so hand them over as
+        // one record.  Only the buckets up to the largest value seen
+        // are kept, so fill in the rest first.
+        if ( true == m_dumpBinsOnOutput ) {
+            m_counts.resize(getIndex(maxValue) + 1, 0);
+            statOutput->outputFields(&m_Fields[x], m_counts.data(), m_counts.size());
+        }
+    }
+
+    void serialize_order(SST::Core::Serialization::serializer& ser) override
+    {
+        StatisticBase::serialize_order(ser);
+        ser& precision;
+        ser& subBucketHalfMagnitude;
+        ser& maxValue;
+        ser& m_OOBMinCount;
+        ser& m_OOBMaxCount;
+        ser& m_itemsRecordedCount;
+        ser& m_minRecorded;
+        ser& m_maxRecorded;
+        ser& m_totalSummed;
+        ser& m_counts;
+    }
+
+    bool isStatModeSupported(StatisticBase::StatMode_t mode) const override
+    {
+        switch ( mode ) {
+        case StatisticBase::STAT_MODE_COUNT:
+        case StatisticBase::STAT_MODE_PERIODIC:
+        case StatisticBase::STAT_MODE_DUMP_AT_END:
+            return true;
+        default:
+            return false;
+        }
+        return false;
+    }
+
+private:
+    // Significant decimal digits kept for each value
+    uint32_t precision;
+
+    // log2 of half the number of linear sub-buckets in each group
+    uint32_t subBucketHalfMagnitude;
+
+    // Largest value that is recorded
+    uint64_t maxValue;
+
+    // Out of bounds counts
+    uint64_t m_OOBMinCount;
+    uint64_t m_OOBMaxCount;
+
+    // Count of items recorded in the buckets
+    uint64_t m_itemsRecordedCount;
+
+    // Exact smallest and largest values recorded
+    uint64_t m_minRecorded;
+    uint64_t m_maxRecorded;
+
+    // Sum of the values recorded, for the mean
+    double m_totalSummed;
+
+    // The count of each bucket, up to the largest value seen
+    std::vector<uint64_t> m_counts;
+
+    // Support
+    std::vector<StatisticOutput::fieldHandle_t> m_Fields;
+    bool                                        m_dumpBinsOnOutput;
+    bool                                        m_includeOutOfBounds;
+};
+
+} // namespace Statistics
+} // namespace SST
+
+#endif // SST_CORE_STATAPI_STATHDRHISTOGRAM_H
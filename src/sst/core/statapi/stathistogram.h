@@ -12,11 +12,16 @@
 #ifndef SST_CORE_STATAPI_STATHISTOGRAM_H
 #define SST_CORE_STATAPI_STATHISTOGRAM_H
 
+#include "sst/core/output.h"
 #include "sst/core/sst_types.h"
 #include "sst/core/statapi/statbase.h"
 #include "sst/core/statapi/statoutput.h"
 #include "sst/core/warnmacros.h"
 
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
 namespace SST {
 namespace Statistics {
 
@@ -32,6 +37,10 @@ namespace Statistics {
 /**
     \class HistogramStatistic
     Holder of data grouped into pre-determined width bins.
+
+    The bin counts are kept in a flat array indexed by
+    (value - minvalue) / binwidth, so adding a value costs one divide
+    and one increment no matter how many bins are in use.
     \tparam BinDataType is the type of the data held in each bin (i.e. what data type described the width of the bin)
 */
 #define CountType   uint64_t
@@ -75,6 +84,8 @@ public:
         m_OOBMinCount      = 0;
         m_OOBMaxCount      = 0;
         m_itemsBinnedCount = 0;
+        m_activeBinCount   = 0;
+        m_bins.assign(m_numBins, 0);
         this->setCollectionCount(0);
 
         // Set the Name of this Statistic
@@ -85,8 +96,8 @@ public:
 
 protected:
     /**
-        Adds a new value to the histogram. The correct bin is identified and then incremented. If no bin can be found
-        to hold the value then a new bin is created.
+        Adds a new value to the histogram. The correct bin is identified and then incremented.  Values outside of the
+        bins are only counted as out of bounds.
     */
     void addData_impl_Ntimes(uint64_t N, BinDataType value) override
     {
@@ -95,7 +106,19 @@ protected:
             m_OOBMinCount += N;
             return;
         }
-        if ( value > getBinsMaxValue() ) {
+
+        // Find the bin.  The subtraction is done in 64 bits so signed
+        // values cannot overflow, and floating point values are
+        // binned in floating point.  Anything past the last bin is
+        // out of bounds.
+        uint64_t bin;
+        if constexpr ( std::is_integral<BinDataType>::value ) {
+            bin = ((uint64_t)value - (uint64_t)getBinsMinValue()) / m_binWidth;
+        }
+        else {
+            bin = (uint64_t)std::floor(((double)value - (double)getBinsMinValue()) / (double)m_binWidth);
+        }
+        if ( bin >= m_numBins ) {
             m_OOBMaxCount += N;
             return;
         }
@@ -106,37 +129,17 @@ protected:
         m_totalSummedSqr += N * (value * value);
 
         // Increment the Binned count (note this <= to the Statistics added Item Count)
-        m_itemsBinnedCount++;
-
-        // Figure out what the starting bin is and find it in the map
-        // To support signed and unsigned values along with floating point types,
-        // the calculation to find the bin_start value must be done in floating point
-        // then converted to BinDataType
-        double      calc1     = (double)value / (double)m_binWidth;
-        double      calc2     = floor(calc1); // Find the floor of the value
-        double      calc3     = m_binWidth * calc2;
-        BinDataType bin_start = (BinDataType)calc3;
-        //      printf("DEBUG: value = %d, junk1 = %f, calc2 = %f, calc3 = %f : bin_start = %d, item count = %ld, \n",
-        //      value, calc1, calc2, calc3, bin_start, getStatCollectionCount());
-
-        HistoMapItr_t bin_itr = m_binsMap.find(bin_start);
-
-        // Was the bin found?
-        if ( bin_itr == m_binsMap.end() ) {
-            // No, Create the bin and set a value of 1 to it
-            m_binsMap.insert(std::pair<BinDataType, CountType>(bin_start, (CountType)N));
-        }
-        else {
-            // Yes, Increment the specific bin's count
-            bin_itr->second += N;
-        }
+        m_itemsBinnedCount += N;
+
+        if ( m_bins[bin] == 0 ) m_activeBinCount++;
+        m_bins[bin] += N;
     }
 
     void addData_impl(BinDataType value) override { addData_impl_Ntimes(1, value); }
 
 private:
     /** Count how many bins are active in this histogram */
-    NumBinsType getActiveBinCount() { return m_binsMap.size(); }
+    NumBinsType getActiveBinCount() { return m_activeBinCount; }
 
     /** Count how many bins are available */
     NumBinsType getNumBins() { return m_numBins; }
@@ -144,26 +147,6 @@ private:
     /** Get the width of a bin in this histogram */
     NumBinsType getBinWidth() { return m_binWidth; }
 
-    /**
-        Get the count of items in the bin by the start value (e.g. give me the count of items in the bin which begins at
-       value X). \return The count of items in the bin else 0.
-    */
-    CountType getBinCountByBinStart(BinDataType binStartValue)
-    {
-        // Find the Bin Start Value in the Bin Map
-        HistoMapItr_t bin_itr = m_binsMap.find(binStartValue);
-
-        // Check to see if the Start Value was found
-        if ( bin_itr == m_binsMap.end() ) {
-            // No, return no count for this bin
-            return (CountType)0;
-        }
-        else {
-            // Yes, return the bin count
-            return m_binsMap[binStartValue];
-        }
-    }
-
     /**
         Get the smallest start value of a bin in this histogram (i.e. the minimum value possibly represented by this
        histogram)
@@ -219,10 +202,35 @@ private:
         m_OOBMinCount      = 0;
         m_OOBMaxCount      = 0;
         m_itemsBinnedCount = 0;
-        m_binsMap.clear();
+        m_activeBinCount   = 0;
+        m_bins.assign(m_numBins, 0);
         this->setCollectionCount(0);
     }
 
+    /** Shared histograms must all use the same bins */
+    bool isMergeable() const override { return true; }
+
+    void mergeStatisticData(StatisticBase* other) override
+    {
+        auto* stat = static_cast<HistogramStatistic<BinDataType>*>(other);
+        if ( stat->m_minValue != m_minValue || stat->m_binWidth != m_binWidth || stat->m_numBins != m_numBins ) {
+            Output::getDefaultObject().fatal(
+                CALL_INFO, 1, "ERROR: Shared histogram %s - All copies must have the same bins\n",
+                this->getFullStatName().c_str());
+        }
+
+        m_totalSummed += stat->m_totalSummed;
+        m_totalSummedSqr += stat->m_totalSummedSqr;
+        m_OOBMinCount += stat->m_OOBMinCount;
+        m_OOBMaxCount += stat->m_OOBMaxCount;
+        m_itemsBinnedCount += stat->m_itemsBinnedCount;
+        for ( NumBinsType i = 0; i < m_numBins; ++i ) {
+            if ( m_bins[i] == 0 && stat->m_bins[i] != 0 ) m_activeBinCount++;
+            m_bins[i] += stat->m_bins[i];
+        }
+        this->setCollectionCount(this->getCollectionCount() + stat->getCollectionCount());
+    }
+
     void registerOutputFields(StatisticFieldsOutput* statOutput) override
     {
         // Check to see if we have registered the Startup Fields
@@ -276,15 +284,21 @@ private:
             statOutput->outputField(m_Fields[x++], m_OOBMaxCount);
         }
 
-        // Do we also need to dump the bin counts on output
-        if ( true == m_dumpBinsOnOutput ) {
-            BinDataType currentBinValue = getBinsMinValue();
-            for ( uint32_t y = 0; y < getNumBins(); y++ ) {
-                statOutput->outputField(m_Fields[x++], getBinCountByBinStart(currentBinValue));
-                // Increment the currentBinValue to get the next bin
-                currentBinValue += getBinWidth();
-            }
-        }
+        // Do we also need to dump the bin counts on output.  The bin
+        // fields were registered last, so hand them over as one record.
+        if ( true == m_dumpBinsOnOutput ) { statOutput->outputFields(&m_Fields[x], m_bins.data(), m_bins.size()); }
+    }
+
+    void serialize_order(SST::Core::Serialization::serializer& ser) override
+    {
+        StatisticBase::serialize_order(ser);
+        ser& m_OOBMinCount;
+        ser& m_OOBMaxCount;
+        ser& m_itemsBinnedCount;
+        ser& m_totalSummed;
+        ser& m_totalSummedSqr;
+        ser& m_activeBinCount;
+        ser& m_bins;
     }
 
     bool isStatModeSupported(StatisticBase::StatMode_t mode) const override
@@ -301,12 +315,6 @@ private:
     }
 
 private:
-    // Bin Map Definition
-    typedef std::map<BinDataType, CountType> HistoMap_t;
-
-    // Iterator over the histogram bins
-    typedef typename HistoMap_t::iterator HistoMapItr_t;
-
     // The minimum value in the Histogram
     BinDataType m_minValue;
 
@@ -332,13 +340,16 @@ private:
     // values such as variance.
     BinDataType m_totalSummedSqr;
 
-    // A map of the the bin starts to the bin counts
-    HistoMap_t m_binsMap;
+    // The count of each bin, indexed from the bin starting at m_minValue
+    std::vector<CountType> m_bins;
+
+    // Number of bins with a non-zero count
+    NumBinsType m_activeBinCount;
 
     // Support
-    std::vector<uint32_t> m_Fields;
-    bool                  m_dumpBinsOnOutput;
-    bool                  m_includeOutOfBounds;
+    std::vector<StatisticOutput::fieldHandle_t> m_Fields;
+    bool                                        m_dumpBinsOnOutput;
+    bool                                        m_includeOutOfBounds;
 };
 
 } // namespace Statistics
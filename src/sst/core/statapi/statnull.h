@@ -106,7 +106,11 @@ struct NullStatistic : public NullStatisticBase<T>
 
     NullStatistic(BaseComponent* comp, const std::string& statName, const std::string& statSubId, Params& statParam) :
         NullStatisticBase<T>(comp, statName, statSubId, statParam)
-    {}
+    {
+        // Stay disabled so addData() returns at the inline enable check
+        // instead of making virtual calls that do nothing
+        this->disable();
+    }
 
     ~NullStatistic() {}
 
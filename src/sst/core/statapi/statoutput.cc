@@ -17,12 +17,76 @@
 #include "sst/core/simulation_impl.h"
 #include "sst/core/statapi/statgroup.h"
 #include "sst/core/stringize.h"
+#include "sst/core/warnmacros.h"
+
+#ifdef SST_CONFIG_HAVE_MPI
+DISABLE_WARN_MISSING_OVERRIDE
+#include <mpi.h>
+REENABLE_WARNING
+#endif
+
+#include <cstdio>
 
 namespace SST {
 namespace Statistics {
 
 ////////////////////////////////////////////////////////////////////////////////
 
+/**
+    Stands in for a StatisticFieldsOutput while its output is being
+    recorded, for the writer thread or for the end of the simulation.
+    Statistics write their fields to it on the simulation thread, and
+    each one is recorded to be output later.
+*/
+class StatisticFieldsAsyncRecorder final : public StatisticFieldsOutput
+{
+public:
+    StatisticFieldsAsyncRecorder(std::vector<AsyncRecord_t>* records) : records(records) {}
+
+    void outputField(fieldHandle_t fieldHandle, int32_t data) override
+    {
+        record(fieldHandle, AsyncRecord_t::INT32).data.i32 = data;
+    }
+    void outputField(fieldHandle_t fieldHandle, uint32_t data) override
+    {
+        record(fieldHandle, AsyncRecord_t::UINT32).data.u32 = data;
+    }
+    void outputField(fieldHandle_t fieldHandle, int64_t data) override
+    {
+        record(fieldHandle, AsyncRecord_t::INT64).data.i64 = data;
+    }
+    void outputField(fieldHandle_t fieldHandle, uint64_t data) override
+    {
+        record(fieldHandle, AsyncRecord_t::UINT64).data.u64 = data;
+    }
+    void outputField(fieldHandle_t fieldHandle, float data) override
+    {
+        record(fieldHandle, AsyncRecord_t::FLOAT).data.f = data;
+    }
+    void outputField(fieldHandle_t fieldHandle, double data) override
+    {
+        record(fieldHandle, AsyncRecord_t::DOUBLE).data.d = data;
+    }
+
+protected:
+    bool checkOutputParameters() override { return true; }
+    void printUsage() override {}
+    void startOfSimulation() override {}
+    void endOfSimulation() override {}
+    void implStartOutputEntries(StatisticBase* UNUSED(statistic)) override {}
+    void implStopOutputEntries() override {}
+
+private:
+    AsyncRecord_t& record(fieldHandle_t fieldHandle, AsyncRecord_t::Kind_t kind)
+    {
+        AsyncRecord_t& rec = addAsyncRecord(*records, kind);
+        rec.handle         = fieldHandle;
+        return rec;
+    }
+
+    std::vector<AsyncRecord_t>* records;
+};
+
 StatisticOutput::StatisticOutput(Params& outputParameters)
 {
     m_statOutputName   = "StatisticOutput";
@@ -56,10 +120,61 @@ StatisticOutput::registerGroup(StatisticGroup* group)
     stopRegisterGroup();
 }
 
+void
+StatisticOutput::mergeRankFiles(const std::string& rankFile, const std::string& mergedFile)
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    Output& out = Simulation_impl::getSimulationOutput();
+
+    FILE* fp = fopen(rankFile.c_str(), "rb");
+    if ( nullptr == fp ) {
+        out.fatal(
+            CALL_INFO, 1, " : %s - Problem opening File %s for merge - %s\n", m_statOutputName.c_str(),
+            rankFile.c_str(), strerror(errno));
+    }
+    fseeko(fp, 0, SEEK_END);
+    uint64_t size = ftello(fp);
+    fseeko(fp, 0, SEEK_SET);
+
+    // Each rank's data goes right after that of the lower ranks
+    uint64_t offset = 0;
+    uint64_t total  = 0;
+    MPI_Exscan(&size, &offset, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
+    MPI_Allreduce(&size, &total, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
+    if ( 0 == Simulation_impl::getSimulation()->getRank().rank ) offset = 0;
+
+    MPI_File fh;
+    if ( MPI_SUCCESS != MPI_File_open(
+                            MPI_COMM_WORLD, mergedFile.c_str(), MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL,
+                            &fh) ) {
+        out.fatal(
+            CALL_INFO, 1, " : %s - Problem opening merged File %s\n", m_statOutputName.c_str(), mergedFile.c_str());
+    }
+    // Drop anything left from an earlier, longer file
+    MPI_File_set_size(fh, total);
+
+    std::vector<char> buffer(16 * 1024 * 1024);
+    size_t            count;
+    while ( (count = fread(buffer.data(), 1, buffer.size(), fp)) > 0 ) {
+        MPI_File_write_at(fh, offset, buffer.data(), count, MPI_BYTE, MPI_STATUS_IGNORE);
+        offset += count;
+    }
+    MPI_File_close(&fh);
+
+    fclose(fp);
+    remove(rankFile.c_str());
+#else
+    (void)rankFile;
+    (void)mergedFile;
+#endif
+}
+
 StatisticFieldsOutput::StatisticFieldsOutput(Params& outputParameters) : StatisticOutput(outputParameters)
 {
     m_highestFieldHandle   = 0;
     m_currentFieldStatName = "";
+    m_asyncEnabled         = outputParameters.find<bool>("async", false);
+    m_asyncBufferSize      = outputParameters.find<size_t>("async_buffer_size", 1000000);
 }
 
 StatisticFieldInfo*
@@ -149,13 +264,274 @@ StatisticFieldsOutput::outputField(fieldHandle_t UNUSED(fieldHandle), uint64_t U
         CALL_INFO, 1, "StatisticOutput %s does not support uint64_t output", getStatisticOutputName().c_str());
 }
 
+void
+StatisticFieldsOutput::outputFields(const fieldHandle_t* fieldHandles, const int32_t* data, size_t count)
+{
+    for ( size_t i = 0; i < count; i++ )
+        outputField(fieldHandles[i], data[i]);
+}
+
+void
+StatisticFieldsOutput::outputFields(const fieldHandle_t* fieldHandles, const uint32_t* data, size_t count)
+{
+    for ( size_t i = 0; i < count; i++ )
+        outputField(fieldHandles[i], data[i]);
+}
+
+void
+StatisticFieldsOutput::outputFields(const fieldHandle_t* fieldHandles, const int64_t* data, size_t count)
+{
+    for ( size_t i = 0; i < count; i++ )
+        outputField(fieldHandles[i], data[i]);
+}
+
+void
+StatisticFieldsOutput::outputFields(const fieldHandle_t* fieldHandles, const uint64_t* data, size_t count)
+{
+    for ( size_t i = 0; i < count; i++ )
+        outputField(fieldHandles[i], data[i]);
+}
+
+void
+StatisticFieldsOutput::outputFields(const fieldHandle_t* fieldHandles, const float* data, size_t count)
+{
+    for ( size_t i = 0; i < count; i++ )
+        outputField(fieldHandles[i], data[i]);
+}
+
+void
+StatisticFieldsOutput::outputFields(const fieldHandle_t* fieldHandles, const double* data, size_t count)
+{
+    for ( size_t i = 0; i < count; i++ )
+        outputField(fieldHandles[i], data[i]);
+}
+
 void
 StatisticFieldsOutput::output(StatisticBase* statistic, bool endOfSimFlag)
 {
+    if ( endOfSimFlag && m_endOfSimDeferred ) {
+        // Only this thread uses its buffer, so no lock is needed
+        EndOfSimBuffer_t* buffer = m_endOfSimBuffers[Simulation_impl::getSimulation()->getRank().thread];
+        recordStatistic(buffer->records, buffer->recorder, statistic, endOfSimFlag);
+        return;
+    }
+
+    this->lock();
+    if ( m_asyncRunning ) {
+        recordStatistic(m_asyncFill, m_asyncRecorder, statistic, endOfSimFlag);
+        if ( !m_asyncInGroup ) handOffAsyncRecords(false);
+    }
+    else {
+        Simulation_impl* sim = Simulation_impl::getSimulation();
+        m_outputSimTime      = sim->getCurrentSimCycle();
+        m_outputRank         = sim->getRank().rank;
+        startOutputEntries(statistic);
+        statistic->outputStatisticFields(this, endOfSimFlag);
+        stopOutputEntries();
+    }
+    this->unlock();
+}
+
+void
+StatisticFieldsOutput::outputGroup(StatisticGroup* group, bool endOfSimFlag)
+{
+    if ( endOfSimFlag && m_endOfSimDeferred ) {
+        EndOfSimBuffer_t* buffer = m_endOfSimBuffers[Simulation_impl::getSimulation()->getRank().thread];
+        addAsyncRecord(buffer->records, AsyncRecord_t::START_GROUP, group).data.time =
+            Simulation_impl::getSimulation()->getCurrentSimCycle();
+        for ( auto& stat : group->stats ) {
+            recordStatistic(buffer->records, buffer->recorder, stat, endOfSimFlag);
+        }
+        addAsyncRecord(buffer->records, AsyncRecord_t::STOP_GROUP);
+        return;
+    }
+
+    if ( !m_asyncRunning ) {
+        m_outputSimTime = Simulation_impl::getSimulation()->getCurrentSimCycle();
+        StatisticOutput::outputGroup(group, endOfSimFlag);
+        return;
+    }
+
+    // Record the whole group before handing it off so the writer
+    // never sees part of a group
+    this->lock();
+    addAsyncRecord(m_asyncFill, AsyncRecord_t::START_GROUP, group).data.time =
+        Simulation_impl::getSimulation()->getCurrentSimCycle();
+    m_asyncInGroup = true;
+    for ( auto& stat : group->stats ) {
+        output(stat, endOfSimFlag);
+    }
+    m_asyncInGroup = false;
+    addAsyncRecord(m_asyncFill, AsyncRecord_t::STOP_GROUP);
+    handOffAsyncRecords(false);
+    this->unlock();
+}
+
+StatisticFieldsOutput::AsyncRecord_t&
+StatisticFieldsOutput::addAsyncRecord(std::vector<AsyncRecord_t>& records, AsyncRecord_t::Kind_t kind, void* object)
+{
+    records.push_back(AsyncRecord_t());
+    AsyncRecord_t& rec = records.back();
+    rec.kind           = kind;
+    rec.object         = object;
+    return rec;
+}
+
+void
+StatisticFieldsOutput::recordStatistic(
+    std::vector<AsyncRecord_t>& records, StatisticFieldsOutput* recorder, StatisticBase* statistic, bool endOfSimFlag)
+{
+    addAsyncRecord(records, AsyncRecord_t::START_ENTRIES, statistic).data.time =
+        Simulation_impl::getSimulation()->getCurrentSimCycle();
+    statistic->outputStatisticFields(recorder, endOfSimFlag);
+    addAsyncRecord(records, AsyncRecord_t::STOP_ENTRIES);
+}
+
+void
+StatisticFieldsOutput::handOffAsyncRecords(bool flush)
+{
+    std::unique_lock<std::mutex> lock(m_asyncMutex);
+
+    // If the writer is still busy, keep filling unless the buffer is
+    // full.  Then wait for the writer so memory use stays bounded.
+    if ( m_asyncBusy && !flush && m_asyncFill.size() < m_asyncBufferSize ) return;
+    m_asyncCV.wait(lock, [this] { return !m_asyncBusy; });
+    if ( m_asyncFill.empty() ) return;
+
+    m_asyncFill.swap(m_asyncDrain);
+    m_asyncBusy = true;
+    m_asyncCV.notify_all();
+
+    if ( flush ) m_asyncCV.wait(lock, [this] { return !m_asyncBusy; });
+}
+
+void
+StatisticFieldsOutput::asyncWriterLoop()
+{
+    std::unique_lock<std::mutex> lock(m_asyncMutex);
+    while ( true ) {
+        m_asyncCV.wait(lock, [this] { return m_asyncBusy || m_asyncStop; });
+        if ( !m_asyncBusy ) break;
+
+        lock.unlock();
+        replayAsyncRecords(m_asyncDrain);
+        m_asyncDrain.clear();
+        lock.lock();
+
+        m_asyncBusy = false;
+        m_asyncCV.notify_all();
+    }
+}
+
+void
+StatisticFieldsOutput::replayAsyncRecords(const std::vector<AsyncRecord_t>& records)
+{
+    for ( auto& rec : records ) {
+        switch ( rec.kind ) {
+        case AsyncRecord_t::START_GROUP:
+            m_outputSimTime = rec.data.time;
+            startOutputGroup(static_cast<StatisticGroup*>(rec.object));
+            break;
+        case AsyncRecord_t::STOP_GROUP:
+            stopOutputGroup();
+            break;
+        case AsyncRecord_t::START_ENTRIES:
+            m_outputSimTime = rec.data.time;
+            startOutputEntries(static_cast<StatisticBase*>(rec.object));
+            break;
+        case AsyncRecord_t::STOP_ENTRIES:
+            stopOutputEntries();
+            break;
+        case AsyncRecord_t::INT32:
+            outputField(rec.handle, rec.data.i32);
+            break;
+        case AsyncRecord_t::UINT32:
+            outputField(rec.handle, rec.data.u32);
+            break;
+        case AsyncRecord_t::INT64:
+            outputField(rec.handle, rec.data.i64);
+            break;
+        case AsyncRecord_t::UINT64:
+            outputField(rec.handle, rec.data.u64);
+            break;
+        case AsyncRecord_t::FLOAT:
+            outputField(rec.handle, rec.data.f);
+            break;
+        case AsyncRecord_t::DOUBLE:
+            outputField(rec.handle, rec.data.d);
+            break;
+        }
+    }
+}
+
+void
+StatisticFieldsOutput::startAsyncOutput()
+{
+    if ( !m_asyncEnabled ) return;
+
+    m_outputRank    = Simulation_impl::getSimulation()->getRank().rank;
+    m_asyncRecorder = new StatisticFieldsAsyncRecorder(&m_asyncFill);
+    m_asyncStop     = false;
+    m_asyncRunning  = true;
+    m_asyncThread   = std::thread(&StatisticFieldsOutput::asyncWriterLoop, this);
+}
+
+void
+StatisticFieldsOutput::stopAsyncOutput()
+{
+    if ( !m_asyncRunning ) return;
+
+    // Write out everything that is left, then stop the writer
+    this->lock();
+    handOffAsyncRecords(true);
+    {
+        std::lock_guard<std::mutex> lock(m_asyncMutex);
+        m_asyncStop = true;
+    }
+    m_asyncCV.notify_all();
+    m_asyncThread.join();
+
+    m_asyncRunning = false;
+    delete m_asyncRecorder;
+    m_asyncRecorder = nullptr;
+    this->unlock();
+}
+
+void
+StatisticFieldsOutput::startEndOfSimOutput()
+{
+    // A single thread already has the output to itself
+    RankInfo num_ranks = Simulation_impl::getSimulation()->getNumRanks();
+    if ( num_ranks.thread < 2 ) return;
+
+    for ( uint32_t i = 0; i < num_ranks.thread; ++i ) {
+        EndOfSimBuffer_t* buffer = new EndOfSimBuffer_t();
+        buffer->recorder         = new StatisticFieldsAsyncRecorder(&buffer->records);
+        m_endOfSimBuffers.push_back(buffer);
+    }
+    m_endOfSimDeferred = true;
+}
+
+void
+StatisticFieldsOutput::finishEndOfSimOutput()
+{
+    if ( !m_endOfSimDeferred ) return;
+
     this->lock();
-    startOutputEntries(statistic);
-    statistic->outputStatisticFields(this, endOfSimFlag);
-    stopOutputEntries();
+    m_endOfSimDeferred = false;
+    m_outputRank       = Simulation_impl::getSimulation()->getRank().rank;
+    for ( auto buffer : m_endOfSimBuffers ) {
+        if ( m_asyncRunning ) {
+            m_asyncFill.insert(m_asyncFill.end(), buffer->records.begin(), buffer->records.end());
+            handOffAsyncRecords(false);
+        }
+        else {
+            replayAsyncRecords(buffer->records);
+        }
+        delete buffer->recorder;
+        delete buffer;
+    }
+    m_endOfSimBuffers.clear();
     this->unlock();
 }
 
@@ -205,6 +581,22 @@ StatisticFieldsOutput::getFieldTypeShortName(fieldType_t type)
     return StatisticFieldInfo::getFieldTypeShortName(type);
 }
 
+void
+StatisticFieldsOutput::appendFormatted(std::string& buffer, double data)
+{
+#ifdef __cpp_lib_to_chars
+    // Fixed with a precision of 6 is defined to match printf's %f
+    char buf[64];
+    auto res = std::to_chars(buf, buf + sizeof(buf), data, std::chars_format::fixed, 6);
+    if ( res.ec == std::errc() ) {
+        buffer.append(buf, res.ptr);
+        return;
+    }
+#endif
+    // Very large values, or no floating point to_chars
+    buffer += format_string("%f", data);
+}
+
 void
 StatisticFieldsOutput::registerStatistic(StatisticBase* stat)
 {
@@ -20,8 +20,13 @@
 #include "sst/core/statapi/statfieldinfo.h"
 #include "sst/core/warnmacros.h"
 
+#include <charconv>
+#include <condition_variable>
 #include <mutex>
+#include <string>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 // Default Settings for Statistic Output and Load Level
 #define STATISTICSDEFAULTOUTPUTNAME     "sst.statOutputConsole"
@@ -34,6 +39,7 @@ class Simulation;
 namespace Statistics {
 class StatisticProcessingEngine;
 class StatisticGroup;
+class StatisticFieldsAsyncRecorder;
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -107,12 +113,28 @@ protected:
      * Allows object to perform any shutdown required. */
     virtual void endOfSimulation() = 0;
 
+    /** Output all the statistics in a group */
+    virtual void outputGroup(StatisticGroup* group, bool endOfSimFlag);
+
+    /** Start and stop background output for outputs that support it.
+     * Called after startOfSimulation() and before endOfSimulation(). */
+    virtual void startAsyncOutput() {}
+    virtual void stopAsyncOutput() {}
+
+    /** Let the threads record their end of simulation output in
+     * buffers of their own, for outputs that support it.  Called after
+     * startAsyncOutput().  From then on, output with endOfSimFlag set
+     * may be held until finishEndOfSimOutput(), which writes it in
+     * thread order.  That is called once all the threads have
+     * finished, before the shared statistics are output. */
+    virtual void startEndOfSimOutput() {}
+    virtual void finishEndOfSimOutput() {}
+
 private:
     // Start / Stop of register Fields
     virtual void registerStatistic(StatisticBase* stat) = 0;
 
     void registerGroup(StatisticGroup* group);
-    void outputGroup(StatisticGroup* group, bool endOfSimFlag);
 
     virtual void startOutputGroup(StatisticGroup* group) = 0;
     virtual void stopOutputGroup()                       = 0;
@@ -133,12 +155,44 @@ protected:
     void lock() { m_lock.lock(); }
     void unlock() { m_lock.unlock(); }
 
+    /** Merge the per rank files of a parallel run into a single file.
+     * Collective over all ranks, which each copy their own file into
+     * place with MPI-IO, ordered by rank, and then remove it.  Rank
+     * files are concatenated as is, so the output format must allow
+     * that.
+     * @param rankFile - The closed file written by this rank.
+     * @param mergedFile - The file to create.
+     */
+    void mergeRankFiles(const std::string& rankFile, const std::string& mergedFile);
+
 private:
     std::string          m_statOutputName;
     Params               m_outputParameters;
     std::recursive_mutex m_lock;
 };
 
+/**
+    \class StatisticFieldsOutput
+
+    Base class for outputs that receive statistic data one field at a
+    time.
+
+    Setting the "async" output parameter moves formatting and file I/O
+    to a background writer thread.  On the simulation threads, the
+    statistic fields are only recorded into a buffer, which is handed
+    to the writer when it is free.  The writer replays the records
+    through the normal output functions, so derived classes don't need
+    to do anything special, except that they must use
+    getOutputSimTime() and getOutputRank() instead of asking the
+    simulation for them.  The "async_buffer_size" parameter limits how
+    many records are held before the simulation waits for the writer.
+
+    With more than one thread, the output at the end of the simulation
+    is recorded the same way, into a buffer for each thread, so the
+    threads get their statistics' final values in parallel instead of
+    taking turns with the lock.  The buffers are written in thread
+    order once all the threads have finished.
+*/
 class StatisticFieldsOutput : public StatisticOutput
 {
 public:
@@ -226,6 +280,21 @@ public:
     virtual void outputField(fieldHandle_t fieldHandle, float data);
     virtual void outputField(fieldHandle_t fieldHandle, double data);
 
+    /** Output data for a run of fields of the same type in one call.
+     * Statistics with many fields (e.g. histogram bins) can use this to
+     * hand over a whole record instead of making a call per field.
+     * The default version calls outputField() for each entry.
+     * @param fieldHandles - The handles of the registered fields.
+     * @param data - The data to be output; data[i] goes to fieldHandles[i].
+     * @param count - The number of fields.
+     */
+    virtual void outputFields(const fieldHandle_t* fieldHandles, const int32_t* data, size_t count);
+    virtual void outputFields(const fieldHandle_t* fieldHandles, const uint32_t* data, size_t count);
+    virtual void outputFields(const fieldHandle_t* fieldHandles, const int64_t* data, size_t count);
+    virtual void outputFields(const fieldHandle_t* fieldHandles, const uint64_t* data, size_t count);
+    virtual void outputFields(const fieldHandle_t* fieldHandles, const float* data, size_t count);
+    virtual void outputFields(const fieldHandle_t* fieldHandles, const double* data, size_t count);
+
     /** Register a field to be output (templated function)
      * @param fieldName - The name of the field.
      * @return The handle of the registered field or -1 if type is not supported.
@@ -261,7 +330,103 @@ protected:
     // For Serialization
     StatisticFieldsOutput() {}
 
+    /** Simulated time of the entries being output.  Output may happen
+     * on a writer thread after the simulation has moved on, so derived
+     * classes must use this instead of the current simulation time. */
+    SimTime_t getOutputSimTime() const { return m_outputSimTime; }
+
+    /** Rank doing the output.  Derived classes must use this instead of
+     * asking the simulation, which isn't accessible from the writer
+     * thread. */
+    int getOutputRank() const { return m_outputRank; }
+
+    /** Append a value to a string in the same form as printf's %d, %u
+     * or %f, without parsing a format string or making a temporary */
+    template <typename T>
+    static void appendFormatted(std::string& buffer, T data)
+    {
+        char buf[24];
+        auto res = std::to_chars(buf, buf + sizeof(buf), data);
+        buffer.append(buf, res.ptr);
+    }
+    static void appendFormatted(std::string& buffer, float data) { appendFormatted(buffer, static_cast<double>(data)); }
+    static void appendFormatted(std::string& buffer, double data);
+
 private:
+    friend class StatisticFieldsAsyncRecorder;
+
+    // A recorded output call for asynchronous output
+    struct AsyncRecord_t
+    {
+        enum Kind_t : uint8_t {
+            START_GROUP,
+            STOP_GROUP,
+            START_ENTRIES,
+            STOP_ENTRIES,
+            INT32,
+            UINT32,
+            INT64,
+            UINT64,
+            FLOAT,
+            DOUBLE
+        };
+
+        Kind_t        kind;
+        fieldHandle_t handle;
+        union {
+            int32_t   i32;
+            uint32_t  u32;
+            int64_t   i64;
+            uint64_t  u64;
+            float     f;
+            double    d;
+            SimTime_t time;
+        } data;
+        void* object; // StatisticBase* or StatisticGroup*
+    };
+
+    // Records of the end of simulation output of one thread
+    struct EndOfSimBuffer_t
+    {
+        std::vector<AsyncRecord_t>    records;
+        StatisticFieldsAsyncRecorder* recorder;
+    };
+
+    void outputGroup(StatisticGroup* group, bool endOfSimFlag) override;
+    void startAsyncOutput() override;
+    void stopAsyncOutput() override;
+    void startEndOfSimOutput() override;
+    void finishEndOfSimOutput() override;
+
+    static AsyncRecord_t&
+    addAsyncRecord(std::vector<AsyncRecord_t>& records, AsyncRecord_t::Kind_t kind, void* object = nullptr);
+
+    void recordStatistic(
+        std::vector<AsyncRecord_t>& records, StatisticFieldsOutput* recorder, StatisticBase* statistic,
+        bool endOfSimFlag);
+    void handOffAsyncRecords(bool flush);
+    void asyncWriterLoop();
+    void replayAsyncRecords(const std::vector<AsyncRecord_t>& records);
+
+    SimTime_t m_outputSimTime = 0;
+    int       m_outputRank    = 0;
+
+    bool                          m_asyncEnabled    = false;
+    size_t                        m_asyncBufferSize = 0;
+    bool                          m_asyncRunning    = false;
+    bool                          m_asyncInGroup    = false;
+    bool                          m_asyncBusy       = false;
+    bool                          m_asyncStop       = false;
+    std::vector<AsyncRecord_t>    m_asyncFill;  // Filled by the simulation threads
+    std::vector<AsyncRecord_t>    m_asyncDrain; // Written by the writer thread
+    StatisticFieldsAsyncRecorder* m_asyncRecorder = nullptr;
+    std::thread                   m_asyncThread;
+    std::mutex                    m_asyncMutex;
+    std::condition_variable       m_asyncCV;
+
+    bool                           m_endOfSimDeferred = false;
+    std::vector<EndOfSimBuffer_t*> m_endOfSimBuffers; // Indexed by thread
+
     // Other support functions
     StatisticFieldInfo* addFieldToLists(const char* fieldName, fieldType_t fieldType);
     fieldHandle_t       generateFieldHandle(StatisticFieldInfo* FieldInfo);
@@ -0,0 +1,364 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/statapi/statoutputcolumnar.h"
+
+#include "sst/core/simulation_impl.h"
+#include "sst/core/stringize.h"
+
+#ifdef HAVE_LIBZ
+#include <zlib.h>
+#endif
+
+#include <cstring>
+
+namespace SST {
+namespace Statistics {
+
+namespace {
+
+const char     COLUMNAR_MAGIC[4] = { 'S', 'S', 'T', 'C' };
+const uint16_t COLUMNAR_VERSION  = 1;
+
+const uint8_t ENCODING_RAW  = 0;
+const uint8_t ENCODING_ZLIB = 1;
+
+const char* NAME_COLUMNS[4] = { "ComponentName", "StatisticName", "StatisticSubId", "StatisticType" };
+
+template <typename T>
+void
+appendValue(std::vector<uint8_t>& buf, T value)
+{
+    size_t pos = buf.size();
+    buf.resize(pos + sizeof(T));
+    memcpy(buf.data() + pos, &value, sizeof(T));
+}
+
+template <typename T>
+void
+writeValue(FILE* fp, T value)
+{
+    fwrite(&value, sizeof(T), 1, fp);
+}
+
+} // anonymous namespace
+
+StatisticOutputColumnar::StatisticOutputColumnar(Params& outputParameters) :
+    StatisticFieldsOutput(outputParameters),
+    m_hFile(nullptr),
+    m_numRows(0)
+{
+    // Announce this output object's name
+    Output& out = Simulation_impl::getSimulationOutput();
+    out.verbose(CALL_INFO, 1, 0, " : StatisticOutputColumnar enabled...\n");
+    setStatisticOutputName("StatisticOutputColumnar");
+}
+
+bool
+StatisticOutputColumnar::checkOutputParameters()
+{
+    bool foundKey;
+
+    // Look for Help Param
+    getOutputParameters().find<std::string>("help", "1", foundKey);
+    if ( true == foundKey ) { return false; }
+
+    // Get the parameters
+    m_FilePath = getOutputParameters().find<std::string>("filepath", "./StatisticOutput.sstc");
+#ifdef HAVE_LIBZ
+    m_useCompression = getOutputParameters().find<bool>("compressed", true);
+#else
+    m_useCompression = getOutputParameters().find<bool>("compressed", false);
+#endif
+    m_compressionLevel = getOutputParameters().find<int>("compressionlevel", 1);
+    m_rowGroupSize     = getOutputParameters().find<uint64_t>("rowgroupsize", 65536);
+    m_mergeRanks       = getOutputParameters().find<bool>("mergeranks", false);
+
+    if ( 0 == m_FilePath.length() ) {
+        // Filepath is zero length
+        return false;
+    }
+#ifndef HAVE_LIBZ
+    if ( m_useCompression ) {
+        // Compression requested but SST was built without zlib
+        return false;
+    }
+#endif
+    if ( 0 == m_rowGroupSize ) { return false; }
+    if ( m_compressionLevel < 0 || m_compressionLevel > 9 ) { return false; }
+
+    return true;
+}
+
+void
+StatisticOutputColumnar::printUsage()
+{
+    // Display how to use this output object
+    Output out("", 0, 0, Output::STDOUT);
+    out.output(" : Usage - Sends all statistic output to a columnar binary file.\n");
+    out.output(" : Parameters:\n");
+    out.output(" : help = Force Statistic Output to display usage\n");
+    out.output(" : filepath = <Path to .sstc file> - Default is ./StatisticOutput.sstc\n");
+    out.output(" : compressed = 0 | 1 - Compress each column with zlib - Default is 1 if SST was built with zlib\n");
+    out.output(" : compressionlevel = <0 - 9> - zlib compression level - Default is 1\n");
+    out.output(" : rowgroupsize = <rows> - Number of rows buffered per row group - Default is 65536\n");
+    out.output(" : mergeranks = 0 | 1 - Merge the per rank files into one at the end of simulation - Default is 0\n");
+    out.output(" : async = 0 | 1 - Format and write output on a background thread - Default is 0\n");
+}
+
+void
+StatisticOutputColumnar::startOfSimulation()
+{
+    // Set Filename with Rank if Num Ranks > 1
+    if ( 1 < Simulation_impl::getSimulation()->getNumRanks().rank ) {
+        int         rank    = Simulation_impl::getSimulation()->getRank().rank;
+        std::string rankstr = "_" + std::to_string(rank);
+
+        m_mergedFilePath = m_FilePath;
+
+        // Search for any extension
+        size_t index = m_FilePath.find_last_of(".");
+        if ( std::string::npos != index ) {
+            // We found a . at the end of the file, insert the rank string
+            m_FilePath.insert(index, rankstr);
+        }
+        else {
+            // No . found, append the rank string
+            m_FilePath += rankstr;
+        }
+    }
+
+    // Open the finalized filename
+    if ( !openFile() ) return;
+
+    // Size the value columns from the types of the registered fields
+    for ( auto* field : getFieldInfoArray() ) {
+        Column col;
+        if ( field->getFieldType() == StatisticFieldType<int32_t>::id() ||
+             field->getFieldType() == StatisticFieldType<uint32_t>::id() ||
+             field->getFieldType() == StatisticFieldType<float>::id() ) {
+            col.width = 4;
+        }
+        else {
+            col.width = 8;
+        }
+        m_columns.push_back(col);
+    }
+}
+
+void
+StatisticOutputColumnar::endOfSimulation()
+{
+    // Write the last, partial row group and close the file
+    if ( m_numRows > 0 ) writeRowGroup();
+    closeFile();
+
+    if ( m_mergeRanks && 1 < Simulation_impl::getSimulation()->getNumRanks().rank ) {
+        mergeRankFiles(m_FilePath, m_mergedFilePath);
+    }
+}
+
+void
+StatisticOutputColumnar::implStartOutputEntries(StatisticBase* statistic)
+{
+    // The names only change when the statistic does, so they are
+    // looked up in the dictionary once per row group
+    auto it = m_statNames.find(statistic);
+    if ( it == m_statNames.end() ) {
+        std::array<uint32_t, 4> names = { addString(statistic->getCompName()), addString(statistic->getStatName()),
+                                          addString(statistic->getStatSubId()),
+                                          addString(statistic->getStatTypeName()) };
+        it                            = m_statNames.emplace(statistic, names).first;
+    }
+    for ( int i = 0; i < 4; ++i ) {
+        m_nameColumns[i].push_back(it->second[i]);
+    }
+    m_simTimeColumn.push_back(getOutputSimTime());
+
+    // Fields the statistic does not provide are left as 0
+    for ( auto& col : m_columns ) {
+        col.data.resize(col.data.size() + col.width, 0);
+    }
+}
+
+void
+StatisticOutputColumnar::implStopOutputEntries()
+{
+    if ( ++m_numRows >= m_rowGroupSize ) writeRowGroup();
+}
+
+template <typename T>
+void
+StatisticOutputColumnar::setField(fieldHandle_t fieldHandle, T data)
+{
+    Column& col = m_columns[fieldHandle];
+    memcpy(col.data.data() + col.data.size() - col.width, &data, sizeof(T));
+}
+
+void
+StatisticOutputColumnar::outputField(fieldHandle_t fieldHandle, int32_t data)
+{
+    setField(fieldHandle, data);
+}
+
+void
+StatisticOutputColumnar::outputField(fieldHandle_t fieldHandle, uint32_t data)
+{
+    setField(fieldHandle, data);
+}
+
+void
+StatisticOutputColumnar::outputField(fieldHandle_t fieldHandle, int64_t data)
+{
+    setField(fieldHandle, data);
+}
+
+void
+StatisticOutputColumnar::outputField(fieldHandle_t fieldHandle, uint64_t data)
+{
+    setField(fieldHandle, data);
+}
+
+void
+StatisticOutputColumnar::outputField(fieldHandle_t fieldHandle, float data)
+{
+    setField(fieldHandle, data);
+}
+
+void
+StatisticOutputColumnar::outputField(fieldHandle_t fieldHandle, double data)
+{
+    setField(fieldHandle, data);
+}
+
+uint32_t
+StatisticOutputColumnar::addString(const std::string& str)
+{
+    auto it = m_dictionaryIndex.find(str);
+    if ( it != m_dictionaryIndex.end() ) return it->second;
+
+    uint32_t index = m_dictionary.size();
+    m_dictionary.push_back(str);
+    m_dictionaryIndex[str] = index;
+    return index;
+}
+
+void
+StatisticOutputColumnar::writeBlock(const std::vector<uint8_t>& raw)
+{
+#ifdef HAVE_LIBZ
+    if ( m_useCompression && !raw.empty() ) {
+        uLongf stored = compressBound(raw.size());
+        m_compressBuffer.resize(stored);
+        // Keep the raw bytes when compression does not make them smaller
+        if ( Z_OK == compress2(m_compressBuffer.data(), &stored, raw.data(), raw.size(), m_compressionLevel) &&
+             stored < raw.size() ) {
+            writeValue<uint8_t>(m_hFile, ENCODING_ZLIB);
+            writeValue<uint64_t>(m_hFile, raw.size());
+            writeValue<uint64_t>(m_hFile, stored);
+            fwrite(m_compressBuffer.data(), 1, stored, m_hFile);
+            return;
+        }
+    }
+#endif
+    writeValue<uint8_t>(m_hFile, ENCODING_RAW);
+    writeValue<uint64_t>(m_hFile, raw.size());
+    writeValue<uint64_t>(m_hFile, raw.size());
+    fwrite(raw.data(), 1, raw.size(), m_hFile);
+}
+
+void
+StatisticOutputColumnar::writeName(const std::string& name)
+{
+    writeValue<uint16_t>(m_hFile, name.size());
+    fwrite(name.data(), 1, name.size(), m_hFile);
+}
+
+void
+StatisticOutputColumnar::writeRowGroup()
+{
+    FieldInfoArray_t&    fields = getFieldInfoArray();
+    std::vector<uint8_t> raw;
+
+    // Row group header
+    fwrite(COLUMNAR_MAGIC, 1, sizeof(COLUMNAR_MAGIC), m_hFile);
+    writeValue<uint16_t>(m_hFile, COLUMNAR_VERSION);
+    writeValue<uint16_t>(m_hFile, 0);
+    writeValue<uint32_t>(m_hFile, getOutputRank());
+    writeValue<uint32_t>(m_hFile, 5 + fields.size());
+    writeValue<uint64_t>(m_hFile, m_numRows);
+
+    // String dictionary
+    appendValue<uint32_t>(raw, m_dictionary.size());
+    for ( auto& str : m_dictionary ) {
+        appendValue<uint32_t>(raw, str.size());
+        raw.insert(raw.end(), str.begin(), str.end());
+    }
+    writeBlock(raw);
+
+    // Dictionary encoded name columns
+    for ( int i = 0; i < 4; ++i ) {
+        writeName(NAME_COLUMNS[i]);
+        writeName("str");
+        raw.resize(m_nameColumns[i].size() * sizeof(uint32_t));
+        memcpy(raw.data(), m_nameColumns[i].data(), raw.size());
+        writeBlock(raw);
+        m_nameColumns[i].clear();
+    }
+
+    writeName("SimTime");
+    writeName("u64");
+    raw.resize(m_simTimeColumn.size() * sizeof(uint64_t));
+    memcpy(raw.data(), m_simTimeColumn.data(), raw.size());
+    writeBlock(raw);
+    m_simTimeColumn.clear();
+
+    // Field columns
+    for ( size_t i = 0; i < fields.size(); ++i ) {
+        writeName(fields[i]->getFieldName());
+        writeName(getFieldTypeShortName(fields[i]->getFieldType()));
+        writeBlock(m_columns[i].data);
+        m_columns[i].data.clear();
+    }
+
+    // Each row group carries its own dictionary
+    m_dictionary.clear();
+    m_dictionaryIndex.clear();
+    m_statNames.clear();
+    m_numRows = 0;
+}
+
+bool
+StatisticOutputColumnar::openFile(void)
+{
+    m_hFile = fopen(m_FilePath.c_str(), "wb");
+    if ( nullptr == m_hFile ) {
+        // We got an error of some sort
+        Output out = Simulation_impl::getSimulation()->getSimulationOutput();
+        out.fatal(
+            CALL_INFO, 1, " : StatisticOutputColumnar - Problem opening File %s - %s\n", m_FilePath.c_str(),
+            strerror(errno));
+        return false;
+    }
+    return true;
+}
+
+void
+StatisticOutputColumnar::closeFile(void)
+{
+    if ( nullptr != m_hFile ) fclose(m_hFile);
+    m_hFile = nullptr;
+}
+
+} // namespace Statistics
+} // namespace SST
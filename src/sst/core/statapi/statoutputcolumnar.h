@@ -0,0 +1,167 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_STATAPI_STATOUTPUTCOLUMNAR_H
+#define SST_CORE_STATAPI_STATOUTPUTCOLUMNAR_H
+
+#include "sst/core/sst_types.h"
+#include "sst/core/statapi/statoutput.h"
+
+#include <array>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace SST {
+namespace Statistics {
+
+/**
+    \class StatisticOutputColumnar
+
+    The class for statistics output to a compact columnar binary file.
+
+    The file is a sequence of self contained row groups, so the per
+    rank files of a parallel run can be joined with cat, or merged at
+    the end of the run by setting "mergeranks".  All values are little
+    endian.  Each row group is laid out as:
+
+        char[4]  magic "SSTC"
+        uint16   format version (1)
+        uint16   reserved (0)
+        uint32   rank that wrote the row group
+        uint32   number of columns
+        uint64   number of rows
+        block    string dictionary
+        columns  for each column: uint16 name length, name,
+                 uint16 type length, type, block of values
+
+    A block is a uint8 encoding (0 = raw, 1 = zlib), the uint64 raw
+    size and the uint64 stored size, followed by the stored bytes.  The
+    dictionary holds a uint32 count followed by a uint32 length and the
+    bytes of each string.
+
+    The first columns are ComponentName, StatisticName, StatisticSubId
+    and StatisticType, of type "str", holding uint32 indices into the
+    dictionary of their row group, followed by SimTime ("u64").  Then
+    there is one column per registered field, typed by the short name
+    of its field type ("i32", "u32", "i64", "u64", "f32" or "f64").  As
+    in the CSV output, fields a statistic does not provide are 0.
+*/
+class StatisticOutputColumnar : public StatisticFieldsOutput
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        StatisticOutput,
+        StatisticOutputColumnar,
+        "sst",
+        "statoutputcolumnar",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Output to a compressed columnar binary file")
+
+    /** Construct a StatOutputColumnar
+     * @param outputParameters - Parameters used for this Statistic Output
+     */
+    StatisticOutputColumnar(Params& outputParameters);
+
+protected:
+    /** Perform a check of provided parameters
+     * @return True if all required parameters and options are acceptable
+     */
+    bool checkOutputParameters() override;
+
+    /** Print out usage for this Statistic Output */
+    void printUsage() override;
+
+    /** Indicate to Statistic Output that simulation started.
+     *  Statistic output may perform any startup code here as necessary.
+     */
+    void startOfSimulation() override;
+
+    /** Indicate to Statistic Output that simulation ended.
+     *  Statistic output may perform any shutdown code here as necessary.
+     */
+    void endOfSimulation() override;
+
+    /** Implementation function for the start of output.
+     * This will be called by the Statistic Processing Engine to indicate that
+     * a Statistic is about to send data to the Statistic Output for processing.
+     * @param statistic - Pointer to the statistic object than the output can
+     * retrieve data from.
+     */
+    void implStartOutputEntries(StatisticBase* statistic) override;
+
+    /** Implementation function for the end of output.
+     * This will be called by the Statistic Processing Engine to indicate that
+     * a Statistic is finished sending data to the Statistic Output for processing.
+     * The Statistic Output can perform any output related functions here.
+     */
+    void implStopOutputEntries() override;
+
+    /** Implementation functions for output.
+     * These will be called by the statistic to provide Statistic defined
+     * data to be output.
+     * @param fieldHandle - The handle to the registered statistic field.
+     * @param data - The data related to the registered field to be output.
+     */
+    void outputField(fieldHandle_t fieldHandle, int32_t data) override;
+    void outputField(fieldHandle_t fieldHandle, uint32_t data) override;
+    void outputField(fieldHandle_t fieldHandle, int64_t data) override;
+    void outputField(fieldHandle_t fieldHandle, uint64_t data) override;
+    void outputField(fieldHandle_t fieldHandle, float data) override;
+    void outputField(fieldHandle_t fieldHandle, double data) override;
+
+    /** True if this StatOutput can handle StatisticGroups */
+    virtual bool acceptsGroups() const override { return true; }
+
+protected:
+    StatisticOutputColumnar() { ; } // For serialization
+
+private:
+    /** Values of one field for the rows of the current row group */
+    struct Column
+    {
+        size_t               width;
+        std::vector<uint8_t> data;
+    };
+
+    bool     openFile();
+    void     closeFile();
+    uint32_t addString(const std::string& str);
+    void     writeBlock(const std::vector<uint8_t>& raw);
+    void     writeName(const std::string& name);
+    void     writeRowGroup();
+
+    template <typename T>
+    void setField(fieldHandle_t fieldHandle, T data);
+
+private:
+    FILE*                                             m_hFile;
+    std::string                                       m_FilePath;
+    std::string                                       m_mergedFilePath;
+    bool                                              m_mergeRanks;
+    bool                                              m_useCompression;
+    int                                               m_compressionLevel;
+    uint64_t                                          m_rowGroupSize;
+    uint64_t                                          m_numRows;
+    std::vector<Column>                               m_columns;
+    std::vector<std::string>                          m_dictionary;
+    std::unordered_map<std::string, uint32_t>         m_dictionaryIndex;
+    std::map<StatisticBase*, std::array<uint32_t, 4>> m_statNames;
+    std::array<std::vector<uint32_t>, 4>              m_nameColumns;
+    std::vector<uint64_t>                             m_simTimeColumn;
+    std::vector<uint8_t>                              m_compressBuffer;
+};
+
+} // namespace Statistics
+} // namespace SST
+
+#endif // SST_CORE_STATAPI_STATOUTPUTCOLUMNAR_H
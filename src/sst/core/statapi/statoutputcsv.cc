@@ -49,6 +49,8 @@ StatisticOutputCSV::checkOutputParameters()
     topHeaderFlag     = getOutputParameters().find<std::string>("outputtopheader", "1");
     simTimeFlag       = getOutputParameters().find<std::string>("outputsimtime", "1");
     rankFlag          = getOutputParameters().find<std::string>("outputrank", "1");
+    m_bufferSize      = getOutputParameters().find<size_t>("buffersize", 65536);
+    m_mergeRanks      = getOutputParameters().find<bool>("mergeranks", false);
     m_outputTopHeader = ("1" == topHeaderFlag);
     m_outputSimTime   = ("1" == simTimeFlag);
     m_outputRank      = ("1" == rankFlag);
@@ -79,6 +81,9 @@ StatisticOutputCSV::printUsage()
     out.output(" : outputtopheader = 0 | 1 - Output Header at top - Default is 1\n");
     out.output(" : outputsimtime = 0 | 1 - Output Simulation Time - Default is 1\n");
     out.output(" : outputrank = 0 | 1 - Output Rank - Default is 1\n");
+    out.output(" : buffersize = <bytes> - Size of the blocks written to the file - Default is 65536\n");
+    out.output(" : mergeranks = 0 | 1 - Merge the per rank files into one at the end of simulation - Default is 0\n");
+    out.output(" : async = 0 | 1 - Format and write output on a background thread - Default is 0\n");
 }
 
 void
@@ -87,12 +92,17 @@ StatisticOutputCSV::startOfSimulation()
     StatisticFieldInfo*        statField;
     std::string                outputBuffer;
     FieldInfoArray_t::iterator it_v;
+    bool                       outputTopHeader = m_outputTopHeader;
 
     // Set Filename with Rank if Num Ranks > 1
     if ( 1 < Simulation_impl::getSimulation()->getNumRanks().rank ) {
         int         rank    = Simulation_impl::getSimulation()->getRank().rank;
         std::string rankstr = "_" + std::to_string(rank);
 
+        // When merging, only the first rank's file gets a header
+        m_mergedFilePath = m_FilePath;
+        if ( m_mergeRanks && 0 != rank ) outputTopHeader = false;
+
         // Search for any extension
         size_t index = m_FilePath.find_last_of(".");
         if ( std::string::npos != index ) {
@@ -113,7 +123,7 @@ StatisticOutputCSV::startOfSimulation()
         m_OutputBufferArray.push_back(std::string(""));
     }
 
-    if ( true == m_outputTopHeader ) {
+    if ( true == outputTopHeader ) {
         // Add a Component Time Header to the front
         outputBuffer = "ComponentName";
         outputBuffer += m_Separator;
@@ -168,8 +178,14 @@ StatisticOutputCSV::startOfSimulation()
 void
 StatisticOutputCSV::endOfSimulation()
 {
-    // Close the file
+    // Write anything left in the buffer and close the file
+    flushBuffer();
     closeFile();
+
+    // Gzip members can be concatenated, so compressed files merge too
+    if ( m_mergeRanks && 1 < Simulation_impl::getSimulation()->getNumRanks().rank ) {
+        mergeRankFiles(m_FilePath, m_mergedFilePath);
+    }
 }
 
 void
@@ -193,85 +209,130 @@ StatisticOutputCSV::implStopOutputEntries()
 {
     uint32_t x;
 
+    // Build the line in the write buffer, which is sent to the file
+    // in blocks of at least m_bufferSize bytes
+
     // Output the Component and Statistic names
-    print("%s", m_currentComponentName.c_str());
-    print("%s", m_Separator.c_str());
-    print("%s", m_currentStatisticName.c_str());
-    print("%s", m_Separator.c_str());
-    print("%s", m_currentStatisticSubId.c_str());
-    print("%s", m_Separator.c_str());
-    print("%s", m_currentStatisticType.c_str());
-    print("%s", m_Separator.c_str());
+    m_writeBuffer += m_currentComponentName;
+    m_writeBuffer += m_Separator;
+    m_writeBuffer += m_currentStatisticName;
+    m_writeBuffer += m_Separator;
+    m_writeBuffer += m_currentStatisticSubId;
+    m_writeBuffer += m_Separator;
+    m_writeBuffer += m_currentStatisticType;
+    m_writeBuffer += m_Separator;
 
     // Done with Output, Send a line of data to the file
     if ( true == m_outputSimTime ) {
         // Add the Simulation Time to the front
-        print("%" PRIu64, Simulation_impl::getSimulation()->getCurrentSimCycle());
-        print("%s", m_Separator.c_str());
+        appendFormatted(m_writeBuffer, getOutputSimTime());
+        m_writeBuffer += m_Separator;
     }
 
     // Done with Output, Send a line of data to the file
     if ( true == m_outputRank ) {
         // Add the Simulation Time to the front
-        print("%d", Simulation_impl::getSimulation()->getRank().rank);
-        print("%s", m_Separator.c_str());
+        appendFormatted(m_writeBuffer, getOutputRank());
+        m_writeBuffer += m_Separator;
     }
 
     x = 0;
     while ( x < m_OutputBufferArray.size() ) {
-        print("%s", m_OutputBufferArray[x].c_str());
+        m_writeBuffer += m_OutputBufferArray[x];
         x++;
-        if ( x != m_OutputBufferArray.size() ) { print("%s", m_Separator.c_str()); }
+        if ( x != m_OutputBufferArray.size() ) { m_writeBuffer += m_Separator; }
     }
-    print("\n");
+    m_writeBuffer += "\n";
+
+    if ( m_writeBuffer.size() >= m_bufferSize ) { flushBuffer(); }
+}
+
+template <typename T>
+void
+StatisticOutputCSV::formatField(fieldHandle_t fieldHandle, T data)
+{
+    // Format in place to reuse the storage already held by the buffer
+    // string
+    m_OutputBufferArray[fieldHandle].clear();
+    appendFormatted(m_OutputBufferArray[fieldHandle], data);
 }
 
 void
 StatisticOutputCSV::outputField(fieldHandle_t fieldHandle, int32_t data)
 {
-    std::string buffer;
-    buffer                           = format_string("%" PRId32, data);
-    m_OutputBufferArray[fieldHandle] = buffer;
+    formatField(fieldHandle, data);
 }
 
 void
 StatisticOutputCSV::outputField(fieldHandle_t fieldHandle, uint32_t data)
 {
-    std::string buffer;
-    buffer                           = format_string("%" PRIu32, data);
-    m_OutputBufferArray[fieldHandle] = buffer;
+    formatField(fieldHandle, data);
 }
 
 void
 StatisticOutputCSV::outputField(fieldHandle_t fieldHandle, int64_t data)
 {
-    std::string buffer;
-    buffer                           = format_string("%" PRId64, data);
-    m_OutputBufferArray[fieldHandle] = buffer;
+    formatField(fieldHandle, data);
 }
 
 void
 StatisticOutputCSV::outputField(fieldHandle_t fieldHandle, uint64_t data)
 {
-    std::string buffer;
-    buffer                           = format_string("%" PRIu64, data);
-    m_OutputBufferArray[fieldHandle] = buffer;
+    formatField(fieldHandle, data);
 }
 
 void
 StatisticOutputCSV::outputField(fieldHandle_t fieldHandle, float data)
 {
-    std::string buffer;
-    buffer                           = format_string("%f", data);
-    m_OutputBufferArray[fieldHandle] = buffer;
+    formatField(fieldHandle, data);
 }
 
 void
 StatisticOutputCSV::outputField(fieldHandle_t fieldHandle, double data)
 {
-    std::string buffer;
-    buffer                           = format_string("%f", data);
-    m_OutputBufferArray[fieldHandle] = buffer;
+    formatField(fieldHandle, data);
+}
+
+void
+StatisticOutputCSV::outputFields(const fieldHandle_t* fieldHandles, const int32_t* data, size_t count)
+{
+    for ( size_t i = 0; i < count; i++ )
+        formatField(fieldHandles[i], data[i]);
+}
+
+void
+StatisticOutputCSV::outputFields(const fieldHandle_t* fieldHandles, const uint32_t* data, size_t count)
+{
+    for ( size_t i = 0; i < count; i++ )
+        formatField(fieldHandles[i], data[i]);
+}
+
+void
+StatisticOutputCSV::outputFields(const fieldHandle_t* fieldHandles, const int64_t* data, size_t count)
+{
+    for ( size_t i = 0; i < count; i++ )
+        formatField(fieldHandles[i], data[i]);
+}
+
+void
+StatisticOutputCSV::outputFields(const fieldHandle_t* fieldHandles, const uint64_t* data, size_t count)
+{
+    for ( size_t i = 0; i < count; i++ )
+        formatField(fieldHandles[i], data[i]);
+}
+
+void
+StatisticOutputCSV::outputFields(const fieldHandle_t* fieldHandles, const float* data, size_t count)
+{
+    for ( size_t i = 0; i < count; i++ )
+        formatField(fieldHandles[i], data[i]);
+}
+
+void
+StatisticOutputCSV::outputFields(const fieldHandle_t* fieldHandles, const double* data, size_t count)
+{
+    for ( size_t i = 0; i < count; i++ )
+        formatField(fieldHandles[i], data[i]);
 }
 
 bool
@@ -320,6 +381,21 @@ StatisticOutputCSV::closeFile(void)
     }
 }
 
+void
+StatisticOutputCSV::flushBuffer()
+{
+    if ( m_writeBuffer.empty() ) return;
+    if ( m_useCompression ) {
+#ifdef HAVE_LIBZ
+        gzwrite(m_gzFile, m_writeBuffer.data(), m_writeBuffer.size());
+#endif
+    }
+    else {
+        fwrite(m_writeBuffer.data(), 1, m_writeBuffer.size(), m_hFile);
+    }
+    m_writeBuffer.clear();
+}
+
 int
 StatisticOutputCSV::print(const char* fmt, ...)
 {
@@ -91,6 +91,19 @@ protected:
     void outputField(fieldHandle_t fieldHandle, float data) override;
     void outputField(fieldHandle_t fieldHandle, double data) override;
 
+    /** Implementation functions for bulk output.
+     * These format a whole record of fields in one call.
+     * @param fieldHandles - The handles to the registered statistic fields.
+     * @param data - The data related to the registered fields to be output.
+     * @param count - The number of fields.
+     */
+    void outputFields(const fieldHandle_t* fieldHandles, const int32_t* data, size_t count) override;
+    void outputFields(const fieldHandle_t* fieldHandles, const uint32_t* data, size_t count) override;
+    void outputFields(const fieldHandle_t* fieldHandles, const int64_t* data, size_t count) override;
+    void outputFields(const fieldHandle_t* fieldHandles, const uint64_t* data, size_t count) override;
+    void outputFields(const fieldHandle_t* fieldHandles, const float* data, size_t count) override;
+    void outputFields(const fieldHandle_t* fieldHandles, const double* data, size_t count) override;
+
     /** True if this StatOutput can handle StatisticGroups */
     virtual bool acceptsGroups() const override { return true; }
 
@@ -101,6 +114,10 @@ private:
     bool openFile();
     void closeFile();
     int  print(const char* fmt, ...);
+    void flushBuffer();
+
+    template <typename T>
+    void formatField(fieldHandle_t fieldHandle, T data);
 
 private:
 #ifdef HAVE_LIBZ
@@ -108,8 +125,11 @@ private:
 #endif
     FILE*                    m_hFile;
     std::vector<std::string> m_OutputBufferArray;
+    std::string              m_writeBuffer;
+    size_t                   m_bufferSize;
     std::string              m_Separator;
     std::string              m_FilePath;
+    std::string              m_mergedFilePath;
     std::string              m_currentComponentName;
     std::string              m_currentStatisticName;
     std::string              m_currentStatisticSubId;
@@ -118,6 +138,7 @@ private:
     bool                     m_outputSimTime;
     bool                     m_outputRank;
     bool                     m_useCompression;
+    bool                     m_mergeRanks;
 };
 
 } // namespace Statistics
@@ -55,8 +55,34 @@ StatisticOutputHDF5::checkOutputParameters()
         return false;
     }
 
+    m_storage.chunkSize   = getOutputParameters().find<hsize_t>("chunksize", 1024);
+    m_storage.compression = getOutputParameters().find<int>("compression", 7);
+    if ( 0 == m_storage.chunkSize || m_storage.compression < 0 || m_storage.compression > 9 ) { return false; }
+
     H5::Exception::dontPrint();
 
+    // Each rank writes a file of its own, and the file at filepath
+    // links to all of them
+    RankInfo numRanks = Simulation_impl::getSimulation()->getNumRanks();
+    if ( 1 < numRanks.rank ) {
+        std::vector<std::string> rankFiles;
+        for ( uint32_t rank = 0; rank < numRanks.rank; rank++ ) {
+            std::string rankFile = m_filePath;
+            std::string rankstr  = "_" + std::to_string(rank);
+
+            // Insert the rank string before any extension
+            size_t index = rankFile.find_last_of(".");
+            if ( std::string::npos != index ) { rankFile.insert(index, rankstr); }
+            else {
+                rankFile += rankstr;
+            }
+            rankFiles.push_back(rankFile);
+        }
+
+        if ( 0 == Simulation_impl::getSimulation()->getRank().rank ) createRankLinks(m_filePath, rankFiles);
+        m_filePath = rankFiles[Simulation_impl::getSimulation()->getRank().rank];
+    }
+
     m_hFile = new H5::H5File(m_filePath, H5F_ACC_TRUNC);
 
     return true;
@@ -71,6 +97,28 @@ StatisticOutputHDF5::printUsage()
     out.output(" : Parameters:\n");
     out.output(" : help = Force Statistic Output to display usage\n");
     out.output(" : filepath = <Path to .h5 file> - Default is ./StatisticOutput.h5\n");
+    out.output(" : chunksize = <entries> - Entries of a statistic in each chunk of the file - Default is 1024\n");
+    out.output(" : compression = 0-9 - Deflate level of the datasets, 0 for none - Default is 7\n");
+    out.output(" : async = 0 | 1 - Format and write output on a background thread - Default is 0\n");
+    out.output(" : With more than one rank, each rank writes to <filepath>_<rank>, and <filepath> links to the\n");
+    out.output(" : files of all the ranks as /rank_<rank>\n");
+}
+
+void
+StatisticOutputHDF5::createRankLinks(const std::string& filePath, const std::vector<std::string>& rankFiles)
+{
+    // The links are only followed when read, so the rank files don't
+    // need to exist yet
+    H5::H5File linkFile(filePath, H5F_ACC_TRUNC);
+    for ( size_t rank = 0; rank < rankFiles.size(); rank++ ) {
+        // Relative to the directory of the linking file
+        const std::string& rankFile = rankFiles[rank];
+        size_t             slash    = rankFile.find_last_of("/");
+        std::string        target   = (std::string::npos == slash) ? rankFile : rankFile.substr(slash + 1);
+        std::string        name     = "rank_" + std::to_string(rank);
+        H5Lcreate_external(target.c_str(), "/", linkFile.getId(), name.c_str(), H5P_DEFAULT, H5P_DEFAULT);
+    }
+    linkFile.close();
 }
 
 void
@@ -103,7 +151,8 @@ StatisticOutputHDF5::startRegisterGroup(StatisticGroup* group)
 {
     StatisticFieldsOutput::startRegisterGroup(group);
     m_statGroups.emplace(
-        std::piecewise_construct, std::forward_as_tuple(group->name), std::forward_as_tuple(group, m_hFile));
+        std::piecewise_construct, std::forward_as_tuple(group->name),
+        std::forward_as_tuple(group, m_hFile, m_storage));
     m_currentDataSet = &m_statGroups.at(group->name);
     m_currentDataSet->beginGroupRegistration(group);
 }
@@ -124,6 +173,7 @@ void
 StatisticOutputHDF5::endOfSimulation()
 {
     for ( auto i : m_statistics ) {
+        i.second->flush();
         delete i.second;
     }
     delete m_hFile;
@@ -133,7 +183,7 @@ void
 StatisticOutputHDF5::implStartOutputEntries(StatisticBase* statistic)
 {
     if ( m_currentDataSet == nullptr ) m_currentDataSet = getStatisticInfo(statistic);
-    m_currentDataSet->startNewEntry(statistic);
+    m_currentDataSet->startNewEntry(statistic, getOutputSimTime());
 }
 
 void
@@ -148,7 +198,7 @@ StatisticOutputHDF5::startOutputGroup(StatisticGroup* group)
 {
     StatisticFieldsOutput::startOutputGroup(group);
     m_currentDataSet = &m_statGroups.at(group->name);
-    m_currentDataSet->startNewGroupEntry();
+    m_currentDataSet->startNewGroupEntry(getOutputSimTime());
 }
 
 void
@@ -195,10 +245,52 @@ StatisticOutputHDF5::outputField(fieldHandle_t fieldHandle, double data)
     m_currentDataSet->getFieldLoc(fieldHandle).d = data;
 }
 
+void
+StatisticOutputHDF5::outputFields(const fieldHandle_t* fieldHandles, const int32_t* data, size_t count)
+{
+    for ( size_t i = 0; i < count; i++ )
+        m_currentDataSet->getFieldLoc(fieldHandles[i]).i32 = data[i];
+}
+
+void
+StatisticOutputHDF5::outputFields(const fieldHandle_t* fieldHandles, const uint32_t* data, size_t count)
+{
+    for ( size_t i = 0; i < count; i++ )
+        m_currentDataSet->getFieldLoc(fieldHandles[i]).u32 = data[i];
+}
+
+void
+StatisticOutputHDF5::outputFields(const fieldHandle_t* fieldHandles, const int64_t* data, size_t count)
+{
+    for ( size_t i = 0; i < count; i++ )
+        m_currentDataSet->getFieldLoc(fieldHandles[i]).i64 = data[i];
+}
+
+void
+StatisticOutputHDF5::outputFields(const fieldHandle_t* fieldHandles, const uint64_t* data, size_t count)
+{
+    for ( size_t i = 0; i < count; i++ )
+        m_currentDataSet->getFieldLoc(fieldHandles[i]).u64 = data[i];
+}
+
+void
+StatisticOutputHDF5::outputFields(const fieldHandle_t* fieldHandles, const float* data, size_t count)
+{
+    for ( size_t i = 0; i < count; i++ )
+        m_currentDataSet->getFieldLoc(fieldHandles[i]).f = data[i];
+}
+
+void
+StatisticOutputHDF5::outputFields(const fieldHandle_t* fieldHandles, const double* data, size_t count)
+{
+    for ( size_t i = 0; i < count; i++ )
+        m_currentDataSet->getFieldLoc(fieldHandles[i]).d = data[i];
+}
+
 StatisticOutputHDF5::StatisticInfo*
 StatisticOutputHDF5::initStatistic(StatisticBase* statistic)
 {
-    StatisticInfo* si       = new StatisticInfo(statistic, m_hFile);
+    StatisticInfo* si       = new StatisticInfo(statistic, m_hFile, m_storage);
     m_statistics[statistic] = si;
     return si;
 }
@@ -210,20 +302,24 @@ StatisticOutputHDF5::getStatisticInfo(StatisticBase* statistic)
 }
 
 void
-StatisticOutputHDF5::StatisticInfo::startNewEntry(StatisticBase* UNUSED(stat))
+StatisticOutputHDF5::StatisticInfo::startNewEntry(StatisticBase* UNUSED(stat), SimTime_t sim_time)
 {
     for ( StatData_u& i : currentData ) {
         memset(&i, '\0', sizeof(i));
     }
-    currentData[0].u64 = Simulation_impl::getSimulation()->getCurrentSimCycle();
+    currentData[0].u64 = sim_time;
 }
 
 StatisticOutputHDF5::StatData_u&
 StatisticOutputHDF5::StatisticInfo::getFieldLoc(fieldHandle_t fieldHandle)
 {
     size_t nItems = indexMap.size();
-    for ( size_t i = 0; i < nItems; i++ ) {
-        if ( indexMap[i] == fieldHandle ) return currentData[i];
+    for ( size_t n = 1; n <= nItems; n++ ) {
+        size_t i = (lastIndex + n) % nItems;
+        if ( indexMap[i] == fieldHandle ) {
+            lastIndex = i;
+            return currentData[i];
+        }
     }
     Output::getDefaultObject().fatal(CALL_INFO, 1, "Attempting to access unregistered Field Handle\n");
     // Not reached
@@ -233,16 +329,30 @@ StatisticOutputHDF5::StatisticInfo::getFieldLoc(fieldHandle_t fieldHandle)
 void
 StatisticOutputHDF5::StatisticInfo::finishEntry()
 {
-    hsize_t dims[1]   = { 1 };
+    pendingData.insert(pendingData.end(), currentData.begin(), currentData.end());
+    // Matches the chunk size of the dataset
+    if ( ++nPending >= storage.chunkSize ) flush();
+}
+
+void
+StatisticOutputHDF5::StatisticInfo::flush()
+{
+    if ( nPending == 0 ) return;
+
+    hsize_t dims[1]   = { nPending };
     hsize_t offset[1] = { nEntries };
 
-    hsize_t newSize[1] = { ++nEntries };
+    nEntries += nPending;
+    hsize_t newSize[1] = { nEntries };
     dataset->extend(newSize);
 
     H5::DataSpace fspace = dataset->getSpace();
     H5::DataSpace memSpace(1, dims);
     fspace.selectHyperslab(H5S_SELECT_SET, dims, offset);
-    dataset->write(currentData.data(), *memType, memSpace, fspace);
+    dataset->write(pendingData.data(), *memType, memSpace, fspace);
+
+    pendingData.clear();
+    nPending = 0;
 }
 
 void
@@ -253,6 +363,18 @@ StatisticOutputHDF5::StatisticInfo::registerField(StatisticFieldInfo* fi)
     fieldNames.push_back(fi->getFieldName());
 }
 
+void
+StatisticOutputHDF5::Storage::setCreateParams(H5::DSetCreatPropList& cparms, int rank, const hsize_t* chunk_dims) const
+{
+    cparms.setChunk(rank, chunk_dims);
+    if ( compression > 0 ) {
+        // Grouping the bytes of the values by significance makes
+        // records of numbers compress much better
+        cparms.setShuffle();
+        cparms.setDeflate(compression);
+    }
+}
+
 static H5::DataType
 getMemTypeForStatType(StatisticOutput::fieldType_t type)
 {
@@ -320,9 +442,8 @@ StatisticOutputHDF5::StatisticInfo::finalizeCurrentStatistic()
     hsize_t               maxdims[1] = { H5S_UNLIMITED };
     H5::DataSpace         dspace(1, dims, maxdims);
     H5::DSetCreatPropList cparms;
-    hsize_t               chunk_dims[1] = { 1024 };
-    cparms.setChunk(1, chunk_dims);
-    cparms.setDeflate(7);
+    hsize_t               chunk_dims[1] = { storage.chunkSize };
+    storage.setCreateParams(cparms, 1, chunk_dims);
 
     dataset = new H5::DataSet(file->createDataSet(statName, *memType, dspace, cparms));
 
@@ -330,13 +451,15 @@ StatisticOutputHDF5::StatisticInfo::finalizeCurrentStatistic()
     fieldNames.clear();
 }
 
-StatisticOutputHDF5::GroupInfo::GroupInfo(StatisticGroup* group, H5::H5File* file) :
-    DataSet(file),
+StatisticOutputHDF5::GroupInfo::GroupInfo(StatisticGroup* group, H5::H5File* file, const Storage& storage) :
+    DataSet(file, storage),
     nEntries(0),
     m_statGroup(group)
 {
-    /* We need to store component pointers, not just IDs */
-    m_components.resize(m_statGroup->components.size());
+    /* We need to store component pointers, not just IDs.  A reducing
+     * group only outputs the components its statistics are reduced
+     * into, which are added as they register. */
+    if ( !m_statGroup->reduce ) m_components.resize(m_statGroup->components.size());
 
     /* Create group directory */
     std::string objName = "/" + getName();
@@ -361,6 +484,11 @@ StatisticOutputHDF5::GroupInfo::setCurrentStatistic(StatisticBase* stat)
     m_currentStat = &(m_statGroups.at(statName));
 
     /* Find and set in our m_components vector */
+    if ( m_statGroup->reduce ) {
+        if ( std::find(m_components.begin(), m_components.end(), stat->getComponent()) == m_components.end() )
+            m_components.push_back(stat->getComponent());
+        return;
+    }
     ComponentId_t id = stat->getComponent()->getId();
     for ( size_t i = 0; i < m_statGroup->components.size(); i++ ) {
         if ( m_statGroup->components.at(i) == id ) { m_components.at(i) = stat->getComponent(); }
@@ -423,12 +551,11 @@ StatisticOutputHDF5::GroupInfo::finalizeGroupRegistration()
     }
 
     H5::DSetCreatPropList cparms;
-    hsize_t               chunk_dims[1] = { std::min(m_statGroup->components.size(), (size_t)64) };
-    cparms.setChunk(1, chunk_dims);
-    cparms.setDeflate(7);
+    hsize_t               chunk_dims[1] = { std::min(m_components.size(), (size_t)64) };
+    storage.setCreateParams(cparms, 1, chunk_dims);
 
     /* Create arrays */
-    hsize_t       infoDim[1] = { m_statGroup->components.size() };
+    hsize_t       infoDim[1] = { m_components.size() };
     H5::DataSpace infoSpace(1, infoDim);
     H5::DataSet*  idSet =
         new H5::DataSet(getFile()->createDataSet(groupName + "/ids", H5::PredType::NATIVE_UINT64, infoSpace, cparms));
@@ -479,7 +606,7 @@ StatisticOutputHDF5::GroupInfo::finalizeGroupRegistration()
 }
 
 void
-StatisticOutputHDF5::GroupInfo::startNewGroupEntry()
+StatisticOutputHDF5::GroupInfo::startNewGroupEntry(SimTime_t sim_time)
 {
     /* Record current timestamp */
     for ( auto& gs : m_statGroups ) {
@@ -495,12 +622,12 @@ StatisticOutputHDF5::GroupInfo::startNewGroupEntry()
     H5::DataSpace fspace = timeDataSet->getSpace();
     H5::DataSpace memSpace(1, dims);
     fspace.selectHyperslab(H5S_SELECT_SET, dims, offset);
-    uint64_t currTime = Simulation_impl::getSimulation()->getCurrentSimCycle();
+    uint64_t currTime = sim_time;
     timeDataSet->write(&currTime, H5::PredType::NATIVE_UINT64, memSpace, fspace);
 }
 
 void
-StatisticOutputHDF5::GroupInfo::startNewEntry(StatisticBase* stat)
+StatisticOutputHDF5::GroupInfo::startNewEntry(StatisticBase* stat, SimTime_t UNUSED(sim_time))
 {
     m_currentStat = &(m_statGroups.at(GroupStat::getStatName(stat)));
     size_t compIndex =
@@ -575,8 +702,7 @@ StatisticOutputHDF5::GroupInfo::GroupStat::finalizeRegistration()
     H5::DataSpace         dspace(2, dims, maxdims);
     H5::DSetCreatPropList cparms;
     hsize_t               chunk_dims[2] = { std::min((hsize_t)16, dims[0]), 128 };
-    cparms.setChunk(2, chunk_dims);
-    cparms.setDeflate(7);
+    gi->storage.setCreateParams(cparms, 2, chunk_dims);
 
     dataset = new H5::DataSet(gi->getFile()->createDataSet(statPath, *memType, dspace, cparms));
 }
@@ -106,6 +106,19 @@ private:
     void outputField(fieldHandle_t fieldHandle, float data) override;
     void outputField(fieldHandle_t fieldHandle, double data) override;
 
+    /** Implementation functions for bulk output.
+     * These store a whole record of fields in one call.
+     * @param fieldHandles - The handles to the registered statistic fields.
+     * @param data - The data related to the registered fields to be output.
+     * @param count - The number of fields.
+     */
+    void outputFields(const fieldHandle_t* fieldHandles, const int32_t* data, size_t count) override;
+    void outputFields(const fieldHandle_t* fieldHandles, const uint32_t* data, size_t count) override;
+    void outputFields(const fieldHandle_t* fieldHandles, const int64_t* data, size_t count) override;
+    void outputFields(const fieldHandle_t* fieldHandles, const uint64_t* data, size_t count) override;
+    void outputFields(const fieldHandle_t* fieldHandles, const float* data, size_t count) override;
+    void outputFields(const fieldHandle_t* fieldHandles, const double* data, size_t count) override;
+
 protected:
     StatisticOutputHDF5() { ; } // For serialization
 
@@ -119,10 +132,22 @@ private:
         double   d;
     } StatData_u;
 
+    /** Layout of the datasets in the file */
+    struct Storage
+    {
+        // Entries in each chunk of a statistic's dataset
+        hsize_t chunkSize;
+        // Deflate level, or 0 for none
+        int compression;
+
+        /** Set the chunk dimensions and filters of a new dataset */
+        void setCreateParams(H5::DSetCreatPropList& cparms, int rank, const hsize_t* chunk_dims) const;
+    };
+
     class DataSet
     {
     public:
-        DataSet(H5::H5File* file) : file(file) {}
+        DataSet(H5::H5File* file, const Storage& storage) : file(file), storage(storage) {}
         virtual ~DataSet() {}
         H5::H5File*  getFile() { return file; }
         virtual bool isGroup() const = 0;
@@ -134,15 +159,16 @@ private:
         virtual void beginGroupRegistration(StatisticGroup* UNUSED(group)) {}
         virtual void finalizeGroupRegistration() {}
 
-        virtual void startNewGroupEntry() {}
+        virtual void startNewGroupEntry(SimTime_t UNUSED(sim_time)) {}
         virtual void finishGroupEntry() {}
 
-        virtual void        startNewEntry(StatisticBase* stat)     = 0;
+        virtual void        startNewEntry(StatisticBase* stat, SimTime_t sim_time) = 0;
         virtual StatData_u& getFieldLoc(fieldHandle_t fieldHandle) = 0;
         virtual void        finishEntry()                          = 0;
 
     protected:
-        H5::H5File* file;
+        H5::H5File*    file;
+        const Storage& storage;
     };
 
     class StatisticInfo : public DataSet
@@ -153,13 +179,28 @@ private:
         std::vector<fieldType_t>   typeList;
         std::vector<std::string>   fieldNames;
 
+        // Entries are collected here and written to the file a chunk
+        // at a time instead of extending the dataset for every entry
+        std::vector<StatData_u> pendingData;
+        hsize_t                 nPending;
+
+        // Index of the last field looked up.  Fields are almost always
+        // output in the order they were registered, so the search for
+        // the next one starts right after it.
+        size_t lastIndex;
+
         H5::DataSet*  dataset;
         H5::CompType* memType;
 
         hsize_t nEntries;
 
     public:
-        StatisticInfo(StatisticBase* stat, H5::H5File* file) : DataSet(file), statistic(stat), nEntries(0)
+        StatisticInfo(StatisticBase* stat, H5::H5File* file, const Storage& storage) :
+            DataSet(file, storage),
+            statistic(stat),
+            nPending(0),
+            lastIndex(0),
+            nEntries(0)
         {
             typeList.push_back(StatisticFieldType<uint64_t>::id());
             indexMap.push_back(-1);
@@ -174,9 +215,12 @@ private:
         void finalizeCurrentStatistic() override;
 
         bool        isGroup() const override { return false; }
-        void        startNewEntry(StatisticBase* stat) override;
+        void        startNewEntry(StatisticBase* stat, SimTime_t sim_time) override;
         StatData_u& getFieldLoc(fieldHandle_t fieldHandle) override;
         void        finishEntry() override;
+
+        /** Write any pending entries to the file */
+        void flush();
     };
 
     class GroupInfo : public DataSet
@@ -219,7 +263,7 @@ private:
         H5::DataSet*                     timeDataSet;
 
     public:
-        GroupInfo(StatisticGroup* group, H5::H5File* file);
+        GroupInfo(StatisticGroup* group, H5::H5File* file, const Storage& storage);
         void beginGroupRegistration(StatisticGroup* UNUSED(group)) override {}
         void setCurrentStatistic(StatisticBase* stat) override;
         void registerField(StatisticFieldInfo* fi) override;
@@ -227,11 +271,11 @@ private:
         void finalizeGroupRegistration() override;
 
         bool        isGroup() const override { return true; }
-        void        startNewEntry(StatisticBase* stat) override;
+        void        startNewEntry(StatisticBase* stat, SimTime_t sim_time) override;
         StatData_u& getFieldLoc(fieldHandle_t fieldHandle) override { return m_currentStat->getFieldLoc(fieldHandle); }
         void        finishEntry() override;
 
-        void   startNewGroupEntry() override;
+        void   startNewGroupEntry(SimTime_t sim_time) override;
         void   finishGroupEntry() override;
         size_t getNumComponents() const { return m_components.size(); }
 
@@ -239,12 +283,16 @@ private:
     };
 
     H5::H5File*                              m_hFile;
+    Storage                                  m_storage;
     DataSet*                                 m_currentDataSet;
     std::map<StatisticBase*, StatisticInfo*> m_statistics;
     std::map<std::string, GroupInfo>         m_statGroups;
 
     StatisticInfo* initStatistic(StatisticBase* statistic);
     StatisticInfo* getStatisticInfo(StatisticBase* statistic);
+
+    /** Link the files of all the ranks into the file at filePath */
+    void createRankLinks(const std::string& filePath, const std::vector<std::string>& rankFiles);
 };
 
 } // namespace Statistics
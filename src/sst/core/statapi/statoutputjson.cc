@@ -48,9 +48,10 @@ StatisticOutputJSON::checkOutputParameters()
     if ( true == foundKey ) { return false; }
 
     // Get the parameters
-    m_FilePath  = getOutputParameters().find<std::string>("filepath", "./StatisticOutput.json");
-    simTimeFlag = getOutputParameters().find<std::string>("outputsimtime", "1");
-    rankFlag    = getOutputParameters().find<std::string>("outputrank", "1");
+    m_FilePath   = getOutputParameters().find<std::string>("filepath", "./StatisticOutput.json");
+    simTimeFlag  = getOutputParameters().find<std::string>("outputsimtime", "1");
+    rankFlag     = getOutputParameters().find<std::string>("outputrank", "1");
+    m_bufferSize = getOutputParameters().find<size_t>("buffersize", 65536);
 
     m_outputSimTime = ("1" == simTimeFlag);
     m_outputRank    = ("1" == rankFlag);
@@ -74,6 +75,8 @@ StatisticOutputJSON::printUsage()
     out.output(" : filepath = <Path to .csv file> - Default is ./StatisticOutput.csv\n");
     out.output(" : outputsimtime = 0 | 1 - Output Simulation Time - Default is 1\n");
     out.output(" : outputrank = 0 | 1 - Output Rank - Default is 1\n");
+    out.output(" : buffersize = <bytes> - Size of the blocks written to the file - Default is 65536\n");
+    out.output(" : async = 0 | 1 - Format and write output on a background thread - Default is 0\n");
 }
 
 void
@@ -82,18 +85,20 @@ StatisticOutputJSON::startOfSimulation()
     // Open the finalized filename
     if ( !openFile() ) return;
 
-    fprintf(m_hFile, "{\n");
+    m_writeBuffer += "{\n";
     m_curIndentLevel++;
 
     if ( 1 < Simulation_impl::getSimulation()->getNumRanks().rank ) {
         const int thisRank = Simulation_impl::getSimulation()->getRank().rank;
 
         printIndent();
-        fprintf(m_hFile, "\"rank\" : %d,\n\n", thisRank);
+        m_writeBuffer += "\"rank\" : ";
+        appendFormatted(m_writeBuffer, thisRank);
+        m_writeBuffer += ",\n\n";
     }
 
     printIndent();
-    fprintf(m_hFile, "\"components\" : [\n");
+    m_writeBuffer += "\"components\" : [\n";
     m_curIndentLevel++;
 }
 
@@ -101,21 +106,22 @@ void
 StatisticOutputJSON::endOfSimulation()
 {
     if ( m_processedAnyStats ) {
-        fprintf(m_hFile, "\n");
+        m_writeBuffer += "\n";
         m_curIndentLevel--;
         printIndent();
-        fprintf(m_hFile, "]\n");
+        m_writeBuffer += "]\n";
         m_curIndentLevel--;
         printIndent();
-        fprintf(m_hFile, "}\n");
+        m_writeBuffer += "}\n";
         m_curIndentLevel--;
     }
 
     printIndent();
-    fprintf(m_hFile, "]\n");
-    fprintf(m_hFile, "}\n");
+    m_writeBuffer += "]\n";
+    m_writeBuffer += "}\n";
 
     // Close the file
+    flushBuffer();
     closeFile();
 }
 
@@ -126,22 +132,24 @@ StatisticOutputJSON::implStartOutputEntries(StatisticBase* statistic)
         if ( m_currentComponentName != "" ) {
             m_curIndentLevel--;
 
-            fprintf(m_hFile, "\n");
+            m_writeBuffer += "\n";
             printIndent();
-            fprintf(m_hFile, "]\n");
+            m_writeBuffer += "]\n";
             m_curIndentLevel--;
             printIndent();
-            fprintf(m_hFile, "},\n");
+            m_writeBuffer += "},\n";
         }
 
         printIndent();
-        fprintf(m_hFile, "{\n");
+        m_writeBuffer += "{\n";
         m_curIndentLevel++;
         printIndent();
-        fprintf(m_hFile, "\"name\" : \"%s\",\n", statistic->getCompName().c_str());
+        m_writeBuffer += "\"name\" : \"";
+        m_writeBuffer += statistic->getCompName();
+        m_writeBuffer += "\",\n";
 
         printIndent();
-        fprintf(m_hFile, "\"statistics\" : [\n");
+        m_writeBuffer += "\"statistics\" : [\n";
 
         m_curIndentLevel++;
         m_firstEntry = true;
@@ -155,11 +163,13 @@ StatisticOutputJSON::implStartOutputEntries(StatisticBase* statistic)
 
     if ( m_firstEntry ) { m_firstEntry = false; }
     else {
-        fprintf(m_hFile, ",\n");
+        m_writeBuffer += ",\n";
     }
 
     printIndent();
-    fprintf(m_hFile, "{ \"stat\" : \"%s\", \"values\" : [ ", statistic->getStatName().c_str());
+    m_writeBuffer += "{ \"stat\" : \"";
+    m_writeBuffer += statistic->getStatName();
+    m_writeBuffer += "\", \"values\" : [ ";
 
     m_processedAnyStats = true;
     m_firstField        = true;
@@ -168,67 +178,59 @@ StatisticOutputJSON::implStartOutputEntries(StatisticBase* statistic)
 void
 StatisticOutputJSON::implStopOutputEntries()
 {
-    fprintf(m_hFile, " ] }");
+    m_writeBuffer += " ] }";
+
+    // Sent to the file in blocks of at least m_bufferSize bytes
+    if ( m_writeBuffer.size() >= m_bufferSize ) { flushBuffer(); }
 }
 
+template <typename T>
 void
-StatisticOutputJSON::outputField(fieldHandle_t UNUSED(fieldHandle), int32_t data)
+StatisticOutputJSON::formatField(T data)
 {
-    if ( !m_firstField ) { fprintf(m_hFile, ", "); }
+    if ( !m_firstField ) { m_writeBuffer += ", "; }
 
-    fprintf(m_hFile, "%" PRId32, data);
+    appendFormatted(m_writeBuffer, data);
 
     m_firstField = false;
 }
 
 void
-StatisticOutputJSON::outputField(fieldHandle_t UNUSED(fieldHandle), uint32_t data)
+StatisticOutputJSON::outputField(fieldHandle_t UNUSED(fieldHandle), int32_t data)
 {
-    if ( !m_firstField ) { fprintf(m_hFile, ", "); }
-
-    fprintf(m_hFile, "%" PRIu32, data);
+    formatField(data);
+}
 
-    m_firstField = false;
+void
+StatisticOutputJSON::outputField(fieldHandle_t UNUSED(fieldHandle), uint32_t data)
+{
+    formatField(data);
 }
 
 void
 StatisticOutputJSON::outputField(fieldHandle_t UNUSED(fieldHandle), int64_t data)
 {
-    if ( !m_firstField ) { fprintf(m_hFile, ", "); }
-
-    fprintf(m_hFile, "%" PRId64, data);
-
-    m_firstField = false;
+    formatField(data);
 }
 
 void
 StatisticOutputJSON::outputField(fieldHandle_t UNUSED(fieldHandle), uint64_t data)
 {
-    if ( !m_firstField ) { fprintf(m_hFile, ", "); }
-
-    fprintf(m_hFile, "%" PRIu64, data);
-
-    m_firstField = false;
+    formatField(data);
 }
 
 void
 StatisticOutputJSON::outputField(fieldHandle_t UNUSED(fieldHandle), float data)
 {
-    if ( !m_firstField ) { fprintf(m_hFile, ", "); }
-
-    fprintf(m_hFile, "%f ", data);
-
-    m_firstField = false;
+    formatField(data);
+    m_writeBuffer += " ";
 }
 
 void
 StatisticOutputJSON::outputField(fieldHandle_t UNUSED(fieldHandle), double data)
 {
-    if ( !m_firstField ) { fprintf(m_hFile, ", "); }
-
-    fprintf(m_hFile, "%f ", data);
-
-    m_firstField = false;
+    formatField(data);
+    m_writeBuffer += " ";
 }
 
 bool
@@ -254,11 +256,19 @@ StatisticOutputJSON::closeFile(void)
     fclose(m_hFile);
 }
 
+void
+StatisticOutputJSON::flushBuffer()
+{
+    if ( m_writeBuffer.empty() ) return;
+    fwrite(m_writeBuffer.data(), 1, m_writeBuffer.size(), m_hFile);
+    m_writeBuffer.clear();
+}
+
 void
 StatisticOutputJSON::printIndent()
 {
     for ( int i = 0; i < m_curIndentLevel; ++i ) {
-        fprintf(m_hFile, "   ");
+        m_writeBuffer += "   ";
     }
 }
 
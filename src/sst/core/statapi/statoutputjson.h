@@ -94,9 +94,15 @@ protected:
 private:
     bool openFile();
     void closeFile();
+    void flushBuffer();
+
+    template <typename T>
+    void formatField(T data);
 
 private:
     FILE*       m_hFile;
+    std::string m_writeBuffer;
+    size_t      m_bufferSize;
     std::string m_FilePath;
     std::string m_currentComponentName;
     std::string m_currentStatisticName;
@@ -0,0 +1,306 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/statapi/statoutputshm.h"
+
+#include "sst/core/interprocess/shmregion.h"
+#include "sst/core/simulation_impl.h"
+#include "sst/core/statapi/statbase.h"
+#include "sst/core/timeLord.h"
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <fnmatch.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace SST {
+namespace Statistics {
+
+StatisticOutputShm::StatisticOutputShm(Params& outputParameters) :
+    StatisticFieldsOutput(outputParameters),
+    m_region(nullptr),
+    m_regionSize(0),
+    m_header(nullptr),
+    m_entries(nullptr),
+    m_names(nullptr),
+    m_namesUsed(0),
+    m_warnedFull(false),
+    m_current(nullptr),
+    m_currentStat(nullptr),
+    m_currentField(0)
+{
+    // Announce this output object's name
+    Output& out = Simulation_impl::getSimulationOutput();
+    out.verbose(CALL_INFO, 1, 0, " : StatisticOutputShm enabled...\n");
+    setStatisticOutputName("StatisticOutputShm");
+}
+
+bool
+StatisticOutputShm::checkOutputParameters()
+{
+    bool foundKey;
+
+    // Look for Help Param
+    getOutputParameters().find<std::string>("help", "1", foundKey);
+    if ( true == foundKey ) { return false; }
+
+    m_name       = getOutputParameters().find<std::string>("name", "/sst_stats_" + std::to_string(getpid()));
+    m_maxEntries = getOutputParameters().find<uint32_t>("max_entries", 4096);
+    m_namesSize  = getOutputParameters().find<size_t>("names_size", 262144);
+    m_unlink     = getOutputParameters().find<bool>("unlink", true);
+
+    std::string patterns = getOutputParameters().find<std::string>("statistics", "*");
+    size_t      start    = 0;
+    while ( start <= patterns.size() ) {
+        size_t end = patterns.find(',', start);
+        if ( end == std::string::npos ) end = patterns.size();
+        if ( end > start ) m_patterns.push_back(patterns.substr(start, end - start));
+        start = end + 1;
+    }
+
+    if ( m_name.empty() || m_maxEntries == 0 || m_namesSize == 0 ) { return false; }
+
+    // shm_open() names start with a single slash
+    if ( m_name[0] != '/' ) m_name = "/" + m_name;
+    return true;
+}
+
+void
+StatisticOutputShm::printUsage()
+{
+    // Display how to use this output object
+    Output out("", 0, 0, Output::STDOUT);
+    out.output(" : Usage - Publishes the latest statistic values in a shared memory region.\n");
+    out.output(" : Parameters:\n");
+    out.output(" : help = Force Statistic Output to display usage\n");
+    out.output(" : name = <Name of the shared memory region> - Default is /sst_stats_<pid>, the rank is appended when "
+               "there is more than one\n");
+    out.output(" : statistics = <Comma separated list of component.statistic patterns> - Default is *\n");
+    out.output(" : max_entries = <Number of values the region holds> - Default is 4096\n");
+    out.output(" : names_size = <Bytes reserved for the names of the values> - Default is 262144\n");
+    out.output(" : unlink = 0 | 1 - Remove the region at the end of the simulation - Default is 1\n");
+    out.output(" : async = 0 | 1 - Update the region on a background thread - Default is 0\n");
+}
+
+void
+StatisticOutputShm::startOfSimulation()
+{
+    Output&  out  = Simulation_impl::getSimulationOutput();
+    uint32_t rank = Simulation_impl::getSimulation()->getRank().rank;
+    if ( 1 < Simulation_impl::getSimulation()->getNumRanks().rank ) { m_name += "_" + std::to_string(rank); }
+
+    // A region left by an earlier run with the same name is replaced
+    int fd = shm_open(m_name.c_str(), O_RDWR | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR);
+    if ( fd < 0 ) {
+        out.fatal(
+            CALL_INFO, 1, " : StatisticOutputShm - Problem creating shared memory region %s - %s\n", m_name.c_str(),
+            strerror(errno));
+    }
+
+    size_t entries_offset = (sizeof(ShmHeader) + 63) / 64 * 64;
+    size_t names_offset   = entries_offset + sizeof(ShmEntry) * m_maxEntries;
+    m_regionSize          = Core::Interprocess::RegionUtil::roundToPageSize(fd, names_offset + m_namesSize);
+
+    if ( ftruncate(fd, m_regionSize) ) {
+        out.fatal(
+            CALL_INFO, 1, " : StatisticOutputShm - Problem resizing shared memory region %s - %s\n", m_name.c_str(),
+            strerror(errno));
+    }
+    m_region = mmap(nullptr, m_regionSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if ( m_region == MAP_FAILED ) {
+        out.fatal(
+            CALL_INFO, 1, " : StatisticOutputShm - Problem mapping shared memory region %s - %s\n", m_name.c_str(),
+            strerror(errno));
+    }
+
+    // The region is zero filled, so only the layout needs to be set.
+    // The magic goes in last, so a monitor that finds it can trust the
+    // rest of the header.
+    m_header                 = static_cast<ShmHeader*>(m_region);
+    m_entries                = reinterpret_cast<ShmEntry*>(static_cast<char*>(m_region) + entries_offset);
+    m_names                  = static_cast<char*>(m_region) + names_offset;
+    m_header->version        = SHM_VERSION;
+    m_header->rank           = rank;
+    m_header->region_size    = m_regionSize;
+    m_header->entries_offset = entries_offset;
+    m_header->names_offset   = names_offset;
+    m_header->names_size     = m_regionSize - names_offset;
+    m_header->max_entries    = m_maxEntries;
+    snprintf(
+        m_header->time_base, sizeof(m_header->time_base), "%s",
+        Simulation_impl::getTimeLord()->getTimeBase().toStringBestSI().c_str());
+    m_namesSize = m_header->names_size;
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    memcpy(m_header->magic, SHM_MAGIC, sizeof(SHM_MAGIC));
+}
+
+void
+StatisticOutputShm::endOfSimulation()
+{
+    if ( m_header == nullptr ) return;
+
+    beginUpdate();
+    __atomic_store_n(&m_header->finished, 1, __ATOMIC_RELAXED);
+    endUpdate();
+
+    munmap(m_region, m_regionSize);
+    m_header = nullptr;
+    if ( m_unlink ) shm_unlink(m_name.c_str());
+}
+
+bool
+StatisticOutputShm::isSelected(StatisticBase* statistic) const
+{
+    std::string name = statistic->getCompName() + "." + statistic->getStatName();
+    for ( auto& pattern : m_patterns ) {
+        if ( fnmatch(pattern.c_str(), name.c_str(), 0) == 0 ) return true;
+    }
+    return false;
+}
+
+void
+StatisticOutputShm::beginUpdate()
+{
+    // Odd while writing.  The fence keeps the writes to the values
+    // from being seen before the sequence number changes.
+    uint64_t seq = m_header->seq;
+    __atomic_store_n(&m_header->seq, seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    __atomic_store_n(&m_header->sim_time, getOutputSimTime(), __ATOMIC_RELAXED);
+}
+
+void
+StatisticOutputShm::endUpdate()
+{
+    __atomic_store_n(&m_header->seq, m_header->seq + 1, __ATOMIC_RELEASE);
+}
+
+void
+StatisticOutputShm::implStartOutputEntries(StatisticBase* statistic)
+{
+    auto it = m_stats.find(statistic);
+    if ( it == m_stats.end() ) {
+        it                  = m_stats.emplace(statistic, StatEntries_t()).first;
+        it->second.selected = m_header != nullptr && isSelected(statistic);
+    }
+
+    m_current      = it->second.selected ? &it->second : nullptr;
+    m_currentStat  = statistic;
+    m_currentField = 0;
+    if ( m_current != nullptr ) beginUpdate();
+}
+
+void
+StatisticOutputShm::implStopOutputEntries()
+{
+    if ( m_current != nullptr ) endUpdate();
+    m_current = nullptr;
+}
+
+StatisticOutputShm::ShmEntry*
+StatisticOutputShm::getEntry(fieldHandle_t fieldHandle, uint32_t type)
+{
+    // Statistics output their fields in the same order every time, so
+    // the entry is normally the next one
+    auto&  entries = m_current->entries;
+    size_t index   = m_currentField++;
+    if ( index >= entries.size() || entries[index].first != fieldHandle ) {
+        index = entries.size();
+        for ( size_t i = 0; i < entries.size(); ++i ) {
+            if ( entries[i].first == fieldHandle ) index = i;
+        }
+    }
+    if ( index < entries.size() ) {
+        return entries[index].second < m_maxEntries ? &m_entries[entries[index].second] : nullptr;
+    }
+
+    // First time the field is output, so give it an entry.  One that
+    // doesn't fit is remembered as such, so it isn't tried again.
+    std::string name = m_currentStat->getCompName() + "." + m_currentStat->getStatName();
+    if ( !m_currentStat->getStatSubId().empty() ) name += "." + m_currentStat->getStatSubId();
+    StatisticFieldInfo* info = getRegisteredField(fieldHandle);
+    name += "." + (info != nullptr ? info->getFieldName() : std::to_string(fieldHandle));
+
+    uint32_t count = m_header->num_entries;
+    if ( count >= m_maxEntries || m_namesUsed + name.size() + 1 > m_namesSize ) {
+        if ( !m_warnedFull ) {
+            Simulation_impl::getSimulationOutput().output(
+                "WARNING: StatisticOutputShm region %s is full, %s and any later values will not be published\n",
+                m_name.c_str(), name.c_str());
+            m_warnedFull = true;
+        }
+        entries.emplace_back(fieldHandle, m_maxEntries);
+        return nullptr;
+    }
+
+    memcpy(m_names + m_namesUsed, name.c_str(), name.size() + 1);
+    m_entries[count].name_offset = m_namesUsed;
+    m_entries[count].type        = type;
+    m_namesUsed += name.size() + 1;
+    __atomic_store_n(&m_header->num_entries, count + 1, __ATOMIC_RELAXED);
+    entries.emplace_back(fieldHandle, count);
+    return &m_entries[count];
+}
+
+void
+StatisticOutputShm::storeValue(fieldHandle_t fieldHandle, uint32_t type, uint64_t bits)
+{
+    if ( m_current == nullptr ) return;
+    ShmEntry* entry = getEntry(fieldHandle, type);
+    if ( entry != nullptr ) __atomic_store_n(&entry->value, bits, __ATOMIC_RELAXED);
+}
+
+void
+StatisticOutputShm::outputField(fieldHandle_t fieldHandle, int32_t data)
+{
+    storeValue(fieldHandle, SHM_INT64, static_cast<uint64_t>(static_cast<int64_t>(data)));
+}
+
+void
+StatisticOutputShm::outputField(fieldHandle_t fieldHandle, uint32_t data)
+{
+    storeValue(fieldHandle, SHM_UINT64, data);
+}
+
+void
+StatisticOutputShm::outputField(fieldHandle_t fieldHandle, int64_t data)
+{
+    storeValue(fieldHandle, SHM_INT64, static_cast<uint64_t>(data));
+}
+
+void
+StatisticOutputShm::outputField(fieldHandle_t fieldHandle, uint64_t data)
+{
+    storeValue(fieldHandle, SHM_UINT64, data);
+}
+
+void
+StatisticOutputShm::outputField(fieldHandle_t fieldHandle, float data)
+{
+    outputField(fieldHandle, static_cast<double>(data));
+}
+
+void
+StatisticOutputShm::outputField(fieldHandle_t fieldHandle, double data)
+{
+    uint64_t bits;
+    memcpy(&bits, &data, sizeof(bits));
+    storeValue(fieldHandle, SHM_DOUBLE, bits);
+}
+
+} // namespace Statistics
+} // namespace SST
@@ -0,0 +1,187 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_STATAPI_STATOUTPUTSHM_H
+#define SST_CORE_STATAPI_STATOUTPUTSHM_H
+
+#include "sst/core/sst_types.h"
+#include "sst/core/statapi/statoutput.h"
+
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace SST {
+namespace Statistics {
+
+/**
+    \class StatisticOutputShm
+
+    The class for publishing the latest statistic values in a shared
+    memory region, for monitors to read while the simulation runs.
+
+    Nothing is written to a file.  Each value a statistic outputs is
+    stored in an entry of the region, which is overwritten the next
+    time the statistic is output.  Entries are added the first time a
+    field of a statistic is output and are never removed, so the index
+    of an entry doesn't change once a monitor has found it.
+
+    The region is opened with shm_open() and is laid out as a
+    ShmHeader, followed by the array of ShmEntry and then the names of
+    the entries.  All values are in the byte order of the machine
+    running the simulation.  The names are NUL terminated strings of
+    the form component.statistic[.subid].field.
+
+    Updates are protected by a sequence lock.  seq is odd while the
+    simulation is writing, and is incremented again when it is done.
+    A monitor takes a consistent snapshot without ever blocking the
+    simulation by:
+
+        1. loading seq (acquire), and starting again while it is odd
+        2. copying num_entries, sim_time, finished and the values
+        3. an acquire fence, then loading seq again, and starting over
+           if it changed
+
+    An entry's name and type are written before num_entries includes
+    it, and never change afterwards.
+*/
+class StatisticOutputShm : public StatisticFieldsOutput
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        StatisticOutput,
+        StatisticOutputShm,
+        "sst",
+        "statoutputshm",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Publish the latest statistic values in shared memory")
+
+    /** Identifies the region, and the version of its layout */
+    static constexpr char     SHM_MAGIC[8] = { 'S', 'S', 'T', 'S', 'T', 'A', 'T', 'S' };
+    static constexpr uint32_t SHM_VERSION  = 1;
+
+    /** Type of the value held by an entry */
+    enum ShmValueType : uint32_t { SHM_INT64 = 0, SHM_UINT64 = 1, SHM_DOUBLE = 2 };
+
+    /** Start of the region */
+    struct ShmHeader
+    {
+        char     magic[8];
+        uint32_t version;
+        uint32_t rank;
+        uint64_t region_size;
+        uint64_t entries_offset; /*!< Offset of the first ShmEntry */
+        uint64_t names_offset;   /*!< Offset of the names */
+        uint64_t names_size;
+        uint32_t max_entries;
+        uint32_t num_entries; /*!< Written under the sequence lock */
+        char     time_base[32];
+        uint64_t seq;
+        uint64_t sim_time; /*!< In units of time_base, written under the sequence lock */
+        uint64_t finished; /*!< 1 once the simulation has ended, written under the sequence lock */
+    };
+
+    /** One published value */
+    struct ShmEntry
+    {
+        uint32_t name_offset; /*!< Offset of the name from names_offset */
+        uint32_t type;        /*!< A ShmValueType */
+        uint64_t value;       /*!< Bits of the value, written under the sequence lock */
+    };
+
+    /** Construct a StatisticOutputShm
+     * @param outputParameters - Parameters used for this Statistic Output
+     */
+    StatisticOutputShm(Params& outputParameters);
+
+protected:
+    /** Perform a check of provided parameters
+     * @return True if all required parameters and options are acceptable
+     */
+    bool checkOutputParameters() override;
+
+    /** Print out usage for this Statistic Output */
+    void printUsage() override;
+
+    /** Create the region */
+    void startOfSimulation() override;
+
+    /** Mark the region finished, and remove it if asked to */
+    void endOfSimulation() override;
+
+    /** Implementation function for the start of output.
+     * Starts an update of the region, if the statistic is published.
+     * @param statistic - Pointer to the statistic object than the output can
+     * retrieve data from.
+     */
+    void implStartOutputEntries(StatisticBase* statistic) override;
+
+    /** Implementation function for the end of output.
+     * Finishes the update of the region.
+     */
+    void implStopOutputEntries() override;
+
+    /** Implementation functions for output.
+     * These will be called by the statistic to provide Statistic defined
+     * data to be output.
+     * @param fieldHandle - The handle to the registered statistic field.
+     * @param data - The data related to the registered field to be output.
+     */
+    void outputField(fieldHandle_t fieldHandle, int32_t data) override;
+    void outputField(fieldHandle_t fieldHandle, uint32_t data) override;
+    void outputField(fieldHandle_t fieldHandle, int64_t data) override;
+    void outputField(fieldHandle_t fieldHandle, uint64_t data) override;
+    void outputField(fieldHandle_t fieldHandle, float data) override;
+    void outputField(fieldHandle_t fieldHandle, double data) override;
+
+protected:
+    StatisticOutputShm() { ; } // For serialization
+
+private:
+    // The entries of a statistic, in the order its fields are output
+    struct StatEntries_t
+    {
+        bool                                            selected;
+        std::vector<std::pair<fieldHandle_t, uint32_t>> entries;
+    };
+
+    bool      isSelected(StatisticBase* statistic) const;
+    ShmEntry* getEntry(fieldHandle_t fieldHandle, uint32_t type);
+    void      storeValue(fieldHandle_t fieldHandle, uint32_t type, uint64_t bits);
+    void      beginUpdate();
+    void      endUpdate();
+
+private:
+    std::string              m_name;
+    std::vector<std::string> m_patterns;
+    uint32_t                 m_maxEntries;
+    size_t                   m_namesSize;
+    bool                     m_unlink;
+
+    void*      m_region;
+    size_t     m_regionSize;
+    ShmHeader* m_header;
+    ShmEntry*  m_entries;
+    char*      m_names;
+    size_t     m_namesUsed;
+    bool       m_warnedFull;
+
+    std::unordered_map<StatisticBase*, StatEntries_t> m_stats;
+    StatEntries_t*                                    m_current;
+    StatisticBase*                                    m_currentStat;
+    size_t                                            m_currentField;
+};
+
+} // namespace Statistics
+} // namespace SST
+
+#endif // SST_CORE_STATAPI_STATOUTPUTSHM_H
@@ -40,6 +40,8 @@ StatisticOutputTextBase::checkOutputParameters()
     m_outputRank         = params.find<bool>("outputrank", getOutputRankDefault());
 
     m_useCompression = false;
+    m_mergeRanks     = false;
+    m_bufferSize     = 0; // The console is written a line at a time
 
     if ( outputsToFile() ) {
         m_FilePath = params.find<std::string>("filepath", getDefaultFileName());
@@ -51,6 +53,8 @@ StatisticOutputTextBase::checkOutputParameters()
         }
 
         if ( supportsCompression() ) { m_useCompression = params.find<bool>("compressed", false); }
+        m_mergeRanks = params.find<bool>("mergeranks", false);
+        m_bufferSize = params.find<size_t>("buffersize", 65536);
     }
 
     return true;
@@ -69,11 +73,14 @@ StatisticOutputTextBase::printUsage()
         if ( supportsCompression() ) {
             out.output(" : compressed = <0|1> - Compresses output file when enabled - Default is 0\n");
         }
+        out.output(" : mergeranks = <0|1> - Merge the per rank files into one at the end of simulation - Default is 0\n");
+        out.output(" : buffersize = <bytes> - Size of the blocks written to the file - Default is 65536\n");
     }
     out.output(" : outputtopheader = <0|1> - Output Header at Top - Default is 0\n");
     out.output(" : outputinlineheader = <0|1>  - Output Header inline - Default is 1\n");
     out.output(" : outputsimtime = 0 | 1 - Output Simulation Time - Default is 1\n");
     out.output(" : outputrank = 0 | 1 - Output Rank - Default is 1\n");
+    out.output(" : async = 0 | 1 - Format and write output on a background thread - Default is 0\n");
 }
 
 void
@@ -87,6 +94,8 @@ StatisticOutputTextBase::startOfSimulation()
         int         rank    = Simulation_impl::getSimulation()->getRank().rank;
         std::string rankstr = "_" + std::to_string(rank);
 
+        m_mergedFilePath = m_FilePath;
+
         // Search for any extension
         size_t index = m_FilePath.find_last_of(".");
         if ( std::string::npos != index ) {
@@ -142,47 +151,38 @@ void
 StatisticOutputTextBase::endOfSimulation()
 {
     // Close the file
+    flushBuffer();
     closeFile();
+
+    if ( m_mergeRanks && 1 < Simulation_impl::getSimulation()->getNumRanks().rank ) {
+        mergeRankFiles(m_FilePath, m_mergedFilePath);
+    }
 }
 
 
 void
 StatisticOutputTextBase::implStartOutputEntries(StatisticBase* statistic)
 {
-    std::string buffer;
-
-    // Starting Output
-    // m_outputBuffer.clear();
-    m_outputBuffer = getStartOutputPrefix();
-
-    m_outputBuffer += statistic->getFullStatName();
-    m_outputBuffer += " : ";
-    m_outputBuffer += statistic->getStatTypeName();
-    m_outputBuffer += " : ";
+    // Each line is built at the end of the write buffer, which is sent
+    // to the file in blocks of at least m_bufferSize bytes
+    m_writeBuffer += getStartOutputPrefix();
+
+    m_writeBuffer += statistic->getFullStatName();
+    m_writeBuffer += " : ";
+    m_writeBuffer += statistic->getStatTypeName();
+    m_writeBuffer += " : ";
     if ( true == m_outputSimTime ) {
         // Add the Simulation Time to the front
-        if ( true == m_outputInlineHeader ) {
-            buffer = format_string("SimTime = %" PRIu64, Simulation_impl::getSimulation()->getCurrentSimCycle());
-        }
-        else {
-            buffer = format_string("%" PRIu64, Simulation_impl::getSimulation()->getCurrentSimCycle());
-        }
-
-        m_outputBuffer += buffer;
-        m_outputBuffer += "; ";
+        if ( true == m_outputInlineHeader ) { m_writeBuffer += "SimTime = "; }
+        appendFormatted(m_writeBuffer, getOutputSimTime());
+        m_writeBuffer += "; ";
     }
 
     if ( true == m_outputRank ) {
         // Add the Rank to the front
-        if ( true == m_outputInlineHeader ) {
-            buffer = format_string("Rank = %d", Simulation_impl::getSimulation()->getRank().rank);
-        }
-        else {
-            buffer = format_string("%d", Simulation_impl::getSimulation()->getRank().rank);
-        }
-
-        m_outputBuffer += buffer;
-        m_outputBuffer += "; ";
+        if ( true == m_outputInlineHeader ) { m_writeBuffer += "Rank = "; }
+        appendFormatted(m_writeBuffer, getOutputRank());
+        m_writeBuffer += "; ";
     }
 }
 
@@ -190,131 +190,64 @@ void
 StatisticOutputTextBase::implStopOutputEntries()
 {
     // Done with Output
-    print("%s\n", m_outputBuffer.c_str());
+    m_writeBuffer += "\n";
+    if ( m_writeBuffer.size() >= m_bufferSize ) { flushBuffer(); }
 }
 
-
+template <typename T>
 void
-StatisticOutputTextBase::outputField(fieldHandle_t fieldHandle, int32_t data)
+StatisticOutputTextBase::formatField(fieldHandle_t fieldHandle, T data)
 {
-    std::string         buffer;
     StatisticFieldInfo* FieldInfo = getRegisteredField(fieldHandle);
 
     if ( nullptr != FieldInfo ) {
-        const char* typeName = getFieldTypeShortName(FieldInfo->getFieldType());
-
         if ( true == m_outputInlineHeader ) {
-            buffer = format_string("%s.%s = %" PRId32, FieldInfo->getFieldName().c_str(), typeName, data);
+            m_writeBuffer += FieldInfo->getFieldName();
+            m_writeBuffer += ".";
+            m_writeBuffer += getFieldTypeShortName(FieldInfo->getFieldType());
+            m_writeBuffer += " = ";
         }
-        else {
-            buffer = format_string("%" PRId32, data);
-        }
-        m_outputBuffer += buffer;
-        m_outputBuffer += "; ";
+        appendFormatted(m_writeBuffer, data);
+        m_writeBuffer += "; ";
     }
 }
 
 void
-StatisticOutputTextBase::outputField(fieldHandle_t fieldHandle, uint32_t data)
+StatisticOutputTextBase::outputField(fieldHandle_t fieldHandle, int32_t data)
 {
-    std::string         buffer;
-    StatisticFieldInfo* FieldInfo = getRegisteredField(fieldHandle);
-
-    if ( nullptr != FieldInfo ) {
-        const char* typeName = getFieldTypeShortName(FieldInfo->getFieldType());
+    formatField(fieldHandle, data);
+}
 
-        if ( true == m_outputInlineHeader ) {
-            buffer = format_string("%s.%s = %" PRIu32, FieldInfo->getFieldName().c_str(), typeName, data);
-        }
-        else {
-            buffer = format_string("%" PRIu32, data);
-        }
-        m_outputBuffer += buffer;
-        m_outputBuffer += "; ";
-    }
+void
+StatisticOutputTextBase::outputField(fieldHandle_t fieldHandle, uint32_t data)
+{
+    formatField(fieldHandle, data);
 }
 
 void
 StatisticOutputTextBase::outputField(fieldHandle_t fieldHandle, int64_t data)
 {
-    std::string         buffer;
-    StatisticFieldInfo* FieldInfo = getRegisteredField(fieldHandle);
-
-    if ( nullptr != FieldInfo ) {
-        const char* typeName = getFieldTypeShortName(FieldInfo->getFieldType());
-
-        if ( true == m_outputInlineHeader ) {
-            buffer = format_string("%s.%s = %" PRId64, FieldInfo->getFieldName().c_str(), typeName, data);
-        }
-        else {
-            buffer = format_string("%" PRId64, data);
-        }
-        m_outputBuffer += buffer;
-        m_outputBuffer += "; ";
-    }
+    formatField(fieldHandle, data);
 }
 
 void
 StatisticOutputTextBase::outputField(fieldHandle_t fieldHandle, uint64_t data)
 {
-    std::string         buffer;
-    StatisticFieldInfo* FieldInfo = getRegisteredField(fieldHandle);
-
-    if ( nullptr != FieldInfo ) {
-        const char* typeName = getFieldTypeShortName(FieldInfo->getFieldType());
-
-        if ( true == m_outputInlineHeader ) {
-            buffer = format_string("%s.%s = %" PRIu64, FieldInfo->getFieldName().c_str(), typeName, data);
-        }
-        else {
-            buffer = format_string("%" PRIu64, data);
-        }
-        m_outputBuffer += buffer;
-        m_outputBuffer += "; ";
-    }
+    formatField(fieldHandle, data);
 }
 
 void
 StatisticOutputTextBase::outputField(fieldHandle_t fieldHandle, float data)
 {
-    std::string         buffer;
-    StatisticFieldInfo* FieldInfo = getRegisteredField(fieldHandle);
-
-    if ( nullptr != FieldInfo ) {
-        const char* typeName = getFieldTypeShortName(FieldInfo->getFieldType());
-
-        if ( true == m_outputInlineHeader ) {
-            buffer = format_string("%s.%s = %f", FieldInfo->getFieldName().c_str(), typeName, data);
-        }
-        else {
-            buffer = format_string("%f", data);
-        }
-        m_outputBuffer += buffer;
-        m_outputBuffer += "; ";
-    }
+    formatField(fieldHandle, data);
 }
 
 void
 StatisticOutputTextBase::outputField(fieldHandle_t fieldHandle, double data)
 {
-    std::string         buffer;
-    StatisticFieldInfo* FieldInfo = getRegisteredField(fieldHandle);
-
-    if ( nullptr != FieldInfo ) {
-        const char* typeName = getFieldTypeShortName(FieldInfo->getFieldType());
-
-        if ( true == m_outputInlineHeader ) {
-            buffer = format_string("%s.%s = %f", FieldInfo->getFieldName().c_str(), typeName, data);
-        }
-        else {
-            buffer = format_string("%f", data);
-        }
-        m_outputBuffer += buffer;
-        m_outputBuffer += "; ";
-    }
+    formatField(fieldHandle, data);
 }
 
-
 bool
 StatisticOutputTextBase::openFile(void)
 {
@@ -367,6 +300,21 @@ StatisticOutputTextBase::closeFile(void)
     }
 }
 
+void
+StatisticOutputTextBase::flushBuffer()
+{
+    if ( m_writeBuffer.empty() ) return;
+    if ( m_useCompression ) {
+#ifdef HAVE_LIBZ
+        gzwrite(m_gzFile, m_writeBuffer.data(), m_writeBuffer.size());
+#endif
+    }
+    else {
+        fwrite(m_writeBuffer.data(), 1, m_writeBuffer.size(), m_hFile);
+    }
+    m_writeBuffer.clear();
+}
+
 int
 StatisticOutputTextBase::print(const char* fmt, ...)
 {
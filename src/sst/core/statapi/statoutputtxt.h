@@ -91,6 +91,10 @@ private:
     bool openFile();
     void closeFile();
     int  print(const char* fmt, ...);
+    void flushBuffer();
+
+    template <typename T>
+    void formatField(fieldHandle_t fieldHandle, T data);
 
 private:
 #ifdef HAVE_LIBZ
@@ -98,7 +102,11 @@ private:
 #endif
     FILE*       m_hFile;
     std::string m_outputBuffer;
+    std::string m_writeBuffer;
+    size_t      m_bufferSize;
     std::string m_FilePath;
+    std::string m_mergedFilePath;
+    bool        m_mergeRanks;
 
     /**
        Returns whether or not this outputter outputs to a file
@@ -0,0 +1,295 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_STATAPI_STATQUANTILESKETCH_H
+#define SST_CORE_STATAPI_STATQUANTILESKETCH_H
+
+#include "sst/core/output.h"
+#include "sst/core/sst_types.h"
+#include "sst/core/statapi/statbase.h"
+#include "sst/core/statapi/statoutput.h"
+#include "sst/core/warnmacros.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+namespace SST {
+class BaseComponent;
+namespace Statistics {
+
+/**
+    \class QuantileSketchStatistic
+
+    Creates a Statistic which estimates the quantiles of the values
+    provided to it with a KLL sketch, without keeping every value.
+
+    The sketch is a stack of compactors.  New values go in the bottom
+    one, and when the sketch is full the lowest full compactor is
+    sorted and every other value, starting at a random one of the first
+    two, moves up a level with twice the weight.  The capacity of each
+    level is 2/3 of the one above it, so the sketch holds at most about
+    3k values however many are added, and the rank of each estimated
+    quantile is within about 1.7% of the true one at the default k of
+    200.  Sketches merge by stacking their compactors, so shared copies
+    give the same accuracy as one sketch of all the data.
+
+    The output has the count and exact min and max of the values, and
+    estimates of the 50th, 90th, 99th and 99.9th percentiles.  Each
+    estimate is one of the values that was added.
+
+    @tparam T A template for holding the main data type of this statistic
+*/
+
+template <typename T>
+class QuantileSketchStatistic : public Statistic<T>
+{
+public:
+    SST_ELI_DECLARE_STATISTIC_TEMPLATE(
+        QuantileSketchStatistic,
+        "sst",
+        "QuantileSketchStatistic",
+        SST_ELI_ELEMENT_VERSION(1, 0, 0),
+        "Estimate quantiles of statistic with a KLL sketch",
+        "SST::Statistic<T>")
+
+    QuantileSketchStatistic(
+        BaseComponent* comp, const std::string& statName, const std::string& statSubId, Params& statParams) :
+        Statistic<T>(comp, statName, statSubId, statParams)
+    {
+        // Identify what keys are Allowed in the parameters
+        Params::KeySet_t allowedKeySet;
+        allowedKeySet.insert("k");
+        statParams.pushAllowedKeys(allowedKeySet);
+
+        k = statParams.find<uint32_t>("k", 200);
+        if ( k < 8 || k > 65536 ) {
+            Output::getDefaultObject().fatal(
+                CALL_INFO, 1, "QuantileSketchStatistic %s: k must be between 8 and 65536, got %" PRIu32 "\n",
+                statName.c_str(), k);
+        }
+
+        clearStatisticData();
+
+        // Set the Name of this Statistic
+        this->setStatisticTypeName("QuantileSketch");
+    }
+
+    ~QuantileSketchStatistic() {}
+
+protected:
+    /**
+    Present a new value to the Statistic to be included in the estimates
+        @param data New data item to be included in the estimates
+    */
+    void addData_impl(T data) override
+    {
+        if ( m_itemsCount == 0 || data < m_min ) m_min = data;
+        if ( m_itemsCount == 0 || data > m_max ) m_max = data;
+        m_itemsCount++;
+
+        compactors[0].push_back(data);
+        if ( ++m_size >= m_maxSize ) compress();
+    }
+
+private:
+    /** Number of values a level can hold before it is compacted */
+    uint64_t getCapacity(size_t level) const
+    {
+        double capacity = k;
+        for ( size_t depth = compactors.size() - level - 1; depth > 0; --depth )
+            capacity *= 2.0 / 3.0;
+        return (uint64_t)std::ceil(capacity) + 1;
+    }
+
+    /** Add a level to the top of the sketch */
+    void grow()
+    {
+        compactors.emplace_back();
+        m_maxSize = 0;
+        for ( size_t level = 0; level < compactors.size(); ++level )
+            m_maxSize += getCapacity(level);
+    }
+
+    /** Compact the lowest full level into the one above it */
+    void compress()
+    {
+        for ( size_t level = 0; level < compactors.size(); ++level ) {
+            if ( compactors[level].size() < getCapacity(level) ) continue;
+            if ( level + 1 == compactors.size() ) grow();
+
+            // An odd value out stays behind
+            auto& values = compactors[level];
+            std::sort(values.begin(), values.end());
+            size_t keep  = values.size() % 2;
+            size_t count = values.size() - keep;
+            auto&  next  = compactors[level + 1];
+            for ( size_t i = nextCoin() + keep; i < values.size(); i += 2 )
+                next.push_back(values[i]);
+            values.erase(values.begin() + keep, values.end());
+            m_size -= count / 2;
+            return;
+        }
+    }
+
+    /** Pick the first or second value of each pair to keep */
+    size_t nextCoin()
+    {
+        // splitmix64
+        uint64_t z = (m_rngState += 0x9e3779b97f4a7c15ULL);
+        z          = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z          = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return (z ^ (z >> 31)) >> 63;
+    }
+
+    void clearStatisticData() override
+    {
+        compactors.clear();
+        m_size       = 0;
+        m_itemsCount = 0;
+        m_min        = 0;
+        m_max        = 0;
+        m_rngState   = 0;
+        grow();
+        this->setCollectionCount(0);
+    }
+
+    /** Shared sketches must all use the same k */
+    bool isMergeable() const override { return true; }
+
+    void mergeStatisticData(StatisticBase* other) override
+    {
+        auto* stat = static_cast<QuantileSketchStatistic<T>*>(other);
+        if ( stat->k != k ) {
+            Output::getDefaultObject().fatal(
+                CALL_INFO, 1, "ERROR: Shared statistic %s - All copies must have the same k\n",
+                this->getFullStatName().c_str());
+        }
+
+        if ( stat->m_itemsCount != 0 ) {
+            if ( m_itemsCount == 0 || stat->m_min < m_min ) m_min = stat->m_min;
+            if ( m_itemsCount == 0 || stat->m_max > m_max ) m_max = stat->m_max;
+        }
+        m_itemsCount += stat->m_itemsCount;
+
+        while ( compactors.size() < stat->compactors.size() )
+            grow();
+        for ( size_t level = 0; level < stat->compactors.size(); ++level ) {
+            auto& values = stat->compactors[level];
+            compactors[level].insert(compactors[level].end(), values.begin(), values.end());
+            m_size += values.size();
+        }
+        while ( m_size >= m_maxSize )
+            compress();
+        this->setCollectionCount(this->getCollectionCount() + stat->getCollectionCount());
+    }
+
+    void serialize_order(SST::Core::Serialization::serializer& ser) override
+    {
+        StatisticBase::serialize_order(ser);
+        ser& k;
+        ser& compactors;
+        ser& m_size;
+        ser& m_maxSize;
+        ser& m_itemsCount;
+        ser& m_min;
+        ser& m_max;
+        ser& m_rngState;
+    }
+
+    void registerOutputFields(StatisticFieldsOutput* statOutput) override
+    {
+        m_Fields.push_back(statOutput->registerField<uint64_t>("Count"));
+        m_Fields.push_back(statOutput->registerField<T>("Min"));
+        m_Fields.push_back(statOutput->registerField<T>("Max"));
+        m_Fields.push_back(statOutput->registerField<T>("P50"));
+        m_Fields.push_back(statOutput->registerField<T>("P90"));
+        m_Fields.push_back(statOutput->registerField<T>("P99"));
+        m_Fields.push_back(statOutput->registerField<T>("P999"));
+    }
+
+    void outputStatisticFields(StatisticFieldsOutput* statOutput, bool UNUSED(EndOfSimFlag)) override
+    {
+        // Each value stands for 2^level of the values added
+        std::vector<std::pair<T, uint64_t>> weighted;
+        weighted.reserve(m_size);
+        uint64_t total = 0;
+        for ( size_t level = 0; level < compactors.size(); ++level ) {
+            for ( auto& value : compactors[level] ) {
+                weighted.emplace_back(value, uint64_t(1) << level);
+            }
+            total += compactors[level].size() << level;
+        }
+        std::sort(weighted.begin(), weighted.end());
+
+        static const uint64_t perMille[]     = { 500, 900, 990, 999 };
+        static const size_t   numPercentiles = sizeof(perMille) / sizeof(perMille[0]);
+
+        T        percentiles[numPercentiles] = {};
+        size_t   next                        = 0;
+        uint64_t cumulative                  = 0;
+        for ( size_t i = 0; i < weighted.size() && next < numPercentiles; ++i ) {
+            cumulative += weighted[i].second;
+            while ( next < numPercentiles && cumulative * 1000 >= perMille[next] * total ) {
+                percentiles[next++] = weighted[i].first;
+            }
+        }
+
+        uint32_t x = 0;
+        statOutput->outputField(m_Fields[x++], m_itemsCount);
+        statOutput->outputField(m_Fields[x++], m_min);
+        statOutput->outputField(m_Fields[x++], m_max);
+        for ( size_t i = 0; i < numPercentiles; ++i ) {
+            statOutput->outputField(m_Fields[x++], percentiles[i]);
+        }
+    }
+
+    bool isStatModeSupported(StatisticBase::StatMode_t mode) const override
+    {
+        switch ( mode ) {
+        case StatisticBase::STAT_MODE_COUNT:
+        case StatisticBase::STAT_MODE_PERIODIC:
+        case StatisticBase::STAT_MODE_DUMP_AT_END:
+            return true;
+        default:
+            return false;
+        }
+        return false;
+    }
+
+private:
+    // Capacity of the top level of the sketch
+    uint32_t k;
+
+    // Values kept at each level, with weight 2^level
+    std::vector<std::vector<T>> compactors;
+
+    // Number of values kept, and the number that triggers a compaction
+    uint64_t m_size;
+    uint64_t m_maxSize;
+
+    // Exact count, min and max of the values added
+    uint64_t m_itemsCount;
+    T        m_min;
+    T        m_max;
+
+    // State of the coin flips of the compactions
+    uint64_t m_rngState;
+
+    // Support
+    std::vector<StatisticOutput::fieldHandle_t> m_Fields;
+};
+
+} // namespace Statistics
+} // namespace SST
+
+#endif // SST_CORE_STATAPI_STATQUANTILESKETCH_H
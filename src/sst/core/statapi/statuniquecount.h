@@ -60,6 +60,20 @@ protected:
 private:
     void clearStatisticData() override { uniqueSet.clear(); }
 
+    bool isMergeable() const override { return true; }
+
+    void mergeStatisticData(StatisticBase* other) override
+    {
+        auto* stat = static_cast<UniqueCountStatistic<T>*>(other);
+        uniqueSet.insert(stat->uniqueSet.begin(), stat->uniqueSet.end());
+    }
+
+    void serialize_order(SST::Core::Serialization::serializer& ser) override
+    {
+        StatisticBase::serialize_order(ser);
+        ser& uniqueSet;
+    }
+
     void registerOutputFields(StatisticFieldsOutput* statOutput) override
     {
         uniqueCountField = statOutput->registerField<uint64_t>("UniqueItems");
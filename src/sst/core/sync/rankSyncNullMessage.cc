@@ -0,0 +1,233 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/sync/rankSyncNullMessage.h"
+
+#include "sst/core/event.h"
+#include "sst/core/profile.h"
+#include "sst/core/serialization/serializer.h"
+#include "sst/core/simulation_impl.h"
+#include "sst/core/sync/syncQueue.h"
+#include "sst/core/timeConverter.h"
+
+#include <algorithm>
+
+namespace SST {
+
+// Add a latency to a time without wrapping past MAX_SIMTIME_T
+static inline SimTime_t
+addLatency(SimTime_t time, SimTime_t latency)
+{
+    return time > MAX_SIMTIME_T - latency ? MAX_SIMTIME_T : time + latency;
+}
+
+RankSyncNullMessage::RankSyncNullMessage(RankInfo num_ranks, TimeConverter* minPartTC) :
+    RankSyncSerialSkip(num_ranks, minPartTC),
+    globalMinimum(0),
+    stopTime(MAX_SIMTIME_T),
+    localNext(0),
+    globalNext(0),
+    reductionPending(false)
+{}
+
+ActivityQueue*
+RankSyncNullMessage::registerLink(
+    const RankInfo& to_rank, const RankInfo& from_rank, const std::string& name, Link* link)
+{
+    ActivityQueue* queue = RankSyncSerialSkip::registerLink(to_rank, from_rank, name, link);
+
+    std::lock_guard<Core::ThreadSafe::Spinlock> slock(lock);
+
+    SimTime_t latency = getSendLatency(link);
+    auto      it      = neighbors.find(to_rank.rank);
+    if ( it == neighbors.end() ) { neighbors[to_rank.rank] = { latency, 0, 0 }; }
+    else if ( latency < it->second.lookahead ) {
+        it->second.lookahead = latency;
+    }
+    return queue;
+}
+
+void
+RankSyncNullMessage::prepareForComplete()
+{
+    finishReduction();
+    RankSyncSerialSkip::prepareForComplete();
+}
+
+void
+RankSyncNullMessage::execute(int thread)
+{
+    if ( thread == 0 ) { exchange(); }
+}
+
+void
+RankSyncNullMessage::finishReduction()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    if ( !reductionPending ) return;
+    SyncProfileToolList::phaseStart(Profile::SyncProfileTool::MPI_WAIT);
+    auto waitStart = SST::Core::Profile::now();
+    MPI_Wait(&reductionRequest, MPI_STATUS_IGNORE);
+    mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+    SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::MPI_WAIT);
+    reductionPending = false;
+    globalMinimum    = globalNext;
+#endif
+}
+
+bool
+RankSyncNullMessage::reachedEndTime(SimTime_t end_time)
+{
+    int reached = Simulation_impl::getSimulation()->getCurrentSimCycle() >= end_time;
+#ifdef SST_CONFIG_HAVE_MPI
+    int all_reached;
+    MPI_Allreduce(&reached, &all_reached, 1, MPI_INT, MPI_LAND, MPI_COMM_WORLD);
+    reached = all_reached;
+#endif
+    return reached;
+}
+
+void
+RankSyncNullMessage::exchange()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+
+    Simulation_impl* sim           = Simulation_impl::getSimulation();
+    SimTime_t        current_cycle = sim->getCurrentSimCycle();
+
+    // Nothing on any rank happens before the minimum reduced at the
+    // last exchange, including events that have not been sent yet
+    finishReduction();
+
+    // Every rank has reached the stop time, so they all end here
+    // rather than at a StopAction some of them might not get to
+    SimTime_t stop_at = sim->getStopAtCycle();
+    if ( globalMinimum >= stop_at ) {
+        stopTime = stop_at;
+        return;
+    }
+
+    // Anything this rank sends from now on is sent at or after this
+    // time, so it will arrive at least a link latency later
+    SimTime_t floor = std::max(current_cycle, globalMinimum);
+
+    // Per rank: 2 sends for the data, 1 for the guarantee, and 1 recv
+    // each for the data and the guarantee
+    MPI_Request sreqs[3 * comm_map.size()];
+    MPI_Request rreqs[2 * comm_map.size()];
+    int         sreq_count = 0;
+    int         rreq_count = 0;
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        neighbor_t& neighbor = neighbors[i->first];
+        neighbor.promised    = addLatency(floor, neighbor.lookahead);
+        MPI_Isend(&neighbor.promised, 1, MPI_UINT64_T, i->first, 3, MPI_COMM_WORLD, &sreqs[sreq_count++]);
+        MPI_Irecv(&neighbor.received, 1, MPI_UINT64_T, i->first, 3, MPI_COMM_WORLD, &rreqs[rreq_count++]);
+
+        SyncProfileToolList::phaseStart(Profile::SyncProfileTool::SERIALIZE);
+        char* send_buffer = i->second.squeue->getData();
+        SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::SERIALIZE);
+
+        SyncQueue::Header* hdr = reinterpret_cast<SyncQueue::Header*>(send_buffer);
+        int                tag = 1;
+        // Check to see if remote queue is big enough for data
+        if ( i->second.remote_size < hdr->buffer_size ) {
+            // not big enough, send message that will tell remote side to get larger buffer
+            hdr->mode = 1;
+            MPI_Isend(
+                send_buffer, sizeof(SyncQueue::Header), MPI_BYTE, i->first /*dest*/, tag, MPI_COMM_WORLD,
+                &sreqs[sreq_count++]);
+            i->second.remote_size = hdr->buffer_size;
+            tag                   = 2;
+        }
+        else {
+            hdr->mode = 0;
+        }
+        MPI_Isend(
+            send_buffer, hdr->buffer_size, MPI_BYTE, i->first /*dest*/, tag, MPI_COMM_WORLD, &sreqs[sreq_count++]);
+        SyncProfileToolList::dataSent(i->first, hdr->buffer_size);
+
+        MPI_Irecv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, 1, MPI_COMM_WORLD, &rreqs[rreq_count++]);
+    }
+
+    SyncProfileToolList::phaseStart(Profile::SyncProfileTool::MPI_WAIT);
+    auto waitStart = SST::Core::Profile::now();
+    MPI_Waitall(rreq_count, rreqs, MPI_STATUSES_IGNORE);
+    mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+    SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::MPI_WAIT);
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        char* buffer = i->second.rbuf;
+
+        SyncQueue::Header* hdr  = reinterpret_cast<SyncQueue::Header*>(buffer);
+        unsigned int       size = hdr->buffer_size;
+
+        if ( hdr->mode == 1 ) {
+            // May need to resize the buffer
+            if ( size > i->second.local_size ) {
+                delete[] i->second.rbuf;
+                i->second.rbuf       = new char[size];
+                i->second.local_size = size;
+            }
+            SyncProfileToolList::phaseStart(Profile::SyncProfileTool::MPI_WAIT);
+            MPI_Recv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, 2, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::MPI_WAIT);
+            buffer = i->second.rbuf;
+        }
+
+        SyncProfileToolList::phaseStart(Profile::SyncProfileTool::DESERIALIZE);
+        auto deserialStart = SST::Core::Profile::now();
+
+        SST::Core::Serialization::serializer ser;
+        SyncQueue::startUnpacking(ser, buffer);
+
+        std::vector<Activity*> activities;
+        ser&                   activities;
+
+        deserializeTime += SST::Core::Profile::getElapsed(deserialStart);
+        SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::DESERIALIZE);
+
+        sendBatch(activities, current_cycle);
+    }
+
+    SyncProfileToolList::phaseStart(Profile::SyncProfileTool::MPI_WAIT);
+    waitStart = SST::Core::Profile::now();
+    MPI_Waitall(sreq_count, sreqs, MPI_STATUSES_IGNORE);
+    mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+    SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::MPI_WAIT);
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        i->second.squeue->clear();
+    }
+
+    // Start the reduction used by the next exchange.  The events just
+    // received are in the TimeVortex, so this is a lower bound on
+    // every activity still to come.
+    localNext = Simulation_impl::getLocalMinimumNextActivityTime();
+    MPI_Iallreduce(&localNext, &globalNext, 1, MPI_UINT64_T, MPI_MIN, MPI_COMM_WORLD, &reductionRequest);
+    reductionPending = true;
+
+    // Run until the earliest time a neighbor may send an event for.
+    // A rank with no neighbors runs one partition period at a time,
+    // since it still takes part in every exchange.
+    SimTime_t next = MAX_SIMTIME_T;
+    for ( auto& x : neighbors )
+        next = std::min(next, x.second.received);
+    if ( neighbors.empty() ) next = addLatency(floor, max_period->getFactor());
+
+    // Don't get to the stop time before the other ranks have
+    myNextSyncTime = std::min(next, stop_at);
+#endif
+}
+
+} // namespace SST
@@ -0,0 +1,96 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_SYNC_RANKSYNCNULLMESSAGE_H
+#define SST_CORE_SYNC_RANKSYNCNULLMESSAGE_H
+
+#include "sst/core/sst_types.h"
+#include "sst/core/sync/rankSyncSerialSkip.h"
+#include "sst/core/warnmacros.h"
+
+#include <map>
+
+#ifdef SST_CONFIG_HAVE_MPI
+DISABLE_WARN_MISSING_OVERRIDE
+#include <mpi.h>
+REENABLE_WARNING
+#endif
+
+namespace SST {
+
+class TimeConverter;
+
+/**
+ * Conservative rank sync in the style of the Chandy-Misra-Bryant null
+ * message algorithm.  Instead of every rank waiting for the global
+ * minimum at each sync, a rank only exchanges events with the ranks it
+ * has links to, along with a guarantee of the earliest time any later
+ * event it sends them can arrive: its own time plus the smallest
+ * latency of its links to that rank.  A rank runs up to the earliest
+ * guarantee it received, so ranks can be at different simulated times
+ * and a rank with long latency links to its neighbors syncs less often.
+ *
+ * The global minimum of the next activity times is still reduced, but
+ * without blocking: the result of one exchange is used at the next to
+ * skip over idle periods and to end all ranks at the same exchange.
+ * Only one thread per rank is supported.
+ */
+class RankSyncNullMessage : public RankSyncSerialSkip
+{
+public:
+    RankSyncNullMessage(RankInfo num_ranks, TimeConverter* minPartTC);
+    virtual ~RankSyncNullMessage() {}
+
+    /** Register a Link which this Sync Object is responsible for */
+    ActivityQueue*
+         registerLink(const RankInfo& to_rank, const RankInfo& from_rank, const std::string& name, Link* link) override;
+    void execute(int thread) override;
+
+    /** Prepare for the complete() stage */
+    void prepareForComplete() override;
+
+    bool      reachedEndTime(SimTime_t end_time) override;
+    SimTime_t getStopTime() override { return stopTime; }
+
+private:
+    // Function that actually does the exchange during run
+    void exchange();
+
+    /** Wait for the reduction started by the last exchange */
+    void finishReduction();
+
+    struct neighbor_t
+    {
+        SimTime_t lookahead; // Smallest latency of the links to the rank
+        SimTime_t promised;  // Guarantee sent in the current exchange
+        SimTime_t received;  // Guarantee received in the current exchange
+    };
+
+    typedef std::map<int, neighbor_t> neighbor_map_t;
+
+    neighbor_map_t neighbors;
+
+    // No activity on any rank is earlier than this
+    SimTime_t globalMinimum;
+    SimTime_t stopTime;
+
+    // Buffers of the reduction started at each exchange
+    SimTime_t localNext;
+    SimTime_t globalNext;
+    bool      reductionPending;
+#ifdef SST_CONFIG_HAVE_MPI
+    MPI_Request reductionRequest;
+#endif
+};
+
+} // namespace SST
+
+#endif // SST_CORE_SYNC_RANKSYNCNULLMESSAGE_H
@@ -0,0 +1,200 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/sync/rankSyncOptimistic.h"
+
+#include "sst/core/event.h"
+#include "sst/core/profile.h"
+#include "sst/core/serialization/serializer.h"
+#include "sst/core/simulation_impl.h"
+#include "sst/core/sync/syncQueue.h"
+#include "sst/core/timeConverter.h"
+#include "sst/core/warnmacros.h"
+
+#include <algorithm>
+
+#ifdef SST_CONFIG_HAVE_MPI
+DISABLE_WARN_MISSING_OVERRIDE
+#include <mpi.h>
+REENABLE_WARNING
+#endif
+
+namespace SST {
+
+RankSyncOptimistic::RankSyncOptimistic(RankInfo num_ranks, TimeConverter* minPartTC, SimTime_t max_window) :
+    RankSyncSerialSkip(num_ranks, minPartTC),
+    window_start(0),
+    windows(0),
+    rollbacks(0)
+{
+    min_window       = max_period->getFactor();
+    this->max_window = max_window != 0 ? std::max(max_window, min_window) : 16 * min_window;
+    // The first window starts before any snapshot is taken
+    window           = min_window;
+}
+
+RankSyncOptimistic::~RankSyncOptimistic()
+{
+    if ( windows > 0 || rollbacks > 0 )
+        Output::getDefaultObject().verbose(
+            CALL_INFO, 1, 0, "RankSyncOptimistic windows: %" PRIu64 "  rollbacks: %" PRIu64 "\n", windows,
+            rollbacks);
+}
+
+void
+RankSyncOptimistic::execute(int thread)
+{
+    if ( thread == 0 ) { exchange(); }
+}
+
+void
+RankSyncOptimistic::exchange()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+
+    Simulation_impl* sim           = Simulation_impl::getSimulation();
+    SimTime_t        current_cycle = sim->getCurrentSimCycle();
+
+    MPI_Request sreqs[2 * comm_map.size()];
+    MPI_Request rreqs[comm_map.size()];
+    int         sreq_count = 0;
+    int         rreq_count = 0;
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        SyncProfileToolList::phaseStart(Profile::SyncProfileTool::SERIALIZE);
+        char* send_buffer = i->second.squeue->getData();
+        SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::SERIALIZE);
+
+        SyncQueue::Header* hdr = reinterpret_cast<SyncQueue::Header*>(send_buffer);
+        int                tag = 1;
+        // Check to see if remote queue is big enough for data
+        if ( i->second.remote_size < hdr->buffer_size ) {
+            // not big enough, send message that will tell remote side to get larger buffer
+            hdr->mode = 1;
+            MPI_Isend(
+                send_buffer, sizeof(SyncQueue::Header), MPI_BYTE, i->first /*dest*/, tag, MPI_COMM_WORLD,
+                &sreqs[sreq_count++]);
+            i->second.remote_size = hdr->buffer_size;
+            tag                   = 2;
+        }
+        else {
+            hdr->mode = 0;
+        }
+        MPI_Isend(
+            send_buffer, hdr->buffer_size, MPI_BYTE, i->first /*dest*/, tag, MPI_COMM_WORLD, &sreqs[sreq_count++]);
+        SyncProfileToolList::dataSent(i->first, hdr->buffer_size);
+
+        MPI_Irecv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, 1, MPI_COMM_WORLD, &rreqs[rreq_count++]);
+    }
+
+    SyncProfileToolList::phaseStart(Profile::SyncProfileTool::MPI_WAIT);
+    auto waitStart = SST::Core::Profile::now();
+    MPI_Waitall(rreq_count, rreqs, MPI_STATUSES_IGNORE);
+    mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+    SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::MPI_WAIT);
+
+    // Nothing is delivered until every rank knows the window is good
+    std::vector<std::vector<Activity*>> received(comm_map.size());
+    SimTime_t                           earliest = MAX_SIMTIME_T;
+    size_t                              index    = 0;
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        char* buffer = i->second.rbuf;
+
+        SyncQueue::Header* hdr  = reinterpret_cast<SyncQueue::Header*>(buffer);
+        unsigned int       size = hdr->buffer_size;
+
+        if ( hdr->mode == 1 ) {
+            // May need to resize the buffer
+            if ( size > i->second.local_size ) {
+                delete[] i->second.rbuf;
+                i->second.rbuf       = new char[size];
+                i->second.local_size = size;
+            }
+            SyncProfileToolList::phaseStart(Profile::SyncProfileTool::MPI_WAIT);
+            MPI_Recv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, 2, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::MPI_WAIT);
+            buffer = i->second.rbuf;
+        }
+
+        SyncProfileToolList::phaseStart(Profile::SyncProfileTool::DESERIALIZE);
+        auto deserialStart = SST::Core::Profile::now();
+
+        SST::Core::Serialization::serializer ser;
+        SyncQueue::startUnpacking(ser, buffer);
+
+        std::vector<Activity*>& activities = received[index++];
+        ser&                    activities;
+
+        deserializeTime += SST::Core::Profile::getElapsed(deserialStart);
+        SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::DESERIALIZE);
+
+        for ( auto* act : activities )
+            earliest = std::min(earliest, act->getDeliveryTime());
+    }
+
+    SyncProfileToolList::phaseStart(Profile::SyncProfileTool::MPI_WAIT);
+    waitStart = SST::Core::Profile::now();
+    MPI_Waitall(sreq_count, sreqs, MPI_STATUSES_IGNORE);
+    mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+    SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::MPI_WAIT);
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        i->second.squeue->clear();
+    }
+
+    // One reduction tells every rank whether any of them got an event
+    // in its past, and finds the start of the next window.  The first
+    // value is 0 if there was a straggler.
+    SimTime_t input[2] = { earliest < current_cycle ? 0u : 1u,
+                           std::min(Simulation_impl::getLocalMinimumNextActivityTime(), earliest) };
+    SimTime_t output[2];
+    SyncProfileToolList::phaseStart(Profile::SyncProfileTool::MPI_WAIT);
+    MPI_Allreduce(input, output, 2, MPI_UINT64_T, MPI_MIN, MPI_COMM_WORLD);
+    SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::MPI_WAIT);
+
+    SimTime_t stop_at = sim->getStopAtCycle();
+
+    if ( output[0] == 0 ) {
+        // The events sent during the window are dropped along with the
+        // state they came from, and sent again when it is rerun
+        for ( auto& activities : received ) {
+            for ( auto* act : activities )
+                delete act;
+        }
+        sim->restoreSnapshot();
+        rollbacks++;
+
+        window         = std::max(window / 2, min_window);
+        myNextSyncTime = window_start + window;
+        if ( stop_at > window_start ) myNextSyncTime = std::min(myNextSyncTime, stop_at);
+        return;
+    }
+
+    for ( auto& activities : received ) {
+        sendBatch(activities, current_cycle);
+    }
+    windows++;
+
+    // Start the next window at the earliest activity on any rank,
+    // which no later rollback can go behind
+    window       = std::min(window * 2, max_window);
+    window_start = output[1];
+    if ( window > min_window ) sim->saveSnapshot();
+
+    myNextSyncTime = window_start > MAX_SIMTIME_T - window ? MAX_SIMTIME_T : window_start + window;
+    if ( stop_at > current_cycle ) myNextSyncTime = std::min(myNextSyncTime, stop_at);
+#endif
+}
+
+} // namespace SST
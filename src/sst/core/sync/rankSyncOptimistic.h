@@ -0,0 +1,67 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_SYNC_RANKSYNCOPTIMISTIC_H
+#define SST_CORE_SYNC_RANKSYNCOPTIMISTIC_H
+
+#include "sst/core/sst_types.h"
+#include "sst/core/sync/rankSyncSerialSkip.h"
+
+namespace SST {
+
+class TimeConverter;
+
+/**
+ * Optimistic rank sync.  Ranks run speculative windows that can be
+ * longer than the minimum partition latency, so an event sent by one
+ * rank may arrive in the past of another.  At the end of each window
+ * the ranks agree on whether any such straggler arrived.  If none did,
+ * the received events are delivered and the start of the next window
+ * is committed, which is the global virtual time of the run.  If one
+ * did, every rank discards what it received and rolls back to the
+ * snapshot it took at the start of the window, then runs the window
+ * again with half the length.  A window that succeeds doubles the
+ * length of the next one, up to the largest window.
+ *
+ * Windows no longer than the minimum partition latency cannot have
+ * stragglers, so no snapshot is taken for them.  Component state is
+ * saved with serialize_order(), as for checkpoints.  Only one thread
+ * per rank is supported.
+ */
+class RankSyncOptimistic : public RankSyncSerialSkip
+{
+public:
+    /**
+       @param num_ranks Number of ranks and threads
+       @param minPartTC Minimum partition latency
+       @param max_window Largest speculative window, 0 for the default
+     */
+    RankSyncOptimistic(RankInfo num_ranks, TimeConverter* minPartTC, SimTime_t max_window);
+    virtual ~RankSyncOptimistic();
+
+    void execute(int thread) override;
+
+private:
+    // Function that actually does the exchange during run
+    void exchange();
+
+    SimTime_t min_window;   // Windows this short need no snapshot
+    SimTime_t max_window;   // Largest speculative window
+    SimTime_t window;       // Length of the current window
+    SimTime_t window_start; // Start of the current window
+
+    uint64_t windows;   // Number of committed windows
+    uint64_t rollbacks; // Number of windows that were rolled back
+};
+
+} // namespace SST
+
+#endif // SST_CORE_SYNC_RANKSYNCOPTIMISTIC_H
@@ -0,0 +1,220 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/sync/rankSyncOverlap.h"
+
+#include "sst/core/event.h"
+#include "sst/core/profile.h"
+#include "sst/core/serialization/serializer.h"
+#include "sst/core/simulation_impl.h"
+#include "sst/core/sync/syncQueue.h"
+#include "sst/core/timeConverter.h"
+
+#include <algorithm>
+
+namespace SST {
+
+RankSyncOverlap::RankSyncOverlap(RankInfo num_ranks, TimeConverter* minPartTC) :
+    RankSyncSerialSkip(num_ranks, minPartTC),
+    pending(false),
+    local_min(0),
+    global_min(0),
+    posted(false),
+    done(false)
+{
+    half_period    = max_period->getFactor() / 2;
+    myNextSyncTime = half_period;
+#ifdef SST_CONFIG_HAVE_MPI
+    MPI_Comm_dup(MPI_COMM_WORLD, &comm);
+    comm_thread = std::thread(&RankSyncOverlap::commLoop, this);
+#endif
+}
+
+RankSyncOverlap::~RankSyncOverlap()
+{
+    stopComm();
+}
+
+void
+RankSyncOverlap::execute(int thread)
+{
+    if ( thread == 0 ) { exchange(); }
+}
+
+void
+RankSyncOverlap::prepareForComplete()
+{
+    // Every rank posted the same exchanges, so the last one completes.
+    // Its events arrive after the end of the run and are dropped.
+    if ( pending ) waitForComm();
+    pending = false;
+    stopComm();
+}
+
+void
+RankSyncOverlap::stopComm()
+{
+    if ( !comm_thread.joinable() ) return;
+    {
+        std::lock_guard<std::mutex> lock(comm_mutex);
+        done = true;
+    }
+    comm_cv.notify_all();
+    comm_thread.join();
+#ifdef SST_CONFIG_HAVE_MPI
+    MPI_Comm_free(&comm);
+#endif
+}
+
+void
+RankSyncOverlap::commLoop()
+{
+    std::unique_lock<std::mutex> lock(comm_mutex);
+    while ( true ) {
+        comm_cv.wait(lock, [this] { return posted || done; });
+        if ( !posted ) return;
+        lock.unlock();
+        communicate();
+        lock.lock();
+        posted = false;
+        comm_cv.notify_all();
+    }
+}
+
+void
+RankSyncOverlap::waitForComm()
+{
+    SyncProfileToolList::phaseStart(Profile::SyncProfileTool::MPI_WAIT);
+    auto                         waitStart = SST::Core::Profile::now();
+    std::unique_lock<std::mutex> lock(comm_mutex);
+    comm_cv.wait(lock, [this] { return !posted; });
+    mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+    SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::MPI_WAIT);
+}
+
+void
+RankSyncOverlap::communicate()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    MPI_Request sreqs[2 * comm_map.size()];
+    MPI_Request rreqs[comm_map.size()];
+    int         sreq_count = 0;
+    int         rreq_count = 0;
+    size_t      index      = 0;
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        char* send_buffer = send_buffers[index++];
+
+        SyncQueue::Header* hdr = reinterpret_cast<SyncQueue::Header*>(send_buffer);
+        int                tag = 1;
+        // Check to see if remote queue is big enough for data
+        if ( i->second.remote_size < hdr->buffer_size ) {
+            // not big enough, send message that will tell remote side to get larger buffer
+            hdr->mode = 1;
+            MPI_Isend(send_buffer, sizeof(SyncQueue::Header), MPI_BYTE, i->first, tag, comm, &sreqs[sreq_count++]);
+            i->second.remote_size = hdr->buffer_size;
+            tag                   = 2;
+        }
+        else {
+            hdr->mode = 0;
+        }
+        MPI_Isend(send_buffer, hdr->buffer_size, MPI_BYTE, i->first, tag, comm, &sreqs[sreq_count++]);
+
+        MPI_Irecv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, 1, comm, &rreqs[rreq_count++]);
+    }
+
+    MPI_Waitall(rreq_count, rreqs, MPI_STATUSES_IGNORE);
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        SyncQueue::Header* hdr  = reinterpret_cast<SyncQueue::Header*>(i->second.rbuf);
+        unsigned int       size = hdr->buffer_size;
+
+        if ( hdr->mode == 1 ) {
+            // May need to resize the buffer
+            if ( size > i->second.local_size ) {
+                delete[] i->second.rbuf;
+                i->second.rbuf       = new char[size];
+                i->second.local_size = size;
+            }
+            MPI_Recv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, 2, comm, MPI_STATUS_IGNORE);
+        }
+    }
+
+    MPI_Waitall(sreq_count, sreqs, MPI_STATUSES_IGNORE);
+
+    MPI_Allreduce(&local_min, &global_min, 1, MPI_UINT64_T, MPI_MIN, comm);
+#endif
+}
+
+void
+RankSyncOverlap::exchange()
+{
+    Simulation_impl* sim           = Simulation_impl::getSimulation();
+    SimTime_t        current_cycle = sim->getCurrentSimCycle();
+
+    // Deliver the events handed off at the last sync.  They were sent
+    // at least a partition latency before they arrive, so none of them
+    // is earlier than this sync.
+    SimTime_t last_min = 0;
+    if ( pending ) {
+        waitForComm();
+        last_min = global_min;
+
+        for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+            SyncProfileToolList::phaseStart(Profile::SyncProfileTool::DESERIALIZE);
+            auto deserialStart = SST::Core::Profile::now();
+
+            SST::Core::Serialization::serializer ser;
+            SyncQueue::startUnpacking(ser, i->second.rbuf);
+
+            std::vector<Activity*> activities;
+            ser&                   activities;
+
+            deserializeTime += SST::Core::Profile::getElapsed(deserialStart);
+            SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::DESERIALIZE);
+
+            sendBatch(activities, current_cycle);
+        }
+    }
+
+    // Serialize the events sent since the last sync.  The buffers
+    // belong to the SyncQueues and stay untouched until the next sync.
+    bool sending = false;
+    send_buffers.clear();
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        if ( !i->second.squeue->empty() ) sending = true;
+        SyncProfileToolList::phaseStart(Profile::SyncProfileTool::SERIALIZE);
+        send_buffers.push_back(i->second.squeue->getData());
+        SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::SERIALIZE);
+        SyncProfileToolList::dataSent(
+            i->first, reinterpret_cast<SyncQueue::Header*>(send_buffers.back())->buffer_size);
+    }
+
+    // Events in flight arrive at least half a partition from now
+    local_min = Simulation_impl::getLocalMinimumNextActivityTime();
+    if ( sending ) local_min = std::min(local_min, current_cycle + half_period);
+
+    {
+        std::lock_guard<std::mutex> lock(comm_mutex);
+        posted = true;
+    }
+    comm_cv.notify_all();
+    pending = true;
+
+    // Nothing on any rank happened before the minimum reduced at the
+    // last sync, so the next sync can skip to half a period after it
+    SimTime_t next = std::max(current_cycle, last_min);
+    myNextSyncTime = next > MAX_SIMTIME_T - half_period ? MAX_SIMTIME_T : next + half_period;
+}
+
+} // namespace SST
@@ -0,0 +1,96 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_SYNC_RANKSYNCOVERLAP_H
+#define SST_CORE_SYNC_RANKSYNCOVERLAP_H
+
+#include "sst/core/sst_types.h"
+#include "sst/core/sync/rankSyncSerialSkip.h"
+#include "sst/core/warnmacros.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifdef SST_CONFIG_HAVE_MPI
+DISABLE_WARN_MISSING_OVERRIDE
+#include <mpi.h>
+REENABLE_WARNING
+#endif
+
+namespace SST {
+
+class TimeConverter;
+
+/**
+ * Rank sync that overlaps the exchange between ranks with the
+ * simulation.  Syncs happen every half of the minimum partition
+ * latency, so an event sent before one sync cannot arrive before the
+ * sync after it.  At each sync, thread 0 delivers the events received
+ * by the previous exchange and hands the events sent since then to a
+ * dedicated communication thread, then all the threads go back to
+ * executing events while the data is in flight.
+ *
+ * The global minimum used to skip idle periods is reduced by the same
+ * exchange, so it is one sync behind.  The MPI calls of the
+ * communication thread use their own communicator, and need MPI to
+ * support MPI_THREAD_MULTIPLE.
+ */
+class RankSyncOverlap : public RankSyncSerialSkip
+{
+public:
+    RankSyncOverlap(RankInfo num_ranks, TimeConverter* minPartTC);
+    virtual ~RankSyncOverlap();
+
+    void execute(int thread) override;
+
+    /** Prepare for the complete() stage */
+    void prepareForComplete() override;
+
+private:
+    // Function that actually does the exchange during run
+    void exchange();
+
+    /** Body of the communication thread */
+    void commLoop();
+
+    /** MPI part of an exchange, run on the communication thread */
+    void communicate();
+
+    /** Wait for the communication thread to finish its exchange */
+    void waitForComm();
+
+    /** Stop and join the communication thread */
+    void stopComm();
+
+    SimTime_t half_period; // Time between syncs
+
+    // Set while an exchange is posted and its data not yet delivered
+    bool               pending;
+    std::vector<char*> send_buffers; // Serialized data for each remote rank
+    SimTime_t          local_min;    // Input and result of the reduction
+    SimTime_t          global_min;
+
+    std::thread             comm_thread;
+    std::mutex              comm_mutex;
+    std::condition_variable comm_cv;
+    bool                    posted; // Protected by comm_mutex
+    bool                    done;   // Protected by comm_mutex
+
+#ifdef SST_CONFIG_HAVE_MPI
+    MPI_Comm comm;
+#endif
+};
+
+} // namespace SST
+
+#endif // SST_CORE_SYNC_RANKSYNCOVERLAP_H
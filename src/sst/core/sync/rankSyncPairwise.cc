@@ -0,0 +1,219 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/sync/rankSyncPairwise.h"
+
+#include "sst/core/event.h"
+#include "sst/core/profile.h"
+#include "sst/core/serialization/serializer.h"
+#include "sst/core/simulation_impl.h"
+#include "sst/core/sync/syncQueue.h"
+#include "sst/core/timeConverter.h"
+#include "sst/core/warnmacros.h"
+
+#include <algorithm>
+
+#ifdef SST_CONFIG_HAVE_MPI
+DISABLE_WARN_MISSING_OVERRIDE
+#include <mpi.h>
+REENABLE_WARNING
+#endif
+
+namespace SST {
+
+RankSyncPairwise::RankSyncPairwise(RankInfo num_ranks, TimeConverter* minPartTC) :
+    RankSyncSerialSkip(num_ranks, minPartTC),
+    global_period(0),
+    base(0),
+    global(true),
+    started(false)
+{}
+
+ActivityQueue*
+RankSyncPairwise::registerLink(const RankInfo& to_rank, const RankInfo& from_rank, const std::string& name, Link* link)
+{
+    ActivityQueue* queue = RankSyncSerialSkip::registerLink(to_rank, from_rank, name, link);
+
+    std::lock_guard<Core::ThreadSafe::Spinlock> slock(lock);
+
+    SimTime_t latency = getSendLatency(link);
+    auto      it      = periods.find(to_rank.rank);
+    if ( it == periods.end() || latency < it->second ) periods[to_rank.rank] = latency;
+    return queue;
+}
+
+void
+RankSyncPairwise::finalizeLinkConfigurations()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    // The two ranks of a pair have to use the same period, so take the
+    // smaller of the latencies in each direction
+    MPI_Request reqs[2 * periods.size()];
+    SimTime_t   remote[periods.size()];
+    int         req_count = 0;
+    int         index     = 0;
+    for ( auto& x : periods ) {
+        MPI_Isend(&x.second, 1, MPI_UINT64_T, x.first, 4, MPI_COMM_WORLD, &reqs[req_count++]);
+        MPI_Irecv(&remote[index++], 1, MPI_UINT64_T, x.first, 4, MPI_COMM_WORLD, &reqs[req_count++]);
+    }
+    MPI_Waitall(req_count, reqs, MPI_STATUSES_IGNORE);
+
+    index               = 0;
+    SimTime_t local_max = 0;
+    for ( auto& x : periods ) {
+        x.second  = std::max<SimTime_t>(std::min(x.second, remote[index++]), 1);
+        local_max = std::max(local_max, x.second);
+    }
+
+    MPI_Allreduce(&local_max, &global_period, 1, MPI_UINT64_T, MPI_MAX, MPI_COMM_WORLD);
+#endif
+    if ( global_period == 0 ) global_period = max_period->getFactor();
+
+    // The first sync stays at the minimum partition latency, which the
+    // other threads have already scheduled, and is a global one that
+    // starts the schedules
+}
+
+SimTime_t
+RankSyncPairwise::nextMultiple(SimTime_t now, SimTime_t period)
+{
+    SimTime_t count = now >= base ? (now - base) / period + 1 : 1;
+    if ( count > (MAX_SIMTIME_T - base) / period ) return MAX_SIMTIME_T;
+    return base + count * period;
+}
+
+void
+RankSyncPairwise::execute(int thread)
+{
+    if ( thread == 0 ) { exchange(); }
+}
+
+void
+RankSyncPairwise::exchange()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+
+    Simulation_impl* sim           = Simulation_impl::getSimulation();
+    SimTime_t        current_cycle = sim->getCurrentSimCycle();
+
+    // Only the pairs whose period ends now exchange, unless this is a
+    // global sync
+    global  = !started || (current_cycle >= base && (current_cycle - base) % global_period == 0);
+    started = true;
+
+    MPI_Request sreqs[2 * comm_map.size()];
+    MPI_Request rreqs[comm_map.size()];
+    int         sreq_count = 0;
+    int         rreq_count = 0;
+
+    std::vector<comm_map_t::iterator> partners;
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        SimTime_t period = periods[i->first];
+        if ( global || (current_cycle >= base && (current_cycle - base) % period == 0) ) partners.push_back(i);
+    }
+
+    for ( auto i : partners ) {
+        SyncProfileToolList::phaseStart(Profile::SyncProfileTool::SERIALIZE);
+        char* send_buffer = i->second.squeue->getData();
+        SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::SERIALIZE);
+
+        SyncQueue::Header* hdr = reinterpret_cast<SyncQueue::Header*>(send_buffer);
+        int                tag = 1;
+        // Check to see if remote queue is big enough for data
+        if ( i->second.remote_size < hdr->buffer_size ) {
+            // not big enough, send message that will tell remote side to get larger buffer
+            hdr->mode = 1;
+            MPI_Isend(
+                send_buffer, sizeof(SyncQueue::Header), MPI_BYTE, i->first /*dest*/, tag, MPI_COMM_WORLD,
+                &sreqs[sreq_count++]);
+            i->second.remote_size = hdr->buffer_size;
+            tag                   = 2;
+        }
+        else {
+            hdr->mode = 0;
+        }
+        MPI_Isend(
+            send_buffer, hdr->buffer_size, MPI_BYTE, i->first /*dest*/, tag, MPI_COMM_WORLD, &sreqs[sreq_count++]);
+        SyncProfileToolList::dataSent(i->first, hdr->buffer_size);
+
+        MPI_Irecv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, 1, MPI_COMM_WORLD, &rreqs[rreq_count++]);
+    }
+
+    SyncProfileToolList::phaseStart(Profile::SyncProfileTool::MPI_WAIT);
+    auto waitStart = SST::Core::Profile::now();
+    MPI_Waitall(rreq_count, rreqs, MPI_STATUSES_IGNORE);
+    mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+    SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::MPI_WAIT);
+
+    for ( auto i : partners ) {
+        char* buffer = i->second.rbuf;
+
+        SyncQueue::Header* hdr  = reinterpret_cast<SyncQueue::Header*>(buffer);
+        unsigned int       size = hdr->buffer_size;
+
+        if ( hdr->mode == 1 ) {
+            // May need to resize the buffer
+            if ( size > i->second.local_size ) {
+                delete[] i->second.rbuf;
+                i->second.rbuf       = new char[size];
+                i->second.local_size = size;
+            }
+            SyncProfileToolList::phaseStart(Profile::SyncProfileTool::MPI_WAIT);
+            MPI_Recv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, 2, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::MPI_WAIT);
+            buffer = i->second.rbuf;
+        }
+
+        SyncProfileToolList::phaseStart(Profile::SyncProfileTool::DESERIALIZE);
+        auto deserialStart = SST::Core::Profile::now();
+
+        SST::Core::Serialization::serializer ser;
+        SyncQueue::startUnpacking(ser, buffer);
+
+        std::vector<Activity*> activities;
+        ser&                   activities;
+
+        deserializeTime += SST::Core::Profile::getElapsed(deserialStart);
+        SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::DESERIALIZE);
+
+        sendBatch(activities, current_cycle);
+    }
+
+    SyncProfileToolList::phaseStart(Profile::SyncProfileTool::MPI_WAIT);
+    waitStart = SST::Core::Profile::now();
+    MPI_Waitall(sreq_count, sreqs, MPI_STATUSES_IGNORE);
+    mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+    SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::MPI_WAIT);
+
+    for ( auto i : partners ) {
+        i->second.squeue->clear();
+    }
+
+    if ( global ) {
+        // Nothing is in flight between any ranks, so all the schedules
+        // can restart from the earliest activity on any rank
+        SimTime_t input = Simulation_impl::getLocalMinimumNextActivityTime();
+        SimTime_t min_time;
+        SyncProfileToolList::phaseStart(Profile::SyncProfileTool::MPI_WAIT);
+        MPI_Allreduce(&input, &min_time, 1, MPI_UINT64_T, MPI_MIN, MPI_COMM_WORLD);
+        SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::MPI_WAIT);
+        base = std::max(current_cycle, min_time);
+    }
+
+    myNextSyncTime = nextMultiple(current_cycle, global_period);
+    for ( auto& x : periods )
+        myNextSyncTime = std::min(myNextSyncTime, nextMultiple(current_cycle, x.second));
+#endif
+}
+
+} // namespace SST
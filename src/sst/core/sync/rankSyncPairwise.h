@@ -0,0 +1,71 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_SYNC_RANKSYNCPAIRWISE_H
+#define SST_CORE_SYNC_RANKSYNCPAIRWISE_H
+
+#include "sst/core/sst_types.h"
+#include "sst/core/sync/rankSyncSerialSkip.h"
+
+#include <map>
+
+namespace SST {
+
+class TimeConverter;
+
+/**
+ * Rank sync where each pair of ranks exchanges events on its own
+ * schedule, every smallest latency of the links between the two, with
+ * point-to-point messages only.  Ranks that only share long latency
+ * links sync rarely even if some other pair has very short links.
+ *
+ * Every largest pair period, all ranks meet at a global sync: events
+ * are exchanged with every neighbor and the minimum of the next
+ * activity times is reduced to skip idle periods.  The schedules of
+ * all pairs restart from the time skipped to.  Collectives outside the
+ * rank sync, like the Exit check, are only done at global syncs.
+ */
+class RankSyncPairwise : public RankSyncSerialSkip
+{
+public:
+    RankSyncPairwise(RankInfo num_ranks, TimeConverter* minPartTC);
+    virtual ~RankSyncPairwise() {}
+
+    /** Register a Link which this Sync Object is responsible for */
+    ActivityQueue*
+         registerLink(const RankInfo& to_rank, const RankInfo& from_rank, const std::string& name, Link* link) override;
+    void execute(int thread) override;
+
+    /** Agree on the period of each pair and of the global syncs */
+    void finalizeLinkConfigurations() override;
+
+    bool isGlobalSync() override { return global; }
+
+private:
+    // Function that actually does the exchange during run
+    void exchange();
+
+    /** First time after now that is a whole number of periods after base */
+    SimTime_t nextMultiple(SimTime_t now, SimTime_t period);
+
+    // Smallest latency of the links to each rank, then of the links in
+    // both directions once finalizeLinkConfigurations() is done
+    std::map<int, SimTime_t> periods;
+
+    SimTime_t global_period; // Largest pair period of any rank
+    SimTime_t base;          // Time all the schedules started from
+    bool      global;        // The last sync was a global sync
+    bool      started;       // The first sync has been done
+};
+
+} // namespace SST
+
+#endif // SST_CORE_SYNC_RANKSYNCPAIRWISE_H
@@ -23,6 +23,8 @@
 #include "sst/core/timeConverter.h"
 #include "sst/core/warnmacros.h"
 
+#include <algorithm>
+
 #ifdef SST_CONFIG_HAVE_MPI
 #define UNUSED_WO_MPI(x) x
 #else
@@ -100,7 +102,7 @@ RankSyncParallelSkip::registerLink(
     if ( comm_send_map.count(to_rank) == 0 ) {
         send_count++;
         comm_send_map[to_rank].to_rank = to_rank;
-        queue = comm_send_map[to_rank].squeue = new SyncQueue();
+        queue = comm_send_map[to_rank].squeue = new SyncQueue(Simulation_impl::getSimulation()->getSyncCompressThreshold());
         comm_send_map[to_rank].remote_size    = 4096;
     }
     else {
@@ -130,10 +132,11 @@ void
 RankSyncParallelSkip::finalizeLinkConfigurations()
 {
     // Set the size of the BoundedQueue that is the work queue for
-    // serializations
-    deserialize_queue.initialize(comm_recv_map.size());
-    serialize_queue.initialize(comm_send_map.size());
-    send_queue.initialize(comm_send_map.size());
+    // serializations.  Ranks with no remote links still poll the
+    // queues, so they need at least one slot.
+    deserialize_queue.initialize(std::max<size_t>(1, comm_recv_map.size()));
+    serialize_queue.initialize(std::max<size_t>(1, comm_send_map.size()));
+    send_queue.initialize(std::max<size_t>(1, comm_send_map.size()));
 }
 
 void
@@ -160,12 +163,18 @@ RankSyncParallelSkip::execute(int thread)
     // TraceFunction trace(CALL_INFO_LONG);
     if ( thread == 0 ) {
         exchange_master(thread);
+        SyncProfileToolList::phaseStart(Profile::SyncProfileTool::BARRIER);
         allDoneBarrier.wait(); /* Sync up with slave finish below */
+        SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::BARRIER);
     }
     else {
+        SyncProfileToolList::phaseStart(Profile::SyncProfileTool::BARRIER);
         serializeReadyBarrier.wait(); /* Wait for exchange_master() to start up */
+        SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::BARRIER);
         exchange_slave(thread);       /* Waits at the end */
-        allDoneBarrier.wait();        /* Wait for exchange_master to finish */
+        SyncProfileToolList::phaseStart(Profile::SyncProfileTool::BARRIER);
+        allDoneBarrier.wait(); /* Wait for exchange_master to finish */
+        SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::BARRIER);
     }
 }
 
@@ -181,10 +190,12 @@ RankSyncParallelSkip::exchange_slave(int thread)
     while ( serialize_queue.try_remove(ser) ) {
         // Measures serialization time
         SST_EVENT_PROFILE_START
+        SyncProfileToolList::phaseStart(Profile::SyncProfileTool::SERIALIZE);
 
         // Serialize the events
         ser->sbuf = ser->squeue->getData();
 
+        SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::SERIALIZE);
         SST_EVENT_PROFILE_STOP
 
         // Send back to master to do MPI send
@@ -210,11 +221,7 @@ RankSyncParallelSkip::exchange_slave(int thread)
             // comm_recv_pair* recv = link_send_queue[thread].remove();
             my_recv_count--;
 
-            for ( size_t i = 0; i < recv->activity_vec.size(); i++ ) {
-                Event*    ev    = static_cast<Event*>(recv->activity_vec[i]);
-                SimTime_t delay = ev->getDeliveryTime() - current_cycle;
-                getDeliveryLink(ev)->send(delay, ev);
-            }
+            sendBatch(recv->activity_vec, current_cycle);
             recv->activity_vec.clear();
         }
         else if ( deserialize_queue.try_remove(recv) ) {
@@ -223,7 +230,9 @@ RankSyncParallelSkip::exchange_slave(int thread)
             link_send_queue[recv->local_thread].insert(recv);
         }
     }
+    SyncProfileToolList::phaseStart(Profile::SyncProfileTool::BARRIER);
     slaveExchangeDoneBarrier.wait();
+    SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::BARRIER);
 }
 
 void
@@ -243,16 +252,62 @@ RankSyncParallelSkip::exchange_master(int UNUSED(thread))
 
     remaining_deser = comm_recv_map.size();
 
+    SyncProfileToolList::phaseStart(Profile::SyncProfileTool::BARRIER);
     serializeReadyBarrier.wait(); /* Wait for / release slaves to serialize */
+    SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::BARRIER);
+
+    // Receive requests are kept in one array so completions can be
+    // picked up for all peers with a single MPI_Testsome
+    int             nrecvs = comm_recv_map.size();
+    MPI_Request     rreqs[nrecvs];
+    comm_recv_pair* rpairs[nrecvs];
+    int             rindices[nrecvs];
+    int             rreq_count = 0;
 
     for ( auto i = comm_recv_map.begin(); i != comm_recv_map.end(); ++i ) {
         // Post all the receives
         int tag             = 2 * i->second.local_thread;
         i->second.recv_done = false;
+        rpairs[rreq_count]  = &(i->second);
         MPI_Irecv(
-            i->second.rbuf, i->second.local_size, MPI_BYTE, i->second.remote_rank, tag, MPI_COMM_WORLD, &i->second.req);
+            i->second.rbuf, i->second.local_size, MPI_BYTE, i->second.remote_rank, tag, MPI_COMM_WORLD,
+            &rreqs[rreq_count++]);
     }
 
+    // Check for completed receives and hand them off to be
+    // deserialized.  Messages that didn't fit in the receive buffer
+    // only deliver the header, so post a second receive for the
+    // rest.  Returns false if there was nothing to process.
+    int  receives_to_process = nrecvs;
+    auto progress_recvs      = [&]() -> bool {
+        if ( receives_to_process == 0 ) return false;
+        int outcount;
+        MPI_Testsome(rreq_count, rreqs, &outcount, rindices, MPI_STATUSES_IGNORE);
+        if ( outcount == MPI_UNDEFINED || outcount == 0 ) return false;
+        for ( int j = 0; j < outcount; ++j ) {
+            comm_recv_pair*    recv = rpairs[rindices[j]];
+            SyncQueue::Header* hdr  = reinterpret_cast<SyncQueue::Header*>(recv->rbuf);
+            if ( !recv->recv_done && hdr->mode == 1 ) {
+                recv->recv_done   = true;
+                unsigned int size = hdr->buffer_size;
+                // May need to resize the buffer
+                if ( size > recv->local_size ) {
+                    delete[] recv->rbuf;
+                    recv->rbuf       = new char[size];
+                    recv->local_size = size;
+                }
+                MPI_Irecv(
+                    recv->rbuf, recv->local_size, MPI_BYTE, recv->remote_rank, 2 * recv->local_thread + 1,
+                    MPI_COMM_WORLD, &rreqs[rindices[j]]);
+                continue;
+            }
+            recv->recv_done = true;
+            receives_to_process--;
+            deserialize_queue.try_insert(recv);
+        }
+        return true;
+    };
+
     // Do all the sends, but if there are no sends to do, then help
     // with serialization
     int             my_send_count = send_count;
@@ -286,64 +341,52 @@ RankSyncParallelSkip::exchange_master(int UNUSED(thread))
             MPI_Isend(
                 send_buffer, hdr->buffer_size, MPI_BYTE, send->to_rank.rank /*dest*/, tag, MPI_COMM_WORLD,
                 &sreqs[sreq_count++]);
+            SyncProfileToolList::dataSent(send->to_rank.rank, hdr->buffer_size);
         }
         else if ( serialize_queue.try_remove(send) ) {
             // Serialize the events
             SST_EVENT_PROFILE_START
+            SyncProfileToolList::phaseStart(Profile::SyncProfileTool::SERIALIZE);
             send->sbuf = send->squeue->getData();
+            SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::SERIALIZE);
             SST_EVENT_PROFILE_STOP
 
             // Send back to master to do MPI send
             send_queue.try_insert(send);
         }
-        else {
+        else if ( !progress_recvs() ) {
             sst_pause();
         }
     }
 
-    // Do all the receives as they arrive
-    int receives_to_process = comm_recv_map.size();
+    // Do all the receives as they arrive.  While waiting on the
+    // slower peers, help the slaves deserialize the ones that have
+    // already arrived.
+    comm_recv_pair* recv;
+    SyncProfileToolList::phaseStart(Profile::SyncProfileTool::MPI_WAIT);
     while ( receives_to_process != 0 ) {
-        for ( auto i = comm_recv_map.begin(); i != comm_recv_map.end(); ++i ) {
-            if ( !i->second.recv_done ) {
-                int flag;
-                MPI_Test(&i->second.req, &flag, MPI_STATUS_IGNORE);
-                if ( flag ) {
-                    receives_to_process--;
-                    i->second.recv_done = true;
-
-                    // Get the buffer and deserialize all the events
-                    char* buffer = i->second.rbuf;
-
-                    SyncQueue::Header* hdr  = reinterpret_cast<SyncQueue::Header*>(buffer);
-                    unsigned int       size = hdr->buffer_size;
-                    int                mode = hdr->mode;
-
-                    if ( mode == 1 ) {
-                        // May need to resize the buffer
-                        if ( size > i->second.local_size ) {
-                            delete[] i->second.rbuf;
-                            i->second.rbuf       = new char[size];
-                            i->second.local_size = size;
-                        }
-                        MPI_Recv(
-                            i->second.rbuf, i->second.local_size, MPI_BYTE, i->second.remote_rank,
-                            2 * i->second.local_thread + 1, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-                        buffer = i->second.rbuf;
-                    }
-
-                    deserialize_queue.try_insert(&(i->second));
-                }
-            }
+        if ( progress_recvs() ) continue;
+        if ( deserialize_queue.try_remove(recv) ) {
+            remaining_deser--;
+            SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::MPI_WAIT);
+            deserializeMessage(recv);
+            SyncProfileToolList::phaseStart(Profile::SyncProfileTool::MPI_WAIT);
+            link_send_queue[recv->local_thread].insert(recv);
+        }
+        else {
+            sst_pause();
         }
     }
+    SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::MPI_WAIT);
 
     // For now simply call exchange_slave() to deliver events
     exchange_slave(0); /* Barriers at end */
 
     // Clear the SyncQueues used to send the data after all the sends have completed
     // waitStart = SST::Core::Profile::now();
+    SyncProfileToolList::phaseStart(Profile::SyncProfileTool::MPI_WAIT);
     MPI_Waitall(sreq_count, sreqs, MPI_STATUSES_IGNORE);
+    SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::MPI_WAIT);
     // mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
 
     for ( auto i = comm_send_map.begin(); i != comm_send_map.end(); ++i ) {
@@ -358,7 +401,9 @@ RankSyncParallelSkip::exchange_master(int UNUSED(thread))
     // SimTime_t input = Simulation_impl::getSimulation()->getNextActivityTime();
     SimTime_t input = Simulation_impl::getLocalMinimumNextActivityTime();
     SimTime_t min_time;
+    SyncProfileToolList::phaseStart(Profile::SyncProfileTool::MPI_WAIT);
     MPI_Allreduce(&input, &min_time, 1, MPI_UINT64_T, MPI_MIN, MPI_COMM_WORLD);
+    SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::MPI_WAIT);
 
     myNextSyncTime = min_time + max_period->getFactor();
 
@@ -370,6 +415,19 @@ RankSyncParallelSkip::exchangeLinkUntimedData(int UNUSED_WO_MPI(thread), std::at
 {
 #ifdef SST_CONFIG_HAVE_MPI
     if ( thread != 0 ) { return; }
+
+    if ( Simulation_impl::getSimulation()->getSyncSparseUntimed() ) {
+        std::vector<std::pair<int, SyncQueue*>> sends;
+        for ( auto i = comm_send_map.begin(); i != comm_send_map.end(); ++i ) {
+            if ( !i->second.squeue->empty() ) sends.emplace_back(i->second.to_rank.rank, i->second.squeue);
+        }
+        exchangeLinkUntimedDataSparse(sends, msg_count);
+        for ( auto i = comm_send_map.begin(); i != comm_send_map.end(); ++i ) {
+            i->second.squeue->clear();
+        }
+        return;
+    }
+
     // Maximum number of outstanding requests is 3 times the number
     // of ranks I communicate with (1 recv, 2 sends per rank)
     MPI_Request sreqs[2 * comm_send_map.size()];
@@ -438,7 +496,7 @@ RankSyncParallelSkip::exchangeLinkUntimedData(int UNUSED_WO_MPI(thread), std::at
         }
 
         SST::Core::Serialization::serializer ser;
-        ser.start_unpacking(&buffer[sizeof(SyncQueue::Header)], size - sizeof(SyncQueue::Header));
+        SyncQueue::startUnpacking(ser, buffer);
 
         std::vector<Activity*> activities;
         ser&                   activities;
@@ -469,18 +527,18 @@ RankSyncParallelSkip::exchangeLinkUntimedData(int UNUSED_WO_MPI(thread), std::at
 void
 RankSyncParallelSkip::deserializeMessage(comm_recv_pair* msg)
 {
-    char*              buffer = msg->rbuf;
-    SyncQueue::Header* hdr    = reinterpret_cast<SyncQueue::Header*>(buffer);
-    unsigned int       size   = hdr->buffer_size;
+    char* buffer = msg->rbuf;
 
+    SyncProfileToolList::phaseStart(Profile::SyncProfileTool::DESERIALIZE);
     auto deserialStart = SST::Core::Profile::now();
 
     SST::Core::Serialization::serializer ser;
 
-    ser.start_unpacking(&buffer[sizeof(SyncQueue::Header)], size - sizeof(SyncQueue::Header));
+    SyncQueue::startUnpacking(ser, buffer);
     ser & msg->activity_vec;
 
     deserializeTime += SST::Core::Profile::getElapsed(deserialStart);
+    SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::DESERIALIZE);
 }
 
 } // namespace SST
@@ -50,6 +50,7 @@ public:
     void prepareForComplete() override;
 
     SimTime_t getNextSyncTime() override { return myNextSyncTime; }
+    void      setNextSyncTime(SimTime_t time) override { myNextSyncTime = time; }
 
     uint64_t getDataSize() const override;
 
@@ -75,10 +76,7 @@ private:
         char*                  rbuf; // receive buffer
         std::vector<Activity*> activity_vec;
         uint32_t               local_size;
-        bool                   recv_done;
-#ifdef SST_CONFIG_HAVE_MPI
-        MPI_Request req;
-#endif
+        bool                   recv_done; // header has arrived
     };
 
     typedef std::map<RankInfo, comm_send_pair> comm_send_map_t;
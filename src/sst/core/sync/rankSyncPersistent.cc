@@ -0,0 +1,250 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/sync/rankSyncPersistent.h"
+
+#include "sst/core/event.h"
+#include "sst/core/profile.h"
+#include "sst/core/serialization/serializer.h"
+#include "sst/core/simulation_impl.h"
+#include "sst/core/sync/syncQueue.h"
+#include "sst/core/timeConverter.h"
+
+#include <algorithm>
+
+namespace SST {
+
+// Tags of the run phase messages.  They are different from the ones
+// of the untimed data exchange, so the receives posted ahead of a
+// sync never match anything else.
+static const int PAYLOAD_TAG = 5;
+static const int RESIZE_TAG  = 6;
+
+// Smallest receive buffer, same as the initial one
+static const uint32_t MIN_BUFFER = 4096;
+
+uint32_t
+RankSyncPersistent::channel::update(uint32_t size, uint32_t current)
+{
+    sizes[next] = size;
+    next        = (next + 1) % HISTORY;
+
+    // Room for twice the largest recent message, rounded up to a power
+    // of two so that small changes don't reallocate
+    uint32_t largest = *std::max_element(sizes, sizes + HISTORY);
+    uint64_t want    = MIN_BUFFER;
+    while ( want < 2 * static_cast<uint64_t>(largest) )
+        want *= 2;
+    if ( want > UINT32_MAX ) want = largest;
+
+    // Grow right away, but only shrink once the buffer is far too big
+    if ( want > current || want * 4 <= current ) return want;
+    return current;
+}
+
+RankSyncPersistent::RankSyncPersistent(RankInfo num_ranks, TimeConverter* minPartTC) :
+    RankSyncSerialSkip(num_ranks, minPartTC),
+    posted(false)
+{}
+
+RankSyncPersistent::~RankSyncPersistent()
+{
+    freeReceives();
+}
+
+void
+RankSyncPersistent::execute(int thread)
+{
+    if ( thread == 0 ) { exchange(); }
+}
+
+void
+RankSyncPersistent::prepareForComplete()
+{
+    // The untimed data exchange reuses the receive buffers
+    freeReceives();
+}
+
+void
+RankSyncPersistent::initReceive(int rank, peer& p)
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    comm_pair& c = comm_map[rank];
+    if ( rreqs[p.index] != MPI_REQUEST_NULL ) MPI_Request_free(&rreqs[p.index]);
+    MPI_Recv_init(c.rbuf, c.local_size, MPI_BYTE, rank, PAYLOAD_TAG, MPI_COMM_WORLD, &rreqs[p.index]);
+#else
+    (void)rank;
+    (void)p;
+#endif
+}
+
+void
+RankSyncPersistent::freeReceives()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    for ( auto& req : rreqs ) {
+        if ( req == MPI_REQUEST_NULL ) continue;
+        // Receives started for a sync that did not happen
+        if ( posted ) {
+            MPI_Cancel(&req);
+            MPI_Wait(&req, MPI_STATUS_IGNORE);
+        }
+        MPI_Request_free(&req);
+    }
+    rreqs.clear();
+#endif
+    peers.clear();
+    posted = false;
+}
+
+void
+RankSyncPersistent::exchange()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    // Maximum number of outstanding sends is 2 times the number of
+    // ranks I communicate with
+    MPI_Request sreqs[2 * comm_map.size()];
+    int         sreq_count = 0;
+
+    Simulation_impl* sim = Simulation_impl::getSimulation();
+
+    // The receives are posted at the end of each sync for the next
+    // one.  The first sync after the untimed phases has to post its
+    // own, since the buffers may have changed size during those phases.
+    if ( !posted ) {
+        rreqs.assign(comm_map.size(), MPI_REQUEST_NULL);
+        size_t index = 0;
+        for ( auto& x : comm_map ) {
+            peer& p = peers[x.first];
+            p.index = index++;
+            initReceive(x.first, p);
+        }
+        MPI_Startall(rreqs.size(), rreqs.data());
+        posted = true;
+    }
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        SyncProfileToolList::phaseStart(Profile::SyncProfileTool::SERIALIZE);
+        char* send_buffer = i->second.squeue->getData();
+        SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::SERIALIZE);
+
+        SyncQueue::Header* hdr = reinterpret_cast<SyncQueue::Header*>(send_buffer);
+        int                tag = PAYLOAD_TAG;
+        if ( i->second.remote_size < hdr->buffer_size ) {
+            // Bigger than anything seen recently, the remote side needs
+            // the size first
+            hdr->mode = 1;
+            MPI_Isend(
+                send_buffer, sizeof(SyncQueue::Header), MPI_BYTE, i->first /*dest*/, tag, MPI_COMM_WORLD,
+                &sreqs[sreq_count++]);
+            tag = RESIZE_TAG;
+        }
+        else {
+            hdr->mode = 0;
+        }
+        MPI_Isend(
+            send_buffer, hdr->buffer_size, MPI_BYTE, i->first /*dest*/, tag, MPI_COMM_WORLD, &sreqs[sreq_count++]);
+        SyncProfileToolList::dataSent(i->first, hdr->buffer_size);
+
+        // The receiver makes the same prediction from the same sizes
+        i->second.remote_size = peers[i->first].send.update(hdr->buffer_size, i->second.remote_size);
+    }
+
+    SimTime_t   input      = 0;
+    SimTime_t   min_time   = 0;
+    MPI_Request reduce_req = MPI_REQUEST_NULL;
+    if ( nonblocking_reduce ) {
+        input = getLocalMinimumWithSends();
+        MPI_Iallreduce(&input, &min_time, 1, MPI_UINT64_T, MPI_MIN, MPI_COMM_WORLD, &reduce_req);
+    }
+
+    SimTime_t current_cycle = sim->getCurrentSimCycle();
+
+    SyncProfileToolList::phaseStart(Profile::SyncProfileTool::MPI_WAIT);
+    auto waitStart = SST::Core::Profile::now();
+    MPI_Waitall(rreqs.size(), rreqs.data(), MPI_STATUSES_IGNORE);
+    mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+    SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::MPI_WAIT);
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        peer&              p    = peers[i->first];
+        SyncQueue::Header* hdr  = reinterpret_cast<SyncQueue::Header*>(i->second.rbuf);
+        uint32_t           size = hdr->buffer_size;
+        int                mode = hdr->mode;
+
+        uint32_t new_size = p.recv.update(size, i->second.local_size);
+        bool     resized  = new_size != i->second.local_size;
+
+        if ( mode == 1 ) {
+            // The message didn't fit, so the prediction has grown past
+            // its size and the payload can go straight into the new
+            // buffer
+            delete[] i->second.rbuf;
+            i->second.rbuf       = new char[new_size];
+            i->second.local_size = new_size;
+            SyncProfileToolList::phaseStart(Profile::SyncProfileTool::MPI_WAIT);
+            MPI_Recv(
+                i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, RESIZE_TAG, MPI_COMM_WORLD,
+                MPI_STATUS_IGNORE);
+            SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::MPI_WAIT);
+        }
+
+        SyncProfileToolList::phaseStart(Profile::SyncProfileTool::DESERIALIZE);
+        auto deserialStart = SST::Core::Profile::now();
+
+        SST::Core::Serialization::serializer ser;
+        SyncQueue::startUnpacking(ser, i->second.rbuf);
+
+        std::vector<Activity*> activities;
+        ser&                   activities;
+
+        deserializeTime += SST::Core::Profile::getElapsed(deserialStart);
+        SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::DESERIALIZE);
+
+        sendBatch(activities, current_cycle);
+
+        // Post the receive for the next sync
+        if ( resized ) {
+            if ( i->second.local_size != new_size ) {
+                delete[] i->second.rbuf;
+                i->second.rbuf       = new char[new_size];
+                i->second.local_size = new_size;
+            }
+            initReceive(i->first, p);
+        }
+        MPI_Start(&rreqs[p.index]);
+    }
+
+    SyncProfileToolList::phaseStart(Profile::SyncProfileTool::MPI_WAIT);
+    waitStart = SST::Core::Profile::now();
+    MPI_Waitall(sreq_count, sreqs, MPI_STATUSES_IGNORE);
+    mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+    SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::MPI_WAIT);
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        i->second.squeue->clear();
+    }
+
+    SyncProfileToolList::phaseStart(Profile::SyncProfileTool::MPI_WAIT);
+    if ( nonblocking_reduce ) { MPI_Wait(&reduce_req, MPI_STATUS_IGNORE); }
+    else {
+        input = Simulation_impl::getLocalMinimumNextActivityTime();
+        MPI_Allreduce(&input, &min_time, 1, MPI_UINT64_T, MPI_MIN, MPI_COMM_WORLD);
+    }
+    SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::MPI_WAIT);
+
+    myNextSyncTime = min_time + max_period->getFactor();
+#endif
+}
+
+} // namespace SST
@@ -0,0 +1,97 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_SYNC_RANKSYNCPERSISTENT_H
+#define SST_CORE_SYNC_RANKSYNCPERSISTENT_H
+
+#include "sst/core/sst_types.h"
+#include "sst/core/sync/rankSyncSerialSkip.h"
+#include "sst/core/warnmacros.h"
+
+#include <map>
+#include <vector>
+
+#ifdef SST_CONFIG_HAVE_MPI
+DISABLE_WARN_MISSING_OVERRIDE
+#include <mpi.h>
+REENABLE_WARNING
+#endif
+
+namespace SST {
+
+class TimeConverter;
+
+/**
+ * Same schedule as RankSyncSerialSkip, but the receives of each sync
+ * are persistent requests that are started again as soon as the data
+ * of the previous sync has been read, so they are always posted
+ * before the data arrives.
+ *
+ * The receive buffer for each neighbor is sized from the sizes of the
+ * last few messages on that channel.  The sender and the receiver see
+ * the same sizes, so both compute the same buffer size without any
+ * extra messages.  A second "header then payload" round is only
+ * needed when a message is bigger than anything seen recently.
+ */
+class RankSyncPersistent : public RankSyncSerialSkip
+{
+public:
+    RankSyncPersistent(RankInfo num_ranks, TimeConverter* minPartTC);
+    virtual ~RankSyncPersistent();
+
+    void execute(int thread) override;
+
+    /** Cancel the receives posted for a sync that won't happen */
+    void prepareForComplete() override;
+
+private:
+    // Number of message sizes kept to size the buffers
+    static const int HISTORY = 8;
+
+    struct channel
+    {
+        uint32_t sizes[HISTORY]; // Sizes of the last messages
+        int      next;           // Where the next size goes in sizes
+
+        channel() : sizes(), next(0) {}
+
+        /** Record a message size and return the buffer size to use */
+        uint32_t update(uint32_t size, uint32_t current);
+    };
+
+    struct peer
+    {
+        channel send;
+        channel recv;
+        size_t  index; // Index of the receive in rreqs
+    };
+
+    // Function that actually does the exchange during run
+    void exchange();
+
+    /** Create the persistent receive of a peer for its current buffer */
+    void initReceive(int rank, peer& p);
+
+    /** Cancel and free all the persistent receives */
+    void freeReceives();
+
+    std::map<int, peer> peers;
+
+#ifdef SST_CONFIG_HAVE_MPI
+    std::vector<MPI_Request> rreqs;
+#endif
+
+    bool posted; // Receives for the next sync have been started
+};
+
+} // namespace SST
+
+#endif // SST_CORE_SYNC_RANKSYNCPERSISTENT_H
@@ -0,0 +1,278 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/sync/rankSyncRma.h"
+
+#include "sst/core/event.h"
+#include "sst/core/profile.h"
+#include "sst/core/serialization/serializer.h"
+#include "sst/core/simulation_impl.h"
+#include "sst/core/sync/syncQueue.h"
+#include "sst/core/timeConverter.h"
+
+#include <atomic>
+#include <cstring>
+#include <vector>
+
+namespace SST {
+
+// Data that didn't fit in a slot
+static const int DATA_TAG   = 7;
+// Location of the regions when the window is created
+static const int REGION_TAG = 8;
+
+// Each slot starts with the number of the sync that wrote it
+static const uint64_t SLOT_HEADER = sizeof(uint64_t);
+
+// Smallest slot, same as the initial receive buffers
+static const uint32_t MIN_SLOT = 4096;
+
+RankSyncRma::RankSyncRma(RankInfo num_ranks, TimeConverter* minPartTC) :
+    RankSyncSerialSkip(num_ranks, minPartTC),
+    base(nullptr),
+    have_window(false),
+    epoch(0)
+{}
+
+RankSyncRma::~RankSyncRma()
+{
+    // The window is freed in prepareForComplete(), since freeing it
+    // needs all ranks and MPI may already be finalized by now
+}
+
+void
+RankSyncRma::execute(int thread)
+{
+    if ( thread == 0 ) { exchange(); }
+}
+
+void
+RankSyncRma::prepareForComplete()
+{
+    freeWindow();
+}
+
+void
+RankSyncRma::createWindow()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    uint64_t total = 0;
+    for ( auto& x : comm_map ) {
+        peer& p = peers[x.first];
+        if ( p.local_cap < MIN_SLOT ) p.local_cap = MIN_SLOT;
+        // Room for twice the largest data that didn't fit
+        while ( p.local_cap < 2 * static_cast<uint64_t>(p.needed) && p.local_cap <= UINT32_MAX / 2 )
+            p.local_cap *= 2;
+        p.needed       = 0;
+        p.local_offset = total;
+        total += 2 * (SLOT_HEADER + p.local_cap);
+    }
+
+    MPI_Win_allocate(total, 1, MPI_INFO_NULL, MPI_COMM_WORLD, &base, &win);
+    // Nobody can write to the window before getting its region below
+    memset(base, 0, total);
+
+    std::vector<uint64_t>    out(2 * comm_map.size());
+    std::vector<uint64_t>    in(2 * comm_map.size());
+    std::vector<MPI_Request> reqs(2 * comm_map.size());
+    size_t                   index = 0;
+    for ( auto& x : comm_map ) {
+        peer& p            = peers[x.first];
+        out[2 * index]     = p.local_offset;
+        out[2 * index + 1] = p.local_cap;
+        MPI_Isend(&out[2 * index], 2, MPI_UINT64_T, x.first, REGION_TAG, MPI_COMM_WORLD, &reqs[2 * index]);
+        MPI_Irecv(&in[2 * index], 2, MPI_UINT64_T, x.first, REGION_TAG, MPI_COMM_WORLD, &reqs[2 * index + 1]);
+        index++;
+    }
+    MPI_Waitall(reqs.size(), reqs.data(), MPI_STATUSES_IGNORE);
+
+    index = 0;
+    for ( auto& x : comm_map ) {
+        peer& p         = peers[x.first];
+        p.remote_offset = in[2 * index];
+        p.remote_cap    = in[2 * index + 1];
+        index++;
+    }
+
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, win);
+    have_window = true;
+#endif
+}
+
+void
+RankSyncRma::freeWindow()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    if ( !have_window ) return;
+    MPI_Win_unlock_all(win);
+    MPI_Win_free(&win);
+    base        = nullptr;
+    have_window = false;
+#endif
+}
+
+void
+RankSyncRma::exchange()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    if ( !have_window ) createWindow();
+    epoch++;
+    const uint64_t slot_index = epoch % 2;
+
+    // Only data that didn't fit is sent with two-sided messages
+    MPI_Request sreqs[comm_map.size()];
+    int         sreq_count = 0;
+    uint64_t    grow       = 0;
+
+    Simulation_impl* sim = Simulation_impl::getSimulation();
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        SyncProfileToolList::phaseStart(Profile::SyncProfileTool::SERIALIZE);
+        char* send_buffer = i->second.squeue->getData();
+        SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::SERIALIZE);
+
+        SyncQueue::Header* hdr  = reinterpret_cast<SyncQueue::Header*>(send_buffer);
+        peer&              p    = peers[i->first];
+        MPI_Aint           slot = p.remote_offset + slot_index * (SLOT_HEADER + p.remote_cap) + SLOT_HEADER;
+
+        if ( hdr->buffer_size <= p.remote_cap ) {
+            hdr->mode = 0;
+            MPI_Put(
+                send_buffer, hdr->buffer_size, MPI_BYTE, i->first, slot, hdr->buffer_size, MPI_BYTE, win);
+        }
+        else {
+            // Only the header goes in the slot, it tells the peer to
+            // receive the data
+            hdr->mode = 1;
+            MPI_Put(
+                send_buffer, sizeof(SyncQueue::Header), MPI_BYTE, i->first, slot, sizeof(SyncQueue::Header),
+                MPI_BYTE, win);
+            MPI_Isend(
+                send_buffer, hdr->buffer_size, MPI_BYTE, i->first /*dest*/, DATA_TAG, MPI_COMM_WORLD,
+                &sreqs[sreq_count++]);
+            grow = 1;
+        }
+        SyncProfileToolList::dataSent(i->first, hdr->buffer_size);
+    }
+
+    // The sync number is only written once the data is in place
+    MPI_Win_flush_all(win);
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        peer&    p    = peers[i->first];
+        MPI_Aint slot = p.remote_offset + slot_index * (SLOT_HEADER + p.remote_cap);
+        MPI_Put(&epoch, 1, MPI_UINT64_T, i->first, slot, 1, MPI_UINT64_T, win);
+    }
+    MPI_Win_flush_all(win);
+
+    // The need to rebuild the windows goes along with the next sync
+    // time, as the largest of the flags is the smallest of their
+    // complements
+    SimTime_t   input[2]   = { 0, UINT64_MAX - grow };
+    SimTime_t   result[2]  = { 0, 0 };
+    MPI_Request reduce_req = MPI_REQUEST_NULL;
+    if ( nonblocking_reduce ) {
+        input[0] = getLocalMinimumWithSends();
+        MPI_Iallreduce(input, result, 2, MPI_UINT64_T, MPI_MIN, MPI_COMM_WORLD, &reduce_req);
+    }
+
+    SimTime_t current_cycle = sim->getCurrentSimCycle();
+
+    // Wait for the data of all peers
+    SyncProfileToolList::phaseStart(Profile::SyncProfileTool::MPI_WAIT);
+    auto   waitStart = SST::Core::Profile::now();
+    size_t arrived   = 0;
+    while ( arrived < comm_map.size() ) {
+        MPI_Win_sync(win);
+        arrived = 0;
+        for ( auto& x : peers ) {
+            const peer& p    = x.second;
+            char*       slot = base + p.local_offset + slot_index * (SLOT_HEADER + p.local_cap);
+            if ( *reinterpret_cast<volatile uint64_t*>(slot) == epoch ) arrived++;
+        }
+        if ( arrived < comm_map.size() ) {
+            // Some MPI libraries only make progress on one-sided
+            // operations when called
+            int flag;
+            MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, MPI_COMM_WORLD, &flag, MPI_STATUS_IGNORE);
+        }
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+    SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::MPI_WAIT);
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        peer&              p      = peers[i->first];
+        char*              buffer = base + p.local_offset + slot_index * (SLOT_HEADER + p.local_cap) + SLOT_HEADER;
+        SyncQueue::Header* hdr    = reinterpret_cast<SyncQueue::Header*>(buffer);
+
+        if ( hdr->mode == 1 ) {
+            unsigned int size = hdr->buffer_size;
+            if ( size > i->second.local_size ) {
+                delete[] i->second.rbuf;
+                i->second.rbuf       = new char[size];
+                i->second.local_size = size;
+            }
+            SyncProfileToolList::phaseStart(Profile::SyncProfileTool::MPI_WAIT);
+            MPI_Recv(
+                i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, DATA_TAG, MPI_COMM_WORLD,
+                MPI_STATUS_IGNORE);
+            SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::MPI_WAIT);
+            buffer = i->second.rbuf;
+            if ( size > p.needed ) p.needed = size;
+        }
+
+        SyncProfileToolList::phaseStart(Profile::SyncProfileTool::DESERIALIZE);
+        auto deserialStart = SST::Core::Profile::now();
+
+        SST::Core::Serialization::serializer ser;
+        SyncQueue::startUnpacking(ser, buffer);
+
+        std::vector<Activity*> activities;
+        ser&                   activities;
+
+        deserializeTime += SST::Core::Profile::getElapsed(deserialStart);
+        SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::DESERIALIZE);
+
+        sendBatch(activities, current_cycle);
+    }
+
+    SyncProfileToolList::phaseStart(Profile::SyncProfileTool::MPI_WAIT);
+    waitStart = SST::Core::Profile::now();
+    MPI_Waitall(sreq_count, sreqs, MPI_STATUSES_IGNORE);
+    mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+    SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::MPI_WAIT);
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        i->second.squeue->clear();
+    }
+
+    SyncProfileToolList::phaseStart(Profile::SyncProfileTool::MPI_WAIT);
+    if ( nonblocking_reduce ) { MPI_Wait(&reduce_req, MPI_STATUS_IGNORE); }
+    else {
+        input[0] = Simulation_impl::getLocalMinimumNextActivityTime();
+        MPI_Allreduce(input, result, 2, MPI_UINT64_T, MPI_MIN, MPI_COMM_WORLD);
+    }
+    SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::MPI_WAIT);
+
+    myNextSyncTime = result[0] + max_period->getFactor();
+
+    // Some data didn't fit, every rank rebuilds its window with room
+    // for what it received
+    if ( result[1] != UINT64_MAX ) {
+        freeWindow();
+        createWindow();
+    }
+#endif
+}
+
+} // namespace SST
@@ -0,0 +1,90 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_SYNC_RANKSYNCRMA_H
+#define SST_CORE_SYNC_RANKSYNCRMA_H
+
+#include "sst/core/sst_types.h"
+#include "sst/core/sync/rankSyncSerialSkip.h"
+#include "sst/core/warnmacros.h"
+
+#include <map>
+
+#ifdef SST_CONFIG_HAVE_MPI
+DISABLE_WARN_MISSING_OVERRIDE
+#include <mpi.h>
+REENABLE_WARNING
+#endif
+
+namespace SST {
+
+class TimeConverter;
+
+/**
+ * Same schedule as RankSyncSerialSkip, but the data is written with
+ * one-sided puts into an MPI window instead of matched sends and
+ * receives.
+ *
+ * Each rank's window has a region for every rank it has links to, with
+ * two slots used on alternate syncs.  A slot starts with the number of
+ * the sync that wrote it, which is put after the data has completed at
+ * the target, so the receiver polls that number instead of matching
+ * messages.  A sender can't get two syncs ahead of a peer, since every
+ * sync waits for the data of all peers, so a slot is never rewritten
+ * while it is being read.
+ *
+ * Data that doesn't fit in its slot is sent with MPI_Send, and the
+ * windows are rebuilt with bigger slots once the sync completes.  The
+ * need to rebuild is folded into the reduction of the next sync time.
+ */
+class RankSyncRma : public RankSyncSerialSkip
+{
+public:
+    RankSyncRma(RankInfo num_ranks, TimeConverter* minPartTC);
+    virtual ~RankSyncRma();
+
+    void execute(int thread) override;
+
+    /** Free the window, which needs all ranks */
+    void prepareForComplete() override;
+
+private:
+    struct peer
+    {
+        uint64_t local_offset;  // Region of the peer in my window
+        uint32_t local_cap;     // Size of each of its slots
+        uint64_t remote_offset; // Region for me in the peer's window
+        uint32_t remote_cap;
+        uint32_t needed;        // Largest data from the peer that didn't fit
+    };
+
+    // Function that actually does the exchange during run
+    void exchange();
+
+    /** Allocate the window and tell each peer where its region is */
+    void createWindow();
+
+    /** Free the window */
+    void freeWindow();
+
+    std::map<int, peer> peers;
+
+#ifdef SST_CONFIG_HAVE_MPI
+    MPI_Win win;
+#endif
+    char*    base;  // Local memory of the window
+    bool     have_window;
+    uint64_t epoch; // Number of the current sync
+};
+
+} // namespace SST
+
+#endif // SST_CORE_SYNC_RANKSYNCRMA_H
@@ -54,7 +54,9 @@ SimTime_t RankSyncSerialSkip::myNextSyncTime = 0;
 RankSyncSerialSkip::RankSyncSerialSkip(RankInfo num_ranks, TimeConverter* UNUSED(minPartTC)) :
     RankSync(num_ranks),
     mpiWaitTime(0.0),
-    deserializeTime(0.0)
+    deserializeTime(0.0),
+    nonblocking_reduce(Simulation_impl::getSimulation()->getSyncNonblockingReduce()),
+    sparse_untimed(Simulation_impl::getSimulation()->getSyncSparseUntimed())
 {
     max_period     = Simulation_impl::getSimulation()->getMinPartTC();
     myNextSyncTime = max_period->getFactor();
@@ -81,7 +83,7 @@ RankSyncSerialSkip::registerLink(
 
     SyncQueue* queue;
     if ( comm_map.count(to_rank.rank) == 0 ) {
-        queue = comm_map[to_rank.rank].squeue = new SyncQueue();
+        queue = comm_map[to_rank.rank].squeue = new SyncQueue(Simulation_impl::getSimulation()->getSyncCompressThreshold());
         comm_map[to_rank.rank].rbuf           = new char[4096];
         comm_map[to_rank.rank].local_size     = 4096;
         comm_map[to_rank.rank].remote_size    = 4096;
@@ -115,6 +117,19 @@ RankSyncSerialSkip::getDataSize() const
     return count;
 }
 
+SimTime_t
+RankSyncSerialSkip::getLocalMinimumWithSends()
+{
+    // Events received in the exchange were in the SyncQueue of some
+    // rank, so they are covered by that rank's input
+    SimTime_t ret = Simulation_impl::getLocalMinimumNextActivityTime();
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        SimTime_t next = i->second.squeue->getNextDeliveryTime();
+        if ( next < ret ) { ret = next; }
+    }
+    return ret;
+}
+
 void
 RankSyncSerialSkip::execute(int thread)
 {
@@ -138,11 +153,13 @@ RankSyncSerialSkip::exchange(void)
     for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
 
         SST_EVENT_PROFILE_START
+        SyncProfileToolList::phaseStart(Profile::SyncProfileTool::SERIALIZE);
 
         // Do all the sends
         // Get the buffer from the syncQueue
         char* send_buffer = i->second.squeue->getData();
 
+        SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::SERIALIZE);
         SST_EVENT_PROFILE_STOP
 
         // Cast to Header so we can get/fill in data
@@ -164,17 +181,30 @@ RankSyncSerialSkip::exchange(void)
         }
         MPI_Isend(
             send_buffer, hdr->buffer_size, MPI_BYTE, i->first /*dest*/, tag, MPI_COMM_WORLD, &sreqs[sreq_count++]);
+        SyncProfileToolList::dataSent(i->first, hdr->buffer_size);
 
         // Post all the receives
         MPI_Irecv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, 1, MPI_COMM_WORLD, &rreqs[rreq_count++]);
     }
 
+    // The reduction of the next sync time can run while the events
+    // are received and delivered
+    SimTime_t   input      = 0;
+    SimTime_t   min_time   = 0;
+    MPI_Request reduce_req = MPI_REQUEST_NULL;
+    if ( nonblocking_reduce ) {
+        input = getLocalMinimumWithSends();
+        MPI_Iallreduce(&input, &min_time, 1, MPI_UINT64_T, MPI_MIN, MPI_COMM_WORLD, &reduce_req);
+    }
+
     // Wait for all sends and recvs to complete
     SimTime_t current_cycle = sim->getCurrentSimCycle();
 
+    SyncProfileToolList::phaseStart(Profile::SyncProfileTool::MPI_WAIT);
     auto waitStart = SST::Core::Profile::now();
     MPI_Waitall(rreq_count, rreqs, MPI_STATUSES_IGNORE);
     mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+    SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::MPI_WAIT);
 
     for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
         // Get the buffer and deserialize all the events
@@ -191,35 +221,36 @@ RankSyncSerialSkip::exchange(void)
                 i->second.rbuf       = new char[size];
                 i->second.local_size = size;
             }
+            SyncProfileToolList::phaseStart(Profile::SyncProfileTool::MPI_WAIT);
             MPI_Recv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, 2, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::MPI_WAIT);
             buffer = i->second.rbuf;
         }
 
+        SyncProfileToolList::phaseStart(Profile::SyncProfileTool::DESERIALIZE);
         auto deserialStart = SST::Core::Profile::now();
 
         SST::Core::Serialization::serializer ser;
-        ser.start_unpacking(&buffer[sizeof(SyncQueue::Header)], size - sizeof(SyncQueue::Header));
+        SyncQueue::startUnpacking(ser, buffer);
 
         std::vector<Activity*> activities;
         activities.clear();
         ser& activities;
 
         deserializeTime += SST::Core::Profile::getElapsed(deserialStart);
+        SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::DESERIALIZE);
 
-        for ( unsigned int j = 0; j < activities.size(); j++ ) {
-
-            Event*    ev    = static_cast<Event*>(activities[j]);
-            SimTime_t delay = ev->getDeliveryTime() - current_cycle;
-            getDeliveryLink(ev)->send(delay, ev);
-        }
+        sendBatch(activities, current_cycle);
 
         activities.clear();
     }
 
     // Clear the SyncQueues used to send the data after all the sends have completed
+    SyncProfileToolList::phaseStart(Profile::SyncProfileTool::MPI_WAIT);
     waitStart = SST::Core::Profile::now();
     MPI_Waitall(sreq_count, sreqs, MPI_STATUSES_IGNORE);
     mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+    SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::MPI_WAIT);
 
     for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
         i->second.squeue->clear();
@@ -234,9 +265,13 @@ RankSyncSerialSkip::exchange(void)
 
     // Need to get the local minimum, then do a global minimum
     // SimTime_t input = Simulation_impl::getSimulation()->getNextActivityTime();
-    SimTime_t input = Simulation_impl::getLocalMinimumNextActivityTime();
-    SimTime_t min_time;
-    MPI_Allreduce(&input, &min_time, 1, MPI_UINT64_T, MPI_MIN, MPI_COMM_WORLD);
+    SyncProfileToolList::phaseStart(Profile::SyncProfileTool::MPI_WAIT);
+    if ( nonblocking_reduce ) { MPI_Wait(&reduce_req, MPI_STATUS_IGNORE); }
+    else {
+        input = Simulation_impl::getLocalMinimumNextActivityTime();
+        MPI_Allreduce(&input, &min_time, 1, MPI_UINT64_T, MPI_MIN, MPI_COMM_WORLD);
+    }
+    SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::MPI_WAIT);
 
     myNextSyncTime = min_time + max_period->getFactor();
 #endif
@@ -247,6 +282,19 @@ RankSyncSerialSkip::exchangeLinkUntimedData(int UNUSED_WO_MPI(thread), std::atom
 {
 #ifdef SST_CONFIG_HAVE_MPI
     if ( thread != 0 ) { return; }
+
+    if ( sparse_untimed ) {
+        std::vector<std::pair<int, SyncQueue*>> sends;
+        for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+            if ( !i->second.squeue->empty() ) sends.emplace_back(i->first, i->second.squeue);
+        }
+        exchangeLinkUntimedDataSparse(sends, msg_count);
+        for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+            i->second.squeue->clear();
+        }
+        return;
+    }
+
     // Maximum number of outstanding requests is 3 times the number of
     // ranks I communicate with (1 recv, 2 sends per rank)
     MPI_Request sreqs[2 * comm_map.size()];
@@ -254,6 +302,13 @@ RankSyncSerialSkip::exchangeLinkUntimedData(int UNUSED_WO_MPI(thread), std::atom
     int         rreq_count = 0;
     int         sreq_count = 0;
 
+    // The count of messages sent is final before the exchange, so its
+    // sum can be computed while the data moves
+    int         input      = msg_count;
+    int         count      = 0;
+    MPI_Request reduce_req = MPI_REQUEST_NULL;
+    if ( nonblocking_reduce ) MPI_Iallreduce(&input, &count, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD, &reduce_req);
+
     for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
 
         // Do all the sends
@@ -306,7 +361,7 @@ RankSyncSerialSkip::exchangeLinkUntimedData(int UNUSED_WO_MPI(thread), std::atom
         }
 
         SST::Core::Serialization::serializer ser;
-        ser.start_unpacking(&buffer[sizeof(SyncQueue::Header)], size - sizeof(SyncQueue::Header));
+        SyncQueue::startUnpacking(ser, buffer);
 
         std::vector<Activity*> activities;
         ser&                   activities;
@@ -325,10 +380,10 @@ RankSyncSerialSkip::exchangeLinkUntimedData(int UNUSED_WO_MPI(thread), std::atom
     }
 
     // Do an allreduce to see if there were any messages sent
-    int input = msg_count;
-
-    int count;
-    MPI_Allreduce(&input, &count, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+    if ( nonblocking_reduce ) { MPI_Wait(&reduce_req, MPI_STATUS_IGNORE); }
+    else {
+        MPI_Allreduce(&input, &count, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+    }
     msg_count = count;
 #endif
 }
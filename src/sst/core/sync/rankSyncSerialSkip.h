@@ -43,15 +43,13 @@ public:
     void prepareForComplete() override;
 
     SimTime_t getNextSyncTime() override { return myNextSyncTime; }
+    void      setNextSyncTime(SimTime_t time) override { myNextSyncTime = time; }
 
     uint64_t getDataSize() const override;
 
-private:
+protected:
     static SimTime_t myNextSyncTime;
 
-    // Function that actually does the exchange during run
-    void exchange();
-
     struct comm_pair
     {
         SyncQueue* squeue; // SyncQueue
@@ -70,7 +68,23 @@ private:
     double mpiWaitTime;
     double deserializeTime;
 
+    // Start the next sync time reduction before the exchange
+    bool nonblocking_reduce;
+
+    // Only send untimed data to the ranks that have some
+    bool sparse_untimed;
+
+    /** Earliest time of anything on this rank, including the events
+        waiting in the SyncQueues.  Called once all the queues have
+        been serialized, it gives the same global minimum as the local
+        minimum taken after the exchange. */
+    SimTime_t getLocalMinimumWithSends();
+
     Core::ThreadSafe::Spinlock lock;
+
+private:
+    // Function that actually does the exchange during run
+    void exchange();
 };
 
 } // namespace SST
@@ -0,0 +1,355 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/sync/rankSyncShmem.h"
+
+#include "sst/core/event.h"
+#include "sst/core/interprocess/shmregion.h"
+#include "sst/core/profile.h"
+#include "sst/core/serialization/serializer.h"
+#include "sst/core/simulation_impl.h"
+#include "sst/core/sync/syncQueue.h"
+#include "sst/core/timeConverter.h"
+#include "sst/core/warnmacros.h"
+
+#include <atomic>
+#include <cerrno>
+#include <cinttypes>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifdef SST_CONFIG_HAVE_MPI
+DISABLE_WARN_MISSING_OVERRIDE
+#include <mpi.h>
+REENABLE_WARNING
+#endif
+
+namespace SST {
+
+// Header mode of a notice.  0 and 1 are used by the data sent through
+// MPI.
+static const uint32_t SHMEM_MODE = 2;
+
+// Smallest slot of a segment
+static const uint32_t MIN_SLOT = 65536;
+
+RankSyncShmem::RankSyncShmem(RankInfo num_ranks, TimeConverter* minPartTC) :
+    RankSyncSerialSkip(num_ranks, minPartTC),
+    setup_done(false),
+    my_rank(Simulation_impl::getSimulation()->getRank().rank),
+    node_id(0)
+{}
+
+RankSyncShmem::~RankSyncShmem()
+{
+    for ( auto& x : channels ) {
+        closeSegment(x.second.send);
+        closeSegment(x.second.recv);
+        // The peer unlinks a segment once it has mapped it, this only
+        // removes the ones it never got to use
+        if ( !x.second.send.name.empty() ) shm_unlink(x.second.send.name.c_str());
+    }
+    channels.clear();
+}
+
+void
+RankSyncShmem::execute(int thread)
+{
+    if ( thread == 0 ) { exchange(); }
+}
+
+void
+RankSyncShmem::setupChannels()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    // All ranks get here at the first sync of the run, when the links
+    // between ranks are known
+    MPI_Comm node_comm;
+    MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, my_rank, MPI_INFO_NULL, &node_comm);
+
+    int node_size;
+    MPI_Comm_size(node_comm, &node_size);
+    std::vector<int> node_ranks(node_size);
+    MPI_Allgather(&my_rank, 1, MPI_INT, node_ranks.data(), 1, MPI_INT, node_comm);
+
+    // The pid of the first rank on the node can't be in use by another
+    // run on the same node, so it keeps the segment names apart
+    uint32_t pid = getpid();
+    MPI_Bcast(&pid, 1, MPI_UINT32_T, 0, node_comm);
+    node_id = pid;
+
+    MPI_Comm_free(&node_comm);
+
+    for ( int rank : node_ranks ) {
+        if ( comm_map.count(rank) == 0 ) continue;
+        channel& ch = channels[rank];
+        ch.slot     = 0;
+    }
+#endif
+    setup_done = true;
+}
+
+std::string
+RankSyncShmem::segmentName(int from, int to, uint32_t capacity) const
+{
+    char name[128];
+    snprintf(name, sizeof(name), "/sst_ranksync_%" PRIu32 "_%d_%d_%" PRIu32, node_id, from, to, capacity);
+    return name;
+}
+
+void
+RankSyncShmem::growSegment(int rank, channel& ch, size_t size)
+{
+    uint64_t capacity = MIN_SLOT;
+    while ( capacity < 2 * static_cast<uint64_t>(size) )
+        capacity *= 2;
+    // Nothing this large could have been sent anyway
+    if ( capacity > UINT32_MAX ) return;
+
+    // The peer keeps its mapping of the old segment until it sees a
+    // notice for the new one
+    closeSegment(ch.send);
+    if ( !ch.send.name.empty() ) shm_unlink(ch.send.name.c_str());
+
+    std::string name = segmentName(my_rank, rank, capacity);
+    int         fd   = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+    if ( fd < 0 && errno == EEXIST ) {
+        // Left behind by a run that crashed with the same pid
+        shm_unlink(name.c_str());
+        fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+    }
+    if ( fd < 0 ) {
+        Simulation_impl::getSimulationOutput().fatal(
+            CALL_INFO, 1, "ERROR: Failed to create rank sync segment '%s': %s\n", name.c_str(), strerror(errno));
+    }
+
+    size_t bytes = Core::Interprocess::RegionUtil::roundToPageSize(fd, 2 * capacity);
+    if ( ftruncate(fd, bytes) ) {
+        Simulation_impl::getSimulationOutput().fatal(
+            CALL_INFO, 1, "ERROR: Resizing rank sync segment '%s' failed: %s\n", name.c_str(), strerror(errno));
+    }
+
+    void* ptr = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if ( ptr == MAP_FAILED ) {
+        Simulation_impl::getSimulationOutput().fatal(
+            CALL_INFO, 1, "ERROR: mmap of rank sync segment '%s' failed: %s\n", name.c_str(), strerror(errno));
+    }
+    close(fd);
+
+    ch.send.name     = name;
+    ch.send.ptr      = static_cast<char*>(ptr);
+    ch.send.size     = bytes;
+    ch.send.capacity = capacity;
+    ch.slot          = 0;
+}
+
+void
+RankSyncShmem::openSegment(int rank, channel& ch, uint32_t capacity)
+{
+    closeSegment(ch.recv);
+
+    std::string name = segmentName(rank, my_rank, capacity);
+    int         fd   = shm_open(name.c_str(), O_RDONLY, S_IRUSR | S_IWUSR);
+    if ( fd < 0 ) {
+        Simulation_impl::getSimulationOutput().fatal(
+            CALL_INFO, 1, "ERROR: Failed to open rank sync segment '%s': %s\n", name.c_str(), strerror(errno));
+    }
+
+    size_t bytes = Core::Interprocess::RegionUtil::roundToPageSize(fd, 2 * static_cast<size_t>(capacity));
+    void*  ptr   = mmap(nullptr, bytes, PROT_READ, MAP_SHARED, fd, 0);
+    if ( ptr == MAP_FAILED ) {
+        Simulation_impl::getSimulationOutput().fatal(
+            CALL_INFO, 1, "ERROR: mmap of rank sync segment '%s' failed: %s\n", name.c_str(), strerror(errno));
+    }
+    close(fd);
+    // Both sides have it mapped now, so the name is no longer needed
+    shm_unlink(name.c_str());
+
+    ch.recv.name     = name;
+    ch.recv.ptr      = static_cast<char*>(ptr);
+    ch.recv.size     = bytes;
+    ch.recv.capacity = capacity;
+}
+
+void
+RankSyncShmem::closeSegment(segment& seg)
+{
+    if ( seg.ptr ) munmap(seg.ptr, seg.size);
+    seg.ptr      = nullptr;
+    seg.size     = 0;
+    seg.capacity = 0;
+}
+
+void
+RankSyncShmem::exchange()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    if ( !setup_done ) setupChannels();
+
+    // Maximum number of outstanding requests is 3 times the number
+    // of ranks I communicate with (1 recv, 2 sends per rank)
+    MPI_Request sreqs[2 * comm_map.size()];
+    MPI_Request rreqs[comm_map.size()];
+    int         sreq_count = 0;
+    int         rreq_count = 0;
+
+    Simulation_impl* sim = Simulation_impl::getSimulation();
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        auto     ch_it  = channels.find(i->first);
+        channel* ch     = ch_it == channels.end() ? nullptr : &ch_it->second;
+        bool     in_shm = false;
+
+        SyncProfileToolList::phaseStart(Profile::SyncProfileTool::SERIALIZE);
+        char* send_buffer;
+        if ( ch ) {
+            // Serialize into the free slot if the data fits
+            send_buffer = i->second.squeue->getData([ch, &in_shm](size_t size) {
+                if ( size <= ch->send.capacity ) {
+                    in_shm = true;
+                    return ch->send.ptr + ch->slot * ch->send.capacity;
+                }
+                ch->spill.resize(size);
+                return ch->spill.data();
+            });
+        }
+        else {
+            send_buffer = i->second.squeue->getData();
+        }
+        SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::SERIALIZE);
+
+        SyncQueue::Header* hdr = reinterpret_cast<SyncQueue::Header*>(send_buffer);
+
+        if ( in_shm ) {
+            ch->note.mode     = SHMEM_MODE;
+            ch->note.slot     = ch->slot;
+            ch->note.capacity = ch->send.capacity;
+            ch->note.size     = hdr->buffer_size;
+            ch->slot ^= 1;
+
+            // The data has to be visible before the peer sees the notice
+            std::atomic_thread_fence(std::memory_order_release);
+            MPI_Isend(
+                &ch->note, sizeof(notice), MPI_BYTE, i->first /*dest*/, 1, MPI_COMM_WORLD, &sreqs[sreq_count++]);
+        }
+        else {
+            int tag = 1;
+            // Check to see if remote queue is big enough for data
+            if ( i->second.remote_size < hdr->buffer_size ) {
+                // not big enough, send message that will tell remote side to get larger buffer
+                hdr->mode = 1;
+                MPI_Isend(
+                    send_buffer, sizeof(SyncQueue::Header), MPI_BYTE, i->first /*dest*/, tag, MPI_COMM_WORLD,
+                    &sreqs[sreq_count++]);
+                i->second.remote_size = hdr->buffer_size;
+                tag                   = 2;
+            }
+            else {
+                hdr->mode = 0;
+            }
+            MPI_Isend(
+                send_buffer, hdr->buffer_size, MPI_BYTE, i->first /*dest*/, tag, MPI_COMM_WORLD,
+                &sreqs[sreq_count++]);
+
+            // Make room for data this size in the following syncs
+            if ( ch ) growSegment(i->first, *ch, hdr->buffer_size);
+        }
+        SyncProfileToolList::dataSent(i->first, hdr->buffer_size);
+
+        // Post all the receives
+        MPI_Irecv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, 1, MPI_COMM_WORLD, &rreqs[rreq_count++]);
+    }
+
+    SimTime_t   input      = 0;
+    SimTime_t   min_time   = 0;
+    MPI_Request reduce_req = MPI_REQUEST_NULL;
+    if ( nonblocking_reduce ) {
+        input = getLocalMinimumWithSends();
+        MPI_Iallreduce(&input, &min_time, 1, MPI_UINT64_T, MPI_MIN, MPI_COMM_WORLD, &reduce_req);
+    }
+
+    SimTime_t current_cycle = sim->getCurrentSimCycle();
+
+    SyncProfileToolList::phaseStart(Profile::SyncProfileTool::MPI_WAIT);
+    auto waitStart = SST::Core::Profile::now();
+    MPI_Waitall(rreq_count, rreqs, MPI_STATUSES_IGNORE);
+    mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+    SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::MPI_WAIT);
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        char*              buffer = i->second.rbuf;
+        SyncQueue::Header* hdr    = reinterpret_cast<SyncQueue::Header*>(buffer);
+
+        if ( hdr->mode == SHMEM_MODE ) {
+            notice*  note = reinterpret_cast<notice*>(buffer);
+            channel& ch   = channels[i->first];
+            if ( note->capacity != ch.recv.capacity ) openSegment(i->first, ch, note->capacity);
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            buffer = ch.recv.ptr + note->slot * ch.recv.capacity;
+        }
+        else if ( hdr->mode == 1 ) {
+            // May need to resize the buffer
+            unsigned int size = hdr->buffer_size;
+            if ( size > i->second.local_size ) {
+                delete[] i->second.rbuf;
+                i->second.rbuf       = new char[size];
+                i->second.local_size = size;
+            }
+            SyncProfileToolList::phaseStart(Profile::SyncProfileTool::MPI_WAIT);
+            MPI_Recv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, 2, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::MPI_WAIT);
+            buffer = i->second.rbuf;
+        }
+
+        SyncProfileToolList::phaseStart(Profile::SyncProfileTool::DESERIALIZE);
+        auto deserialStart = SST::Core::Profile::now();
+
+        SST::Core::Serialization::serializer ser;
+        SyncQueue::startUnpacking(ser, buffer);
+
+        std::vector<Activity*> activities;
+        ser&                   activities;
+
+        deserializeTime += SST::Core::Profile::getElapsed(deserialStart);
+        SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::DESERIALIZE);
+
+        sendBatch(activities, current_cycle);
+    }
+
+    SyncProfileToolList::phaseStart(Profile::SyncProfileTool::MPI_WAIT);
+    waitStart = SST::Core::Profile::now();
+    MPI_Waitall(sreq_count, sreqs, MPI_STATUSES_IGNORE);
+    mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+    SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::MPI_WAIT);
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        i->second.squeue->clear();
+    }
+
+    SyncProfileToolList::phaseStart(Profile::SyncProfileTool::MPI_WAIT);
+    if ( nonblocking_reduce ) { MPI_Wait(&reduce_req, MPI_STATUS_IGNORE); }
+    else {
+        input = Simulation_impl::getLocalMinimumNextActivityTime();
+        MPI_Allreduce(&input, &min_time, 1, MPI_UINT64_T, MPI_MIN, MPI_COMM_WORLD);
+    }
+    SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::MPI_WAIT);
+
+    myNextSyncTime = min_time + max_period->getFactor();
+#endif
+}
+
+} // namespace SST
@@ -0,0 +1,109 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_SYNC_RANKSYNCSHMEM_H
+#define SST_CORE_SYNC_RANKSYNCSHMEM_H
+
+#include "sst/core/sst_types.h"
+#include "sst/core/sync/rankSyncSerialSkip.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace SST {
+
+class TimeConverter;
+
+/**
+ * Same schedule as RankSyncSerialSkip, but the events sent to a rank
+ * on the same node are serialized straight into a POSIX shared memory
+ * segment that the receiving rank has mapped.  MPI only carries a
+ * small notice saying which half of the segment holds the data, and
+ * still carries the full data for ranks on other nodes.
+ *
+ * Each segment belongs to one sender and one receiver and has two
+ * slots used on alternate syncs.  A sender can't get two syncs ahead
+ * of a receiver it shares links with, since every sync waits for the
+ * data of all its peers, so a slot is never rewritten while it is
+ * being read.  Data that doesn't fit in a slot is sent through MPI and
+ * the sender creates a bigger segment for the following syncs.
+ */
+class RankSyncShmem : public RankSyncSerialSkip
+{
+public:
+    RankSyncShmem(RankInfo num_ranks, TimeConverter* minPartTC);
+    virtual ~RankSyncShmem();
+
+    void execute(int thread) override;
+
+private:
+    // Mapping of a shared memory segment
+    struct segment
+    {
+        std::string name;
+        char*       ptr;
+        size_t      size;
+        uint32_t    capacity; // Size of each of the two slots
+
+        segment() : ptr(nullptr), size(0), capacity(0) {}
+    };
+
+    // Sent through MPI in place of the data when the data is in
+    // shared memory.  mode is in the same place as in
+    // SyncQueue::Header so the receiver can tell them apart.
+    struct notice
+    {
+        uint32_t mode;
+        uint32_t slot;
+        uint32_t capacity;
+        uint32_t size;
+    };
+
+    struct channel
+    {
+        segment           send;   // Segment this rank writes to the peer
+        segment           recv;   // Segment the peer writes to this rank
+        uint32_t          slot;   // Slot of send to use next
+        notice            note;   // Notice of the last send
+        std::vector<char> spill;  // Data that didn't fit in send
+    };
+
+    // Function that actually does the exchange during run
+    void exchange();
+
+    /** Find the ranks on this node and set up their channels */
+    void setupChannels();
+
+    /** Name of the segment from one rank to another */
+    std::string segmentName(int from, int to, uint32_t capacity) const;
+
+    /** Replace the send segment of a channel with one with slots of
+        at least size bytes */
+    void growSegment(int rank, channel& ch, size_t size);
+
+    /** Map the segment a peer has created for this rank */
+    void openSegment(int rank, channel& ch, uint32_t capacity);
+
+    /** Unmap a segment */
+    static void closeSegment(segment& seg);
+
+    // Channels to the ranks on the same node
+    std::map<int, channel> channels;
+
+    bool     setup_done;
+    int      my_rank;
+    uint32_t node_id; // Identifies this run's segments on the node
+};
+
+} // namespace SST
+
+#endif // SST_CORE_SYNC_RANKSYNCSHMEM_H
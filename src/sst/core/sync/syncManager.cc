@@ -13,12 +13,22 @@
 
 #include "sst/core/sync/syncManager.h"
 
+#include "sst/core/cputimer.h"
 #include "sst/core/exit.h"
 #include "sst/core/objectComms.h"
 #include "sst/core/profile/syncProfileTool.h"
+#include "sst/core/serialization/serializer.h"
 #include "sst/core/simulation_impl.h"
+#include "sst/core/sync/rankSyncNullMessage.h"
+#include "sst/core/sync/rankSyncOptimistic.h"
+#include "sst/core/sync/rankSyncOverlap.h"
+#include "sst/core/sync/rankSyncPairwise.h"
 #include "sst/core/sync/rankSyncParallelSkip.h"
+#include "sst/core/sync/rankSyncPersistent.h"
+#include "sst/core/sync/rankSyncRma.h"
 #include "sst/core/sync/rankSyncSerialSkip.h"
+#include "sst/core/sync/rankSyncShmem.h"
+#include "sst/core/sync/syncQueue.h"
 #include "sst/core/sync/threadSyncDirectSkip.h"
 #include "sst/core/sync/threadSyncQueue.h"
 #include "sst/core/sync/threadSyncSimpleSkip.h"
@@ -207,34 +217,78 @@ RankSync::exchangeLinkInfo(uint32_t UNUSED_WO_MPI(my_rank))
 #endif
 }
 
-// Class used to hold the list of profile tools installed in the SyncManager
-class SyncProfileToolList
-{
-public:
-    SyncProfileToolList() {}
-
-    void syncManagerStart()
-    {
-        for ( auto* x : tools )
-            x->syncManagerStart();
-    }
+// Tags of the sparse untimed exchange, alternated between rounds.
+// These are above the ones used by the thread based syncs.
+#define UNTIMED_SPARSE_TAG 0x7ff0
 
-    void syncManagerEnd()
-    {
-        for ( auto* x : tools )
-            x->syncManagerEnd();
+void
+RankSync::exchangeLinkUntimedDataSparse(
+    const std::vector<std::pair<int, SyncQueue*>>& UNUSED_WO_MPI(sends), std::atomic<int>& UNUSED_WO_MPI(msg_count))
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    // A rank can start sending the next round before a slower rank
+    // sees this one end, so the rounds use different tags
+    int tag = UNTIMED_SPARSE_TAG + (untimed_round++ & 1);
+
+    // Synchronous sends only complete once they are received, so
+    // once a rank's sends are done it has nothing left in flight
+    std::vector<MPI_Request> sreqs(sends.size());
+    for ( size_t i = 0; i < sends.size(); ++i ) {
+        char*              send_buffer = sends[i].second->getData();
+        SyncQueue::Header* hdr         = reinterpret_cast<SyncQueue::Header*>(send_buffer);
+        hdr->mode                      = 0;
+        MPI_Issend(send_buffer, hdr->buffer_size, MPI_BYTE, sends[i].first /*dest*/, tag, MPI_COMM_WORLD, &sreqs[i]);
     }
 
-    /**
-       Adds a profile tool the the list and registers this handler
-       with the profile tool
-    */
-    void addProfileTool(Profile::SyncProfileTool* tool) { tools.push_back(tool); }
+    // Receive until every rank has finished sending.  The sum of the
+    // message counts is the consensus, so it replaces the barrier of
+    // NBX and no separate reduction is needed.
+    int               input      = msg_count;
+    int               count      = 0;
+    MPI_Request       reduce_req = MPI_REQUEST_NULL;
+    bool              reducing   = false;
+    bool              done       = false;
+    std::vector<char> rbuf;
+    while ( !done ) {
+        int        flag;
+        MPI_Status status;
+        MPI_Iprobe(MPI_ANY_SOURCE, tag, MPI_COMM_WORLD, &flag, &status);
+        if ( flag ) {
+            int size;
+            MPI_Get_count(&status, MPI_BYTE, &size);
+            rbuf.resize(size);
+            MPI_Recv(rbuf.data(), size, MPI_BYTE, status.MPI_SOURCE, tag, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+
+            SST::Core::Serialization::serializer ser;
+            SyncQueue::startUnpacking(ser, rbuf.data());
+
+            std::vector<Activity*> activities;
+            ser&                   activities;
+            for ( unsigned int j = 0; j < activities.size(); j++ ) {
+                Event* ev = static_cast<Event*>(activities[j]);
+                sendUntimedData_sync(getDeliveryLink(ev), ev);
+            }
+        }
 
-private:
-    std::vector<Profile::SyncProfileTool*> tools;
-};
+        if ( !reducing ) {
+            int sent;
+            MPI_Testall(sreqs.size(), sreqs.data(), &sent, MPI_STATUSES_IGNORE);
+            if ( sent ) {
+                MPI_Iallreduce(&input, &count, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD, &reduce_req);
+                reducing = true;
+            }
+        }
+        else {
+            int reduced;
+            MPI_Test(&reduce_req, &reduced, MPI_STATUS_IGNORE);
+            done = reduced;
+        }
+    }
+    msg_count = count;
+#endif
+}
 
+thread_local SyncProfileToolList* SyncProfileToolList::current = nullptr;
 
 SyncManager::SyncManager(
     const RankInfo& rank, const RankInfo& num_ranks, TimeConverter* minPartTC, SimTime_t min_part,
@@ -254,7 +308,67 @@ SyncManager::SyncManager(
         for ( auto& b : LinkUntimedBarrier ) {
             b.resize(num_ranks.thread);
         }
-        if ( min_part != MAX_SIMTIME_T ) {
+        if ( min_part != MAX_SIMTIME_T && sim->rank_sync == "nullmessage" ) {
+            if ( num_ranks.thread > 1 ) {
+                sim->getSimulationOutput().fatal(
+                    CALL_INFO, 1, "ERROR: --rank-sync=nullmessage only supports one thread per rank\n");
+            }
+            if ( sim->checkpoint_period != 0 || sim->load_checkpoint != "" ) {
+                sim->getSimulationOutput().fatal(
+                    CALL_INFO, 1, "ERROR: --rank-sync=nullmessage does not support checkpoints\n");
+            }
+            rankSync = new RankSyncNullMessage(num_ranks, minPartTC);
+        }
+        else if ( min_part != MAX_SIMTIME_T && sim->rank_sync == "optimistic" ) {
+            if ( num_ranks.thread > 1 ) {
+                sim->getSimulationOutput().fatal(
+                    CALL_INFO, 1, "ERROR: --rank-sync=optimistic only supports one thread per rank\n");
+            }
+            if ( sim->checkpoint_period != 0 || sim->load_checkpoint != "" ) {
+                sim->getSimulationOutput().fatal(
+                    CALL_INFO, 1, "ERROR: --rank-sync=optimistic does not support checkpoints\n");
+            }
+            rankSync = new RankSyncOptimistic(num_ranks, minPartTC, sim->optimistic_window);
+        }
+        else if ( min_part != MAX_SIMTIME_T && sim->rank_sync == "overlap" ) {
+            if ( min_part < 2 ) {
+                sim->getSimulationOutput().fatal(
+                    CALL_INFO, 1,
+                    "ERROR: --rank-sync=overlap needs a minimum partition latency of at least 2 core time units\n");
+            }
+            if ( sim->checkpoint_period != 0 || sim->load_checkpoint != "" ) {
+                sim->getSimulationOutput().fatal(
+                    CALL_INFO, 1, "ERROR: --rank-sync=overlap does not support checkpoints\n");
+            }
+#ifdef SST_CONFIG_HAVE_MPI
+            int thread_level;
+            MPI_Query_thread(&thread_level);
+            if ( thread_level < MPI_THREAD_MULTIPLE ) {
+                sim->getSimulationOutput().fatal(
+                    CALL_INFO, 1,
+                    "ERROR: --rank-sync=overlap needs MPI_THREAD_MULTIPLE, which is only requested when the option "
+                    "is given on the command line\n");
+            }
+#endif
+            rankSync = new RankSyncOverlap(num_ranks, minPartTC);
+        }
+        else if ( min_part != MAX_SIMTIME_T && sim->rank_sync == "pairwise" ) {
+            if ( sim->checkpoint_period != 0 || sim->load_checkpoint != "" ) {
+                sim->getSimulationOutput().fatal(
+                    CALL_INFO, 1, "ERROR: --rank-sync=pairwise does not support checkpoints\n");
+            }
+            rankSync = new RankSyncPairwise(num_ranks, minPartTC);
+        }
+        else if ( min_part != MAX_SIMTIME_T && sim->rank_sync == "persistent" ) {
+            rankSync = new RankSyncPersistent(num_ranks, minPartTC);
+        }
+        else if ( min_part != MAX_SIMTIME_T && sim->rank_sync == "shmem" ) {
+            rankSync = new RankSyncShmem(num_ranks, minPartTC);
+        }
+        else if ( min_part != MAX_SIMTIME_T && sim->rank_sync == "rma" ) {
+            rankSync = new RankSyncRma(num_ranks, minPartTC);
+        }
+        else if ( min_part != MAX_SIMTIME_T ) {
             if ( num_ranks.thread == 1 ) { rankSync = new RankSyncSerialSkip(num_ranks, minPartTC); }
             else {
                 rankSync = new RankSyncParallelSkip(num_ranks, minPartTC);
@@ -326,6 +440,9 @@ SyncManager::execute(void)
 
     SST_SYNC_PROFILE_START
 
+    double sync_start = track_sync_time ? sst_get_cpu_time() : 0.0;
+
+    SyncProfileToolList::current = profile_tools;
     if ( profile_tools ) profile_tools->syncManagerStart();
 
     switch ( next_sync_type ) {
@@ -333,55 +450,90 @@ SyncManager::execute(void)
         // Need to make sure all threads have reached the sync to
         // guarantee that all events have been sent to the appropriate
         // queues.
-        RankExecBarrier[0].wait();
+        barrierWait(RankExecBarrier[0]);
 
         // For a rank sync, we will force a thread sync first.  This
         // will ensure that all events sent between threads will be
         // flushed into their respective TimeVortices.  We need to do
         // this to enable any skip ahead optimizations.
+        SyncProfileToolList::phaseStart(Profile::SyncProfileTool::THREAD_SYNC);
         threadSync->before();
+        SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::THREAD_SYNC);
 
         // Need to make sure everyone has made it through the mutex
         // and the min time computation is complete
-        RankExecBarrier[1].wait();
+        barrierWait(RankExecBarrier[1]);
 
         // Now call the actual RankSync
         rankSync->execute(rank.thread);
 
-        RankExecBarrier[2].wait();
+        barrierWait(RankExecBarrier[2]);
 
         // Now call the threadSync after() call
+        SyncProfileToolList::phaseStart(Profile::SyncProfileTool::THREAD_SYNC);
         threadSync->after();
+        SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::THREAD_SYNC);
 
-        RankExecBarrier[3].wait();
+        barrierWait(RankExecBarrier[3]);
 
-        if ( exit != nullptr && rank.thread == 0 ) exit->check();
+        if ( exit != nullptr && rank.thread == 0 && rankSync->isGlobalSync() ) exit->check();
 
-        RankExecBarrier[4].wait();
+        barrierWait(RankExecBarrier[4]);
 
-        if ( exit->getGlobalCount() == 0 ) { endSimulation(exit->getEndTime()); }
+        // The Exit count is only updated at global syncs
+        if ( rankSync->isGlobalSync() ) {
+            if ( exit->getGlobalCount() == 0 && rankSync->reachedEndTime(exit->getEndTime()) ) {
+                endSimulation(exit->getEndTime());
+            }
+            else if ( rankSync->getStopTime() != MAX_SIMTIME_T ) {
+                endSimulation(rankSync->getStopTime());
+            }
+        }
+
+        // All events between ranks and threads have been delivered,
+        // so this is a consistent point to checkpoint at
+        if ( sim->checkpointDue() && !sim->endSim ) {
+            sim->checkpoint(rankSync->getNextSyncTime(), threadSync->getNextSyncTime());
+        }
 
         break;
     case THREAD:
 
+        // The ThreadSync reports its own barrier waits
         threadSync->execute();
 
         if ( /*num_ranks.rank == 1*/ min_part == MAX_SIMTIME_T ) {
             if ( exit->getRefCount() == 0 ) { endSimulation(exit->getEndTime()); }
         }
 
+        // Events between ranks are only delivered at rank syncs, so
+        // a thread sync is only consistent when no links cross ranks
+        if ( min_part == MAX_SIMTIME_T && sim->checkpointDue() && !sim->endSim ) {
+            sim->checkpoint(rankSync->getNextSyncTime(), threadSync->getNextSyncTime());
+        }
+
         break;
     default:
         break;
     }
     computeNextInsert();
-    RankExecBarrier[5].wait();
+    barrierWait(RankExecBarrier[5]);
 
     if ( profile_tools ) profile_tools->syncManagerEnd();
 
+    if ( track_sync_time ) sync_time += sst_get_cpu_time() - sync_start;
+
     SST_SYNC_PROFILE_STOP
 }
 
+void
+SyncManager::barrierWait(Core::ThreadSafe::Barrier& barrier)
+{
+    SyncProfileToolList::phaseStart(Profile::SyncProfileTool::BARRIER);
+    barrier.wait();
+    SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::BARRIER);
+}
+
 /** Cause an exchange of Untimed Data to occur */
 void
 SyncManager::exchangeLinkUntimedData(std::atomic<int>& msg_count)
@@ -415,6 +567,22 @@ SyncManager::prepareForComplete()
     if ( rank.thread == 0 ) rankSync->prepareForComplete();
 }
 
+void
+SyncManager::restoreSyncTimes(SimTime_t rank_sync_time, SimTime_t thread_sync_time)
+{
+    // Only thread 0 should set the time on rankSync.  Syncs that are
+    // not needed by this partition are left unscheduled, which only
+    // matters when the checkpoint was written by a different one.
+    if ( rank.thread == 0 && rankSync->getNextSyncTime() != MAX_SIMTIME_T ) {
+        rankSync->setNextSyncTime(rank_sync_time);
+    }
+    if ( threadSync->getNextSyncTime() != MAX_SIMTIME_T ) threadSync->setNextSyncTime(thread_sync_time);
+
+    // Everyone needs the new rank sync time before scheduling
+    RankExecBarrier[5].wait();
+    computeNextInsert();
+}
+
 void
 SyncManager::computeNextInsert()
 {
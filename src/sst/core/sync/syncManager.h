@@ -14,6 +14,7 @@
 
 #include "sst/core/action.h"
 #include "sst/core/link.h"
+#include "sst/core/profile/syncProfileTool.h"
 #include "sst/core/rankInfo.h"
 #include "sst/core/sst_types.h"
 #include "sst/core/threadsafe.h"
@@ -26,13 +27,67 @@ namespace SST {
 class Exit;
 class Simulation_impl;
 // class SyncBase;
+class SyncQueue;
 class ThreadSyncQueue;
 class TimeConverter;
 
-class SyncProfileToolList;
-namespace Profile {
-class SyncProfileTool;
-}
+// Class used to hold the list of profile tools installed in the SyncManager
+class SyncProfileToolList
+{
+public:
+    SyncProfileToolList() {}
+
+    void syncManagerStart()
+    {
+        for ( auto* x : tools )
+            x->syncManagerStart();
+    }
+
+    void syncManagerEnd()
+    {
+        for ( auto* x : tools )
+            x->syncManagerEnd();
+    }
+
+    /**
+       Adds a profile tool the the list and registers this handler
+       with the profile tool
+    */
+    void addProfileTool(Profile::SyncProfileTool* tool) { tools.push_back(tool); }
+
+    /**
+       The RankSync and ThreadSync objects are shared by the threads
+       of a rank, so they report the phases of a sync through these
+       functions, which go to the profile tools of the SyncManager on
+       the calling thread.  They do nothing if it has no tools.
+    */
+    static void phaseStart(Profile::SyncProfileTool::Phase phase)
+    {
+        if ( current )
+            for ( auto* x : current->tools )
+                x->syncPhaseStart(phase);
+    }
+
+    static void phaseEnd(Profile::SyncProfileTool::Phase phase)
+    {
+        if ( current )
+            for ( auto* x : current->tools )
+                x->syncPhaseEnd(phase);
+    }
+
+    static void dataSent(uint32_t rank, uint64_t bytes)
+    {
+        if ( current )
+            for ( auto* x : current->tools )
+                x->syncDataSent(rank, bytes);
+    }
+
+    // Tools of the SyncManager running on this thread
+    static thread_local SyncProfileToolList* current;
+
+private:
+    std::vector<Profile::SyncProfileTool*> tools;
+};
 
 class RankSync
 {
@@ -51,17 +106,38 @@ public:
     virtual void prepareForComplete()                                             = 0;
 
     virtual SimTime_t getNextSyncTime() { return nextSyncTime; }
+    /** Set the time of the next sync, used when restoring from a checkpoint */
+    virtual void      setNextSyncTime(SimTime_t time) { nextSyncTime = time; }
 
     // void setMaxPeriod(TimeConverter* period) {max_period = period;}
     TimeConverter* getMaxPeriod() { return max_period; }
 
     virtual uint64_t getDataSize() const = 0;
 
+    /** Check whether every rank has reached end_time, after Exit found
+     * that all primary components are done.  Must be called on all
+     * ranks.  Syncs that keep all ranks at the same time can always
+     * end right away. */
+    virtual bool reachedEndTime(SimTime_t UNUSED(end_time)) { return true; }
+
+    /** Time all ranks agreed to stop at in the last exchange, or
+     * MAX_SIMTIME_T.  Syncs that let ranks run at different times
+     * can't leave it to each rank's StopAction, since all ranks have
+     * to end at the same sync. */
+    virtual SimTime_t getStopTime() { return MAX_SIMTIME_T; }
+
+    /** Whether every rank took part in the last exchange.  Collectives
+     * outside the sync, like the Exit check, are only done after those. */
+    virtual bool isGlobalSync() { return true; }
+
 protected:
     SimTime_t      nextSyncTime;
     TimeConverter* max_period;
     const RankInfo num_ranks;
 
+    // Count of sparse untimed exchanges, used to alternate their tags
+    uint32_t untimed_round = 0;
+
     std::vector<std::map<std::string, uintptr_t>> link_maps;
 
     void finalizeConfiguration(Link* link) { link->finalizeConfiguration(); }
@@ -74,6 +150,26 @@ protected:
 
     inline Link* getDeliveryLink(Event* ev) { return ev->getDeliveryLink(); }
 
+    /** Exchange untimed data with a nonblocking consensus (NBX).  Only
+     * the queues in sends, given as (rank, queue), are sent, and data
+     * is received from whichever ranks send it.  The round ends with a
+     * nonblocking sum of msg_count, which is set to the result.  Must
+     * be called on thread 0 of all ranks.  The caller clears the
+     * queues afterwards. */
+    void exchangeLinkUntimedDataSparse(
+        const std::vector<std::pair<int, SyncQueue*>>& sends, std::atomic<int>& msg_count);
+
+    /** Latency of events sent to the remote rank on a link given to
+     * registerLink() */
+    SimTime_t getSendLatency(Link* link) { return link->pair_link->latency; }
+
+    /** Send a window of received events on their delivery links,
+     * batching the inserts into the destination queues */
+    inline void sendBatch(std::vector<Activity*>& vec, SimTime_t current_cycle)
+    {
+        Link::sendBatch_sync(vec.data(), vec.data() + vec.size(), current_cycle);
+    }
+
 private:
 };
 
@@ -91,6 +187,8 @@ public:
     virtual void prepareForComplete()         = 0;
 
     virtual SimTime_t getNextSyncTime() { return nextSyncTime; }
+    /** Set the time of the next sync, used when restoring from a checkpoint */
+    virtual void      setNextSyncTime(SimTime_t time) { nextSyncTime = time; }
 
     void           setMaxPeriod(TimeConverter* period) { max_period = period; }
     TimeConverter* getMaxPeriod() { return max_period; }
@@ -113,6 +211,13 @@ protected:
 
     inline Link* getDeliveryLink(Event* ev) { return ev->getDeliveryLink(); }
 
+    /** Send a window of received events on their delivery links,
+     * batching the inserts into the destination queues */
+    inline void sendBatch(std::vector<Activity*>& vec, SimTime_t current_cycle)
+    {
+        Link::sendBatch_sync(vec.data(), vec.data() + vec.size(), current_cycle);
+    }
+
 private:
 };
 
@@ -136,12 +241,24 @@ public:
     void finalizeLinkConfigurations();
     void prepareForComplete();
 
+    /** Restore the times of the next syncs when restarting from a
+     * checkpoint and schedule the next one.  Syncs this partition does
+     * not need stay unscheduled.  Must be called by all threads.
+     */
+    void restoreSyncTimes(SimTime_t rank_sync_time, SimTime_t thread_sync_time);
+
     void print(const std::string& header, Output& out) const override;
 
     uint64_t getDataSize() const;
 
     void addProfileTool(Profile::SyncProfileTool* tool);
 
+    /** Start keeping track of the wall-clock time spent in syncs */
+    void trackSyncTime() { track_sync_time = true; }
+
+    /** Wall-clock time in seconds spent in syncs, if tracked */
+    double getSyncTime() const { return sync_time; }
+
 private:
     enum sync_type_t { RANK, THREAD };
 
@@ -163,8 +280,14 @@ private:
 
     SyncProfileToolList* profile_tools = nullptr;
 
+    bool   track_sync_time = false;
+    double sync_time       = 0.0;
+
     void computeNextInsert();
 
+    /** Wait on a barrier, reporting the wait to the profile tools */
+    void barrierWait(Core::ThreadSafe::Barrier& barrier);
+
     NotSerializable(SST::SyncManager)
 };
 
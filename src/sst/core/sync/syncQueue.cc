@@ -17,6 +17,10 @@
 #include "sst/core/serialization/serializer.h"
 #include "sst/core/simulation_impl.h"
 
+#ifdef HAVE_LIBZ
+#include <zlib.h>
+#endif
+
 #if SST_EVENT_PROFILING
 #define SST_EVENT_PROFILE_SIZE(events, bytes)                    \
     do {                                                         \
@@ -32,9 +36,18 @@ namespace SST {
 using namespace Core::ThreadSafe;
 using namespace Core::Serialization;
 
-SyncQueue::SyncQueue() : ActivityQueue(), buffer(nullptr), buf_size(0) {}
+SyncQueue::SyncQueue(size_t compress_threshold) :
+    ActivityQueue(),
+    cbuffer(nullptr),
+    cbuf_size(0),
+    compress_threshold(compress_threshold),
+    next_delivery(MAX_SIMTIME_T)
+{}
 
-SyncQueue::~SyncQueue() {}
+SyncQueue::~SyncQueue()
+{
+    delete[] cbuffer;
+}
 
 bool
 SyncQueue::empty()
@@ -54,6 +67,26 @@ void
 SyncQueue::insert(Activity* activity)
 {
     std::lock_guard<Spinlock> lock(slock);
+
+    if ( activity->getDeliveryTime() < next_delivery ) next_delivery = activity->getDeliveryTime();
+
+    // Consecutive events for the same remote link, time and priority
+    // are sent as one batch, which on the other side is delivered the
+    // same way the events would have been
+    if ( !activities.empty() ) {
+        Event* last  = static_cast<Event*>(activities.back());
+        Event* event = static_cast<Event*>(activity);
+        if ( last->delivery_info == event->delivery_info && last->getDeliveryTime() == event->getDeliveryTime() &&
+             last->getPriority() == event->getPriority() ) {
+            EventBatch* batch = dynamic_cast<EventBatch*>(last);
+            if ( batch == nullptr ) {
+                batch             = new EventBatch(last);
+                activities.back() = batch;
+            }
+            batch->add(event);
+            return;
+        }
+    }
     activities.push_back(activity);
 }
 
@@ -81,14 +114,38 @@ SyncQueue::clear()
 {
     std::lock_guard<Spinlock> lock(slock);
     activities.clear();
+    next_delivery = MAX_SIMTIME_T;
 }
 
 char*
-SyncQueue::getData()
+SyncQueue::finishData(char* buf, size_t size, bool compact)
+{
+    SST_EVENT_PROFILE_SIZE(activities.size(), size)
+
+    // Delete all the events
+    for ( unsigned int i = 0; i < activities.size(); i++ ) {
+        delete activities[i];
+    }
+    activities.clear();
+
+    // Set the size field in the header
+    SyncQueue::Header* hdr = static_cast<SyncQueue::Header*>(static_cast<void*>(buf));
+    hdr->flags             = compact ? COMPACT_TYPES : 0;
+    hdr->buffer_size       = size + sizeof(SyncQueue::Header);
+    hdr->raw_size          = 0;
+
+    return buf;
+}
+
+char*
+SyncQueue::getData(const std::function<char*(size_t)>& alloc)
 {
     std::lock_guard<Spinlock> lock(slock);
 
+    // The size is needed up front to get the buffer
     serializer ser;
+    bool       compact = serializable_factory::have_dense_ids();
+    ser.set_compact_types(compact);
 
     ser.start_sizing();
 
@@ -96,29 +153,107 @@ SyncQueue::getData()
 
     size_t size = ser.size();
 
-    SST_EVENT_PROFILE_SIZE(activities.size(), size)
+    char* buf = alloc(size + sizeof(SyncQueue::Header));
 
-    if ( buf_size < (size + sizeof(SyncQueue::Header)) ) {
-        if ( buffer != nullptr ) { delete[] buffer; }
+    ser.start_packing(buf + sizeof(SyncQueue::Header), size);
 
-        buf_size = size + sizeof(SyncQueue::Header);
-        buffer   = new char[buf_size];
-    }
+    ser& activities;
+
+    return finishData(buf, size, compact);
+}
+
+char*
+SyncQueue::getData()
+{
+    std::lock_guard<Spinlock> lock(slock);
 
-    ser.start_packing(buffer + sizeof(SyncQueue::Header), size);
+    // The buffer grows while packing, so the events are only walked
+    // once.  It keeps its size between syncs.
+    serializer ser;
+    bool       compact = serializable_factory::have_dense_ids();
+    ser.set_compact_types(compact);
+
+    ser.start_packing(buffer, sizeof(SyncQueue::Header));
 
     ser& activities;
 
-    // Delete all the events
-    for ( unsigned int i = 0; i < activities.size(); i++ ) {
-        delete activities[i];
+    size_t size = ser.size();
+
+    finishData(buffer.data(), size, compact);
+
+#ifdef HAVE_LIBZ
+    // Small buffers are sent as is since they aren't worth the time
+    // to compress
+    if ( compress_threshold == 0 || size < compress_threshold ) return buffer.data();
+
+    uLongf csize = compressBound(size);
+    if ( cbuf_size < (csize + sizeof(SyncQueue::Header)) ) {
+        if ( cbuffer != nullptr ) { delete[] cbuffer; }
+
+        cbuf_size = csize + sizeof(SyncQueue::Header);
+        cbuffer   = new char[cbuf_size];
     }
-    activities.clear();
 
-    // Set the size field in the header
-    static_cast<SyncQueue::Header*>(static_cast<void*>(buffer))->buffer_size = size + sizeof(SyncQueue::Header);
+    int ret = compress2(
+        reinterpret_cast<Bytef*>(cbuffer + sizeof(SyncQueue::Header)), &csize,
+        reinterpret_cast<const Bytef*>(buffer.data() + sizeof(SyncQueue::Header)), size, Z_BEST_SPEED);
+
+    // Only use the compressed data if it actually got smaller
+    if ( ret != Z_OK || csize >= size ) return buffer.data();
+
+    SyncQueue::Header* chdr = static_cast<SyncQueue::Header*>(static_cast<void*>(cbuffer));
+    chdr->flags             = compact ? COMPACT_TYPES : 0;
+    chdr->buffer_size       = csize + sizeof(SyncQueue::Header);
+    chdr->raw_size          = size;
+
+    return cbuffer;
+#else
+    return buffer.data();
+#endif
+}
+
+char*
+SyncQueue::getActivityData(char* buffer, size_t& size)
+{
+    SyncQueue::Header* hdr = reinterpret_cast<SyncQueue::Header*>(buffer);
+    if ( hdr->raw_size == 0 ) {
+        size = hdr->buffer_size - sizeof(SyncQueue::Header);
+        return &buffer[sizeof(SyncQueue::Header)];
+    }
+
+#ifdef HAVE_LIBZ
+    // Multiple threads can be deserializing at once in the parallel
+    // rank sync, so each gets its own buffer
+    static thread_local std::vector<char> raw;
+    if ( raw.size() < hdr->raw_size ) raw.resize(hdr->raw_size);
+
+    uLongf raw_size = hdr->raw_size;
+    int    ret      = uncompress(
+        reinterpret_cast<Bytef*>(raw.data()), &raw_size,
+        reinterpret_cast<const Bytef*>(&buffer[sizeof(SyncQueue::Header)]),
+        hdr->buffer_size - sizeof(SyncQueue::Header));
+    if ( ret != Z_OK || raw_size != hdr->raw_size ) {
+        Simulation_impl::getSimulationOutput().fatal(
+            CALL_INFO, 1, "ERROR: Failed to decompress rank sync buffer (zlib error %d)\n", ret);
+    }
+    size = raw_size;
+    return raw.data();
+#else
+    Simulation_impl::getSimulationOutput().fatal(
+        CALL_INFO, 1, "ERROR: Received a compressed rank sync buffer, but SST was built without zlib\n");
+    return nullptr;
+#endif
+}
+
+void
+SyncQueue::startUnpacking(serializer& ser, char* buffer)
+{
+    SyncQueue::Header* hdr = reinterpret_cast<SyncQueue::Header*>(buffer);
+    ser.set_compact_types(hdr->flags & COMPACT_TYPES);
 
-    return buffer;
+    size_t size;
+    char*  data = getActivityData(buffer, size);
+    ser.start_unpacking(data, size);
 }
 
 } // namespace SST
@@ -13,8 +13,10 @@
 #define SST_CORE_SYNC_SYNCQUEUE_H
 
 #include "sst/core/activityQueue.h"
+#include "sst/core/serialization/serializer_fwd.h"
 #include "sst/core/threadsafe.h"
 
+#include <functional>
 #include <vector>
 
 namespace SST {
@@ -32,11 +34,21 @@ public:
     struct Header
     {
         uint32_t mode;
-        uint32_t count;
+        uint32_t flags; // COMPACT_TYPES
         uint32_t buffer_size;
+        uint32_t raw_size; // size of the serialized data before compression, 0 if not compressed
     };
 
-    SyncQueue();
+    /** Header flag: the data uses the short type ids of
+        serializable_factory::build_dense_ids() */
+    static const uint32_t COMPACT_TYPES = 1;
+
+    /** Create a new SyncQueue
+        \param compress_threshold Serialized data at least this many
+        bytes long will be compressed before sending (0 disables
+        compression)
+    */
+    SyncQueue(size_t compress_threshold = 0);
     ~SyncQueue();
 
     bool      empty() override;
@@ -50,13 +62,44 @@ public:
     void  clear();
     /** Accessor method to the internal queue */
     char* getData();
+    /** Serialize the queue into a buffer provided by the caller, for
+        instance one the remote rank can read directly.  The data is
+        never compressed.
+        \param alloc Called with the number of bytes needed, header
+        included, and returns the buffer to write to
+        \return The buffer returned by alloc
+    */
+    char* getData(const std::function<char*(size_t)>& alloc);
+
+    /** Get the serialized activities out of a buffer created by
+        getData(), decompressing them if needed.  The returned pointer
+        is only valid until the next call on the same thread.
+        \param buffer Buffer received from the remote rank
+        \param size Set to the size of the serialized data
+    */
+    static char* getActivityData(char* buffer, size_t& size);
+
+    /** Start unpacking the activities in a buffer created by
+        getData(), with the type ids it was written with */
+    static void startUnpacking(Core::Serialization::serializer& ser, char* buffer);
 
-    uint64_t getDataSize() { return buf_size + (activities.capacity() * sizeof(Activity*)); }
+    uint64_t getDataSize() { return buffer.size() + cbuf_size + (activities.capacity() * sizeof(Activity*)); }
+
+    /** Earliest delivery time of the activities inserted since the
+        last clear(), MAX_SIMTIME_T if there are none.  Still valid
+        after getData(). */
+    SimTime_t getNextDeliveryTime() const { return next_delivery; }
 
 private:
-    char*                  buffer;
-    size_t                 buf_size;
+    /** Delete the packed activities and fill in the header of buf */
+    char* finishData(char* buf, size_t size, bool compact);
+
+    std::vector<char>      buffer;
+    char*                  cbuffer; // compressed data
+    size_t                 cbuf_size;
+    size_t                 compress_threshold;
     std::vector<Activity*> activities;
+    SimTime_t              next_delivery;
 
     Core::ThreadSafe::Spinlock slock;
 };
@@ -57,6 +57,15 @@ ThreadSyncDirectSkip::~ThreadSyncDirectSkip()
 void
 ThreadSyncDirectSkip::after()
 {
+    // Lookahead only looks at the TimeVortices, which are stable
+    // because execute() waits for all threads to stop before calling
+    // after().  Events sent directly during the window can't arrive
+    // before the computed sync time.
+    if ( sim->interthread_lookahead ) {
+        nextSyncTime = sim->getLocalMinimumNextSyncTime();
+        return;
+    }
+
     // Use this nextSyncTime computation for no skip
     nextSyncTime = sim->getCurrentSimCycle() + my_max_period;
 
@@ -73,8 +82,19 @@ ThreadSyncDirectSkip::after()
 void
 ThreadSyncDirectSkip::execute()
 {
+    // All threads need to be stopped before looking at other
+    // threads' TimeVortices
+    if ( sim->interthread_lookahead ) {
+        SyncProfileToolList::phaseStart(Profile::SyncProfileTool::BARRIER);
+        totalWaitTime += barrier[0].wait();
+        SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::BARRIER);
+    }
+    SyncProfileToolList::phaseStart(Profile::SyncProfileTool::THREAD_SYNC);
     after();
+    SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::THREAD_SYNC);
+    SyncProfileToolList::phaseStart(Profile::SyncProfileTool::BARRIER);
     totalWaitTime += barrier[2].wait();
+    SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::BARRIER);
 }
 
 uint64_t
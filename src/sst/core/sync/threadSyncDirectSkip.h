@@ -49,6 +49,7 @@ public:
     void prepareForComplete() override {}
 
     SimTime_t getNextSyncTime() override { return nextSyncTime - 1; }
+    void      setNextSyncTime(SimTime_t time) override { nextSyncTime = time + 1; }
 
     /** Register a Link which this Sync Object is responsible for */
     void           registerLink(const std::string& UNUSED(name), Link* UNUSED(link)) override {}
@@ -104,13 +104,8 @@ ThreadSyncSimpleSkip::before()
     SimTime_t current_cycle = sim->getCurrentSimCycle();
     // Empty all the queues and send events on the links
     for ( size_t i = 0; i < queues.size(); i++ ) {
-        ThreadSyncQueue*        queue = queues[i];
-        std::vector<Activity*>& vec   = queue->getVector();
-        for ( size_t j = 0; j < vec.size(); j++ ) {
-            Event*    ev    = static_cast<Event*>(vec[j]);
-            SimTime_t delay = ev->getDeliveryTime() - current_cycle;
-            getDeliveryLink(ev)->send(delay, ev);
-        }
+        ThreadSyncQueue* queue = queues[i];
+        sendBatch(queue->getVector(), current_cycle);
         queue->clear();
     }
 }
@@ -123,6 +118,14 @@ ThreadSyncSimpleSkip::after()
 
     // Use this nextSyncTime computation for skipping
 
+    // With lookahead enabled, each thread only constrains the next
+    // sync by the latency of its own cross-thread links, so threads
+    // with low latency links that are idle don't force frequent syncs
+    if ( sim->interthread_lookahead ) {
+        nextSyncTime = sim->getLocalMinimumNextSyncTime();
+        return;
+    }
+
     auto nextmin     = sim->getLocalMinimumNextActivityTime();
     auto nextminPlus = nextmin + my_max_period;
     nextSyncTime     = nextmin > nextminPlus ? nextmin : nextminPlus;
@@ -131,11 +134,21 @@ ThreadSyncSimpleSkip::after()
 void
 ThreadSyncSimpleSkip::execute()
 {
+    SyncProfileToolList::phaseStart(Profile::SyncProfileTool::BARRIER);
     totalWaitTime = barrier[0].wait();
+    SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::BARRIER);
+    SyncProfileToolList::phaseStart(Profile::SyncProfileTool::THREAD_SYNC);
     before();
+    SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::THREAD_SYNC);
+    SyncProfileToolList::phaseStart(Profile::SyncProfileTool::BARRIER);
     totalWaitTime = barrier[1].wait();
+    SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::BARRIER);
+    SyncProfileToolList::phaseStart(Profile::SyncProfileTool::THREAD_SYNC);
     after();
+    SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::THREAD_SYNC);
+    SyncProfileToolList::phaseStart(Profile::SyncProfileTool::BARRIER);
     totalWaitTime += barrier[2].wait();
+    SyncProfileToolList::phaseEnd(Profile::SyncProfileTool::BARRIER);
 }
 
 void
@@ -0,0 +1,53 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/testElements/coreTest_ClockBatchComponent.h"
+
+namespace SST {
+namespace CoreTestClockBatchComponent {
+
+coreTestClockBatchComponent::coreTestClockBatchComponent(ComponentId_t id, Params& params) :
+    Component(id),
+    batch(nullptr),
+    index(0),
+    count(0)
+{
+    std::string clock = params.find<std::string>("clock", "1GHz");
+    step              = params.find<uint64_t>("step", 1);
+
+    if ( params.find<bool>("batched", true) ) {
+        batch              = registerClockBatch<CounterBatch>(clock, index);
+        batch->step[index] = step;
+    }
+    else {
+        registerClock(
+            clock, new Clock::Handler2<coreTestClockBatchComponent, &coreTestClockBatchComponent::tick>(this));
+    }
+}
+
+bool
+coreTestClockBatchComponent::tick(Cycle_t)
+{
+    count += step;
+    return false;
+}
+
+void
+coreTestClockBatchComponent::finish()
+{
+    if ( batch ) count = batch->count[index];
+    std::cout << getName() << " count = " << count << std::endl;
+}
+
+} // namespace CoreTestClockBatchComponent
+} // namespace SST
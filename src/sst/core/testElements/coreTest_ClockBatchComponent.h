@@ -0,0 +1,97 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_CORETEST_CLOCKBATCHCOMPONENT_H
+#define SST_CORE_CORETEST_CLOCKBATCHCOMPONENT_H
+
+#include "sst/core/clockBatch.h"
+#include "sst/core/component.h"
+
+#include <vector>
+
+namespace SST {
+namespace CoreTestClockBatchComponent {
+
+// Counters of all the batched components on a clock, one vector per field
+class CounterBatch : public SST::ClockBatch
+{
+public:
+    std::vector<uint64_t> count;
+    std::vector<uint64_t> step;
+
+protected:
+    void resize(size_t size) override
+    {
+        count.resize(size, 0);
+        step.resize(size, 0);
+    }
+
+    bool tick(SST::Cycle_t) override
+    {
+        uint64_t*       c = count.data();
+        const uint64_t* s = step.data();
+        for ( size_t i = 0; i < size(); ++i )
+            c[i] += s[i];
+        return false;
+    }
+};
+
+class coreTestClockBatchComponent : public SST::Component
+{
+public:
+    // REGISTER THIS COMPONENT INTO THE ELEMENT LIBRARY
+    SST_ELI_REGISTER_COMPONENT(
+        coreTestClockBatchComponent,
+        "coreTestElement",
+        "coreTestClockBatchComponent",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Counter that is either updated by a clock batch or by its own clock handler",
+        COMPONENT_CATEGORY_UNCATEGORIZED
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "clock",   "Clock frequency", "1GHz" },
+        { "step",    "Amount added to the counter every cycle", "1" },
+        { "batched", "Update the counter in a clock batch shared with the other batched components", "true" }
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_STATISTICS(
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_PORTS(
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
+    )
+
+    coreTestClockBatchComponent(SST::ComponentId_t id, SST::Params& params);
+    void setup() override {}
+    void finish() override;
+
+private:
+    coreTestClockBatchComponent(const coreTestClockBatchComponent&); // do not implement
+    void operator=(const coreTestClockBatchComponent&);              // do not implement
+
+    bool tick(SST::Cycle_t);
+
+    CounterBatch* batch; // nullptr if not batched
+    size_t        index;
+    uint64_t      count;
+    uint64_t      step;
+};
+
+} // namespace CoreTestClockBatchComponent
+} // namespace SST
+
+#endif // SST_CORE_CORETEST_CLOCKBATCHCOMPONENT_H
@@ -22,6 +22,8 @@ coreTestClockerComponent::coreTestClockerComponent(ComponentId_t id, Params& par
 {
     clock_frequency_str = params.find<std::string>("clock", "1GHz");
     clock_count         = params.find<int64_t>("clockcount", 1000);
+    skip_interval       = params.find<Cycle_t>("skipinterval", 0);
+    sleep_interval      = params.find<Cycle_t>("sleepinterval", 0);
 
     std::cout << "Clock is configured for: " << clock_frequency_str << std::endl;
 
@@ -46,6 +48,22 @@ coreTestClockerComponent::coreTestClockerComponent(ComponentId_t id, Params& par
         new Clock::Handler<coreTestClockerComponent, uint32_t>(this, &coreTestClockerComponent::Clock3Tick, 333);
     tc = registerClock("15 ns", Clock3Handler);
 
+    // Fourth Clock (7ns), which skips ahead
+    if ( skip_interval != 0 ) {
+        std::cout << "REGISTER CLOCK #4 at 7 ns" << std::endl;
+        registerClock(
+            "7 ns", new Clock::SkipHandler<coreTestClockerComponent, uint32_t>(
+                        this, &coreTestClockerComponent::Clock4Tick, 444));
+    }
+
+    // Fifth handler, on the main clock, which is suspended and resumed
+    if ( sleep_interval != 0 ) {
+        std::cout << "REGISTER CLOCK #5 at " << clock_frequency_str << std::endl;
+        Clock5Handle = registerSuspendableClock(
+            clock_frequency_str,
+            new Clock::Handler<coreTestClockerComponent>(this, &coreTestClockerComponent::Clock5Tick));
+    }
+
     // Create the OneShot Callback Handlers
     callback1Handler = new OneShot::Handler<coreTestClockerComponent, uint32_t>(
         this, &coreTestClockerComponent::Oneshot1Callback, 456);
@@ -58,10 +76,15 @@ coreTestClockerComponent::coreTestClockerComponent() : Component(-1)
     // for serialization only
 }
 
-bool coreTestClockerComponent::tick(Cycle_t)
+bool coreTestClockerComponent::tick(Cycle_t CycleNum)
 {
     clock_count--;
 
+    if ( sleep_interval != 0 && CycleNum % 5 == 0 ) {
+        Cycle_t next = resumeClock(Clock5Handle);
+        std::cout << "  RESUME CLOCK #5 at " << getCurrentSimTimeNano() << " ns, next cycle " << next << std::endl;
+    }
+
     // return false so we keep going
     if ( clock_count == 0 ) {
         primaryComponentOKToEndSim();
@@ -104,6 +127,30 @@ coreTestClockerComponent::Clock3Tick(SST::Cycle_t CycleNum, uint32_t Param)
     }
 }
 
+SST::Cycle_t
+coreTestClockerComponent::Clock4Tick(SST::Cycle_t CycleNum, uint32_t Param)
+{
+    // NOTE: THIS IS THE 7NS CLOCK
+    std::cout << "  CLOCK #4 - TICK Num " << CycleNum << " at " << getCurrentSimTimeNano() << " ns; Param = " << Param
+              << std::endl;
+
+    // return the next cycle to be called on or 0 to stop
+    if ( CycleNum >= 20 ) { return 0; }
+    else {
+        return CycleNum + skip_interval;
+    }
+}
+
+bool
+coreTestClockerComponent::Clock5Tick(SST::Cycle_t CycleNum)
+{
+    // NOTE: THIS IS ON THE MAIN CLOCK
+    std::cout << "  CLOCK #5 - TICK Num " << CycleNum << " at " << getCurrentSimTimeNano() << " ns" << std::endl;
+
+    // return true to suspend until the main clock handler resumes it
+    return CycleNum % sleep_interval == 0;
+}
+
 void
 coreTestClockerComponent::Oneshot1Callback(uint32_t Param)
 {
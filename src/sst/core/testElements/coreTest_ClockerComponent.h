@@ -32,7 +32,9 @@ public:
 
     SST_ELI_DOCUMENT_PARAMS(
         { "clock",      "Clock frequency", "1GHz" },
-        { "clockcount", "Number of clock ticks to execute", "100000"}
+        { "clockcount", "Number of clock ticks to execute", "100000"},
+        { "skipinterval", "If not 0, also register a 7 ns clock handler that is only called every skipinterval cycles", "0"},
+        { "sleepinterval", "If not 0, also register a suspendable handler on the main clock that suspends itself every sleepinterval cycles and is resumed every 5 cycles", "0"}
     )
 
     // Optional since there is nothing to document
@@ -60,12 +62,15 @@ private:
 
     virtual bool Clock2Tick(SST::Cycle_t, uint32_t);
     virtual bool Clock3Tick(SST::Cycle_t, uint32_t);
+    virtual SST::Cycle_t Clock4Tick(SST::Cycle_t, uint32_t);
+    virtual bool         Clock5Tick(SST::Cycle_t);
 
     virtual void Oneshot1Callback(uint32_t);
     virtual void Oneshot2Callback();
 
-    TimeConverter*      tc;
-    Clock::HandlerBase* Clock3Handler;
+    TimeConverter*       tc;
+    Clock::HandlerBase*  Clock3Handler;
+    Clock::SuspendHandle Clock5Handle;
 
     // Variables to store OneShot Callback Handlers
     OneShot::HandlerBase* callback1Handler;
@@ -73,6 +78,8 @@ private:
 
     std::string clock_frequency_str;
     int         clock_count;
+    Cycle_t     skip_interval;
+    Cycle_t     sleep_interval;
 };
 
 } // namespace CoreTestClockerComponent
@@ -108,6 +108,12 @@ public:
     void setup() {}
     void finish() { printf("Component Finished.\n"); }
 
+    void serialize_order(SST::Core::Serialization::serializer& ser) override
+    {
+        ser& neighbor;
+        ser& *rng;
+    }
+
 private:
     coreTestComponent();                         // for serialization only
     coreTestComponent(const coreTestComponent&); // do not implement
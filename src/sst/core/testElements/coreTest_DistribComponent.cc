@@ -95,7 +95,18 @@ coreTestDistribComponent::coreTestDistribComponent(ComponentId_t id, Params& par
             probs[prob_count - 1] = 1.0;
         }
 
-        comp_distrib = new SSTDiscreteDistribution(probs, prob_count, new MersenneRNG(10111));
+        std::string method = params.find<std::string>("method", "search");
+        if ( "alias" == method ) {
+            comp_distrib = new SSTDiscreteDistribution(
+                probs, prob_count, new MersenneRNG(10111), SSTDiscreteDistribution::ALIAS_TABLE);
+        }
+        else if ( "search" == method ) {
+            comp_distrib = new SSTDiscreteDistribution(probs, prob_count, new MersenneRNG(10111));
+        }
+        else {
+            std::cerr << "Unknown discrete sampling method." << std::endl;
+            exit(-1);
+        }
     }
     else {
         std::cerr << "Unknown distribution type." << std::endl;
@@ -42,7 +42,8 @@ public:
         { "lambda",            "Lambda value to use for the exponential distribution", "1.0"},
         { "binresults",        "Print the results, only if value is \"1\"", "1"},
         { "probcount",         "Number of probabilities in discrete distribution", "1"},
-        { "prob%(probcount)d", "Probability values for discrete distribution", "1"}
+        { "prob%(probcount)d", "Probability values for discrete distribution", "1"},
+        { "method",            "Sampling method for the discrete distribution - \"search\" or \"alias\"", "search"}
     )
 
     // Optional since there is nothing to document
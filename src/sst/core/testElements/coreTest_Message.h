@@ -19,9 +19,17 @@ class coreTestMessage : public SST::Event
 {
 public:
     coreTestMessage() : SST::Event() {}
+    coreTestMessage(int seq) : SST::Event(), seq(seq) {}
+
+    /** Position of the message in the order it was sent, or -1 */
+    int seq = -1;
 
 public:
-    void serialize_order(SST::Core::Serialization::serializer& ser) override { Event::serialize_order(ser); }
+    void serialize_order(SST::Core::Serialization::serializer& ser) override
+    {
+        Event::serialize_order(ser);
+        ser& seq;
+    }
 
     ImplementSerializable(SST::CoreTestMessageGeneratorComponent::coreTestMessage);
 };
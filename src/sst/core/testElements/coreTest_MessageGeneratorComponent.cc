@@ -25,6 +25,10 @@ coreTestMessageGeneratorComponent::coreTestMessageGeneratorComponent(ComponentId
 
     total_message_send_count = params.find<int64_t>("sendcount", 1000);
     output_message_info      = params.find<int64_t>("outputinfo", 1);
+    batch_size               = params.find<int64_t>("batchsize", 1);
+    burst_size               = params.find<int64_t>("burstsize", 1);
+    check_order              = params.find<bool>("checkorder", false);
+    polling                  = params.find<bool>("polling", false);
 
     message_counter_recv = 0;
     message_counter_sent = 0;
@@ -33,9 +37,12 @@ coreTestMessageGeneratorComponent::coreTestMessageGeneratorComponent(ComponentId
     registerAsPrimaryComponent();
     primaryComponentDoNotEndSim();
 
-    remote_component = configureLink(
-        "remoteComponent",
-        new Event::Handler<coreTestMessageGeneratorComponent>(this, &coreTestMessageGeneratorComponent::handleEvent));
+    if ( polling ) { remote_component = configureLink("remoteComponent"); }
+    else {
+        remote_component = configureLink(
+            "remoteComponent", new Event::Handler<coreTestMessageGeneratorComponent>(
+                                   this, &coreTestMessageGeneratorComponent::handleEvent));
+    }
 
     assert(remote_component);
 
@@ -53,6 +60,13 @@ coreTestMessageGeneratorComponent::coreTestMessageGeneratorComponent() : Compone
 void
 coreTestMessageGeneratorComponent::handleEvent(Event* event)
 {
+    coreTestMessage* msg = static_cast<coreTestMessage*>(event);
+    if ( check_order && msg->seq != message_counter_recv ) {
+        getSimulationOutput().fatal(
+            CALL_INFO, 1, "%s received message %d when message %d was expected\n", getName().c_str(), msg->seq,
+            message_counter_recv);
+    }
+
     message_counter_recv++;
 
     if ( output_message_info ) {
@@ -70,18 +84,49 @@ coreTestMessageGeneratorComponent::handleEvent(Event* event)
 // one of our neighbors.
 bool coreTestMessageGeneratorComponent::tick(Cycle_t)
 {
-    coreTestMessage* msg = new coreTestMessage();
-    remote_component->send(msg);
+    if ( polling ) {
+        // Drain everything that has arrived, then keep the clock
+        // running until all messages are both sent and received
+        while ( Event* ev = remote_component->recv() ) {
+            handleEvent(ev);
+        }
+        if ( message_counter_sent == total_message_send_count ) {
+            return message_counter_recv == total_message_send_count;
+        }
+    }
 
-    if ( output_message_info ) {
-        std::cout << "Sent message: " << message_counter_sent << " (time=" << getCurrentSimTimeMicro() << "us)"
-                  << std::endl;
+    if ( batch_size > 1 ) {
+        std::vector<Event*> msgs;
+        for ( int i = 0; i < batch_size && message_counter_sent < total_message_send_count; ++i ) {
+            msgs.push_back(new coreTestMessage(message_counter_sent));
+
+            if ( output_message_info ) {
+                std::cout << "Sent message: " << message_counter_sent << " (time=" << getCurrentSimTimeMicro()
+                          << "us)" << std::endl;
+            }
+
+            message_counter_sent++;
+        }
+        remote_component->sendBatch(msgs);
+
+        return !polling && message_counter_sent == total_message_send_count;
     }
 
-    message_counter_sent++;
+    // Messages in a burst all have the same delivery time
+    for ( int i = 0; i < burst_size && message_counter_sent < total_message_send_count; ++i ) {
+        coreTestMessage* msg = new coreTestMessage(message_counter_sent);
+        remote_component->send(msg);
+
+        if ( output_message_info ) {
+            std::cout << "Sent message: " << message_counter_sent << " (time=" << getCurrentSimTimeMicro() << "us)"
+                      << std::endl;
+        }
+
+        message_counter_sent++;
+    }
 
     // return false so we keep going
-    if ( message_counter_sent == total_message_send_count ) { return true; }
+    if ( message_counter_sent == total_message_send_count ) { return !polling; }
     else {
         return false;
     }
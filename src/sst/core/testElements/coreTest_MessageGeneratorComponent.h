@@ -35,7 +35,11 @@ public:
         { "printStats", "Prints the statistics from the component", "0"},
         { "clock", "Sets the clock for the message generator", "1GHz" },
         { "sendcount", "Sets the number of sends in the simulation.", "1000" },
-        { "outputinfo", "Sets the level of output information", "1" }
+        { "outputinfo", "Sets the level of output information", "1" },
+        { "batchsize", "Number of messages sent together with sendBatch() each clock tick.  1 uses send()", "1" },
+        { "burstsize", "Number of messages sent with separate calls to send() each clock tick, when batchsize is 1", "1" },
+        { "checkorder", "Fail if messages aren't received in the order they were sent", "0" },
+        { "polling", "Receive messages by polling the link with recv() each clock tick instead of with a handler", "0" }
     )
 
     // Optional since there is nothing to document
@@ -70,6 +74,10 @@ private:
     int         message_counter_recv;
     int         total_message_send_count;
     int         output_message_info;
+    int         batch_size;
+    int         burst_size;
+    bool        check_order;
+    bool        polling;
 
     SST::Link* remote_component;
 };
@@ -116,7 +116,20 @@ coreTestParamComponent::coreTestParamComponent(ComponentId_t id, Params& params)
         else
             out.output(", %s: %d", i.first.c_str(), i.second);
     }
-    out.output(" }\n\n");
+    out.output(" }\n");
+
+    // The params passed in were frozen when the component was built.
+    // Check that a frozen copy gives the same answers and that writes
+    // to it, including ones that hide a global param, show up in later
+    // reads
+    Params frozen = params;
+    frozen.freeze();
+    const int32_t     frozen_i32v = frozen.find<int32_t>("int32t_param");
+    const std::string frozen_strv = frozen.find<std::string>("string_param");
+    frozen.insert("int32t_param", "12345");
+    frozen.insert("string_param", "written");
+    out.output("    frozen       int32_t = %" PRId32 " -> %" PRId32 ", string = \"%s\" -> \"%s\"\n\n", frozen_i32v,
+        frozen.find<int32_t>("int32t_param"), frozen_strv.c_str(), frozen.find<std::string>("string_param").c_str());
 }
 
 
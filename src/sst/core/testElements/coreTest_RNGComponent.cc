@@ -15,14 +15,78 @@
 
 #include "sst/core/rng/marsaglia.h"
 #include "sst/core/rng/mersenne.h"
+#include "sst/core/rng/philox.h"
 #include "sst/core/rng/xorshift.h"
 
 #include <assert.h>
+#include <vector>
 
 using namespace SST;
 using namespace SST::RNG;
 using namespace SST::CoreTestRNGComponent;
 
+// Check that the fill functions produce the same numbers as the
+// single number calls.  Both generators must have been created with the
+// same seeds; they are deleted when the check is done.  The test only
+// compares the last few numbers printed, so a mismatch is fatal.
+static void
+checkFill(Random* single, Random* bulk, Output* output)
+{
+    const size_t n = 1000;
+
+    std::vector<double> uniform(n);
+    bulk->fillUniform(uniform.data(), n);
+    for ( size_t i = 0; i < n; ++i ) {
+        if ( uniform[i] != single->nextUniform() ) {
+            output->fatal(CALL_INFO, -1, "ERROR: fillUniform() does not match nextUniform()\n");
+        }
+    }
+
+    std::vector<uint32_t> u32(n);
+    bulk->fillUInt32(u32.data(), n);
+    for ( size_t i = 0; i < n; ++i ) {
+        if ( u32[i] != single->generateNextUInt32() ) {
+            output->fatal(CALL_INFO, -1, "ERROR: fillUInt32() does not match generateNextUInt32()\n");
+        }
+    }
+
+    std::vector<uint64_t> u64(n);
+    bulk->fillUInt64(u64.data(), n);
+    for ( size_t i = 0; i < n; ++i ) {
+        if ( u64[i] != single->generateNextUInt64() ) {
+            output->fatal(CALL_INFO, -1, "ERROR: fillUInt64() does not match generateNextUInt64()\n");
+        }
+    }
+
+    delete single;
+    delete bulk;
+}
+
+// Check Philox against the Random123 known answers and check that
+// jumping ahead and switching streams match drawing the numbers in order
+static void
+checkPhilox(Output* output)
+{
+    const uint32_t kat[4] = { 0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8 };
+    PhiloxRNG      zero(0, 0);
+    for ( int i = 0; i < 4; ++i ) {
+        if ( zero.generateNextUInt32() != kat[i] )
+            output->fatal(CALL_INFO, -1, "ERROR: Philox does not match the known answer for a zero key and counter\n");
+    }
+
+    PhiloxRNG sequential(1447, 3);
+    PhiloxRNG jumped(1447, 0);
+    jumped.setStream(3);
+    for ( int i = 0; i < 1001; ++i )
+        sequential.generateNextUInt32();
+    jumped.jump(1001);
+    for ( int i = 0; i < 100; ++i ) {
+        if ( sequential.generateNextUInt64() != jumped.generateNextUInt64() )
+            output->fatal(CALL_INFO, -1, "ERROR: Philox jump() does not match sequential generation\n");
+    }
+    if ( jumped.getPosition() != 1201 ) output->fatal(CALL_INFO, -1, "ERROR: Philox position is not correct\n");
+}
+
 coreTestRNGComponent::coreTestRNGComponent(ComponentId_t id, Params& params) : Component(id)
 {
     rng_count     = 0;
@@ -38,6 +102,7 @@ coreTestRNGComponent::coreTestRNGComponent(ComponentId_t id, Params& params) : C
 
         output->verbose(CALL_INFO, 1, 0, "Using Mersenne Generator with seed: %" PRIu32 "\n", seed);
         rng = new MersenneRNG(seed);
+        checkFill(new MersenneRNG(seed), new MersenneRNG(seed), output);
     }
     else if ( rngType == "marsaglia" ) {
         const uint32_t m_w = (uint32_t)params.find<int64_t>("seed_w", 0);
@@ -51,12 +116,23 @@ coreTestRNGComponent::coreTestRNGComponent(ComponentId_t id, Params& params) : C
             output->verbose(
                 CALL_INFO, 1, 0, "Using Marsaglia Generator with seeds: Z=%" PRIu32 ", W=%" PRIu32 "\n", m_w, m_z);
             rng = new MarsagliaRNG(m_z, m_w);
+            checkFill(new MarsagliaRNG(m_z, m_w), new MarsagliaRNG(m_z, m_w), output);
         }
     }
     else if ( rngType == "xorshift" ) {
         uint32_t seed = (uint32_t)params.find<int64_t>("seed", 57);
         output->verbose(CALL_INFO, 1, 0, "Using XORShift Generator with seed: %" PRIu32 "\n", seed);
         rng = new XORShiftRNG(seed);
+        checkFill(new XORShiftRNG(seed), new XORShiftRNG(seed), output);
+    }
+    else if ( rngType == "philox" ) {
+        const uint64_t seed   = (uint64_t)params.find<int64_t>("seed", 1447);
+        const uint64_t stream = (uint64_t)params.find<int64_t>("stream", 0);
+        output->verbose(
+            CALL_INFO, 1, 0, "Using Philox Generator with seed: %" PRIu64 ", stream: %" PRIu64 "\n", seed, stream);
+        rng = new PhiloxRNG(seed, stream);
+        checkFill(new PhiloxRNG(seed, stream), new PhiloxRNG(seed, stream), output);
+        checkPhilox(output);
     }
     else {
         output->verbose(
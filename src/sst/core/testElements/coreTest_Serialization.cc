@@ -161,6 +161,24 @@ coreTestSerialization::coreTestSerialization(ComponentId_t id, UNUSED(Params& pa
     passed = checkContainerSerializeDeserialize(vector_in);
     if ( !passed ) out.output("ERROR: vector<int32_t> did not serialize/deserialize properly\n");
 
+    // Vectors of fundamental types are copied as a single block, so
+    // check a large payload, a non-integer type and an empty vector
+    std::vector<uint8_t> vector_u8_in;
+    for ( int i = 0; i < 100000; ++i )
+        vector_u8_in.push_back(rng->generateNextUInt32());
+    passed = checkContainerSerializeDeserialize(vector_u8_in);
+    if ( !passed ) out.output("ERROR: vector<uint8_t> did not serialize/deserialize properly\n");
+
+    std::vector<double> vector_double_in;
+    for ( int i = 0; i < 10; ++i )
+        vector_double_in.push_back(rng->nextUniform() * 1000000);
+    passed = checkContainerSerializeDeserialize(vector_double_in);
+    if ( !passed ) out.output("ERROR: vector<double> did not serialize/deserialize properly\n");
+
+    std::vector<int32_t> vector_empty_in;
+    passed = checkContainerSerializeDeserialize(vector_empty_in);
+    if ( !passed ) out.output("ERROR: empty vector<int32_t> did not serialize/deserialize properly\n");
+
     std::list<int32_t> list_in;
     for ( int i = 0; i < 10; ++i )
         list_in.push_back(rng->generateNextInt32());
@@ -188,6 +206,66 @@ coreTestSerialization::coreTestSerialization(ComponentId_t id, UNUSED(Params& pa
     if ( !passed ) out.output("ERROR: unordered_set<int32_t,int32_t> did not serialize/deserialize properly\n");
 
 
+    // Blocks of trivially copyable members
+    {
+        struct BlockTest
+        {
+            int32_t  a;
+            uint64_t b;
+            double   c;
+            uint8_t  d;
+        };
+        BlockTest block_in  = { rng->generateNextInt32(), rng->generateNextUInt64(), rng->nextUniform(), 0x5a };
+        BlockTest block_out = { 0, 0, 0.0, 0 };
+
+        SST::Core::Serialization::serializer ser;
+        ser.start_sizing();
+        ser& SST::Core::Serialization::block(block_in.b, block_in.d);
+        ser& SST::Core::Serialization::block(block_in);
+        size_t size = ser.size();
+
+        std::vector<char> buffer(size);
+        ser.start_packing(buffer.data(), size);
+        ser& SST::Core::Serialization::block(block_in.b, block_in.d);
+        ser& SST::Core::Serialization::block(block_in);
+
+        BlockTest partial_out = { 0, 0, 0.0, 0 };
+        ser.start_unpacking(buffer.data(), size);
+        ser& SST::Core::Serialization::block(partial_out.b, partial_out.d);
+        ser& SST::Core::Serialization::block(block_out);
+
+        passed = partial_out.a == 0 && partial_out.b == block_in.b && partial_out.c == block_in.c &&
+                 partial_out.d == block_in.d && block_out.a == block_in.a && block_out.b == block_in.b &&
+                 block_out.c == block_in.c && block_out.d == block_in.d;
+        if ( !passed )
+            out.output("ERROR: block of trivially copyable members did not serialize/deserialize properly\n");
+    }
+
+    // Packing into a buffer that grows, after a reserved header
+    {
+        std::vector<int32_t> vec_in;
+        for ( int i = 0; i < 1000; ++i )
+            vec_in.push_back(rng->generateNextInt32());
+        std::string str_in = "growable buffer";
+
+        SST::Core::Serialization::serializer ser;
+        std::vector<char>                    buffer(8, 'h');
+        ser.start_packing(buffer, 4);
+        ser& vec_in;
+        ser& str_in;
+        size_t size = ser.size();
+
+        std::vector<int32_t> vec_out;
+        std::string          str_out;
+        ser.start_unpacking(buffer.data() + 4, size);
+        ser& vec_out;
+        ser& str_out;
+
+        passed = vec_out == vec_in && str_out == str_in && buffer.size() >= size + 4 &&
+                 std::string(buffer.data(), 4) == "hhhh";
+        if ( !passed ) out.output("ERROR: packing into a growable buffer did not serialize/deserialize properly\n");
+    }
+
     // Containers to other containers
 
     {
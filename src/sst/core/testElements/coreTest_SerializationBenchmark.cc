@@ -0,0 +1,352 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/testElements/coreTest_SerializationBenchmark.h"
+
+#include "sst/core/event.h"
+#include "sst/core/interfaces/simpleNetwork.h"
+#include "sst/core/serialization/serializer.h"
+
+#include <chrono>
+#include <cinttypes>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace SST {
+namespace CoreTestSerializationBenchmark {
+
+using SST::Interfaces::SimpleNetwork;
+
+// Event with only a few scalar fields
+class SmallEvent : public SST::Event
+{
+public:
+    SmallEvent() : SST::Event() {}
+    SmallEvent(uint64_t id, int32_t value) : SST::Event(), id(id), value(value) {}
+
+    bool operator==(const SmallEvent& other) const { return id == other.id && value == other.value; }
+
+    void serialize_order(SST::Core::Serialization::serializer& ser) override
+    {
+        Event::serialize_order(ser);
+        ser& id;
+        ser& value;
+    }
+
+    uint64_t id    = 0;
+    int32_t  value = 0;
+
+    ImplementSerializable(SST::CoreTestSerializationBenchmark::SmallEvent);
+};
+
+// Event carrying a name and a block of data
+class DataEvent : public SST::Event
+{
+public:
+    DataEvent() : SST::Event() {}
+    DataEvent(uint64_t id, const std::string& tag, std::vector<uint8_t> data) :
+        SST::Event(),
+        id(id),
+        tag(tag),
+        data(std::move(data))
+    {}
+
+    bool operator==(const DataEvent& other) const
+    {
+        return id == other.id && tag == other.tag && data == other.data;
+    }
+
+    void serialize_order(SST::Core::Serialization::serializer& ser) override
+    {
+        Event::serialize_order(ser);
+        ser& id;
+        ser& tag;
+        ser& data;
+    }
+
+    uint64_t             id = 0;
+    std::string          tag;
+    std::vector<uint8_t> data;
+
+    ImplementSerializable(SST::CoreTestSerializationBenchmark::DataEvent);
+};
+
+// StandardMem requests aren't serializable, memory models send their
+// fields in their own events.  This has the fields of a Read or Write.
+class MemEvent : public SST::Event
+{
+public:
+    MemEvent() : SST::Event() {}
+
+    bool operator==(const MemEvent& other) const
+    {
+        return id == other.id && pAddr == other.pAddr && vAddr == other.vAddr && iPtr == other.iPtr &&
+               tid == other.tid && size == other.size && flags == other.flags && write == other.write &&
+               posted == other.posted && data == other.data;
+    }
+
+    void serialize_order(SST::Core::Serialization::serializer& ser) override
+    {
+        Event::serialize_order(ser);
+        ser& id;
+        ser& pAddr;
+        ser& vAddr;
+        ser& iPtr;
+        ser& tid;
+        ser& size;
+        ser& flags;
+        ser& write;
+        ser& posted;
+        ser& data;
+    }
+
+    uint64_t             id     = 0;
+    uint64_t             pAddr  = 0;
+    uint64_t             vAddr  = 0;
+    uint64_t             iPtr   = 0;
+    uint32_t             tid    = 0;
+    uint64_t             size   = 0;
+    uint32_t             flags  = 0;
+    bool                 write  = false;
+    bool                 posted = false;
+    std::vector<uint8_t> data;
+
+    ImplementSerializable(SST::CoreTestSerializationBenchmark::MemEvent);
+};
+
+namespace {
+
+template <typename T>
+bool
+equalAs(Event* a, Event* b)
+{
+    T* x = dynamic_cast<T*>(a);
+    T* y = dynamic_cast<T*>(b);
+    return x != nullptr && y != nullptr && *x == *y;
+}
+
+bool
+equalEvents(Event* a, Event* b)
+{
+    if ( a == nullptr || b == nullptr ) return a == b;
+    return equalAs<SmallEvent>(a, b) || equalAs<DataEvent>(a, b) || equalAs<MemEvent>(a, b);
+}
+
+template <typename T>
+bool
+equalEventVectors(const std::vector<T*>& a, const std::vector<T*>& b)
+{
+    if ( a.size() != b.size() ) return false;
+    for ( size_t i = 0; i < a.size(); ++i ) {
+        if ( !equalEvents(a[i], b[i]) ) return false;
+    }
+    return true;
+}
+
+bool
+equalRequests(const std::vector<SimpleNetwork::Request*>& a, const std::vector<SimpleNetwork::Request*>& b)
+{
+    if ( a.size() != b.size() ) return false;
+    for ( size_t i = 0; i < a.size(); ++i ) {
+        SimpleNetwork::Request* x = a[i];
+        SimpleNetwork::Request* y = b[i];
+        if ( x->dest != y->dest || x->src != y->src || x->vn != y->vn || x->size_in_bits != y->size_in_bits ||
+             x->head != y->head || x->tail != y->tail || x->allow_adaptive != y->allow_adaptive )
+            return false;
+        if ( !equalEvents(x->inspectPayload(), y->inspectPayload()) ) return false;
+        auto& xs = x->inspectSharedPayload();
+        auto& ys = y->inspectSharedPayload();
+        if ( (xs == nullptr) != (ys == nullptr) ) return false;
+        if ( xs != nullptr && *xs != *ys ) return false;
+    }
+    return true;
+}
+
+template <typename T>
+void
+deleteAll(std::vector<T*>& objects)
+{
+    for ( auto* x : objects )
+        delete x;
+    objects.clear();
+}
+
+double
+elapsedSeconds(std::chrono::steady_clock::time_point start)
+{
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+} // namespace
+
+coreTestSerializationBenchmark::coreTestSerializationBenchmark(ComponentId_t id, Params& params) :
+    Component(id),
+    rng(nullptr)
+{
+    params.find_array<std::string>("workloads", workloads);
+    if ( workloads.empty() ) workloads = { "events", "network_request", "std_mem", "containers" };
+
+    batch         = params.find<uint64_t>("batch", 64);
+    iterations    = params.find<uint64_t>("iterations", 10000);
+    payload_bytes = params.find<uint32_t>("payload_bytes", 64);
+    seed          = params.find<uint32_t>("seed", 1447);
+    report_timing = params.find<bool>("report_timing", true);
+
+    if ( iterations == 0 ) iterations = 1;
+    if ( payload_bytes == 0 ) payload_bytes = 1;
+}
+
+coreTestSerializationBenchmark::~coreTestSerializationBenchmark()
+{
+    delete rng;
+}
+
+std::vector<uint8_t>
+coreTestSerializationBenchmark::makePayload()
+{
+    std::vector<uint8_t> data(1 + rng->generateNextUInt32() % (2 * payload_bytes));
+    for ( auto& x : data )
+        x = rng->generateNextUInt32();
+    return data;
+}
+
+template <typename T, typename Equal, typename Release>
+void
+coreTestSerializationBenchmark::runBenchmark(const std::string& name, T& data, Equal equal, Release release)
+{
+    Output&                              out = getSimulationOutput();
+    SST::Core::Serialization::serializer ser;
+
+    size_t size  = 0;
+    auto   start = std::chrono::steady_clock::now();
+    for ( uint64_t i = 0; i < iterations; ++i ) {
+        ser.start_sizing();
+        ser& data;
+        size = ser.size();
+    }
+    double size_sec = elapsedSeconds(start);
+
+    std::vector<char> buffer(size);
+    start = std::chrono::steady_clock::now();
+    for ( uint64_t i = 0; i < iterations; ++i ) {
+        ser.start_packing(buffer.data(), size);
+        ser& data;
+    }
+    double pack_sec = elapsedSeconds(start);
+
+    // Only the unpacking is timed, not deleting what was unpacked
+    bool   match      = true;
+    double unpack_sec = 0.0;
+    for ( uint64_t i = 0; i < iterations; ++i ) {
+        T copy;
+        start = std::chrono::steady_clock::now();
+        ser.start_unpacking(buffer.data(), size);
+        ser& copy;
+        unpack_sec += elapsedSeconds(start);
+        if ( i == 0 ) match = equal(data, copy);
+        release(copy);
+    }
+
+    if ( !match ) out.fatal(CALL_INFO, 1, "ERROR: %s did not unpack to the objects that were packed\n", name.c_str());
+
+    out.output("Serialization %s: %" PRIu64 " objects, unpacked objects match\n", name.c_str(), batch);
+    if ( report_timing ) {
+        double bytes = static_cast<double>(size) * iterations;
+        out.output(
+            "  %zu bytes per batch, sizer %.3f GB/s, packer %.3f GB/s, unpacker %.3f GB/s, %.1f ns/object packed\n",
+            size, bytes / size_sec / 1.0e9, bytes / pack_sec / 1.0e9, bytes / unpack_sec / 1.0e9,
+            pack_sec * 1.0e9 / (iterations * batch));
+    }
+}
+
+void
+coreTestSerializationBenchmark::setup()
+{
+    for ( auto& name : workloads ) {
+        // Every workload sees the same sequence of values
+        delete rng;
+        rng = new SST::RNG::MersenneRNG(seed);
+
+        if ( name == "events" ) {
+            std::vector<Event*> events;
+            for ( uint64_t i = 0; i < batch; ++i ) {
+                if ( i % 2 == 0 )
+                    events.push_back(new SmallEvent(i, rng->generateNextInt32()));
+                else
+                    events.push_back(new DataEvent(i, "event" + std::to_string(i), makePayload()));
+            }
+            runBenchmark(name, events, equalEventVectors<Event>, deleteAll<Event>);
+            deleteAll(events);
+        }
+        else if ( name == "network_request" ) {
+            std::vector<SimpleNetwork::Request*> requests;
+            for ( uint64_t i = 0; i < batch; ++i ) {
+                auto* req = new SimpleNetwork::Request(
+                    rng->generateNextUInt32() % 1024, i, payload_bytes * 8, true, true,
+                    new DataEvent(i, "payload", makePayload()));
+                req->vn = i % 4;
+                // Every fourth request also has shared bytes
+                if ( i % 4 == 0 ) req->giveSharedPayload(std::make_shared<const std::vector<uint8_t>>(makePayload()));
+                requests.push_back(req);
+            }
+            runBenchmark(name, requests, equalRequests, deleteAll<SimpleNetwork::Request>);
+            deleteAll(requests);
+        }
+        else if ( name == "std_mem" ) {
+            std::vector<Event*> events;
+            for ( uint64_t i = 0; i < batch; ++i ) {
+                auto* ev  = new MemEvent();
+                ev->id    = i;
+                ev->pAddr = rng->generateNextUInt64() & ~uint64_t(63);
+                ev->vAddr = ev->pAddr ^ 0x7f0000000000ULL;
+                ev->iPtr  = rng->generateNextUInt64();
+                ev->tid   = i % 8;
+                ev->size  = 64;
+                ev->flags = rng->generateNextUInt32() & 0xff;
+                // Half are writes carrying a cache line
+                ev->write = (i % 2 == 1);
+                if ( ev->write ) {
+                    ev->data.resize(ev->size);
+                    for ( auto& x : ev->data )
+                        x = rng->generateNextUInt32();
+                }
+                events.push_back(ev);
+            }
+            runBenchmark(name, events, equalEventVectors<Event>, deleteAll<Event>);
+            deleteAll(events);
+        }
+        else if ( name == "containers" ) {
+            typedef std::vector<std::map<std::string, std::vector<uint64_t>>> Nested;
+            Nested nested(batch);
+            for ( auto& map : nested ) {
+                for ( int key = 0; key < 8; ++key ) {
+                    auto& values = map["key" + std::to_string(rng->generateNextUInt32() % 100)];
+                    values.resize(1 + rng->generateNextUInt32() % (payload_bytes / 4 + 1));
+                    for ( auto& x : values )
+                        x = rng->generateNextUInt64();
+                }
+            }
+            runBenchmark(
+                name, nested, [](const Nested& a, const Nested& b) { return a == b; }, [](Nested&) {});
+        }
+        else {
+            getSimulationOutput().fatal(CALL_INFO, 1, "ERROR: Unknown workload: %s\n", name.c_str());
+        }
+    }
+}
+
+} // namespace CoreTestSerializationBenchmark
+} // namespace SST
@@ -0,0 +1,103 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_CORETEST_SERIALIZATIONBENCHMARK_H
+#define SST_CORE_CORETEST_SERIALIZATIONBENCHMARK_H
+
+#include "sst/core/component.h"
+#include "sst/core/rng/mersenne.h"
+
+#include <string>
+#include <vector>
+
+namespace SST {
+namespace CoreTestSerializationBenchmark {
+
+/**
+ * Measures the throughput of the serializer on batches of objects like
+ * the ones sent between ranks.  Each workload is sized, packed and
+ * unpacked a number of times, and the unpacked objects are checked
+ * against the originals.  The workloads are:
+ *
+ *   events:          a mix of small and payload carrying events, sent
+ *                    through Event pointers
+ *   network_request: SimpleNetwork::Requests carrying an event
+ *   std_mem:         events with the fields of StandardMem reads and
+ *                    writes
+ *   containers:      nested maps and vectors
+ */
+class coreTestSerializationBenchmark : public SST::Component
+{
+public:
+    // REGISTER THIS COMPONENT INTO THE ELEMENT LIBRARY
+    SST_ELI_REGISTER_COMPONENT(
+        coreTestSerializationBenchmark,
+        "coreTestElement",
+        "coreTestSerializationBenchmark",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Microbenchmark for the serializer",
+        COMPONENT_CATEGORY_UNCATEGORIZED
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "workloads", "List of workloads to run, from events, network_request, std_mem and containers.  Empty means all", "[]" },
+        { "batch", "Number of objects serialized together", "64" },
+        { "iterations", "Number of times each batch is sized, packed and unpacked", "10000" },
+        { "payload_bytes", "Mean size of the data carried by events and requests", "64" },
+        { "seed", "Seed for the random number generator", "1447" },
+        { "report_timing", "Set to false to suppress the timing numbers (used for regression testing)", "true" }
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_STATISTICS(
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_PORTS(
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
+    )
+
+    coreTestSerializationBenchmark(SST::ComponentId_t id, SST::Params& params);
+    ~coreTestSerializationBenchmark();
+
+    void setup() override;
+    void finish() override {}
+
+private:
+    coreTestSerializationBenchmark();                                      // for serialization only
+    coreTestSerializationBenchmark(const coreTestSerializationBenchmark&); // do not implement
+    void operator=(const coreTestSerializationBenchmark&);                 // do not implement
+
+    /** Time sizing, packing and unpacking of data, and check the
+     * unpacked copy with equal(data, copy) */
+    template <typename T, typename Equal, typename Release>
+    void runBenchmark(const std::string& name, T& data, Equal equal, Release release);
+
+    /** Returns random bytes of about payload_bytes in length */
+    std::vector<uint8_t> makePayload();
+
+    std::vector<std::string> workloads;
+    uint64_t                 batch;
+    uint64_t                 iterations;
+    uint32_t                 payload_bytes;
+    uint32_t                 seed;
+    bool                     report_timing;
+
+    SST::RNG::MersenneRNG* rng;
+};
+
+} // namespace CoreTestSerializationBenchmark
+} // namespace SST
+
+#endif // SST_CORE_CORETEST_SERIALIZATIONBENCHMARK_H
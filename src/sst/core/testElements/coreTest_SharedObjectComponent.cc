@@ -69,6 +69,12 @@ coreTestSharedObjectsComponent::coreTestSharedObjectsComponent(SST::ComponentId_
 
     late_initialize = params.find<bool>("late_initialize", "false");
 
+    bool frozen_layout = params.find<bool>("frozen_layout", "false");
+
+    bool hashed_layout = params.find<bool>("hashed_layout", "false");
+
+    bool node_shared = params.find<bool>("node_shared", "false");
+
     // Get the verify mode
     std::string mode = params.find<std::string>("verify_mode", "INIT");
 
@@ -104,6 +110,7 @@ coreTestSharedObjectsComponent::coreTestSharedObjectsComponent(SST::ComponentId_
             if ( double_initialize ) array.initialize("test_shared_array", myid + 1, -1, v_type);
             array.write(myid, myid);
         }
+        if ( node_shared ) array.useNodeSharedMemory();
         if ( pub ) array.publish();
     }
     else if ( test_map && !late_initialize ) {
@@ -121,6 +128,8 @@ coreTestSharedObjectsComponent::coreTestSharedObjectsComponent(SST::ComponentId_
             if ( double_initialize ) map.initialize("test_shared_map", v_type);
             map.write(myid, myid);
         }
+        if ( frozen_layout ) map.useFrozenLayout();
+        if ( hashed_layout ) map.useHashedLayout();
         if ( pub ) map.publish();
     }
     else if ( test_set && !late_initialize ) {
@@ -138,6 +147,8 @@ coreTestSharedObjectsComponent::coreTestSharedObjectsComponent(SST::ComponentId_
             if ( double_initialize ) map.initialize("test_shared_set", v_type);
             set.insert(setItem(myid, myid));
         }
+        if ( frozen_layout ) set.useFrozenLayout();
+        if ( hashed_layout ) set.useHashedLayout();
         if ( pub ) set.publish();
     }
 
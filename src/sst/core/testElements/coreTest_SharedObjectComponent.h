@@ -74,7 +74,10 @@ public:
         { "late_write", "Controls whether a late write is done", "false" },
         { "publish", "Controls whether publish() is called or not", "true"},
         { "double_initialize", "If true, initialize() will be called twice", "false" },
-        { "late_initialize", "If true, initialize() will be called during setup instead of in constructor", "false" }
+        { "late_initialize", "If true, initialize() will be called during setup instead of in constructor", "false" },
+        { "frozen_layout", "If true, SharedMap and SharedSet will be frozen at the end of init", "false" },
+        { "hashed_layout", "If true, SharedMap and SharedSet will be frozen with a hash index at the end of init", "false" },
+        { "node_shared", "If true, SharedArray will be moved to node shared memory at the end of init", "false" }
     )
 
     // Optional since there is nothing to document
@@ -123,4 +126,14 @@ private:
 } // namespace CoreTestSharedObjectsComponent
 } // namespace SST
 
+// Hashes the key only, since that is all operator< compares
+template <>
+struct std::hash<SST::CoreTestSharedObjectsComponent::setItem>
+{
+    size_t operator()(const SST::CoreTestSharedObjectsComponent::setItem& item) const
+    {
+        return std::hash<int>()(item.key);
+    }
+};
+
 #endif // SST_CORE_CORETEST_SHAREDOBJECT_H
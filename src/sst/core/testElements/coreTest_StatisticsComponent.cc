@@ -110,10 +110,10 @@ StatisticsComponentInt::Clock1Tick(Cycle_t UNUSED(CycleNum))
     int64_t  scaled_I64 = I64 / 1000000000000000;
 
     // Add the Statistic Data
-    stat1_U32->addData(scaled_U32);
-    stat2_U64->addData(scaled_U64);
-    stat3_I32->addData(scaled_I32);
-    stat4_I64->addData(scaled_I64);
+    stat1_U32->addDataAtLevel<1>(scaled_U32);
+    stat2_U64->addDataAtLevel<2>(scaled_U64);
+    stat3_I32->addDataAtLevel<3>(scaled_I32);
+    stat4_I64->addDataAtLevel<4>(scaled_I64);
 
     // return false so we keep going or true to stop
     if ( rng_count >= rng_max_count ) {
@@ -0,0 +1,194 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/testElements/coreTest_TimeVortexBenchmark.h"
+
+#include "sst/core/factory.h"
+#include "sst/core/memuse.h"
+#include "sst/core/timeVortex.h"
+
+#include <chrono>
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+#include <unistd.h>
+
+namespace SST {
+namespace CoreTestTimeVortexBenchmark {
+
+namespace {
+
+// Minimal Activity to put in the TimeVortex
+class BenchActivity : public Activity
+{
+public:
+    BenchActivity(SimTime_t time, uint32_t tag)
+    {
+        setDeliveryTime(time);
+        setPriority(EVENTPRIORITY);
+        setOrderTag(tag);
+    }
+
+    void execute() override {}
+
+    NotSerializable(BenchActivity)
+};
+
+// Current resident set size in KB, or 0 if it can't be determined
+uint64_t
+currentRSS()
+{
+    uint64_t rss = 0;
+    FILE*    fp  = fopen("/proc/self/statm", "r");
+    if ( fp != nullptr ) {
+        uint64_t size;
+        if ( fscanf(fp, "%" SCNu64 " %" SCNu64, &size, &rss) != 2 ) rss = 0;
+        fclose(fp);
+    }
+    return rss * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+double
+elapsedNs(std::chrono::steady_clock::time_point start, uint64_t count)
+{
+    if ( count == 0 ) return 0.0;
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / count;
+}
+
+} // namespace
+
+coreTestTimeVortexBenchmark::coreTestTimeVortexBenchmark(ComponentId_t id, Params& params) :
+    Component(id),
+    rng(nullptr)
+{
+    params.find_array<std::string>("vortices", vortices);
+    if ( vortices.empty() ) vortices = ELI::InfoDatabase::getRegisteredElementNames<TimeVortex>();
+
+    dist_name = params.find<std::string>("distribution", "uniform");
+    const std::string& dist = dist_name;
+    if ( dist == "uniform" )
+        distribution = Distribution::UNIFORM;
+    else if ( dist == "clock" )
+        distribution = Distribution::CLOCK;
+    else if ( dist == "exponential" )
+        distribution = Distribution::EXPONENTIAL;
+    else
+        getSimulationOutput().fatal(CALL_INFO, 1, "ERROR: Unknown distribution: %s\n", dist.c_str());
+
+    depth         = params.find<uint64_t>("depth", 100000);
+    operations    = params.find<uint64_t>("operations", 1000000);
+    mean_delay    = params.find<SimTime_t>("mean_delay", 1000);
+    clock_phases  = params.find<uint32_t>("clock_phases", 4);
+    seed          = params.find<uint32_t>("seed", 1447);
+    report_timing = params.find<bool>("report_timing", true);
+
+    if ( mean_delay == 0 ) mean_delay = 1;
+    if ( clock_phases == 0 ) clock_phases = 1;
+}
+
+coreTestTimeVortexBenchmark::~coreTestTimeVortexBenchmark()
+{
+    delete rng;
+}
+
+SimTime_t
+coreTestTimeVortexBenchmark::nextDelay()
+{
+    switch ( distribution ) {
+    case Distribution::UNIFORM:
+        return 1 + (rng->generateNextUInt64() % (2 * mean_delay));
+    case Distribution::CLOCK:
+        // Lots of events landing on a few clock edges
+        return mean_delay * (1 + (rng->generateNextUInt32() % clock_phases));
+    case Distribution::EXPONENTIAL:
+        return 1 + (SimTime_t)(-std::log(1.0 - rng->nextUniform()) * mean_delay);
+    }
+    return 1;
+}
+
+void
+coreTestTimeVortexBenchmark::runBenchmark(const std::string& name)
+{
+    Output& out = getSimulationOutput();
+
+    // Every TimeVortex sees the same sequence of events
+    delete rng;
+    rng = new SST::RNG::MersenneRNG(seed);
+
+    Params      params;
+    TimeVortex* tv = Factory::getFactory()->Create<TimeVortex>(name, params);
+
+    uint64_t  rss_start = currentRSS();
+    SimTime_t now       = 0;
+    uint32_t  tag       = 0;
+
+    // Fill
+    auto start = std::chrono::steady_clock::now();
+    for ( uint64_t i = 0; i < depth; ++i ) {
+        tv->insert(new BenchActivity(nextDelay(), tag++));
+    }
+    double   insert_ns = elapsedNs(start, depth);
+    uint64_t rss_full  = currentRSS();
+
+    // Hold model: pop the head and insert a new event in its future
+    bool ordered = true;
+    start        = std::chrono::steady_clock::now();
+    for ( uint64_t i = 0; i < operations; ++i ) {
+        Activity* act = tv->pop();
+        if ( act == nullptr ) break;
+        if ( act->getDeliveryTime() < now ) ordered = false;
+        now = act->getDeliveryTime();
+        delete act;
+        tv->insert(new BenchActivity(now + nextDelay(), tag++));
+    }
+    double hold_ns = elapsedNs(start, operations);
+
+    // Drain
+    uint64_t count = 0;
+    start          = std::chrono::steady_clock::now();
+    while ( Activity* act = tv->pop() ) {
+        if ( act->getDeliveryTime() < now ) ordered = false;
+        now = act->getDeliveryTime();
+        delete act;
+        count++;
+    }
+    double pop_ns = elapsedNs(start, count);
+
+    delete tv;
+
+    if ( !ordered ) out.fatal(CALL_INFO, 1, "ERROR: %s delivered events out of order\n", name.c_str());
+
+    out.output(
+        "TimeVortex %s (%s distribution): %" PRIu64 " events drained in order\n", name.c_str(), dist_name.c_str(),
+        count);
+    if ( report_timing ) {
+        out.output(
+            "  insert %.1f ns/op, hold %.1f ns/op, pop %.1f ns/op, rss at full depth +%" PRIu64 " KB\n", insert_ns,
+            hold_ns, pop_ns, rss_full > rss_start ? rss_full - rss_start : 0);
+    }
+}
+
+void
+coreTestTimeVortexBenchmark::setup()
+{
+    for ( auto& name : vortices ) {
+        runBenchmark(name);
+    }
+    if ( report_timing ) {
+        getSimulationOutput().output("Peak process RSS: %" PRIu64 " KB\n", SST::Core::localMemSize());
+    }
+}
+
+} // namespace CoreTestTimeVortexBenchmark
+} // namespace SST
@@ -0,0 +1,105 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_CORETEST_TIMEVORTEXBENCHMARK_H
+#define SST_CORE_CORETEST_TIMEVORTEXBENCHMARK_H
+
+#include "sst/core/component.h"
+#include "sst/core/rng/mersenne.h"
+
+#include <string>
+#include <vector>
+
+namespace SST {
+
+class TimeVortex;
+
+namespace CoreTestTimeVortexBenchmark {
+
+/**
+ * Drives TimeVortex implementations directly, outside of the
+ * simulation loop, and reports the cost of insert and pop for a
+ * synthetic event distribution.  Each TimeVortex is filled to the
+ * requested depth, run through a number of hold operations (pop one,
+ * insert one in the future) and then drained.
+ */
+class coreTestTimeVortexBenchmark : public SST::Component
+{
+public:
+    // REGISTER THIS COMPONENT INTO THE ELEMENT LIBRARY
+    SST_ELI_REGISTER_COMPONENT(
+        coreTestTimeVortexBenchmark,
+        "coreTestElement",
+        "coreTestTimeVortexBenchmark",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Microbenchmark for the TimeVortex implementations",
+        COMPONENT_CATEGORY_UNCATEGORIZED
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "vortices", "List of TimeVortex elements to benchmark.  Empty means all registered TimeVortex elements", "[]" },
+        { "distribution", "Distribution of event delivery delays: uniform, clock or exponential", "uniform" },
+        { "depth", "Number of pending events kept in the TimeVortex", "100000" },
+        { "operations", "Number of hold operations (pop plus insert) to time", "1000000" },
+        { "mean_delay", "Mean delivery delay of an inserted event in core cycles", "1000" },
+        { "clock_phases", "For the clock distribution, number of distinct clock edges events are spread over", "4" },
+        { "seed", "Seed for the random number generator", "1447" },
+        { "report_timing", "Set to false to suppress the timing numbers (used for regression testing)", "true" }
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_STATISTICS(
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_PORTS(
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
+    )
+
+    coreTestTimeVortexBenchmark(SST::ComponentId_t id, SST::Params& params);
+    ~coreTestTimeVortexBenchmark();
+
+    void setup() override;
+    void finish() override {}
+
+private:
+    enum class Distribution { UNIFORM, CLOCK, EXPONENTIAL };
+
+    coreTestTimeVortexBenchmark();                                   // for serialization only
+    coreTestTimeVortexBenchmark(const coreTestTimeVortexBenchmark&); // do not implement
+    void operator=(const coreTestTimeVortexBenchmark&);              // do not implement
+
+    /** Run the benchmark on a single TimeVortex */
+    void runBenchmark(const std::string& name);
+
+    /** Returns the delay of the next event to insert */
+    SimTime_t nextDelay();
+
+    std::vector<std::string> vortices;
+    std::string              dist_name;
+    Distribution             distribution;
+    uint64_t                 depth;
+    uint64_t                 operations;
+    SimTime_t                mean_delay;
+    uint32_t                 clock_phases;
+    uint32_t                 seed;
+    bool                     report_timing;
+
+    SST::RNG::MersenneRNG* rng;
+};
+
+} // namespace CoreTestTimeVortexBenchmark
+} // namespace SST
+
+#endif // SST_CORE_CORETEST_TIMEVORTEXBENCHMARK_H
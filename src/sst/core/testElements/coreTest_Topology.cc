@@ -0,0 +1,41 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/testElements/coreTest_Topology.h"
+
+using namespace SST;
+using namespace SST::CoreTestTopology;
+
+coreTestRing::coreTestRing(Params& params) : TopologyBuilder()
+{
+    num_components = params.find<uint64_t>("num_components", 4);
+    latency        = params.find<std::string>("latency", "1ns");
+}
+
+void
+coreTestRing::getComponent(uint64_t index, ComponentDesc& desc)
+{
+    desc.name = "ring_" + std::to_string(index);
+    desc.type = "coreTestElement.coreTestLinks";
+    desc.params.emplace_back("id", std::to_string(index));
+}
+
+void
+coreTestRing::getLinks(uint64_t index, std::vector<LinkDesc>& links)
+{
+    // Link i goes from the Elink of component i to the Wlink of i + 1
+    uint64_t next = (index + 1) % num_components;
+    uint64_t prev = (index + num_components - 1) % num_components;
+    links.push_back(LinkDesc { "ring_link_" + std::to_string(index), "Elink", next, "Wlink", latency });
+    links.push_back(LinkDesc { "ring_link_" + std::to_string(prev), "Wlink", prev, "Elink", latency });
+}
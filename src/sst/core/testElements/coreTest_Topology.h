@@ -0,0 +1,54 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_CORETEST_TOPOLOGY_H
+#define SST_CORE_CORETEST_TOPOLOGY_H
+
+#include "sst/core/topologyBuilder.h"
+
+namespace SST {
+namespace CoreTestTopology {
+
+/**
+ * Ring of coreTestLinks components, each connected from its Elink to
+ * the Wlink of the next one
+ */
+class coreTestRing : public SST::TopologyBuilder
+{
+public:
+    SST_ELI_REGISTER_TOPOLOGY_BUILDER(
+        coreTestRing,
+        "coreTestElement",
+        "coreTestRing",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "CoreTest ring of coreTestLinks components")
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "num_components", "Number of components in the ring", "4" },
+        { "latency",        "Latency of the links", "1ns" }
+    )
+
+    coreTestRing(SST::Params& params);
+    ~coreTestRing() {}
+
+    uint64_t getNumComponents() override { return num_components; }
+    void     getComponent(uint64_t index, ComponentDesc& desc) override;
+    void     getLinks(uint64_t index, std::vector<LinkDesc>& links) override;
+
+private:
+    uint64_t    num_components;
+    std::string latency;
+};
+
+} // namespace CoreTestTopology
+} // namespace SST
+
+#endif // SST_CORE_CORETEST_TOPOLOGY_H
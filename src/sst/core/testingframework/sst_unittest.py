@@ -362,6 +362,65 @@ class SSTTestCase(unittest.TestCase):
         # Return the command used to launch SST
         return oscmd
 
+###
+
+    def run_sst_perf(self, sdl_file, out_file, perf_name=None, baseline_file=None,
+                     tolerance=None, runs=None, other_args="", num_ranks=None,
+                     num_threads=None, timeout_sec=120):
+        """ Launch sst as a performance test.  In performance mode
+            (sst-test-core --perf) the simulation is run several times and
+            the median wall time, run loop time and events/sec are compared
+            against a stored baseline.  A metric that is worse than the
+            baseline by more than the tolerance generates a
+            SSTTestCase.assert().  Otherwise the simulation is run once, so
+            the test can still check its output.
+
+            Args:
+                sdl_file (str): The FilePath to the test SDL (python) file.
+                out_file (str): The FilePath to the finalized output file.
+                                The output of the last run is kept.
+                perf_name (str): Name of the test in the baseline file.
+                                 Default = the test name, ranks and threads
+                baseline_file (str): The FilePath to the baseline file.
+                                     Default = the test engine --perf_baseline
+                tolerance (float): Percent a metric may get worse.
+                                   Default = the test engine --perf_tolerance
+                runs (int): Number of runs.
+                            Default = the test engine --perf_runs
+                other_args (str): Any other arguments used in the SST cmd
+                num_ranks (int): The number of ranks to run SST with.
+                num_threads (int): The number of threads to run SST with.
+                timeout_sec (int): Allowed runtime in seconds of each run
+
+            Returns:
+                (list) The results of each run from testing_perf_parse_timing()
+        """
+        if num_ranks is None:
+            num_ranks = test_engine_globals.TESTENGINE_SSTRUN_NUMRANKS
+        if num_threads is None:
+            num_threads = test_engine_globals.TESTENGINE_SSTRUN_NUMTHREADS
+        if perf_name is None:
+            perf_name = "{0}.{1}_{2}r_{3}t".format(self.get_testsuite_name(), self.testname,
+                                                   num_ranks, num_threads)
+        if runs is None:
+            runs = test_engine_globals.TESTENGINE_PERF_RUNS
+        if not testing_check_is_in_perf_mode():
+            runs = 1
+
+        results = []
+        for run in range(runs):
+            timing_file = "{0}.timing{1}.json".format(out_file, run)
+            self.run_sst(sdl_file, out_file, other_args="{0} --timing-info-json={1}".format(
+                         other_args, timing_file), num_ranks=num_ranks,
+                         num_threads=num_threads, timeout_sec=timeout_sec)
+            results.append(testing_perf_parse_timing(timing_file))
+
+        if testing_check_is_in_perf_mode():
+            passed, report = testing_perf_check(perf_name, results, baseline_file, tolerance)
+            log_forced(report)
+            self.assertTrue(passed, report)
+        return results
+
 ################################################################################
 ### Module level support
 ################################################################################
@@ -26,6 +26,9 @@ import tarfile
 import shutil
 import difflib
 import configparser
+import json
+import statistics
+import threading
 
 import test_engine_globals
 from test_engine_support import OSCommand
@@ -109,6 +112,113 @@ def testing_check_get_num_threads():
     """
     return test_engine_globals.TESTENGINE_SSTRUN_NUMTHREADS
 
+###
+
+def testing_check_is_in_perf_mode():
+    """ Identify if test frameworks is comparing performance tests against
+        a baseline
+
+        Returns:
+            (bool) True if test frameworks is in performance mode
+    """
+    return test_engine_globals.TESTENGINE_PERFMODE
+
+################################################################################
+# Performance Testing Functions
+################################################################################
+
+# Metrics compared against the baseline, and whether larger is better
+PERF_METRICS = [("wall_time", False), ("run_time", False), ("events_per_sec", True)]
+
+perf_baseline_lock = threading.Lock()
+
+def testing_perf_parse_timing(timing_file):
+    """ Read the results of one run from a file written by
+        sst --timing-info-json
+
+        Args:
+            timing_file (str): Path to the timing file
+
+        Returns:
+            (dict) The wall time, run time, events and events/sec of the run
+    """
+    check_param_type("timing_file", timing_file, str)
+    with open(timing_file, 'r') as fp:
+        report = json.load(fp)
+    phases = {phase["name"] : phase for phase in report["phases"]}
+    result = {"wall_time" : phases["total"]["max"],
+              "run_time" : phases["run"]["max"],
+              "events" : report["events"]["total"]}
+    if result["run_time"] > 0:
+        result["events_per_sec"] = result["events"] / result["run_time"]
+    return result
+
+###
+
+def testing_perf_check(perf_name, results, baseline_file=None, tolerance=None):
+    """ Compare the median of the results of several runs of a performance
+        test against its baseline.  If the test engine was run with
+        --perf_update_baseline, the medians are stored in the baseline
+        instead.
+
+        Args:
+            perf_name (str): Name of the test in the baseline file
+            results (list): Results of each run from testing_perf_parse_timing()
+            baseline_file (str): Path to the baseline file.
+                                 Default = the test engine --perf_baseline file
+            tolerance (float): Percent a metric may get worse before it is a
+                               regression.
+                               Default = the test engine --perf_tolerance
+
+        Returns:
+            (bool, str) False if any metric regressed by more than the
+            tolerance, and a report of the relative change of each metric
+    """
+    check_param_type("perf_name", perf_name, str)
+    if baseline_file is None:
+        baseline_file = test_engine_globals.TESTENGINE_PERF_BASELINE
+    if tolerance is None:
+        tolerance = test_engine_globals.TESTENGINE_PERF_TOLERANCE
+
+    current = {}
+    for metric, _ in PERF_METRICS:
+        values = [r[metric] for r in results if metric in r]
+        if values:
+            current[metric] = statistics.median(values)
+    current["runs"] = len(results)
+
+    with perf_baseline_lock:
+        baseline = {}
+        if os.path.isfile(baseline_file):
+            with open(baseline_file, 'r') as fp:
+                baseline = json.load(fp)
+
+        if test_engine_globals.TESTENGINE_PERF_UPDATEBASELINE:
+            baseline[perf_name] = current
+            with open(baseline_file, 'w') as fp:
+                json.dump(baseline, fp, indent=2, sort_keys=True)
+            return (True, "{0}: stored baseline in {1}".format(perf_name, baseline_file))
+
+    if perf_name not in baseline:
+        return (True, "{0}: no baseline in {1}".format(perf_name, baseline_file))
+
+    passed = True
+    lines = []
+    for metric, higher_is_better in PERF_METRICS:
+        old = baseline[perf_name].get(metric)
+        new = current.get(metric)
+        if not old or new is None:
+            continue
+        change = 100.0 * (new - old) / old
+        worse = -change if higher_is_better else change
+        status = ""
+        if worse > tolerance:
+            passed = False
+            status = " REGRESSION (tolerance {0:.1f}%)".format(tolerance)
+        lines.append("{0}: {1} baseline {2:.6g}, current {3:.6g}, {4:+.1f}%{5}".format(
+            perf_name, metric, old, new, change, status))
+    return (passed, "\n".join(lines))
+
 ################################################################################
 # PIN Information Functions
 ################################################################################
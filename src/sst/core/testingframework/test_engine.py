@@ -248,6 +248,22 @@ class TestEngine():
                                help=('Runtime args for all SST runs (must be\n')
                                + ('identified as a string; Note: Extra space at front)'))
 
+        perf_group = parser.add_argument_group('Performance Test Options')
+        perf_group.add_argument('--perf', action='store_true',
+                                help=('Run performance tests several times and compare\n')
+                                + ('their times against a baseline [false]'))
+        perf_group.add_argument('--perf_runs', type=int, metavar="NN",
+                                nargs=1, default=[5],
+                                help='Runs of each performance test; median is used [5]')
+        perf_group.add_argument('--perf_tolerance', type=float, metavar="PCT",
+                                nargs=1, default=[10.0],
+                                help='Percent slowdown allowed against the baseline [10.0]')
+        perf_group.add_argument('--perf_baseline', type=str, metavar="file",
+                                nargs=1, default=['./sst_perf_baseline.json'],
+                                help='Baseline file [./sst_perf_baseline.json]')
+        perf_group.add_argument('--perf_update_baseline', action='store_true',
+                                help='Store the results in the baseline instead of comparing [false]')
+
         parser.add_argument('-f', '--fail_fast', action='store_true',
                             help='Stop testing on failure [false]')
         parser.add_argument('-o', '--out_dir', type=str, metavar='dir',
@@ -340,6 +356,14 @@ class TestEngine():
         test_engine_globals.TESTENGINE_SSTRUN_NUMRANKS = args.ranks[0]
         test_engine_globals.TESTENGINE_SSTRUN_NUMTHREADS = args.threads[0]
         test_engine_globals.TESTENGINE_SSTRUN_GLOBALARGS = args.sst_run_args[0]
+        test_engine_globals.TESTENGINE_PERFMODE = args.perf or args.perf_update_baseline
+        test_engine_globals.TESTENGINE_PERF_RUNS = args.perf_runs[0]
+        test_engine_globals.TESTENGINE_PERF_TOLERANCE = args.perf_tolerance[0]
+        test_engine_globals.TESTENGINE_PERF_BASELINE = os.path.abspath(args.perf_baseline[0])
+        test_engine_globals.TESTENGINE_PERF_UPDATEBASELINE = args.perf_update_baseline
+        if args.perf_runs[0] < 1:
+            parser.print_help()
+            log_fatal("Performance runs must be > 0; you provided {0}".format(args.perf_runs[0]))
         test_engine_globals.TESTOUTPUT_TOPDIRPATH = os.path.abspath(args.out_dir[0])
         test_engine_globals.TESTOUTPUT_RUNDIRPATH = os.path.\
         abspath("{0}/run_data".format(args.out_dir[0]))
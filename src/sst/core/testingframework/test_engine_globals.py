@@ -46,6 +46,11 @@ TESTENGINE_ELEM_CONFINCLUDE_DICT = None
 TESTENGINE_ERRORCOUNT = 0
 TESTENGINE_SCENARIOSLIST = None
 TESTENGINE_TESTNOTESLIST = None
+TESTENGINE_PERFMODE = None
+TESTENGINE_PERF_RUNS = None
+TESTENGINE_PERF_TOLERANCE = None
+TESTENGINE_PERF_BASELINE = None
+TESTENGINE_PERF_UPDATEBASELINE = None
 
 # These are some globals to pass data between the top level test engine
 # and the lower level testscripts
@@ -75,6 +80,11 @@ def init_test_engine_globals():
     global TESTENGINE_ERRORCOUNT
     global TESTENGINE_SCENARIOSLIST
     global TESTENGINE_TESTNOTESLIST
+    global TESTENGINE_PERFMODE
+    global TESTENGINE_PERF_RUNS
+    global TESTENGINE_PERF_TOLERANCE
+    global TESTENGINE_PERF_BASELINE
+    global TESTENGINE_PERF_UPDATEBASELINE
 
     TESTRUN_TESTRUNNINGFLAG = False
     TESTRUN_SINGTHREAD_TESTSUITE_NAME = ""
@@ -100,3 +110,8 @@ def init_test_engine_globals():
     TESTENGINE_ERRORCOUNT = 0
     TESTENGINE_SCENARIOSLIST = []
     TESTENGINE_TESTNOTESLIST = []
+    TESTENGINE_PERFMODE = False
+    TESTENGINE_PERF_RUNS = 5
+    TESTENGINE_PERF_TOLERANCE = 10.0
+    TESTENGINE_PERF_BASELINE = os.path.abspath("./sst_perf_baseline.json")
+    TESTENGINE_PERF_UPDATEBASELINE = False
@@ -0,0 +1,152 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/threadAffinity.h"
+
+#include "sst/core/output.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <fstream>
+#include <map>
+#include <vector>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+namespace SST {
+namespace Core {
+namespace ThreadAffinity {
+
+// Both are only written by init(), before the simulation threads start
+
+// Core chosen for each simulation thread, empty when not pinning
+static std::vector<int> thread_cpus;
+
+// Package (socket) of each core the process may run on
+static std::map<int, int> cpu_package;
+
+#ifdef __linux__
+/** Returns the package of a core, or 0 if it can't be read */
+static int
+readPackage(int cpu)
+{
+    std::ifstream in("/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/topology/physical_package_id");
+    int           package = 0;
+    if ( !(in >> package) ) return 0;
+    return package;
+}
+#endif
+
+void
+init(const std::string& policy, uint32_t num_threads, Output& out)
+{
+    thread_cpus.clear();
+    cpu_package.clear();
+    if ( policy == "none" ) return;
+
+#ifdef __linux__
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    if ( sched_getaffinity(0, sizeof(allowed), &allowed) != 0 ) {
+        out.output("WARNING: Could not get the CPU affinity of the process, threads will not be pinned\n");
+        return;
+    }
+
+    // Allowed cores of each package, in core order
+    std::map<int, std::vector<int>> packages;
+    for ( int cpu = 0; cpu < CPU_SETSIZE; cpu++ ) {
+        if ( !CPU_ISSET(cpu, &allowed) ) continue;
+        int package      = readPackage(cpu);
+        cpu_package[cpu] = package;
+        packages[package].push_back(cpu);
+    }
+
+    std::vector<int> order;
+    if ( policy == "compact" ) {
+        for ( auto& x : packages )
+            order.insert(order.end(), x.second.begin(), x.second.end());
+    }
+    else {
+        // scatter: take one core from each package in turn
+        size_t most = 0;
+        for ( auto& x : packages )
+            most = std::max(most, x.second.size());
+        for ( size_t i = 0; i < most; i++ ) {
+            for ( auto& x : packages ) {
+                if ( i < x.second.size() ) order.push_back(x.second[i]);
+            }
+        }
+    }
+
+    if ( order.size() < num_threads ) {
+        out.output(
+            "WARNING: %" PRIu32 " threads but only %zu cores available, some threads will share a core\n", num_threads,
+            order.size());
+    }
+    for ( uint32_t i = 0; i < num_threads; i++ )
+        thread_cpus.push_back(order[i % order.size()]);
+#else
+    (void)num_threads;
+    out.output("WARNING: --thread-affinity is only supported on Linux, threads will not be pinned\n");
+#endif
+}
+
+uint32_t
+threadSocket(uint32_t thread)
+{
+    if ( thread >= thread_cpus.size() ) return 0;
+
+    std::map<int, uint32_t> sockets;
+    for ( uint32_t i = 0; i <= thread; i++ )
+        sockets.emplace(cpu_package.at(thread_cpus[i]), sockets.size());
+    return sockets.at(cpu_package.at(thread_cpus[thread]));
+}
+
+bool
+enabled()
+{
+    return !thread_cpus.empty();
+}
+
+void
+pinSimulationThread(uint32_t thread)
+{
+    if ( thread >= thread_cpus.size() ) return;
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(thread_cpus[thread], &set);
+    sched_setaffinity(0, sizeof(set), &set);
+#endif
+}
+
+void
+placeHelperThread(uint32_t thread)
+{
+    if ( thread >= thread_cpus.size() ) return;
+#ifdef __linux__
+    int       package = cpu_package.at(thread_cpus[thread]);
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for ( auto& x : cpu_package ) {
+        if ( x.second == package ) CPU_SET(x.first, &set);
+    }
+    sched_setaffinity(0, sizeof(set), &set);
+#endif
+}
+
+} // namespace ThreadAffinity
+} // namespace Core
+} // namespace SST
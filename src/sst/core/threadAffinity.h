@@ -0,0 +1,69 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_THREADAFFINITY_H
+#define SST_CORE_THREADAFFINITY_H
+
+#include <cstdint>
+#include <string>
+
+namespace SST {
+
+class Output;
+
+namespace Core {
+namespace ThreadAffinity {
+
+/**
+   Choose the cores the simulation threads of this rank will run on.
+   Must be called before the threads are started.
+
+   Threads are placed on the cores the process is allowed to run on,
+   so ranks that were bound by the MPI launcher stay within their
+   binding.  With "compact", consecutive threads go on consecutive
+   cores of the same socket.  With "scatter", consecutive threads go
+   on different sockets.  With "none", threads are not pinned.  Only
+   supported on Linux; elsewhere threads are not pinned.
+
+   @param policy none, compact or scatter
+   @param num_threads Number of simulation threads in the rank
+   @param out Output used to report problems with the placement
+ */
+void init(const std::string& policy, uint32_t num_threads, Output& out);
+
+/** Whether threads are being pinned */
+bool enabled();
+
+/**
+   Socket a simulation thread will run on, numbered from 0 in the order
+   the sockets are first used.  0 for every thread when threads are not
+   pinned.
+ */
+uint32_t threadSocket(uint32_t thread);
+
+/**
+   Pin the calling thread to the core chosen for a simulation thread.
+   Does nothing if threads are not being pinned.
+ */
+void pinSimulationThread(uint32_t thread);
+
+/**
+   Let the calling thread run on any core of the socket of a
+   simulation thread.  Used for helper threads working for that
+   thread, so the memory they touch first is local to it.
+ */
+void placeHelperThread(uint32_t thread);
+
+} // namespace ThreadAffinity
+} // namespace Core
+} // namespace SST
+
+#endif // SST_CORE_THREADAFFINITY_H
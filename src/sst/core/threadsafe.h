@@ -22,7 +22,9 @@
 #endif
 
 #include <atomic>
+#include <algorithm>
 #include <condition_variable>
+#include <memory>
 #include <mutex>
 #include <thread>
 #include <vector>
@@ -44,23 +46,132 @@ namespace ThreadSafe {
 #define CACHE_ALIGNED_T           alignas(64)
 #endif
 
+/**
+ * Barrier for the threads of a rank.
+ *
+ * By default every thread decrements one shared counter, which gets
+ * slow with many threads.  After setTreeBarriers(true), barriers
+ * created or resized afterwards combine arrivals in a tree instead:
+ * groups of TREE_FANIN threads with consecutive thread indices, which
+ * are usually close together on the machine, meet at a leaf, the last
+ * to arrive moves up, and the release goes back down the same way.
+ * Tree barriers need every thread to call setThreadIndex() with its
+ * own index below the barrier count.
+ */
 class CACHE_ALIGNED_T Barrier
 {
+    static const size_t TREE_FANIN = 4;
+
+    struct CACHE_ALIGNED_T TreeNode
+    {
+        std::atomic<size_t> count;
+        std::atomic<size_t> release; // Incremented each time the node's threads are released
+        size_t              fanin;
+        TreeNode*           parent;
+    };
+
     size_t              origCount;
     std::atomic<bool>   enabled;
     std::atomic<size_t> count, generation;
 
+    std::unique_ptr<TreeNode[]> tree; // Leaves first, nullptr for a central barrier
+
+    static bool                use_tree;
+    static thread_local size_t thread_index;
+
+    void buildTree()
+    {
+        tree.reset();
+        if ( !use_tree || origCount <= TREE_FANIN ) return;
+
+        size_t total = 0;
+        for ( size_t width = origCount; width > 1; ) {
+            width = (width + TREE_FANIN - 1) / TREE_FANIN;
+            total += width;
+        }
+        tree.reset(new TreeNode[total]);
+
+        // Lay out each level after the one below it
+        size_t base = 0, width = origCount;
+        while ( width > 1 ) {
+            size_t nodes = (width + TREE_FANIN - 1) / TREE_FANIN;
+            for ( size_t i = 0; i < nodes; i++ ) {
+                TreeNode& node = tree[base + i];
+                node.fanin     = std::min(TREE_FANIN, width - i * TREE_FANIN);
+                node.count.store(node.fanin);
+                node.release.store(0);
+                node.parent = nodes > 1 ? &tree[base + nodes + i / TREE_FANIN] : nullptr;
+            }
+            base += nodes;
+            width = nodes;
+        }
+    }
+
+    /** Spin, then yield, then sleep until done() returns true */
+    template <typename F>
+    static void spinUntil(F done)
+    {
+        uint32_t count = 0;
+        do {
+            count++;
+            if ( count < 1024 ) { sst_pause(); }
+            else if ( count < (1024 * 1024) ) {
+                std::this_thread::yield();
+            }
+            else {
+                struct timespec ts;
+                ts.tv_sec  = 0;
+                ts.tv_nsec = 1000;
+                nanosleep(&ts, nullptr);
+            }
+        } while ( !done() );
+    }
+
+    void waitTree()
+    {
+        TreeNode* won[64];
+        int       num_won = 0;
+
+        TreeNode* node = &tree[thread_index / TREE_FANIN];
+        while ( true ) {
+            size_t gen = node->release.load(std::memory_order_acquire);
+            if ( node->count.fetch_sub(1) != 1 ) {
+                spinUntil([&]() { return gen != node->release.load(std::memory_order_acquire) || !enabled; });
+                break;
+            }
+            // Last to arrive, so reset the node and carry on up
+            node->count.store(node->fanin, std::memory_order_relaxed);
+            won[num_won++] = node;
+            if ( node->parent == nullptr ) break;
+            node = node->parent;
+        }
+
+        // Release the nodes this thread moved up from, top first
+        while ( num_won > 0 )
+            won[--num_won]->release.fetch_add(1, std::memory_order_release);
+    }
+
 public:
-    Barrier(size_t count) : origCount(count), enabled(true), count(count), generation(0) {}
+    Barrier(size_t count) : origCount(count), enabled(true), count(count), generation(0) { buildTree(); }
 
     // Come g++ 4.7, this can become a delegating constructor
     Barrier() : origCount(0), enabled(false), count(0), generation(0) {}
 
+    /** Select whether barriers created or resized from now on are tree barriers */
+    static void setTreeBarriers(bool tree) { use_tree = tree; }
+
+    /** Set the index of the calling thread, used by tree barriers */
+    static void setThreadIndex(size_t index) { thread_index = index; }
+
+    /** Index of the calling thread, as set by setThreadIndex() */
+    static size_t getThreadIndex() { return thread_index; }
+
     /** ONLY call this while nobody is in wait() */
     void resize(size_t newCount)
     {
         count = origCount = newCount;
         generation.store(0);
+        buildTree();
         enabled.store(true);
     }
 
@@ -74,6 +185,11 @@ public:
         if ( enabled ) {
             auto startTime = SST::Core::Profile::now();
 
+            if ( tree ) {
+                waitTree();
+                return SST::Core::Profile::getElapsed(startTime);
+            }
+
             size_t gen = generation.load(std::memory_order_acquire);
             asm("" ::: "memory");
             size_t c = count.fetch_sub(1) - 1;
@@ -87,20 +203,7 @@ public:
             }
             else {
                 /* Try spinning first */
-                uint32_t count = 0;
-                do {
-                    count++;
-                    if ( count < 1024 ) { sst_pause(); }
-                    else if ( count < (1024 * 1024) ) {
-                        std::this_thread::yield();
-                    }
-                    else {
-                        struct timespec ts;
-                        ts.tv_sec  = 0;
-                        ts.tv_nsec = 1000;
-                        nanosleep(&ts, nullptr);
-                    }
-                } while ( gen == generation.load(std::memory_order_acquire) );
+                spinUntil([&]() { return gen != generation.load(std::memory_order_acquire); });
             }
             elapsed = SST::Core::Profile::getElapsed(startTime);
         }
@@ -247,6 +350,19 @@ public:
             sst_pause();
         }
     }
+
+    /** Call f on each item in the queue, oldest first, without
+     * removing them.  Items still being inserted are skipped.  Must
+     * not be called while another thread is removing items. */
+    template <typename F>
+    void for_each(F f) const
+    {
+        for ( size_t pos = rPtr.load(std::memory_order_relaxed);; ++pos ) {
+            const cell_t* cell = &data[pos % dsize];
+            if ( cell->sequence.load(std::memory_order_acquire) != pos + 1 ) return;
+            f(cell->data);
+        }
+    }
 };
 
 template <typename T>
@@ -15,6 +15,8 @@
 #include "sst/core/sst_types.h"
 #include "sst/core/unitAlgebra.h"
 
+#include <cstddef>
+
 namespace SST {
 
 class TimeLord;
@@ -40,7 +42,41 @@ public:
        The result is truncated, not rounded.
        @param time time to convert from core time
      */
-    SimTime_t convertFromCoreTime(SimTime_t time) const { return time / factor; }
+    SimTime_t convertFromCoreTime(SimTime_t time) const
+    {
+        // Divide by multiplying with the precomputed inverse of factor
+        if ( magic == 0 ) return time >> shift;
+        SimTime_t q = static_cast<SimTime_t>((static_cast<uint128_t>(magic) * time) >> 64);
+        if ( add ) return (((time - q) >> 1) + q) >> shift;
+        return q >> shift;
+    }
+
+    /**
+       Converts an array of times from the component's view to the
+       core's view of time.
+       @param in times to convert to core time
+       @param out converted times, may be the same as in
+       @param count number of times to convert
+     */
+    void convertToCoreTime(const SimTime_t* in, SimTime_t* out, size_t count) const
+    {
+        for ( size_t i = 0; i < count; ++i )
+            out[i] = in[i] * factor;
+    }
+
+    /**
+       Converts an array of times from the core's view to the
+       component's view of time.  The results are truncated, not
+       rounded.
+       @param in times to convert from core time
+       @param out converted times, may be the same as in
+       @param count number of times to convert
+     */
+    void convertFromCoreTime(const SimTime_t* in, SimTime_t* out, size_t count) const
+    {
+        for ( size_t i = 0; i < count; ++i )
+            out[i] = convertFromCoreTime(in[i]);
+    }
 
     /**
      * @return The factor used for conversions with Core Time
@@ -53,12 +89,26 @@ public:
     UnitAlgebra getPeriod() const; // Implemented in timeLord.cc
 
 private:
+    __extension__ typedef unsigned __int128 uint128_t;
+
     /**
        Factor for converting between core and component time
     */
     SimTime_t factor;
 
-    TimeConverter(SimTime_t fact) { factor = fact; }
+    /**
+       Multiplicative inverse of factor, so converting from core time
+       needs no division.  A magic of 0 means factor is a power of two
+       and the conversion is just a shift.
+    */
+    SimTime_t magic;
+    uint8_t   shift;
+    bool      add; // magic needs 65 bits, the top one is added back in
+
+    TimeConverter(SimTime_t fact) : factor(fact) { computeInverse(); }
+
+    /** Set magic, shift and add for factor.  Implemented in timeLord.cc */
+    void computeInverse();
 
     ~TimeConverter() {}
 
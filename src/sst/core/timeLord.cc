@@ -174,6 +174,34 @@ TimeLord::getSimCycles(const std::string& ts, const std::string& UNUSED(where))
     return parseCache[ts]->getFactor();
 }
 
+void
+TimeConverter::computeInverse()
+{
+    // Round up method for unsigned division by a constant (Granlund
+    // and Montgomery), as used by libdivide
+    magic = 0;
+    shift = 0;
+    add   = false;
+    if ( factor == 0 ) return;
+
+    uint8_t log2 = 63 - __builtin_clzll(factor);
+    shift        = log2;
+    if ( (factor & (factor - 1)) == 0 ) return;
+
+    uint128_t numerator = static_cast<uint128_t>(1) << (64 + log2);
+    SimTime_t m         = static_cast<SimTime_t>(numerator / factor);
+    SimTime_t rem       = static_cast<SimTime_t>(numerator % factor);
+    if ( factor - rem >= (static_cast<SimTime_t>(1) << log2) ) {
+        // 2^(64 + log2) / factor doesn't round up closely enough, so
+        // use one more bit of precision, which takes a 65 bit magic
+        m += m;
+        SimTime_t twice_rem = rem + rem;
+        if ( twice_rem >= factor || twice_rem < rem ) m += 1;
+        add = true;
+    }
+    magic = m + 1;
+}
+
 UnitAlgebra
 TimeConverter::getPeriod() const
 {
@@ -13,9 +13,53 @@
 
 #include "sst/core/timeVortex.h"
 
+#include <vector>
+
 namespace SST {
 
 SST_ELI_DEFINE_CTOR_EXTERN(TimeVortex)
 SST_ELI_DEFINE_INFO_EXTERN(TimeVortex)
 
+void
+TimeVortex::activityCancelled()
+{
+    // Compacting is linear in the depth, so only do it once at least
+    // half of it can be removed
+    static const uint64_t min_cancelled = 1024;
+    if ( ++cancelled < min_cancelled || cancelled * 2 < getCurrentDepth() ) return;
+    compact();
+    cancelled = 0;
+}
+
+void
+TimeVortex::popBatch(std::vector<Activity*>& batch)
+{
+    Activity* first = pop();
+    batch.push_back(first);
+    while ( !empty() ) {
+        Activity* next = front();
+        if ( next->getDeliveryTime() != first->getDeliveryTime() || next->getPriority() != first->getPriority() ) {
+            break;
+        }
+        batch.push_back(pop());
+    }
+}
+
+void
+TimeVortex::compact()
+{
+    std::vector<Activity*> live;
+    live.reserve(getCurrentDepth());
+    while ( !empty() ) {
+        Activity* act = pop();
+        if ( act->isCancelled() ) { delete act; }
+        else {
+            live.push_back(act);
+        }
+    }
+    for ( Activity* act : live ) {
+        insert(act);
+    }
+}
+
 } // namespace SST
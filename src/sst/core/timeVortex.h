@@ -15,6 +15,8 @@
 #include "sst/core/activityQueue.h"
 #include "sst/core/module.h"
 
+#include <vector>
+
 namespace SST {
 
 class Output;
@@ -37,15 +39,46 @@ public:
     virtual int       size() override                     = 0;
     virtual void      insert(Activity* activity) override = 0;
     virtual Activity* pop() override                      = 0;
-    virtual Activity* front() override                    = 0;
+
+    /** Returns the next activity without changing the queue.  While a
+     * thread waits at a sync, the other threads call front() on its
+     * TimeVortex to find the next activity time, so front() must not
+     * move anything around and can't leave work to be done later.
+     */
+    virtual Activity* front() override = 0;
+
+    /** Pop the activity at the head of the queue along with all the
+     * ones after it with the same delivery time and priority, in
+     * order.  Only called when the queue isn't empty.  The default
+     * pops them one at a time.
+     * @param batch Activities are appended to it
+     */
+    virtual void popBatch(std::vector<Activity*>& batch);
 
     /** Print the state of the TimeVortex */
     virtual void     print(Output& out) const = 0;
     virtual uint64_t getMaxDepth() const { return max_depth; }
     virtual uint64_t getCurrentDepth() const = 0;
 
+    /** Note that an Activity in the TimeVortex was cancelled.
+     * Cancelled activities are left in place and dropped as they come
+     * out, unless they make up enough of the TimeVortex that it is
+     * worth compacting. */
+    void activityCancelled();
+
+    /** Remove all the cancelled activities.  The default pops
+     * everything and inserts back the ones that are still live, in
+     * the same order. */
+    virtual void compact();
+
 protected:
     uint64_t max_depth;
+
+private:
+    // Cancelled since the last compaction.  Ones that were dropped as
+    // they came out are still counted, which only makes compaction
+    // happen a bit early.
+    uint64_t cancelled = 0;
 };
 
 } // namespace SST
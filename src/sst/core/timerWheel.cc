@@ -0,0 +1,276 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/timerWheel.h"
+
+#include "sst/core/simulation_impl.h"
+#include "sst/core/timeConverter.h"
+
+#include <algorithm>
+#include <sstream>
+
+namespace SST {
+
+// A timer is kept at the level of the highest byte in which its tick
+// differs from the current tick of the wheel, in the slot given by
+// that byte of its tick.  So every timer at a level is earlier than
+// every timer at the levels above it, and when the wheel moves to a
+// new tick only the slot of that tick at the highest level that
+// changed has to be spread out over the levels below.
+
+static inline int
+levelOf(SimTime_t diff)
+{
+    return (63 - __builtin_clzll(diff)) / 8;
+}
+
+static bool
+laterWakeUp(const Action* a, const Action* b)
+{
+    return a->getDeliveryTime() > b->getDeliveryTime();
+}
+
+TimerWheel::TimerWheel(TimeConverter* tick, HandlerBase* handler, int priority) :
+    sim(Simulation_impl::getSimulation()),
+    handler(handler),
+    factor(tick->getFactor()),
+    priority(priority),
+    now(0),
+    count(0),
+    free_list(NIL)
+{
+    std::fill(heads, heads + DUE_LIST + 1, NIL);
+    std::fill(tails, tails + DUE_LIST + 1, NIL);
+    std::fill(&occupied[0][0], &occupied[0][0] + LEVELS * SLOTS / 64, 0);
+}
+
+TimerWheel::~TimerWheel()
+{
+    // The TimeVortex still owns the wake ups
+    for ( WakeUp* wakeup : wakeups )
+        wakeup->wheel = nullptr;
+    delete handler;
+}
+
+TimerWheel::TimerId
+TimerWheel::schedule(SimTime_t delay, uint64_t data)
+{
+    SimTime_t current = sim->getCurrentSimCycle();
+    SimTime_t tick    = current / factor;
+
+    // With nothing pending the wheel doesn't need to have followed the
+    // simulation, so move it up to avoid placing timers high up
+    if ( count == 0 ) now = tick;
+
+    SimTime_t when;
+    if ( delay >= (MAX_SIMTIME_T - current) / factor ) { when = MAX_SIMTIME_T / factor; }
+    else {
+        when = std::max(tick + delay + (current % factor != 0), tick + 1);
+    }
+
+    uint32_t index;
+    if ( free_list != NIL ) {
+        index     = free_list;
+        free_list = nodes[index].next;
+    }
+    else {
+        index = nodes.size();
+        nodes.push_back(Node { 0, 0, NIL, NIL, NIL, 0 });
+    }
+
+    Node& node = nodes[index];
+    node.when  = when;
+    node.data  = data;
+    place(index);
+    count++;
+
+    wakeAt(when);
+    return (static_cast<TimerId>(node.generation) << 32) | (index + 1);
+}
+
+bool
+TimerWheel::cancel(TimerId id)
+{
+    uint32_t index = static_cast<uint32_t>(id) - 1;
+    if ( id == INVALID_TIMER || index >= nodes.size() ) return false;
+
+    Node& node = nodes[index];
+    if ( node.list == NIL || node.generation != static_cast<uint32_t>(id >> 32) ) return false;
+
+    // A wake up for the timer is left in the TimeVortex, it just
+    // won't find anything to do
+    unlink(index);
+    release(index);
+    count--;
+    return true;
+}
+
+void
+TimerWheel::place(uint32_t index)
+{
+    SimTime_t when = nodes[index].when;
+    if ( when == now ) {
+        link(index, DUE_LIST);
+        return;
+    }
+    int      level = levelOf(when ^ now);
+    uint32_t slot  = (when >> (8 * level)) & (SLOTS - 1);
+    link(index, level * SLOTS + slot);
+}
+
+void
+TimerWheel::link(uint32_t index, uint32_t list)
+{
+    Node& node = nodes[index];
+    node.list  = list;
+    node.prev  = tails[list];
+    node.next  = NIL;
+    if ( tails[list] == NIL ) {
+        heads[list] = index;
+        if ( list != DUE_LIST ) occupied[list / SLOTS][(list % SLOTS) / 64] |= 1ull << (list % 64);
+    }
+    else {
+        nodes[tails[list]].next = index;
+    }
+    tails[list] = index;
+}
+
+void
+TimerWheel::unlink(uint32_t index)
+{
+    Node&    node = nodes[index];
+    uint32_t list = node.list;
+
+    if ( node.prev == NIL ) { heads[list] = node.next; }
+    else {
+        nodes[node.prev].next = node.next;
+    }
+    if ( node.next == NIL ) { tails[list] = node.prev; }
+    else {
+        nodes[node.next].prev = node.prev;
+    }
+
+    if ( heads[list] == NIL && list != DUE_LIST ) {
+        occupied[list / SLOTS][(list % SLOTS) / 64] &= ~(1ull << (list % 64));
+    }
+}
+
+void
+TimerWheel::release(uint32_t index)
+{
+    Node& node = nodes[index];
+    node.list  = NIL;
+    node.generation++;
+    node.next = free_list;
+    free_list = index;
+}
+
+void
+TimerWheel::advance(SimTime_t tick)
+{
+    // Nothing is pending before tick, so all the levels below the
+    // highest one that changes are empty, and at that level only the
+    // slot of tick has timers that now belong further down
+    int      level = levelOf(tick ^ now);
+    uint32_t list  = level * SLOTS + ((tick >> (8 * level)) & (SLOTS - 1));
+    now            = tick;
+
+    uint32_t index = heads[list];
+    heads[list]    = NIL;
+    tails[list]    = NIL;
+    occupied[level][(list % SLOTS) / 64] &= ~(1ull << (list % 64));
+
+    while ( index != NIL ) {
+        uint32_t next = nodes[index].next;
+        place(index);
+        index = next;
+    }
+
+    // The handlers can schedule and cancel timers, including the ones
+    // still waiting to be fired here
+    while ( heads[DUE_LIST] != NIL ) {
+        index         = heads[DUE_LIST];
+        uint64_t data = nodes[index].data;
+        unlink(index);
+        release(index);
+        count--;
+        (*handler)(data);
+    }
+}
+
+void
+TimerWheel::wakeUp(WakeUp* wakeup)
+{
+    // Wake ups are delivered in time order and there is at most one
+    // per tick, so this is the first in the heap
+    std::pop_heap(wakeups.begin(), wakeups.end(), laterWakeUp);
+    wakeups.pop_back();
+
+    if ( wakeup->tick > now && count > 0 ) advance(wakeup->tick);
+    if ( count > 0 ) wakeAt(nextTick());
+}
+
+SimTime_t
+TimerWheel::nextTick() const
+{
+    for ( int level = 0; level < LEVELS; level++ ) {
+        for ( int word = 0; word < SLOTS / 64; word++ ) {
+            if ( occupied[level][word] == 0 ) continue;
+
+            // Only the higher bytes of the tick are known, which is
+            // early enough to move the slot down the wheel
+            SimTime_t slot  = word * 64 + __builtin_ctzll(occupied[level][word]);
+            int       shift = 8 * (level + 1);
+            SimTime_t upper = shift < 64 ? (now >> shift) << shift : 0;
+            return upper | (slot << (8 * level));
+        }
+    }
+    return MAX_SIMTIME_T;
+}
+
+void
+TimerWheel::wakeAt(SimTime_t tick)
+{
+    if ( !wakeups.empty() && wakeups.front()->tick <= tick ) return;
+    // Past the end of simulated time
+    if ( tick > MAX_SIMTIME_T / factor - 1 ) return;
+
+    WakeUp* wakeup = new WakeUp(this, tick);
+    wakeup->setDeliveryTime(tick * factor);
+    wakeups.push_back(wakeup);
+    std::push_heap(wakeups.begin(), wakeups.end(), laterWakeUp);
+    sim->insertActivity(tick * factor, wakeup);
+}
+
+TimerWheel::WakeUp::WakeUp(TimerWheel* wheel, SimTime_t tick) : Action(), wheel(wheel), tick(tick)
+{
+    setPriority(wheel->priority);
+}
+
+void
+TimerWheel::WakeUp::execute(void)
+{
+    if ( wheel ) wheel->wakeUp(this);
+    delete this;
+}
+
+std::string
+TimerWheel::WakeUp::toString() const
+{
+    std::stringstream buf;
+    buf << "TimerWheel WakeUp Activity for tick " << tick << " to be delivered at " << getDeliveryTime()
+        << " with priority " << getPriority() << (wheel ? "" : " (cancelled)");
+    return buf.str();
+}
+
+} // namespace SST
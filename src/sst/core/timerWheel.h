@@ -0,0 +1,179 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_TIMERWHEEL_H
+#define SST_CORE_TIMERWHEEL_H
+
+#include "sst/core/action.h"
+#include "sst/core/sst_types.h"
+#include "sst/core/ssthandler.h"
+
+#include <cinttypes>
+#include <vector>
+
+namespace SST {
+
+class Simulation_impl;
+class TimeConverter;
+
+/**
+ * Hierarchical timer wheel for components that schedule and cancel
+ * large numbers of timeouts, such as retransmit timers.
+ *
+ * Scheduling and cancelling a timer take constant time and allocate
+ * nothing once the wheel has grown to its working size.  Rather than
+ * each timer being its own TimeVortex entry, the wheel keeps a single
+ * wake up scheduled at the tick of its earliest timer, and timers that
+ * are further out are moved down the wheel as that tick gets closer.
+ *
+ * All the timers of a wheel call the same handler, with the data given
+ * when the timer was scheduled.  The wheel must only be used from the
+ * thread that created it.  Wheels are not saved in checkpoints or
+ * snapshots.
+ */
+class TimerWheel
+{
+public:
+    /**
+       Base handler for timer callbacks.
+     */
+    using HandlerBase = SSTHandlerBase<void, uint64_t>;
+
+    /**
+       Used to create handlers for the timers.  The callback function
+       is expected to be in the form of:
+
+         void func(uint64_t data)
+
+       In which case, the class is created with:
+
+         new TimerWheel::Handler<classname>(this, &classname::function_name)
+
+       Static data is added as for Event::Handler.
+     */
+    template <typename classT, typename dataT = void>
+    using Handler = SSTHandler<void, uint64_t, classT, dataT>;
+
+    /**
+       Used to create timer handlers when the callback function is
+       known at compile time.
+     */
+    template <typename classT, auto funcT, typename dataT = void>
+    using Handler2 = SSTHandler2<void, uint64_t, classT, dataT, funcT>;
+
+    /** Identifies a scheduled timer.  Ids are not reused while the
+     * timer is pending, so a stale id can safely be cancelled. */
+    typedef uint64_t TimerId;
+
+    static const TimerId INVALID_TIMER = 0;
+
+    /**
+       Create a timer wheel
+       @param tick Length of one tick of the wheel.  Timers fire on tick boundaries.
+       @param handler Handler called for each timer.  Owned by the wheel.
+       @param priority Priority of the wheel's TimeVortex entries
+     */
+    TimerWheel(TimeConverter* tick, HandlerBase* handler, int priority = ONESHOTPRIORITY);
+    ~TimerWheel();
+
+    /**
+       Schedule a timer
+       @param delay Number of ticks from now.  The timer fires on the
+       first tick boundary at least delay ticks away, and never in the
+       current tick.
+       @param data Passed to the handler
+       @return Id used to cancel the timer
+     */
+    TimerId schedule(SimTime_t delay, uint64_t data = 0);
+
+    /**
+       Cancel a timer
+       @return true if the timer was pending, false if it already fired
+       or was cancelled
+     */
+    bool cancel(TimerId id);
+
+    /** Number of pending timers */
+    size_t size() const { return count; }
+
+    /** Whether any timers are pending */
+    bool empty() const { return count == 0; }
+
+private:
+    static const int      LEVEL_BITS = 8;
+    static const int      SLOTS      = 1 << LEVEL_BITS;
+    static const int      LEVELS     = 64 / LEVEL_BITS;
+    static const int      DUE_LIST   = LEVELS * SLOTS; // Timers being fired
+    static const uint32_t NIL        = UINT32_MAX;
+
+    /** Wake up of the wheel at a tick.  A wheel can have several
+     * pending at once, since an earlier timer can be scheduled after a
+     * wake up was inserted into the TimeVortex. */
+    class WakeUp : public Action
+    {
+    public:
+        WakeUp(TimerWheel* wheel, SimTime_t tick);
+
+        void        execute(void) override;
+        std::string toString() const override;
+
+        TimerWheel* wheel; // nullptr once the wheel was deleted
+        SimTime_t   tick;
+
+        NotSerializable(SST::TimerWheel::WakeUp)
+    };
+
+    struct Node
+    {
+        SimTime_t when;
+        uint64_t  data;
+        uint32_t  prev;
+        uint32_t  next;
+        uint32_t  list; // Slot the timer is in, NIL when free
+        uint32_t  generation;
+    };
+
+    /** Place a timer in the slot for its tick relative to now */
+    void place(uint32_t index);
+    void link(uint32_t index, uint32_t list);
+    void unlink(uint32_t index);
+    void release(uint32_t index);
+
+    /** Move the wheel to tick and fire the timers that are due */
+    void advance(SimTime_t tick);
+
+    /** Called by a WakeUp when it is delivered */
+    void wakeUp(WakeUp* wakeup);
+
+    /** Earliest tick the wheel needs to be woken up at */
+    SimTime_t nextTick() const;
+
+    /** Make sure a wake up is pending at or before tick */
+    void wakeAt(SimTime_t tick);
+
+    Simulation_impl* sim;
+    HandlerBase*     handler;
+    SimTime_t        factor;
+    int              priority;
+    SimTime_t        now; // Last tick the wheel was moved to
+    size_t           count;
+
+    std::vector<Node>    nodes;
+    uint32_t             free_list;
+    uint32_t             heads[DUE_LIST + 1];
+    uint32_t             tails[DUE_LIST + 1];
+    uint64_t             occupied[LEVELS][SLOTS / 64];
+    std::vector<WakeUp*> wakeups; // Min-heap of the pending wake ups
+};
+
+} // namespace SST
+
+#endif // SST_CORE_TIMERWHEEL_H
@@ -0,0 +1,105 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/topologyBuilder.h"
+
+#include "sst/core/configGraph.h"
+#include "sst/core/output.h"
+
+namespace SST {
+
+SST_ELI_DEFINE_INFO_EXTERN(TopologyBuilder)
+SST_ELI_DEFINE_CTOR_EXTERN(TopologyBuilder)
+
+RankInfo
+TopologyBuilder::getRank(uint64_t index, RankInfo world_size)
+{
+    // The first extra parts get one more component than the rest
+    uint64_t parts = (uint64_t)world_size.rank * world_size.thread;
+    uint64_t size  = getNumComponents() / parts;
+    uint64_t extra = getNumComponents() % parts;
+    uint64_t part;
+    if ( index < extra * (size + 1) ) { part = index / (size + 1); }
+    else {
+        part = extra + (index - extra * (size + 1)) / size;
+    }
+    return RankInfo(part / world_size.thread, part % world_size.thread);
+}
+
+uint64_t
+TopologyBuilder::populate(
+    ConfigGraph* graph, const std::string& prefix, bool parallel_load, RankInfo world_size, RankInfo my_rank)
+{
+    uint64_t                   num_comps = getNumComponents();
+    std::vector<ComponentId_t> ids(num_comps, UNSET_COMPONENT_ID);
+    std::vector<uint64_t>      local;
+
+    // All the components go in before any links, so links can be
+    // added from either end
+    ComponentDesc desc;
+    for ( uint64_t i = 0; i < num_comps; ++i ) {
+        RankInfo rank;
+        if ( parallel_load ) {
+            rank = getRank(i, world_size);
+            if ( rank.rank != my_rank.rank ) continue;
+        }
+
+        desc.name.clear();
+        desc.type.clear();
+        desc.params.clear();
+        getComponent(i, desc);
+
+        ids[i]              = graph->addComponent(prefix + desc.name, desc.type);
+        ConfigComponent* cc = graph->findComponent(ids[i]);
+        for ( auto& p : desc.params ) {
+            cc->addParameter(p.first, p.second, true);
+        }
+        if ( parallel_load ) cc->setRank(rank);
+        local.push_back(i);
+    }
+
+    std::vector<LinkDesc> links;
+    for ( auto i : local ) {
+        links.clear();
+        getLinks(i, links);
+        for ( auto& link : links ) {
+            if ( link.peer >= num_comps ) {
+                Output::getDefaultObject().fatal(
+                    CALL_INFO, 1, "ERROR: Topology link %s is to unknown component %" PRIu64 "\n", link.name.c_str(),
+                    link.peer);
+            }
+            graph->addLink(ids[i], prefix + link.name, link.port, link.latency);
+
+            if ( !parallel_load ) continue;
+            RankInfo peer_rank = getRank(link.peer, world_size);
+            if ( peer_rank.rank == my_rank.rank ) continue;
+
+            // The other end is on another rank, so it only gets a copy
+            // for the link to connect to, the same as the ghosts left
+            // when a graph is split.  Nothing else adds the copy's end
+            // of the link.
+            if ( ids[link.peer] == UNSET_COMPONENT_ID ) {
+                desc.name.clear();
+                desc.type.clear();
+                desc.params.clear();
+                getComponent(link.peer, desc);
+                ids[link.peer] = graph->addComponent(prefix + desc.name, desc.type);
+                graph->findComponent(ids[link.peer])->setRank(peer_rank);
+            }
+            graph->addLink(ids[link.peer], prefix + link.name, link.peer_port, link.latency);
+        }
+    }
+    return local.size();
+}
+
+} // namespace SST
@@ -0,0 +1,115 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_TOPOLOGYBUILDER_H
+#define SST_CORE_TOPOLOGYBUILDER_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/params.h"
+#include "sst/core/rankInfo.h"
+#include "sst/core/sst_types.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace SST {
+
+class ConfigGraph;
+
+/**
+ * Base class for generating regular topologies directly into the
+ * ConfigGraph, instead of through loops in the Python model.
+ *
+ * A builder describes the topology one component at a time.  The
+ * components are numbered from 0 to getNumComponents() - 1, and each
+ * one reports its own end of every link it has, so a component's
+ * links can be found without walking the rest of the topology.  That
+ * lets populate() build only the part of the graph a rank needs when
+ * the graph is loaded in parallel.
+ */
+class TopologyBuilder
+{
+public:
+    SST_ELI_DECLARE_BASE(TopologyBuilder)
+    SST_ELI_DECLARE_INFO_EXTERN(ELI::ProvidesParams)
+    SST_ELI_DECLARE_CTOR_EXTERN(SST::Params&)
+
+    /** Description of one component.  It is reused between calls to
+     * getComponent(), and cleared before each one. */
+    struct ComponentDesc
+    {
+        std::string                                      name;
+        std::string                                      type;
+        std::vector<std::pair<std::string, std::string>> params;
+    };
+
+    /** One end of a link */
+    struct LinkDesc
+    {
+        std::string name;      /*!< Name of the link, the same from both ends */
+        std::string port;      /*!< Port on this component */
+        uint64_t    peer;      /*!< Index of the component on the other end */
+        std::string peer_port; /*!< Port on the other component */
+        std::string latency;
+    };
+
+    TopologyBuilder() {}
+    virtual ~TopologyBuilder() {}
+
+    /** Number of components in the topology */
+    virtual uint64_t getNumComponents() = 0;
+
+    /** Describe a component
+     * @param index Index of the component
+     * @param desc Filled in with the name, type and parameters
+     */
+    virtual void getComponent(uint64_t index, ComponentDesc& desc) = 0;
+
+    /** Describe the links of a component.  Each link is reported by
+     * the components on both of its ends, once for each end.
+     * @param index Index of the component
+     * @param links Filled in with one entry per port that is connected
+     */
+    virtual void getLinks(uint64_t index, std::vector<LinkDesc>& links) = 0;
+
+    /** Rank and thread a component goes on when the graph is loaded in
+     * parallel.  The default gives each thread a contiguous block of
+     * component indices. */
+    virtual RankInfo getRank(uint64_t index, RankInfo world_size);
+
+    /** Add the topology to a graph.
+     *
+     * If the graph is loaded in parallel, only the components that go
+     * on my_rank are added, with their ranks set, along with a copy of
+     * each component on another rank that one of them has a link to.
+     * Otherwise every component is added and the partitioner places
+     * them.
+     *
+     * @param graph Graph to add to
+     * @param prefix Prepended to the component and link names
+     * @param parallel_load Whether the graph is loaded in parallel
+     * @param world_size Number of ranks and threads
+     * @param my_rank Rank the graph is being loaded on
+     * @return Number of components added, not counting the copies
+     */
+    uint64_t populate(
+        ConfigGraph* graph, const std::string& prefix, bool parallel_load, RankInfo world_size, RankInfo my_rank);
+};
+
+} // namespace SST
+
+#ifndef SST_ELI_REGISTER_TOPOLOGY_BUILDER
+#define SST_ELI_REGISTER_TOPOLOGY_BUILDER(cls, lib, name, version, desc) \
+    SST_ELI_REGISTER_DERIVED(SST::TopologyBuilder,cls,lib,name,ELI_FORWARD_AS_ONE(version),desc)
+#endif
+
+#endif // SST_CORE_TOPOLOGYBUILDER_H
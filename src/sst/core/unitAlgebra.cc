@@ -58,6 +58,7 @@ std::recursive_mutex                  Units::unit_lock;
 map<string, Units::unit_id_t>         Units::valid_base_units;
 map<string, pair<Units, sst_big_num>> Units::valid_compound_units;
 map<Units::unit_id_t, string>         Units::unit_strings;
+map<string, pair<Units, sst_big_num>> Units::parse_cache;
 Units::unit_id_t                      Units::count;
 bool                                  Units::initialized = Units::initialize();
 
@@ -184,6 +185,8 @@ Units::registerBaseUnit(const std::string& u)
 {
     std::lock_guard<std::recursive_mutex> lock(unit_lock);
     if ( valid_base_units.find(u) != valid_base_units.end() ) return;
+    // A new unit can change how a string with an SI prefix parses
+    parse_cache.clear();
     valid_base_units[u] = count;
     unit_strings[count] = u;
     count++;
@@ -195,6 +198,7 @@ Units::registerCompoundUnit(const std::string& u, const std::string& v)
 {
     std::lock_guard<std::recursive_mutex> lock(unit_lock);
     if ( valid_compound_units.find(u) != valid_compound_units.end() ) return;
+    parse_cache.clear();
     sst_big_num multiplier = 1;
     Units       unit(v, multiplier);
     valid_compound_units[u] = std::pair<Units, sst_big_num>(unit, multiplier);
@@ -337,6 +341,18 @@ UnitAlgebra::trim(const std::string& str)
 void
 UnitAlgebra::init(const std::string& val)
 {
+    // The same few strings are parsed over and over while the
+    // simulation is built, so reuse the result of an earlier parse
+    {
+        std::lock_guard<std::recursive_mutex> lock(Units::unit_lock);
+        auto                                  cached = Units::parse_cache.find(val);
+        if ( cached != Units::parse_cache.end() ) {
+            unit  = cached->second.first;
+            value = cached->second.second;
+            return;
+        }
+    }
+
     // Trim off all whitespace on front and back
     const string parse = trim(val);
 
@@ -364,6 +380,9 @@ UnitAlgebra::init(const std::string& val)
     }
 
     value *= multiplier;
+
+    std::lock_guard<std::recursive_mutex> lock(Units::unit_lock);
+    Units::parse_cache.emplace(val, std::make_pair(unit, value));
 }
 
 UnitAlgebra::UnitAlgebra(const std::string& val)
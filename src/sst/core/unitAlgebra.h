@@ -50,6 +50,8 @@ private:
     static std::map<unit_id_t, std::string>                     unit_strings;
     static unit_id_t                                            count;
     static bool                                                 initialized;
+    // Units and value of every string UnitAlgebra has parsed
+    static std::map<std::string, std::pair<Units, sst_big_num>> parse_cache;
 
     static bool initialize();
 
@@ -396,6 +398,57 @@ operator<<(std::ostream& os, const UnitAlgebra& r)
     return os;
 }
 
+/**
+   User-defined literals for common units, so a component can write
+   2_GHz instead of UnitAlgebra("2GHz").  The units of each suffix are
+   parsed only the first time it is used.  Use with
+   using namespace SST::UnitAlgebraLiterals;
+*/
+namespace UnitAlgebraLiterals {
+
+#define SST_UNITALGEBRA_LITERAL(units)                                     \
+    inline UnitAlgebra operator""_##units(unsigned long long v)            \
+    {                                                                      \
+        static const UnitAlgebra base("1" #units);                         \
+        return base * v;                                                   \
+    }                                                                      \
+    inline UnitAlgebra operator""_##units(const char* v)                   \
+    {                                                                      \
+        static const UnitAlgebra base("1" #units);                         \
+        return base * sst_big_num(std::string(v));                         \
+    }
+
+SST_UNITALGEBRA_LITERAL(s)
+SST_UNITALGEBRA_LITERAL(ms)
+SST_UNITALGEBRA_LITERAL(us)
+SST_UNITALGEBRA_LITERAL(ns)
+SST_UNITALGEBRA_LITERAL(ps)
+SST_UNITALGEBRA_LITERAL(fs)
+SST_UNITALGEBRA_LITERAL(Hz)
+SST_UNITALGEBRA_LITERAL(kHz)
+SST_UNITALGEBRA_LITERAL(MHz)
+SST_UNITALGEBRA_LITERAL(GHz)
+SST_UNITALGEBRA_LITERAL(THz)
+SST_UNITALGEBRA_LITERAL(B)
+SST_UNITALGEBRA_LITERAL(KB)
+SST_UNITALGEBRA_LITERAL(MB)
+SST_UNITALGEBRA_LITERAL(GB)
+SST_UNITALGEBRA_LITERAL(KiB)
+SST_UNITALGEBRA_LITERAL(MiB)
+SST_UNITALGEBRA_LITERAL(GiB)
+SST_UNITALGEBRA_LITERAL(Bps)
+SST_UNITALGEBRA_LITERAL(KBps)
+SST_UNITALGEBRA_LITERAL(MBps)
+SST_UNITALGEBRA_LITERAL(GBps)
+SST_UNITALGEBRA_LITERAL(bps)
+SST_UNITALGEBRA_LITERAL(Kbps)
+SST_UNITALGEBRA_LITERAL(Mbps)
+SST_UNITALGEBRA_LITERAL(Gbps)
+
+#undef SST_UNITALGEBRA_LITERAL
+
+} // namespace UnitAlgebraLiterals
+
 inline std::ostream&
 operator<<(std::ostream& os, const Units& r)
 {
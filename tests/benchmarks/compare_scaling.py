@@ -0,0 +1,80 @@
+#!/usr/bin/env python3
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+"""Compare two results files from run_scaling.py.
+
+Prints the change in each metric for every configuration found in both
+files, and exits with 1 if any got worse by more than the threshold.
+"""
+
+import argparse
+import json
+import sys
+
+# Metrics compared, and whether a larger value is better
+METRICS = [
+    ("events_per_sec", True),
+    ("run_time", False),
+    ("build_time", False),
+    ("sync_time", False),
+    ("max_rss", False),
+]
+
+
+def key(config):
+    return tuple(sorted(config.items(), key=lambda kv: kv[0]))
+
+
+def load(path):
+    with open(path) as fp:
+        return {key(r["config"]): r["summary"] for r in json.load(fp)["results"]}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("baseline", help="results to compare against")
+    parser.add_argument("current", help="new results")
+    parser.add_argument("--threshold", type=float, default=5.0, help="percent change counted as a regression")
+    parser.add_argument("--metrics", default=",".join(m for m, _ in METRICS), help="metrics to compare")
+    args = parser.parse_args()
+
+    baseline = load(args.baseline)
+    current = load(args.current)
+    metrics = [(m, higher) for m, higher in METRICS if m in args.metrics.split(",")]
+
+    regressions = 0
+    print("%-50s %-16s %14s %14s %9s" % ("config", "metric", "baseline", "current", "change"))
+    for config in sorted(set(baseline) & set(current), key=str):
+        name = " ".join("%s=%s" % (k, v) for k, v in config if v is not None)
+        for metric, higher in metrics:
+            old = baseline[config].get(metric)
+            new = current[config].get(metric)
+            if not old or new is None:
+                continue
+            change = 100.0 * (new - old) / old
+            worse = -change if higher else change
+            flag = ""
+            if worse > args.threshold:
+                flag = " REGRESSION"
+                regressions += 1
+            print("%-50s %-16s %14.6g %14.6g %+8.1f%%%s" % (name, metric, old, new, change, flag))
+
+    for config in sorted(set(baseline) ^ set(current), key=str):
+        where = args.baseline if config in baseline else args.current
+        print("only in %s: %s" % (where, " ".join("%s=%s" % kv for kv in config)))
+
+    if regressions:
+        print("%d regressions over %.1f%%" % (regressions, args.threshold))
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,205 @@
+#!/usr/bin/env python3
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+"""Run strong and weak scaling sweeps of the core.
+
+Runs scaling_model.py over each combination of the sizes, latencies,
+communication frequencies, ranks and threads given, and writes the
+timing, event and sync results of each run to a JSON file that can be
+compared with compare_scaling.py.
+
+Strong scaling keeps each size fixed while the ranks and threads grow.
+With --weak, each size is instead the size per partition, and the x
+dimension grows with the number of partitions.
+"""
+
+import argparse
+import datetime
+import itertools
+import json
+import os
+import platform
+import re
+import shlex
+import statistics
+import subprocess
+import sys
+
+MODEL = os.path.join(os.path.dirname(os.path.abspath(__file__)), "scaling_model.py")
+
+SI_PREFIX = {"": 1, "k": 1e3, "K": 1e3, "M": 1e6, "G": 1e9, "T": 1e12, "P": 1e15}
+
+TIMES = {
+    "build_time": re.compile(r"^\s*Build time:\s+([\d.]+) seconds", re.M),
+    "run_time": re.compile(r"^\s*Run loop time:\s+([\d.]+) seconds", re.M),
+    "total_time": re.compile(r"^\s*Total time:\s+([\d.]+) seconds", re.M),
+}
+
+SIZES = {
+    "max_rss": re.compile(r"^\s*Max Resident Set Size:\s+([\d.]+) (\w?)B", re.M),
+    "global_rss": re.compile(r"^\s*Approx. Global Max RSS Size:\s+([\d.]+) (\w?)B", re.M),
+    "max_sync_data": re.compile(r"^\s*Max Sync data size:\s+([\d.]+) (\w?)B", re.M),
+    "global_sync_data": re.compile(r"^\s*Global Sync data size:\s+([\d.]+) (\w?)B", re.M),
+}
+
+PARTITION = re.compile(r"^\s*(\d+)\s+(\d+)\s+(\d+)\s+([\d.]+)\s+([\d.]+)\s+([\d.]+)\s*$", re.M)
+SYNC_COUNT = re.compile(r"^\s*SyncManager Count = (\d+)", re.M)
+SYNC_TIME = re.compile(r"^\s*Total SyncManager Time = ([\d.]+)s", re.M)
+PHASE = re.compile(r"^\s+(\S+)\s+Count = (\d+), Total Time = ([\d.]+)s", re.M)
+
+
+def parse_list(text, kind=str):
+    return [kind(x) for x in text.split(",") if x]
+
+
+def parse_size(text):
+    x, _, y = text.partition("x")
+    return (int(x), int(y or x))
+
+
+def parse_output(text):
+    """Pull the results of one run out of the output of sst"""
+    result = {}
+    for key, regex in TIMES.items():
+        m = regex.search(text)
+        if m:
+            result[key] = float(m.group(1))
+    for key, regex in SIZES.items():
+        m = regex.search(text)
+        if m:
+            result[key] = int(float(m.group(1)) * SI_PREFIX.get(m.group(2), 1))
+
+    # One row per partition from --print-imbalance-info
+    partitions = [
+        {"rank": int(m.group(1)), "thread": int(m.group(2)), "events": int(m.group(3)),
+         "busy": float(m.group(4)), "sync": float(m.group(5)), "end_wait": float(m.group(6))}
+        for m in PARTITION.finditer(text)
+    ]
+    if partitions:
+        result["partitions"] = partitions
+        result["events"] = sum(p["events"] for p in partitions)
+        result["max_busy"] = max(p["busy"] for p in partitions)
+        result["max_sync"] = max(p["sync"] for p in partitions)
+    if result.get("run_time") and "events" in result:
+        result["events_per_sec"] = result["events"] / result["run_time"]
+
+    # Every partition does every sync, so the counts are the same and
+    # the times are summed over all of them
+    counts = [int(c) for c in SYNC_COUNT.findall(text)]
+    if counts:
+        result["sync_count"] = max(counts)
+        result["sync_time"] = sum(float(t) for t in SYNC_TIME.findall(text))
+        phases = {}
+        for m in PHASE.finditer(text):
+            phase = phases.setdefault(m.group(1), {"count": 0, "time": 0.0})
+            phase["count"] += int(m.group(2))
+            phase["time"] += float(m.group(3))
+        result["phases"] = phases
+    return result
+
+
+def median(runs, key):
+    values = [r[key] for r in runs if key in r]
+    return statistics.median(values) if values else None
+
+
+def run_config(args, config):
+    cmd = []
+    if config["ranks"] > 1:
+        cmd += shlex.split(args.mpirun.format(ranks=config["ranks"]))
+    cmd += shlex.split(args.sst)
+    cmd += ["--print-timing-info", "--print-imbalance-info", "-n", str(config["threads"])]
+    # The sync profiler only has something to report with more than
+    # one partition
+    if config["ranks"] * config["threads"] > 1:
+        cmd += ["--enable-profiling=sync:sst.profile.sync.time.high_resolution(level=global)[sync]"]
+    options = [
+        "--model", config["model"], "--x", config["x"], "--y", config["y"], "--latency", config["latency"],
+        "--comm-freq", config["comm_freq"], "--work", args.work, "--stop-at", args.stop_at
+    ]
+    cmd += ["--model-options", " ".join(str(o) for o in options), MODEL]
+
+    if args.verbose:
+        print(" ".join(shlex.quote(c) for c in cmd), file=sys.stderr)
+    try:
+        proc = subprocess.run(cmd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True,
+                              timeout=args.timeout)
+    except subprocess.TimeoutExpired:
+        return {"error": "timeout"}
+    if proc.returncode != 0:
+        return {"error": "exit code %d" % proc.returncode, "output": proc.stdout[-4096:]}
+    return parse_output(proc.stdout)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--sst", default="sst", help="command used to run sst")
+    parser.add_argument("--mpirun", default="mpirun -np {ranks}",
+                        help="command used to launch multi-rank runs, {ranks} is replaced by the rank count")
+    parser.add_argument("--models", default="mesh,perf", help="models to run, from mesh and perf")
+    parser.add_argument("--sizes", default="4x4,8x8,16x16", help="mesh sizes, as XxY")
+    parser.add_argument("--latencies", default="1ns", help="link latencies")
+    parser.add_argument("--comm-freqs", default="100",
+                        help="perf model only, each component sends on 1 in N cycles")
+    parser.add_argument("--ranks", default="1", help="rank counts")
+    parser.add_argument("--threads", default="1,2,4", help="thread counts")
+    parser.add_argument("--weak", action="store_true", help="grow the x dimension with the number of partitions")
+    parser.add_argument("--work", type=int, default=0, help="perf model only, work done each cycle")
+    parser.add_argument("--stop-at", default="10us", help="simulated time of each run")
+    parser.add_argument("--repeat", type=int, default=3, help="runs of each configuration")
+    parser.add_argument("--timeout", type=float, default=None, help="seconds allowed for each run")
+    parser.add_argument("-o", "--output", default="scaling.json", help="results file")
+    parser.add_argument("-v", "--verbose", action="store_true", help="print each command")
+    args = parser.parse_args()
+
+    configs = []
+    for model, size, latency, comm_freq, ranks, threads in itertools.product(
+            parse_list(args.models), parse_list(args.sizes, parse_size), parse_list(args.latencies),
+            parse_list(args.comm_freqs, int), parse_list(args.ranks, int), parse_list(args.threads, int)):
+        # Only the perf model uses the communication frequency
+        if model == "mesh" and comm_freq != parse_list(args.comm_freqs, int)[0]:
+            continue
+        x, y = size
+        if args.weak:
+            x *= ranks * threads
+        configs.append({"model": model, "x": x, "y": y, "latency": latency,
+                        "comm_freq": comm_freq if model == "perf" else None,
+                        "ranks": ranks, "threads": threads})
+
+    results = []
+    for n, config in enumerate(configs):
+        print("[%d/%d] %s" % (n + 1, len(configs), " ".join("%s=%s" % kv for kv in config.items())), file=sys.stderr)
+        runs = [run_config(args, config) for _ in range(args.repeat)]
+        good = [r for r in runs if "error" not in r]
+        summary = {key: median(good, key) for key in
+                   ["build_time", "run_time", "total_time", "events", "events_per_sec", "max_rss", "global_rss",
+                    "max_sync_data", "global_sync_data", "max_busy", "max_sync", "sync_count", "sync_time"]}
+        results.append({"config": config, "summary": summary, "runs": runs})
+        if len(good) < len(runs):
+            print("  %d of %d runs failed" % (len(runs) - len(good), len(runs)), file=sys.stderr)
+        elif summary["events_per_sec"]:
+            print("  %.0f events/s, run loop %.3fs" % (summary["events_per_sec"], summary["run_time"]),
+                  file=sys.stderr)
+
+    with open(args.output, "w") as fp:
+        json.dump({
+            "date": datetime.datetime.now().isoformat(),
+            "host": platform.node(),
+            "sst": args.sst,
+            "weak": args.weak,
+            "stop_at": args.stop_at,
+            "work": args.work,
+            "results": results
+        }, fp, indent=2)
+
+
+if __name__ == "__main__":
+    main()
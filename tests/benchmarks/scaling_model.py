@@ -0,0 +1,76 @@
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import argparse
+import sys
+
+import sst
+
+# Model used by run_scaling.py.  Builds an x by y torus of either
+# message_mesh components, which keep a fixed number of messages
+# moving around the mesh, or PerfComponents, which each send an event
+# to a neighbor on 1 in comm-freq cycles of a 1GHz clock.  Options are
+# passed with --model-options.
+parser = argparse.ArgumentParser(prog="scaling_model.py")
+parser.add_argument("--model", choices=["mesh", "perf"], default="mesh")
+parser.add_argument("--x", type=int, default=8)
+parser.add_argument("--y", type=int, default=8)
+parser.add_argument("--latency", default="1ns")
+parser.add_argument("--comm-freq", type=int, default=100)
+parser.add_argument("--comm-size", type=int, default=100)
+parser.add_argument("--work", type=int, default=0)
+parser.add_argument("--stop-at", default="10us")
+args = parser.parse_args(sys.argv[1:])
+
+sst.setProgramOption("stop-at", args.stop_at)
+
+links = dict()
+def getLink(leftName, rightName):
+    name = "link_%s_%s"%(leftName, rightName)
+    if name not in links:
+        links[name] = sst.Link(name)
+    return links[name]
+
+def neighbors(my_x, my_y):
+    # Links in the positive and negative directions of each dimension
+    xp = (my_x + 1) % args.x
+    xn = (my_x - 1) % args.x
+    yp = (my_y + 1) % args.y
+    yn = (my_y - 1) % args.y
+    return [getLink("x%dy%d"%(my_x,my_y), "x%dy%d"%(xp,my_y)),
+            getLink("x%dy%d"%(xn,my_y), "x%dy%d"%(my_x,my_y)),
+            getLink("x%dy%d"%(my_x,my_y), "x%dy%d"%(my_x,yp)),
+            getLink("x%dy%d"%(my_x,yn), "x%dy%d"%(my_x,my_y))]
+
+for i in range(args.x * args.y):
+    my_x = i % args.x
+    my_y = i // args.x
+    xp, xn, yp, yn = neighbors(my_x, my_y)
+
+    if args.model == "mesh":
+        comp = sst.Component("component%d"%i, "coreTestElement.message_mesh.enclosing_component")
+        comp.addParam("id", i)
+        comp.setCoordinates(my_x, my_y)
+        comp.setSubComponent("route", "coreTestElement.message_mesh.route_message")
+        for slot, link in enumerate([xp, xn, yp, yn]):
+            port = comp.setSubComponent("ports", "coreTestElement.message_mesh.message_port", slot)
+            port.addLink(link, "port", args.latency)
+    else:
+        comp = sst.Component("c%d_%d"%(my_x,my_y), "coreTestElement.coreTestPerfComponent")
+        comp.addParams({
+            "workPerCycle" : args.work,
+            "commSize" : args.comm_size,
+            "commFreq" : args.comm_freq
+        })
+        comp.setCoordinates(my_x, my_y)
+        comp.addLink(xp, "Elink", args.latency)
+        comp.addLink(xn, "Wlink", args.latency)
+        comp.addLink(yp, "Nlink", args.latency)
+        comp.addLink(yn, "Slink", args.latency)
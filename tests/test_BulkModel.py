@@ -0,0 +1,41 @@
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+from array import array
+
+# Define SST core options
+sst.setProgramOption("stop-at", "10000s")
+
+# Create the components in bulk, all with the same parameters
+sst.pushNamePrefix("bulk")
+gens = sst.createComponents("coreTestElement.coreTestMessageGeneratorComponent",
+                            [ "gen%d"%i for i in range(6) ],
+                            { "outputinfo" : 0, "sendcount" : 10, "clock" : "1MHz" })
+sst.popNamePrefix()
+
+print("Created %d components, first is %s of type %s"%(len(gens), gens[0].getFullName(), gens[0].getType()))
+print("Found by name: %s"%sst.findComponentByName("bulk.gen5").getFullName())
+
+# Components can still be changed individually
+gens[1].addParam("clock", "2MHz")
+
+# Connect the components in pairs: by Component object, by id array
+# and by a list of ids, with latencies given per link or shared
+sst.connectLinks([ "link0" ], [ gens[0] ], "remoteComponent", [ gens[1] ], "remoteComponent", "10ns")
+
+ids = array('Q', [ gens[i].getID() for i in range(6) ])
+sst.connectLinks([ "link1", "link2" ], ids[2:6:2], [ "remoteComponent", "remoteComponent" ],
+                 [ ids[3], ids[5] ], "remoteComponent", [ "20ns", "30ns" ])
+
+try:
+    sst.connectLinks([ "bad0", "bad1" ], [ gens[0] ], "remoteComponent", [ gens[1] ], "remoteComponent", "1ns")
+except ValueError as e:
+    print("Caught error: %s"%e)
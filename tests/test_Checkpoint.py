@@ -0,0 +1,45 @@
+# -*- coding: utf-8 -*-
+#
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+
+# Torus of coreTestComponents.  The components, their random number
+# generators, the events on the links and the statistics all have to
+# be checkpointed for a restart to match a straight run.  The first
+# row only ticks at the end of the simulation, so its state does not
+# change between checkpoints.
+size = 4
+
+sst.setProgramOption("stop-at", "20us")
+
+comps = {}
+for x in range(size):
+    for y in range(size):
+        comp = sst.Component("c{0}_{1}".format(x, y), "coreTestElement.coreTestComponent")
+        comp.addParams({
+            "workPerCycle" : "10",
+            "commSize" : "10",
+            "commFreq" : "50"
+        })
+        if y == 0: comp.addParam("clockFrequency", "50kHz")
+        comps[(x, y)] = comp
+
+for x in range(size):
+    for y in range(size):
+        east = sst.Link("link_e_{0}_{1}".format(x, y))
+        east.connect( (comps[(x, y)], "Elink", "10ns"), (comps[((x + 1) % size, y)], "Wlink", "10ns") )
+        north = sst.Link("link_n_{0}_{1}".format(x, y))
+        north.connect( (comps[(x, y)], "Nlink", "10ns"), (comps[(x, (y + 1) % size)], "Slink", "10ns") )
+
+sst.setStatisticLoadLevel(7)
+sst.setStatisticOutput("sst.statOutputConsole")
+sst.enableAllStatisticsForAllComponents({"type":"sst.AccumulatorStatistic"})
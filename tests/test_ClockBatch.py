@@ -0,0 +1,26 @@
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+
+# Define SST core options
+sst.setProgramOption("stop-at", "100ns")
+
+# The batched counters share one clock handler per clock, and must end
+# up with the same counts as the ones with their own handlers
+for i in range(8):
+    clock = "1GHz" if i < 6 else "2GHz"
+    for mode in [ "batched", "single" ]:
+        comp = sst.Component("{0}{1}".format(mode, i), "coreTestElement.coreTestClockBatchComponent")
+        comp.addParams({
+            "clock" : clock,
+            "step" : i + 1,
+            "batched" : mode == "batched"
+        })
@@ -0,0 +1,23 @@
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+
+# Define SST core options
+sst.setProgramOption("stop-at", "200ns")
+
+# The 7 ns clock only has a handler that skips ahead, so it should
+# only fire every third cycle until the handler removes itself
+comp_clocker0 = sst.Component("clocker0", "coreTestElement.coreTestClockerComponent")
+comp_clocker0.addParams({
+      "clockcount" : "1000",
+      "clock" : "1GHz",
+      "skipinterval" : "3"
+})
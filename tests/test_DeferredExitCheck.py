@@ -0,0 +1,43 @@
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+
+# The simulation ends when the primary components are done, so the end
+# time and the statistics depend on the sync where the end is detected.
+# The periodic statistic output keeps running until the very end.
+sst.setStatisticLoadLevel(7)
+sst.setStatisticOutput("sst.statOutputConsole")
+
+# Message generators linked across ranks, which are done once they
+# have received all of their messages
+msgGen = []
+for i in range(2):
+    comp = sst.Component("msgGen%d"%i, "coreTestElement.simpleMessageGeneratorComponent")
+    comp.addParams({
+        "outputinfo" : "0",
+        "sendcount" : "1000",
+        "clock" : "1MHz"
+    })
+    msgGen.append(comp)
+
+link = sst.Link("link_msgGen")
+link.connect( (msgGen[0], "remoteComponent", "1us"), (msgGen[1], "remoteComponent", "1us") )
+
+# Statistics components that finish at different times on each rank
+for i in range(2):
+    comp = sst.Component("stats%d"%i, "coreTestElement.StatisticsComponent.int")
+    comp.addParams({
+        "rng" : "marsaglia",
+        "count" : 100 * (i + 1),
+        "seed_w" : 1447 + i,
+        "seed_z" : 1053 + i
+    })
+    comp.enableAllStatistics({ "type" : "sst.AccumulatorStatistic", "rate" : "7us" })
@@ -0,0 +1,41 @@
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+
+# Define SST core options
+sst.setProgramOption("stop-at", "10000s")
+sst.setProgramOption("direct-delivery", "true")
+
+# Zero latency links cannot cross a rank or thread boundary, so keep
+# both components together however many ranks the test runs with
+sst.setProgramOption("partitioner", "single")
+
+# Define the simulation components.  The generators run on different
+# clocks, so messages are received both while the other clock fires
+# and on their own
+comp_msgGen0 = sst.Component("msgGen0", "coreTestElement.coreTestMessageGeneratorComponent")
+comp_msgGen0.addParams({
+      "outputinfo" : "1",
+      "sendcount" : "20",
+      "clock" : "1MHz"
+})
+comp_msgGen1 = sst.Component("msgGen1", "coreTestElement.coreTestMessageGeneratorComponent")
+comp_msgGen1.addParams({
+      "outputinfo" : "1",
+      "sendcount" : "20",
+      "clock" : "2MHz"
+})
+
+
+# Define the simulation links.  With no latency, every message is
+# delivered at the time it is sent.
+link_s_0_1 = sst.Link("link_s_0_1")
+link_s_0_1.connect( (comp_msgGen0, "remoteComponent", "0ps"), (comp_msgGen1, "remoteComponent", "0ps") )
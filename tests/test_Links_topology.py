@@ -0,0 +1,17 @@
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+
+# Ring of coreTestLinks components built by a topology builder
+sst.buildTopology("coreTestElement.coreTestRing", {
+    "num_components" : 4,
+    "latency"        : "5 ns"
+})
@@ -36,6 +36,7 @@ for i in range(num_routers):
 
     comp = sst.Component("component%d"%i, "coreTestElement.message_mesh.enclosing_component")
     comp.addParam("id",i)
+    comp.setCoordinates(my_x, my_y)
     
     # Setup up all the ports.  X ports will use MessagePort directly, Y ports, will use the SlotPort
     port_x_pos = comp.setSubComponent("ports","coreTestElement.message_mesh.message_port",0);
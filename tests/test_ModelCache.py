@@ -0,0 +1,52 @@
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+import sys
+
+# Usage: test_ModelCache.py <ring size> <workPerCycle>
+ring_size = int(sys.argv[1])
+work_per_cycle = sys.argv[2]
+
+# The topology only depends on the ring size, so it is built with
+# sst.cacheGraph() and reused from the model cache when only the
+# parameters change
+def build(size):
+    sst.setProgramOption("stop-at", "25us")
+    comps = [sst.Component("c%d"%i, "coreTestElement.coreTestComponent") for i in range(size)]
+    for i in range(size):
+        comps[i].addParams({
+            "workPerCycle" : "1000",
+            "commSize" : "100",
+            "commFreq" : "1000"
+        })
+        link = sst.Link("link_%d"%i)
+        link.connect( (comps[i], "Elink", "10000ps"), (comps[(i + 1) % size], "Wlink", "10000ps") )
+        link = sst.Link("link_ns_%d"%i)
+        link.connect( (comps[i], "Nlink", "10000ps"), (comps[i], "Slink", "10000ps") )
+
+cached = sst.cacheGraph(build, ring_size)
+print("Graph loaded from the model cache: %s"%cached)
+
+# Parameter overrides run every time
+for i in range(ring_size):
+    sst.findComponentByName("c%d"%i).addParam("workPerCycle", work_per_cycle)
+
+# So do components added after the cached part of the graph
+extra = sst.Component("extra", "coreTestElement.coreTestComponent")
+extra.addParams({
+    "workPerCycle" : work_per_cycle,
+    "commSize" : "100",
+    "commFreq" : "1000"
+})
+link = sst.Link("link_extra_ew")
+link.connect( (extra, "Elink", "10000ps"), (extra, "Wlink", "10000ps") )
+link = sst.Link("link_extra_ns")
+link.connect( (extra, "Nlink", "10000ps"), (extra, "Slink", "10000ps") )
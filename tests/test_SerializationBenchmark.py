@@ -0,0 +1,22 @@
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+
+# Run a small version of the serialization microbenchmark over each
+# workload.  Timing output is turned off so the results can be
+# compared against a reference file.
+comp = sst.Component("bench", "coreTestElement.coreTestSerializationBenchmark")
+comp.addParams({
+    "workloads" : ["events", "network_request", "std_mem", "containers"],
+    "batch" : 32,
+    "iterations" : 100,
+    "report_timing" : "false"
+})
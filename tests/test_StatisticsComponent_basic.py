@@ -11,6 +11,18 @@
 import sst
 import sys
 
+# Passing "async" as a model option does all the statistic output on
+# background writer threads.  Passing "columnar" sends the CSV group
+# to the columnar binary output instead, and "merged" has the file
+# outputs merge their per rank files.  Output must match the default
+# run.
+output_mode = sys.argv[1] if len(sys.argv) > 1 else ""
+async_output = output_mode == "async"
+merge_ranks = output_mode == "merged"
+file_prefix = "test_StatisticsComponent_basic"
+if output_mode:
+    file_prefix += "_" + output_mode
+
 ########################################################################
 # This script tests the basic behavior of setting general parameters
 # on statistics (startat, stopat, rate)
@@ -98,7 +110,8 @@ sst.setStatisticLoadLevel(2)
 # Set the desired Statistic Output (sst.statOutputConsole is default)
 sst.setStatisticOutput("sst.statOutputConsole", {
     "outputsimtime" : True,
-    "outputrank" : False
+    "outputrank" : False,
+    "async" : async_output
 })
 
 #sst.setStatisticOutput("sst.statOutputTXT", {"filepath" : sys.argv[1],
@@ -587,7 +600,8 @@ StatGroup0.setFrequency("19ns")
 # Set output
 StatOutput0 = sst.StatisticOutput("sst.statOutputConsole", {
     "outputsimtime" : True,
-    "outputrank" : False
+    "outputrank" : False,
+    "async" : async_output
 })
 
 StatGroup0.setOutput(StatOutput0)
@@ -645,11 +659,19 @@ StatGroup1.addStatistic("stat2_U64", {
 StatGroup1.setFrequency("23ns")
 
 # Set output
-StatOutput1 = sst.StatisticOutput("sst.statOutputCSV", {
-    "filepath" : "test_StatisticsComponent_basic_group_stats.csv",
-    "separator" : ", ",
-    "outputrank" : "0"
-})
+if output_mode == "columnar":
+    StatOutput1 = sst.StatisticOutput("sst.statoutputcolumnar", {
+        "filepath" : file_prefix + "_group_stats.sstc",
+        "rowgroupsize" : "16"
+    })
+else:
+    StatOutput1 = sst.StatisticOutput("sst.statOutputCSV", {
+        "filepath" : file_prefix + "_group_stats.csv",
+        "separator" : ", ",
+        "outputrank" : "0",
+        "async" : async_output,
+        "mergeranks" : merge_ranks
+    })
 
 StatGroup1.setOutput(StatOutput1)
 
@@ -709,8 +731,10 @@ StatGroup2.setFrequency("27ns")
 
 # Set output
 StatOutput2 = sst.StatisticOutput("sst.statOutputTXT", {
-    "filepath" : "test_StatisticsComponent_basic_group_stats.txt",
-    "outputrank" : "0"
+    "filepath" : file_prefix + "_group_stats.txt",
+    "outputrank" : "0",
+    "async" : async_output,
+    "mergeranks" : merge_ranks
 })
 
 StatGroup2.setOutput(StatOutput2)
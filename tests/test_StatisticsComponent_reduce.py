@@ -0,0 +1,54 @@
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+
+########################################################################
+# This script tests statistic groups that reduce their statistics.
+
+# StatReduce0 - StatReduce3 see the same data as StatShared0 -
+# StatShared3 in test_StatisticsComponent_shared.py.  Their statistics
+# are merged by the Reduced group, which only outputs one statistic of
+# each name under the group name, so the output matches the shared
+# statistics of that test.
+########################################################################
+
+sst.setStatisticLoadLevel(4)
+
+sst.setStatisticOutput("sst.statOutputConsole", {
+    "outputsimtime" : True,
+    "outputrank" : False
+})
+
+group = sst.StatisticGroup("Reduced")
+group.setReduce(True)
+
+for i in range(4):
+    comp = sst.Component("StatReduce%d" % i, "coreTestElement.StatisticsComponent.int")
+    comp.addParams({
+          "rng" : "marsaglia",
+          "count" : str(101 + 10 * i),
+          "seed_w" : str(1447 + i),
+          "seed_z" : str(1053 + i)
+    })
+    group.addComponent(comp)
+
+group.addStatistic("stat1_U32", {
+    "type" : "sst.AccumulatorStatistic"})
+group.addStatistic("stat3_I32", {
+    "type" : "sst.HistogramStatistic",
+    "minvalue" : "-200",
+    "binwidth" : "50",
+    "numbins" : "8"})
+
+group.setOutput(sst.StatisticOutput("sst.statOutputConsole", {
+    "outputsimtime" : True,
+    "outputrank" : False
+}))
@@ -0,0 +1,50 @@
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+
+########################################################################
+# This script tests the statistic sampling modes.
+
+# StatAll records all of the values, StatInterval every 10th value and
+# StatRandom each value with probability 1/10.
+########################################################################
+
+sst.setStatisticLoadLevel(4)
+
+sst.setStatisticOutput("sst.statOutputConsole", {
+    "outputsimtime" : True
+})
+
+sample_params = {
+    "all" : {},
+    "interval" : { "samplemode" : "interval", "sampleinterval" : "10" },
+    "random" : { "samplemode" : "random", "sampleinterval" : "10", "sampleseed" : "42" }
+}
+
+for name, params in sample_params.items():
+    comp = sst.Component("Stat" + name.capitalize(), "coreTestElement.StatisticsComponent.int")
+    comp.addParams({
+          "rng" : "marsaglia",
+          "count" : "1000",
+          "seed_w" : "1447",
+          "seed_z" : "1053"
+    })
+
+    stat_params = { "type" : "sst.AccumulatorStatistic" }
+    stat_params.update(params)
+    comp.enableStatistics(["stat1_U32"], stat_params)
+
+    stat_params = { "type" : "sst.HistogramStatistic",
+                    "minvalue" : "0",
+                    "binwidth" : "4000",
+                    "numbins" : "5" }
+    stat_params.update(params)
+    comp.enableStatistics(["stat2_U64"], stat_params)
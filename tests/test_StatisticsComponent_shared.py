@@ -0,0 +1,72 @@
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+
+########################################################################
+# This script tests statistics shared with the "sharedname" parameter.
+
+# StatShared0 - StatShared3 each add to shared statistics of every
+# mergeable type.  They are spread across the threads, and each shared
+# statistic is output once at the end of simulation under its shared
+# name.
+
+# StatSingle0 - StatSingle3 see the same data as StatShared0 -
+# StatShared3 and output stat1_U32 on their own, so the shared
+# accumulator can be checked against the sum of its parts.
+########################################################################
+
+# Scatter the components across the threads
+sst.setProgramOptions({
+    "partitioner" : "roundrobin"
+})
+
+sst.setStatisticLoadLevel(4)
+
+sst.setStatisticOutput("sst.statOutputConsole", {
+    "outputsimtime" : True,
+    "outputrank" : False
+})
+
+for i in range(4):
+    params = {
+          "rng" : "marsaglia",
+          "count" : str(101 + 10 * i),
+          "seed_w" : str(1447 + i),
+          "seed_z" : str(1053 + i)
+    }
+
+    shared = sst.Component("StatShared%d" % i, "coreTestElement.StatisticsComponent.int")
+    shared.addParams(params)
+
+    shared.enableStatistics(["stat1_U32"], {
+        "type" : "sst.AccumulatorStatistic",
+        "sharedname" : "SharedAccumulator"})
+
+    shared.enableStatistics(["stat2_U64"], {
+        "type" : "sst.UniqueCountStatistic",
+        "sharedname" : "SharedUniqueCount"})
+
+    shared.enableStatistics(["stat3_I32"], {
+        "type" : "sst.HistogramStatistic",
+        "sharedname" : "SharedHistogram",
+        "minvalue" : "-200",
+        "binwidth" : "50",
+        "numbins" : "8"})
+
+    shared.enableStatistics(["stat4_I64"], {
+        "type" : "sst.ApproxUniqueCountStatistic",
+        "sharedname" : "SharedApproxUniqueCount"})
+
+    single = sst.Component("StatSingle%d" % i, "coreTestElement.StatisticsComponent.int")
+    single.addParams(params)
+
+    single.enableStatistics(["stat1_U32"], {
+        "type" : "sst.AccumulatorStatistic"})
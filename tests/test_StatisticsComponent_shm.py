@@ -0,0 +1,31 @@
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+import sys
+
+# The region is left in place for the test to read back
+sst.setStatisticLoadLevel(4)
+sst.setStatisticOutput("sst.statoutputshm", {
+    "name" : sys.argv[1],
+    "statistics" : "StatInt0.stat1_U32,StatInt0.stat2*",
+    "unlink" : False
+})
+
+StatInt0 = sst.Component("StatInt0", "coreTestElement.StatisticsComponent.int")
+StatInt0.addParams({
+      "rng" : "marsaglia",
+      "count" : "100",
+      "seed_w" : "1447",
+      "seed_z" : "1053"
+})
+
+StatInt0.enableStatistics(["stat1_U32", "stat2_U64", "stat3_I32"], {
+    "type" : "sst.AccumulatorStatistic"})
@@ -0,0 +1,129 @@
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+
+########################################################################
+# This script tests the binning of HistogramStatistic and the estimate
+# of ApproxUniqueCountStatistic.
+
+# StatHisto0 tests HistogramStatistic with:
+# - a minvalue that is not a multiple of binwidth, values that fall on
+#   both sides of the bins and periodic output with resetOnOutput
+# - negative bins
+
+# StatHisto1 tests HistogramStatistic on floating point data
+
+# StatUnique0 and StatUnique1 see the same data, so the estimate of
+# ApproxUniqueCountStatistic can be checked against the exact count of
+# UniqueCountStatistic
+
+# StatHdr0 tests HdrHistogramStatistic with:
+# - percentiles of values that are not all exact at precision 2
+# - negative and too large values and the bucket dump at precision 1
+
+# StatSketch0 tests QuantileSketchStatistic with enough values to fill
+# several levels of the sketch, and with a small k
+########################################################################
+
+sst.setStatisticLoadLevel(4)
+
+sst.setStatisticOutput("sst.statOutputConsole", {
+    "outputsimtime" : True,
+    "outputrank" : False
+})
+
+StatHisto0 = sst.Component("StatHisto0", "coreTestElement.StatisticsComponent.int")
+StatHisto0.addParams({
+      "rng" : "marsaglia",
+      "count" : "1999",
+      "seed_w" : "1447",
+      "seed_z" : "1053"
+})
+
+StatHisto0.enableStatistics(["stat1_U32"], {
+    "type" : "sst.HistogramStatistic",
+    "minvalue" : "25",
+    "binwidth" : "50",
+    "numbins" : "7",
+    "rate" : "500 ns",
+    "resetOnOutput" : True})
+
+StatHisto0.enableStatistics(["stat3_I32"], {
+    "type" : "sst.HistogramStatistic",
+    "minvalue" : "-200",
+    "binwidth" : "40",
+    "numbins" : "10"})
+
+StatHisto1 = sst.Component("StatHisto1", "coreTestElement.StatisticsComponent.float")
+StatHisto1.addParams({
+      "rng" : "marsaglia",
+      "count" : "101",
+      "seed_w" : "1451",
+      "seed_z" : "1057"
+})
+
+StatHisto1.enableStatistics(["stat1_F32"], {
+    "type" : "sst.HistogramStatistic",
+    "minvalue" : "100.5",
+    "binwidth" : "150",
+    "numbins" : "5"})
+
+StatUnique0 = sst.Component("StatUnique0", "coreTestElement.StatisticsComponent.int")
+StatUnique1 = sst.Component("StatUnique1", "coreTestElement.StatisticsComponent.int")
+for comp in [StatUnique0, StatUnique1]:
+    comp.addParams({
+          "rng" : "marsaglia",
+          "count" : "1999",
+          "seed_w" : "1449",
+          "seed_z" : "1055"
+    })
+
+StatUnique0.enableStatistics(["stat1_U32", "stat3_I32"], {
+    "type" : "sst.UniqueCountStatistic"})
+
+StatUnique1.enableStatistics(["stat1_U32"], {
+    "type" : "sst.ApproxUniqueCountStatistic"})
+
+StatUnique1.enableStatistics(["stat3_I32"], {
+    "type" : "sst.ApproxUniqueCountStatistic",
+    "precision" : "6"})
+
+StatHdr0 = sst.Component("StatHdr0", "coreTestElement.StatisticsComponent.int")
+StatHdr0.addParams({
+      "rng" : "marsaglia",
+      "count" : "1999",
+      "seed_w" : "1459",
+      "seed_z" : "1061"
+})
+
+StatHdr0.enableStatistics(["stat1_U32"], {
+    "type" : "sst.HdrHistogramStatistic"})
+
+StatHdr0.enableStatistics(["stat3_I32"], {
+    "type" : "sst.HdrHistogramStatistic",
+    "precision" : "1",
+    "maxvalue" : "70",
+    "dumpbinsonoutput" : True})
+
+StatSketch0 = sst.Component("StatSketch0", "coreTestElement.StatisticsComponent.int")
+StatSketch0.addParams({
+      "rng" : "marsaglia",
+      "count" : "1999",
+      "seed_w" : "1461",
+      "seed_z" : "1063"
+})
+
+StatSketch0.enableStatistics(["stat1_U32"], {
+    "type" : "sst.QuantileSketchStatistic"})
+
+StatSketch0.enableStatistics(["stat3_I32"], {
+    "type" : "sst.QuantileSketchStatistic",
+    "k" : "16"})
@@ -0,0 +1,33 @@
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+
+# Run a small version of the TimeVortex microbenchmark over each
+# distribution.  Timing output is turned off so the results can be
+# compared against a reference file.
+vortices = ["sst.timevortex.priority_queue",
+            "sst.timevortex.priority_queue.staged",
+            "sst.timevortex.dheap",
+            "sst.timevortex.simdheap",
+            "sst.timevortex.calendar_queue",
+            "sst.timevortex.ring.binned",
+            "sst.timevortex.bucketed",
+            "sst.timevortex.adaptive"]
+
+for dist in ["uniform", "clock", "exponential"]:
+    comp = sst.Component("bench_%s"%dist, "coreTestElement.coreTestTimeVortexBenchmark")
+    comp.addParams({
+        "vortices" : vortices,
+        "distribution" : dist,
+        "depth" : 5000,
+        "operations" : 20000,
+        "report_timing" : "false"
+    })
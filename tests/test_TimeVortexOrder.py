@@ -0,0 +1,34 @@
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+
+# Two message generators on different threads send bursts of messages
+# with the same delivery time to each other.  Each one checks that the
+# messages arrive in the order they were sent.
+sst.setProgramOption("stop-at", "10000s")
+sst.setProgramOption("num-threads", "2")
+sst.setProgramOption("partitioner", "self")
+
+comps = []
+for i in range(2):
+    comp = sst.Component("msgGen%d"%i, "coreTestElement.coreTestMessageGeneratorComponent")
+    comp.addParams({
+        "outputinfo" : "0",
+        "sendcount" : "2000",
+        "burstsize" : "50",
+        "checkorder" : "1",
+        "clock" : "1MHz"
+    })
+    comp.setRank(0, i)
+    comps.append(comp)
+
+link = sst.Link("link_0_1")
+link.connect( (comps[0], "remoteComponent", "500ns"), (comps[1], "remoteComponent", "500ns") )
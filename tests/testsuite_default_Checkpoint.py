@@ -0,0 +1,114 @@
+# -*- coding: utf-8 -*-
+#
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+from sst_unittest import *
+from sst_unittest_support import *
+
+################################################################################
+# Code to support a single instance module initialize, must be called setUp method
+
+module_init = 0
+module_sema = threading.Semaphore()
+
+def initializeTestModule_SingleInstance(class_inst):
+    global module_init
+    global module_sema
+
+    module_sema.acquire()
+    if module_init != 1:
+        # Put your single instance Init Code Here
+        module_init = 1
+    module_sema.release()
+
+################################################################################
+
+class testcase_Checkpoint(SSTTestCase):
+
+    def initializeClass(self, testName):
+        super(type(self), self).initializeClass(testName)
+        # Put test based setup code here. it is called before testing starts
+        # NOTE: This method is called once for every test
+
+    def setUp(self):
+        super(type(self), self).setUp()
+        initializeTestModule_SingleInstance(self)
+        # Put test based setup code here. it is called once before every test
+
+    def tearDown(self):
+        # Put test based teardown code here. it is called once after every test
+        super(type(self), self).tearDown()
+
+#####
+
+    def test_Checkpoint(self):
+        self.checkpoint_test_template("Checkpoint", 1)
+
+    def test_Checkpoint_restart_with_period(self):
+        self.checkpoint_test_template("Checkpoint", 0, restart_args="--checkpoint-period=7us",
+                                      outname="Checkpoint_restart_with_period")
+
+    def test_Checkpoint_async_incremental(self):
+        self.checkpoint_test_template("Checkpoint", 1, checkpoint_args="--checkpoint-async --checkpoint-incremental",
+                                      outname="Checkpoint_async_incremental")
+
+    @unittest.skipIf(testing_check_get_num_ranks() > 1, "Test sets its own number of threads on a single rank")
+    def test_Checkpoint_repartition(self):
+        self.checkpoint_test_template("Checkpoint", 1, checkpoint_threads=2, restart_threads=1,
+                                      outname="Checkpoint_repartition")
+
+    # Rollbacks restore the same state a checkpoint saves, so the
+    # optimistic rank sync is checked with the checkpoint model.  It only
+    # takes effect when the tests are run with multiple ranks.
+    @unittest.skipIf(testing_check_get_num_threads() > 1, "Optimistic sync only supports one thread per rank")
+    def test_Checkpoint_optimistic_rank_sync(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_Checkpoint.py".format(testsuitedir)
+        reffile = "{0}/refFiles/test_Checkpoint.out".format(testsuitedir)
+        outfile = "{0}/test_Checkpoint_optimistic_rank_sync.out".format(outdir)
+
+        self.run_sst(sdlfile, outfile, other_args="--rank-sync=optimistic --optimistic-window=1us")
+
+        cmp_result = testing_compare_sorted_diff("Checkpoint_optimistic_rank_sync", outfile, reffile)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile, reffile))
+
+#####
+
+    def checkpoint_test_template(self, testtype, restart_index, checkpoint_args="", restart_args="",
+                                 checkpoint_threads=None, restart_threads=None, outname=None):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_{1}.py".format(testsuitedir, testtype)
+        reffile = "{0}/refFiles/test_{1}.out".format(testsuitedir, testtype)
+        if outname is None: outname = testtype
+        prefix = "{0}/test_{1}_ckpt".format(outdir, outname)
+
+        # Write checkpoints at 7us and 14us, then restart from one of them.
+        # Both runs must produce the output of an uninterrupted run.
+        runs = [ ("checkpoint", "--checkpoint-period=7us --checkpoint-prefix={0} {1}".format(prefix, checkpoint_args),
+                  checkpoint_threads),
+                 ("restart", "--load-checkpoint={0}_{1} --checkpoint-prefix={0}_restart {2}".format(prefix, restart_index, restart_args),
+                  restart_threads) ]
+
+        for run, args, threads in runs:
+            outfile = "{0}/test_{1}_{2}.out".format(outdir, outname, run)
+            errfile = "{0}/test_{1}_{2}.err".format(outdir, outname, run)
+
+            self.run_sst(sdlfile, outfile, errfile, other_args=args, num_threads=threads)
+
+            # Lines starting with # report the checkpoints written and loaded
+            filter1 = StartsWithFilter("#")
+            cmp_result = testing_compare_filtered_diff(outname, outfile, reffile, sort=True, filters=[filter1])
+            self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile, reffile))
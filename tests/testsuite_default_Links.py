@@ -59,6 +59,42 @@ class testcase_Links(SSTTestCase):
     def test_Links_wrong_port(self):
         self.component_test_template("wrong_port", "--model-options=wrong_port", 1)
 
+    def test_Links_topology(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_Links_topology.py".format(testsuitedir)
+        reffile = "{0}/refFiles/test_Links_topology.out".format(testsuitedir)
+        outfile = "{0}/test_Links_topology.out".format(outdir)
+
+        self.run_sst(sdlfile, outfile)
+        cmp_result = testing_compare_sorted_diff("Links_topology", outfile, reffile)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile, reffile))
+
+    @unittest.skipIf(testing_check_get_num_ranks() > 1 or testing_check_get_num_threads() > 1,
+                     "Boundary traces only support a single rank and thread")
+    def test_Links_boundary(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_Links.py".format(testsuitedir)
+        tracefile = "{0}/test_Links_boundary.trace".format(outdir)
+        boundary = "--boundary-components=c1_*"
+
+        # Recording doesn't change the run
+        reffile = "{0}/refFiles/test_Links_basic.out".format(testsuitedir)
+        outfile = "{0}/test_Links_boundary_record.out".format(outdir)
+        self.run_sst(sdlfile, outfile, other_args="{0} --boundary-record={1}".format(boundary, tracefile))
+        cmp_result = testing_compare_sorted_diff("Links_boundary_record", outfile, reffile)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile, reffile))
+
+        # Replaying gives the same output for the components inside
+        reffile = "{0}/refFiles/test_Links_boundary.out".format(testsuitedir)
+        outfile = "{0}/test_Links_boundary_replay.out".format(outdir)
+        self.run_sst(sdlfile, outfile, other_args="{0} --boundary-replay={1}".format(boundary, tracefile))
+        cmp_result = testing_compare_sorted_diff("Links_boundary_replay", outfile, reffile)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile, reffile))
+
 #####
 
     def component_test_template(self, testtype, extra_args="", rc=0):
@@ -17,6 +17,8 @@ import filecmp
 from sst_unittest import *
 from sst_unittest_support import *
 
+have_mempool = sst_core_config_include_file_get_value_int("USE_MEMPOOL", default=0, disable_warning=True) == 1
+
 ################################################################################
 # Code to support a single instance module initialize, must be called setUp method
 
@@ -60,20 +62,59 @@ class testcase_StatisticComponent(SSTTestCase):
     def test_MemPool_undeleted_items(self):
         self.Statistics_test_template("undeleted_items")
 
+    @unittest.skipIf(not have_mempool, "Test requires SST to be built with mempools")
+    @unittest.skipIf(testing_check_get_num_ranks() > 1, "Test only supports single rank runs")
+    def test_MemPool_print_stats(self):
+        self.Statistics_test_template("print_stats", filters = self.print_stats_filters())
+
+    @unittest.skipIf(not have_mempool, "Test requires SST to be built with mempools")
+    @unittest.skipIf(testing_check_get_num_ranks() > 1, "Test only supports single rank runs")
+    def test_MemPool_active_untimed_phases(self):
+        # The complete phase sends untimed data, so only the receiving
+        # components are called after phase 0
+        self.Statistics_test_template("print_stats", None, "active_untimed_phases", "--active-untimed-phases",
+                                      self.print_stats_filters())
+
+    def print_stats_filters(self):
+        # Pool sizes, item sizes and allocation counts depend on the
+        # ABI and the build, so only the live items per class are
+        # compared
+        return [RemoveRegexFromLineFilter(r"^ +\d+ B: .*\n?"), RemoveRegexFromLineFilter(r", \d+ B")]
+
+    @unittest.skipIf(testing_check_get_num_ranks() > 1, "Test only supports single rank runs")
+    def test_MemPool_thread_return(self):
+        # Same checks as overflow, but items freed on other threads go
+        # back to the allocating thread
+        self.Statistics_test_template("overflow", 4, "thread_return", "--mempool-thread-return")
+
+    @unittest.skipIf(testing_check_get_num_ranks() > 1, "Test only supports single rank runs")
+    def test_MemPool_arena_placement(self):
+        # Same checks as overflow, with huge page and NUMA local arenas.
+        # Both fall back to normal arenas where they aren't available.
+        self.Statistics_test_template("overflow", 4, "arena_placement", "--mempool-huge-pages --mempool-numa-local")
+
+    @unittest.skipIf(testing_check_get_num_ranks() > 1, "Test only supports single rank runs")
+    def test_MemPool_trim(self):
+        # Same checks as overflow, with the free arenas released after
+        # setup.  The items still in use must be unaffected.
+        self.Statistics_test_template("overflow", 4, "trim", "--mempool-trim")
+
 #####
 
-    def Statistics_test_template(self, testtype, num_threads = None):
+    def Statistics_test_template(self, testtype, num_threads = None, outname = None, other_args = "", filters = []):
         testsuitedir = self.get_testsuite_dir()
         outdir = test_output_get_run_dir()
+        if outname is None:
+            outname = testtype
 
         sdlfile = "{0}/test_MemPool_{1}.py".format(testsuitedir, testtype)
         reffile = "{0}/refFiles/test_MemPool_{1}.out".format(testsuitedir, testtype)
-        outfile = "{0}/test_MemPool_{1}.out".format(outdir, testtype)
+        outfile = "{0}/test_MemPool_{1}.out".format(outdir, outname)
 
-        self.run_sst(sdlfile, outfile, num_threads=num_threads)
+        self.run_sst(sdlfile, outfile, num_threads=num_threads, other_args=other_args)
 
         # Perform the test
         filter1 = StartsWithFilter("WARNING: No components are")
         filter2 = StartsWithFilter("#")
-        cmp_result = testing_compare_filtered_diff(testtype, outfile, reffile, True, [filter1, filter2])
+        cmp_result = testing_compare_filtered_diff(testtype, outfile, reffile, True, [filter1, filter2] + filters)
         self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile, reffile))
@@ -64,8 +64,9 @@ class testcase_PerfComponent(SSTTestCase):
         reffile = "{0}/refFiles/test_PerfComponent.out".format(testsuitedir)
         outfile = "{0}/test_PerfComponent.out".format(outdir)
 
-        self.run_sst(sdlfile, outfile)
-        
+        # Also a performance test with --perf
+        self.run_sst_perf(sdlfile, outfile)
+
         # Perform the test of the standard simulation output
         cmp_result = testing_compare_sorted_diff(testtype, outfile, reffile)
         self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile, reffile))
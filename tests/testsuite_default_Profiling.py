@@ -0,0 +1,232 @@
+# -*- coding: utf-8 -*-
+#
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+from sst_unittest import *
+from sst_unittest_support import *
+
+import glob
+import json
+
+handler_profiling = sst_core_config_include_file_get_value_int(
+    "SST_DISABLE_HANDLER_PROFILING", default=0, disable_warning=True) == 0
+
+################################################################################
+# Code to support a single instance module initialize, must be called setUp method
+
+module_init = 0
+module_sema = threading.Semaphore()
+
+def initializeTestModule_SingleInstance(class_inst):
+    global module_init
+    global module_sema
+
+    module_sema.acquire()
+    if module_init != 1:
+        # Put your single instance Init Code Here
+        module_init = 1
+    module_sema.release()
+
+################################################################################
+
+class testcase_Profiling(SSTTestCase):
+
+    def initializeClass(self, testName):
+        super(type(self), self).initializeClass(testName)
+        # Put test based setup code here. it is called before testing starts
+        # NOTE: This method is called once for every test
+
+    def setUp(self):
+        super(type(self), self).setUp()
+        initializeTestModule_SingleInstance(self)
+        # Put test based setup code here. it is called once before every test
+
+    def tearDown(self):
+        # Put test based teardown code here. it is called once after every test
+        super(type(self), self).tearDown()
+
+#####
+
+    @unittest.skipIf(not handler_profiling, "SST was configured with --disable-handler-profiling")
+    def test_Profiling_event_trace(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_MessageGeneratorComponent.py".format(testsuitedir)
+        outfile = "{0}/test_Profiling_event_trace.out".format(outdir)
+        prefix = "{0}/test_Profiling_event_trace".format(outdir)
+        jsonfile = "{0}/test_Profiling_event_trace.json".format(outdir)
+
+        for f in glob.glob("{0}_*.sstt".format(prefix)):
+            os.remove(f)
+
+        profile = ("trace:sst.profile.handler.event.trace(level=subcomponent,track_ports=true,"
+                   "profile_sends=true,buffer_size=1048576,file={0})[event]").format(prefix)
+        self.run_sst(sdlfile, outfile, other_args="--enable-profiling=\"{0}\"".format(profile))
+
+        # One trace file per rank and thread
+        traces = sorted(glob.glob("{0}_*.sstt".format(prefix)))
+        self.assertEqual(len(traces), testing_check_get_num_ranks() * testing_check_get_num_threads(),
+                         "Wrong number of trace files: {0}".format(traces))
+
+        converter = "{0}/sst-trace-to-chrome".format(sstsimulator_conf_get_value_str('SSTCore', 'bindir'))
+        rtn = os_simple_command("{0} -o {1} {2}".format(converter, jsonfile, " ".join(traces)))
+        self.assertEqual(rtn[0], 0, "sst-trace-to-chrome failed: {0}".format(rtn[1]))
+
+        # Each component sends and receives 100000 messages
+        with open(jsonfile) as f:
+            events = json.load(f)["traceEvents"]
+        for comp in ["msgGen0", "msgGen1"]:
+            name = "{0}:remoteComponent".format(comp)
+            recvs = [e for e in events if e.get("cat") == "recv" and e["name"] == name]
+            sends = [e for e in events if e.get("cat") == "send" and e["args"]["handler"] == name]
+            self.assertEqual(len(recvs), 100000, "Wrong number of receives traced for {0}".format(comp))
+            self.assertEqual(len(sends), 100000, "Wrong number of sends traced for {0}".format(comp))
+
+    def test_Profiling_timing_json(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_MessageGeneratorComponent.py".format(testsuitedir)
+        outfile = "{0}/test_Profiling_timing_json.out".format(outdir)
+        jsonfile = "{0}/test_Profiling_timing_json.json".format(outdir)
+
+        self.run_sst(sdlfile, outfile, other_args="--timing-info-json={0}".format(jsonfile))
+
+        with open(jsonfile) as f:
+            report = json.load(f)
+        self.assertEqual(report["ranks"], testing_check_get_num_ranks())
+        self.assertEqual(report["threads"], testing_check_get_num_threads())
+
+        # Every phase has a time for each rank
+        names = [p["name"] for p in report["phases"]]
+        for name in ["model", "partition", "graph_broadcast", "construction", "init", "init_round_0",
+                     "setup", "run", "complete", "finish", "stat_output", "teardown", "total"]:
+            self.assertIn(name, names, "Phase {0} missing from timing report".format(name))
+        for phase in report["phases"]:
+            self.assertEqual(len(phase["ranks"]), report["ranks"])
+            self.assertTrue(phase["min"] <= phase["avg"] <= phase["max"] + 1e-9,
+                            "Bad summary of phase {0}".format(phase["name"]))
+
+    @unittest.skipIf(not handler_profiling, "SST was configured with --disable-handler-profiling")
+    def test_Profiling_event_sample(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_MessageGeneratorComponent.py".format(testsuitedir)
+        outfile = "{0}/test_Profiling_event_sample.out".format(outdir)
+        prefix = "{0}/test_Profiling_event_sample".format(outdir)
+        profout = "{0}.prof".format(prefix)
+
+        for f in glob.glob("{0}*.prof".format(prefix)):
+            os.remove(f)
+
+        profile = "sample:sst.profile.handler.event.sample(level=component,period=100)[event]"
+        self.run_sst(sdlfile, outfile,
+                     other_args="--enable-profiling=\"{0}\" --profiling-output={1}".format(profile, profout))
+
+        # One file per rank with a report per thread, each with a line
+        # for the components on that thread
+        files = glob.glob("{0}*.prof".format(prefix))
+        self.assertEqual(len(files), testing_check_get_num_ranks(), "Wrong number of profile files: {0}".format(files))
+        reports = 0
+        components = set()
+        for name in files:
+            with open(name) as f:
+                lines = [l.strip() for l in f]
+            for i, line in enumerate(lines):
+                if line != "sample": continue
+                reports += 1
+                self.assertTrue(lines[i + 1].startswith("Sample period (us) = 100,"),
+                                "Bad header: {0}".format(lines[i + 1]))
+                self.assertEqual(lines[i + 2], "Name, samples, percent of samples")
+                for entry in lines[i + 3:]:
+                    fields = entry.split(", ")
+                    if len(fields) != 3: break
+                    components.add(fields[0])
+        self.assertEqual(reports, testing_check_get_num_ranks() * testing_check_get_num_threads())
+        self.assertEqual(components, {"msgGen0", "msgGen1"})
+
+    @unittest.skipIf(not handler_profiling, "SST was configured with --disable-handler-profiling")
+    def test_Profiling_event_time_sampled(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_MessageGeneratorComponent.py".format(testsuitedir)
+        outfile = "{0}/test_Profiling_event_time_sampled.out".format(outdir)
+        prefix = "{0}/test_Profiling_event_time_sampled".format(outdir)
+        profout = "{0}.prof".format(prefix)
+
+        for f in glob.glob("{0}*.prof".format(prefix)):
+            os.remove(f)
+
+        profile = "time:sst.profile.handler.event.time.steady(level=component,sample_interval=7)[event]"
+        self.run_sst(sdlfile, outfile,
+                     other_args="--enable-profiling=\"{0}\" --profiling-output={1}".format(profile, profout))
+
+        # Every call is counted, even though only some are timed
+        files = glob.glob("{0}*.prof".format(prefix))
+        self.assertEqual(len(files), testing_check_get_num_ranks(), "Wrong number of profile files: {0}".format(files))
+        reports = 0
+        components = set()
+        for name in files:
+            with open(name) as f:
+                lines = [l.strip() for l in f]
+            for i, line in enumerate(lines):
+                if line != "time": continue
+                reports += 1
+                self.assertEqual(lines[i + 1], "Name, recv count, recv time (s), avg. recv time (ns)")
+                for entry in lines[i + 2:]:
+                    fields = entry.split(", ")
+                    if len(fields) != 4: break
+                    self.assertGreater(int(fields[1]), 7, "Too few calls counted: {0}".format(entry))
+                    components.add(fields[0])
+        self.assertEqual(reports, testing_check_get_num_ranks() * testing_check_get_num_threads())
+        self.assertEqual(components, {"msgGen0", "msgGen1"})
+
+    @unittest.skipIf(not handler_profiling, "SST was configured with --disable-handler-profiling")
+    def test_Profiling_event_comm(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_MessageGeneratorComponent.py".format(testsuitedir)
+        outfile = "{0}/test_Profiling_event_comm.out".format(outdir)
+        prefix = "{0}/test_Profiling_event_comm".format(outdir)
+        profout = "{0}.prof".format(prefix)
+
+        for f in glob.glob("{0}*.prof".format(prefix)):
+            os.remove(f)
+
+        profile = "comm:sst.profile.handler.event.comm(level=subcomponent,track_ports=true)[event]"
+        self.run_sst(sdlfile, outfile,
+                     other_args="--enable-profiling=\"{0}\" --profiling-output={1}".format(profile, profout))
+
+        # Collect the partition and link traffic from all the reports
+        partition_events = 0
+        link_events = {}
+        for name in glob.glob("{0}*.prof".format(prefix)):
+            section = None
+            with open(name) as f:
+                for line in f:
+                    fields = line.strip().split(", ")
+                    if fields[0] in ("Source", "Link"):
+                        section = fields[0]
+                    elif len(fields) != 4:
+                        section = None
+                    elif section == "Source":
+                        partition_events += int(fields[2])
+                    elif section == "Link":
+                        link_events[fields[0]] = link_events.get(fields[0], 0) + int(fields[2])
+
+        # Each component sends 100000 messages
+        self.assertEqual(link_events, {"msgGen0:remoteComponent": 100000, "msgGen1:remoteComponent": 100000})
+        self.assertEqual(partition_events, 200000)
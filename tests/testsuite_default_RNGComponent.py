@@ -62,6 +62,9 @@ class testcase_RNGComponent(SSTTestCase):
     def test_RNG_xorshift(self):
         self.RNG_test_template("xorshift")
 
+    def test_RNG_philox(self):
+        self.RNG_test_template("philox")
+
 #####
 
     def RNG_test_template(self, testtype):
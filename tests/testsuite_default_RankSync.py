@@ -0,0 +1,117 @@
+# -*- coding: utf-8 -*-
+#
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+import os
+import sys
+
+from sst_unittest import *
+from sst_unittest_support import *
+
+################################################################################
+# Code to support a single instance module initialize, must be called setUp method
+
+module_init = 0
+module_sema = threading.Semaphore()
+
+def initializeTestModule_SingleInstance(class_inst):
+    global module_init
+    global module_sema
+
+    module_sema.acquire()
+    if module_init != 1:
+        # Put your single instance Init Code Here
+        module_init = 1
+    module_sema.release()
+
+################################################################################
+
+class testcase_RankSync(SSTTestCase):
+
+    def initializeClass(self, testName):
+        super(type(self), self).initializeClass(testName)
+        # Put test based setup code here. it is called before testing starts
+        # NOTE: This method is called once for every test
+
+    def setUp(self):
+        super(type(self), self).setUp()
+        initializeTestModule_SingleInstance(self)
+        # Put test based setup code here. it is called once before every test
+
+    def tearDown(self):
+        # Put test based teardown code here. it is called once after every test
+        super(type(self), self).tearDown()
+
+###
+
+
+    def test_compression(self):
+        self.ranksync_test_template("compression", "6 6", "--sync-compress-threshold=1")
+
+    def test_compression_threshold(self):
+        self.ranksync_test_template("compression_threshold", "6 6", "--sync-compress-threshold=4096")
+
+    @unittest.skipIf(testing_check_get_num_threads() > 1, "Null message sync only supports one thread per rank")
+    def test_null_message(self):
+        self.ranksync_test_template("null_message", "6 6", "--rank-sync=nullmessage")
+
+    def test_overlap(self):
+        self.ranksync_test_template("overlap", "6 6", "--rank-sync=overlap")
+
+    def test_pairwise(self):
+        self.ranksync_test_template("pairwise", "6 6", "--rank-sync=pairwise")
+
+    def test_persistent(self):
+        self.ranksync_test_template("persistent", "6 6", "--rank-sync=persistent")
+
+    def test_nonblocking_reduce(self):
+        self.ranksync_test_template("nonblocking_reduce", "6 6", "--sync-nonblocking-reduce")
+
+    def test_persistent_nonblocking_reduce(self):
+        self.ranksync_test_template("persistent_nonblocking_reduce", "6 6", "--rank-sync=persistent --sync-nonblocking-reduce")
+
+    def test_rma(self):
+        self.ranksync_test_template("rma", "6 6", "--rank-sync=rma")
+
+    def test_shmem(self):
+        self.ranksync_test_template("shmem", "6 6", "--rank-sync=shmem")
+
+    def test_tree_barrier(self):
+        self.ranksync_test_template("tree_barrier", "6 6", "--thread-barrier=tree")
+
+    def test_deferred_exit_check(self):
+        # The model ends when its primary components are done, so the
+        # end time and the statistics have to match the serial run
+        self.ranksync_test_template("deferred_exit_check", "", "--deferred-exit-check", "DeferredExitCheck")
+
+#####
+
+    def ranksync_test_template(self, testtype, model_options, sync_options, model = "MessageMesh"):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        options = "--model-options=\"{0}\"".format(model_options)
+
+        # Set the various file paths
+        sdlfile = "{0}/test_{1}.py".format(testsuitedir, model)
+        outfile_ref = "{0}/test_ranksync_ref_{1}.out".format(outdir, testtype)
+        outfile_check = "{0}/test_ranksync_check_{1}.out".format(outdir, testtype)
+
+        # Do a serial reference run, then run the same model with the
+        # requested sync options.  The sync options only take effect
+        # when the tests are run with multiple ranks.
+        self.run_sst(sdlfile, outfile_ref, other_args=options, num_ranks=1, num_threads=1)
+        self.run_sst(sdlfile, outfile_check, other_args="{0} {1}".format(options, sync_options))
+
+        # Perform the test
+        cmp_result = testing_compare_sorted_diff(testtype, outfile_ref, outfile_check)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile_ref, outfile_check))
@@ -69,3 +69,16 @@ class testcase_StatisticComponent(SSTTestCase):
         filter1 = StartsWithFilter("WARNING: No components are")
         cmp_result = testing_compare_filtered_diff("serialization", outfile, reffile, True, [filter1])
         self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile, reffile))
+
+    def test_SerializationBenchmark(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_SerializationBenchmark.py".format(testsuitedir)
+        reffile = "{0}/refFiles/test_SerializationBenchmark.out".format(testsuitedir)
+        outfile = "{0}/test_SerializationBenchmark.out".format(outdir)
+
+        self.run_sst(sdlfile, outfile, num_ranks=1, num_threads=1)
+
+        cmp_result = testing_compare_sorted_diff("SerializationBenchmark", outfile, reffile)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile, reffile))
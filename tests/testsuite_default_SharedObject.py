@@ -111,6 +111,12 @@ class testcase_SharedObject(SSTTestCase):
     def test_SharedObject_array_late_initialize(self):
         self.sharedobject_test_template("array_late_initialize", 1, "--param=object_type:array --param=num_entities:12 --param=late_initialize:true")
 
+    def test_SharedObject_array_full_single_node_shared(self):
+        self.sharedobject_test_template("array_full_single_node_shared", 0, "--param=object_type:array --param=num_entities:12 --param=full_initialization:true --param=node_shared:true")
+
+    def test_SharedObject_array_partial_node_shared(self):
+        self.sharedobject_test_template("array_partial_node_shared", 0, "--param=object_type:array --param=num_entities:12 --param=full_initialization:false --param=node_shared:true")
+
 
     # SharedMap Tests
     # Full Initialization
@@ -170,6 +176,21 @@ class testcase_SharedObject(SSTTestCase):
     def test_SharedObject_map_late_initialize(self):
         self.sharedobject_test_template("map_late_initialize", 1, "--param=object_type:map --param=num_entities:12 --param=late_initialize:true")
 
+    def test_SharedObject_map_full_single_frozen(self):
+        self.sharedobject_test_template("map_full_single_frozen", 0, "--param=object_type:map --param=num_entities:12 --param=full_initialization:true --param=frozen_layout:true")
+
+    def test_SharedObject_map_partial_frozen(self):
+        self.sharedobject_test_template("map_partial_frozen", 0, "--param=object_type:map --param=num_entities:12 --param=full_initialization:false --param=frozen_layout:true")
+
+    def test_SharedObject_map_partial_late_frozen(self):
+        self.sharedobject_test_template("map_partial_late_frozen", 1, "--param=object_type:map --param=num_entities:12 --param=full_initialization:false --param=late_write:true --param=frozen_layout:true")
+
+    def test_SharedObject_map_full_single_hashed(self):
+        self.sharedobject_test_template("map_full_single_hashed", 0, "--param=object_type:map --param=num_entities:12 --param=full_initialization:true --param=hashed_layout:true")
+
+    def test_SharedObject_map_partial_hashed(self):
+        self.sharedobject_test_template("map_partial_hashed", 0, "--param=object_type:map --param=num_entities:12 --param=full_initialization:false --param=hashed_layout:true")
+
     # SharedSet Tests
     # Full Initialization
     #   single - only ID 0 initializes set
@@ -228,6 +249,18 @@ class testcase_SharedObject(SSTTestCase):
     def test_SharedObject_set_late_initialize(self):
         self.sharedobject_test_template("set_late_initialize", 1, "--param=object_type:set --param=num_entities:12 --param=late_initialize:true")
 
+    def test_SharedObject_set_full_single_frozen(self):
+        self.sharedobject_test_template("set_full_single_frozen", 0, "--param=object_type:set --param=num_entities:12 --param=full_initialization:true --param=frozen_layout:true")
+
+    def test_SharedObject_set_partial_frozen(self):
+        self.sharedobject_test_template("set_partial_frozen", 0, "--param=object_type:set --param=num_entities:12 --param=full_initialization:false --param=frozen_layout:true")
+
+    def test_SharedObject_set_full_single_hashed(self):
+        self.sharedobject_test_template("set_full_single_hashed", 0, "--param=object_type:set --param=num_entities:12 --param=full_initialization:true --param=hashed_layout:true")
+
+    def test_SharedObject_set_partial_hashed(self):
+        self.sharedobject_test_template("set_partial_hashed", 0, "--param=object_type:set --param=num_entities:12 --param=full_initialization:false --param=hashed_layout:true")
+
 #####
 
     def sharedobject_test_template(self, testtype, exp_rc, options):
@@ -13,6 +13,8 @@
 
 import os
 import filecmp
+import struct
+import zlib
 
 from sst_unittest import *
 from sst_unittest_support import *
@@ -59,27 +61,97 @@ class testcase_StatisticComponent(SSTTestCase):
     def test_StatisticsBasic(self):
         self.Statistics_test_template("basic")
 
+    def test_StatisticsBasic_async(self):
+        self.Statistics_test_template("basic", "basic_async", "async")
+
+    def test_StatisticsBasic_columnar(self):
+        self.Statistics_test_template("basic", "basic_columnar", "columnar")
+
+    def test_StatisticsBasic_merged(self):
+        self.Statistics_test_template("basic", "basic_merged", "merged")
+
+    # Statistic output must still be complete when teardown is skipped
+    def test_StatisticsBasic_fast_exit(self):
+        self.Statistics_test_template("basic", "basic_fast_exit", sst_options="--fast-exit")
+
+    def test_StatisticsTypes(self):
+        self.Statistics_output_test_template("types")
+
+    def test_StatisticsSample(self):
+        self.Statistics_output_test_template("sample")
+
+    # Shared statistics are merged per rank, so the output only
+    # matches the reference on a single rank
+    @unittest.skipIf(testing_check_get_num_ranks() > 1, "Test sets its own number of threads on a single rank")
+    def test_StatisticsShared(self):
+        self.Statistics_output_test_template("shared", num_threads=2)
+
+    # Groups reduce the statistics of each thread, so the output only
+    # matches the reference on a single thread
+    @unittest.skipIf(testing_check_get_num_ranks() > 1, "Test sets its own number of threads on a single rank")
+    def test_StatisticsReduce(self):
+        self.Statistics_output_test_template("reduce", num_threads=1)
+
+    # The region is read back after the run, which is only done for
+    # the single region of a one rank run
+    @unittest.skipIf(testing_check_get_num_ranks() > 1, "Test reads the region of a single rank")
+    @unittest.skipIf(not os.path.isdir("/dev/shm"), "Test reads the region from /dev/shm")
+    def test_StatisticsShm(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_StatisticsComponent_shm.py".format(testsuitedir)
+        outfile = "{0}/test_StatisticsComponent_shm.out".format(outdir)
+        name = "sst_stats_test_{0}".format(os.getpid())
+
+        self.run_sst(sdlfile, outfile, other_args="--model-options={0}".format(name))
+
+        path = "/dev/shm/{0}".format(name)
+        try:
+            finished, values = read_shm_stats(path)
+        finally:
+            os.remove(path)
+
+        self.assertEqual(finished, 1, "Statistic region {0} was not marked finished".format(path))
+        expected = ["StatInt0.{0}.{1}".format(stat, field)
+                    for stat in ("stat1_U32", "stat2_U64")
+                    for field in ("Sum", "SumSQ", "Count", "Min", "Max")]
+        self.assertEqual(sorted(values.keys()), sorted(expected))
+        self.assertEqual(values["StatInt0.stat1_U32.Count"], 100)
+        self.assertEqual(values["StatInt0.stat2_U64.Count"], 100)
+
 #####
 
-    def Statistics_test_template(self, testtype):
+    def Statistics_test_template(self, testtype, outname = None, model_options = "", sst_options = ""):
         testsuitedir = self.get_testsuite_dir()
         outdir = test_output_get_run_dir()
+        if outname is None:
+            outname = testtype
 
         sdlfile = "{0}/test_StatisticsComponent_{1}.py".format(testsuitedir, testtype)
         reffile = "{0}/refFiles/test_StatisticsComponent_{1}.out".format(testsuitedir, testtype)
-        outfile = "{0}/test_StatisticsComponent_{1}.out".format(outdir, testtype)
+        outfile = "{0}/test_StatisticsComponent_{1}.out".format(outdir, outname)
         ref_group_stat_file_csv = "{0}/refFiles/test_StatisticsComponent_{1}_group_stats.csv".format(testsuitedir, testtype)
-        out_group_stat_file_csv = "{0}/test_StatisticsComponent_{1}_group_stats.csv".format(outdir, testtype)
+        out_group_stat_file_csv = "{0}/test_StatisticsComponent_{1}_group_stats.csv".format(outdir, outname)
         ref_group_stat_file_txt = "{0}/refFiles/test_StatisticsComponent_{1}_group_stats.txt".format(testsuitedir, testtype)
-        out_group_stat_file_txt = "{0}/test_StatisticsComponent_{1}_group_stats.txt".format(outdir, testtype)
+        out_group_stat_file_txt = "{0}/test_StatisticsComponent_{1}_group_stats.txt".format(outdir, outname)
 
         # Perform the test
-        self.run_sst(sdlfile, outfile)
+        other_args = "--model-options={0}".format(model_options) if model_options else ""
+        self.run_sst(sdlfile, outfile, other_args="{0} {1}".format(other_args, sst_options).strip())
 
-        # Combine the stat output files into a single file
-        combine_per_rank_files(out_group_stat_file_txt)
+        # The columnar output replaces the CSV group, convert it back
+        # to CSV lines to check it against the same reference
+        if model_options == "columnar":
+            columnar_to_csv(out_group_stat_file_csv.replace(".csv", ".sstc"), out_group_stat_file_csv)
+
+        # Combine the stat output files into a single file, unless
+        # sst already merged them
+        if model_options != "merged":
+            combine_per_rank_files(out_group_stat_file_txt)
         # Need to skip header after the first file
-        combine_per_rank_files(out_group_stat_file_csv)
+        if model_options not in ("columnar", "merged"):
+            combine_per_rank_files(out_group_stat_file_csv)
 
         filter1 = StartsWithFilter("WARNING: No components are")
         cmp_result = testing_compare_filtered_diff(testtype, outfile, reffile, True, [filter1])
@@ -91,3 +163,112 @@ class testcase_StatisticComponent(SSTTestCase):
 
         cmp_result = testing_compare_filtered_diff(testtype, out_group_stat_file_txt, ref_group_stat_file_txt, True)
         self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(out_group_stat_file_txt, ref_group_stat_file_txt))
+
+    def Statistics_output_test_template(self, testtype, num_threads=None):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_StatisticsComponent_{1}.py".format(testsuitedir, testtype)
+        reffile = "{0}/refFiles/test_StatisticsComponent_{1}.out".format(testsuitedir, testtype)
+        outfile = "{0}/test_StatisticsComponent_{1}.out".format(outdir, testtype)
+
+        self.run_sst(sdlfile, outfile, num_threads=num_threads)
+
+        filter1 = StartsWithFilter("WARNING: No components are")
+        cmp_result = testing_compare_filtered_diff(testtype, outfile, reffile, True, [filter1])
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile, reffile))
+
+#####
+
+def columnar_to_csv(sstc_file, csv_file):
+    """Decode a statoutputcolumnar file into the lines the CSV output
+    writes with outputrank off.  Per rank files are concatenated first,
+    which must give a valid columnar file.
+    """
+    ranks = testing_check_get_num_ranks()
+    if ranks == 1:
+        names = [sstc_file]
+    else:
+        base, ext = os.path.splitext(sstc_file)
+        names = ["{0}_{1}{2}".format(base, x, ext) for x in range(ranks)]
+    data = b"".join(open(name, "rb").read() for name in names)
+
+    def read_block(pos):
+        encoding, raw_size, stored_size = struct.unpack_from("<BQQ", data, pos)
+        pos += 17
+        block = data[pos:pos + stored_size]
+        if encoding == 1:
+            block = zlib.decompress(block)
+        assert len(block) == raw_size
+        return block, pos + stored_size
+
+    def read_name(pos):
+        (length,) = struct.unpack_from("<H", data, pos)
+        return data[pos + 2:pos + 2 + length].decode(), pos + 2 + length
+
+    formats = {"str" : "I", "i32" : "i", "u32" : "I", "i64" : "q", "u64" : "Q", "f32" : "f", "f64" : "d"}
+    lines = []
+    pos = 0
+    while pos < len(data):
+        magic, version, _, _, num_cols, num_rows = struct.unpack_from("<4sHHIIQ", data, pos)
+        assert magic == b"SSTC" and version == 1
+        pos += 24
+        block, pos = read_block(pos)
+        (num_strings,) = struct.unpack_from("<I", block, 0)
+        strings = []
+        spos = 4
+        for _ in range(num_strings):
+            (length,) = struct.unpack_from("<I", block, spos)
+            strings.append(block[spos + 4:spos + 4 + length].decode())
+            spos += 4 + length
+
+        columns = []
+        for _ in range(num_cols):
+            _, pos = read_name(pos)
+            col_type, pos = read_name(pos)
+            block, pos = read_block(pos)
+            values = struct.unpack("<{0}{1}".format(num_rows, formats[col_type]), block)
+            if col_type == "str":
+                values = [strings[x] for x in values]
+            elif col_type[0] == "f":
+                values = ["{0:f}".format(x) for x in values]
+            else:
+                values = [str(x) for x in values]
+            columns.append(values)
+
+        for row in range(num_rows):
+            lines.append(", ".join(col[row] for col in columns) + "\n")
+
+    with open(csv_file, "w") as fp:
+        fp.writelines(lines)
+
+def read_shm_stats(path):
+    """Read a statoutputshm region, using its sequence lock the same
+    way a monitor would.  Returns the finished flag and a dictionary
+    of the values by name.
+    """
+    with open(path, "rb") as fp:
+        data = fp.read()
+
+    header = struct.Struct("=8sIIQQQQII32sQQQ")
+    entry = struct.Struct("=IIQ")
+    (magic, version, rank, region_size, entries_offset, names_offset, names_size,
+     max_entries, num_entries, time_base, seq, sim_time, finished) = header.unpack_from(data, 0)
+    if magic != b"SSTSTATS" or version != 1:
+        raise ValueError("{0} is not a statistic region".format(path))
+    if seq % 2 != 0:
+        raise ValueError("{0} was left in the middle of an update".format(path))
+
+    values = {}
+    for i in range(num_entries):
+        name_offset, value_type, bits = entry.unpack_from(data, entries_offset + i * entry.size)
+        start = names_offset + name_offset
+        name = data[start:data.index(b"\0", start)].decode()
+        if value_type == 0:
+            value = struct.unpack("=q", struct.pack("=Q", bits))[0]
+        elif value_type == 1:
+            value = bits
+        else:
+            value = struct.unpack("=d", struct.pack("=Q", bits))[0]
+        values[name] = value
+    return finished, values
@@ -0,0 +1,83 @@
+# -*- coding: utf-8 -*-
+#
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+import os
+import sys
+
+from sst_unittest import *
+from sst_unittest_support import *
+
+################################################################################
+# Code to support a single instance module initialize, must be called setUp method
+
+module_init = 0
+module_sema = threading.Semaphore()
+
+def initializeTestModule_SingleInstance(class_inst):
+    global module_init
+    global module_sema
+
+    module_sema.acquire()
+    if module_init != 1:
+        # Put your single instance Init Code Here
+        module_init = 1
+    module_sema.release()
+
+################################################################################
+
+class testcase_ThreadSync(SSTTestCase):
+
+    def initializeClass(self, testName):
+        super(type(self), self).initializeClass(testName)
+        # Put test based setup code here. it is called before testing starts
+        # NOTE: This method is called once for every test
+
+    def setUp(self):
+        super(type(self), self).setUp()
+        initializeTestModule_SingleInstance(self)
+        # Put test based setup code here. it is called once before every test
+
+    def tearDown(self):
+        # Put test based teardown code here. it is called once after every test
+        super(type(self), self).tearDown()
+
+###
+
+
+    def test_simple_skip_lookahead(self):
+        self.threadsync_test_template("simple_skip_lookahead", "6 6", "--interthread-lookahead")
+
+    def test_direct_skip_lookahead(self):
+        self.threadsync_test_template("direct_skip_lookahead", "6 6", "--interthread-links --interthread-lookahead")
+
+#####
+
+    def threadsync_test_template(self, testtype, model_options, sync_options):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        options = "--model-options=\"{0}\"".format(model_options)
+
+        # Set the various file paths
+        sdlfile = "{0}/test_MessageMesh.py".format(testsuitedir)
+        outfile_ref = "{0}/test_threadsync_ref_{1}.out".format(outdir, testtype)
+        outfile_check = "{0}/test_threadsync_check_{1}.out".format(outdir, testtype)
+
+        # Do a serial reference run, then run the same model across
+        # threads using the requested sync options
+        self.run_sst(sdlfile, outfile_ref, other_args=options, num_ranks=1, num_threads=1)
+        self.run_sst(sdlfile, outfile_check, other_args="{0} {1}".format(options, sync_options), num_ranks=1, num_threads=3)
+
+        # Perform the test
+        cmp_result = testing_compare_sorted_diff(testtype, outfile_ref, outfile_check)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile_ref, outfile_check))
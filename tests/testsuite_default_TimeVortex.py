@@ -0,0 +1,124 @@
+# -*- coding: utf-8 -*-
+#
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+from sst_unittest import *
+from sst_unittest_support import *
+
+################################################################################
+# Code to support a single instance module initialize, must be called setUp method
+
+module_init = 0
+module_sema = threading.Semaphore()
+
+def initializeTestModule_SingleInstance(class_inst):
+    global module_init
+    global module_sema
+
+    module_sema.acquire()
+    if module_init != 1:
+        # Put your single instance Init Code Here
+        module_init = 1
+    module_sema.release()
+
+################################################################################
+
+class testcase_TimeVortex(SSTTestCase):
+
+    def initializeClass(self, testName):
+        super(type(self), self).initializeClass(testName)
+        # Put test based setup code here. it is called before testing starts
+        # NOTE: This method is called once for every test
+
+    def setUp(self):
+        super(type(self), self).setUp()
+        initializeTestModule_SingleInstance(self)
+        # Put test based setup code here. it is called once before every test
+
+    def tearDown(self):
+        # Put test based teardown code here. it is called once after every test
+        super(type(self), self).tearDown()
+
+#####
+
+    def test_TimeVortex_priority_queue(self):
+        self.timevortex_test_template("priority_queue")
+
+    def test_TimeVortex_priority_queue_staged(self):
+        self.timevortex_test_template("priority_queue.staged")
+
+    def test_TimeVortex_calendar_queue(self):
+        self.timevortex_test_template("calendar_queue")
+
+    def test_TimeVortex_ring_binned(self):
+        self.timevortex_test_template("ring.binned")
+
+    def test_TimeVortex_dheap(self):
+        self.timevortex_test_template("dheap")
+
+    def test_TimeVortex_simdheap(self):
+        self.timevortex_test_template("simdheap")
+
+    def test_TimeVortex_bucketed(self):
+        self.timevortex_test_template("bucketed")
+
+    def test_TimeVortex_adaptive(self):
+        self.timevortex_test_template("adaptive")
+
+    # A short horizon and small runs so most events go through the
+    # spill file
+    def test_TimeVortex_spill(self):
+        self.timevortex_test_template("spill", "--timeVortex-params=horizon=10ns,spill_size=64,block_size=16")
+
+    # Small staging buffers so most inserts from the other thread go
+    # through the overflow list
+    @unittest.skipIf(testing_check_get_num_ranks() > 1, "Test only supports single rank runs")
+    def test_TimeVortex_priority_queue_staged_order(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_TimeVortexOrder.py".format(testsuitedir)
+        outfile = "{0}/test_TimeVortex_priority_queue_staged_order.out".format(outdir)
+
+        # The components fail the run if messages arrive out of order
+        self.run_sst(sdlfile, outfile, num_threads=2, other_args="--interthread-links --timeVortex=sst.timevortex.priority_queue.staged --timeVortex-params=staging_size=2")
+
+    def test_TimeVortex_benchmark(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_TimeVortexBenchmark.py".format(testsuitedir)
+        reffile = "{0}/refFiles/test_TimeVortexBenchmark.out".format(testsuitedir)
+        outfile = "{0}/test_TimeVortexBenchmark.out".format(outdir)
+
+        self.run_sst(sdlfile, outfile)
+
+        cmp_result = testing_compare_sorted_diff("TimeVortexBenchmark", outfile, reffile)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile, reffile))
+
+#####
+
+    # Every TimeVortex must deliver activities in the same order, so
+    # each implementation is checked against the standard Component
+    # test reference output
+    def timevortex_test_template(self, vortex, extra_args=""):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_Component.py".format(testsuitedir)
+        reffile = "{0}/refFiles/test_Component.out".format(testsuitedir)
+        outfile = "{0}/test_TimeVortex_{1}.out".format(outdir, vortex)
+
+        self.run_sst(sdlfile, outfile, other_args="--timeVortex=sst.timevortex.{0} {1}".format(vortex, extra_args))
+
+        cmp_result = testing_compare_sorted_diff("TimeVortex_{0}".format(vortex), outfile, reffile)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile, reffile))
@@ -11,7 +11,10 @@
 # information, see the LICENSE file in the top level directory of the
 # distribution.
 
+import collections
+import json
 import os
+import shutil
 import sys
 
 from sst_unittest import *
@@ -71,25 +74,119 @@ class testcase_Config_input_output(SSTTestCase):
     def test_json_io_comp(self):
         self.configio_test_template("json_io_comp", "", "json", False, "NONE", True)
 
+    def test_json_io_links_first(self):
+        # The loader streams the file, so links that come before the
+        # components they connect must still be found
+        self.configio_test_template("json_io_links_first", "6 6", "json", False, "NONE", links_first=True)
+
     @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
     def test_json_io_parallel(self):
         self.configio_test_template("json_io_parallel", "6 6", "json", True, "MULTI")
 
+    def test_binary_io(self):
+        self.configio_test_template("binary_io", "6 6", "sstgraph", False, "NONE")
+
+    def test_binary_io_comp(self):
+        self.configio_test_template("binary_io_comp", "", "sstgraph", False, "NONE", True)
+
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    def test_binary_io_parallel(self):
+        self.configio_test_template("binary_io_parallel", "6 6", "sstgraph", True, "MULTI")
+
 
     @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
     def test_python_single_parallel_load(self):
         self.configio_test_template("python_single_parallel_load", "6 6", "py", False, "SINGLE")
 
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    def test_python_replicate_parallel_load(self):
+        self.configio_test_template("python_replicate_parallel_load", "6 6", "py", False, "REPLICATE")
+
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    def test_python_node_parallel_load(self):
+        self.configio_test_template("python_node_parallel_load", "6 6", "py", False, "NODE")
+
+
+    def test_model_cache(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        cachedir = "{0}/test_model_cache".format(outdir)
+        shutil.rmtree(cachedir, ignore_errors=True)
+        options = "--model-options=\"6 6\" --model-cache={0}".format(cachedir)
+
+        sdlfile = "{0}/test_MessageMesh.py".format(testsuitedir)
+        outfile_first = "{0}/test_model_cache_first.out".format(outdir)
+        outfile_cached = "{0}/test_model_cache_cached.out".format(outdir)
+
+        # The first run saves the graph and the second one loads it
+        # without saving it again
+        self.run_sst(sdlfile, outfile_first, other_args=options)
+        entries = [f for f in os.listdir(cachedir) if f.endswith(".deps")]
+        self.assertEqual(len(entries), 1, "Model cache {0} has {1} entries, expected 1".format(cachedir, len(entries)))
+        entry = "{0}/{1}".format(cachedir, entries[0])
+        saved = os.stat(entry).st_mtime_ns
+
+        self.run_sst(sdlfile, outfile_cached, other_args=options)
+        self.assertEqual(saved, os.stat(entry).st_mtime_ns, "Model cache entry {0} was saved again".format(entry))
+
+        # Only the cached run says which entry it used
+        with open(outfile_cached) as f:
+            self.assertIn("from the model cache entry {0}".format(entry[:-len(".deps")] + ".sstgraph"), f.read())
+
+        # A different key doesn't use the entry
+        options += " --model-cache-key=other"
+        outfile_key = "{0}/test_model_cache_key.out".format(outdir)
+        self.run_sst(sdlfile, outfile_key, other_args=options)
+        with open(outfile_key) as f:
+            self.assertNotIn("from the model cache entry", f.read())
+        self.assertEqual(len([f for f in os.listdir(cachedir) if f.endswith(".deps")]), 2)
+
+        filters = [ StartsWithFilter("# Loaded ") ]
+        cmp_result = testing_compare_filtered_diff("model_cache", outfile_cached, outfile_first, True, filters)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile_cached, outfile_first))
+
+    def test_model_cache_graph(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        cachedir = "{0}/test_model_cache_graph".format(outdir)
+        shutil.rmtree(cachedir, ignore_errors=True)
+        sdlfile = "{0}/test_ModelCache.py".format(testsuitedir)
+        json_file = "{0}/test_model_cache_graph.json".format(outdir)
+
+        # Only the parameters change in the second run, so the graph
+        # comes from the cache and the overrides and the extra
+        # component are added to it.  The third run changes the graph.
+        runs = [ ("8 1000", "False"), ("8 500", "True"), ("9 500", "False") ]
+        for i, (model_options, cached) in enumerate(runs):
+            outfile = "{0}/test_model_cache_graph_{1}.out".format(outdir, i)
+            options = "--model-options=\"{0}\" --model-cache={1} --output-json={2}".format(model_options, cachedir, json_file)
+            self.run_sst(sdlfile, outfile, other_args=options)
+
+            expected = "Graph loaded from the model cache: {0}".format(cached)
+            with open(outfile) as f:
+                self.assertIn(expected, f.read(), "Output file {0} does not contain \"{1}\"".format(outfile, expected))
+
+            size, work = model_options.split()
+            with open(json_file) as f:
+                comps = json.load(f)["components"]
+            names = sorted(comp["name"] for comp in comps)
+            expected_names = sorted(["c{0}".format(n) for n in range(int(size))] + ["extra"])
+            self.assertEqual(names, expected_names, "Run {0} has components {1}, expected {2}".format(i, names, expected_names))
+            for comp in comps:
+                self.assertEqual(comp["params"]["workPerCycle"], work, "Parameter override not applied to {0}".format(comp["name"]))
 
 #####
 
-    def configio_test_template(self, testtype, model_options, output_type, parallel_io, load_mode, use_component_test=False):
+    def configio_test_template(self, testtype, model_options, output_type, parallel_io, load_mode, use_component_test=False, links_first=False):
         testsuitedir = self.get_testsuite_dir()
         outdir = test_output_get_run_dir()
 
         output_config = "{0}/test_configio_{1}.{2}".format(outdir,testtype,output_type)
         if ( output_type == "py" ): out_flag = "--output-config"
         elif ( output_type == "json"): out_flag = "--output-json"
+        elif ( output_type == "sstgraph"): out_flag = "--output-binary"
         else:
             print("Unknown output type: {0}".format(output_type))
             sys.exit(1)
@@ -115,6 +212,14 @@ class testcase_Config_input_output(SSTTestCase):
         outfile_check = "{0}/test_configio_check_{1}.out".format(outdir, testtype)
 
         self.run_sst(sdlfile, outfile_ref, other_args=options_ref)
+
+        if links_first:
+            with open(output_config) as f:
+                model = json.load(f, object_pairs_hook=collections.OrderedDict)
+            model.move_to_end("links", last=False)
+            with open(output_config, "w") as f:
+                json.dump(model, f, indent=2)
+
         self.run_sst(output_config, outfile_check, other_args=options_check, check_sdl_file=False)
 
         # Perform the test
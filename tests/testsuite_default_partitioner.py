@@ -63,13 +63,63 @@ class testcase_Partitioners(SSTTestCase):
     def test_simple(self):
         self.partitioner_test_template("simple", "6 6", "sst.simple")
 
+    def test_weighted(self):
+        self.partitioner_test_template("weighted", "6 6", "sst.weighted")
+
+    def test_multilevel(self):
+        self.partitioner_test_template("multilevel", "6 6", "sst.multilevel")
+
+    def test_geometric(self):
+        self.partitioner_test_template("geometric", "6 6", "sst.geometric")
+
+    def test_weighted_profile(self):
+        self.partitioner_test_template("weighted_profile", "6 6", "sst.weighted", "test_partitioner_weights.txt")
+
+    def test_partition_report(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        options = "--model-options=\"6 6\" --partitioner=sst.multilevel --partition-only"
+        sdlfile = "{0}/test_MessageMesh.py".format(testsuitedir)
+        outfile = "{0}/test_partitioner_report.out".format(outdir)
+
+        self.run_sst(sdlfile, outfile, other_args=options)
+
+        with open(outfile, 'r') as f:
+            output = f.read()
+        self.assertTrue("# Partition report (sst.multilevel" in output, "Output file {0} has no partition report".format(outfile))
+        self.assertFalse("Simulation is complete" in output, "Simulation ran despite --partition-only")
+
+    def test_partition_cache(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        cachefile = "{0}/test_partitioner_cache.bin".format(outdir)
+        if os.path.exists(cachefile):
+            os.remove(cachefile)
+        options = "--model-options=\"6 6\" --partitioner=sst.multilevel --partition-cache={0}".format(cachefile)
+
+        sdlfile = "{0}/test_MessageMesh.py".format(testsuitedir)
+        outfile_first = "{0}/test_partitioner_cache_first.out".format(outdir)
+        outfile_cached = "{0}/test_partitioner_cache_cached.out".format(outdir)
+
+        # The first run writes the cache and the second one reads it back
+        self.run_sst(sdlfile, outfile_first, other_args=options)
+        self.assertTrue(os.path.exists(cachefile), "Partition cache {0} was not written".format(cachefile))
+        self.run_sst(sdlfile, outfile_cached, other_args=options)
+
+        cmp_result = testing_compare_sorted_diff("partition_cache", outfile_first, outfile_cached)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile_cached, outfile_first))
+
 #####
 
-    def partitioner_test_template(self, testtype, model_options, partitioner):
+    def partitioner_test_template(self, testtype, model_options, partitioner, weights_file=None):
         testsuitedir = self.get_testsuite_dir()
         outdir = test_output_get_run_dir()
 
         options = "--model-options=\"{0}\" --partitioner={1}".format(model_options, partitioner);
+        if weights_file:
+            options += " --partition-weights={0}/{1}".format(testsuitedir, weights_file)
         
         # Set the various file paths
         sdlfile = "{0}/test_MessageMesh.py".format(testsuitedir)
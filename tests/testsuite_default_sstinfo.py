@@ -14,6 +14,8 @@
 from sst_unittest import *
 from sst_unittest_support import *
 
+import tempfile
+
 ################################################################################
 # Code to support a single instance module initialize, must be called setUp method
 
@@ -53,22 +55,51 @@ class testcase_sstinfo(SSTTestCase):
     def test_sstinfo_coretestelement(self):
         self.sstinfo_test_template("coreTestElement")
 
+    def test_sstinfo_element_cache(self):
+        outdir = test_output_get_run_dir()
+        cachedir = tempfile.mkdtemp(prefix="test_sstinfo_element_cache_", dir=outdir)
+        cachefile = "{0}/element_cache.txt".format(cachedir)
+
+        # The first load searches the library path and creates the cache
+        self.sstinfo_test_template("coreTestElement", "element_cache", "--element-cache={0}".format(cachefile))
+        self.assertTrue(os.path.isfile(cachefile), "Element cache {0} was not created".format(cachefile))
+
+        # The cache should hold the location of the library that was processed
+        with open(cachefile, 'r') as f:
+            entries = [line.split('\t') for line in f.read().splitlines()[2:]]
+        libs = [x[0] for x in entries if len(x) == 2]
+        self.assertTrue("coreTestElement" in libs, "Element cache {0} has no entry for coreTestElement".format(cachefile))
+
+        # The second load should open the library straight from the cache
+        env = dict(os.environ)
+        env["SST_CORE_ELEMENT_CACHE"] = cachefile
+        env["SST_CORE_DL_VERBOSE"] = "1"
+        outfile = self.sstinfo_test_template("coreTestElement", "element_cache_used", env = env)
+        with open(outfile, 'r') as f:
+            output = f.read()
+        self.assertTrue("from element cache" in output,
+                        "Element cache {0} was not used, see {1}".format(cachefile, outfile))
+        self.assertFalse("Loading from element cache failed" in output,
+                         "Loading from element cache {0} failed, see {1}".format(cachefile, outfile))
+
 #####
 
-    def sstinfo_test_template(self, testtype):
+    def sstinfo_test_template(self, testtype, outname = None, other_args = "", env = None):
         testsuitedir = self.get_testsuite_dir()
         outdir = test_output_get_run_dir()
+        if outname is None:
+            outname = testtype
 
-        outfile = "{0}/test_sstinfo_{1}.out".format(outdir, testtype)
-        errfile = "{0}/test_sstinfo_{1}.err".format(outdir, testtype)
+        outfile = "{0}/test_sstinfo_{1}.out".format(outdir, outname)
+        errfile = "{0}/test_sstinfo_{1}.err".format(outdir, outname)
 
         # Get the path to sst-info binary application
         sst_app_path = sstsimulator_conf_get_value_str('SSTCore', 'bindir', default="UNDEFINED")
         err_str = "Path to SST-INFO {0}; does not exist...".format(sst_app_path)
         self.assertTrue(os.path.isdir(sst_app_path), err_str)
 
-        cmd = '{0}/sst-info -q {1}'.format(sst_app_path, testtype)
-        rtn = OSCommand(cmd, output_file_path = outfile, error_file_path = errfile).run()
+        cmd = '{0}/sst-info -q {1} {2}'.format(sst_app_path, other_args, testtype)
+        rtn = OSCommand(cmd, output_file_path = outfile, error_file_path = errfile).run(env = env)
         if rtn.result() != 0:
             self.assertEquals(rtn.result(), 0, "sst-info Test failed running cmdline {0} - return = {1}".format(cmd, rtn.result()))
             with open(outfile, 'r') as f:
@@ -79,3 +110,5 @@ class testcase_sstinfo(SSTTestCase):
             self.assertFalse(err_file_not_empty, "sst-info Test failed because the error file is not empty".format(cmd, rtn.result()))
             with open(errfile, 'r') as f:
                 log_failure("FAILURE: sst-info cmdline {0}; error output =\n{1}".format(cmd, f.read()))
+
+        return outfile